@@ -0,0 +1,164 @@
+// Benchmark entry point.
+// Generates synthetic OBJ files from 10K to 10M faces and times ObjParser over them,
+// single threaded and chunked across the thread pool, reporting throughput in MB/s and triangles/s.
+// Usage: Benchmark [maxFaces]
+
+// Below ifdef required to remove warnings for unsafe version of fopen.
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "ObjParser.h"
+
+// Writes a grid mesh with roughly the requested number of triangle faces, returns the file size in bytes.
+static long writeSyntheticObj(const char* filename, int faceCount)
+{
+	FILE* file = fopen(filename, "w");
+	if (file == NULL)
+	{
+		return 0;
+	}
+
+	// Square grid of quads, two triangles per quad.
+	int quads = (faceCount + 1) / 2;
+	int side = 1;
+	while (side * side < quads)
+	{
+		side++;
+	}
+
+	fprintf(file, "# Synthetic benchmark mesh, %d faces\n", faceCount);
+	for (int z = 0; z <= side; z++)
+	{
+		for (int x = 0; x <= side; x++)
+		{
+			fprintf(file, "v %f %f %f\n", x * 0.5f - side * 0.25f, 0.0f, z * -0.5f);
+		}
+	}
+	for (int z = 0; z <= side; z++)
+	{
+		for (int x = 0; x <= side; x++)
+		{
+			fprintf(file, "vt %f %f\n", (float)x / side, (float)z / side);
+		}
+	}
+	fprintf(file, "vn 0.000000 1.000000 0.000000\n");
+
+	// Every other row uses relative (negative) indices, counted back from the last v, vt and vn, so chunks after the
+	// first have to be offset by the counts before them when the parallel parse merges.
+	int count = (side + 1) * (side + 1);
+	int written = 0;
+	for (int z = 0; z < side && written < faceCount; z++)
+	{
+		int offset = z % 2 == 1 ? -(count + 1) : 0;
+		int normal = z % 2 == 1 ? -1 : 1;
+		for (int x = 0; x < side && written < faceCount; x++)
+		{
+			int a = z * (side + 1) + x + 1 + offset;
+			int b = a + 1;
+			int c = a + side + 1;
+			int d = c + 1;
+			if (written % 4096 == 0)
+			{
+				fprintf(file, "usemtl material_%d\n", (written / 4096) % 8);
+			}
+			fprintf(file, "f %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, normal, c, c, normal, b, b, normal);
+			written++;
+			if (written < faceCount)
+			{
+				fprintf(file, "f %d/%d/%d %d/%d/%d %d/%d/%d\n", b, b, normal, c, c, normal, d, d, normal);
+				written++;
+			}
+		}
+	}
+
+	long size = ftell(file);
+	fclose(file);
+	return size;
+}
+
+// Best time in seconds of a few parses, so the first run warms the file cache. Returns -1 on failure.
+static double timeParse(const char* filename, int faces, bool parallel, ObjData& out)
+{
+	double best = -1.0;
+	for (int run = 0; run < 3; run++)
+	{
+		out.clear();
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		bool result = parallel ? ObjParser::parseFileParallel(filename, out) : ObjParser::parseFile(filename, out);
+		std::chrono::high_resolution_clock::time_point finish = std::chrono::high_resolution_clock::now();
+		if (!result || out.faces.size() != (size_t)faces * 9)
+		{
+			return -1.0;
+		}
+
+		double seconds = std::chrono::duration<double>(finish - start).count();
+		if (best < 0.0 || seconds < best)
+		{
+			best = seconds;
+		}
+	}
+	return best;
+}
+
+// Byte for byte comparison of two parse results.
+static bool sameData(const ObjData& a, const ObjData& b)
+{
+	return a.verts.size() == b.verts.size() && a.texCs.size() == b.texCs.size() && a.norms.size() == b.norms.size() &&
+		a.faces.size() == b.faces.size() && a.materialNames == b.materialNames && a.materialRanges.size() == b.materialRanges.size() &&
+		(a.verts.empty() || memcmp(a.verts.data(), b.verts.data(), a.verts.size() * sizeof(Vector3)) == 0) &&
+		(a.texCs.empty() || memcmp(a.texCs.data(), b.texCs.data(), a.texCs.size() * sizeof(Vector3)) == 0) &&
+		(a.norms.empty() || memcmp(a.norms.data(), b.norms.data(), a.norms.size() * sizeof(Vector3)) == 0) &&
+		(a.faces.empty() || memcmp(a.faces.data(), b.faces.data(), a.faces.size() * sizeof(unsigned int)) == 0) &&
+		(a.materialRanges.empty() || memcmp(a.materialRanges.data(), b.materialRanges.data(), a.materialRanges.size() * sizeof(ObjMaterialRange)) == 0);
+}
+
+int main(int argc, char** argv)
+{
+	int maxFaces = 10000000;
+	if (argc > 1)
+	{
+		maxFaces = atoi(argv[1]);
+	}
+
+	const char* filename = "benchmark_synthetic.obj";
+
+	printf("Worker threads: %u\n", ThreadPool::shared().size());
+	printf("%12s %12s %10s %12s %12s %16s\n", "faces", "size (MB)", "parser", "time (ms)", "MB/s", "triangles/s");
+	for (int faces = 10000; faces <= maxFaces; faces *= 10)
+	{
+		long bytes = writeSyntheticObj(filename, faces);
+		if (bytes == 0)
+		{
+			printf("Failed to write %s\n", filename);
+			return 1;
+		}
+
+		ObjData serial, parallel;
+		double serialTime = timeParse(filename, faces, false, serial);
+		double parallelTime = timeParse(filename, faces, true, parallel);
+		if (serialTime < 0.0 || parallelTime < 0.0)
+		{
+			printf("Parse failed for %d faces\n", faces);
+			remove(filename);
+			return 1;
+		}
+		if (!sameData(serial, parallel))
+		{
+			printf("Parallel parse differs from single threaded parse for %d faces\n", faces);
+			remove(filename);
+			return 1;
+		}
+
+		double megabytes = bytes / (1024.0 * 1024.0);
+		printf("%12d %12.2f %10s %12.2f %12.1f %16.0f\n", faces, megabytes, "serial", serialTime * 1000.0, megabytes / serialTime, faces / serialTime);
+		printf("%12s %12s %10s %12.2f %12.1f %16.0f\n", "", "", "parallel", parallelTime * 1000.0, megabytes / parallelTime, faces / parallelTime);
+	}
+
+	remove(filename);
+	return 0;
+}
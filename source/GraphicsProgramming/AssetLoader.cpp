@@ -0,0 +1,146 @@
+#include "AssetLoader.h"
+#include "GLState.h"
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+
+AssetLoader::AssetLoader(unsigned int threadCount) : pendingCount(0), placeholder(0), workers(threadCount)
+{
+}
+
+AssetLoader::~AssetLoader()
+{
+	// workers is declared last so its destructor joins the threads before the queue they push to is destroyed.
+	// Anything still waiting for upload is dropped.
+}
+
+void AssetLoader::init()
+{
+	const GLubyte grey[] = { 128, 128, 128 };
+
+	glGenTextures(1, &placeholder);
+	GLState::bindTexture(placeholder);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, grey);
+	// No mipmaps, so the default mipmapped min filter would leave the texture incomplete.
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	GLState::bindTexture(0);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+void AssetLoader::queueUpload(const Upload& upload)
+{
+	std::lock_guard<std::mutex> lock(uploadMutex);
+	uploads.push_back(upload);
+}
+
+void AssetLoader::loadModel(Model* model, const char* modelFilename, const char* textureFilename, const char* mtlFilename)
+{
+	pendingCount++;
+
+	// Copies, the caller's strings may be gone by the time the job runs.
+	std::string modelName = modelFilename;
+	std::string textureName = textureFilename != NULL ? textureFilename : "";
+	std::string mtlName = mtlFilename != NULL ? mtlFilename : "";
+
+	workers.submit([this, model, modelName, textureName, mtlName]()
+	{
+		if (!model->loadData(modelName.c_str(), textureName.empty() ? NULL : textureName.c_str(), mtlName.empty() ? NULL : mtlName.c_str()))
+		{
+			printf("AssetLoader: model '%s' failed to load\n", modelName.c_str());
+			pendingCount--;
+			return;
+		}
+
+		// One texture per step, so a model with many materials is spread over several frames.
+		queueUpload([this, model]()
+		{
+			if (!model->uploadStep())
+			{
+				return false;
+			}
+			pendingCount--;
+			return true;
+		});
+	});
+}
+
+void AssetLoader::loadTexture(GLuint* target, const char* filename, unsigned int flags)
+{
+	std::string name = filename;
+	loadCached(target, name, flags, [name, flags](DecodedImage& image) { return TextureLoader::decode(name.c_str(), flags, image); });
+}
+
+void AssetLoader::loadAtlas(GLuint* target, const char* left, const char* right, unsigned int flags)
+{
+	// Named after both files, so it's shared like any other texture and never confused with a different pair.
+	std::string leftName = left, rightName = right;
+	loadCached(target, "atlas:" + leftName + "|" + rightName, flags,
+		[leftName, rightName](DecodedImage& image) { return TextureLoader::decodeAtlas(leftName.c_str(), rightName.c_str(), image); });
+}
+
+void AssetLoader::loadCached(GLuint* target, const std::string& name, unsigned int flags, const Decode& decode)
+{
+	// Shared with anything else that has loaded the same image.
+	GLuint cached = TextureCache::shared().find(name.c_str(), flags);
+	if (cached != 0)
+	{
+		*target = cached;
+		return;
+	}
+
+	pendingCount++;
+	*target = placeholder;
+
+	workers.submit([this, target, name, flags, decode]()
+	{
+		std::shared_ptr<DecodedImage> image = std::make_shared<DecodedImage>();
+		if (!decode(*image))
+		{
+			pendingCount--;
+			return;
+		}
+
+		queueUpload([this, target, name, image, flags]()
+		{
+			GLuint texture = TextureCache::shared().add(name.c_str(), flags, *image);
+			TextureLoader::release(*image);
+			if (texture != 0)
+			{
+				*target = texture;
+			}
+			pendingCount--;
+			return true;
+		});
+	});
+}
+
+void AssetLoader::update(float budgetMs)
+{
+	typedef std::chrono::high_resolution_clock Clock;
+	Clock::time_point start = Clock::now();
+
+	do
+	{
+		Upload upload;
+		{
+			std::lock_guard<std::mutex> lock(uploadMutex);
+			if (uploads.empty())
+			{
+				return;
+			}
+			upload = uploads.front();
+		}
+
+		// Only this thread removes uploads, so the front is still the one just run.
+		bool finished = upload();
+		{
+			std::lock_guard<std::mutex> lock(uploadMutex);
+			if (finished)
+			{
+				uploads.pop_front();
+			}
+		}
+	} while (std::chrono::duration<float, std::milli>(Clock::now() - start).count() < budgetMs);
+}
@@ -0,0 +1,66 @@
+// AssetLoader class, loads models and textures in the background so the first frame doesn't wait on them.
+// Parsing and image decoding run on the loader's worker threads, anything that touches GL is queued
+// back to the render thread and run a slice at a time by update().
+// Until an asset is resident textures point at a flat grey placeholder and models draw their bounding box.
+#ifndef _ASSETLOADER_H_
+#define _ASSETLOADER_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <deque>
+#include <string>
+#include <functional>
+#include <mutex>
+#include <atomic>
+#include "ThreadPool.h"
+#include "TextureLoader.h"
+#include "TextureCache.h"
+#include "Model.h"
+
+class AssetLoader
+{
+
+public:
+	// Workers are separate from ThreadPool::shared() as model loads use that pool to parse and decode in parallel.
+	// 0 threads uses one per hardware thread, so a batch of textures decodes on every core.
+	AssetLoader(unsigned int threadCount = 0);
+	~AssetLoader();
+
+	// Creates the placeholder texture, call once the GL context exists.
+	void init();
+
+	// Queues a model load. Filenames are copied, the model must outlive the loader.
+	void loadModel(Model* model, const char* modelFilename, const char* textureFilename, const char* mtlFilename);
+	// Queues a texture load through TextureCache::shared(), the texture holds a reference from the cache.
+	// target is set to the placeholder now and to the real texture once uploaded.
+	void loadTexture(GLuint* target, const char* filename, unsigned int flags = TextureLoader::defaultFlags);
+	// Queues a load of two textures as one atlas, see TextureLoader::decodeAtlas, cached and set like loadTexture.
+	// Nothing is built until both images are decoded, so the atlas never holds the placeholder.
+	void loadAtlas(GLuint* target, const char* left, const char* right, unsigned int flags = TextureLoader::defaultFlags);
+
+	// Runs queued uploads on the render thread until budgetMs has passed, always running at least one.
+	void update(float budgetMs);
+
+	// Loads not yet resident.
+	int pending() const { return pendingCount; };
+	GLuint placeholderTexture() const { return placeholder; };
+
+private:
+	AssetLoader(const AssetLoader&);
+	AssetLoader& operator=(const AssetLoader&);
+
+	// An upload step run on the render thread, returns true when finished or false to be run again next.
+	typedef std::function<bool()> Upload;
+	void queueUpload(const Upload& upload);
+	// Decodes on a worker and uploads through TextureCache::shared() as name, unless the cache already has it.
+	typedef std::function<bool(DecodedImage&)> Decode;
+	void loadCached(GLuint* target, const std::string& name, unsigned int flags, const Decode& decode);
+
+	std::mutex uploadMutex;
+	std::deque<Upload> uploads;
+	std::atomic<int> pendingCount;
+	GLuint placeholder;
+	ThreadPool workers;
+};
+
+#endif
@@ -0,0 +1,14 @@
+// AtlasLayout, where the two images of a two texture atlas sit. Shared by TextureLoader::decodeAtlas, which builds the
+// atlas, and ShapeGen::genCuboid, which maps the tram rail's texture co-ordinates into it. Makes no GL calls.
+#ifndef _ATLASLAYOUT_H_
+#define _ATLASLAYOUT_H_
+
+struct AtlasLayout
+{
+	// Gutter either side of each atlas image, as a fraction of its half's width.
+	static constexpr float gutter = 0.1f;
+	// Atlas u of u in an image's own texture co-ordinates, for the left (0) or right (1) half.
+	static constexpr float u(int half, float u) { return (half + gutter + u * (1.0f - 2.0f * gutter)) * 0.5f; };
+};
+
+#endif
@@ -0,0 +1,4 @@
+#include "BakedShapes.h"
+
+// Tables of BakedTables and its definitions, generated by ShapeBake.
+#include "BakedTables.inl"
@@ -0,0 +1,191 @@
+// Baked shapes, Shape's primitives made ahead of time for a fixed radius and segment count, so there's no generation or
+// copying at startup.
+// Small shapes are baked by the compiler. Each table is a constexpr static member of a class template, so it's computed
+// at compile time, lands in read only data and is shared by every user of the same shape. Written to C++11 (a single
+// return statement per constexpr function, MakeIndices for std::make_index_sequence) for the VS2015 toolset, and only
+// used for tables of a few dozen elements, like the disc's 78, that stay far inside its constant evaluation limits.
+// Radii are template arguments in thousandths, as floats can't be.
+// Larger shapes are baked offline into BakedTables.inl, see BakedTables. Shape's gen functions remain for any other sizes.
+#ifndef _BAKEDSHAPES_H_
+#define _BAKEDSHAPES_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <stddef.h>
+
+// A shape's arrays, pointing either at Shape's generated vectors or at a baked table.
+// indices is NULL for shapes drawn with glDrawArrays. radius and segments are what the shape was made with, Shape
+// makes its coarser levels of detail from them.
+struct ShapeArrays
+{
+	const float* vertex;
+	const float* normals;
+	const float* texCoords;
+	const GLuint* indices;
+	int vertexCount;
+	int indexCount;
+	float radius;
+	float segments;
+};
+
+namespace Baked
+{
+	// Same value as Shape's PI so the angles match the runtime generators.
+	constexpr double pi = 3.14159265;
+
+	// Angle i of a ring split into segments steps of turn, rounded to float as the runtime generators do.
+	constexpr float angle(int i, double turn, float segments)
+	{
+		return (float)((i * turn) / segments);
+	}
+
+	// Sine by Taylor series, after wrapping into -pi..pi where 20 terms are well past float precision.
+	constexpr double wrap(double x)
+	{
+		return x > pi ? wrap(x - 2 * pi) : (x < -pi ? wrap(x + 2 * pi) : x);
+	}
+	constexpr double sineSeries(double x2, double term, int k, double sum)
+	{
+		return k == 20 ? sum : sineSeries(x2, -term * x2 / ((2 * k + 2) * (2 * k + 3)), k + 1, sum + term);
+	}
+	constexpr float sine(float x)
+	{
+		return (float)sineSeries(wrap(x) * wrap(x), wrap(x), 0, 0.0);
+	}
+	constexpr float cosine(float x)
+	{
+		return sine((float)(x + pi / 2));
+	}
+
+	template<size_t N>
+	struct FloatTable
+	{
+		float v[N];
+	};
+	template<size_t N>
+	struct IndexTable
+	{
+		GLuint v[N];
+	};
+
+	// Indices 0 to N - 1 as a parameter pack, C++11's stand in for std::make_index_sequence. Built by joining two halves
+	// so the tables' thousands of elements only nest templates log2(N) deep.
+	template<size_t... I>
+	struct Indices
+	{
+		typedef Indices type;
+	};
+	template<typename Low, typename High>
+	struct JoinIndices;
+	template<size_t... Low, size_t... High>
+	struct JoinIndices<Indices<Low...>, Indices<High...> > : Indices<Low..., (sizeof...(Low) + High)...> {};
+	template<size_t N>
+	struct MakeIndices : JoinIndices<typename MakeIndices<N / 2>::type, typename MakeIndices<N - N / 2>::type> {};
+	template<>
+	struct MakeIndices<0> : Indices<> {};
+	template<>
+	struct MakeIndices<1> : Indices<0> {};
+
+	// Table whose element i is F::at(i).
+	template<typename F, size_t... I>
+	constexpr FloatTable<sizeof...(I)> makeFloats(Indices<I...>)
+	{
+		return FloatTable<sizeof...(I)>{ { F::at((int)I)... } };
+	}
+	template<typename F, size_t... I>
+	constexpr IndexTable<sizeof...(I)> makeIndices(Indices<I...>)
+	{
+		return IndexTable<sizeof...(I)>{ { F::at((int)I)... } };
+	}
+
+	// Cosines and sines of the Segments + 1 angles round a ring, a full turn or (Halves 1) half of one.
+	template<int Segments, int Halves>
+	struct RingCosine
+	{
+		static constexpr float at(int i) { return cosine(angle(i, Halves * pi, (float)Segments)); }
+	};
+	template<int Segments, int Halves>
+	struct RingSine
+	{
+		static constexpr float at(int i) { return sine(angle(i, Halves * pi, (float)Segments)); }
+	};
+	template<int Segments, int Halves>
+	struct Ring
+	{
+		static constexpr FloatTable<Segments + 1> cosines = makeFloats<RingCosine<Segments, Halves> >(typename MakeIndices<Segments + 1>::type());
+		static constexpr FloatTable<Segments + 1> sines = makeFloats<RingSine<Segments, Halves> >(typename MakeIndices<Segments + 1>::type());
+	};
+	template<int Segments, int Halves>
+	constexpr FloatTable<Segments + 1> Ring<Segments, Halves>::cosines;
+	template<int Segments, int Halves>
+	constexpr FloatTable<Segments + 1> Ring<Segments, Halves>::sines;
+
+	// Element i of the disc's vertex, normal and texture co-ordinate arrays, matching genDiscData.
+	template<int Segments, int RadiusMilli>
+	struct DiscData
+	{
+		static constexpr float r() { return RadiusMilli / 1000.0f; }
+		static constexpr float cosAt(int k) { return Ring<Segments, 2>::cosines.v[k - 1]; }
+		static constexpr float sinAt(int k) { return Ring<Segments, 2>::sines.v[k - 1]; }
+		// Vertex 0 is the centre, the rest go round the rim.
+		struct Vertex { static constexpr float at(int i) { return i < 3 || i % 3 == 2 ? 0.0f : (i % 3 == 0 ? r() * cosAt(i / 3) : r() * sinAt(i / 3)); } };
+		struct Normal { static constexpr float at(int i) { return i % 3 == 2 ? 1.0f : 0.0f; } };
+		struct TexCoord { static constexpr float at(int i) { return i < 2 ? 0.5f : (float)((i % 2 == 0 ? cosAt(i / 2) : sinAt(i / 2)) / (2 * r()) + 0.5); } };
+	};
+
+	// Baked arrays of one shape. Data gives element i of each array, as DiscData above.
+	template<typename Data, int Segments, int RadiusMilli, int VertexCount, int IndexCount, typename Index>
+	struct Mesh
+	{
+		static constexpr FloatTable<VertexCount * 3> vertex = makeFloats<typename Data::Vertex>(typename MakeIndices<VertexCount * 3>::type());
+		static constexpr FloatTable<VertexCount * 3> normals = makeFloats<typename Data::Normal>(typename MakeIndices<VertexCount * 3>::type());
+		static constexpr FloatTable<VertexCount * 2> texCoords = makeFloats<typename Data::TexCoord>(typename MakeIndices<VertexCount * 2>::type());
+		static constexpr IndexTable<IndexCount> indices = makeIndices<Index>(typename MakeIndices<IndexCount>::type());
+
+		static ShapeArrays arrays()
+		{
+			ShapeArrays result = { vertex.v, normals.v, texCoords.v, IndexCount > 1 ? indices.v : NULL, VertexCount, IndexCount > 1 ? IndexCount : 0,
+				RadiusMilli / 1000.0f, (float)Segments };
+			return result;
+		}
+	};
+	template<typename Data, int Segments, int RadiusMilli, int VertexCount, int IndexCount, typename Index>
+	constexpr FloatTable<VertexCount * 3> Mesh<Data, Segments, RadiusMilli, VertexCount, IndexCount, Index>::vertex;
+	template<typename Data, int Segments, int RadiusMilli, int VertexCount, int IndexCount, typename Index>
+	constexpr FloatTable<VertexCount * 3> Mesh<Data, Segments, RadiusMilli, VertexCount, IndexCount, Index>::normals;
+	template<typename Data, int Segments, int RadiusMilli, int VertexCount, int IndexCount, typename Index>
+	constexpr FloatTable<VertexCount * 2> Mesh<Data, Segments, RadiusMilli, VertexCount, IndexCount, Index>::texCoords;
+	template<typename Data, int Segments, int RadiusMilli, int VertexCount, int IndexCount, typename Index>
+	constexpr IndexTable<IndexCount> Mesh<Data, Segments, RadiusMilli, VertexCount, IndexCount, Index>::indices;
+
+	// Placeholder index table for shapes drawn without indices.
+	struct NoIndex
+	{
+		static constexpr GLuint at(int) { return 0; }
+	};
+}
+
+// The baked disc, e.g. BakedDisc<24, 1000>::arrays() is a unit disc of 24 segments for Shape::setDiscData.
+template<int Segments, int RadiusMilli>
+struct BakedDisc : Baked::Mesh<Baked::DiscData<Segments, RadiusMilli>, Segments, RadiusMilli, Segments + 2, 1, Baked::NoIndex> {};
+
+// The scene's larger shapes, too large to bake at compile time. Generated offline from ShapeGen by the ShapeBake tool
+// into BakedTables.inl, which BakedShapes.cpp compiles once. Rerun ShapeBake after changing ShapeGen, ShapeBake --check
+// reports whether the checked in tables are out of date.
+class BakedTables
+{
+
+public:
+	// ShapeGen::genSphere(1, 20), genCylinder(1, 24, 24) and genTorus(0.325, 24).
+	static ShapeArrays sphere();
+	static ShapeArrays cylinder();
+	static ShapeArrays torus();
+	// ShapeGen::genPlane(1, 20) and genCuboid(1, 20), the tram rail's, with the cuboid's atlas texture co-ordinates.
+	static ShapeArrays plane();
+	static ShapeArrays cuboid();
+	static const float* cuboidAtlasTexCoords();
+	// ShapeGen::genWall(1, 20) with ShapeGen::doorway.
+	static ShapeArrays wall();
+};
+
+#endif
@@ -0,0 +1,7937 @@
+// Generated by ShapeBake from ShapeGen, do not edit. Rerun ShapeBake after changing ShapeGen.
+// Included once, by BakedShapes.cpp.
+
+// ShapeGen::genSphere(1, 20)
+static const float sphereVertex[1323] =
+{
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, -0.0f,
+	1.0f, 0.0f, -0.0f, 1.0f, 0.0f, -0.0f, 1.0f, 0.0f,
+	-0.0f, 1.0f, 0.0f, -0.0f, 1.0f, 0.0f, -0.0f, 1.0f,
+	-0.0f, -0.0f, 1.0f, -0.0f, -0.0f, 1.0f, -0.0f, -0.0f,
+	1.0f, -0.0f, -0.0f, 1.0f, -0.0f, 0.0f, 1.0f, -0.0f,
+	0.0f, 1.0f, -0.0f, 0.0f, 1.0f, -0.0f, 0.0f, 1.0f,
+	-0.0f, 0.0f, 1.0f, -0.0f, 0.0f, 1.0f, 0.0f, 0.15643448f,
+	0.98768836f, 0.0f, 0.14877804f, 0.98768836f, 0.048340913f, 0.12655815f, 0.98768836f, 0.09194988f,
+	0.09194988f, 0.98768836f, 0.12655815f, 0.04834091f, 0.98768836f, 0.14877804f, -6.837968e-09f, 0.98768836f,
+	0.15643448f, -0.048340917f, 0.98768836f, 0.14877802f, -0.091949865f, 0.98768836f, 0.12655815f, -0.12655815f,
+	0.98768836f, 0.091949865f, -0.14877802f, 0.98768836f, 0.048340917f, -0.15643448f, 0.98768836f, -1.3675936e-08f,
+	-0.14877804f, 0.98768836f, -0.04834091f, -0.12655814f, 0.98768836f, -0.091949895f, -0.09194985f, 0.98768836f,
+	-0.12655817f, -0.048340928f, 0.98768836f, -0.14877802f, 1.8654625e-09f, 0.98768836f, -0.15643448f, 0.04834093f,
+	0.98768836f, -0.14877802f, 0.09194985f, 0.98768836f, -0.12655817f, 0.12655814f, 0.98768836f, -0.09194989f,
+	0.14877804f, 0.98768836f, -0.048340905f, 0.15643448f, 0.98768836f, 2.7351872e-08f, 0.309017f, 0.95105654f,
+	0.0f, 0.29389265f, 0.95105654f, 0.095491506f, 0.25f, 0.95105654f, 0.18163563f, 0.18163563f,
+	0.95105654f, 0.25f, 0.0954915f, 0.95105654f, 0.29389265f, -1.3507562e-08f, 0.95105654f, 0.309017f,
+	-0.09549151f, 0.95105654f, 0.29389262f, -0.18163562f, 0.95105654f, 0.25f, -0.25000003f, 0.95105654f,
+	0.18163562f, -0.29389262f, 0.95105654f, 0.09549151f, -0.309017f, 0.95105654f, -2.7015124e-08f, -0.29389265f,
+	0.95105654f, -0.0954915f, -0.24999999f, 0.95105654f, -0.18163568f, -0.18163557f, 0.95105654f, -0.25000006f,
+	-0.095491536f, 0.95105654f, -0.29389262f, 3.684991e-09f, 0.95105654f, -0.309017f, 0.09549154f, 0.95105654f,
+	-0.29389262f, 0.18163557f, 0.95105654f, -0.25000006f, 0.24999999f, 0.95105654f, -0.18163565f, 0.29389265f,
+	0.95105654f, -0.09549149f, 0.309017f, 0.95105654f, 5.403025e-08f, 0.45399052f, 0.8910065f, 0.0f,
+	0.43177065f, 0.8910065f, 0.1402908f, 0.36728606f, 0.8910065f, 0.26684892f, 0.26684892f, 0.8910065f,
+	0.36728606f, 0.14029078f, 0.8910065f, 0.43177065f, -1.9844556e-08f, 0.8910065f, 0.45399052f, -0.1402908f,
+	0.8910065f, 0.43177062f, -0.2668489f, 0.8910065f, 0.36728606f, -0.3672861f, 0.8910065f, 0.2668489f,
+	-0.43177062f, 0.8910065f, 0.1402908f, -0.45399052f, 0.8910065f, -3.9689112e-08f, -0.43177065f, 0.8910065f,
+	-0.14029078f, -0.36728603f, 0.8910065f, -0.26684898f, -0.26684883f, 0.8910065f, -0.36728612f, -0.14029083f,
+	0.8910065f, -0.43177062f, 5.4137828e-09f, 0.8910065f, -0.45399052f, 0.14029084f, 0.8910065f, -0.43177062f,
+	0.26684883f, 0.8910065f, -0.36728612f, 0.36728603f, 0.8910065f, -0.26684895f, 0.43177065f, 0.8910065f,
+	-0.14029077f, 0.45399052f, 0.8910065f, 7.9378225e-08f, 0.58778524f, 0.809017f, 0.0f, 0.559017f,
+	0.809017f, 0.18163563f, 0.47552827f, 0.809017f, 0.3454915f, 0.3454915f, 0.809017f, 0.47552827f,
+	0.18163562f, 0.809017f, 0.559017f, -2.569291e-08f, 0.809017f, 0.58778524f, -0.18163565f, 0.809017f,
+	0.55901694f, -0.34549147f, 0.809017f, 0.47552827f, -0.4755283f, 0.809017f, 0.34549147f, -0.55901694f,
+	0.809017f, 0.18163565f, -0.58778524f, 0.809017f, -5.138582e-08f, -0.559017f, 0.809017f, -0.18163562f,
+	-0.4755282f, 0.809017f, -0.34549156f, -0.34549138f, 0.809017f, -0.47552833f, -0.1816357f, 0.809017f,
+	-0.55901694f, 7.0092687e-09f, 0.809017f, -0.58778524f, 0.18163571f, 0.809017f, -0.55901694f, 0.34549138f,
+	0.809017f, -0.47552833f, 0.4755282f, 0.809017f, -0.34549153f, 0.559017f, 0.809017f, -0.1816356f,
+	0.58778524f, 0.809017f, 1.0277164e-07f, 0.70710677f, 0.70710677f, 0.0f, 0.6724985f, 0.70710677f,
+	0.21850802f, 0.5720614f, 0.70710677f, 0.4156269f, 0.4156269f, 0.70710677f, 0.5720614f, 0.21850799f,
+	0.70710677f, 0.6724985f, -3.090862e-08f, 0.70710677f, 0.70710677f, -0.21850803f, 0.70710677f, 0.67249846f,
+	-0.41562688f, 0.70710677f, 0.5720614f, -0.5720614f, 0.70710677f, 0.41562688f, -0.67249846f, 0.70710677f,
+	0.21850803f, -0.70710677f, 0.70710677f, -6.181724e-08f, -0.6724985f, 0.70710677f, -0.21850799f, -0.57206136f,
+	0.70710677f, -0.415627f, -0.4156268f, 0.70710677f, -0.5720615f, -0.21850808f, 0.70710677f, -0.67249846f,
+	8.432163e-09f, 0.70710677f, -0.70710677f, 0.2185081f, 0.70710677f, -0.67249846f, 0.4156268f, 0.70710677f,
+	-0.5720615f, 0.57206136f, 0.70710677f, -0.41562697f, 0.6724985f, 0.70710677f, -0.21850798f, 0.70710677f,
+	0.70710677f, 1.2363448e-07f, 0.809017f, 0.58778524f, 0.0f, 0.7694209f, 0.58778524f, 0.25f,
+	0.65450853f, 0.58778524f, 0.47552827f, 0.47552827f, 0.58778524f, 0.65450853f, 0.24999999f, 0.58778524f,
+	0.7694209f, -3.5363257e-08f, 0.58778524f, 0.809017f, -0.25000003f, 0.58778524f, 0.76942086f, -0.4755282f,
+	0.58778524f, 0.65450853f, -0.65450853f, 0.58778524f, 0.4755282f, -0.76942086f, 0.58778524f, 0.25000003f,
+	-0.809017f, 0.58778524f, -7.0726514e-08f, -0.7694209f, 0.58778524f, -0.24999999f, -0.6545085f, 0.58778524f,
+	-0.47552836f, -0.47552812f, 0.58778524f, -0.6545086f, -0.2500001f, 0.58778524f, -0.76942086f, 9.647431e-09f,
+	0.58778524f, -0.809017f, 0.25000012f, 0.58778524f, -0.76942086f, 0.47552812f, 0.58778524f, -0.6545086f,
+	0.6545085f, 0.58778524f, -0.4755283f, 0.7694209f, 0.58778524f, -0.24999996f, 0.809017f, 0.58778524f,
+	1.4145303e-07f, 0.8910065f, 0.45399052f, 0.0f, 0.84739757f, 0.45399052f, 0.27533618f, 0.72083944f,
+	0.45399052f, 0.5237205f, 0.5237205f, 0.45399052f, 0.72083944f, 0.27533615f, 0.45399052f, 0.84739757f,
+	-3.894713e-08f, 0.45399052f, 0.8910065f, -0.2753362f, 0.45399052f, 0.8473975f, -0.52372044f, 0.45399052f,
+	0.72083944f, -0.7208395f, 0.45399052f, 0.52372044f, -0.8473975f, 0.45399052f, 0.2753362f, -0.8910065f,
+	0.45399052f, -7.789426e-08f, -0.84739757f, 0.45399052f, -0.27533615f, -0.7208394f, 0.45399052f, -0.5237206f,
+	-0.5237203f, 0.45399052f, -0.72083956f, -0.27533624f, 0.45399052f, -0.8473975f, 1.0625146e-08f, 0.45399052f,
+	-0.8910065f, 0.27533627f, 0.45399052f, -0.8473975f, 0.5237203f, 0.45399052f, -0.72083956f, 0.7208394f,
+	0.45399052f, -0.52372056f, 0.84739757f, 0.45399052f, -0.27533612f, 0.8910065f, 0.45399052f, 1.5578853e-07f,
+	0.95105654f, 0.30901697f, 0.0f, 0.90450853f, 0.30901697f, 0.29389265f, 0.7694209f, 0.30901697f,
+	0.559017f, 0.559017f, 0.30901697f, 0.7694209f, 0.29389262f, 0.30901697f, 0.90450853f, -4.1572e-08f,
+	0.30901697f, 0.95105654f, -0.29389268f, 0.30901697f, 0.9045085f, -0.55901694f, 0.30901697f, 0.7694209f,
+	-0.769421f, 0.30901697f, 0.55901694f, -0.9045085f, 0.30901697f, 0.29389268f, -0.95105654f, 0.30901697f,
+	-8.3144e-08f, -0.90450853f, 0.30901697f, -0.29389262f, -0.76942086f, 0.30901697f, -0.5590171f, -0.5590168f,
+	0.30901697f, -0.76942104f, -0.29389274f, 0.30901697f, -0.9045085f, 1.13412355e-08f, 0.30901697f, -0.95105654f,
+	0.29389274f, 0.30901697f, -0.9045085f, 0.5590168f, 0.30901697f, -0.76942104f, 0.76942086f, 0.30901697f,
+	-0.55901706f, 0.90450853f, 0.30901697f, -0.2938926f, 0.95105654f, 0.30901697f, 1.66288e-07f, 0.98768836f,
+	0.15643449f, 0.0f, 0.9393475f, 0.15643449f, 0.3052125f, 0.79905665f, 0.15643449f, 0.58054864f,
+	0.58054864f, 0.15643449f, 0.79905665f, 0.30521247f, 0.15643449f, 0.9393475f, -4.317323e-08f, 0.15643449f,
+	0.98768836f, -0.30521253f, 0.15643449f, 0.93934745f, -0.5805486f, 0.15643449f, 0.79905665f, -0.7990567f,
+	0.15643449f, 0.5805486f, -0.93934745f, 0.15643449f, 0.30521253f, -0.98768836f, 0.15643449f, -8.634646e-08f,
+	-0.9393475f, 0.15643449f, -0.30521247f, -0.79905665f, 0.15643449f, -0.58054876f, -0.58054847f, 0.15643449f,
+	-0.79905677f, -0.3052126f, 0.15643449f, -0.93934745f, 1.1778066e-08f, 0.15643449f, -0.98768836f, 0.30521262f,
+	0.15643449f, -0.93934745f, 0.58054847f, 0.15643449f, -0.79905677f, 0.79905665f, 0.15643449f, -0.5805487f,
+	0.9393475f, 0.15643449f, -0.30521244f, 0.98768836f, 0.15643449f, 1.7269292e-07f, 1.0f, -4.371139e-08f,
+	0.0f, 0.95105654f, -4.371139e-08f, 0.309017f, 0.809017f, -4.371139e-08f, 0.58778524f, 0.58778524f,
+	-4.371139e-08f, 0.809017f, 0.30901697f, -4.371139e-08f, 0.95105654f, -4.371139e-08f, -4.371139e-08f, 1.0f,
+	-0.30901703f, -4.371139e-08f, 0.9510565f, -0.5877852f, -4.371139e-08f, 0.809017f, -0.80901706f, -4.371139e-08f,
+	0.5877852f, -0.9510565f, -4.371139e-08f, 0.30901703f, -1.0f, -4.371139e-08f, -8.742278e-08f, -0.95105654f,
+	-4.371139e-08f, -0.30901697f, -0.80901694f, -4.371139e-08f, -0.58778536f, -0.58778507f, -4.371139e-08f, -0.8090171f,
+	-0.3090171f, -4.371139e-08f, -0.9510565f, 1.1924881e-08f, -4.371139e-08f, -1.0f, 0.30901712f, -4.371139e-08f,
+	-0.9510565f, 0.58778507f, -4.371139e-08f, -0.8090171f, 0.80901694f, -4.371139e-08f, -0.5877853f, 0.95105654f,
+	-4.371139e-08f, -0.30901694f, 1.0f, -4.371139e-08f, 1.7484555e-07f, 0.98768836f, -0.15643445f, 0.0f,
+	0.9393475f, -0.15643445f, 0.3052125f, 0.79905665f, -0.15643445f, 0.58054864f, 0.58054864f, -0.15643445f,
+	0.79905665f, 0.30521247f, -0.15643445f, 0.9393475f, -4.317323e-08f, -0.15643445f, 0.98768836f, -0.30521253f,
+	-0.15643445f, 0.93934745f, -0.5805486f, -0.15643445f, 0.79905665f, -0.7990567f, -0.15643445f, 0.5805486f,
+	-0.93934745f, -0.15643445f, 0.30521253f, -0.98768836f, -0.15643445f, -8.634646e-08f, -0.9393475f, -0.15643445f,
+	-0.30521247f, -0.79905665f, -0.15643445f, -0.58054876f, -0.58054847f, -0.15643445f, -0.79905677f, -0.3052126f,
+	-0.15643445f, -0.93934745f, 1.1778066e-08f, -0.15643445f, -0.98768836f, 0.30521262f, -0.15643445f, -0.93934745f,
+	0.58054847f, -0.15643445f, -0.79905677f, 0.79905665f, -0.15643445f, -0.5805487f, 0.9393475f, -0.15643445f,
+	-0.30521244f, 0.98768836f, -0.15643445f, 1.7269292e-07f, 0.9510565f, -0.30901703f, 0.0f, 0.9045085f,
+	-0.30901703f, 0.29389262f, 0.76942086f, -0.30901703f, 0.55901694f, 0.55901694f, -0.30901703f, 0.76942086f,
+	0.2938926f, -0.30901703f, 0.9045085f, -4.1571997e-08f, -0.30901703f, 0.9510565f, -0.29389265f, -0.30901703f,
+	0.9045084f, -0.5590169f, -0.30901703f, 0.76942086f, -0.7694209f, -0.30901703f, 0.5590169f, -0.9045084f,
+	-0.30901703f, 0.29389265f, -0.9510565f, -0.30901703f, -8.3143995e-08f, -0.9045085f, -0.30901703f, -0.2938926f,
+	-0.7694208f, -0.30901703f, -0.55901706f, -0.5590168f, -0.30901703f, -0.769421f, -0.2938927f, -0.30901703f,
+	-0.9045084f, 1.1341235e-08f, -0.30901703f, -0.9510565f, 0.29389274f, -0.30901703f, -0.9045084f, 0.5590168f,
+	-0.30901703f, -0.769421f, 0.7694208f, -0.30901703f, -0.559017f, 0.9045085f, -0.30901703f, -0.29389256f,
+	0.9510565f, -0.30901703f, 1.6628799e-07f, 0.89100647f, -0.4539906f, 0.0f, 0.8473975f, -0.4539906f,
+	0.27533615f, 0.7208394f, -0.4539906f, 0.52372044f, 0.52372044f, -0.4539906f, 0.7208394f, 0.27533612f,
+	-0.4539906f, 0.8473975f, -3.8947128e-08f, -0.4539906f, 0.89100647f, -0.27533618f, -0.4539906f, 0.8473975f,
+	-0.5237204f, -0.4539906f, 0.7208394f, -0.72083944f, -0.4539906f, 0.5237204f, -0.8473975f, -0.4539906f,
+	0.27533618f, -0.89100647f, -0.4539906f, -7.7894256e-08f, -0.8473975f, -0.4539906f, -0.27533612f, -0.7208393f,
+	-0.4539906f, -0.52372056f, -0.5237203f, -0.4539906f, -0.7208395f, -0.27533624f, -0.4539906f, -0.8473975f,
+	1.0625146e-08f, -0.4539906f, -0.89100647f, 0.27533627f, -0.4539906f, -0.8473975f, 0.5237203f, -0.4539906f,
+	-0.7208395f, 0.7208393f, -0.4539906f, -0.5237205f, 0.8473975f, -0.4539906f, -0.2753361f, 0.89100647f,
+	-0.4539906f, 1.5578851e-07f, 0.809017f, -0.5877852f, 0.0f, 0.7694209f, -0.5877852f, 0.25f,
+	0.65450853f, -0.5877852f, 0.47552827f, 0.47552827f, -0.5877852f, 0.65450853f, 0.24999999f, -0.5877852f,
+	0.7694209f, -3.5363257e-08f, -0.5877852f, 0.809017f, -0.25000003f, -0.5877852f, 0.76942086f, -0.4755282f,
+	-0.5877852f, 0.65450853f, -0.65450853f, -0.5877852f, 0.4755282f, -0.76942086f, -0.5877852f, 0.25000003f,
+	-0.809017f, -0.5877852f, -7.0726514e-08f, -0.7694209f, -0.5877852f, -0.24999999f, -0.6545085f, -0.5877852f,
+	-0.47552836f, -0.47552812f, -0.5877852f, -0.6545086f, -0.2500001f, -0.5877852f, -0.76942086f, 9.647431e-09f,
+	-0.5877852f, -0.809017f, 0.25000012f, -0.5877852f, -0.76942086f, 0.47552812f, -0.5877852f, -0.6545086f,
+	0.6545085f, -0.5877852f, -0.4755283f, 0.7694209f, -0.5877852f, -0.24999996f, 0.809017f, -0.5877852f,
+	1.4145303e-07f, 0.70710677f, -0.70710677f, 0.0f, 0.6724985f, -0.70710677f, 0.21850802f, 0.5720614f,
+	-0.70710677f, 0.4156269f, 0.4156269f, -0.70710677f, 0.5720614f, 0.21850799f, -0.70710677f, 0.6724985f,
+	-3.090862e-08f, -0.70710677f, 0.70710677f, -0.21850803f, -0.70710677f, 0.67249846f, -0.41562688f, -0.70710677f,
+	0.5720614f, -0.5720614f, -0.70710677f, 0.41562688f, -0.67249846f, -0.70710677f, 0.21850803f, -0.70710677f,
+	-0.70710677f, -6.181724e-08f, -0.6724985f, -0.70710677f, -0.21850799f, -0.57206136f, -0.70710677f, -0.415627f,
+	-0.4156268f, -0.70710677f, -0.5720615f, -0.21850808f, -0.70710677f, -0.67249846f, 8.432163e-09f, -0.70710677f,
+	-0.70710677f, 0.2185081f, -0.70710677f, -0.67249846f, 0.4156268f, -0.70710677f, -0.5720615f, 0.57206136f,
+	-0.70710677f, -0.41562697f, 0.6724985f, -0.70710677f, -0.21850798f, 0.70710677f, -0.70710677f, 1.2363448e-07f,
+	0.5877852f, -0.80901706f, 0.0f, 0.55901694f, -0.80901706f, 0.18163562f, 0.4755282f, -0.80901706f,
+	0.34549147f, 0.34549147f, -0.80901706f, 0.4755282f, 0.1816356f, -0.80901706f, 0.55901694f, -2.5692906e-08f,
+	-0.80901706f, 0.5877852f, -0.18163563f, -0.80901706f, 0.5590169f, -0.3454914f, -0.80901706f, 0.4755282f,
+	-0.47552824f, -0.80901706f, 0.3454914f, -0.5590169f, -0.80901706f, 0.18163563f, -0.5877852f, -0.80901706f,
+	-5.138581e-08f, -0.55901694f, -0.80901706f, -0.1816356f, -0.47552818f, -0.80901706f, -0.34549153f, -0.34549135f,
+	-0.80901706f, -0.47552827f, -0.18163566f, -0.80901706f, -0.5590169f, 7.0092683e-09f, -0.80901706f, -0.5877852f,
+	0.1816357f, -0.80901706f, -0.5590169f, 0.34549135f, -0.80901706f, -0.47552827f, 0.47552818f, -0.80901706f,
+	-0.3454915f, 0.55901694f, -0.80901706f, -0.18163557f, 0.5877852f, -0.80901706f, 1.0277162e-07f, 0.45399058f,
+	-0.89100647f, 0.0f, 0.4317707f, -0.89100647f, 0.14029081f, 0.3672861f, -0.89100647f, 0.26684895f,
+	0.26684895f, -0.89100647f, 0.3672861f, 0.1402908f, -0.89100647f, 0.4317707f, -1.9844558e-08f, -0.89100647f,
+	0.45399058f, -0.14029083f, -0.89100647f, 0.43177068f, -0.26684892f, -0.89100647f, 0.3672861f, -0.36728612f,
+	-0.89100647f, 0.26684892f, -0.43177068f, -0.89100647f, 0.14029083f, -0.45399058f, -0.89100647f, -3.9689116e-08f,
+	-0.4317707f, -0.89100647f, -0.1402908f, -0.36728606f, -0.89100647f, -0.266849f, -0.2668489f, -0.89100647f,
+	-0.36728615f, -0.14029084f, -0.89100647f, -0.43177068f, 5.4137836e-09f, -0.89100647f, -0.45399058f, 0.14029086f,
+	-0.89100647f, -0.43177068f, 0.2668489f, -0.89100647f, -0.36728615f, 0.36728606f, -0.89100647f, -0.26684898f,
+	0.4317707f, -0.89100647f, -0.14029078f, 0.45399058f, -0.89100647f, 7.937823e-08f, 0.30901703f, -0.9510565f,
+	0.0f, 0.29389268f, -0.9510565f, 0.09549151f, 0.25000003f, -0.9510565f, 0.18163565f, 0.18163565f,
+	-0.9510565f, 0.25000003f, 0.095491506f, -0.9510565f, 0.29389268f, -1.3507563e-08f, -0.9510565f, 0.30901703f,
+	-0.09549153f, -0.9510565f, 0.29389265f, -0.18163563f, -0.9510565f, 0.25000003f, -0.25000006f, -0.9510565f,
+	0.18163563f, -0.29389265f, -0.9510565f, 0.09549153f, -0.30901703f, -0.9510565f, -2.7015126e-08f, -0.29389268f,
+	-0.9510565f, -0.095491506f, -0.25f, -0.9510565f, -0.1816357f, -0.1816356f, -0.9510565f, -0.25000006f,
+	-0.09549154f, -0.9510565f, -0.29389265f, 3.6849912e-09f, -0.9510565f, -0.30901703f, 0.09549155f, -0.9510565f,
+	-0.29389265f, 0.1816356f, -0.9510565f, -0.25000006f, 0.25f, -0.9510565f, -0.18163566f, 0.29389268f,
+	-0.9510565f, -0.0954915f, 0.30901703f, -0.9510565f, 5.4030252e-08f, 0.15643445f, -0.98768836f, 0.0f,
+	0.148778f, -0.98768836f, 0.048340905f, 0.12655813f, -0.98768836f, 0.09194986f, 0.09194986f, -0.98768836f,
+	0.12655813f, 0.048340898f, -0.98768836f, 0.148778f, -6.8379666e-09f, -0.98768836f, 0.15643445f, -0.04834091f,
+	-0.98768836f, 0.14877799f, -0.09194985f, -0.98768836f, 0.12655813f, -0.12655814f, -0.98768836f, 0.09194985f,
+	-0.14877799f, -0.98768836f, 0.04834091f, -0.15643445f, -0.98768836f, -1.3675933e-08f, -0.148778f, -0.98768836f,
+	-0.048340898f, -0.12655813f, -0.98768836f, -0.09194988f, -0.09194983f, -0.98768836f, -0.12655814f, -0.048340917f,
+	-0.98768836f, -0.14877799f, 1.865462e-09f, -0.98768836f, -0.15643445f, 0.048340924f, -0.98768836f, -0.14877799f,
+	0.09194983f, -0.98768836f, -0.12655814f, 0.12655813f, -0.98768836f, -0.091949865f, 0.148778f, -0.98768836f,
+	-0.048340894f, 0.15643445f, -0.98768836f, 2.7351867e-08f, -8.742278e-08f, -1.0f, -0.0f, -8.3144e-08f,
+	-1.0f, -2.7015124e-08f, -7.0726514e-08f, -1.0f, -5.138582e-08f, -5.138582e-08f, -1.0f, -7.0726514e-08f,
+	-2.7015123e-08f, -1.0f, -8.3144e-08f, 3.821371e-15f, -1.0f, -8.742278e-08f, 2.7015126e-08f, -1.0f,
+	-8.3143995e-08f, 5.138581e-08f, -1.0f, -7.0726514e-08f, 7.0726514e-08f, -1.0f, -5.138581e-08f, 8.3143995e-08f,
+	-1.0f, -2.7015126e-08f, 8.742278e-08f, -1.0f, 7.642742e-15f, 8.3144e-08f, -1.0f, 2.7015123e-08f,
+	7.072651e-08f, -1.0f, 5.138583e-08f, 5.1385804e-08f, -1.0f, 7.072652e-08f, 2.7015131e-08f, -1.0f,
+	8.3143995e-08f, -1.0425061e-15f, -1.0f, 8.742278e-08f, -2.7015135e-08f, -1.0f, 8.3143995e-08f, -5.1385804e-08f,
+	-1.0f, 7.072652e-08f, -7.072651e-08f, -1.0f, 5.1385822e-08f, -8.3144e-08f, -1.0f, 2.7015119e-08f,
+	-8.742278e-08f, -1.0f, -1.5285484e-14f
+};
+static const float sphereNormals[1323] =
+{
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, -0.0f,
+	1.0f, 0.0f, -0.0f, 1.0f, 0.0f, -0.0f, 1.0f, 0.0f,
+	-0.0f, 1.0f, 0.0f, -0.0f, 1.0f, 0.0f, -0.0f, 1.0f,
+	-0.0f, -0.0f, 1.0f, -0.0f, -0.0f, 1.0f, -0.0f, -0.0f,
+	1.0f, -0.0f, -0.0f, 1.0f, -0.0f, 0.0f, 1.0f, -0.0f,
+	0.0f, 1.0f, -0.0f, 0.0f, 1.0f, -0.0f, 0.0f, 1.0f,
+	-0.0f, 0.0f, 1.0f, -0.0f, 0.0f, 1.0f, 0.0f, 0.15643448f,
+	0.98768836f, 0.0f, 0.14877804f, 0.98768836f, 0.048340913f, 0.12655815f, 0.98768836f, 0.09194988f,
+	0.09194988f, 0.98768836f, 0.12655815f, 0.04834091f, 0.98768836f, 0.14877804f, -6.837968e-09f, 0.98768836f,
+	0.15643448f, -0.048340917f, 0.98768836f, 0.14877802f, -0.091949865f, 0.98768836f, 0.12655815f, -0.12655815f,
+	0.98768836f, 0.091949865f, -0.14877802f, 0.98768836f, 0.048340917f, -0.15643448f, 0.98768836f, -1.3675936e-08f,
+	-0.14877804f, 0.98768836f, -0.04834091f, -0.12655814f, 0.98768836f, -0.091949895f, -0.09194985f, 0.98768836f,
+	-0.12655817f, -0.048340928f, 0.98768836f, -0.14877802f, 1.8654625e-09f, 0.98768836f, -0.15643448f, 0.04834093f,
+	0.98768836f, -0.14877802f, 0.09194985f, 0.98768836f, -0.12655817f, 0.12655814f, 0.98768836f, -0.09194989f,
+	0.14877804f, 0.98768836f, -0.048340905f, 0.15643448f, 0.98768836f, 2.7351872e-08f, 0.309017f, 0.95105654f,
+	0.0f, 0.29389265f, 0.95105654f, 0.095491506f, 0.25f, 0.95105654f, 0.18163563f, 0.18163563f,
+	0.95105654f, 0.25f, 0.0954915f, 0.95105654f, 0.29389265f, -1.3507562e-08f, 0.95105654f, 0.309017f,
+	-0.09549151f, 0.95105654f, 0.29389262f, -0.18163562f, 0.95105654f, 0.25f, -0.25000003f, 0.95105654f,
+	0.18163562f, -0.29389262f, 0.95105654f, 0.09549151f, -0.309017f, 0.95105654f, -2.7015124e-08f, -0.29389265f,
+	0.95105654f, -0.0954915f, -0.24999999f, 0.95105654f, -0.18163568f, -0.18163557f, 0.95105654f, -0.25000006f,
+	-0.095491536f, 0.95105654f, -0.29389262f, 3.684991e-09f, 0.95105654f, -0.309017f, 0.09549154f, 0.95105654f,
+	-0.29389262f, 0.18163557f, 0.95105654f, -0.25000006f, 0.24999999f, 0.95105654f, -0.18163565f, 0.29389265f,
+	0.95105654f, -0.09549149f, 0.309017f, 0.95105654f, 5.403025e-08f, 0.45399052f, 0.8910065f, 0.0f,
+	0.43177065f, 0.8910065f, 0.1402908f, 0.36728606f, 0.8910065f, 0.26684892f, 0.26684892f, 0.8910065f,
+	0.36728606f, 0.14029078f, 0.8910065f, 0.43177065f, -1.9844556e-08f, 0.8910065f, 0.45399052f, -0.1402908f,
+	0.8910065f, 0.43177062f, -0.2668489f, 0.8910065f, 0.36728606f, -0.3672861f, 0.8910065f, 0.2668489f,
+	-0.43177062f, 0.8910065f, 0.1402908f, -0.45399052f, 0.8910065f, -3.9689112e-08f, -0.43177065f, 0.8910065f,
+	-0.14029078f, -0.36728603f, 0.8910065f, -0.26684898f, -0.26684883f, 0.8910065f, -0.36728612f, -0.14029083f,
+	0.8910065f, -0.43177062f, 5.4137828e-09f, 0.8910065f, -0.45399052f, 0.14029084f, 0.8910065f, -0.43177062f,
+	0.26684883f, 0.8910065f, -0.36728612f, 0.36728603f, 0.8910065f, -0.26684895f, 0.43177065f, 0.8910065f,
+	-0.14029077f, 0.45399052f, 0.8910065f, 7.9378225e-08f, 0.58778524f, 0.809017f, 0.0f, 0.559017f,
+	0.809017f, 0.18163563f, 0.47552827f, 0.809017f, 0.3454915f, 0.3454915f, 0.809017f, 0.47552827f,
+	0.18163562f, 0.809017f, 0.559017f, -2.569291e-08f, 0.809017f, 0.58778524f, -0.18163565f, 0.809017f,
+	0.55901694f, -0.34549147f, 0.809017f, 0.47552827f, -0.4755283f, 0.809017f, 0.34549147f, -0.55901694f,
+	0.809017f, 0.18163565f, -0.58778524f, 0.809017f, -5.138582e-08f, -0.559017f, 0.809017f, -0.18163562f,
+	-0.4755282f, 0.809017f, -0.34549156f, -0.34549138f, 0.809017f, -0.47552833f, -0.1816357f, 0.809017f,
+	-0.55901694f, 7.0092687e-09f, 0.809017f, -0.58778524f, 0.18163571f, 0.809017f, -0.55901694f, 0.34549138f,
+	0.809017f, -0.47552833f, 0.4755282f, 0.809017f, -0.34549153f, 0.559017f, 0.809017f, -0.1816356f,
+	0.58778524f, 0.809017f, 1.0277164e-07f, 0.70710677f, 0.70710677f, 0.0f, 0.6724985f, 0.70710677f,
+	0.21850802f, 0.5720614f, 0.70710677f, 0.4156269f, 0.4156269f, 0.70710677f, 0.5720614f, 0.21850799f,
+	0.70710677f, 0.6724985f, -3.090862e-08f, 0.70710677f, 0.70710677f, -0.21850803f, 0.70710677f, 0.67249846f,
+	-0.41562688f, 0.70710677f, 0.5720614f, -0.5720614f, 0.70710677f, 0.41562688f, -0.67249846f, 0.70710677f,
+	0.21850803f, -0.70710677f, 0.70710677f, -6.181724e-08f, -0.6724985f, 0.70710677f, -0.21850799f, -0.57206136f,
+	0.70710677f, -0.415627f, -0.4156268f, 0.70710677f, -0.5720615f, -0.21850808f, 0.70710677f, -0.67249846f,
+	8.432163e-09f, 0.70710677f, -0.70710677f, 0.2185081f, 0.70710677f, -0.67249846f, 0.4156268f, 0.70710677f,
+	-0.5720615f, 0.57206136f, 0.70710677f, -0.41562697f, 0.6724985f, 0.70710677f, -0.21850798f, 0.70710677f,
+	0.70710677f, 1.2363448e-07f, 0.809017f, 0.58778524f, 0.0f, 0.7694209f, 0.58778524f, 0.25f,
+	0.65450853f, 0.58778524f, 0.47552827f, 0.47552827f, 0.58778524f, 0.65450853f, 0.24999999f, 0.58778524f,
+	0.7694209f, -3.5363257e-08f, 0.58778524f, 0.809017f, -0.25000003f, 0.58778524f, 0.76942086f, -0.4755282f,
+	0.58778524f, 0.65450853f, -0.65450853f, 0.58778524f, 0.4755282f, -0.76942086f, 0.58778524f, 0.25000003f,
+	-0.809017f, 0.58778524f, -7.0726514e-08f, -0.7694209f, 0.58778524f, -0.24999999f, -0.6545085f, 0.58778524f,
+	-0.47552836f, -0.47552812f, 0.58778524f, -0.6545086f, -0.2500001f, 0.58778524f, -0.76942086f, 9.647431e-09f,
+	0.58778524f, -0.809017f, 0.25000012f, 0.58778524f, -0.76942086f, 0.47552812f, 0.58778524f, -0.6545086f,
+	0.6545085f, 0.58778524f, -0.4755283f, 0.7694209f, 0.58778524f, -0.24999996f, 0.809017f, 0.58778524f,
+	1.4145303e-07f, 0.8910065f, 0.45399052f, 0.0f, 0.84739757f, 0.45399052f, 0.27533618f, 0.72083944f,
+	0.45399052f, 0.5237205f, 0.5237205f, 0.45399052f, 0.72083944f, 0.27533615f, 0.45399052f, 0.84739757f,
+	-3.894713e-08f, 0.45399052f, 0.8910065f, -0.2753362f, 0.45399052f, 0.8473975f, -0.52372044f, 0.45399052f,
+	0.72083944f, -0.7208395f, 0.45399052f, 0.52372044f, -0.8473975f, 0.45399052f, 0.2753362f, -0.8910065f,
+	0.45399052f, -7.789426e-08f, -0.84739757f, 0.45399052f, -0.27533615f, -0.7208394f, 0.45399052f, -0.5237206f,
+	-0.5237203f, 0.45399052f, -0.72083956f, -0.27533624f, 0.45399052f, -0.8473975f, 1.0625146e-08f, 0.45399052f,
+	-0.8910065f, 0.27533627f, 0.45399052f, -0.8473975f, 0.5237203f, 0.45399052f, -0.72083956f, 0.7208394f,
+	0.45399052f, -0.52372056f, 0.84739757f, 0.45399052f, -0.27533612f, 0.8910065f, 0.45399052f, 1.5578853e-07f,
+	0.95105654f, 0.30901697f, 0.0f, 0.90450853f, 0.30901697f, 0.29389265f, 0.7694209f, 0.30901697f,
+	0.559017f, 0.559017f, 0.30901697f, 0.7694209f, 0.29389262f, 0.30901697f, 0.90450853f, -4.1572e-08f,
+	0.30901697f, 0.95105654f, -0.29389268f, 0.30901697f, 0.9045085f, -0.55901694f, 0.30901697f, 0.7694209f,
+	-0.769421f, 0.30901697f, 0.55901694f, -0.9045085f, 0.30901697f, 0.29389268f, -0.95105654f, 0.30901697f,
+	-8.3144e-08f, -0.90450853f, 0.30901697f, -0.29389262f, -0.76942086f, 0.30901697f, -0.5590171f, -0.5590168f,
+	0.30901697f, -0.76942104f, -0.29389274f, 0.30901697f, -0.9045085f, 1.13412355e-08f, 0.30901697f, -0.95105654f,
+	0.29389274f, 0.30901697f, -0.9045085f, 0.5590168f, 0.30901697f, -0.76942104f, 0.76942086f, 0.30901697f,
+	-0.55901706f, 0.90450853f, 0.30901697f, -0.2938926f, 0.95105654f, 0.30901697f, 1.66288e-07f, 0.98768836f,
+	0.15643449f, 0.0f, 0.9393475f, 0.15643449f, 0.3052125f, 0.79905665f, 0.15643449f, 0.58054864f,
+	0.58054864f, 0.15643449f, 0.79905665f, 0.30521247f, 0.15643449f, 0.9393475f, -4.317323e-08f, 0.15643449f,
+	0.98768836f, -0.30521253f, 0.15643449f, 0.93934745f, -0.5805486f, 0.15643449f, 0.79905665f, -0.7990567f,
+	0.15643449f, 0.5805486f, -0.93934745f, 0.15643449f, 0.30521253f, -0.98768836f, 0.15643449f, -8.634646e-08f,
+	-0.9393475f, 0.15643449f, -0.30521247f, -0.79905665f, 0.15643449f, -0.58054876f, -0.58054847f, 0.15643449f,
+	-0.79905677f, -0.3052126f, 0.15643449f, -0.93934745f, 1.1778066e-08f, 0.15643449f, -0.98768836f, 0.30521262f,
+	0.15643449f, -0.93934745f, 0.58054847f, 0.15643449f, -0.79905677f, 0.79905665f, 0.15643449f, -0.5805487f,
+	0.9393475f, 0.15643449f, -0.30521244f, 0.98768836f, 0.15643449f, 1.7269292e-07f, 1.0f, -4.371139e-08f,
+	0.0f, 0.95105654f, -4.371139e-08f, 0.309017f, 0.809017f, -4.371139e-08f, 0.58778524f, 0.58778524f,
+	-4.371139e-08f, 0.809017f, 0.30901697f, -4.371139e-08f, 0.95105654f, -4.371139e-08f, -4.371139e-08f, 1.0f,
+	-0.30901703f, -4.371139e-08f, 0.9510565f, -0.5877852f, -4.371139e-08f, 0.809017f, -0.80901706f, -4.371139e-08f,
+	0.5877852f, -0.9510565f, -4.371139e-08f, 0.30901703f, -1.0f, -4.371139e-08f, -8.742278e-08f, -0.95105654f,
+	-4.371139e-08f, -0.30901697f, -0.80901694f, -4.371139e-08f, -0.58778536f, -0.58778507f, -4.371139e-08f, -0.8090171f,
+	-0.3090171f, -4.371139e-08f, -0.9510565f, 1.1924881e-08f, -4.371139e-08f, -1.0f, 0.30901712f, -4.371139e-08f,
+	-0.9510565f, 0.58778507f, -4.371139e-08f, -0.8090171f, 0.80901694f, -4.371139e-08f, -0.5877853f, 0.95105654f,
+	-4.371139e-08f, -0.30901694f, 1.0f, -4.371139e-08f, 1.7484555e-07f, 0.98768836f, -0.15643445f, 0.0f,
+	0.9393475f, -0.15643445f, 0.3052125f, 0.79905665f, -0.15643445f, 0.58054864f, 0.58054864f, -0.15643445f,
+	0.79905665f, 0.30521247f, -0.15643445f, 0.9393475f, -4.317323e-08f, -0.15643445f, 0.98768836f, -0.30521253f,
+	-0.15643445f, 0.93934745f, -0.5805486f, -0.15643445f, 0.79905665f, -0.7990567f, -0.15643445f, 0.5805486f,
+	-0.93934745f, -0.15643445f, 0.30521253f, -0.98768836f, -0.15643445f, -8.634646e-08f, -0.9393475f, -0.15643445f,
+	-0.30521247f, -0.79905665f, -0.15643445f, -0.58054876f, -0.58054847f, -0.15643445f, -0.79905677f, -0.3052126f,
+	-0.15643445f, -0.93934745f, 1.1778066e-08f, -0.15643445f, -0.98768836f, 0.30521262f, -0.15643445f, -0.93934745f,
+	0.58054847f, -0.15643445f, -0.79905677f, 0.79905665f, -0.15643445f, -0.5805487f, 0.9393475f, -0.15643445f,
+	-0.30521244f, 0.98768836f, -0.15643445f, 1.7269292e-07f, 0.9510565f, -0.30901703f, 0.0f, 0.9045085f,
+	-0.30901703f, 0.29389262f, 0.76942086f, -0.30901703f, 0.55901694f, 0.55901694f, -0.30901703f, 0.76942086f,
+	0.2938926f, -0.30901703f, 0.9045085f, -4.1571997e-08f, -0.30901703f, 0.9510565f, -0.29389265f, -0.30901703f,
+	0.9045084f, -0.5590169f, -0.30901703f, 0.76942086f, -0.7694209f, -0.30901703f, 0.5590169f, -0.9045084f,
+	-0.30901703f, 0.29389265f, -0.9510565f, -0.30901703f, -8.3143995e-08f, -0.9045085f, -0.30901703f, -0.2938926f,
+	-0.7694208f, -0.30901703f, -0.55901706f, -0.5590168f, -0.30901703f, -0.769421f, -0.2938927f, -0.30901703f,
+	-0.9045084f, 1.1341235e-08f, -0.30901703f, -0.9510565f, 0.29389274f, -0.30901703f, -0.9045084f, 0.5590168f,
+	-0.30901703f, -0.769421f, 0.7694208f, -0.30901703f, -0.559017f, 0.9045085f, -0.30901703f, -0.29389256f,
+	0.9510565f, -0.30901703f, 1.6628799e-07f, 0.89100647f, -0.4539906f, 0.0f, 0.8473975f, -0.4539906f,
+	0.27533615f, 0.7208394f, -0.4539906f, 0.52372044f, 0.52372044f, -0.4539906f, 0.7208394f, 0.27533612f,
+	-0.4539906f, 0.8473975f, -3.8947128e-08f, -0.4539906f, 0.89100647f, -0.27533618f, -0.4539906f, 0.8473975f,
+	-0.5237204f, -0.4539906f, 0.7208394f, -0.72083944f, -0.4539906f, 0.5237204f, -0.8473975f, -0.4539906f,
+	0.27533618f, -0.89100647f, -0.4539906f, -7.7894256e-08f, -0.8473975f, -0.4539906f, -0.27533612f, -0.7208393f,
+	-0.4539906f, -0.52372056f, -0.5237203f, -0.4539906f, -0.7208395f, -0.27533624f, -0.4539906f, -0.8473975f,
+	1.0625146e-08f, -0.4539906f, -0.89100647f, 0.27533627f, -0.4539906f, -0.8473975f, 0.5237203f, -0.4539906f,
+	-0.7208395f, 0.7208393f, -0.4539906f, -0.5237205f, 0.8473975f, -0.4539906f, -0.2753361f, 0.89100647f,
+	-0.4539906f, 1.5578851e-07f, 0.809017f, -0.5877852f, 0.0f, 0.7694209f, -0.5877852f, 0.25f,
+	0.65450853f, -0.5877852f, 0.47552827f, 0.47552827f, -0.5877852f, 0.65450853f, 0.24999999f, -0.5877852f,
+	0.7694209f, -3.5363257e-08f, -0.5877852f, 0.809017f, -0.25000003f, -0.5877852f, 0.76942086f, -0.4755282f,
+	-0.5877852f, 0.65450853f, -0.65450853f, -0.5877852f, 0.4755282f, -0.76942086f, -0.5877852f, 0.25000003f,
+	-0.809017f, -0.5877852f, -7.0726514e-08f, -0.7694209f, -0.5877852f, -0.24999999f, -0.6545085f, -0.5877852f,
+	-0.47552836f, -0.47552812f, -0.5877852f, -0.6545086f, -0.2500001f, -0.5877852f, -0.76942086f, 9.647431e-09f,
+	-0.5877852f, -0.809017f, 0.25000012f, -0.5877852f, -0.76942086f, 0.47552812f, -0.5877852f, -0.6545086f,
+	0.6545085f, -0.5877852f, -0.4755283f, 0.7694209f, -0.5877852f, -0.24999996f, 0.809017f, -0.5877852f,
+	1.4145303e-07f, 0.70710677f, -0.70710677f, 0.0f, 0.6724985f, -0.70710677f, 0.21850802f, 0.5720614f,
+	-0.70710677f, 0.4156269f, 0.4156269f, -0.70710677f, 0.5720614f, 0.21850799f, -0.70710677f, 0.6724985f,
+	-3.090862e-08f, -0.70710677f, 0.70710677f, -0.21850803f, -0.70710677f, 0.67249846f, -0.41562688f, -0.70710677f,
+	0.5720614f, -0.5720614f, -0.70710677f, 0.41562688f, -0.67249846f, -0.70710677f, 0.21850803f, -0.70710677f,
+	-0.70710677f, -6.181724e-08f, -0.6724985f, -0.70710677f, -0.21850799f, -0.57206136f, -0.70710677f, -0.415627f,
+	-0.4156268f, -0.70710677f, -0.5720615f, -0.21850808f, -0.70710677f, -0.67249846f, 8.432163e-09f, -0.70710677f,
+	-0.70710677f, 0.2185081f, -0.70710677f, -0.67249846f, 0.4156268f, -0.70710677f, -0.5720615f, 0.57206136f,
+	-0.70710677f, -0.41562697f, 0.6724985f, -0.70710677f, -0.21850798f, 0.70710677f, -0.70710677f, 1.2363448e-07f,
+	0.5877852f, -0.80901706f, 0.0f, 0.55901694f, -0.80901706f, 0.18163562f, 0.4755282f, -0.80901706f,
+	0.34549147f, 0.34549147f, -0.80901706f, 0.4755282f, 0.1816356f, -0.80901706f, 0.55901694f, -2.5692906e-08f,
+	-0.80901706f, 0.5877852f, -0.18163563f, -0.80901706f, 0.5590169f, -0.3454914f, -0.80901706f, 0.4755282f,
+	-0.47552824f, -0.80901706f, 0.3454914f, -0.5590169f, -0.80901706f, 0.18163563f, -0.5877852f, -0.80901706f,
+	-5.138581e-08f, -0.55901694f, -0.80901706f, -0.1816356f, -0.47552818f, -0.80901706f, -0.34549153f, -0.34549135f,
+	-0.80901706f, -0.47552827f, -0.18163566f, -0.80901706f, -0.5590169f, 7.0092683e-09f, -0.80901706f, -0.5877852f,
+	0.1816357f, -0.80901706f, -0.5590169f, 0.34549135f, -0.80901706f, -0.47552827f, 0.47552818f, -0.80901706f,
+	-0.3454915f, 0.55901694f, -0.80901706f, -0.18163557f, 0.5877852f, -0.80901706f, 1.0277162e-07f, 0.45399058f,
+	-0.89100647f, 0.0f, 0.4317707f, -0.89100647f, 0.14029081f, 0.3672861f, -0.89100647f, 0.26684895f,
+	0.26684895f, -0.89100647f, 0.3672861f, 0.1402908f, -0.89100647f, 0.4317707f, -1.9844558e-08f, -0.89100647f,
+	0.45399058f, -0.14029083f, -0.89100647f, 0.43177068f, -0.26684892f, -0.89100647f, 0.3672861f, -0.36728612f,
+	-0.89100647f, 0.26684892f, -0.43177068f, -0.89100647f, 0.14029083f, -0.45399058f, -0.89100647f, -3.9689116e-08f,
+	-0.4317707f, -0.89100647f, -0.1402908f, -0.36728606f, -0.89100647f, -0.266849f, -0.2668489f, -0.89100647f,
+	-0.36728615f, -0.14029084f, -0.89100647f, -0.43177068f, 5.4137836e-09f, -0.89100647f, -0.45399058f, 0.14029086f,
+	-0.89100647f, -0.43177068f, 0.2668489f, -0.89100647f, -0.36728615f, 0.36728606f, -0.89100647f, -0.26684898f,
+	0.4317707f, -0.89100647f, -0.14029078f, 0.45399058f, -0.89100647f, 7.937823e-08f, 0.30901703f, -0.9510565f,
+	0.0f, 0.29389268f, -0.9510565f, 0.09549151f, 0.25000003f, -0.9510565f, 0.18163565f, 0.18163565f,
+	-0.9510565f, 0.25000003f, 0.095491506f, -0.9510565f, 0.29389268f, -1.3507563e-08f, -0.9510565f, 0.30901703f,
+	-0.09549153f, -0.9510565f, 0.29389265f, -0.18163563f, -0.9510565f, 0.25000003f, -0.25000006f, -0.9510565f,
+	0.18163563f, -0.29389265f, -0.9510565f, 0.09549153f, -0.30901703f, -0.9510565f, -2.7015126e-08f, -0.29389268f,
+	-0.9510565f, -0.095491506f, -0.25f, -0.9510565f, -0.1816357f, -0.1816356f, -0.9510565f, -0.25000006f,
+	-0.09549154f, -0.9510565f, -0.29389265f, 3.6849912e-09f, -0.9510565f, -0.30901703f, 0.09549155f, -0.9510565f,
+	-0.29389265f, 0.1816356f, -0.9510565f, -0.25000006f, 0.25f, -0.9510565f, -0.18163566f, 0.29389268f,
+	-0.9510565f, -0.0954915f, 0.30901703f, -0.9510565f, 5.4030252e-08f, 0.15643445f, -0.98768836f, 0.0f,
+	0.148778f, -0.98768836f, 0.048340905f, 0.12655813f, -0.98768836f, 0.09194986f, 0.09194986f, -0.98768836f,
+	0.12655813f, 0.048340898f, -0.98768836f, 0.148778f, -6.8379666e-09f, -0.98768836f, 0.15643445f, -0.04834091f,
+	-0.98768836f, 0.14877799f, -0.09194985f, -0.98768836f, 0.12655813f, -0.12655814f, -0.98768836f, 0.09194985f,
+	-0.14877799f, -0.98768836f, 0.04834091f, -0.15643445f, -0.98768836f, -1.3675933e-08f, -0.148778f, -0.98768836f,
+	-0.048340898f, -0.12655813f, -0.98768836f, -0.09194988f, -0.09194983f, -0.98768836f, -0.12655814f, -0.048340917f,
+	-0.98768836f, -0.14877799f, 1.865462e-09f, -0.98768836f, -0.15643445f, 0.048340924f, -0.98768836f, -0.14877799f,
+	0.09194983f, -0.98768836f, -0.12655814f, 0.12655813f, -0.98768836f, -0.091949865f, 0.148778f, -0.98768836f,
+	-0.048340894f, 0.15643445f, -0.98768836f, 2.7351867e-08f, -8.742278e-08f, -1.0f, -0.0f, -8.3144e-08f,
+	-1.0f, -2.7015124e-08f, -7.0726514e-08f, -1.0f, -5.138582e-08f, -5.138582e-08f, -1.0f, -7.0726514e-08f,
+	-2.7015123e-08f, -1.0f, -8.3144e-08f, 3.821371e-15f, -1.0f, -8.742278e-08f, 2.7015126e-08f, -1.0f,
+	-8.3143995e-08f, 5.138581e-08f, -1.0f, -7.0726514e-08f, 7.0726514e-08f, -1.0f, -5.138581e-08f, 8.3143995e-08f,
+	-1.0f, -2.7015126e-08f, 8.742278e-08f, -1.0f, 7.642742e-15f, 8.3144e-08f, -1.0f, 2.7015123e-08f,
+	7.072651e-08f, -1.0f, 5.138583e-08f, 5.1385804e-08f, -1.0f, 7.072652e-08f, 2.7015131e-08f, -1.0f,
+	8.3143995e-08f, -1.0425061e-15f, -1.0f, 8.742278e-08f, -2.7015135e-08f, -1.0f, 8.3143995e-08f, -5.1385804e-08f,
+	-1.0f, 7.072652e-08f, -7.072651e-08f, -1.0f, 5.1385822e-08f, -8.3144e-08f, -1.0f, 2.7015119e-08f,
+	-8.742278e-08f, -1.0f, -1.5285484e-14f
+};
+static const float sphereTexCoords[882] =
+{
+	0.0f, 0.0f, 0.05f, 0.0f, 0.1f, 0.0f, 0.15f, 0.0f,
+	0.2f, 0.0f, 0.25f, 0.0f, 0.3f, 0.0f, 0.35f, 0.0f,
+	0.4f, 0.0f, 0.45000002f, 0.0f, 0.5f, 0.0f, 0.55f, 0.0f,
+	0.6f, 0.0f, 0.65000004f, 0.0f, 0.7f, 0.0f, 0.75f, 0.0f,
+	0.8f, 0.0f, 0.85f, 0.0f, 0.90000004f, 0.0f, 0.95f, 0.0f,
+	1.0f, 0.0f, 0.0f, 0.05f, 0.05f, 0.05f, 0.1f, 0.05f,
+	0.15f, 0.05f, 0.2f, 0.05f, 0.25f, 0.05f, 0.3f, 0.05f,
+	0.35f, 0.05f, 0.4f, 0.05f, 0.45000002f, 0.05f, 0.5f, 0.05f,
+	0.55f, 0.05f, 0.6f, 0.05f, 0.65000004f, 0.05f, 0.7f, 0.05f,
+	0.75f, 0.05f, 0.8f, 0.05f, 0.85f, 0.05f, 0.90000004f, 0.05f,
+	0.95f, 0.05f, 1.0f, 0.05f, 0.0f, 0.1f, 0.05f, 0.1f,
+	0.1f, 0.1f, 0.15f, 0.1f, 0.2f, 0.1f, 0.25f, 0.1f,
+	0.3f, 0.1f, 0.35f, 0.1f, 0.4f, 0.1f, 0.45000002f, 0.1f,
+	0.5f, 0.1f, 0.55f, 0.1f, 0.6f, 0.1f, 0.65000004f, 0.1f,
+	0.7f, 0.1f, 0.75f, 0.1f, 0.8f, 0.1f, 0.85f, 0.1f,
+	0.90000004f, 0.1f, 0.95f, 0.1f, 1.0f, 0.1f, 0.0f, 0.15f,
+	0.05f, 0.15f, 0.1f, 0.15f, 0.15f, 0.15f, 0.2f, 0.15f,
+	0.25f, 0.15f, 0.3f, 0.15f, 0.35f, 0.15f, 0.4f, 0.15f,
+	0.45000002f, 0.15f, 0.5f, 0.15f, 0.55f, 0.15f, 0.6f, 0.15f,
+	0.65000004f, 0.15f, 0.7f, 0.15f, 0.75f, 0.15f, 0.8f, 0.15f,
+	0.85f, 0.15f, 0.90000004f, 0.15f, 0.95f, 0.15f, 1.0f, 0.15f,
+	0.0f, 0.2f, 0.05f, 0.2f, 0.1f, 0.2f, 0.15f, 0.2f,
+	0.2f, 0.2f, 0.25f, 0.2f, 0.3f, 0.2f, 0.35f, 0.2f,
+	0.4f, 0.2f, 0.45000002f, 0.2f, 0.5f, 0.2f, 0.55f, 0.2f,
+	0.6f, 0.2f, 0.65000004f, 0.2f, 0.7f, 0.2f, 0.75f, 0.2f,
+	0.8f, 0.2f, 0.85f, 0.2f, 0.90000004f, 0.2f, 0.95f, 0.2f,
+	1.0f, 0.2f, 0.0f, 0.25f, 0.05f, 0.25f, 0.1f, 0.25f,
+	0.15f, 0.25f, 0.2f, 0.25f, 0.25f, 0.25f, 0.3f, 0.25f,
+	0.35f, 0.25f, 0.4f, 0.25f, 0.45000002f, 0.25f, 0.5f, 0.25f,
+	0.55f, 0.25f, 0.6f, 0.25f, 0.65000004f, 0.25f, 0.7f, 0.25f,
+	0.75f, 0.25f, 0.8f, 0.25f, 0.85f, 0.25f, 0.90000004f, 0.25f,
+	0.95f, 0.25f, 1.0f, 0.25f, 0.0f, 0.3f, 0.05f, 0.3f,
+	0.1f, 0.3f, 0.15f, 0.3f, 0.2f, 0.3f, 0.25f, 0.3f,
+	0.3f, 0.3f, 0.35f, 0.3f, 0.4f, 0.3f, 0.45000002f, 0.3f,
+	0.5f, 0.3f, 0.55f, 0.3f, 0.6f, 0.3f, 0.65000004f, 0.3f,
+	0.7f, 0.3f, 0.75f, 0.3f, 0.8f, 0.3f, 0.85f, 0.3f,
+	0.90000004f, 0.3f, 0.95f, 0.3f, 1.0f, 0.3f, 0.0f, 0.35f,
+	0.05f, 0.35f, 0.1f, 0.35f, 0.15f, 0.35f, 0.2f, 0.35f,
+	0.25f, 0.35f, 0.3f, 0.35f, 0.35f, 0.35f, 0.4f, 0.35f,
+	0.45000002f, 0.35f, 0.5f, 0.35f, 0.55f, 0.35f, 0.6f, 0.35f,
+	0.65000004f, 0.35f, 0.7f, 0.35f, 0.75f, 0.35f, 0.8f, 0.35f,
+	0.85f, 0.35f, 0.90000004f, 0.35f, 0.95f, 0.35f, 1.0f, 0.35f,
+	0.0f, 0.4f, 0.05f, 0.4f, 0.1f, 0.4f, 0.15f, 0.4f,
+	0.2f, 0.4f, 0.25f, 0.4f, 0.3f, 0.4f, 0.35f, 0.4f,
+	0.4f, 0.4f, 0.45000002f, 0.4f, 0.5f, 0.4f, 0.55f, 0.4f,
+	0.6f, 0.4f, 0.65000004f, 0.4f, 0.7f, 0.4f, 0.75f, 0.4f,
+	0.8f, 0.4f, 0.85f, 0.4f, 0.90000004f, 0.4f, 0.95f, 0.4f,
+	1.0f, 0.4f, 0.0f, 0.45000002f, 0.05f, 0.45000002f, 0.1f, 0.45000002f,
+	0.15f, 0.45000002f, 0.2f, 0.45000002f, 0.25f, 0.45000002f, 0.3f, 0.45000002f,
+	0.35f, 0.45000002f, 0.4f, 0.45000002f, 0.45000002f, 0.45000002f, 0.5f, 0.45000002f,
+	0.55f, 0.45000002f, 0.6f, 0.45000002f, 0.65000004f, 0.45000002f, 0.7f, 0.45000002f,
+	0.75f, 0.45000002f, 0.8f, 0.45000002f, 0.85f, 0.45000002f, 0.90000004f, 0.45000002f,
+	0.95f, 0.45000002f, 1.0f, 0.45000002f, 0.0f, 0.5f, 0.05f, 0.5f,
+	0.1f, 0.5f, 0.15f, 0.5f, 0.2f, 0.5f, 0.25f, 0.5f,
+	0.3f, 0.5f, 0.35f, 0.5f, 0.4f, 0.5f, 0.45000002f, 0.5f,
+	0.5f, 0.5f, 0.55f, 0.5f, 0.6f, 0.5f, 0.65000004f, 0.5f,
+	0.7f, 0.5f, 0.75f, 0.5f, 0.8f, 0.5f, 0.85f, 0.5f,
+	0.90000004f, 0.5f, 0.95f, 0.5f, 1.0f, 0.5f, 0.0f, 0.55f,
+	0.05f, 0.55f, 0.1f, 0.55f, 0.15f, 0.55f, 0.2f, 0.55f,
+	0.25f, 0.55f, 0.3f, 0.55f, 0.35f, 0.55f, 0.4f, 0.55f,
+	0.45000002f, 0.55f, 0.5f, 0.55f, 0.55f, 0.55f, 0.6f, 0.55f,
+	0.65000004f, 0.55f, 0.7f, 0.55f, 0.75f, 0.55f, 0.8f, 0.55f,
+	0.85f, 0.55f, 0.90000004f, 0.55f, 0.95f, 0.55f, 1.0f, 0.55f,
+	0.0f, 0.6f, 0.05f, 0.6f, 0.1f, 0.6f, 0.15f, 0.6f,
+	0.2f, 0.6f, 0.25f, 0.6f, 0.3f, 0.6f, 0.35f, 0.6f,
+	0.4f, 0.6f, 0.45000002f, 0.6f, 0.5f, 0.6f, 0.55f, 0.6f,
+	0.6f, 0.6f, 0.65000004f, 0.6f, 0.7f, 0.6f, 0.75f, 0.6f,
+	0.8f, 0.6f, 0.85f, 0.6f, 0.90000004f, 0.6f, 0.95f, 0.6f,
+	1.0f, 0.6f, 0.0f, 0.65000004f, 0.05f, 0.65000004f, 0.1f, 0.65000004f,
+	0.15f, 0.65000004f, 0.2f, 0.65000004f, 0.25f, 0.65000004f, 0.3f, 0.65000004f,
+	0.35f, 0.65000004f, 0.4f, 0.65000004f, 0.45000002f, 0.65000004f, 0.5f, 0.65000004f,
+	0.55f, 0.65000004f, 0.6f, 0.65000004f, 0.65000004f, 0.65000004f, 0.7f, 0.65000004f,
+	0.75f, 0.65000004f, 0.8f, 0.65000004f, 0.85f, 0.65000004f, 0.90000004f, 0.65000004f,
+	0.95f, 0.65000004f, 1.0f, 0.65000004f, 0.0f, 0.7f, 0.05f, 0.7f,
+	0.1f, 0.7f, 0.15f, 0.7f, 0.2f, 0.7f, 0.25f, 0.7f,
+	0.3f, 0.7f, 0.35f, 0.7f, 0.4f, 0.7f, 0.45000002f, 0.7f,
+	0.5f, 0.7f, 0.55f, 0.7f, 0.6f, 0.7f, 0.65000004f, 0.7f,
+	0.7f, 0.7f, 0.75f, 0.7f, 0.8f, 0.7f, 0.85f, 0.7f,
+	0.90000004f, 0.7f, 0.95f, 0.7f, 1.0f, 0.7f, 0.0f, 0.75f,
+	0.05f, 0.75f, 0.1f, 0.75f, 0.15f, 0.75f, 0.2f, 0.75f,
+	0.25f, 0.75f, 0.3f, 0.75f, 0.35f, 0.75f, 0.4f, 0.75f,
+	0.45000002f, 0.75f, 0.5f, 0.75f, 0.55f, 0.75f, 0.6f, 0.75f,
+	0.65000004f, 0.75f, 0.7f, 0.75f, 0.75f, 0.75f, 0.8f, 0.75f,
+	0.85f, 0.75f, 0.90000004f, 0.75f, 0.95f, 0.75f, 1.0f, 0.75f,
+	0.0f, 0.8f, 0.05f, 0.8f, 0.1f, 0.8f, 0.15f, 0.8f,
+	0.2f, 0.8f, 0.25f, 0.8f, 0.3f, 0.8f, 0.35f, 0.8f,
+	0.4f, 0.8f, 0.45000002f, 0.8f, 0.5f, 0.8f, 0.55f, 0.8f,
+	0.6f, 0.8f, 0.65000004f, 0.8f, 0.7f, 0.8f, 0.75f, 0.8f,
+	0.8f, 0.8f, 0.85f, 0.8f, 0.90000004f, 0.8f, 0.95f, 0.8f,
+	1.0f, 0.8f, 0.0f, 0.85f, 0.05f, 0.85f, 0.1f, 0.85f,
+	0.15f, 0.85f, 0.2f, 0.85f, 0.25f, 0.85f, 0.3f, 0.85f,
+	0.35f, 0.85f, 0.4f, 0.85f, 0.45000002f, 0.85f, 0.5f, 0.85f,
+	0.55f, 0.85f, 0.6f, 0.85f, 0.65000004f, 0.85f, 0.7f, 0.85f,
+	0.75f, 0.85f, 0.8f, 0.85f, 0.85f, 0.85f, 0.90000004f, 0.85f,
+	0.95f, 0.85f, 1.0f, 0.85f, 0.0f, 0.90000004f, 0.05f, 0.90000004f,
+	0.1f, 0.90000004f, 0.15f, 0.90000004f, 0.2f, 0.90000004f, 0.25f, 0.90000004f,
+	0.3f, 0.90000004f, 0.35f, 0.90000004f, 0.4f, 0.90000004f, 0.45000002f, 0.90000004f,
+	0.5f, 0.90000004f, 0.55f, 0.90000004f, 0.6f, 0.90000004f, 0.65000004f, 0.90000004f,
+	0.7f, 0.90000004f, 0.75f, 0.90000004f, 0.8f, 0.90000004f, 0.85f, 0.90000004f,
+	0.90000004f, 0.90000004f, 0.95f, 0.90000004f, 1.0f, 0.90000004f, 0.0f, 0.95f,
+	0.05f, 0.95f, 0.1f, 0.95f, 0.15f, 0.95f, 0.2f, 0.95f,
+	0.25f, 0.95f, 0.3f, 0.95f, 0.35f, 0.95f, 0.4f, 0.95f,
+	0.45000002f, 0.95f, 0.5f, 0.95f, 0.55f, 0.95f, 0.6f, 0.95f,
+	0.65000004f, 0.95f, 0.7f, 0.95f, 0.75f, 0.95f, 0.8f, 0.95f,
+	0.85f, 0.95f, 0.90000004f, 0.95f, 0.95f, 0.95f, 1.0f, 0.95f,
+	0.0f, 1.0f, 0.05f, 1.0f, 0.1f, 1.0f, 0.15f, 1.0f,
+	0.2f, 1.0f, 0.25f, 1.0f, 0.3f, 1.0f, 0.35f, 1.0f,
+	0.4f, 1.0f, 0.45000002f, 1.0f, 0.5f, 1.0f, 0.55f, 1.0f,
+	0.6f, 1.0f, 0.65000004f, 1.0f, 0.7f, 1.0f, 0.75f, 1.0f,
+	0.8f, 1.0f, 0.85f, 1.0f, 0.90000004f, 1.0f, 0.95f, 1.0f,
+	1.0f, 1.0f
+};
+static const GLuint sphereIndices[2400] =
+{
+	0, 21, 22, 0, 22, 1, 1, 22, 23, 1, 23, 2, 2, 23, 24, 2,
+	24, 3, 3, 24, 25, 3, 25, 4, 4, 25, 26, 4, 26, 5, 5, 26,
+	27, 5, 27, 6, 6, 27, 28, 6, 28, 7, 7, 28, 29, 7, 29, 8,
+	8, 29, 30, 8, 30, 9, 9, 30, 31, 9, 31, 10, 10, 31, 32, 10,
+	32, 11, 11, 32, 33, 11, 33, 12, 12, 33, 34, 12, 34, 13, 13, 34,
+	35, 13, 35, 14, 14, 35, 36, 14, 36, 15, 15, 36, 37, 15, 37, 16,
+	16, 37, 38, 16, 38, 17, 17, 38, 39, 17, 39, 18, 18, 39, 40, 18,
+	40, 19, 19, 40, 41, 19, 41, 20, 21, 42, 43, 21, 43, 22, 22, 43,
+	44, 22, 44, 23, 23, 44, 45, 23, 45, 24, 24, 45, 46, 24, 46, 25,
+	25, 46, 47, 25, 47, 26, 26, 47, 48, 26, 48, 27, 27, 48, 49, 27,
+	49, 28, 28, 49, 50, 28, 50, 29, 29, 50, 51, 29, 51, 30, 30, 51,
+	52, 30, 52, 31, 31, 52, 53, 31, 53, 32, 32, 53, 54, 32, 54, 33,
+	33, 54, 55, 33, 55, 34, 34, 55, 56, 34, 56, 35, 35, 56, 57, 35,
+	57, 36, 36, 57, 58, 36, 58, 37, 37, 58, 59, 37, 59, 38, 38, 59,
+	60, 38, 60, 39, 39, 60, 61, 39, 61, 40, 40, 61, 62, 40, 62, 41,
+	42, 63, 64, 42, 64, 43, 43, 64, 65, 43, 65, 44, 44, 65, 66, 44,
+	66, 45, 45, 66, 67, 45, 67, 46, 46, 67, 68, 46, 68, 47, 47, 68,
+	69, 47, 69, 48, 48, 69, 70, 48, 70, 49, 49, 70, 71, 49, 71, 50,
+	50, 71, 72, 50, 72, 51, 51, 72, 73, 51, 73, 52, 52, 73, 74, 52,
+	74, 53, 53, 74, 75, 53, 75, 54, 54, 75, 76, 54, 76, 55, 55, 76,
+	77, 55, 77, 56, 56, 77, 78, 56, 78, 57, 57, 78, 79, 57, 79, 58,
+	58, 79, 80, 58, 80, 59, 59, 80, 81, 59, 81, 60, 60, 81, 82, 60,
+	82, 61, 61, 82, 83, 61, 83, 62, 63, 84, 85, 63, 85, 64, 64, 85,
+	86, 64, 86, 65, 65, 86, 87, 65, 87, 66, 66, 87, 88, 66, 88, 67,
+	67, 88, 89, 67, 89, 68, 68, 89, 90, 68, 90, 69, 69, 90, 91, 69,
+	91, 70, 70, 91, 92, 70, 92, 71, 71, 92, 93, 71, 93, 72, 72, 93,
+	94, 72, 94, 73, 73, 94, 95, 73, 95, 74, 74, 95, 96, 74, 96, 75,
+	75, 96, 97, 75, 97, 76, 76, 97, 98, 76, 98, 77, 77, 98, 99, 77,
+	99, 78, 78, 99, 100, 78, 100, 79, 79, 100, 101, 79, 101, 80, 80, 101,
+	102, 80, 102, 81, 81, 102, 103, 81, 103, 82, 82, 103, 104, 82, 104, 83,
+	84, 105, 106, 84, 106, 85, 85, 106, 107, 85, 107, 86, 86, 107, 108, 86,
+	108, 87, 87, 108, 109, 87, 109, 88, 88, 109, 110, 88, 110, 89, 89, 110,
+	111, 89, 111, 90, 90, 111, 112, 90, 112, 91, 91, 112, 113, 91, 113, 92,
+	92, 113, 114, 92, 114, 93, 93, 114, 115, 93, 115, 94, 94, 115, 116, 94,
+	116, 95, 95, 116, 117, 95, 117, 96, 96, 117, 118, 96, 118, 97, 97, 118,
+	119, 97, 119, 98, 98, 119, 120, 98, 120, 99, 99, 120, 121, 99, 121, 100,
+	100, 121, 122, 100, 122, 101, 101, 122, 123, 101, 123, 102, 102, 123, 124, 102,
+	124, 103, 103, 124, 125, 103, 125, 104, 105, 126, 127, 105, 127, 106, 106, 127,
+	128, 106, 128, 107, 107, 128, 129, 107, 129, 108, 108, 129, 130, 108, 130, 109,
+	109, 130, 131, 109, 131, 110, 110, 131, 132, 110, 132, 111, 111, 132, 133, 111,
+	133, 112, 112, 133, 134, 112, 134, 113, 113, 134, 135, 113, 135, 114, 114, 135,
+	136, 114, 136, 115, 115, 136, 137, 115, 137, 116, 116, 137, 138, 116, 138, 117,
+	117, 138, 139, 117, 139, 118, 118, 139, 140, 118, 140, 119, 119, 140, 141, 119,
+	141, 120, 120, 141, 142, 120, 142, 121, 121, 142, 143, 121, 143, 122, 122, 143,
+	144, 122, 144, 123, 123, 144, 145, 123, 145, 124, 124, 145, 146, 124, 146, 125,
+	126, 147, 148, 126, 148, 127, 127, 148, 149, 127, 149, 128, 128, 149, 150, 128,
+	150, 129, 129, 150, 151, 129, 151, 130, 130, 151, 152, 130, 152, 131, 131, 152,
+	153, 131, 153, 132, 132, 153, 154, 132, 154, 133, 133, 154, 155, 133, 155, 134,
+	134, 155, 156, 134, 156, 135, 135, 156, 157, 135, 157, 136, 136, 157, 158, 136,
+	158, 137, 137, 158, 159, 137, 159, 138, 138, 159, 160, 138, 160, 139, 139, 160,
+	161, 139, 161, 140, 140, 161, 162, 140, 162, 141, 141, 162, 163, 141, 163, 142,
+	142, 163, 164, 142, 164, 143, 143, 164, 165, 143, 165, 144, 144, 165, 166, 144,
+	166, 145, 145, 166, 167, 145, 167, 146, 147, 168, 169, 147, 169, 148, 148, 169,
+	170, 148, 170, 149, 149, 170, 171, 149, 171, 150, 150, 171, 172, 150, 172, 151,
+	151, 172, 173, 151, 173, 152, 152, 173, 174, 152, 174, 153, 153, 174, 175, 153,
+	175, 154, 154, 175, 176, 154, 176, 155, 155, 176, 177, 155, 177, 156, 156, 177,
+	178, 156, 178, 157, 157, 178, 179, 157, 179, 158, 158, 179, 180, 158, 180, 159,
+	159, 180, 181, 159, 181, 160, 160, 181, 182, 160, 182, 161, 161, 182, 183, 161,
+	183, 162, 162, 183, 184, 162, 184, 163, 163, 184, 185, 163, 185, 164, 164, 185,
+	186, 164, 186, 165, 165, 186, 187, 165, 187, 166, 166, 187, 188, 166, 188, 167,
+	168, 189, 190, 168, 190, 169, 169, 190, 191, 169, 191, 170, 170, 191, 192, 170,
+	192, 171, 171, 192, 193, 171, 193, 172, 172, 193, 194, 172, 194, 173, 173, 194,
+	195, 173, 195, 174, 174, 195, 196, 174, 196, 175, 175, 196, 197, 175, 197, 176,
+	176, 197, 198, 176, 198, 177, 177, 198, 199, 177, 199, 178, 178, 199, 200, 178,
+	200, 179, 179, 200, 201, 179, 201, 180, 180, 201, 202, 180, 202, 181, 181, 202,
+	203, 181, 203, 182, 182, 203, 204, 182, 204, 183, 183, 204, 205, 183, 205, 184,
+	184, 205, 206, 184, 206, 185, 185, 206, 207, 185, 207, 186, 186, 207, 208, 186,
+	208, 187, 187, 208, 209, 187, 209, 188, 189, 210, 211, 189, 211, 190, 190, 211,
+	212, 190, 212, 191, 191, 212, 213, 191, 213, 192, 192, 213, 214, 192, 214, 193,
+	193, 214, 215, 193, 215, 194, 194, 215, 216, 194, 216, 195, 195, 216, 217, 195,
+	217, 196, 196, 217, 218, 196, 218, 197, 197, 218, 219, 197, 219, 198, 198, 219,
+	220, 198, 220, 199, 199, 220, 221, 199, 221, 200, 200, 221, 222, 200, 222, 201,
+	201, 222, 223, 201, 223, 202, 202, 223, 224, 202, 224, 203, 203, 224, 225, 203,
+	225, 204, 204, 225, 226, 204, 226, 205, 205, 226, 227, 205, 227, 206, 206, 227,
+	228, 206, 228, 207, 207, 228, 229, 207, 229, 208, 208, 229, 230, 208, 230, 209,
+	210, 231, 232, 210, 232, 211, 211, 232, 233, 211, 233, 212, 212, 233, 234, 212,
+	234, 213, 213, 234, 235, 213, 235, 214, 214, 235, 236, 214, 236, 215, 215, 236,
+	237, 215, 237, 216, 216, 237, 238, 216, 238, 217, 217, 238, 239, 217, 239, 218,
+	218, 239, 240, 218, 240, 219, 219, 240, 241, 219, 241, 220, 220, 241, 242, 220,
+	242, 221, 221, 242, 243, 221, 243, 222, 222, 243, 244, 222, 244, 223, 223, 244,
+	245, 223, 245, 224, 224, 245, 246, 224, 246, 225, 225, 246, 247, 225, 247, 226,
+	226, 247, 248, 226, 248, 227, 227, 248, 249, 227, 249, 228, 228, 249, 250, 228,
+	250, 229, 229, 250, 251, 229, 251, 230, 231, 252, 253, 231, 253, 232, 232, 253,
+	254, 232, 254, 233, 233, 254, 255, 233, 255, 234, 234, 255, 256, 234, 256, 235,
+	235, 256, 257, 235, 257, 236, 236, 257, 258, 236, 258, 237, 237, 258, 259, 237,
+	259, 238, 238, 259, 260, 238, 260, 239, 239, 260, 261, 239, 261, 240, 240, 261,
+	262, 240, 262, 241, 241, 262, 263, 241, 263, 242, 242, 263, 264, 242, 264, 243,
+	243, 264, 265, 243, 265, 244, 244, 265, 266, 244, 266, 245, 245, 266, 267, 245,
+	267, 246, 246, 267, 268, 246, 268, 247, 247, 268, 269, 247, 269, 248, 248, 269,
+	270, 248, 270, 249, 249, 270, 271, 249, 271, 250, 250, 271, 272, 250, 272, 251,
+	252, 273, 274, 252, 274, 253, 253, 274, 275, 253, 275, 254, 254, 275, 276, 254,
+	276, 255, 255, 276, 277, 255, 277, 256, 256, 277, 278, 256, 278, 257, 257, 278,
+	279, 257, 279, 258, 258, 279, 280, 258, 280, 259, 259, 280, 281, 259, 281, 260,
+	260, 281, 282, 260, 282, 261, 261, 282, 283, 261, 283, 262, 262, 283, 284, 262,
+	284, 263, 263, 284, 285, 263, 285, 264, 264, 285, 286, 264, 286, 265, 265, 286,
+	287, 265, 287, 266, 266, 287, 288, 266, 288, 267, 267, 288, 289, 267, 289, 268,
+	268, 289, 290, 268, 290, 269, 269, 290, 291, 269, 291, 270, 270, 291, 292, 270,
+	292, 271, 271, 292, 293, 271, 293, 272, 273, 294, 295, 273, 295, 274, 274, 295,
+	296, 274, 296, 275, 275, 296, 297, 275, 297, 276, 276, 297, 298, 276, 298, 277,
+	277, 298, 299, 277, 299, 278, 278, 299, 300, 278, 300, 279, 279, 300, 301, 279,
+	301, 280, 280, 301, 302, 280, 302, 281, 281, 302, 303, 281, 303, 282, 282, 303,
+	304, 282, 304, 283, 283, 304, 305, 283, 305, 284, 284, 305, 306, 284, 306, 285,
+	285, 306, 307, 285, 307, 286, 286, 307, 308, 286, 308, 287, 287, 308, 309, 287,
+	309, 288, 288, 309, 310, 288, 310, 289, 289, 310, 311, 289, 311, 290, 290, 311,
+	312, 290, 312, 291, 291, 312, 313, 291, 313, 292, 292, 313, 314, 292, 314, 293,
+	294, 315, 316, 294, 316, 295, 295, 316, 317, 295, 317, 296, 296, 317, 318, 296,
+	318, 297, 297, 318, 319, 297, 319, 298, 298, 319, 320, 298, 320, 299, 299, 320,
+	321, 299, 321, 300, 300, 321, 322, 300, 322, 301, 301, 322, 323, 301, 323, 302,
+	302, 323, 324, 302, 324, 303, 303, 324, 325, 303, 325, 304, 304, 325, 326, 304,
+	326, 305, 305, 326, 327, 305, 327, 306, 306, 327, 328, 306, 328, 307, 307, 328,
+	329, 307, 329, 308, 308, 329, 330, 308, 330, 309, 309, 330, 331, 309, 331, 310,
+	310, 331, 332, 310, 332, 311, 311, 332, 333, 311, 333, 312, 312, 333, 334, 312,
+	334, 313, 313, 334, 335, 313, 335, 314, 315, 336, 337, 315, 337, 316, 316, 337,
+	338, 316, 338, 317, 317, 338, 339, 317, 339, 318, 318, 339, 340, 318, 340, 319,
+	319, 340, 341, 319, 341, 320, 320, 341, 342, 320, 342, 321, 321, 342, 343, 321,
+	343, 322, 322, 343, 344, 322, 344, 323, 323, 344, 345, 323, 345, 324, 324, 345,
+	346, 324, 346, 325, 325, 346, 347, 325, 347, 326, 326, 347, 348, 326, 348, 327,
+	327, 348, 349, 327, 349, 328, 328, 349, 350, 328, 350, 329, 329, 350, 351, 329,
+	351, 330, 330, 351, 352, 330, 352, 331, 331, 352, 353, 331, 353, 332, 332, 353,
+	354, 332, 354, 333, 333, 354, 355, 333, 355, 334, 334, 355, 356, 334, 356, 335,
+	336, 357, 358, 336, 358, 337, 337, 358, 359, 337, 359, 338, 338, 359, 360, 338,
+	360, 339, 339, 360, 361, 339, 361, 340, 340, 361, 362, 340, 362, 341, 341, 362,
+	363, 341, 363, 342, 342, 363, 364, 342, 364, 343, 343, 364, 365, 343, 365, 344,
+	344, 365, 366, 344, 366, 345, 345, 366, 367, 345, 367, 346, 346, 367, 368, 346,
+	368, 347, 347, 368, 369, 347, 369, 348, 348, 369, 370, 348, 370, 349, 349, 370,
+	371, 349, 371, 350, 350, 371, 372, 350, 372, 351, 351, 372, 373, 351, 373, 352,
+	352, 373, 374, 352, 374, 353, 353, 374, 375, 353, 375, 354, 354, 375, 376, 354,
+	376, 355, 355, 376, 377, 355, 377, 356, 357, 378, 379, 357, 379, 358, 358, 379,
+	380, 358, 380, 359, 359, 380, 381, 359, 381, 360, 360, 381, 382, 360, 382, 361,
+	361, 382, 383, 361, 383, 362, 362, 383, 384, 362, 384, 363, 363, 384, 385, 363,
+	385, 364, 364, 385, 386, 364, 386, 365, 365, 386, 387, 365, 387, 366, 366, 387,
+	388, 366, 388, 367, 367, 388, 389, 367, 389, 368, 368, 389, 390, 368, 390, 369,
+	369, 390, 391, 369, 391, 370, 370, 391, 392, 370, 392, 371, 371, 392, 393, 371,
+	393, 372, 372, 393, 394, 372, 394, 373, 373, 394, 395, 373, 395, 374, 374, 395,
+	396, 374, 396, 375, 375, 396, 397, 375, 397, 376, 376, 397, 398, 376, 398, 377,
+	378, 399, 400, 378, 400, 379, 379, 400, 401, 379, 401, 380, 380, 401, 402, 380,
+	402, 381, 381, 402, 403, 381, 403, 382, 382, 403, 404, 382, 404, 383, 383, 404,
+	405, 383, 405, 384, 384, 405, 406, 384, 406, 385, 385, 406, 407, 385, 407, 386,
+	386, 407, 408, 386, 408, 387, 387, 408, 409, 387, 409, 388, 388, 409, 410, 388,
+	410, 389, 389, 410, 411, 389, 411, 390, 390, 411, 412, 390, 412, 391, 391, 412,
+	413, 391, 413, 392, 392, 413, 414, 392, 414, 393, 393, 414, 415, 393, 415, 394,
+	394, 415, 416, 394, 416, 395, 395, 416, 417, 395, 417, 396, 396, 417, 418, 396,
+	418, 397, 397, 418, 419, 397, 419, 398, 399, 420, 421, 399, 421, 400, 400, 421,
+	422, 400, 422, 401, 401, 422, 423, 401, 423, 402, 402, 423, 424, 402, 424, 403,
+	403, 424, 425, 403, 425, 404, 404, 425, 426, 404, 426, 405, 405, 426, 427, 405,
+	427, 406, 406, 427, 428, 406, 428, 407, 407, 428, 429, 407, 429, 408, 408, 429,
+	430, 408, 430, 409, 409, 430, 431, 409, 431, 410, 410, 431, 432, 410, 432, 411,
+	411, 432, 433, 411, 433, 412, 412, 433, 434, 412, 434, 413, 413, 434, 435, 413,
+	435, 414, 414, 435, 436, 414, 436, 415, 415, 436, 437, 415, 437, 416, 416, 437,
+	438, 416, 438, 417, 417, 438, 439, 417, 439, 418, 418, 439, 440, 418, 440, 419
+};
+
+ShapeArrays BakedTables::sphere()
+{
+	ShapeArrays arrays = { sphereVertex, sphereNormals, sphereTexCoords, sphereIndices, 441, 2400, 1.0f, 20.0f };
+	return arrays;
+}
+
+// ShapeGen::genCylinder(1, 24, 24)
+static const float cylinderVertex[1875] =
+{
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+	2.0f, 1.0f, 0.0f, 3.0f, 1.0f, 0.0f, 4.0f, 1.0f,
+	0.0f, 5.0f, 1.0f, 0.0f, 6.0f, 1.0f, 0.0f, 7.0f,
+	1.0f, 0.0f, 8.0f, 1.0f, 0.0f, 9.0f, 1.0f, 0.0f,
+	10.0f, 1.0f, 0.0f, 11.0f, 1.0f, 0.0f, 12.0f, 1.0f,
+	0.0f, 13.0f, 1.0f, 0.0f, 14.0f, 1.0f, 0.0f, 15.0f,
+	1.0f, 0.0f, 16.0f, 1.0f, 0.0f, 17.0f, 1.0f, 0.0f,
+	18.0f, 1.0f, 0.0f, 19.0f, 1.0f, 0.0f, 20.0f, 1.0f,
+	0.0f, 21.0f, 1.0f, 0.0f, 22.0f, 1.0f, 0.0f, 23.0f,
+	1.0f, 0.0f, 24.0f, 0.9659258f, 0.25881904f, 0.0f, 0.9659258f, 0.25881904f,
+	1.0f, 0.9659258f, 0.25881904f, 2.0f, 0.9659258f, 0.25881904f, 3.0f, 0.9659258f,
+	0.25881904f, 4.0f, 0.9659258f, 0.25881904f, 5.0f, 0.9659258f, 0.25881904f, 6.0f,
+	0.9659258f, 0.25881904f, 7.0f, 0.9659258f, 0.25881904f, 8.0f, 0.9659258f, 0.25881904f,
+	9.0f, 0.9659258f, 0.25881904f, 10.0f, 0.9659258f, 0.25881904f, 11.0f, 0.9659258f,
+	0.25881904f, 12.0f, 0.9659258f, 0.25881904f, 13.0f, 0.9659258f, 0.25881904f, 14.0f,
+	0.9659258f, 0.25881904f, 15.0f, 0.9659258f, 0.25881904f, 16.0f, 0.9659258f, 0.25881904f,
+	17.0f, 0.9659258f, 0.25881904f, 18.0f, 0.9659258f, 0.25881904f, 19.0f, 0.9659258f,
+	0.25881904f, 20.0f, 0.9659258f, 0.25881904f, 21.0f, 0.9659258f, 0.25881904f, 22.0f,
+	0.9659258f, 0.25881904f, 23.0f, 0.9659258f, 0.25881904f, 24.0f, 0.8660254f, 0.5f,
+	0.0f, 0.8660254f, 0.5f, 1.0f, 0.8660254f, 0.5f, 2.0f, 0.8660254f,
+	0.5f, 3.0f, 0.8660254f, 0.5f, 4.0f, 0.8660254f, 0.5f, 5.0f,
+	0.8660254f, 0.5f, 6.0f, 0.8660254f, 0.5f, 7.0f, 0.8660254f, 0.5f,
+	8.0f, 0.8660254f, 0.5f, 9.0f, 0.8660254f, 0.5f, 10.0f, 0.8660254f,
+	0.5f, 11.0f, 0.8660254f, 0.5f, 12.0f, 0.8660254f, 0.5f, 13.0f,
+	0.8660254f, 0.5f, 14.0f, 0.8660254f, 0.5f, 15.0f, 0.8660254f, 0.5f,
+	16.0f, 0.8660254f, 0.5f, 17.0f, 0.8660254f, 0.5f, 18.0f, 0.8660254f,
+	0.5f, 19.0f, 0.8660254f, 0.5f, 20.0f, 0.8660254f, 0.5f, 21.0f,
+	0.8660254f, 0.5f, 22.0f, 0.8660254f, 0.5f, 23.0f, 0.8660254f, 0.5f,
+	24.0f, 0.70710677f, 0.70710677f, 0.0f, 0.70710677f, 0.70710677f, 1.0f, 0.70710677f,
+	0.70710677f, 2.0f, 0.70710677f, 0.70710677f, 3.0f, 0.70710677f, 0.70710677f, 4.0f,
+	0.70710677f, 0.70710677f, 5.0f, 0.70710677f, 0.70710677f, 6.0f, 0.70710677f, 0.70710677f,
+	7.0f, 0.70710677f, 0.70710677f, 8.0f, 0.70710677f, 0.70710677f, 9.0f, 0.70710677f,
+	0.70710677f, 10.0f, 0.70710677f, 0.70710677f, 11.0f, 0.70710677f, 0.70710677f, 12.0f,
+	0.70710677f, 0.70710677f, 13.0f, 0.70710677f, 0.70710677f, 14.0f, 0.70710677f, 0.70710677f,
+	15.0f, 0.70710677f, 0.70710677f, 16.0f, 0.70710677f, 0.70710677f, 17.0f, 0.70710677f,
+	0.70710677f, 18.0f, 0.70710677f, 0.70710677f, 19.0f, 0.70710677f, 0.70710677f, 20.0f,
+	0.70710677f, 0.70710677f, 21.0f, 0.70710677f, 0.70710677f, 22.0f, 0.70710677f, 0.70710677f,
+	23.0f, 0.70710677f, 0.70710677f, 24.0f, 0.49999997f, 0.86602545f, 0.0f, 0.49999997f,
+	0.86602545f, 1.0f, 0.49999997f, 0.86602545f, 2.0f, 0.49999997f, 0.86602545f, 3.0f,
+	0.49999997f, 0.86602545f, 4.0f, 0.49999997f, 0.86602545f, 5.0f, 0.49999997f, 0.86602545f,
+	6.0f, 0.49999997f, 0.86602545f, 7.0f, 0.49999997f, 0.86602545f, 8.0f, 0.49999997f,
+	0.86602545f, 9.0f, 0.49999997f, 0.86602545f, 10.0f, 0.49999997f, 0.86602545f, 11.0f,
+	0.49999997f, 0.86602545f, 12.0f, 0.49999997f, 0.86602545f, 13.0f, 0.49999997f, 0.86602545f,
+	14.0f, 0.49999997f, 0.86602545f, 15.0f, 0.49999997f, 0.86602545f, 16.0f, 0.49999997f,
+	0.86602545f, 17.0f, 0.49999997f, 0.86602545f, 18.0f, 0.49999997f, 0.86602545f, 19.0f,
+	0.49999997f, 0.86602545f, 20.0f, 0.49999997f, 0.86602545f, 21.0f, 0.49999997f, 0.86602545f,
+	22.0f, 0.49999997f, 0.86602545f, 23.0f, 0.49999997f, 0.86602545f, 24.0f, 0.25881907f,
+	0.9659258f, 0.0f, 0.25881907f, 0.9659258f, 1.0f, 0.25881907f, 0.9659258f, 2.0f,
+	0.25881907f, 0.9659258f, 3.0f, 0.25881907f, 0.9659258f, 4.0f, 0.25881907f, 0.9659258f,
+	5.0f, 0.25881907f, 0.9659258f, 6.0f, 0.25881907f, 0.9659258f, 7.0f, 0.25881907f,
+	0.9659258f, 8.0f, 0.25881907f, 0.9659258f, 9.0f, 0.25881907f, 0.9659258f, 10.0f,
+	0.25881907f, 0.9659258f, 11.0f, 0.25881907f, 0.9659258f, 12.0f, 0.25881907f, 0.9659258f,
+	13.0f, 0.25881907f, 0.9659258f, 14.0f, 0.25881907f, 0.9659258f, 15.0f, 0.25881907f,
+	0.9659258f, 16.0f, 0.25881907f, 0.9659258f, 17.0f, 0.25881907f, 0.9659258f, 18.0f,
+	0.25881907f, 0.9659258f, 19.0f, 0.25881907f, 0.9659258f, 20.0f, 0.25881907f, 0.9659258f,
+	21.0f, 0.25881907f, 0.9659258f, 22.0f, 0.25881907f, 0.9659258f, 23.0f, 0.25881907f,
+	0.9659258f, 24.0f, -4.371139e-08f, 1.0f, 0.0f, -4.371139e-08f, 1.0f, 1.0f,
+	-4.371139e-08f, 1.0f, 2.0f, -4.371139e-08f, 1.0f, 3.0f, -4.371139e-08f, 1.0f,
+	4.0f, -4.371139e-08f, 1.0f, 5.0f, -4.371139e-08f, 1.0f, 6.0f, -4.371139e-08f,
+	1.0f, 7.0f, -4.371139e-08f, 1.0f, 8.0f, -4.371139e-08f, 1.0f, 9.0f,
+	-4.371139e-08f, 1.0f, 10.0f, -4.371139e-08f, 1.0f, 11.0f, -4.371139e-08f, 1.0f,
+	12.0f, -4.371139e-08f, 1.0f, 13.0f, -4.371139e-08f, 1.0f, 14.0f, -4.371139e-08f,
+	1.0f, 15.0f, -4.371139e-08f, 1.0f, 16.0f, -4.371139e-08f, 1.0f, 17.0f,
+	-4.371139e-08f, 1.0f, 18.0f, -4.371139e-08f, 1.0f, 19.0f, -4.371139e-08f, 1.0f,
+	20.0f, -4.371139e-08f, 1.0f, 21.0f, -4.371139e-08f, 1.0f, 22.0f, -4.371139e-08f,
+	1.0f, 23.0f, -4.371139e-08f, 1.0f, 24.0f, -0.25881904f, 0.9659258f, 0.0f,
+	-0.25881904f, 0.9659258f, 1.0f, -0.25881904f, 0.9659258f, 2.0f, -0.25881904f, 0.9659258f,
+	3.0f, -0.25881904f, 0.9659258f, 4.0f, -0.25881904f, 0.9659258f, 5.0f, -0.25881904f,
+	0.9659258f, 6.0f, -0.25881904f, 0.9659258f, 7.0f, -0.25881904f, 0.9659258f, 8.0f,
+	-0.25881904f, 0.9659258f, 9.0f, -0.25881904f, 0.9659258f, 10.0f, -0.25881904f, 0.9659258f,
+	11.0f, -0.25881904f, 0.9659258f, 12.0f, -0.25881904f, 0.9659258f, 13.0f, -0.25881904f,
+	0.9659258f, 14.0f, -0.25881904f, 0.9659258f, 15.0f, -0.25881904f, 0.9659258f, 16.0f,
+	-0.25881904f, 0.9659258f, 17.0f, -0.25881904f, 0.9659258f, 18.0f, -0.25881904f, 0.9659258f,
+	19.0f, -0.25881904f, 0.9659258f, 20.0f, -0.25881904f, 0.9659258f, 21.0f, -0.25881904f,
+	0.9659258f, 22.0f, -0.25881904f, 0.9659258f, 23.0f, -0.25881904f, 0.9659258f, 24.0f,
+	-0.50000006f, 0.8660254f, 0.0f, -0.50000006f, 0.8660254f, 1.0f, -0.50000006f, 0.8660254f,
+	2.0f, -0.50000006f, 0.8660254f, 3.0f, -0.50000006f, 0.8660254f, 4.0f, -0.50000006f,
+	0.8660254f, 5.0f, -0.50000006f, 0.8660254f, 6.0f, -0.50000006f, 0.8660254f, 7.0f,
+	-0.50000006f, 0.8660254f, 8.0f, -0.50000006f, 0.8660254f, 9.0f, -0.50000006f, 0.8660254f,
+	10.0f, -0.50000006f, 0.8660254f, 11.0f, -0.50000006f, 0.8660254f, 12.0f, -0.50000006f,
+	0.8660254f, 13.0f, -0.50000006f, 0.8660254f, 14.0f, -0.50000006f, 0.8660254f, 15.0f,
+	-0.50000006f, 0.8660254f, 16.0f, -0.50000006f, 0.8660254f, 17.0f, -0.50000006f, 0.8660254f,
+	18.0f, -0.50000006f, 0.8660254f, 19.0f, -0.50000006f, 0.8660254f, 20.0f, -0.50000006f,
+	0.8660254f, 21.0f, -0.50000006f, 0.8660254f, 22.0f, -0.50000006f, 0.8660254f, 23.0f,
+	-0.50000006f, 0.8660254f, 24.0f, -0.70710677f, 0.70710677f, 0.0f, -0.70710677f, 0.70710677f,
+	1.0f, -0.70710677f, 0.70710677f, 2.0f, -0.70710677f, 0.70710677f, 3.0f, -0.70710677f,
+	0.70710677f, 4.0f, -0.70710677f, 0.70710677f, 5.0f, -0.70710677f, 0.70710677f, 6.0f,
+	-0.70710677f, 0.70710677f, 7.0f, -0.70710677f, 0.70710677f, 8.0f, -0.70710677f, 0.70710677f,
+	9.0f, -0.70710677f, 0.70710677f, 10.0f, -0.70710677f, 0.70710677f, 11.0f, -0.70710677f,
+	0.70710677f, 12.0f, -0.70710677f, 0.70710677f, 13.0f, -0.70710677f, 0.70710677f, 14.0f,
+	-0.70710677f, 0.70710677f, 15.0f, -0.70710677f, 0.70710677f, 16.0f, -0.70710677f, 0.70710677f,
+	17.0f, -0.70710677f, 0.70710677f, 18.0f, -0.70710677f, 0.70710677f, 19.0f, -0.70710677f,
+	0.70710677f, 20.0f, -0.70710677f, 0.70710677f, 21.0f, -0.70710677f, 0.70710677f, 22.0f,
+	-0.70710677f, 0.70710677f, 23.0f, -0.70710677f, 0.70710677f, 24.0f, -0.8660254f, 0.50000006f,
+	0.0f, -0.8660254f, 0.50000006f, 1.0f, -0.8660254f, 0.50000006f, 2.0f, -0.8660254f,
+	0.50000006f, 3.0f, -0.8660254f, 0.50000006f, 4.0f, -0.8660254f, 0.50000006f, 5.0f,
+	-0.8660254f, 0.50000006f, 6.0f, -0.8660254f, 0.50000006f, 7.0f, -0.8660254f, 0.50000006f,
+	8.0f, -0.8660254f, 0.50000006f, 9.0f, -0.8660254f, 0.50000006f, 10.0f, -0.8660254f,
+	0.50000006f, 11.0f, -0.8660254f, 0.50000006f, 12.0f, -0.8660254f, 0.50000006f, 13.0f,
+	-0.8660254f, 0.50000006f, 14.0f, -0.8660254f, 0.50000006f, 15.0f, -0.8660254f, 0.50000006f,
+	16.0f, -0.8660254f, 0.50000006f, 17.0f, -0.8660254f, 0.50000006f, 18.0f, -0.8660254f,
+	0.50000006f, 19.0f, -0.8660254f, 0.50000006f, 20.0f, -0.8660254f, 0.50000006f, 21.0f,
+	-0.8660254f, 0.50000006f, 22.0f, -0.8660254f, 0.50000006f, 23.0f, -0.8660254f, 0.50000006f,
+	24.0f, -0.9659258f, 0.25881913f, 0.0f, -0.9659258f, 0.25881913f, 1.0f, -0.9659258f,
+	0.25881913f, 2.0f, -0.9659258f, 0.25881913f, 3.0f, -0.9659258f, 0.25881913f, 4.0f,
+	-0.9659258f, 0.25881913f, 5.0f, -0.9659258f, 0.25881913f, 6.0f, -0.9659258f, 0.25881913f,
+	7.0f, -0.9659258f, 0.25881913f, 8.0f, -0.9659258f, 0.25881913f, 9.0f, -0.9659258f,
+	0.25881913f, 10.0f, -0.9659258f, 0.25881913f, 11.0f, -0.9659258f, 0.25881913f, 12.0f,
+	-0.9659258f, 0.25881913f, 13.0f, -0.9659258f, 0.25881913f, 14.0f, -0.9659258f, 0.25881913f,
+	15.0f, -0.9659258f, 0.25881913f, 16.0f, -0.9659258f, 0.25881913f, 17.0f, -0.9659258f,
+	0.25881913f, 18.0f, -0.9659258f, 0.25881913f, 19.0f, -0.9659258f, 0.25881913f, 20.0f,
+	-0.9659258f, 0.25881913f, 21.0f, -0.9659258f, 0.25881913f, 22.0f, -0.9659258f, 0.25881913f,
+	23.0f, -0.9659258f, 0.25881913f, 24.0f, -1.0f, -8.742278e-08f, 0.0f, -1.0f,
+	-8.742278e-08f, 1.0f, -1.0f, -8.742278e-08f, 2.0f, -1.0f, -8.742278e-08f, 3.0f,
+	-1.0f, -8.742278e-08f, 4.0f, -1.0f, -8.742278e-08f, 5.0f, -1.0f, -8.742278e-08f,
+	6.0f, -1.0f, -8.742278e-08f, 7.0f, -1.0f, -8.742278e-08f, 8.0f, -1.0f,
+	-8.742278e-08f, 9.0f, -1.0f, -8.742278e-08f, 10.0f, -1.0f, -8.742278e-08f, 11.0f,
+	-1.0f, -8.742278e-08f, 12.0f, -1.0f, -8.742278e-08f, 13.0f, -1.0f, -8.742278e-08f,
+	14.0f, -1.0f, -8.742278e-08f, 15.0f, -1.0f, -8.742278e-08f, 16.0f, -1.0f,
+	-8.742278e-08f, 17.0f, -1.0f, -8.742278e-08f, 18.0f, -1.0f, -8.742278e-08f, 19.0f,
+	-1.0f, -8.742278e-08f, 20.0f, -1.0f, -8.742278e-08f, 21.0f, -1.0f, -8.742278e-08f,
+	22.0f, -1.0f, -8.742278e-08f, 23.0f, -1.0f, -8.742278e-08f, 24.0f, -0.9659258f,
+	-0.25881907f, 0.0f, -0.9659258f, -0.25881907f, 1.0f, -0.9659258f, -0.25881907f, 2.0f,
+	-0.9659258f, -0.25881907f, 3.0f, -0.9659258f, -0.25881907f, 4.0f, -0.9659258f, -0.25881907f,
+	5.0f, -0.9659258f, -0.25881907f, 6.0f, -0.9659258f, -0.25881907f, 7.0f, -0.9659258f,
+	-0.25881907f, 8.0f, -0.9659258f, -0.25881907f, 9.0f, -0.9659258f, -0.25881907f, 10.0f,
+	-0.9659258f, -0.25881907f, 11.0f, -0.9659258f, -0.25881907f, 12.0f, -0.9659258f, -0.25881907f,
+	13.0f, -0.9659258f, -0.25881907f, 14.0f, -0.9659258f, -0.25881907f, 15.0f, -0.9659258f,
+	-0.25881907f, 16.0f, -0.9659258f, -0.25881907f, 17.0f, -0.9659258f, -0.25881907f, 18.0f,
+	-0.9659258f, -0.25881907f, 19.0f, -0.9659258f, -0.25881907f, 20.0f, -0.9659258f, -0.25881907f,
+	21.0f, -0.9659258f, -0.25881907f, 22.0f, -0.9659258f, -0.25881907f, 23.0f, -0.9659258f,
+	-0.25881907f, 24.0f, -0.8660254f, -0.49999997f, 0.0f, -0.8660254f, -0.49999997f, 1.0f,
+	-0.8660254f, -0.49999997f, 2.0f, -0.8660254f, -0.49999997f, 3.0f, -0.8660254f, -0.49999997f,
+	4.0f, -0.8660254f, -0.49999997f, 5.0f, -0.8660254f, -0.49999997f, 6.0f, -0.8660254f,
+	-0.49999997f, 7.0f, -0.8660254f, -0.49999997f, 8.0f, -0.8660254f, -0.49999997f, 9.0f,
+	-0.8660254f, -0.49999997f, 10.0f, -0.8660254f, -0.49999997f, 11.0f, -0.8660254f, -0.49999997f,
+	12.0f, -0.8660254f, -0.49999997f, 13.0f, -0.8660254f, -0.49999997f, 14.0f, -0.8660254f,
+	-0.49999997f, 15.0f, -0.8660254f, -0.49999997f, 16.0f, -0.8660254f, -0.49999997f, 17.0f,
+	-0.8660254f, -0.49999997f, 18.0f, -0.8660254f, -0.49999997f, 19.0f, -0.8660254f, -0.49999997f,
+	20.0f, -0.8660254f, -0.49999997f, 21.0f, -0.8660254f, -0.49999997f, 22.0f, -0.8660254f,
+	-0.49999997f, 23.0f, -0.8660254f, -0.49999997f, 24.0f, -0.7071068f, -0.7071067f, 0.0f,
+	-0.7071068f, -0.7071067f, 1.0f, -0.7071068f, -0.7071067f, 2.0f, -0.7071068f, -0.7071067f,
+	3.0f, -0.7071068f, -0.7071067f, 4.0f, -0.7071068f, -0.7071067f, 5.0f, -0.7071068f,
+	-0.7071067f, 6.0f, -0.7071068f, -0.7071067f, 7.0f, -0.7071068f, -0.7071067f, 8.0f,
+	-0.7071068f, -0.7071067f, 9.0f, -0.7071068f, -0.7071067f, 10.0f, -0.7071068f, -0.7071067f,
+	11.0f, -0.7071068f, -0.7071067f, 12.0f, -0.7071068f, -0.7071067f, 13.0f, -0.7071068f,
+	-0.7071067f, 14.0f, -0.7071068f, -0.7071067f, 15.0f, -0.7071068f, -0.7071067f, 16.0f,
+	-0.7071068f, -0.7071067f, 17.0f, -0.7071068f, -0.7071067f, 18.0f, -0.7071068f, -0.7071067f,
+	19.0f, -0.7071068f, -0.7071067f, 20.0f, -0.7071068f, -0.7071067f, 21.0f, -0.7071068f,
+	-0.7071067f, 22.0f, -0.7071068f, -0.7071067f, 23.0f, -0.7071068f, -0.7071067f, 24.0f,
+	-0.4999999f, -0.86602545f, 0.0f, -0.4999999f, -0.86602545f, 1.0f, -0.4999999f, -0.86602545f,
+	2.0f, -0.4999999f, -0.86602545f, 3.0f, -0.4999999f, -0.86602545f, 4.0f, -0.4999999f,
+	-0.86602545f, 5.0f, -0.4999999f, -0.86602545f, 6.0f, -0.4999999f, -0.86602545f, 7.0f,
+	-0.4999999f, -0.86602545f, 8.0f, -0.4999999f, -0.86602545f, 9.0f, -0.4999999f, -0.86602545f,
+	10.0f, -0.4999999f, -0.86602545f, 11.0f, -0.4999999f, -0.86602545f, 12.0f, -0.4999999f,
+	-0.86602545f, 13.0f, -0.4999999f, -0.86602545f, 14.0f, -0.4999999f, -0.86602545f, 15.0f,
+	-0.4999999f, -0.86602545f, 16.0f, -0.4999999f, -0.86602545f, 17.0f, -0.4999999f, -0.86602545f,
+	18.0f, -0.4999999f, -0.86602545f, 19.0f, -0.4999999f, -0.86602545f, 20.0f, -0.4999999f,
+	-0.86602545f, 21.0f, -0.4999999f, -0.86602545f, 22.0f, -0.4999999f, -0.86602545f, 23.0f,
+	-0.4999999f, -0.86602545f, 24.0f, -0.25881898f, -0.9659259f, 0.0f, -0.25881898f, -0.9659259f,
+	1.0f, -0.25881898f, -0.9659259f, 2.0f, -0.25881898f, -0.9659259f, 3.0f, -0.25881898f,
+	-0.9659259f, 4.0f, -0.25881898f, -0.9659259f, 5.0f, -0.25881898f, -0.9659259f, 6.0f,
+	-0.25881898f, -0.9659259f, 7.0f, -0.25881898f, -0.9659259f, 8.0f, -0.25881898f, -0.9659259f,
+	9.0f, -0.25881898f, -0.9659259f, 10.0f, -0.25881898f, -0.9659259f, 11.0f, -0.25881898f,
+	-0.9659259f, 12.0f, -0.25881898f, -0.9659259f, 13.0f, -0.25881898f, -0.9659259f, 14.0f,
+	-0.25881898f, -0.9659259f, 15.0f, -0.25881898f, -0.9659259f, 16.0f, -0.25881898f, -0.9659259f,
+	17.0f, -0.25881898f, -0.9659259f, 18.0f, -0.25881898f, -0.9659259f, 19.0f, -0.25881898f,
+	-0.9659259f, 20.0f, -0.25881898f, -0.9659259f, 21.0f, -0.25881898f, -0.9659259f, 22.0f,
+	-0.25881898f, -0.9659259f, 23.0f, -0.25881898f, -0.9659259f, 24.0f, 1.1924881e-08f, -1.0f,
+	0.0f, 1.1924881e-08f, -1.0f, 1.0f, 1.1924881e-08f, -1.0f, 2.0f, 1.1924881e-08f,
+	-1.0f, 3.0f, 1.1924881e-08f, -1.0f, 4.0f, 1.1924881e-08f, -1.0f, 5.0f,
+	1.1924881e-08f, -1.0f, 6.0f, 1.1924881e-08f, -1.0f, 7.0f, 1.1924881e-08f, -1.0f,
+	8.0f, 1.1924881e-08f, -1.0f, 9.0f, 1.1924881e-08f, -1.0f, 10.0f, 1.1924881e-08f,
+	-1.0f, 11.0f, 1.1924881e-08f, -1.0f, 12.0f, 1.1924881e-08f, -1.0f, 13.0f,
+	1.1924881e-08f, -1.0f, 14.0f, 1.1924881e-08f, -1.0f, 15.0f, 1.1924881e-08f, -1.0f,
+	16.0f, 1.1924881e-08f, -1.0f, 17.0f, 1.1924881e-08f, -1.0f, 18.0f, 1.1924881e-08f,
+	-1.0f, 19.0f, 1.1924881e-08f, -1.0f, 20.0f, 1.1924881e-08f, -1.0f, 21.0f,
+	1.1924881e-08f, -1.0f, 22.0f, 1.1924881e-08f, -1.0f, 23.0f, 1.1924881e-08f, -1.0f,
+	24.0f, 0.258819f, -0.9659258f, 0.0f, 0.258819f, -0.9659258f, 1.0f, 0.258819f,
+	-0.9659258f, 2.0f, 0.258819f, -0.9659258f, 3.0f, 0.258819f, -0.9659258f, 4.0f,
+	0.258819f, -0.9659258f, 5.0f, 0.258819f, -0.9659258f, 6.0f, 0.258819f, -0.9659258f,
+	7.0f, 0.258819f, -0.9659258f, 8.0f, 0.258819f, -0.9659258f, 9.0f, 0.258819f,
+	-0.9659258f, 10.0f, 0.258819f, -0.9659258f, 11.0f, 0.258819f, -0.9659258f, 12.0f,
+	0.258819f, -0.9659258f, 13.0f, 0.258819f, -0.9659258f, 14.0f, 0.258819f, -0.9659258f,
+	15.0f, 0.258819f, -0.9659258f, 16.0f, 0.258819f, -0.9659258f, 17.0f, 0.258819f,
+	-0.9659258f, 18.0f, 0.258819f, -0.9659258f, 19.0f, 0.258819f, -0.9659258f, 20.0f,
+	0.258819f, -0.9659258f, 21.0f, 0.258819f, -0.9659258f, 22.0f, 0.258819f, -0.9659258f,
+	23.0f, 0.258819f, -0.9659258f, 24.0f, 0.4999999f, -0.86602545f, 0.0f, 0.4999999f,
+	-0.86602545f, 1.0f, 0.4999999f, -0.86602545f, 2.0f, 0.4999999f, -0.86602545f, 3.0f,
+	0.4999999f, -0.86602545f, 4.0f, 0.4999999f, -0.86602545f, 5.0f, 0.4999999f, -0.86602545f,
+	6.0f, 0.4999999f, -0.86602545f, 7.0f, 0.4999999f, -0.86602545f, 8.0f, 0.4999999f,
+	-0.86602545f, 9.0f, 0.4999999f, -0.86602545f, 10.0f, 0.4999999f, -0.86602545f, 11.0f,
+	0.4999999f, -0.86602545f, 12.0f, 0.4999999f, -0.86602545f, 13.0f, 0.4999999f, -0.86602545f,
+	14.0f, 0.4999999f, -0.86602545f, 15.0f, 0.4999999f, -0.86602545f, 16.0f, 0.4999999f,
+	-0.86602545f, 17.0f, 0.4999999f, -0.86602545f, 18.0f, 0.4999999f, -0.86602545f, 19.0f,
+	0.4999999f, -0.86602545f, 20.0f, 0.4999999f, -0.86602545f, 21.0f, 0.4999999f, -0.86602545f,
+	22.0f, 0.4999999f, -0.86602545f, 23.0f, 0.4999999f, -0.86602545f, 24.0f, 0.70710665f,
+	-0.7071069f, 0.0f, 0.70710665f, -0.7071069f, 1.0f, 0.70710665f, -0.7071069f, 2.0f,
+	0.70710665f, -0.7071069f, 3.0f, 0.70710665f, -0.7071069f, 4.0f, 0.70710665f, -0.7071069f,
+	5.0f, 0.70710665f, -0.7071069f, 6.0f, 0.70710665f, -0.7071069f, 7.0f, 0.70710665f,
+	-0.7071069f, 8.0f, 0.70710665f, -0.7071069f, 9.0f, 0.70710665f, -0.7071069f, 10.0f,
+	0.70710665f, -0.7071069f, 11.0f, 0.70710665f, -0.7071069f, 12.0f, 0.70710665f, -0.7071069f,
+	13.0f, 0.70710665f, -0.7071069f, 14.0f, 0.70710665f, -0.7071069f, 15.0f, 0.70710665f,
+	-0.7071069f, 16.0f, 0.70710665f, -0.7071069f, 17.0f, 0.70710665f, -0.7071069f, 18.0f,
+	0.70710665f, -0.7071069f, 19.0f, 0.70710665f, -0.7071069f, 20.0f, 0.70710665f, -0.7071069f,
+	21.0f, 0.70710665f, -0.7071069f, 22.0f, 0.70710665f, -0.7071069f, 23.0f, 0.70710665f,
+	-0.7071069f, 24.0f, 0.8660253f, -0.5000002f, 0.0f, 0.8660253f, -0.5000002f, 1.0f,
+	0.8660253f, -0.5000002f, 2.0f, 0.8660253f, -0.5000002f, 3.0f, 0.8660253f, -0.5000002f,
+	4.0f, 0.8660253f, -0.5000002f, 5.0f, 0.8660253f, -0.5000002f, 6.0f, 0.8660253f,
+	-0.5000002f, 7.0f, 0.8660253f, -0.5000002f, 8.0f, 0.8660253f, -0.5000002f, 9.0f,
+	0.8660253f, -0.5000002f, 10.0f, 0.8660253f, -0.5000002f, 11.0f, 0.8660253f, -0.5000002f,
+	12.0f, 0.8660253f, -0.5000002f, 13.0f, 0.8660253f, -0.5000002f, 14.0f, 0.8660253f,
+	-0.5000002f, 15.0f, 0.8660253f, -0.5000002f, 16.0f, 0.8660253f, -0.5000002f, 17.0f,
+	0.8660253f, -0.5000002f, 18.0f, 0.8660253f, -0.5000002f, 19.0f, 0.8660253f, -0.5000002f,
+	20.0f, 0.8660253f, -0.5000002f, 21.0f, 0.8660253f, -0.5000002f, 22.0f, 0.8660253f,
+	-0.5000002f, 23.0f, 0.8660253f, -0.5000002f, 24.0f, 0.9659259f, -0.25881884f, 0.0f,
+	0.9659259f, -0.25881884f, 1.0f, 0.9659259f, -0.25881884f, 2.0f, 0.9659259f, -0.25881884f,
+	3.0f, 0.9659259f, -0.25881884f, 4.0f, 0.9659259f, -0.25881884f, 5.0f, 0.9659259f,
+	-0.25881884f, 6.0f, 0.9659259f, -0.25881884f, 7.0f, 0.9659259f, -0.25881884f, 8.0f,
+	0.9659259f, -0.25881884f, 9.0f, 0.9659259f, -0.25881884f, 10.0f, 0.9659259f, -0.25881884f,
+	11.0f, 0.9659259f, -0.25881884f, 12.0f, 0.9659259f, -0.25881884f, 13.0f, 0.9659259f,
+	-0.25881884f, 14.0f, 0.9659259f, -0.25881884f, 15.0f, 0.9659259f, -0.25881884f, 16.0f,
+	0.9659259f, -0.25881884f, 17.0f, 0.9659259f, -0.25881884f, 18.0f, 0.9659259f, -0.25881884f,
+	19.0f, 0.9659259f, -0.25881884f, 20.0f, 0.9659259f, -0.25881884f, 21.0f, 0.9659259f,
+	-0.25881884f, 22.0f, 0.9659259f, -0.25881884f, 23.0f, 0.9659259f, -0.25881884f, 24.0f,
+	1.0f, 1.7484555e-07f, 0.0f, 1.0f, 1.7484555e-07f, 1.0f, 1.0f, 1.7484555e-07f,
+	2.0f, 1.0f, 1.7484555e-07f, 3.0f, 1.0f, 1.7484555e-07f, 4.0f, 1.0f,
+	1.7484555e-07f, 5.0f, 1.0f, 1.7484555e-07f, 6.0f, 1.0f, 1.7484555e-07f, 7.0f,
+	1.0f, 1.7484555e-07f, 8.0f, 1.0f, 1.7484555e-07f, 9.0f, 1.0f, 1.7484555e-07f,
+	10.0f, 1.0f, 1.7484555e-07f, 11.0f, 1.0f, 1.7484555e-07f, 12.0f, 1.0f,
+	1.7484555e-07f, 13.0f, 1.0f, 1.7484555e-07f, 14.0f, 1.0f, 1.7484555e-07f, 15.0f,
+	1.0f, 1.7484555e-07f, 16.0f, 1.0f, 1.7484555e-07f, 17.0f, 1.0f, 1.7484555e-07f,
+	18.0f, 1.0f, 1.7484555e-07f, 19.0f, 1.0f, 1.7484555e-07f, 20.0f, 1.0f,
+	1.7484555e-07f, 21.0f, 1.0f, 1.7484555e-07f, 22.0f, 1.0f, 1.7484555e-07f, 23.0f,
+	1.0f, 1.7484555e-07f, 24.0f
+};
+static const float cylinderNormals[1875] =
+{
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+	2.0f, 1.0f, 0.0f, 3.0f, 1.0f, 0.0f, 4.0f, 1.0f,
+	0.0f, 5.0f, 1.0f, 0.0f, 6.0f, 1.0f, 0.0f, 7.0f,
+	1.0f, 0.0f, 8.0f, 1.0f, 0.0f, 9.0f, 1.0f, 0.0f,
+	10.0f, 1.0f, 0.0f, 11.0f, 1.0f, 0.0f, 12.0f, 1.0f,
+	0.0f, 13.0f, 1.0f, 0.0f, 14.0f, 1.0f, 0.0f, 15.0f,
+	1.0f, 0.0f, 16.0f, 1.0f, 0.0f, 17.0f, 1.0f, 0.0f,
+	18.0f, 1.0f, 0.0f, 19.0f, 1.0f, 0.0f, 20.0f, 1.0f,
+	0.0f, 21.0f, 1.0f, 0.0f, 22.0f, 1.0f, 0.0f, 23.0f,
+	1.0f, 0.0f, 24.0f, 0.9659258f, 0.25881904f, 0.0f, 0.9659258f, 0.25881904f,
+	1.0f, 0.9659258f, 0.25881904f, 2.0f, 0.9659258f, 0.25881904f, 3.0f, 0.9659258f,
+	0.25881904f, 4.0f, 0.9659258f, 0.25881904f, 5.0f, 0.9659258f, 0.25881904f, 6.0f,
+	0.9659258f, 0.25881904f, 7.0f, 0.9659258f, 0.25881904f, 8.0f, 0.9659258f, 0.25881904f,
+	9.0f, 0.9659258f, 0.25881904f, 10.0f, 0.9659258f, 0.25881904f, 11.0f, 0.9659258f,
+	0.25881904f, 12.0f, 0.9659258f, 0.25881904f, 13.0f, 0.9659258f, 0.25881904f, 14.0f,
+	0.9659258f, 0.25881904f, 15.0f, 0.9659258f, 0.25881904f, 16.0f, 0.9659258f, 0.25881904f,
+	17.0f, 0.9659258f, 0.25881904f, 18.0f, 0.9659258f, 0.25881904f, 19.0f, 0.9659258f,
+	0.25881904f, 20.0f, 0.9659258f, 0.25881904f, 21.0f, 0.9659258f, 0.25881904f, 22.0f,
+	0.9659258f, 0.25881904f, 23.0f, 0.9659258f, 0.25881904f, 24.0f, 0.8660254f, 0.5f,
+	0.0f, 0.8660254f, 0.5f, 1.0f, 0.8660254f, 0.5f, 2.0f, 0.8660254f,
+	0.5f, 3.0f, 0.8660254f, 0.5f, 4.0f, 0.8660254f, 0.5f, 5.0f,
+	0.8660254f, 0.5f, 6.0f, 0.8660254f, 0.5f, 7.0f, 0.8660254f, 0.5f,
+	8.0f, 0.8660254f, 0.5f, 9.0f, 0.8660254f, 0.5f, 10.0f, 0.8660254f,
+	0.5f, 11.0f, 0.8660254f, 0.5f, 12.0f, 0.8660254f, 0.5f, 13.0f,
+	0.8660254f, 0.5f, 14.0f, 0.8660254f, 0.5f, 15.0f, 0.8660254f, 0.5f,
+	16.0f, 0.8660254f, 0.5f, 17.0f, 0.8660254f, 0.5f, 18.0f, 0.8660254f,
+	0.5f, 19.0f, 0.8660254f, 0.5f, 20.0f, 0.8660254f, 0.5f, 21.0f,
+	0.8660254f, 0.5f, 22.0f, 0.8660254f, 0.5f, 23.0f, 0.8660254f, 0.5f,
+	24.0f, 0.70710677f, 0.70710677f, 0.0f, 0.70710677f, 0.70710677f, 1.0f, 0.70710677f,
+	0.70710677f, 2.0f, 0.70710677f, 0.70710677f, 3.0f, 0.70710677f, 0.70710677f, 4.0f,
+	0.70710677f, 0.70710677f, 5.0f, 0.70710677f, 0.70710677f, 6.0f, 0.70710677f, 0.70710677f,
+	7.0f, 0.70710677f, 0.70710677f, 8.0f, 0.70710677f, 0.70710677f, 9.0f, 0.70710677f,
+	0.70710677f, 10.0f, 0.70710677f, 0.70710677f, 11.0f, 0.70710677f, 0.70710677f, 12.0f,
+	0.70710677f, 0.70710677f, 13.0f, 0.70710677f, 0.70710677f, 14.0f, 0.70710677f, 0.70710677f,
+	15.0f, 0.70710677f, 0.70710677f, 16.0f, 0.70710677f, 0.70710677f, 17.0f, 0.70710677f,
+	0.70710677f, 18.0f, 0.70710677f, 0.70710677f, 19.0f, 0.70710677f, 0.70710677f, 20.0f,
+	0.70710677f, 0.70710677f, 21.0f, 0.70710677f, 0.70710677f, 22.0f, 0.70710677f, 0.70710677f,
+	23.0f, 0.70710677f, 0.70710677f, 24.0f, 0.49999997f, 0.86602545f, 0.0f, 0.49999997f,
+	0.86602545f, 1.0f, 0.49999997f, 0.86602545f, 2.0f, 0.49999997f, 0.86602545f, 3.0f,
+	0.49999997f, 0.86602545f, 4.0f, 0.49999997f, 0.86602545f, 5.0f, 0.49999997f, 0.86602545f,
+	6.0f, 0.49999997f, 0.86602545f, 7.0f, 0.49999997f, 0.86602545f, 8.0f, 0.49999997f,
+	0.86602545f, 9.0f, 0.49999997f, 0.86602545f, 10.0f, 0.49999997f, 0.86602545f, 11.0f,
+	0.49999997f, 0.86602545f, 12.0f, 0.49999997f, 0.86602545f, 13.0f, 0.49999997f, 0.86602545f,
+	14.0f, 0.49999997f, 0.86602545f, 15.0f, 0.49999997f, 0.86602545f, 16.0f, 0.49999997f,
+	0.86602545f, 17.0f, 0.49999997f, 0.86602545f, 18.0f, 0.49999997f, 0.86602545f, 19.0f,
+	0.49999997f, 0.86602545f, 20.0f, 0.49999997f, 0.86602545f, 21.0f, 0.49999997f, 0.86602545f,
+	22.0f, 0.49999997f, 0.86602545f, 23.0f, 0.49999997f, 0.86602545f, 24.0f, 0.25881907f,
+	0.9659258f, 0.0f, 0.25881907f, 0.9659258f, 1.0f, 0.25881907f, 0.9659258f, 2.0f,
+	0.25881907f, 0.9659258f, 3.0f, 0.25881907f, 0.9659258f, 4.0f, 0.25881907f, 0.9659258f,
+	5.0f, 0.25881907f, 0.9659258f, 6.0f, 0.25881907f, 0.9659258f, 7.0f, 0.25881907f,
+	0.9659258f, 8.0f, 0.25881907f, 0.9659258f, 9.0f, 0.25881907f, 0.9659258f, 10.0f,
+	0.25881907f, 0.9659258f, 11.0f, 0.25881907f, 0.9659258f, 12.0f, 0.25881907f, 0.9659258f,
+	13.0f, 0.25881907f, 0.9659258f, 14.0f, 0.25881907f, 0.9659258f, 15.0f, 0.25881907f,
+	0.9659258f, 16.0f, 0.25881907f, 0.9659258f, 17.0f, 0.25881907f, 0.9659258f, 18.0f,
+	0.25881907f, 0.9659258f, 19.0f, 0.25881907f, 0.9659258f, 20.0f, 0.25881907f, 0.9659258f,
+	21.0f, 0.25881907f, 0.9659258f, 22.0f, 0.25881907f, 0.9659258f, 23.0f, 0.25881907f,
+	0.9659258f, 24.0f, -4.371139e-08f, 1.0f, 0.0f, -4.371139e-08f, 1.0f, 1.0f,
+	-4.371139e-08f, 1.0f, 2.0f, -4.371139e-08f, 1.0f, 3.0f, -4.371139e-08f, 1.0f,
+	4.0f, -4.371139e-08f, 1.0f, 5.0f, -4.371139e-08f, 1.0f, 6.0f, -4.371139e-08f,
+	1.0f, 7.0f, -4.371139e-08f, 1.0f, 8.0f, -4.371139e-08f, 1.0f, 9.0f,
+	-4.371139e-08f, 1.0f, 10.0f, -4.371139e-08f, 1.0f, 11.0f, -4.371139e-08f, 1.0f,
+	12.0f, -4.371139e-08f, 1.0f, 13.0f, -4.371139e-08f, 1.0f, 14.0f, -4.371139e-08f,
+	1.0f, 15.0f, -4.371139e-08f, 1.0f, 16.0f, -4.371139e-08f, 1.0f, 17.0f,
+	-4.371139e-08f, 1.0f, 18.0f, -4.371139e-08f, 1.0f, 19.0f, -4.371139e-08f, 1.0f,
+	20.0f, -4.371139e-08f, 1.0f, 21.0f, -4.371139e-08f, 1.0f, 22.0f, -4.371139e-08f,
+	1.0f, 23.0f, -4.371139e-08f, 1.0f, 24.0f, -0.25881904f, 0.9659258f, 0.0f,
+	-0.25881904f, 0.9659258f, 1.0f, -0.25881904f, 0.9659258f, 2.0f, -0.25881904f, 0.9659258f,
+	3.0f, -0.25881904f, 0.9659258f, 4.0f, -0.25881904f, 0.9659258f, 5.0f, -0.25881904f,
+	0.9659258f, 6.0f, -0.25881904f, 0.9659258f, 7.0f, -0.25881904f, 0.9659258f, 8.0f,
+	-0.25881904f, 0.9659258f, 9.0f, -0.25881904f, 0.9659258f, 10.0f, -0.25881904f, 0.9659258f,
+	11.0f, -0.25881904f, 0.9659258f, 12.0f, -0.25881904f, 0.9659258f, 13.0f, -0.25881904f,
+	0.9659258f, 14.0f, -0.25881904f, 0.9659258f, 15.0f, -0.25881904f, 0.9659258f, 16.0f,
+	-0.25881904f, 0.9659258f, 17.0f, -0.25881904f, 0.9659258f, 18.0f, -0.25881904f, 0.9659258f,
+	19.0f, -0.25881904f, 0.9659258f, 20.0f, -0.25881904f, 0.9659258f, 21.0f, -0.25881904f,
+	0.9659258f, 22.0f, -0.25881904f, 0.9659258f, 23.0f, -0.25881904f, 0.9659258f, 24.0f,
+	-0.50000006f, 0.8660254f, 0.0f, -0.50000006f, 0.8660254f, 1.0f, -0.50000006f, 0.8660254f,
+	2.0f, -0.50000006f, 0.8660254f, 3.0f, -0.50000006f, 0.8660254f, 4.0f, -0.50000006f,
+	0.8660254f, 5.0f, -0.50000006f, 0.8660254f, 6.0f, -0.50000006f, 0.8660254f, 7.0f,
+	-0.50000006f, 0.8660254f, 8.0f, -0.50000006f, 0.8660254f, 9.0f, -0.50000006f, 0.8660254f,
+	10.0f, -0.50000006f, 0.8660254f, 11.0f, -0.50000006f, 0.8660254f, 12.0f, -0.50000006f,
+	0.8660254f, 13.0f, -0.50000006f, 0.8660254f, 14.0f, -0.50000006f, 0.8660254f, 15.0f,
+	-0.50000006f, 0.8660254f, 16.0f, -0.50000006f, 0.8660254f, 17.0f, -0.50000006f, 0.8660254f,
+	18.0f, -0.50000006f, 0.8660254f, 19.0f, -0.50000006f, 0.8660254f, 20.0f, -0.50000006f,
+	0.8660254f, 21.0f, -0.50000006f, 0.8660254f, 22.0f, -0.50000006f, 0.8660254f, 23.0f,
+	-0.50000006f, 0.8660254f, 24.0f, -0.70710677f, 0.70710677f, 0.0f, -0.70710677f, 0.70710677f,
+	1.0f, -0.70710677f, 0.70710677f, 2.0f, -0.70710677f, 0.70710677f, 3.0f, -0.70710677f,
+	0.70710677f, 4.0f, -0.70710677f, 0.70710677f, 5.0f, -0.70710677f, 0.70710677f, 6.0f,
+	-0.70710677f, 0.70710677f, 7.0f, -0.70710677f, 0.70710677f, 8.0f, -0.70710677f, 0.70710677f,
+	9.0f, -0.70710677f, 0.70710677f, 10.0f, -0.70710677f, 0.70710677f, 11.0f, -0.70710677f,
+	0.70710677f, 12.0f, -0.70710677f, 0.70710677f, 13.0f, -0.70710677f, 0.70710677f, 14.0f,
+	-0.70710677f, 0.70710677f, 15.0f, -0.70710677f, 0.70710677f, 16.0f, -0.70710677f, 0.70710677f,
+	17.0f, -0.70710677f, 0.70710677f, 18.0f, -0.70710677f, 0.70710677f, 19.0f, -0.70710677f,
+	0.70710677f, 20.0f, -0.70710677f, 0.70710677f, 21.0f, -0.70710677f, 0.70710677f, 22.0f,
+	-0.70710677f, 0.70710677f, 23.0f, -0.70710677f, 0.70710677f, 24.0f, -0.8660254f, 0.50000006f,
+	0.0f, -0.8660254f, 0.50000006f, 1.0f, -0.8660254f, 0.50000006f, 2.0f, -0.8660254f,
+	0.50000006f, 3.0f, -0.8660254f, 0.50000006f, 4.0f, -0.8660254f, 0.50000006f, 5.0f,
+	-0.8660254f, 0.50000006f, 6.0f, -0.8660254f, 0.50000006f, 7.0f, -0.8660254f, 0.50000006f,
+	8.0f, -0.8660254f, 0.50000006f, 9.0f, -0.8660254f, 0.50000006f, 10.0f, -0.8660254f,
+	0.50000006f, 11.0f, -0.8660254f, 0.50000006f, 12.0f, -0.8660254f, 0.50000006f, 13.0f,
+	-0.8660254f, 0.50000006f, 14.0f, -0.8660254f, 0.50000006f, 15.0f, -0.8660254f, 0.50000006f,
+	16.0f, -0.8660254f, 0.50000006f, 17.0f, -0.8660254f, 0.50000006f, 18.0f, -0.8660254f,
+	0.50000006f, 19.0f, -0.8660254f, 0.50000006f, 20.0f, -0.8660254f, 0.50000006f, 21.0f,
+	-0.8660254f, 0.50000006f, 22.0f, -0.8660254f, 0.50000006f, 23.0f, -0.8660254f, 0.50000006f,
+	24.0f, -0.9659258f, 0.25881913f, 0.0f, -0.9659258f, 0.25881913f, 1.0f, -0.9659258f,
+	0.25881913f, 2.0f, -0.9659258f, 0.25881913f, 3.0f, -0.9659258f, 0.25881913f, 4.0f,
+	-0.9659258f, 0.25881913f, 5.0f, -0.9659258f, 0.25881913f, 6.0f, -0.9659258f, 0.25881913f,
+	7.0f, -0.9659258f, 0.25881913f, 8.0f, -0.9659258f, 0.25881913f, 9.0f, -0.9659258f,
+	0.25881913f, 10.0f, -0.9659258f, 0.25881913f, 11.0f, -0.9659258f, 0.25881913f, 12.0f,
+	-0.9659258f, 0.25881913f, 13.0f, -0.9659258f, 0.25881913f, 14.0f, -0.9659258f, 0.25881913f,
+	15.0f, -0.9659258f, 0.25881913f, 16.0f, -0.9659258f, 0.25881913f, 17.0f, -0.9659258f,
+	0.25881913f, 18.0f, -0.9659258f, 0.25881913f, 19.0f, -0.9659258f, 0.25881913f, 20.0f,
+	-0.9659258f, 0.25881913f, 21.0f, -0.9659258f, 0.25881913f, 22.0f, -0.9659258f, 0.25881913f,
+	23.0f, -0.9659258f, 0.25881913f, 24.0f, -1.0f, -8.742278e-08f, 0.0f, -1.0f,
+	-8.742278e-08f, 1.0f, -1.0f, -8.742278e-08f, 2.0f, -1.0f, -8.742278e-08f, 3.0f,
+	-1.0f, -8.742278e-08f, 4.0f, -1.0f, -8.742278e-08f, 5.0f, -1.0f, -8.742278e-08f,
+	6.0f, -1.0f, -8.742278e-08f, 7.0f, -1.0f, -8.742278e-08f, 8.0f, -1.0f,
+	-8.742278e-08f, 9.0f, -1.0f, -8.742278e-08f, 10.0f, -1.0f, -8.742278e-08f, 11.0f,
+	-1.0f, -8.742278e-08f, 12.0f, -1.0f, -8.742278e-08f, 13.0f, -1.0f, -8.742278e-08f,
+	14.0f, -1.0f, -8.742278e-08f, 15.0f, -1.0f, -8.742278e-08f, 16.0f, -1.0f,
+	-8.742278e-08f, 17.0f, -1.0f, -8.742278e-08f, 18.0f, -1.0f, -8.742278e-08f, 19.0f,
+	-1.0f, -8.742278e-08f, 20.0f, -1.0f, -8.742278e-08f, 21.0f, -1.0f, -8.742278e-08f,
+	22.0f, -1.0f, -8.742278e-08f, 23.0f, -1.0f, -8.742278e-08f, 24.0f, -0.9659258f,
+	-0.25881907f, 0.0f, -0.9659258f, -0.25881907f, 1.0f, -0.9659258f, -0.25881907f, 2.0f,
+	-0.9659258f, -0.25881907f, 3.0f, -0.9659258f, -0.25881907f, 4.0f, -0.9659258f, -0.25881907f,
+	5.0f, -0.9659258f, -0.25881907f, 6.0f, -0.9659258f, -0.25881907f, 7.0f, -0.9659258f,
+	-0.25881907f, 8.0f, -0.9659258f, -0.25881907f, 9.0f, -0.9659258f, -0.25881907f, 10.0f,
+	-0.9659258f, -0.25881907f, 11.0f, -0.9659258f, -0.25881907f, 12.0f, -0.9659258f, -0.25881907f,
+	13.0f, -0.9659258f, -0.25881907f, 14.0f, -0.9659258f, -0.25881907f, 15.0f, -0.9659258f,
+	-0.25881907f, 16.0f, -0.9659258f, -0.25881907f, 17.0f, -0.9659258f, -0.25881907f, 18.0f,
+	-0.9659258f, -0.25881907f, 19.0f, -0.9659258f, -0.25881907f, 20.0f, -0.9659258f, -0.25881907f,
+	21.0f, -0.9659258f, -0.25881907f, 22.0f, -0.9659258f, -0.25881907f, 23.0f, -0.9659258f,
+	-0.25881907f, 24.0f, -0.8660254f, -0.49999997f, 0.0f, -0.8660254f, -0.49999997f, 1.0f,
+	-0.8660254f, -0.49999997f, 2.0f, -0.8660254f, -0.49999997f, 3.0f, -0.8660254f, -0.49999997f,
+	4.0f, -0.8660254f, -0.49999997f, 5.0f, -0.8660254f, -0.49999997f, 6.0f, -0.8660254f,
+	-0.49999997f, 7.0f, -0.8660254f, -0.49999997f, 8.0f, -0.8660254f, -0.49999997f, 9.0f,
+	-0.8660254f, -0.49999997f, 10.0f, -0.8660254f, -0.49999997f, 11.0f, -0.8660254f, -0.49999997f,
+	12.0f, -0.8660254f, -0.49999997f, 13.0f, -0.8660254f, -0.49999997f, 14.0f, -0.8660254f,
+	-0.49999997f, 15.0f, -0.8660254f, -0.49999997f, 16.0f, -0.8660254f, -0.49999997f, 17.0f,
+	-0.8660254f, -0.49999997f, 18.0f, -0.8660254f, -0.49999997f, 19.0f, -0.8660254f, -0.49999997f,
+	20.0f, -0.8660254f, -0.49999997f, 21.0f, -0.8660254f, -0.49999997f, 22.0f, -0.8660254f,
+	-0.49999997f, 23.0f, -0.8660254f, -0.49999997f, 24.0f, -0.7071068f, -0.7071067f, 0.0f,
+	-0.7071068f, -0.7071067f, 1.0f, -0.7071068f, -0.7071067f, 2.0f, -0.7071068f, -0.7071067f,
+	3.0f, -0.7071068f, -0.7071067f, 4.0f, -0.7071068f, -0.7071067f, 5.0f, -0.7071068f,
+	-0.7071067f, 6.0f, -0.7071068f, -0.7071067f, 7.0f, -0.7071068f, -0.7071067f, 8.0f,
+	-0.7071068f, -0.7071067f, 9.0f, -0.7071068f, -0.7071067f, 10.0f, -0.7071068f, -0.7071067f,
+	11.0f, -0.7071068f, -0.7071067f, 12.0f, -0.7071068f, -0.7071067f, 13.0f, -0.7071068f,
+	-0.7071067f, 14.0f, -0.7071068f, -0.7071067f, 15.0f, -0.7071068f, -0.7071067f, 16.0f,
+	-0.7071068f, -0.7071067f, 17.0f, -0.7071068f, -0.7071067f, 18.0f, -0.7071068f, -0.7071067f,
+	19.0f, -0.7071068f, -0.7071067f, 20.0f, -0.7071068f, -0.7071067f, 21.0f, -0.7071068f,
+	-0.7071067f, 22.0f, -0.7071068f, -0.7071067f, 23.0f, -0.7071068f, -0.7071067f, 24.0f,
+	-0.4999999f, -0.86602545f, 0.0f, -0.4999999f, -0.86602545f, 1.0f, -0.4999999f, -0.86602545f,
+	2.0f, -0.4999999f, -0.86602545f, 3.0f, -0.4999999f, -0.86602545f, 4.0f, -0.4999999f,
+	-0.86602545f, 5.0f, -0.4999999f, -0.86602545f, 6.0f, -0.4999999f, -0.86602545f, 7.0f,
+	-0.4999999f, -0.86602545f, 8.0f, -0.4999999f, -0.86602545f, 9.0f, -0.4999999f, -0.86602545f,
+	10.0f, -0.4999999f, -0.86602545f, 11.0f, -0.4999999f, -0.86602545f, 12.0f, -0.4999999f,
+	-0.86602545f, 13.0f, -0.4999999f, -0.86602545f, 14.0f, -0.4999999f, -0.86602545f, 15.0f,
+	-0.4999999f, -0.86602545f, 16.0f, -0.4999999f, -0.86602545f, 17.0f, -0.4999999f, -0.86602545f,
+	18.0f, -0.4999999f, -0.86602545f, 19.0f, -0.4999999f, -0.86602545f, 20.0f, -0.4999999f,
+	-0.86602545f, 21.0f, -0.4999999f, -0.86602545f, 22.0f, -0.4999999f, -0.86602545f, 23.0f,
+	-0.4999999f, -0.86602545f, 24.0f, -0.25881898f, -0.9659259f, 0.0f, -0.25881898f, -0.9659259f,
+	1.0f, -0.25881898f, -0.9659259f, 2.0f, -0.25881898f, -0.9659259f, 3.0f, -0.25881898f,
+	-0.9659259f, 4.0f, -0.25881898f, -0.9659259f, 5.0f, -0.25881898f, -0.9659259f, 6.0f,
+	-0.25881898f, -0.9659259f, 7.0f, -0.25881898f, -0.9659259f, 8.0f, -0.25881898f, -0.9659259f,
+	9.0f, -0.25881898f, -0.9659259f, 10.0f, -0.25881898f, -0.9659259f, 11.0f, -0.25881898f,
+	-0.9659259f, 12.0f, -0.25881898f, -0.9659259f, 13.0f, -0.25881898f, -0.9659259f, 14.0f,
+	-0.25881898f, -0.9659259f, 15.0f, -0.25881898f, -0.9659259f, 16.0f, -0.25881898f, -0.9659259f,
+	17.0f, -0.25881898f, -0.9659259f, 18.0f, -0.25881898f, -0.9659259f, 19.0f, -0.25881898f,
+	-0.9659259f, 20.0f, -0.25881898f, -0.9659259f, 21.0f, -0.25881898f, -0.9659259f, 22.0f,
+	-0.25881898f, -0.9659259f, 23.0f, -0.25881898f, -0.9659259f, 24.0f, 1.1924881e-08f, -1.0f,
+	0.0f, 1.1924881e-08f, -1.0f, 1.0f, 1.1924881e-08f, -1.0f, 2.0f, 1.1924881e-08f,
+	-1.0f, 3.0f, 1.1924881e-08f, -1.0f, 4.0f, 1.1924881e-08f, -1.0f, 5.0f,
+	1.1924881e-08f, -1.0f, 6.0f, 1.1924881e-08f, -1.0f, 7.0f, 1.1924881e-08f, -1.0f,
+	8.0f, 1.1924881e-08f, -1.0f, 9.0f, 1.1924881e-08f, -1.0f, 10.0f, 1.1924881e-08f,
+	-1.0f, 11.0f, 1.1924881e-08f, -1.0f, 12.0f, 1.1924881e-08f, -1.0f, 13.0f,
+	1.1924881e-08f, -1.0f, 14.0f, 1.1924881e-08f, -1.0f, 15.0f, 1.1924881e-08f, -1.0f,
+	16.0f, 1.1924881e-08f, -1.0f, 17.0f, 1.1924881e-08f, -1.0f, 18.0f, 1.1924881e-08f,
+	-1.0f, 19.0f, 1.1924881e-08f, -1.0f, 20.0f, 1.1924881e-08f, -1.0f, 21.0f,
+	1.1924881e-08f, -1.0f, 22.0f, 1.1924881e-08f, -1.0f, 23.0f, 1.1924881e-08f, -1.0f,
+	24.0f, 0.258819f, -0.9659258f, 0.0f, 0.258819f, -0.9659258f, 1.0f, 0.258819f,
+	-0.9659258f, 2.0f, 0.258819f, -0.9659258f, 3.0f, 0.258819f, -0.9659258f, 4.0f,
+	0.258819f, -0.9659258f, 5.0f, 0.258819f, -0.9659258f, 6.0f, 0.258819f, -0.9659258f,
+	7.0f, 0.258819f, -0.9659258f, 8.0f, 0.258819f, -0.9659258f, 9.0f, 0.258819f,
+	-0.9659258f, 10.0f, 0.258819f, -0.9659258f, 11.0f, 0.258819f, -0.9659258f, 12.0f,
+	0.258819f, -0.9659258f, 13.0f, 0.258819f, -0.9659258f, 14.0f, 0.258819f, -0.9659258f,
+	15.0f, 0.258819f, -0.9659258f, 16.0f, 0.258819f, -0.9659258f, 17.0f, 0.258819f,
+	-0.9659258f, 18.0f, 0.258819f, -0.9659258f, 19.0f, 0.258819f, -0.9659258f, 20.0f,
+	0.258819f, -0.9659258f, 21.0f, 0.258819f, -0.9659258f, 22.0f, 0.258819f, -0.9659258f,
+	23.0f, 0.258819f, -0.9659258f, 24.0f, 0.4999999f, -0.86602545f, 0.0f, 0.4999999f,
+	-0.86602545f, 1.0f, 0.4999999f, -0.86602545f, 2.0f, 0.4999999f, -0.86602545f, 3.0f,
+	0.4999999f, -0.86602545f, 4.0f, 0.4999999f, -0.86602545f, 5.0f, 0.4999999f, -0.86602545f,
+	6.0f, 0.4999999f, -0.86602545f, 7.0f, 0.4999999f, -0.86602545f, 8.0f, 0.4999999f,
+	-0.86602545f, 9.0f, 0.4999999f, -0.86602545f, 10.0f, 0.4999999f, -0.86602545f, 11.0f,
+	0.4999999f, -0.86602545f, 12.0f, 0.4999999f, -0.86602545f, 13.0f, 0.4999999f, -0.86602545f,
+	14.0f, 0.4999999f, -0.86602545f, 15.0f, 0.4999999f, -0.86602545f, 16.0f, 0.4999999f,
+	-0.86602545f, 17.0f, 0.4999999f, -0.86602545f, 18.0f, 0.4999999f, -0.86602545f, 19.0f,
+	0.4999999f, -0.86602545f, 20.0f, 0.4999999f, -0.86602545f, 21.0f, 0.4999999f, -0.86602545f,
+	22.0f, 0.4999999f, -0.86602545f, 23.0f, 0.4999999f, -0.86602545f, 24.0f, 0.70710665f,
+	-0.7071069f, 0.0f, 0.70710665f, -0.7071069f, 1.0f, 0.70710665f, -0.7071069f, 2.0f,
+	0.70710665f, -0.7071069f, 3.0f, 0.70710665f, -0.7071069f, 4.0f, 0.70710665f, -0.7071069f,
+	5.0f, 0.70710665f, -0.7071069f, 6.0f, 0.70710665f, -0.7071069f, 7.0f, 0.70710665f,
+	-0.7071069f, 8.0f, 0.70710665f, -0.7071069f, 9.0f, 0.70710665f, -0.7071069f, 10.0f,
+	0.70710665f, -0.7071069f, 11.0f, 0.70710665f, -0.7071069f, 12.0f, 0.70710665f, -0.7071069f,
+	13.0f, 0.70710665f, -0.7071069f, 14.0f, 0.70710665f, -0.7071069f, 15.0f, 0.70710665f,
+	-0.7071069f, 16.0f, 0.70710665f, -0.7071069f, 17.0f, 0.70710665f, -0.7071069f, 18.0f,
+	0.70710665f, -0.7071069f, 19.0f, 0.70710665f, -0.7071069f, 20.0f, 0.70710665f, -0.7071069f,
+	21.0f, 0.70710665f, -0.7071069f, 22.0f, 0.70710665f, -0.7071069f, 23.0f, 0.70710665f,
+	-0.7071069f, 24.0f, 0.8660253f, -0.5000002f, 0.0f, 0.8660253f, -0.5000002f, 1.0f,
+	0.8660253f, -0.5000002f, 2.0f, 0.8660253f, -0.5000002f, 3.0f, 0.8660253f, -0.5000002f,
+	4.0f, 0.8660253f, -0.5000002f, 5.0f, 0.8660253f, -0.5000002f, 6.0f, 0.8660253f,
+	-0.5000002f, 7.0f, 0.8660253f, -0.5000002f, 8.0f, 0.8660253f, -0.5000002f, 9.0f,
+	0.8660253f, -0.5000002f, 10.0f, 0.8660253f, -0.5000002f, 11.0f, 0.8660253f, -0.5000002f,
+	12.0f, 0.8660253f, -0.5000002f, 13.0f, 0.8660253f, -0.5000002f, 14.0f, 0.8660253f,
+	-0.5000002f, 15.0f, 0.8660253f, -0.5000002f, 16.0f, 0.8660253f, -0.5000002f, 17.0f,
+	0.8660253f, -0.5000002f, 18.0f, 0.8660253f, -0.5000002f, 19.0f, 0.8660253f, -0.5000002f,
+	20.0f, 0.8660253f, -0.5000002f, 21.0f, 0.8660253f, -0.5000002f, 22.0f, 0.8660253f,
+	-0.5000002f, 23.0f, 0.8660253f, -0.5000002f, 24.0f, 0.9659259f, -0.25881884f, 0.0f,
+	0.9659259f, -0.25881884f, 1.0f, 0.9659259f, -0.25881884f, 2.0f, 0.9659259f, -0.25881884f,
+	3.0f, 0.9659259f, -0.25881884f, 4.0f, 0.9659259f, -0.25881884f, 5.0f, 0.9659259f,
+	-0.25881884f, 6.0f, 0.9659259f, -0.25881884f, 7.0f, 0.9659259f, -0.25881884f, 8.0f,
+	0.9659259f, -0.25881884f, 9.0f, 0.9659259f, -0.25881884f, 10.0f, 0.9659259f, -0.25881884f,
+	11.0f, 0.9659259f, -0.25881884f, 12.0f, 0.9659259f, -0.25881884f, 13.0f, 0.9659259f,
+	-0.25881884f, 14.0f, 0.9659259f, -0.25881884f, 15.0f, 0.9659259f, -0.25881884f, 16.0f,
+	0.9659259f, -0.25881884f, 17.0f, 0.9659259f, -0.25881884f, 18.0f, 0.9659259f, -0.25881884f,
+	19.0f, 0.9659259f, -0.25881884f, 20.0f, 0.9659259f, -0.25881884f, 21.0f, 0.9659259f,
+	-0.25881884f, 22.0f, 0.9659259f, -0.25881884f, 23.0f, 0.9659259f, -0.25881884f, 24.0f,
+	1.0f, 1.7484555e-07f, 0.0f, 1.0f, 1.7484555e-07f, 1.0f, 1.0f, 1.7484555e-07f,
+	2.0f, 1.0f, 1.7484555e-07f, 3.0f, 1.0f, 1.7484555e-07f, 4.0f, 1.0f,
+	1.7484555e-07f, 5.0f, 1.0f, 1.7484555e-07f, 6.0f, 1.0f, 1.7484555e-07f, 7.0f,
+	1.0f, 1.7484555e-07f, 8.0f, 1.0f, 1.7484555e-07f, 9.0f, 1.0f, 1.7484555e-07f,
+	10.0f, 1.0f, 1.7484555e-07f, 11.0f, 1.0f, 1.7484555e-07f, 12.0f, 1.0f,
+	1.7484555e-07f, 13.0f, 1.0f, 1.7484555e-07f, 14.0f, 1.0f, 1.7484555e-07f, 15.0f,
+	1.0f, 1.7484555e-07f, 16.0f, 1.0f, 1.7484555e-07f, 17.0f, 1.0f, 1.7484555e-07f,
+	18.0f, 1.0f, 1.7484555e-07f, 19.0f, 1.0f, 1.7484555e-07f, 20.0f, 1.0f,
+	1.7484555e-07f, 21.0f, 1.0f, 1.7484555e-07f, 22.0f, 1.0f, 1.7484555e-07f, 23.0f,
+	1.0f, 1.7484555e-07f, 24.0f
+};
+static const float cylinderTexCoords[1250] =
+{
+	1.0f, 0.0f, 1.0f, 0.041666668f, 1.0f, 0.083333336f, 1.0f, 0.125f,
+	1.0f, 0.16666667f, 1.0f, 0.20833333f, 1.0f, 0.25f, 1.0f, 0.29166666f,
+	1.0f, 0.33333334f, 1.0f, 0.375f, 1.0f, 0.41666666f, 1.0f, 0.45833334f,
+	1.0f, 0.5f, 1.0f, 0.5416667f, 1.0f, 0.5833333f, 1.0f, 0.625f,
+	1.0f, 0.6666667f, 1.0f, 0.7083333f, 1.0f, 0.75f, 1.0f, 0.7916667f,
+	1.0f, 0.8333333f, 1.0f, 0.875f, 1.0f, 0.9166667f, 1.0f, 0.9583333f,
+	1.0f, 1.0f, 0.9583333f, 0.0f, 0.9583333f, 0.041666668f, 0.9583333f, 0.083333336f,
+	0.9583333f, 0.125f, 0.9583333f, 0.16666667f, 0.9583333f, 0.20833333f, 0.9583333f, 0.25f,
+	0.9583333f, 0.29166666f, 0.9583333f, 0.33333334f, 0.9583333f, 0.375f, 0.9583333f, 0.41666666f,
+	0.9583333f, 0.45833334f, 0.9583333f, 0.5f, 0.9583333f, 0.5416667f, 0.9583333f, 0.5833333f,
+	0.9583333f, 0.625f, 0.9583333f, 0.6666667f, 0.9583333f, 0.7083333f, 0.9583333f, 0.75f,
+	0.9583333f, 0.7916667f, 0.9583333f, 0.8333333f, 0.9583333f, 0.875f, 0.9583333f, 0.9166667f,
+	0.9583333f, 0.9583333f, 0.9583333f, 1.0f, 0.9166667f, 0.0f, 0.9166667f, 0.041666668f,
+	0.9166667f, 0.083333336f, 0.9166667f, 0.125f, 0.9166667f, 0.16666667f, 0.9166667f, 0.20833333f,
+	0.9166667f, 0.25f, 0.9166667f, 0.29166666f, 0.9166667f, 0.33333334f, 0.9166667f, 0.375f,
+	0.9166667f, 0.41666666f, 0.9166667f, 0.45833334f, 0.9166667f, 0.5f, 0.9166667f, 0.5416667f,
+	0.9166667f, 0.5833333f, 0.9166667f, 0.625f, 0.9166667f, 0.6666667f, 0.9166667f, 0.7083333f,
+	0.9166667f, 0.75f, 0.9166667f, 0.7916667f, 0.9166667f, 0.8333333f, 0.9166667f, 0.875f,
+	0.9166667f, 0.9166667f, 0.9166667f, 0.9583333f, 0.9166667f, 1.0f, 0.875f, 0.0f,
+	0.875f, 0.041666668f, 0.875f, 0.083333336f, 0.875f, 0.125f, 0.875f, 0.16666667f,
+	0.875f, 0.20833333f, 0.875f, 0.25f, 0.875f, 0.29166666f, 0.875f, 0.33333334f,
+	0.875f, 0.375f, 0.875f, 0.41666666f, 0.875f, 0.45833334f, 0.875f, 0.5f,
+	0.875f, 0.5416667f, 0.875f, 0.5833333f, 0.875f, 0.625f, 0.875f, 0.6666667f,
+	0.875f, 0.7083333f, 0.875f, 0.75f, 0.875f, 0.7916667f, 0.875f, 0.8333333f,
+	0.875f, 0.875f, 0.875f, 0.9166667f, 0.875f, 0.9583333f, 0.875f, 1.0f,
+	0.8333333f, 0.0f, 0.8333333f, 0.041666668f, 0.8333333f, 0.083333336f, 0.8333333f, 0.125f,
+	0.8333333f, 0.16666667f, 0.8333333f, 0.20833333f, 0.8333333f, 0.25f, 0.8333333f, 0.29166666f,
+	0.8333333f, 0.33333334f, 0.8333333f, 0.375f, 0.8333333f, 0.41666666f, 0.8333333f, 0.45833334f,
+	0.8333333f, 0.5f, 0.8333333f, 0.5416667f, 0.8333333f, 0.5833333f, 0.8333333f, 0.625f,
+	0.8333333f, 0.6666667f, 0.8333333f, 0.7083333f, 0.8333333f, 0.75f, 0.8333333f, 0.7916667f,
+	0.8333333f, 0.8333333f, 0.8333333f, 0.875f, 0.8333333f, 0.9166667f, 0.8333333f, 0.9583333f,
+	0.8333333f, 1.0f, 0.7916666f, 0.0f, 0.7916666f, 0.041666668f, 0.7916666f, 0.083333336f,
+	0.7916666f, 0.125f, 0.7916666f, 0.16666667f, 0.7916666f, 0.20833333f, 0.7916666f, 0.25f,
+	0.7916666f, 0.29166666f, 0.7916666f, 0.33333334f, 0.7916666f, 0.375f, 0.7916666f, 0.41666666f,
+	0.7916666f, 0.45833334f, 0.7916666f, 0.5f, 0.7916666f, 0.5416667f, 0.7916666f, 0.5833333f,
+	0.7916666f, 0.625f, 0.7916666f, 0.6666667f, 0.7916666f, 0.7083333f, 0.7916666f, 0.75f,
+	0.7916666f, 0.7916667f, 0.7916666f, 0.8333333f, 0.7916666f, 0.875f, 0.7916666f, 0.9166667f,
+	0.7916666f, 0.9583333f, 0.7916666f, 1.0f, 0.75f, 0.0f, 0.75f, 0.041666668f,
+	0.75f, 0.083333336f, 0.75f, 0.125f, 0.75f, 0.16666667f, 0.75f, 0.20833333f,
+	0.75f, 0.25f, 0.75f, 0.29166666f, 0.75f, 0.33333334f, 0.75f, 0.375f,
+	0.75f, 0.41666666f, 0.75f, 0.45833334f, 0.75f, 0.5f, 0.75f, 0.5416667f,
+	0.75f, 0.5833333f, 0.75f, 0.625f, 0.75f, 0.6666667f, 0.75f, 0.7083333f,
+	0.75f, 0.75f, 0.75f, 0.7916667f, 0.75f, 0.8333333f, 0.75f, 0.875f,
+	0.75f, 0.9166667f, 0.75f, 0.9583333f, 0.75f, 1.0f, 0.7083333f, 0.0f,
+	0.7083333f, 0.041666668f, 0.7083333f, 0.083333336f, 0.7083333f, 0.125f, 0.7083333f, 0.16666667f,
+	0.7083333f, 0.20833333f, 0.7083333f, 0.25f, 0.7083333f, 0.29166666f, 0.7083333f, 0.33333334f,
+	0.7083333f, 0.375f, 0.7083333f, 0.41666666f, 0.7083333f, 0.45833334f, 0.7083333f, 0.5f,
+	0.7083333f, 0.5416667f, 0.7083333f, 0.5833333f, 0.7083333f, 0.625f, 0.7083333f, 0.6666667f,
+	0.7083333f, 0.7083333f, 0.7083333f, 0.75f, 0.7083333f, 0.7916667f, 0.7083333f, 0.8333333f,
+	0.7083333f, 0.875f, 0.7083333f, 0.9166667f, 0.7083333f, 0.9583333f, 0.7083333f, 1.0f,
+	0.6666666f, 0.0f, 0.6666666f, 0.041666668f, 0.6666666f, 0.083333336f, 0.6666666f, 0.125f,
+	0.6666666f, 0.16666667f, 0.6666666f, 0.20833333f, 0.6666666f, 0.25f, 0.6666666f, 0.29166666f,
+	0.6666666f, 0.33333334f, 0.6666666f, 0.375f, 0.6666666f, 0.41666666f, 0.6666666f, 0.45833334f,
+	0.6666666f, 0.5f, 0.6666666f, 0.5416667f, 0.6666666f, 0.5833333f, 0.6666666f, 0.625f,
+	0.6666666f, 0.6666667f, 0.6666666f, 0.7083333f, 0.6666666f, 0.75f, 0.6666666f, 0.7916667f,
+	0.6666666f, 0.8333333f, 0.6666666f, 0.875f, 0.6666666f, 0.9166667f, 0.6666666f, 0.9583333f,
+	0.6666666f, 1.0f, 0.625f, 0.0f, 0.625f, 0.041666668f, 0.625f, 0.083333336f,
+	0.625f, 0.125f, 0.625f, 0.16666667f, 0.625f, 0.20833333f, 0.625f, 0.25f,
+	0.625f, 0.29166666f, 0.625f, 0.33333334f, 0.625f, 0.375f, 0.625f, 0.41666666f,
+	0.625f, 0.45833334f, 0.625f, 0.5f, 0.625f, 0.5416667f, 0.625f, 0.5833333f,
+	0.625f, 0.625f, 0.625f, 0.6666667f, 0.625f, 0.7083333f, 0.625f, 0.75f,
+	0.625f, 0.7916667f, 0.625f, 0.8333333f, 0.625f, 0.875f, 0.625f, 0.9166667f,
+	0.625f, 0.9583333f, 0.625f, 1.0f, 0.5833333f, 0.0f, 0.5833333f, 0.041666668f,
+	0.5833333f, 0.083333336f, 0.5833333f, 0.125f, 0.5833333f, 0.16666667f, 0.5833333f, 0.20833333f,
+	0.5833333f, 0.25f, 0.5833333f, 0.29166666f, 0.5833333f, 0.33333334f, 0.5833333f, 0.375f,
+	0.5833333f, 0.41666666f, 0.5833333f, 0.45833334f, 0.5833333f, 0.5f, 0.5833333f, 0.5416667f,
+	0.5833333f, 0.5833333f, 0.5833333f, 0.625f, 0.5833333f, 0.6666667f, 0.5833333f, 0.7083333f,
+	0.5833333f, 0.75f, 0.5833333f, 0.7916667f, 0.5833333f, 0.8333333f, 0.5833333f, 0.875f,
+	0.5833333f, 0.9166667f, 0.5833333f, 0.9583333f, 0.5833333f, 1.0f, 0.5416666f, 0.0f,
+	0.5416666f, 0.041666668f, 0.5416666f, 0.083333336f, 0.5416666f, 0.125f, 0.5416666f, 0.16666667f,
+	0.5416666f, 0.20833333f, 0.5416666f, 0.25f, 0.5416666f, 0.29166666f, 0.5416666f, 0.33333334f,
+	0.5416666f, 0.375f, 0.5416666f, 0.41666666f, 0.5416666f, 0.45833334f, 0.5416666f, 0.5f,
+	0.5416666f, 0.5416667f, 0.5416666f, 0.5833333f, 0.5416666f, 0.625f, 0.5416666f, 0.6666667f,
+	0.5416666f, 0.7083333f, 0.5416666f, 0.75f, 0.5416666f, 0.7916667f, 0.5416666f, 0.8333333f,
+	0.5416666f, 0.875f, 0.5416666f, 0.9166667f, 0.5416666f, 0.9583333f, 0.5416666f, 1.0f,
+	0.5f, 0.0f, 0.5f, 0.041666668f, 0.5f, 0.083333336f, 0.5f, 0.125f,
+	0.5f, 0.16666667f, 0.5f, 0.20833333f, 0.5f, 0.25f, 0.5f, 0.29166666f,
+	0.5f, 0.33333334f, 0.5f, 0.375f, 0.5f, 0.41666666f, 0.5f, 0.45833334f,
+	0.5f, 0.5f, 0.5f, 0.5416667f, 0.5f, 0.5833333f, 0.5f, 0.625f,
+	0.5f, 0.6666667f, 0.5f, 0.7083333f, 0.5f, 0.75f, 0.5f, 0.7916667f,
+	0.5f, 0.8333333f, 0.5f, 0.875f, 0.5f, 0.9166667f, 0.5f, 0.9583333f,
+	0.5f, 1.0f, 0.4583333f, 0.0f, 0.4583333f, 0.041666668f, 0.4583333f, 0.083333336f,
+	0.4583333f, 0.125f, 0.4583333f, 0.16666667f, 0.4583333f, 0.20833333f, 0.4583333f, 0.25f,
+	0.4583333f, 0.29166666f, 0.4583333f, 0.33333334f, 0.4583333f, 0.375f, 0.4583333f, 0.41666666f,
+	0.4583333f, 0.45833334f, 0.4583333f, 0.5f, 0.4583333f, 0.5416667f, 0.4583333f, 0.5833333f,
+	0.4583333f, 0.625f, 0.4583333f, 0.6666667f, 0.4583333f, 0.7083333f, 0.4583333f, 0.75f,
+	0.4583333f, 0.7916667f, 0.4583333f, 0.8333333f, 0.4583333f, 0.875f, 0.4583333f, 0.9166667f,
+	0.4583333f, 0.9583333f, 0.4583333f, 1.0f, 0.41666663f, 0.0f, 0.41666663f, 0.041666668f,
+	0.41666663f, 0.083333336f, 0.41666663f, 0.125f, 0.41666663f, 0.16666667f, 0.41666663f, 0.20833333f,
+	0.41666663f, 0.25f, 0.41666663f, 0.29166666f, 0.41666663f, 0.33333334f, 0.41666663f, 0.375f,
+	0.41666663f, 0.41666666f, 0.41666663f, 0.45833334f, 0.41666663f, 0.5f, 0.41666663f, 0.5416667f,
+	0.41666663f, 0.5833333f, 0.41666663f, 0.625f, 0.41666663f, 0.6666667f, 0.41666663f, 0.7083333f,
+	0.41666663f, 0.75f, 0.41666663f, 0.7916667f, 0.41666663f, 0.8333333f, 0.41666663f, 0.875f,
+	0.41666663f, 0.9166667f, 0.41666663f, 0.9583333f, 0.41666663f, 1.0f, 0.375f, 0.0f,
+	0.375f, 0.041666668f, 0.375f, 0.083333336f, 0.375f, 0.125f, 0.375f, 0.16666667f,
+	0.375f, 0.20833333f, 0.375f, 0.25f, 0.375f, 0.29166666f, 0.375f, 0.33333334f,
+	0.375f, 0.375f, 0.375f, 0.41666666f, 0.375f, 0.45833334f, 0.375f, 0.5f,
+	0.375f, 0.5416667f, 0.375f, 0.5833333f, 0.375f, 0.625f, 0.375f, 0.6666667f,
+	0.375f, 0.7083333f, 0.375f, 0.75f, 0.375f, 0.7916667f, 0.375f, 0.8333333f,
+	0.375f, 0.875f, 0.375f, 0.9166667f, 0.375f, 0.9583333f, 0.375f, 1.0f,
+	0.3333333f, 0.0f, 0.3333333f, 0.041666668f, 0.3333333f, 0.083333336f, 0.3333333f, 0.125f,
+	0.3333333f, 0.16666667f, 0.3333333f, 0.20833333f, 0.3333333f, 0.25f, 0.3333333f, 0.29166666f,
+	0.3333333f, 0.33333334f, 0.3333333f, 0.375f, 0.3333333f, 0.41666666f, 0.3333333f, 0.45833334f,
+	0.3333333f, 0.5f, 0.3333333f, 0.5416667f, 0.3333333f, 0.5833333f, 0.3333333f, 0.625f,
+	0.3333333f, 0.6666667f, 0.3333333f, 0.7083333f, 0.3333333f, 0.75f, 0.3333333f, 0.7916667f,
+	0.3333333f, 0.8333333f, 0.3333333f, 0.875f, 0.3333333f, 0.9166667f, 0.3333333f, 0.9583333f,
+	0.3333333f, 1.0f, 0.29166663f, 0.0f, 0.29166663f, 0.041666668f, 0.29166663f, 0.083333336f,
+	0.29166663f, 0.125f, 0.29166663f, 0.16666667f, 0.29166663f, 0.20833333f, 0.29166663f, 0.25f,
+	0.29166663f, 0.29166666f, 0.29166663f, 0.33333334f, 0.29166663f, 0.375f, 0.29166663f, 0.41666666f,
+	0.29166663f, 0.45833334f, 0.29166663f, 0.5f, 0.29166663f, 0.5416667f, 0.29166663f, 0.5833333f,
+	0.29166663f, 0.625f, 0.29166663f, 0.6666667f, 0.29166663f, 0.7083333f, 0.29166663f, 0.75f,
+	0.29166663f, 0.7916667f, 0.29166663f, 0.8333333f, 0.29166663f, 0.875f, 0.29166663f, 0.9166667f,
+	0.29166663f, 0.9583333f, 0.29166663f, 1.0f, 0.25f, 0.0f, 0.25f, 0.041666668f,
+	0.25f, 0.083333336f, 0.25f, 0.125f, 0.25f, 0.16666667f, 0.25f, 0.20833333f,
+	0.25f, 0.25f, 0.25f, 0.29166666f, 0.25f, 0.33333334f, 0.25f, 0.375f,
+	0.25f, 0.41666666f, 0.25f, 0.45833334f, 0.25f, 0.5f, 0.25f, 0.5416667f,
+	0.25f, 0.5833333f, 0.25f, 0.625f, 0.25f, 0.6666667f, 0.25f, 0.7083333f,
+	0.25f, 0.75f, 0.25f, 0.7916667f, 0.25f, 0.8333333f, 0.25f, 0.875f,
+	0.25f, 0.9166667f, 0.25f, 0.9583333f, 0.25f, 1.0f, 0.20833331f, 0.0f,
+	0.20833331f, 0.041666668f, 0.20833331f, 0.083333336f, 0.20833331f, 0.125f, 0.20833331f, 0.16666667f,
+	0.20833331f, 0.20833333f, 0.20833331f, 0.25f, 0.20833331f, 0.29166666f, 0.20833331f, 0.33333334f,
+	0.20833331f, 0.375f, 0.20833331f, 0.41666666f, 0.20833331f, 0.45833334f, 0.20833331f, 0.5f,
+	0.20833331f, 0.5416667f, 0.20833331f, 0.5833333f, 0.20833331f, 0.625f, 0.20833331f, 0.6666667f,
+	0.20833331f, 0.7083333f, 0.20833331f, 0.75f, 0.20833331f, 0.7916667f, 0.20833331f, 0.8333333f,
+	0.20833331f, 0.875f, 0.20833331f, 0.9166667f, 0.20833331f, 0.9583333f, 0.20833331f, 1.0f,
+	0.16666663f, 0.0f, 0.16666663f, 0.041666668f, 0.16666663f, 0.083333336f, 0.16666663f, 0.125f,
+	0.16666663f, 0.16666667f, 0.16666663f, 0.20833333f, 0.16666663f, 0.25f, 0.16666663f, 0.29166666f,
+	0.16666663f, 0.33333334f, 0.16666663f, 0.375f, 0.16666663f, 0.41666666f, 0.16666663f, 0.45833334f,
+	0.16666663f, 0.5f, 0.16666663f, 0.5416667f, 0.16666663f, 0.5833333f, 0.16666663f, 0.625f,
+	0.16666663f, 0.6666667f, 0.16666663f, 0.7083333f, 0.16666663f, 0.75f, 0.16666663f, 0.7916667f,
+	0.16666663f, 0.8333333f, 0.16666663f, 0.875f, 0.16666663f, 0.9166667f, 0.16666663f, 0.9583333f,
+	0.16666663f, 1.0f, 0.125f, 0.0f, 0.125f, 0.041666668f, 0.125f, 0.083333336f,
+	0.125f, 0.125f, 0.125f, 0.16666667f, 0.125f, 0.20833333f, 0.125f, 0.25f,
+	0.125f, 0.29166666f, 0.125f, 0.33333334f, 0.125f, 0.375f, 0.125f, 0.41666666f,
+	0.125f, 0.45833334f, 0.125f, 0.5f, 0.125f, 0.5416667f, 0.125f, 0.5833333f,
+	0.125f, 0.625f, 0.125f, 0.6666667f, 0.125f, 0.7083333f, 0.125f, 0.75f,
+	0.125f, 0.7916667f, 0.125f, 0.8333333f, 0.125f, 0.875f, 0.125f, 0.9166667f,
+	0.125f, 0.9583333f, 0.125f, 1.0f, 0.08333331f, 0.0f, 0.08333331f, 0.041666668f,
+	0.08333331f, 0.083333336f, 0.08333331f, 0.125f, 0.08333331f, 0.16666667f, 0.08333331f, 0.20833333f,
+	0.08333331f, 0.25f, 0.08333331f, 0.29166666f, 0.08333331f, 0.33333334f, 0.08333331f, 0.375f,
+	0.08333331f, 0.41666666f, 0.08333331f, 0.45833334f, 0.08333331f, 0.5f, 0.08333331f, 0.5416667f,
+	0.08333331f, 0.5833333f, 0.08333331f, 0.625f, 0.08333331f, 0.6666667f, 0.08333331f, 0.7083333f,
+	0.08333331f, 0.75f, 0.08333331f, 0.7916667f, 0.08333331f, 0.8333333f, 0.08333331f, 0.875f,
+	0.08333331f, 0.9166667f, 0.08333331f, 0.9583333f, 0.08333331f, 1.0f, 0.041666627f, 0.0f,
+	0.041666627f, 0.041666668f, 0.041666627f, 0.083333336f, 0.041666627f, 0.125f, 0.041666627f, 0.16666667f,
+	0.041666627f, 0.20833333f, 0.041666627f, 0.25f, 0.041666627f, 0.29166666f, 0.041666627f, 0.33333334f,
+	0.041666627f, 0.375f, 0.041666627f, 0.41666666f, 0.041666627f, 0.45833334f, 0.041666627f, 0.5f,
+	0.041666627f, 0.5416667f, 0.041666627f, 0.5833333f, 0.041666627f, 0.625f, 0.041666627f, 0.6666667f,
+	0.041666627f, 0.7083333f, 0.041666627f, 0.75f, 0.041666627f, 0.7916667f, 0.041666627f, 0.8333333f,
+	0.041666627f, 0.875f, 0.041666627f, 0.9166667f, 0.041666627f, 0.9583333f, 0.041666627f, 1.0f,
+	0.0f, 0.0f, 0.0f, 0.041666668f, 0.0f, 0.083333336f, 0.0f, 0.125f,
+	0.0f, 0.16666667f, 0.0f, 0.20833333f, 0.0f, 0.25f, 0.0f, 0.29166666f,
+	0.0f, 0.33333334f, 0.0f, 0.375f, 0.0f, 0.41666666f, 0.0f, 0.45833334f,
+	0.0f, 0.5f, 0.0f, 0.5416667f, 0.0f, 0.5833333f, 0.0f, 0.625f,
+	0.0f, 0.6666667f, 0.0f, 0.7083333f, 0.0f, 0.75f, 0.0f, 0.7916667f,
+	0.0f, 0.8333333f, 0.0f, 0.875f, 0.0f, 0.9166667f, 0.0f, 0.9583333f,
+	0.0f, 1.0f
+};
+static const GLuint cylinderIndices[3456] =
+{
+	0, 25, 26, 0, 26, 1, 1, 26, 27, 1, 27, 2, 2, 27, 28, 2,
+	28, 3, 3, 28, 29, 3, 29, 4, 4, 29, 30, 4, 30, 5, 5, 30,
+	31, 5, 31, 6, 6, 31, 32, 6, 32, 7, 7, 32, 33, 7, 33, 8,
+	8, 33, 34, 8, 34, 9, 9, 34, 35, 9, 35, 10, 10, 35, 36, 10,
+	36, 11, 11, 36, 37, 11, 37, 12, 12, 37, 38, 12, 38, 13, 13, 38,
+	39, 13, 39, 14, 14, 39, 40, 14, 40, 15, 15, 40, 41, 15, 41, 16,
+	16, 41, 42, 16, 42, 17, 17, 42, 43, 17, 43, 18, 18, 43, 44, 18,
+	44, 19, 19, 44, 45, 19, 45, 20, 20, 45, 46, 20, 46, 21, 21, 46,
+	47, 21, 47, 22, 22, 47, 48, 22, 48, 23, 23, 48, 49, 23, 49, 24,
+	25, 50, 51, 25, 51, 26, 26, 51, 52, 26, 52, 27, 27, 52, 53, 27,
+	53, 28, 28, 53, 54, 28, 54, 29, 29, 54, 55, 29, 55, 30, 30, 55,
+	56, 30, 56, 31, 31, 56, 57, 31, 57, 32, 32, 57, 58, 32, 58, 33,
+	33, 58, 59, 33, 59, 34, 34, 59, 60, 34, 60, 35, 35, 60, 61, 35,
+	61, 36, 36, 61, 62, 36, 62, 37, 37, 62, 63, 37, 63, 38, 38, 63,
+	64, 38, 64, 39, 39, 64, 65, 39, 65, 40, 40, 65, 66, 40, 66, 41,
+	41, 66, 67, 41, 67, 42, 42, 67, 68, 42, 68, 43, 43, 68, 69, 43,
+	69, 44, 44, 69, 70, 44, 70, 45, 45, 70, 71, 45, 71, 46, 46, 71,
+	72, 46, 72, 47, 47, 72, 73, 47, 73, 48, 48, 73, 74, 48, 74, 49,
+	50, 75, 76, 50, 76, 51, 51, 76, 77, 51, 77, 52, 52, 77, 78, 52,
+	78, 53, 53, 78, 79, 53, 79, 54, 54, 79, 80, 54, 80, 55, 55, 80,
+	81, 55, 81, 56, 56, 81, 82, 56, 82, 57, 57, 82, 83, 57, 83, 58,
+	58, 83, 84, 58, 84, 59, 59, 84, 85, 59, 85, 60, 60, 85, 86, 60,
+	86, 61, 61, 86, 87, 61, 87, 62, 62, 87, 88, 62, 88, 63, 63, 88,
+	89, 63, 89, 64, 64, 89, 90, 64, 90, 65, 65, 90, 91, 65, 91, 66,
+	66, 91, 92, 66, 92, 67, 67, 92, 93, 67, 93, 68, 68, 93, 94, 68,
+	94, 69, 69, 94, 95, 69, 95, 70, 70, 95, 96, 70, 96, 71, 71, 96,
+	97, 71, 97, 72, 72, 97, 98, 72, 98, 73, 73, 98, 99, 73, 99, 74,
+	75, 100, 101, 75, 101, 76, 76, 101, 102, 76, 102, 77, 77, 102, 103, 77,
+	103, 78, 78, 103, 104, 78, 104, 79, 79, 104, 105, 79, 105, 80, 80, 105,
+	106, 80, 106, 81, 81, 106, 107, 81, 107, 82, 82, 107, 108, 82, 108, 83,
+	83, 108, 109, 83, 109, 84, 84, 109, 110, 84, 110, 85, 85, 110, 111, 85,
+	111, 86, 86, 111, 112, 86, 112, 87, 87, 112, 113, 87, 113, 88, 88, 113,
+	114, 88, 114, 89, 89, 114, 115, 89, 115, 90, 90, 115, 116, 90, 116, 91,
+	91, 116, 117, 91, 117, 92, 92, 117, 118, 92, 118, 93, 93, 118, 119, 93,
+	119, 94, 94, 119, 120, 94, 120, 95, 95, 120, 121, 95, 121, 96, 96, 121,
+	122, 96, 122, 97, 97, 122, 123, 97, 123, 98, 98, 123, 124, 98, 124, 99,
+	100, 125, 126, 100, 126, 101, 101, 126, 127, 101, 127, 102, 102, 127, 128, 102,
+	128, 103, 103, 128, 129, 103, 129, 104, 104, 129, 130, 104, 130, 105, 105, 130,
+	131, 105, 131, 106, 106, 131, 132, 106, 132, 107, 107, 132, 133, 107, 133, 108,
+	108, 133, 134, 108, 134, 109, 109, 134, 135, 109, 135, 110, 110, 135, 136, 110,
+	136, 111, 111, 136, 137, 111, 137, 112, 112, 137, 138, 112, 138, 113, 113, 138,
+	139, 113, 139, 114, 114, 139, 140, 114, 140, 115, 115, 140, 141, 115, 141, 116,
+	116, 141, 142, 116, 142, 117, 117, 142, 143, 117, 143, 118, 118, 143, 144, 118,
+	144, 119, 119, 144, 145, 119, 145, 120, 120, 145, 146, 120, 146, 121, 121, 146,
+	147, 121, 147, 122, 122, 147, 148, 122, 148, 123, 123, 148, 149, 123, 149, 124,
+	125, 150, 151, 125, 151, 126, 126, 151, 152, 126, 152, 127, 127, 152, 153, 127,
+	153, 128, 128, 153, 154, 128, 154, 129, 129, 154, 155, 129, 155, 130, 130, 155,
+	156, 130, 156, 131, 131, 156, 157, 131, 157, 132, 132, 157, 158, 132, 158, 133,
+	133, 158, 159, 133, 159, 134, 134, 159, 160, 134, 160, 135, 135, 160, 161, 135,
+	161, 136, 136, 161, 162, 136, 162, 137, 137, 162, 163, 137, 163, 138, 138, 163,
+	164, 138, 164, 139, 139, 164, 165, 139, 165, 140, 140, 165, 166, 140, 166, 141,
+	141, 166, 167, 141, 167, 142, 142, 167, 168, 142, 168, 143, 143, 168, 169, 143,
+	169, 144, 144, 169, 170, 144, 170, 145, 145, 170, 171, 145, 171, 146, 146, 171,
+	172, 146, 172, 147, 147, 172, 173, 147, 173, 148, 148, 173, 174, 148, 174, 149,
+	150, 175, 176, 150, 176, 151, 151, 176, 177, 151, 177, 152, 152, 177, 178, 152,
+	178, 153, 153, 178, 179, 153, 179, 154, 154, 179, 180, 154, 180, 155, 155, 180,
+	181, 155, 181, 156, 156, 181, 182, 156, 182, 157, 157, 182, 183, 157, 183, 158,
+	158, 183, 184, 158, 184, 159, 159, 184, 185, 159, 185, 160, 160, 185, 186, 160,
+	186, 161, 161, 186, 187, 161, 187, 162, 162, 187, 188, 162, 188, 163, 163, 188,
+	189, 163, 189, 164, 164, 189, 190, 164, 190, 165, 165, 190, 191, 165, 191, 166,
+	166, 191, 192, 166, 192, 167, 167, 192, 193, 167, 193, 168, 168, 193, 194, 168,
+	194, 169, 169, 194, 195, 169, 195, 170, 170, 195, 196, 170, 196, 171, 171, 196,
+	197, 171, 197, 172, 172, 197, 198, 172, 198, 173, 173, 198, 199, 173, 199, 174,
+	175, 200, 201, 175, 201, 176, 176, 201, 202, 176, 202, 177, 177, 202, 203, 177,
+	203, 178, 178, 203, 204, 178, 204, 179, 179, 204, 205, 179, 205, 180, 180, 205,
+	206, 180, 206, 181, 181, 206, 207, 181, 207, 182, 182, 207, 208, 182, 208, 183,
+	183, 208, 209, 183, 209, 184, 184, 209, 210, 184, 210, 185, 185, 210, 211, 185,
+	211, 186, 186, 211, 212, 186, 212, 187, 187, 212, 213, 187, 213, 188, 188, 213,
+	214, 188, 214, 189, 189, 214, 215, 189, 215, 190, 190, 215, 216, 190, 216, 191,
+	191, 216, 217, 191, 217, 192, 192, 217, 218, 192, 218, 193, 193, 218, 219, 193,
+	219, 194, 194, 219, 220, 194, 220, 195, 195, 220, 221, 195, 221, 196, 196, 221,
+	222, 196, 222, 197, 197, 222, 223, 197, 223, 198, 198, 223, 224, 198, 224, 199,
+	200, 225, 226, 200, 226, 201, 201, 226, 227, 201, 227, 202, 202, 227, 228, 202,
+	228, 203, 203, 228, 229, 203, 229, 204, 204, 229, 230, 204, 230, 205, 205, 230,
+	231, 205, 231, 206, 206, 231, 232, 206, 232, 207, 207, 232, 233, 207, 233, 208,
+	208, 233, 234, 208, 234, 209, 209, 234, 235, 209, 235, 210, 210, 235, 236, 210,
+	236, 211, 211, 236, 237, 211, 237, 212, 212, 237, 238, 212, 238, 213, 213, 238,
+	239, 213, 239, 214, 214, 239, 240, 214, 240, 215, 215, 240, 241, 215, 241, 216,
+	216, 241, 242, 216, 242, 217, 217, 242, 243, 217, 243, 218, 218, 243, 244, 218,
+	244, 219, 219, 244, 245, 219, 245, 220, 220, 245, 246, 220, 246, 221, 221, 246,
+	247, 221, 247, 222, 222, 247, 248, 222, 248, 223, 223, 248, 249, 223, 249, 224,
+	225, 250, 251, 225, 251, 226, 226, 251, 252, 226, 252, 227, 227, 252, 253, 227,
+	253, 228, 228, 253, 254, 228, 254, 229, 229, 254, 255, 229, 255, 230, 230, 255,
+	256, 230, 256, 231, 231, 256, 257, 231, 257, 232, 232, 257, 258, 232, 258, 233,
+	233, 258, 259, 233, 259, 234, 234, 259, 260, 234, 260, 235, 235, 260, 261, 235,
+	261, 236, 236, 261, 262, 236, 262, 237, 237, 262, 263, 237, 263, 238, 238, 263,
+	264, 238, 264, 239, 239, 264, 265, 239, 265, 240, 240, 265, 266, 240, 266, 241,
+	241, 266, 267, 241, 267, 242, 242, 267, 268, 242, 268, 243, 243, 268, 269, 243,
+	269, 244, 244, 269, 270, 244, 270, 245, 245, 270, 271, 245, 271, 246, 246, 271,
+	272, 246, 272, 247, 247, 272, 273, 247, 273, 248, 248, 273, 274, 248, 274, 249,
+	250, 275, 276, 250, 276, 251, 251, 276, 277, 251, 277, 252, 252, 277, 278, 252,
+	278, 253, 253, 278, 279, 253, 279, 254, 254, 279, 280, 254, 280, 255, 255, 280,
+	281, 255, 281, 256, 256, 281, 282, 256, 282, 257, 257, 282, 283, 257, 283, 258,
+	258, 283, 284, 258, 284, 259, 259, 284, 285, 259, 285, 260, 260, 285, 286, 260,
+	286, 261, 261, 286, 287, 261, 287, 262, 262, 287, 288, 262, 288, 263, 263, 288,
+	289, 263, 289, 264, 264, 289, 290, 264, 290, 265, 265, 290, 291, 265, 291, 266,
+	266, 291, 292, 266, 292, 267, 267, 292, 293, 267, 293, 268, 268, 293, 294, 268,
+	294, 269, 269, 294, 295, 269, 295, 270, 270, 295, 296, 270, 296, 271, 271, 296,
+	297, 271, 297, 272, 272, 297, 298, 272, 298, 273, 273, 298, 299, 273, 299, 274,
+	275, 300, 301, 275, 301, 276, 276, 301, 302, 276, 302, 277, 277, 302, 303, 277,
+	303, 278, 278, 303, 304, 278, 304, 279, 279, 304, 305, 279, 305, 280, 280, 305,
+	306, 280, 306, 281, 281, 306, 307, 281, 307, 282, 282, 307, 308, 282, 308, 283,
+	283, 308, 309, 283, 309, 284, 284, 309, 310, 284, 310, 285, 285, 310, 311, 285,
+	311, 286, 286, 311, 312, 286, 312, 287, 287, 312, 313, 287, 313, 288, 288, 313,
+	314, 288, 314, 289, 289, 314, 315, 289, 315, 290, 290, 315, 316, 290, 316, 291,
+	291, 316, 317, 291, 317, 292, 292, 317, 318, 292, 318, 293, 293, 318, 319, 293,
+	319, 294, 294, 319, 320, 294, 320, 295, 295, 320, 321, 295, 321, 296, 296, 321,
+	322, 296, 322, 297, 297, 322, 323, 297, 323, 298, 298, 323, 324, 298, 324, 299,
+	300, 325, 326, 300, 326, 301, 301, 326, 327, 301, 327, 302, 302, 327, 328, 302,
+	328, 303, 303, 328, 329, 303, 329, 304, 304, 329, 330, 304, 330, 305, 305, 330,
+	331, 305, 331, 306, 306, 331, 332, 306, 332, 307, 307, 332, 333, 307, 333, 308,
+	308, 333, 334, 308, 334, 309, 309, 334, 335, 309, 335, 310, 310, 335, 336, 310,
+	336, 311, 311, 336, 337, 311, 337, 312, 312, 337, 338, 312, 338, 313, 313, 338,
+	339, 313, 339, 314, 314, 339, 340, 314, 340, 315, 315, 340, 341, 315, 341, 316,
+	316, 341, 342, 316, 342, 317, 317, 342, 343, 317, 343, 318, 318, 343, 344, 318,
+	344, 319, 319, 344, 345, 319, 345, 320, 320, 345, 346, 320, 346, 321, 321, 346,
+	347, 321, 347, 322, 322, 347, 348, 322, 348, 323, 323, 348, 349, 323, 349, 324,
+	325, 350, 351, 325, 351, 326, 326, 351, 352, 326, 352, 327, 327, 352, 353, 327,
+	353, 328, 328, 353, 354, 328, 354, 329, 329, 354, 355, 329, 355, 330, 330, 355,
+	356, 330, 356, 331, 331, 356, 357, 331, 357, 332, 332, 357, 358, 332, 358, 333,
+	333, 358, 359, 333, 359, 334, 334, 359, 360, 334, 360, 335, 335, 360, 361, 335,
+	361, 336, 336, 361, 362, 336, 362, 337, 337, 362, 363, 337, 363, 338, 338, 363,
+	364, 338, 364, 339, 339, 364, 365, 339, 365, 340, 340, 365, 366, 340, 366, 341,
+	341, 366, 367, 341, 367, 342, 342, 367, 368, 342, 368, 343, 343, 368, 369, 343,
+	369, 344, 344, 369, 370, 344, 370, 345, 345, 370, 371, 345, 371, 346, 346, 371,
+	372, 346, 372, 347, 347, 372, 373, 347, 373, 348, 348, 373, 374, 348, 374, 349,
+	350, 375, 376, 350, 376, 351, 351, 376, 377, 351, 377, 352, 352, 377, 378, 352,
+	378, 353, 353, 378, 379, 353, 379, 354, 354, 379, 380, 354, 380, 355, 355, 380,
+	381, 355, 381, 356, 356, 381, 382, 356, 382, 357, 357, 382, 383, 357, 383, 358,
+	358, 383, 384, 358, 384, 359, 359, 384, 385, 359, 385, 360, 360, 385, 386, 360,
+	386, 361, 361, 386, 387, 361, 387, 362, 362, 387, 388, 362, 388, 363, 363, 388,
+	389, 363, 389, 364, 364, 389, 390, 364, 390, 365, 365, 390, 391, 365, 391, 366,
+	366, 391, 392, 366, 392, 367, 367, 392, 393, 367, 393, 368, 368, 393, 394, 368,
+	394, 369, 369, 394, 395, 369, 395, 370, 370, 395, 396, 370, 396, 371, 371, 396,
+	397, 371, 397, 372, 372, 397, 398, 372, 398, 373, 373, 398, 399, 373, 399, 374,
+	375, 400, 401, 375, 401, 376, 376, 401, 402, 376, 402, 377, 377, 402, 403, 377,
+	403, 378, 378, 403, 404, 378, 404, 379, 379, 404, 405, 379, 405, 380, 380, 405,
+	406, 380, 406, 381, 381, 406, 407, 381, 407, 382, 382, 407, 408, 382, 408, 383,
+	383, 408, 409, 383, 409, 384, 384, 409, 410, 384, 410, 385, 385, 410, 411, 385,
+	411, 386, 386, 411, 412, 386, 412, 387, 387, 412, 413, 387, 413, 388, 388, 413,
+	414, 388, 414, 389, 389, 414, 415, 389, 415, 390, 390, 415, 416, 390, 416, 391,
+	391, 416, 417, 391, 417, 392, 392, 417, 418, 392, 418, 393, 393, 418, 419, 393,
+	419, 394, 394, 419, 420, 394, 420, 395, 395, 420, 421, 395, 421, 396, 396, 421,
+	422, 396, 422, 397, 397, 422, 423, 397, 423, 398, 398, 423, 424, 398, 424, 399,
+	400, 425, 426, 400, 426, 401, 401, 426, 427, 401, 427, 402, 402, 427, 428, 402,
+	428, 403, 403, 428, 429, 403, 429, 404, 404, 429, 430, 404, 430, 405, 405, 430,
+	431, 405, 431, 406, 406, 431, 432, 406, 432, 407, 407, 432, 433, 407, 433, 408,
+	408, 433, 434, 408, 434, 409, 409, 434, 435, 409, 435, 410, 410, 435, 436, 410,
+	436, 411, 411, 436, 437, 411, 437, 412, 412, 437, 438, 412, 438, 413, 413, 438,
+	439, 413, 439, 414, 414, 439, 440, 414, 440, 415, 415, 440, 441, 415, 441, 416,
+	416, 441, 442, 416, 442, 417, 417, 442, 443, 417, 443, 418, 418, 443, 444, 418,
+	444, 419, 419, 444, 445, 419, 445, 420, 420, 445, 446, 420, 446, 421, 421, 446,
+	447, 421, 447, 422, 422, 447, 448, 422, 448, 423, 423, 448, 449, 423, 449, 424,
+	425, 450, 451, 425, 451, 426, 426, 451, 452, 426, 452, 427, 427, 452, 453, 427,
+	453, 428, 428, 453, 454, 428, 454, 429, 429, 454, 455, 429, 455, 430, 430, 455,
+	456, 430, 456, 431, 431, 456, 457, 431, 457, 432, 432, 457, 458, 432, 458, 433,
+	433, 458, 459, 433, 459, 434, 434, 459, 460, 434, 460, 435, 435, 460, 461, 435,
+	461, 436, 436, 461, 462, 436, 462, 437, 437, 462, 463, 437, 463, 438, 438, 463,
+	464, 438, 464, 439, 439, 464, 465, 439, 465, 440, 440, 465, 466, 440, 466, 441,
+	441, 466, 467, 441, 467, 442, 442, 467, 468, 442, 468, 443, 443, 468, 469, 443,
+	469, 444, 444, 469, 470, 444, 470, 445, 445, 470, 471, 445, 471, 446, 446, 471,
+	472, 446, 472, 447, 447, 472, 473, 447, 473, 448, 448, 473, 474, 448, 474, 449,
+	450, 475, 476, 450, 476, 451, 451, 476, 477, 451, 477, 452, 452, 477, 478, 452,
+	478, 453, 453, 478, 479, 453, 479, 454, 454, 479, 480, 454, 480, 455, 455, 480,
+	481, 455, 481, 456, 456, 481, 482, 456, 482, 457, 457, 482, 483, 457, 483, 458,
+	458, 483, 484, 458, 484, 459, 459, 484, 485, 459, 485, 460, 460, 485, 486, 460,
+	486, 461, 461, 486, 487, 461, 487, 462, 462, 487, 488, 462, 488, 463, 463, 488,
+	489, 463, 489, 464, 464, 489, 490, 464, 490, 465, 465, 490, 491, 465, 491, 466,
+	466, 491, 492, 466, 492, 467, 467, 492, 493, 467, 493, 468, 468, 493, 494, 468,
+	494, 469, 469, 494, 495, 469, 495, 470, 470, 495, 496, 470, 496, 471, 471, 496,
+	497, 471, 497, 472, 472, 497, 498, 472, 498, 473, 473, 498, 499, 473, 499, 474,
+	475, 500, 501, 475, 501, 476, 476, 501, 502, 476, 502, 477, 477, 502, 503, 477,
+	503, 478, 478, 503, 504, 478, 504, 479, 479, 504, 505, 479, 505, 480, 480, 505,
+	506, 480, 506, 481, 481, 506, 507, 481, 507, 482, 482, 507, 508, 482, 508, 483,
+	483, 508, 509, 483, 509, 484, 484, 509, 510, 484, 510, 485, 485, 510, 511, 485,
+	511, 486, 486, 511, 512, 486, 512, 487, 487, 512, 513, 487, 513, 488, 488, 513,
+	514, 488, 514, 489, 489, 514, 515, 489, 515, 490, 490, 515, 516, 490, 516, 491,
+	491, 516, 517, 491, 517, 492, 492, 517, 518, 492, 518, 493, 493, 518, 519, 493,
+	519, 494, 494, 519, 520, 494, 520, 495, 495, 520, 521, 495, 521, 496, 496, 521,
+	522, 496, 522, 497, 497, 522, 523, 497, 523, 498, 498, 523, 524, 498, 524, 499,
+	500, 525, 526, 500, 526, 501, 501, 526, 527, 501, 527, 502, 502, 527, 528, 502,
+	528, 503, 503, 528, 529, 503, 529, 504, 504, 529, 530, 504, 530, 505, 505, 530,
+	531, 505, 531, 506, 506, 531, 532, 506, 532, 507, 507, 532, 533, 507, 533, 508,
+	508, 533, 534, 508, 534, 509, 509, 534, 535, 509, 535, 510, 510, 535, 536, 510,
+	536, 511, 511, 536, 537, 511, 537, 512, 512, 537, 538, 512, 538, 513, 513, 538,
+	539, 513, 539, 514, 514, 539, 540, 514, 540, 515, 515, 540, 541, 515, 541, 516,
+	516, 541, 542, 516, 542, 517, 517, 542, 543, 517, 543, 518, 518, 543, 544, 518,
+	544, 519, 519, 544, 545, 519, 545, 520, 520, 545, 546, 520, 546, 521, 521, 546,
+	547, 521, 547, 522, 522, 547, 548, 522, 548, 523, 523, 548, 549, 523, 549, 524,
+	525, 550, 551, 525, 551, 526, 526, 551, 552, 526, 552, 527, 527, 552, 553, 527,
+	553, 528, 528, 553, 554, 528, 554, 529, 529, 554, 555, 529, 555, 530, 530, 555,
+	556, 530, 556, 531, 531, 556, 557, 531, 557, 532, 532, 557, 558, 532, 558, 533,
+	533, 558, 559, 533, 559, 534, 534, 559, 560, 534, 560, 535, 535, 560, 561, 535,
+	561, 536, 536, 561, 562, 536, 562, 537, 537, 562, 563, 537, 563, 538, 538, 563,
+	564, 538, 564, 539, 539, 564, 565, 539, 565, 540, 540, 565, 566, 540, 566, 541,
+	541, 566, 567, 541, 567, 542, 542, 567, 568, 542, 568, 543, 543, 568, 569, 543,
+	569, 544, 544, 569, 570, 544, 570, 545, 545, 570, 571, 545, 571, 546, 546, 571,
+	572, 546, 572, 547, 547, 572, 573, 547, 573, 548, 548, 573, 574, 548, 574, 549,
+	550, 575, 576, 550, 576, 551, 551, 576, 577, 551, 577, 552, 552, 577, 578, 552,
+	578, 553, 553, 578, 579, 553, 579, 554, 554, 579, 580, 554, 580, 555, 555, 580,
+	581, 555, 581, 556, 556, 581, 582, 556, 582, 557, 557, 582, 583, 557, 583, 558,
+	558, 583, 584, 558, 584, 559, 559, 584, 585, 559, 585, 560, 560, 585, 586, 560,
+	586, 561, 561, 586, 587, 561, 587, 562, 562, 587, 588, 562, 588, 563, 563, 588,
+	589, 563, 589, 564, 564, 589, 590, 564, 590, 565, 565, 590, 591, 565, 591, 566,
+	566, 591, 592, 566, 592, 567, 567, 592, 593, 567, 593, 568, 568, 593, 594, 568,
+	594, 569, 569, 594, 595, 569, 595, 570, 570, 595, 596, 570, 596, 571, 571, 596,
+	597, 571, 597, 572, 572, 597, 598, 572, 598, 573, 573, 598, 599, 573, 599, 574,
+	575, 600, 601, 575, 601, 576, 576, 601, 602, 576, 602, 577, 577, 602, 603, 577,
+	603, 578, 578, 603, 604, 578, 604, 579, 579, 604, 605, 579, 605, 580, 580, 605,
+	606, 580, 606, 581, 581, 606, 607, 581, 607, 582, 582, 607, 608, 582, 608, 583,
+	583, 608, 609, 583, 609, 584, 584, 609, 610, 584, 610, 585, 585, 610, 611, 585,
+	611, 586, 586, 611, 612, 586, 612, 587, 587, 612, 613, 587, 613, 588, 588, 613,
+	614, 588, 614, 589, 589, 614, 615, 589, 615, 590, 590, 615, 616, 590, 616, 591,
+	591, 616, 617, 591, 617, 592, 592, 617, 618, 592, 618, 593, 593, 618, 619, 593,
+	619, 594, 594, 619, 620, 594, 620, 595, 595, 620, 621, 595, 621, 596, 596, 621,
+	622, 596, 622, 597, 597, 622, 623, 597, 623, 598, 598, 623, 624, 598, 624, 599
+};
+
+ShapeArrays BakedTables::cylinder()
+{
+	ShapeArrays arrays = { cylinderVertex, cylinderNormals, cylinderTexCoords, cylinderIndices, 625, 3456, 1.0f, 24.0f };
+	return arrays;
+}
+
+// ShapeGen::genTorus(0.325, 24)
+static const float torusVertex[1875] =
+{
+	0.97499996f, 0.0f, 0.0f, 0.96392584f, 0.0f, 0.08411618f, 0.93145823f, 0.0f,
+	0.1625f, 0.8798097f, 0.0f, 0.22980969f, 0.81249994f, 0.0f, 0.28145826f, 0.7341162f,
+	0.0f, 0.3139259f, 0.65f, 0.0f, 0.325f, 0.5658838f, 0.0f, 0.3139259f,
+	0.48749995f, 0.0f, 0.28145823f, 0.42019027f, 0.0f, 0.22980969f, 0.36854175f, 0.0f,
+	0.16250001f, 0.33607408f, 0.0f, 0.08411621f, 0.325f, 0.0f, -2.8412401e-08f, 0.33607408f,
+	0.0f, -0.0841162f, 0.36854175f, 0.0f, -0.16249998f, 0.42019027f, 0.0f, -0.22980967f,
+	0.4875f, 0.0f, -0.28145826f, 0.5658838f, 0.0f, -0.3139259f, 0.65f, 0.0f,
+	-0.325f, 0.73411614f, 0.0f, -0.3139259f, 0.81249994f, 0.0f, -0.28145826f, 0.8798096f,
+	0.0f, -0.22980973f, 0.93145823f, 0.0f, -0.16250005f, 0.96392584f, 0.0f, -0.084116116f,
+	0.97499996f, 0.0f, 5.6824803e-08f, 0.94177765f, 0.25234857f, 0.0f, 0.9310809f, 0.24948236f,
+	0.08411618f, 0.89971954f, 0.24107914f, 0.1625f, 0.84983087f, 0.2277115f, 0.22980969f, 0.78481466f,
+	0.21029046f, 0.28145826f, 0.7091018f, 0.19000325f, 0.3139259f, 0.6278518f, 0.16823237f, 0.325f,
+	0.5466018f, 0.1464615f, 0.3139259f, 0.4708888f, 0.12617427f, 0.28145823f, 0.40587264f, 0.10875324f,
+	0.22980969f, 0.35598397f, 0.095385626f, 0.16250001f, 0.32462263f, 0.08698237f, 0.08411621f, 0.3139259f,
+	0.08411618f, -2.8412401e-08f, 0.32462263f, 0.08698237f, -0.0841162f, 0.35598397f, 0.095385626f, -0.16249998f,
+	0.40587264f, 0.10875324f, -0.22980967f, 0.47088885f, 0.12617429f, -0.28145826f, 0.5466018f, 0.1464615f,
+	-0.3139259f, 0.6278518f, 0.16823237f, -0.325f, 0.70910174f, 0.19000323f, -0.3139259f, 0.78481466f,
+	0.21029046f, -0.28145826f, 0.8498308f, 0.22771148f, -0.22980973f, 0.89971954f, 0.24107914f, -0.16250005f,
+	0.9310809f, 0.24948236f, -0.084116116f, 0.94177765f, 0.25234857f, 5.6824803e-08f, 0.8443747f, 0.48749998f,
+	0.0f, 0.83478427f, 0.48196292f, 0.08411618f, 0.8066665f, 0.46572912f, 0.1625f, 0.7619375f,
+	0.43990484f, 0.22980969f, 0.7036456f, 0.40624997f, 0.28145826f, 0.6357633f, 0.3670581f, 0.3139259f,
+	0.56291646f, 0.325f, 0.325f, 0.49006975f, 0.2829419f, 0.3139259f, 0.42218733f, 0.24374998f,
+	0.28145823f, 0.36389545f, 0.21009514f, 0.22980969f, 0.3191665f, 0.18427087f, 0.16250001f, 0.29104868f,
+	0.16803704f, 0.08411621f, 0.28145823f, 0.1625f, -2.8412401e-08f, 0.29104868f, 0.16803704f, -0.0841162f,
+	0.3191665f, 0.18427087f, -0.16249998f, 0.36389545f, 0.21009514f, -0.22980967f, 0.4221874f, 0.24375f,
+	-0.28145826f, 0.49006975f, 0.2829419f, -0.3139259f, 0.56291646f, 0.325f, -0.325f, 0.6357632f,
+	0.36705807f, -0.3139259f, 0.7036456f, 0.40624997f, -0.28145826f, 0.76193744f, 0.4399048f, -0.22980973f,
+	0.8066665f, 0.46572912f, -0.16250005f, 0.83478427f, 0.48196292f, -0.084116116f, 0.8443747f, 0.48749998f,
+	5.6824803e-08f, 0.6894291f, 0.6894291f, 0.0f, 0.6815985f, 0.6815985f, 0.08411618f, 0.65864044f,
+	0.65864044f, 0.1625f, 0.62211937f, 0.62211937f, 0.22980969f, 0.5745242f, 0.5745242f, 0.28145826f,
+	0.5190985f, 0.5190985f, 0.3139259f, 0.45961937f, 0.45961937f, 0.325f, 0.4001403f, 0.4001403f,
+	0.3139259f, 0.34471452f, 0.34471452f, 0.28145823f, 0.29711938f, 0.29711938f, 0.22980969f, 0.26059836f,
+	0.26059836f, 0.16250001f, 0.23764026f, 0.23764026f, 0.08411621f, 0.22980969f, 0.22980969f, -2.8412401e-08f,
+	0.23764026f, 0.23764026f, -0.0841162f, 0.26059836f, 0.26059836f, -0.16249998f, 0.29711938f, 0.29711938f,
+	-0.22980967f, 0.34471455f, 0.34471455f, -0.28145826f, 0.4001403f, 0.4001403f, -0.3139259f, 0.45961937f,
+	0.45961937f, -0.325f, 0.51909846f, 0.51909846f, -0.3139259f, 0.5745242f, 0.5745242f, -0.28145826f,
+	0.6221193f, 0.6221193f, -0.22980973f, 0.65864044f, 0.65864044f, -0.16250005f, 0.6815985f, 0.6815985f,
+	-0.084116116f, 0.6894291f, 0.6894291f, 5.6824803e-08f, 0.48749995f, 0.8443748f, 0.0f, 0.4819629f,
+	0.8347843f, 0.08411618f, 0.4657291f, 0.80666655f, 0.1625f, 0.4399048f, 0.76193756f, 0.22980969f,
+	0.40624994f, 0.70364565f, 0.28145826f, 0.36705807f, 0.6357633f, 0.3139259f, 0.32499996f, 0.5629165f,
+	0.325f, 0.28294188f, 0.49006978f, 0.3139259f, 0.24374996f, 0.42218736f, 0.28145823f, 0.21009512f,
+	0.36389548f, 0.22980969f, 0.18427086f, 0.31916654f, 0.16250001f, 0.16803703f, 0.2910487f, 0.08411621f,
+	0.16249998f, 0.28145826f, -2.8412401e-08f, 0.16803703f, 0.2910487f, -0.0841162f, 0.18427086f, 0.31916654f,
+	-0.16249998f, 0.21009512f, 0.36389548f, -0.22980967f, 0.24374999f, 0.42218742f, -0.28145826f, 0.28294188f,
+	0.49006978f, -0.3139259f, 0.32499996f, 0.5629165f, -0.325f, 0.36705804f, 0.6357632f, -0.3139259f,
+	0.40624994f, 0.70364565f, -0.28145826f, 0.43990478f, 0.7619375f, -0.22980973f, 0.4657291f, 0.80666655f,
+	-0.16250005f, 0.4819629f, 0.8347843f, -0.084116116f, 0.48749995f, 0.8443748f, 5.6824803e-08f, 0.2523486f,
+	0.94177765f, 0.0f, 0.2494824f, 0.9310809f, 0.08411618f, 0.24107915f, 0.89971954f, 0.1625f,
+	0.22771153f, 0.84983087f, 0.22980969f, 0.21029048f, 0.78481466f, 0.28145826f, 0.19000328f, 0.7091018f,
+	0.3139259f, 0.1682324f, 0.6278518f, 0.325f, 0.14646153f, 0.5466018f, 0.3139259f, 0.12617429f,
+	0.4708888f, 0.28145823f, 0.10875326f, 0.40587264f, 0.22980969f, 0.09538563f, 0.35598397f, 0.16250001f,
+	0.086982384f, 0.32462263f, 0.08411621f, 0.0841162f, 0.3139259f, -2.8412401e-08f, 0.086982384f, 0.32462263f,
+	-0.0841162f, 0.09538563f, 0.35598397f, -0.16249998f, 0.10875326f, 0.40587264f, -0.22980967f, 0.1261743f,
+	0.47088885f, -0.28145826f, 0.14646153f, 0.5466018f, -0.3139259f, 0.1682324f, 0.6278518f, -0.325f,
+	0.19000326f, 0.70910174f, -0.3139259f, 0.21029048f, 0.78481466f, -0.28145826f, 0.22771151f, 0.8498308f,
+	-0.22980973f, 0.24107915f, 0.89971954f, -0.16250005f, 0.2494824f, 0.9310809f, -0.084116116f, 0.2523486f,
+	0.94177765f, 5.6824803e-08f, -4.2618602e-08f, 0.97499996f, 0.0f, -4.2134538e-08f, 0.96392584f, 0.08411618f,
+	-4.071533e-08f, 0.93145823f, 0.1625f, -3.8457703e-08f, 0.8798097f, 0.22980969f, -3.55155e-08f, 0.81249994f,
+	0.28145826f, -3.208924e-08f, 0.7341162f, 0.3139259f, -2.8412401e-08f, 0.65f, 0.325f, -2.4735566e-08f,
+	0.5658838f, 0.3139259f, -2.13093e-08f, 0.48749995f, 0.28145823f, -1.83671e-08f, 0.42019027f, 0.22980969f,
+	-1.6109471e-08f, 0.36854175f, 0.16250001f, -1.4690265e-08f, 0.33607408f, 0.08411621f, -1.4206201e-08f, 0.325f,
+	-2.8412401e-08f, -1.4690265e-08f, 0.33607408f, -0.0841162f, -1.6109471e-08f, 0.36854175f, -0.16249998f, -1.83671e-08f,
+	0.42019027f, -0.22980967f, -2.1309303e-08f, 0.4875f, -0.28145826f, -2.4735566e-08f, 0.5658838f, -0.3139259f,
+	-2.8412401e-08f, 0.65f, -0.325f, -3.2089236e-08f, 0.73411614f, -0.3139259f, -3.55155e-08f, 0.81249994f,
+	-0.28145826f, -3.84577e-08f, 0.8798096f, -0.22980973f, -4.071533e-08f, 0.93145823f, -0.16250005f, -4.2134538e-08f,
+	0.96392584f, -0.084116116f, -4.2618602e-08f, 0.97499996f, 5.6824803e-08f, -0.25234857f, 0.94177765f, 0.0f,
+	-0.24948236f, 0.9310809f, 0.08411618f, -0.24107914f, 0.89971954f, 0.1625f, -0.2277115f, 0.84983087f,
+	0.22980969f, -0.21029046f, 0.78481466f, 0.28145826f, -0.19000325f, 0.7091018f, 0.3139259f, -0.16823237f,
+	0.6278518f, 0.325f, -0.1464615f, 0.5466018f, 0.3139259f, -0.12617427f, 0.4708888f, 0.28145823f,
+	-0.10875324f, 0.40587264f, 0.22980969f, -0.095385626f, 0.35598397f, 0.16250001f, -0.08698237f, 0.32462263f,
+	0.08411621f, -0.08411618f, 0.3139259f, -2.8412401e-08f, -0.08698237f, 0.32462263f, -0.0841162f, -0.095385626f,
+	0.35598397f, -0.16249998f, -0.10875324f, 0.40587264f, -0.22980967f, -0.12617429f, 0.47088885f, -0.28145826f,
+	-0.1464615f, 0.5466018f, -0.3139259f, -0.16823237f, 0.6278518f, -0.325f, -0.19000323f, 0.70910174f,
+	-0.3139259f, -0.21029046f, 0.78481466f, -0.28145826f, -0.22771148f, 0.8498308f, -0.22980973f, -0.24107914f,
+	0.89971954f, -0.16250005f, -0.24948236f, 0.9310809f, -0.084116116f, -0.25234857f, 0.94177765f, 5.6824803e-08f,
+	-0.48750004f, 0.8443747f, 0.0f, -0.48196298f, 0.83478427f, 0.08411618f, -0.46572918f, 0.8066665f,
+	0.1625f, -0.4399049f, 0.7619375f, 0.22980969f, -0.40625003f, 0.7036456f, 0.28145826f, -0.36705813f,
+	0.6357633f, 0.3139259f, -0.32500002f, 0.56291646f, 0.325f, -0.28294194f, 0.49006975f, 0.3139259f,
+	-0.24375f, 0.42218733f, 0.28145823f, -0.21009517f, 0.36389545f, 0.22980969f, -0.18427089f, 0.3191665f,
+	0.16250001f, -0.16803706f, 0.29104868f, 0.08411621f, -0.16250001f, 0.28145823f, -2.8412401e-08f, -0.16803706f,
+	0.29104868f, -0.0841162f, -0.18427089f, 0.3191665f, -0.16249998f, -0.21009517f, 0.36389545f, -0.22980967f,
+	-0.24375004f, 0.4221874f, -0.28145826f, -0.28294194f, 0.49006975f, -0.3139259f, -0.32500002f, 0.56291646f,
+	-0.325f, -0.3670581f, 0.6357632f, -0.3139259f, -0.40625003f, 0.7036456f, -0.28145826f, -0.43990487f,
+	0.76193744f, -0.22980973f, -0.46572918f, 0.8066665f, -0.16250005f, -0.48196298f, 0.83478427f, -0.084116116f,
+	-0.48750004f, 0.8443747f, 5.6824803e-08f, -0.6894291f, 0.6894291f, 0.0f, -0.6815985f, 0.6815985f,
+	0.08411618f, -0.65864044f, 0.65864044f, 0.1625f, -0.62211937f, 0.62211937f, 0.22980969f, -0.5745242f,
+	0.5745242f, 0.28145826f, -0.5190985f, 0.5190985f, 0.3139259f, -0.45961937f, 0.45961937f, 0.325f,
+	-0.4001403f, 0.4001403f, 0.3139259f, -0.34471452f, 0.34471452f, 0.28145823f, -0.29711938f, 0.29711938f,
+	0.22980969f, -0.26059836f, 0.26059836f, 0.16250001f, -0.23764026f, 0.23764026f, 0.08411621f, -0.22980969f,
+	0.22980969f, -2.8412401e-08f, -0.23764026f, 0.23764026f, -0.0841162f, -0.26059836f, 0.26059836f, -0.16249998f,
+	-0.29711938f, 0.29711938f, -0.22980967f, -0.34471455f, 0.34471455f, -0.28145826f, -0.4001403f, 0.4001403f,
+	-0.3139259f, -0.45961937f, 0.45961937f, -0.325f, -0.51909846f, 0.51909846f, -0.3139259f, -0.5745242f,
+	0.5745242f, -0.28145826f, -0.6221193f, 0.6221193f, -0.22980973f, -0.65864044f, 0.65864044f, -0.16250005f,
+	-0.6815985f, 0.6815985f, -0.084116116f, -0.6894291f, 0.6894291f, 5.6824803e-08f, -0.8443747f, 0.48750004f,
+	0.0f, -0.83478427f, 0.48196298f, 0.08411618f, -0.8066665f, 0.46572918f, 0.1625f, -0.7619375f,
+	0.4399049f, 0.22980969f, -0.7036456f, 0.40625003f, 0.28145826f, -0.6357633f, 0.36705813f, 0.3139259f,
+	-0.56291646f, 0.32500002f, 0.325f, -0.49006975f, 0.28294194f, 0.3139259f, -0.42218733f, 0.24375f,
+	0.28145823f, -0.36389545f, 0.21009517f, 0.22980969f, -0.3191665f, 0.18427089f, 0.16250001f, -0.29104868f,
+	0.16803706f, 0.08411621f, -0.28145823f, 0.16250001f, -2.8412401e-08f, -0.29104868f, 0.16803706f, -0.0841162f,
+	-0.3191665f, 0.18427089f, -0.16249998f, -0.36389545f, 0.21009517f, -0.22980967f, -0.4221874f, 0.24375004f,
+	-0.28145826f, -0.49006975f, 0.28294194f, -0.3139259f, -0.56291646f, 0.32500002f, -0.325f, -0.6357632f,
+	0.3670581f, -0.3139259f, -0.7036456f, 0.40625003f, -0.28145826f, -0.76193744f, 0.43990487f, -0.22980973f,
+	-0.8066665f, 0.46572918f, -0.16250005f, -0.83478427f, 0.48196298f, -0.084116116f, -0.8443747f, 0.48750004f,
+	5.6824803e-08f, -0.94177765f, 0.25234863f, 0.0f, -0.9310809f, 0.24948245f, 0.08411618f, -0.89971954f,
+	0.24107921f, 0.1625f, -0.84983087f, 0.22771157f, 0.22980969f, -0.78481466f, 0.21029054f, 0.28145826f,
+	-0.7091018f, 0.19000332f, 0.3139259f, -0.6278518f, 0.16823243f, 0.325f, -0.5466018f, 0.14646156f,
+	0.3139259f, -0.4708888f, 0.12617432f, 0.28145823f, -0.40587264f, 0.10875329f, 0.22980969f, -0.35598397f,
+	0.095385656f, 0.16250001f, -0.32462263f, 0.08698241f, 0.08411621f, -0.3139259f, 0.08411621f, -2.8412401e-08f,
+	-0.32462263f, 0.08698241f, -0.0841162f, -0.35598397f, 0.095385656f, -0.16249998f, -0.40587264f, 0.10875329f,
+	-0.22980967f, -0.47088885f, 0.12617433f, -0.28145826f, -0.5466018f, 0.14646156f, -0.3139259f, -0.6278518f,
+	0.16823243f, -0.325f, -0.70910174f, 0.1900033f, -0.3139259f, -0.78481466f, 0.21029054f, -0.28145826f,
+	-0.8498308f, 0.22771156f, -0.22980973f, -0.89971954f, 0.24107921f, -0.16250005f, -0.9310809f, 0.24948245f,
+	-0.084116116f, -0.94177765f, 0.25234863f, 5.6824803e-08f, -0.97499996f, -8.5237204e-08f, 0.0f, -0.96392584f,
+	-8.4269075e-08f, 0.08411618f, -0.93145823f, -8.143066e-08f, 0.1625f, -0.8798097f, -7.6915406e-08f, 0.22980969f,
+	-0.81249994f, -7.1031e-08f, 0.28145826f, -0.7341162f, -6.417848e-08f, 0.3139259f, -0.65f, -5.6824803e-08f,
+	0.325f, -0.5658838f, -4.9471133e-08f, 0.3139259f, -0.48749995f, -4.26186e-08f, 0.28145823f, -0.42019027f,
+	-3.67342e-08f, 0.22980969f, -0.36854175f, -3.2218942e-08f, 0.16250001f, -0.33607408f, -2.938053e-08f, 0.08411621f,
+	-0.325f, -2.8412401e-08f, -2.8412401e-08f, -0.33607408f, -2.938053e-08f, -0.0841162f, -0.36854175f, -3.2218942e-08f,
+	-0.16249998f, -0.42019027f, -3.67342e-08f, -0.22980967f, -0.4875f, -4.2618606e-08f, -0.28145826f, -0.5658838f,
+	-4.9471133e-08f, -0.3139259f, -0.65f, -5.6824803e-08f, -0.325f, -0.73411614f, -6.417847e-08f, -0.3139259f,
+	-0.81249994f, -7.1031e-08f, -0.28145826f, -0.8798096f, -7.69154e-08f, -0.22980973f, -0.93145823f, -8.143066e-08f,
+	-0.16250005f, -0.96392584f, -8.4269075e-08f, -0.084116116f, -0.97499996f, -8.5237204e-08f, 5.6824803e-08f, -0.94177765f,
+	-0.2523486f, 0.0f, -0.9310809f, -0.2494824f, 0.08411618f, -0.89971954f, -0.24107915f, 0.1625f,
+	-0.84983087f, -0.22771153f, 0.22980969f, -0.78481466f, -0.21029048f, 0.28145826f, -0.7091018f, -0.19000328f,
+	0.3139259f, -0.6278518f, -0.1682324f, 0.325f, -0.5466018f, -0.14646153f, 0.3139259f, -0.4708888f,
+	-0.12617429f, 0.28145823f, -0.40587264f, -0.10875326f, 0.22980969f, -0.35598397f, -0.09538563f, 0.16250001f,
+	-0.32462263f, -0.086982384f, 0.08411621f, -0.3139259f, -0.0841162f, -2.8412401e-08f, -0.32462263f, -0.086982384f,
+	-0.0841162f, -0.35598397f, -0.09538563f, -0.16249998f, -0.40587264f, -0.10875326f, -0.22980967f, -0.47088885f,
+	-0.1261743f, -0.28145826f, -0.5466018f, -0.14646153f, -0.3139259f, -0.6278518f, -0.1682324f, -0.325f,
+	-0.70910174f, -0.19000326f, -0.3139259f, -0.78481466f, -0.21029048f, -0.28145826f, -0.8498308f, -0.22771151f,
+	-0.22980973f, -0.89971954f, -0.24107915f, -0.16250005f, -0.9310809f, -0.2494824f, -0.084116116f, -0.94177765f,
+	-0.2523486f, 5.6824803e-08f, -0.8443747f, -0.48749995f, 0.0f, -0.83478427f, -0.4819629f, 0.08411618f,
+	-0.8066665f, -0.4657291f, 0.1625f, -0.7619375f, -0.4399048f, 0.22980969f, -0.7036456f, -0.40624994f,
+	0.28145826f, -0.6357633f, -0.36705807f, 0.3139259f, -0.56291646f, -0.32499996f, 0.325f, -0.49006975f,
+	-0.28294188f, 0.3139259f, -0.42218733f, -0.24374996f, 0.28145823f, -0.36389545f, -0.21009512f, 0.22980969f,
+	-0.3191665f, -0.18427086f, 0.16250001f, -0.29104868f, -0.16803703f, 0.08411621f, -0.28145823f, -0.16249998f,
+	-2.8412401e-08f, -0.29104868f, -0.16803703f, -0.0841162f, -0.3191665f, -0.18427086f, -0.16249998f, -0.36389545f,
+	-0.21009512f, -0.22980967f, -0.4221874f, -0.24374999f, -0.28145826f, -0.49006975f, -0.28294188f, -0.3139259f,
+	-0.56291646f, -0.32499996f, -0.325f, -0.6357632f, -0.36705804f, -0.3139259f, -0.7036456f, -0.40624994f,
+	-0.28145826f, -0.76193744f, -0.43990478f, -0.22980973f, -0.8066665f, -0.4657291f, -0.16250005f, -0.83478427f,
+	-0.4819629f, -0.084116116f, -0.8443747f, -0.48749995f, 5.6824803e-08f, -0.6894291f, -0.68942904f, 0.0f,
+	-0.68159854f, -0.6815984f, 0.08411618f, -0.6586405f, -0.6586404f, 0.1625f, -0.6221194f, -0.6221193f,
+	0.22980969f, -0.5745243f, -0.57452416f, 0.28145826f, -0.5190986f, -0.51909846f, 0.3139259f, -0.45961943f,
+	-0.45961934f, 0.325f, -0.40014032f, -0.40014026f, 0.3139259f, -0.34471455f, -0.3447145f, 0.28145823f,
+	-0.2971194f, -0.29711935f, 0.22980969f, -0.2605984f, -0.26059833f, 0.16250001f, -0.23764028f, -0.23764025f,
+	0.08411621f, -0.22980972f, -0.22980967f, -2.8412401e-08f, -0.23764028f, -0.23764025f, -0.0841162f, -0.2605984f,
+	-0.26059833f, -0.16249998f, -0.2971194f, -0.29711935f, -0.22980967f, -0.34471458f, -0.34471452f, -0.28145826f,
+	-0.40014032f, -0.40014026f, -0.3139259f, -0.45961943f, -0.45961934f, -0.325f, -0.5190985f, -0.51909846f,
+	-0.3139259f, -0.5745243f, -0.57452416f, -0.28145826f, -0.62211937f, -0.6221193f, -0.22980973f, -0.6586405f,
+	-0.6586404f, -0.16250005f, -0.68159854f, -0.6815984f, -0.084116116f, -0.6894291f, -0.68942904f, 5.6824803e-08f,
+	-0.4874999f, -0.8443748f, 0.0f, -0.48196283f, -0.8347843f, 0.08411618f, -0.46572903f, -0.80666655f,
+	0.1625f, -0.43990475f, -0.76193756f, 0.22980969f, -0.4062499f, -0.70364565f, 0.28145826f, -0.36705804f,
+	-0.6357633f, 0.3139259f, -0.32499993f, -0.5629165f, 0.325f, -0.28294185f, -0.49006978f, 0.3139259f,
+	-0.24374993f, -0.42218736f, 0.28145823f, -0.2100951f, -0.36389548f, 0.22980969f, -0.18427084f, -0.31916654f,
+	0.16250001f, -0.16803701f, -0.2910487f, 0.08411621f, -0.16249996f, -0.28145826f, -2.8412401e-08f, -0.16803701f,
+	-0.2910487f, -0.0841162f, -0.18427084f, -0.31916654f, -0.16249998f, -0.2100951f, -0.36389548f, -0.22980967f,
+	-0.24374996f, -0.42218742f, -0.28145826f, -0.28294185f, -0.49006978f, -0.3139259f, -0.32499993f, -0.5629165f,
+	-0.325f, -0.367058f, -0.6357632f, -0.3139259f, -0.4062499f, -0.70364565f, -0.28145826f, -0.43990472f,
+	-0.7619375f, -0.22980973f, -0.46572903f, -0.80666655f, -0.16250005f, -0.48196283f, -0.8347843f, -0.084116116f,
+	-0.4874999f, -0.8443748f, 5.6824803e-08f, -0.2523485f, -0.9417777f, 0.0f, -0.2494823f, -0.9310809f,
+	0.08411618f, -0.24107908f, -0.8997196f, 0.1625f, -0.22771145f, -0.8498309f, 0.22980969f, -0.2102904f,
+	-0.7848147f, 0.28145826f, -0.1900032f, -0.70910186f, 0.3139259f, -0.16823234f, -0.6278518f, 0.325f,
+	-0.14646147f, -0.54660183f, 0.3139259f, -0.12617424f, -0.47088882f, 0.28145823f, -0.10875322f, -0.40587264f,
+	0.22980969f, -0.0953856f, -0.355984f, 0.16250001f, -0.086982355f, -0.32462266f, 0.08411621f, -0.08411617f,
+	-0.3139259f, -2.8412401e-08f, -0.086982355f, -0.32462266f, -0.0841162f, -0.0953856f, -0.355984f, -0.16249998f,
+	-0.10875322f, -0.40587264f, -0.22980967f, -0.12617426f, -0.47088888f, -0.28145826f, -0.14646147f, -0.54660183f,
+	-0.3139259f, -0.16823234f, -0.6278518f, -0.325f, -0.19000319f, -0.7091018f, -0.3139259f, -0.2102904f,
+	-0.7848147f, -0.28145826f, -0.22771142f, -0.84983087f, -0.22980973f, -0.24107908f, -0.8997196f, -0.16250005f,
+	-0.2494823f, -0.9310809f, -0.084116116f, -0.2523485f, -0.9417777f, 5.6824803e-08f, 1.1626758e-08f, -0.97499996f,
+	0.0f, 1.14947e-08f, -0.96392584f, 0.08411618f, 1.1107528e-08f, -0.93145823f, 0.1625f, 1.0491625e-08f,
+	-0.8798097f, 0.22980969f, 9.688965e-09f, -0.81249994f, 0.28145826f, 8.754248e-09f, -0.7341162f, 0.3139259f,
+	7.751172e-09f, -0.65f, 0.325f, 6.7480967e-09f, -0.5658838f, 0.3139259f, 5.8133787e-09f, -0.48749995f,
+	0.28145823f, 5.010719e-09f, -0.42019027f, 0.22980969f, 4.3948165e-09f, -0.36854175f, 0.16250001f, 4.0076436e-09f,
+	-0.33607408f, 0.08411621f, 3.875586e-09f, -0.325f, -2.8412401e-08f, 4.0076436e-09f, -0.33607408f, -0.0841162f,
+	4.3948165e-09f, -0.36854175f, -0.16249998f, 5.010719e-09f, -0.42019027f, -0.22980967f, 5.8133796e-09f, -0.4875f,
+	-0.28145826f, 6.7480967e-09f, -0.5658838f, -0.3139259f, 7.751172e-09f, -0.65f, -0.325f, 8.754247e-09f,
+	-0.73411614f, -0.3139259f, 9.688965e-09f, -0.81249994f, -0.28145826f, 1.04916245e-08f, -0.8798096f, -0.22980973f,
+	1.1107528e-08f, -0.93145823f, -0.16250005f, 1.14947e-08f, -0.96392584f, -0.084116116f, 1.1626758e-08f, -0.97499996f,
+	5.6824803e-08f, 0.25234854f, -0.94177765f, 0.0f, 0.24948233f, -0.9310809f, 0.08411618f, 0.2410791f,
+	-0.89971954f, 0.1625f, 0.22771147f, -0.84983087f, 0.22980969f, 0.21029043f, -0.78481466f, 0.28145826f,
+	0.19000323f, -0.7091018f, 0.3139259f, 0.16823235f, -0.6278518f, 0.325f, 0.14646149f, -0.5466018f,
+	0.3139259f, 0.12617426f, -0.4708888f, 0.28145823f, 0.108753234f, -0.40587264f, 0.22980969f, 0.09538561f,
+	-0.35598397f, 0.16250001f, 0.08698236f, -0.32462263f, 0.08411621f, 0.084116176f, -0.3139259f, -2.8412401e-08f,
+	0.08698236f, -0.32462263f, -0.0841162f, 0.09538561f, -0.35598397f, -0.16249998f, 0.108753234f, -0.40587264f,
+	-0.22980967f, 0.12617427f, -0.47088885f, -0.28145826f, 0.14646149f, -0.5466018f, -0.3139259f, 0.16823235f,
+	-0.6278518f, -0.325f, 0.19000322f, -0.70910174f, -0.3139259f, 0.21029043f, -0.78481466f, -0.28145826f,
+	0.22771145f, -0.8498308f, -0.22980973f, 0.2410791f, -0.89971954f, -0.16250005f, 0.24948233f, -0.9310809f,
+	-0.084116116f, 0.25234854f, -0.94177765f, 5.6824803e-08f, 0.4874999f, -0.8443748f, 0.0f, 0.48196283f,
+	-0.8347843f, 0.08411618f, 0.46572903f, -0.80666655f, 0.1625f, 0.43990475f, -0.76193756f, 0.22980969f,
+	0.4062499f, -0.70364565f, 0.28145826f, 0.36705804f, -0.6357633f, 0.3139259f, 0.32499993f, -0.5629165f,
+	0.325f, 0.28294185f, -0.49006978f, 0.3139259f, 0.24374993f, -0.42218736f, 0.28145823f, 0.2100951f,
+	-0.36389548f, 0.22980969f, 0.18427084f, -0.31916654f, 0.16250001f, 0.16803701f, -0.2910487f, 0.08411621f,
+	0.16249996f, -0.28145826f, -2.8412401e-08f, 0.16803701f, -0.2910487f, -0.0841162f, 0.18427084f, -0.31916654f,
+	-0.16249998f, 0.2100951f, -0.36389548f, -0.22980967f, 0.24374996f, -0.42218742f, -0.28145826f, 0.28294185f,
+	-0.49006978f, -0.3139259f, 0.32499993f, -0.5629165f, -0.325f, 0.367058f, -0.6357632f, -0.3139259f,
+	0.4062499f, -0.70364565f, -0.28145826f, 0.43990472f, -0.7619375f, -0.22980973f, 0.46572903f, -0.80666655f,
+	-0.16250005f, 0.48196283f, -0.8347843f, -0.084116116f, 0.4874999f, -0.8443748f, 5.6824803e-08f, 0.689429f,
+	-0.68942916f, 0.0f, 0.68159837f, -0.6815986f, 0.08411618f, 0.6586403f, -0.65864056f, 0.1625f,
+	0.62211925f, -0.6221195f, 0.22980969f, 0.5745241f, -0.5745243f, 0.28145826f, 0.51909846f, -0.51909864f,
+	0.3139259f, 0.4596193f, -0.45961946f, 0.325f, 0.4001402f, -0.40014035f, 0.3139259f, 0.34471446f,
+	-0.34471458f, 0.28145823f, 0.29711935f, -0.29711944f, 0.22980969f, 0.26059833f, -0.26059842f, 0.16250001f,
+	0.23764022f, -0.2376403f, 0.08411621f, 0.22980966f, -0.22980973f, -2.8412401e-08f, 0.23764022f, -0.2376403f,
+	-0.0841162f, 0.26059833f, -0.26059842f, -0.16249998f, 0.29711935f, -0.29711944f, -0.22980967f, 0.3447145f,
+	-0.3447146f, -0.28145826f, 0.4001402f, -0.40014035f, -0.3139259f, 0.4596193f, -0.45961946f, -0.325f,
+	0.5190984f, -0.5190986f, -0.3139259f, 0.5745241f, -0.5745243f, -0.28145826f, 0.62211925f, -0.6221194f,
+	-0.22980973f, 0.6586403f, -0.65864056f, -0.16250005f, 0.68159837f, -0.6815986f, -0.084116116f, 0.689429f,
+	-0.68942916f, 5.6824803e-08f, 0.84437466f, -0.48750016f, 0.0f, 0.8347842f, -0.4819631f, 0.08411618f,
+	0.80666643f, -0.4657293f, 0.1625f, 0.76193744f, -0.439905f, 0.22980969f, 0.7036455f, -0.40625012f,
+	0.28145826f, 0.6357632f, -0.36705822f, 0.3139259f, 0.56291646f, -0.3250001f, 0.325f, 0.49006972f,
+	-0.282942f, 0.3139259f, 0.4221873f, -0.24375007f, 0.28145823f, 0.36389542f, -0.21009521f, 0.22980969f,
+	0.31916648f, -0.18427093f, 0.16250001f, 0.29104868f, -0.1680371f, 0.08411621f, 0.28145823f, -0.16250005f,
+	-2.8412401e-08f, 0.29104868f, -0.1680371f, -0.0841162f, 0.31916648f, -0.18427093f, -0.16249998f, 0.36389542f,
+	-0.21009521f, -0.22980967f, 0.42218736f, -0.2437501f, -0.28145826f, 0.49006972f, -0.282942f, -0.3139259f,
+	0.56291646f, -0.3250001f, -0.325f, 0.63576317f, -0.3670582f, -0.3139259f, 0.7036455f, -0.40625012f,
+	-0.28145826f, 0.76193744f, -0.43990496f, -0.22980973f, 0.80666643f, -0.4657293f, -0.16250005f, 0.8347842f,
+	-0.4819631f, -0.084116116f, 0.84437466f, -0.48750016f, 5.6824803e-08f, 0.9417777f, -0.25234836f, 0.0f,
+	0.9310809f, -0.24948217f, 0.08411618f, 0.8997196f, -0.24107893f, 0.1625f, 0.8498309f, -0.22771132f,
+	0.22980969f, 0.7848147f, -0.21029028f, 0.28145826f, 0.70910186f, -0.1900031f, 0.3139259f, 0.6278518f,
+	-0.16823223f, 0.325f, 0.54660183f, -0.14646138f, 0.3139259f, 0.47088882f, -0.12617417f, 0.28145823f,
+	0.40587264f, -0.10875316f, 0.22980969f, 0.355984f, -0.095385544f, 0.16250001f, 0.32462266f, -0.0869823f,
+	0.08411621f, 0.3139259f, -0.084116116f, -2.8412401e-08f, 0.32462266f, -0.0869823f, -0.0841162f, 0.355984f,
+	-0.095385544f, -0.16249998f, 0.40587264f, -0.10875316f, -0.22980967f, 0.47088888f, -0.12617418f, -0.28145826f,
+	0.54660183f, -0.14646138f, -0.3139259f, 0.6278518f, -0.16823223f, -0.325f, 0.7091018f, -0.19000308f,
+	-0.3139259f, 0.7848147f, -0.21029028f, -0.28145826f, 0.84983087f, -0.2277113f, -0.22980973f, 0.8997196f,
+	-0.24107893f, -0.16250005f, 0.9310809f, -0.24948217f, -0.084116116f, 0.9417777f, -0.25234836f, 5.6824803e-08f,
+	0.97499996f, 1.7047441e-07f, 0.0f, 0.96392584f, 1.6853815e-07f, 0.08411618f, 0.93145823f, 1.6286133e-07f,
+	0.1625f, 0.8798097f, 1.5383081e-07f, 0.22980969f, 0.81249994f, 1.42062e-07f, 0.28145826f, 0.7341162f,
+	1.2835696e-07f, 0.3139259f, 0.65f, 1.13649605e-07f, 0.325f, 0.5658838f, 9.8942266e-08f, 0.3139259f,
+	0.48749995f, 8.52372e-08f, 0.28145823f, 0.42019027f, 7.34684e-08f, 0.22980969f, 0.36854175f, 6.4437884e-08f,
+	0.16250001f, 0.33607408f, 5.876106e-08f, 0.08411621f, 0.325f, 5.6824803e-08f, -2.8412401e-08f, 0.33607408f,
+	5.876106e-08f, -0.0841162f, 0.36854175f, 6.4437884e-08f, -0.16249998f, 0.42019027f, 7.34684e-08f, -0.22980967f,
+	0.4875f, 8.523721e-08f, -0.28145826f, 0.5658838f, 9.8942266e-08f, -0.3139259f, 0.65f, 1.13649605e-07f,
+	-0.325f, 0.73411614f, 1.2835694e-07f, -0.3139259f, 0.81249994f, 1.42062e-07f, -0.28145826f, 0.8798096f,
+	1.538308e-07f, -0.22980973f, 0.93145823f, 1.6286133e-07f, -0.16250005f, 0.96392584f, 1.6853815e-07f, -0.084116116f,
+	0.97499996f, 1.7047441e-07f, 5.6824803e-08f
+};
+static const float torusNormals[1875] =
+{
+	3.0f, 0.0f, 0.0f, 2.9659257f, 0.0f, 0.25881904f, 2.8660254f, 0.0f,
+	0.5f, 2.7071068f, 0.0f, 0.70710677f, 2.5f, 0.0f, 0.86602545f, 2.258819f,
+	0.0f, 0.9659259f, 2.0f, 0.0f, 1.0f, 1.741181f, 0.0f, 0.9659259f,
+	1.4999999f, 0.0f, 0.8660253f, 1.2928932f, 0.0f, 0.70710677f, 1.1339747f, 0.0f,
+	0.50000006f, 1.0340742f, 0.0f, 0.25881913f, 1.0f, 0.0f, -8.742278e-08f, 1.0340742f,
+	0.0f, -0.25881907f, 1.1339747f, 0.0f, -0.49999994f, 1.2928932f, 0.0f, -0.7071067f,
+	1.5000001f, 0.0f, -0.86602545f, 1.741181f, 0.0f, -0.9659259f, 2.0f, 0.0f,
+	-1.0f, 2.2588189f, 0.0f, -0.9659259f, 2.5f, 0.0f, -0.86602545f, 2.7071066f,
+	0.0f, -0.7071069f, 2.8660254f, 0.0f, -0.5000002f, 2.9659257f, 0.0f, -0.25881884f,
+	3.0f, 0.0f, 1.7484555e-07f, 2.8977776f, 0.7764572f, 0.0f, 2.8648643f, 0.7676381f,
+	0.25881904f, 2.768368f, 0.741782f, 0.5f, 2.6148643f, 0.7006508f, 0.70710677f, 2.4148145f,
+	0.6470476f, 0.86602545f, 2.1818519f, 0.5846254f, 0.9659259f, 1.9318517f, 0.5176381f, 1.0f,
+	1.6818516f, 0.45065078f, 0.9659259f, 1.4488887f, 0.38822854f, 0.8660253f, 1.2488389f, 0.33462536f,
+	0.70710677f, 1.0953354f, 0.29349425f, 0.50000006f, 0.9988389f, 0.26763806f, 0.25881913f, 0.9659259f,
+	0.25881904f, -8.742278e-08f, 0.9988389f, 0.26763806f, -0.25881907f, 1.0953354f, 0.29349425f, -0.49999994f,
+	1.2488389f, 0.33462536f, -0.7071067f, 1.4488888f, 0.3882286f, -0.86602545f, 1.6818516f, 0.45065078f,
+	-0.9659259f, 1.9318517f, 0.5176381f, -1.0f, 2.1818516f, 0.58462536f, -0.9659259f, 2.4148145f,
+	0.6470476f, -0.86602545f, 2.614864f, 0.70065075f, -0.7071069f, 2.768368f, 0.741782f, -0.5000002f,
+	2.8648643f, 0.7676381f, -0.25881884f, 2.8977776f, 0.7764572f, 1.7484555e-07f, 2.598076f, 1.5f,
+	0.0f, 2.568567f, 1.4829628f, 0.25881904f, 2.482051f, 1.4330127f, 0.5f, 2.344423f,
+	1.3535534f, 0.70710677f, 2.1650634f, 1.25f, 0.86602545f, 1.9561948f, 1.1294096f, 0.9659259f,
+	1.7320507f, 1.0f, 1.0f, 1.5079069f, 0.8705905f, 0.9659259f, 1.2990379f, 0.74999994f,
+	0.8660253f, 1.1196784f, 0.6464466f, 0.70710677f, 0.98205084f, 0.56698734f, 0.50000006f, 0.8955344f,
+	0.5170371f, 0.25881913f, 0.8660253f, 0.5f, -8.742278e-08f, 0.8955344f, 0.5170371f, -0.25881907f,
+	0.98205084f, 0.56698734f, -0.49999994f, 1.1196784f, 0.6464466f, -0.7071067f, 1.2990382f, 0.75000006f,
+	-0.86602545f, 1.5079069f, 0.8705905f, -0.9659259f, 1.7320507f, 1.0f, -1.0f, 1.9561946f,
+	1.1294094f, -0.9659259f, 2.1650634f, 1.25f, -0.86602545f, 2.344423f, 1.3535533f, -0.7071069f,
+	2.482051f, 1.4330127f, -0.5000002f, 2.568567f, 1.4829628f, -0.25881884f, 2.598076f, 1.5f,
+	1.7484555e-07f, 2.1213205f, 2.1213205f, 0.0f, 2.0972261f, 2.0972261f, 0.25881904f, 2.026586f,
+	2.026586f, 0.5f, 1.9142135f, 1.9142135f, 0.70710677f, 1.767767f, 1.767767f, 0.86602545f,
+	1.5972263f, 1.5972263f, 0.9659259f, 1.4142135f, 1.4142135f, 1.0f, 1.2312009f, 1.2312009f,
+	0.9659259f, 1.0606601f, 1.0606601f, 0.8660253f, 0.9142135f, 0.9142135f, 0.70710677f, 0.80184114f,
+	0.80184114f, 0.50000006f, 0.7312008f, 0.7312008f, 0.25881913f, 0.70710677f, 0.70710677f, -8.742278e-08f,
+	0.7312008f, 0.7312008f, -0.25881907f, 0.80184114f, 0.80184114f, -0.49999994f, 0.9142135f, 0.9142135f,
+	-0.7071067f, 1.0606602f, 1.0606602f, -0.86602545f, 1.2312009f, 1.2312009f, -0.9659259f, 1.4142135f,
+	1.4142135f, -1.0f, 1.5972261f, 1.5972261f, -0.9659259f, 1.767767f, 1.767767f, -0.86602545f,
+	1.9142133f, 1.9142133f, -0.7071069f, 2.026586f, 2.026586f, -0.5000002f, 2.0972261f, 2.0972261f,
+	-0.25881884f, 2.1213205f, 2.1213205f, 1.7484555e-07f, 1.4999999f, 2.5980763f, 0.0f, 1.4829628f,
+	2.5685673f, 0.25881904f, 1.4330126f, 2.4820511f, 0.5f, 1.3535533f, 2.3444233f, 0.70710677f,
+	1.2499999f, 2.1650636f, 0.86602545f, 1.1294094f, 1.9561948f, 0.9659259f, 0.9999999f, 1.7320509f,
+	1.0f, 0.87059045f, 1.507907f, 0.9659259f, 0.7499999f, 1.299038f, 0.8660253f, 0.6464465f,
+	1.1196784f, 0.70710677f, 0.5669873f, 0.98205096f, 0.50000006f, 0.51703703f, 0.8955345f, 0.25881913f,
+	0.49999994f, 0.86602545f, -8.742278e-08f, 0.51703703f, 0.8955345f, -0.25881907f, 0.5669873f, 0.98205096f,
+	-0.49999994f, 0.6464465f, 1.1196784f, -0.7071067f, 0.75f, 1.2990383f, -0.86602545f, 0.87059045f,
+	1.507907f, -0.9659259f, 0.9999999f, 1.7320509f, -1.0f, 1.1294094f, 1.9561946f, -0.9659259f,
+	1.2499999f, 2.1650636f, -0.86602545f, 1.3535532f, 2.344423f, -0.7071069f, 1.4330126f, 2.4820511f,
+	-0.5000002f, 1.4829628f, 2.5685673f, -0.25881884f, 1.4999999f, 2.5980763f, 1.7484555e-07f, 0.77645725f,
+	2.8977776f, 0.0f, 0.76763815f, 2.8648643f, 0.25881904f, 0.741782f, 2.768368f, 0.5f,
+	0.7006509f, 2.6148643f, 0.70710677f, 0.64704764f, 2.4148145f, 0.86602545f, 0.5846255f, 2.1818519f,
+	0.9659259f, 0.51763815f, 1.9318517f, 1.0f, 0.45065087f, 1.6818516f, 0.9659259f, 0.3882286f,
+	1.4488887f, 0.8660253f, 0.33462542f, 1.2488389f, 0.70710677f, 0.29349425f, 1.0953354f, 0.50000006f,
+	0.26763812f, 0.9988389f, 0.25881913f, 0.25881907f, 0.9659259f, -8.742278e-08f, 0.26763812f, 0.9988389f,
+	-0.25881907f, 0.29349425f, 1.0953354f, -0.49999994f, 0.33462542f, 1.2488389f, -0.7071067f, 0.38822863f,
+	1.4488888f, -0.86602545f, 0.45065087f, 1.6818516f, -0.9659259f, 0.51763815f, 1.9318517f, -1.0f,
+	0.5846254f, 2.1818516f, -0.9659259f, 0.64704764f, 2.4148145f, -0.86602545f, 0.7006508f, 2.614864f,
+	-0.7071069f, 0.741782f, 2.768368f, -0.5000002f, 0.76763815f, 2.8648643f, -0.25881884f, 0.77645725f,
+	2.8977776f, 1.7484555e-07f, -1.3113416e-07f, 3.0f, 0.0f, -1.2964473e-07f, 2.9659257f, 0.25881904f,
+	-1.2527795e-07f, 2.8660254f, 0.5f, -1.183314e-07f, 2.7071068f, 0.70710677f, -1.0927847e-07f, 2.5f,
+	0.86602545f, -9.873612e-08f, 2.258819f, 0.9659259f, -8.742278e-08f, 2.0f, 1.0f, -7.610944e-08f,
+	1.741181f, 0.9659259f, -6.556708e-08f, 1.4999999f, 0.8660253f, -5.6514157e-08f, 1.2928932f, 0.70710677f,
+	-4.9567607e-08f, 1.1339747f, 0.50000006f, -4.5200817e-08f, 1.0340742f, 0.25881913f, -4.371139e-08f, 1.0f,
+	-8.742278e-08f, -4.5200817e-08f, 1.0340742f, -0.25881907f, -4.9567607e-08f, 1.1339747f, -0.49999994f, -5.6514157e-08f,
+	1.2928932f, -0.7071067f, -6.5567086e-08f, 1.5000001f, -0.86602545f, -7.610944e-08f, 1.741181f, -0.9659259f,
+	-8.742278e-08f, 2.0f, -1.0f, -9.8736116e-08f, 2.2588189f, -0.9659259f, -1.0927847e-07f, 2.5f,
+	-0.86602545f, -1.18331386e-07f, 2.7071066f, -0.7071069f, -1.2527795e-07f, 2.8660254f, -0.5000002f, -1.2964473e-07f,
+	2.9659257f, -0.25881884f, -1.3113416e-07f, 3.0f, 1.7484555e-07f, -0.7764572f, 2.8977776f, 0.0f,
+	-0.7676381f, 2.8648643f, 0.25881904f, -0.741782f, 2.768368f, 0.5f, -0.7006508f, 2.6148643f,
+	0.70710677f, -0.6470476f, 2.4148145f, 0.86602545f, -0.5846254f, 2.1818519f, 0.9659259f, -0.5176381f,
+	1.9318517f, 1.0f, -0.45065078f, 1.6818516f, 0.9659259f, -0.38822854f, 1.4488887f, 0.8660253f,
+	-0.33462536f, 1.2488389f, 0.70710677f, -0.29349425f, 1.0953354f, 0.50000006f, -0.26763806f, 0.9988389f,
+	0.25881913f, -0.25881904f, 0.9659259f, -8.742278e-08f, -0.26763806f, 0.9988389f, -0.25881907f, -0.29349425f,
+	1.0953354f, -0.49999994f, -0.33462536f, 1.2488389f, -0.7071067f, -0.3882286f, 1.4488888f, -0.86602545f,
+	-0.45065078f, 1.6818516f, -0.9659259f, -0.5176381f, 1.9318517f, -1.0f, -0.58462536f, 2.1818516f,
+	-0.9659259f, -0.6470476f, 2.4148145f, -0.86602545f, -0.70065075f, 2.614864f, -0.7071069f, -0.741782f,
+	2.768368f, -0.5000002f, -0.7676381f, 2.8648643f, -0.25881884f, -0.7764572f, 2.8977776f, 1.7484555e-07f,
+	-1.5000002f, 2.598076f, 0.0f, -1.4829631f, 2.568567f, 0.25881904f, -1.433013f, 2.482051f,
+	0.5f, -1.3535535f, 2.344423f, 0.70710677f, -1.2500001f, 2.1650634f, 0.86602545f, -1.1294097f,
+	1.9561948f, 0.9659259f, -1.0000001f, 1.7320507f, 1.0f, -0.8705906f, 1.5079069f, 0.9659259f,
+	-0.75000006f, 1.2990379f, 0.8660253f, -0.6464467f, 1.1196784f, 0.70710677f, -0.5669874f, 0.98205084f,
+	0.50000006f, -0.5170371f, 0.8955344f, 0.25881913f, -0.50000006f, 0.8660253f, -8.742278e-08f, -0.5170371f,
+	0.8955344f, -0.25881907f, -0.5669874f, 0.98205084f, -0.49999994f, -0.6464467f, 1.1196784f, -0.7071067f,
+	-0.7500001f, 1.2990382f, -0.86602545f, -0.8705906f, 1.5079069f, -0.9659259f, -1.0000001f, 1.7320507f,
+	-1.0f, -1.1294096f, 1.9561946f, -0.9659259f, -1.2500001f, 2.1650634f, -0.86602545f, -1.3535535f,
+	2.344423f, -0.7071069f, -1.433013f, 2.482051f, -0.5000002f, -1.4829631f, 2.568567f, -0.25881884f,
+	-1.5000002f, 2.598076f, 1.7484555e-07f, -2.1213205f, 2.1213205f, 0.0f, -2.0972261f, 2.0972261f,
+	0.25881904f, -2.026586f, 2.026586f, 0.5f, -1.9142135f, 1.9142135f, 0.70710677f, -1.767767f,
+	1.767767f, 0.86602545f, -1.5972263f, 1.5972263f, 0.9659259f, -1.4142135f, 1.4142135f, 1.0f,
+	-1.2312009f, 1.2312009f, 0.9659259f, -1.0606601f, 1.0606601f, 0.8660253f, -0.9142135f, 0.9142135f,
+	0.70710677f, -0.80184114f, 0.80184114f, 0.50000006f, -0.7312008f, 0.7312008f, 0.25881913f, -0.70710677f,
+	0.70710677f, -8.742278e-08f, -0.7312008f, 0.7312008f, -0.25881907f, -0.80184114f, 0.80184114f, -0.49999994f,
+	-0.9142135f, 0.9142135f, -0.7071067f, -1.0606602f, 1.0606602f, -0.86602545f, -1.2312009f, 1.2312009f,
+	-0.9659259f, -1.4142135f, 1.4142135f, -1.0f, -1.5972261f, 1.5972261f, -0.9659259f, -1.767767f,
+	1.767767f, -0.86602545f, -1.9142133f, 1.9142133f, -0.7071069f, -2.026586f, 2.026586f, -0.5000002f,
+	-2.0972261f, 2.0972261f, -0.25881884f, -2.1213205f, 2.1213205f, 1.7484555e-07f, -2.598076f, 1.5000002f,
+	0.0f, -2.568567f, 1.4829631f, 0.25881904f, -2.482051f, 1.433013f, 0.5f, -2.344423f,
+	1.3535535f, 0.70710677f, -2.1650634f, 1.2500001f, 0.86602545f, -1.9561948f, 1.1294097f, 0.9659259f,
+	-1.7320507f, 1.0000001f, 1.0f, -1.5079069f, 0.8705906f, 0.9659259f, -1.2990379f, 0.75000006f,
+	0.8660253f, -1.1196784f, 0.6464467f, 0.70710677f, -0.98205084f, 0.5669874f, 0.50000006f, -0.8955344f,
+	0.5170371f, 0.25881913f, -0.8660253f, 0.50000006f, -8.742278e-08f, -0.8955344f, 0.5170371f, -0.25881907f,
+	-0.98205084f, 0.5669874f, -0.49999994f, -1.1196784f, 0.6464467f, -0.7071067f, -1.2990382f, 0.7500001f,
+	-0.86602545f, -1.5079069f, 0.8705906f, -0.9659259f, -1.7320507f, 1.0000001f, -1.0f, -1.9561946f,
+	1.1294096f, -0.9659259f, -2.1650634f, 1.2500001f, -0.86602545f, -2.344423f, 1.3535535f, -0.7071069f,
+	-2.482051f, 1.433013f, -0.5000002f, -2.568567f, 1.4829631f, -0.25881884f, -2.598076f, 1.5000002f,
+	1.7484555e-07f, -2.8977776f, 0.77645737f, 0.0f, -2.8648643f, 0.7676383f, 0.25881904f, -2.768368f,
+	0.7417822f, 0.5f, -2.6148643f, 0.70065105f, 0.70710677f, -2.4148145f, 0.6470478f, 0.86602545f,
+	-2.1818519f, 0.5846256f, 0.9659259f, -1.9318517f, 0.51763827f, 1.0f, -1.6818516f, 0.45065096f,
+	0.9659259f, -1.4488887f, 0.38822868f, 0.8660253f, -1.2488389f, 0.3346255f, 0.70710677f, -1.0953354f,
+	0.29349434f, 0.50000006f, -0.9988389f, 0.26763818f, 0.25881913f, -0.9659259f, 0.25881913f, -8.742278e-08f,
+	-0.9988389f, 0.26763818f, -0.25881907f, -1.0953354f, 0.29349434f, -0.49999994f, -1.2488389f, 0.3346255f,
+	-0.7071067f, -1.4488888f, 0.3882287f, -0.86602545f, -1.6818516f, 0.45065096f, -0.9659259f, -1.9318517f,
+	0.51763827f, -1.0f, -2.1818516f, 0.5846256f, -0.9659259f, -2.4148145f, 0.6470478f, -0.86602545f,
+	-2.614864f, 0.700651f, -0.7071069f, -2.768368f, 0.7417822f, -0.5000002f, -2.8648643f, 0.7676383f,
+	-0.25881884f, -2.8977776f, 0.77645737f, 1.7484555e-07f, -3.0f, -2.6226832e-07f, 0.0f, -2.9659257f,
+	-2.5928946e-07f, 0.25881904f, -2.8660254f, -2.505559e-07f, 0.5f, -2.7071068f, -2.366628e-07f, 0.70710677f,
+	-2.5f, -2.1855693e-07f, 0.86602545f, -2.258819f, -1.9747225e-07f, 0.9659259f, -2.0f, -1.7484555e-07f,
+	1.0f, -1.741181f, -1.5221887e-07f, 0.9659259f, -1.4999999f, -1.3113416e-07f, 0.8660253f, -1.2928932f,
+	-1.13028314e-07f, 0.70710677f, -1.1339747f, -9.9135214e-08f, 0.50000006f, -1.0340742f, -9.0401635e-08f, 0.25881913f,
+	-1.0f, -8.742278e-08f, -8.742278e-08f, -1.0340742f, -9.0401635e-08f, -0.25881907f, -1.1339747f, -9.9135214e-08f,
+	-0.49999994f, -1.2928932f, -1.13028314e-07f, -0.7071067f, -1.5000001f, -1.3113417e-07f, -0.86602545f, -1.741181f,
+	-1.5221887e-07f, -0.9659259f, -2.0f, -1.7484555e-07f, -1.0f, -2.2588189f, -1.9747223e-07f, -0.9659259f,
+	-2.5f, -2.1855693e-07f, -0.86602545f, -2.7071066f, -2.3666277e-07f, -0.7071069f, -2.8660254f, -2.505559e-07f,
+	-0.5000002f, -2.9659257f, -2.5928946e-07f, -0.25881884f, -3.0f, -2.6226832e-07f, 1.7484555e-07f, -2.8977776f,
+	-0.77645725f, 0.0f, -2.8648643f, -0.76763815f, 0.25881904f, -2.768368f, -0.741782f, 0.5f,
+	-2.6148643f, -0.7006509f, 0.70710677f, -2.4148145f, -0.64704764f, 0.86602545f, -2.1818519f, -0.5846255f,
+	0.9659259f, -1.9318517f, -0.51763815f, 1.0f, -1.6818516f, -0.45065087f, 0.9659259f, -1.4488887f,
+	-0.3882286f, 0.8660253f, -1.2488389f, -0.33462542f, 0.70710677f, -1.0953354f, -0.29349425f, 0.50000006f,
+	-0.9988389f, -0.26763812f, 0.25881913f, -0.9659259f, -0.25881907f, -8.742278e-08f, -0.9988389f, -0.26763812f,
+	-0.25881907f, -1.0953354f, -0.29349425f, -0.49999994f, -1.2488389f, -0.33462542f, -0.7071067f, -1.4488888f,
+	-0.38822863f, -0.86602545f, -1.6818516f, -0.45065087f, -0.9659259f, -1.9318517f, -0.51763815f, -1.0f,
+	-2.1818516f, -0.5846254f, -0.9659259f, -2.4148145f, -0.64704764f, -0.86602545f, -2.614864f, -0.7006508f,
+	-0.7071069f, -2.768368f, -0.741782f, -0.5000002f, -2.8648643f, -0.76763815f, -0.25881884f, -2.8977776f,
+	-0.77645725f, 1.7484555e-07f, -2.598076f, -1.4999999f, 0.0f, -2.568567f, -1.4829628f, 0.25881904f,
+	-2.482051f, -1.4330126f, 0.5f, -2.344423f, -1.3535533f, 0.70710677f, -2.1650634f, -1.2499999f,
+	0.86602545f, -1.9561948f, -1.1294094f, 0.9659259f, -1.7320507f, -0.9999999f, 1.0f, -1.5079069f,
+	-0.87059045f, 0.9659259f, -1.2990379f, -0.7499999f, 0.8660253f, -1.1196784f, -0.6464465f, 0.70710677f,
+	-0.98205084f, -0.5669873f, 0.50000006f, -0.8955344f, -0.51703703f, 0.25881913f, -0.8660253f, -0.49999994f,
+	-8.742278e-08f, -0.8955344f, -0.51703703f, -0.25881907f, -0.98205084f, -0.5669873f, -0.49999994f, -1.1196784f,
+	-0.6464465f, -0.7071067f, -1.2990382f, -0.75f, -0.86602545f, -1.5079069f, -0.87059045f, -0.9659259f,
+	-1.7320507f, -0.9999999f, -1.0f, -1.9561946f, -1.1294094f, -0.9659259f, -2.1650634f, -1.2499999f,
+	-0.86602545f, -2.344423f, -1.3535532f, -0.7071069f, -2.482051f, -1.4330126f, -0.5000002f, -2.568567f,
+	-1.4829628f, -0.25881884f, -2.598076f, -1.4999999f, 1.7484555e-07f, -2.1213205f, -2.1213202f, 0.0f,
+	-2.0972264f, -2.097226f, 0.25881904f, -2.0265863f, -2.0265858f, 0.5f, -1.9142137f, -1.9142133f,
+	0.70710677f, -1.7677671f, -1.7677667f, 0.86602545f, -1.5972265f, -1.5972261f, 0.9659259f, -1.4142137f,
+	-1.4142134f, 1.0f, -1.231201f, -1.2312008f, 0.9659259f, -1.0606602f, -1.06066f, 0.8660253f,
+	-0.9142136f, -0.9142134f, 0.70710677f, -0.80184126f, -0.801841f, 0.50000006f, -0.7312009f, -0.7312008f,
+	0.25881913f, -0.7071068f, -0.7071067f, -8.742278e-08f, -0.7312009f, -0.7312008f, -0.25881907f, -0.80184126f,
+	-0.801841f, -0.49999994f, -0.9142136f, -0.9142134f, -0.7071067f, -1.0606602f, -1.0606601f, -0.86602545f,
+	-1.231201f, -1.2312008f, -0.9659259f, -1.4142137f, -1.4142134f, -1.0f, -1.5972263f, -1.5972261f,
+	-0.9659259f, -1.7677671f, -1.7677667f, -0.86602545f, -1.9142135f, -1.9142133f, -0.7071069f, -2.0265863f,
+	-2.0265858f, -0.5000002f, -2.0972264f, -2.097226f, -0.25881884f, -2.1213205f, -2.1213202f, 1.7484555e-07f,
+	-1.4999998f, -2.5980763f, 0.0f, -1.4829626f, -2.5685673f, 0.25881904f, -1.4330125f, -2.4820511f,
+	0.5f, -1.3535532f, -2.3444233f, 0.70710677f, -1.2499998f, -2.1650636f, 0.86602545f, -1.1294094f,
+	-1.9561948f, 0.9659259f, -0.9999998f, -1.7320509f, 1.0f, -0.8705903f, -1.507907f, 0.9659259f,
+	-0.7499998f, -1.299038f, 0.8660253f, -0.64644647f, -1.1196784f, 0.70710677f, -0.5669872f, -0.98205096f,
+	0.50000006f, -0.517037f, -0.8955345f, 0.25881913f, -0.4999999f, -0.86602545f, -8.742278e-08f, -0.517037f,
+	-0.8955345f, -0.25881907f, -0.5669872f, -0.98205096f, -0.49999994f, -0.64644647f, -1.1196784f, -0.7071067f,
+	-0.7499999f, -1.2990383f, -0.86602545f, -0.8705903f, -1.507907f, -0.9659259f, -0.9999998f, -1.7320509f,
+	-1.0f, -1.1294093f, -1.9561946f, -0.9659259f, -1.2499998f, -2.1650636f, -0.86602545f, -1.353553f,
+	-2.344423f, -0.7071069f, -1.4330125f, -2.4820511f, -0.5000002f, -1.4829626f, -2.5685673f, -0.25881884f,
+	-1.4999998f, -2.5980763f, 1.7484555e-07f, -0.776457f, -2.8977776f, 0.0f, -0.7676379f, -2.8648643f,
+	0.25881904f, -0.74178183f, -2.768368f, 0.5f, -0.70065063f, -2.6148646f, 0.70710677f, -0.6470474f,
+	-2.4148147f, 0.86602545f, -0.58462524f, -2.1818519f, 0.9659259f, -0.51763797f, -1.9318517f, 1.0f,
+	-0.4506507f, -1.6818519f, 0.9659259f, -0.38822845f, -1.4488888f, 0.8660253f, -0.3346253f, -1.2488389f,
+	0.70710677f, -0.29349416f, -1.0953355f, 0.50000006f, -0.26763803f, -0.998839f, 0.25881913f, -0.25881898f,
+	-0.9659259f, -8.742278e-08f, -0.26763803f, -0.998839f, -0.25881907f, -0.29349416f, -1.0953355f, -0.49999994f,
+	-0.3346253f, -1.2488389f, -0.7071067f, -0.3882285f, -1.4488889f, -0.86602545f, -0.4506507f, -1.6818519f,
+	-0.9659259f, -0.51763797f, -1.9318517f, -1.0f, -0.5846252f, -2.1818519f, -0.9659259f, -0.6470474f,
+	-2.4148147f, -0.86602545f, -0.7006506f, -2.6148643f, -0.7071069f, -0.74178183f, -2.768368f, -0.5000002f,
+	-0.7676379f, -2.8648643f, -0.25881884f, -0.776457f, -2.8977776f, 1.7484555e-07f, 3.5774644e-08f, -3.0f,
+	0.0f, 3.536831e-08f, -2.9659257f, 0.25881904f, 3.417701e-08f, -2.8660254f, 0.5f, 3.2281925e-08f,
+	-2.7071068f, 0.70710677f, 2.9812202e-08f, -2.5f, 0.86602545f, 2.693615e-08f, -2.258819f, 0.9659259f,
+	2.3849761e-08f, -2.0f, 1.0f, 2.0763375e-08f, -1.741181f, 0.9659259f, 1.788732e-08f, -1.4999999f,
+	0.8660253f, 1.5417598e-08f, -1.2928932f, 0.70710677f, 1.3522513e-08f, -1.1339747f, 0.50000006f, 1.2331212e-08f,
+	-1.0340742f, 0.25881913f, 1.1924881e-08f, -1.0f, -8.742278e-08f, 1.2331212e-08f, -1.0340742f, -0.25881907f,
+	1.3522513e-08f, -1.1339747f, -0.49999994f, 1.5417598e-08f, -1.2928932f, -0.7071067f, 1.7887322e-08f, -1.5000001f,
+	-0.86602545f, 2.0763375e-08f, -1.741181f, -0.9659259f, 2.3849761e-08f, -2.0f, -1.0f, 2.6936146e-08f,
+	-2.2588189f, -0.9659259f, 2.9812202e-08f, -2.5f, -0.86602545f, 3.228192e-08f, -2.7071066f, -0.7071069f,
+	3.417701e-08f, -2.8660254f, -0.5000002f, 3.536831e-08f, -2.9659257f, -0.25881884f, 3.5774644e-08f, -3.0f,
+	1.7484555e-07f, 0.7764571f, -2.8977776f, 0.0f, 0.76763797f, -2.8648643f, 0.25881904f, 0.7417819f,
+	-2.768368f, 0.5f, 0.7006507f, -2.6148643f, 0.70710677f, 0.6470475f, -2.4148145f, 0.86602545f,
+	0.58462536f, -2.1818519f, 0.9659259f, 0.517638f, -1.9318517f, 1.0f, 0.45065075f, -1.6818516f,
+	0.9659259f, 0.3882285f, -1.4488887f, 0.8660253f, 0.33462533f, -1.2488389f, 0.70710677f, 0.2934942f,
+	-1.0953354f, 0.50000006f, 0.26763806f, -0.9988389f, 0.25881913f, 0.258819f, -0.9659259f, -8.742278e-08f,
+	0.26763806f, -0.9988389f, -0.25881907f, 0.2934942f, -1.0953354f, -0.49999994f, 0.33462533f, -1.2488389f,
+	-0.7071067f, 0.38822854f, -1.4488888f, -0.86602545f, 0.45065075f, -1.6818516f, -0.9659259f, 0.517638f,
+	-1.9318517f, -1.0f, 0.5846253f, -2.1818516f, -0.9659259f, 0.6470475f, -2.4148145f, -0.86602545f,
+	0.70065063f, -2.614864f, -0.7071069f, 0.7417819f, -2.768368f, -0.5000002f, 0.76763797f, -2.8648643f,
+	-0.25881884f, 0.7764571f, -2.8977776f, 1.7484555e-07f, 1.4999998f, -2.5980763f, 0.0f, 1.4829626f,
+	-2.5685673f, 0.25881904f, 1.4330125f, -2.4820511f, 0.5f, 1.3535532f, -2.3444233f, 0.70710677f,
+	1.2499998f, -2.1650636f, 0.86602545f, 1.1294094f, -1.9561948f, 0.9659259f, 0.9999998f, -1.7320509f,
+	1.0f, 0.8705903f, -1.507907f, 0.9659259f, 0.7499998f, -1.299038f, 0.8660253f, 0.64644647f,
+	-1.1196784f, 0.70710677f, 0.5669872f, -0.98205096f, 0.50000006f, 0.517037f, -0.8955345f, 0.25881913f,
+	0.4999999f, -0.86602545f, -8.742278e-08f, 0.517037f, -0.8955345f, -0.25881907f, 0.5669872f, -0.98205096f,
+	-0.49999994f, 0.64644647f, -1.1196784f, -0.7071067f, 0.7499999f, -1.2990383f, -0.86602545f, 0.8705903f,
+	-1.507907f, -0.9659259f, 0.9999998f, -1.7320509f, -1.0f, 1.1294093f, -1.9561946f, -0.9659259f,
+	1.2499998f, -2.1650636f, -0.86602545f, 1.353553f, -2.344423f, -0.7071069f, 1.4330125f, -2.4820511f,
+	-0.5000002f, 1.4829626f, -2.5685673f, -0.25881884f, 1.4999998f, -2.5980763f, 1.7484555e-07f, 2.12132f,
+	-2.1213205f, 0.0f, 2.097226f, -2.0972266f, 0.25881904f, 2.0265856f, -2.0265865f, 0.5f,
+	1.9142132f, -1.9142139f, 0.70710677f, 1.7677666f, -1.7677671f, 0.86602545f, 1.5972261f, -1.5972266f,
+	0.9659259f, 1.4142133f, -1.4142138f, 1.0f, 1.2312007f, -1.231201f, 0.9659259f, 1.0606599f,
+	-1.0606602f, 0.8660253f, 0.9142134f, -0.9142137f, 0.70710677f, 0.801841f, -0.8018413f, 0.50000006f,
+	0.7312007f, -0.731201f, 0.25881913f, 0.70710665f, -0.7071069f, -8.742278e-08f, 0.7312007f, -0.731201f,
+	-0.25881907f, 0.801841f, -0.8018413f, -0.49999994f, 0.9142134f, -0.9142137f, -0.7071067f, 1.06066f,
+	-1.0606604f, -0.86602545f, 1.2312007f, -1.231201f, -0.9659259f, 1.4142133f, -1.4142138f, -1.0f,
+	1.5972259f, -1.5972265f, -0.9659259f, 1.7677666f, -1.7677671f, -0.86602545f, 1.9142132f, -1.9142137f,
+	-0.7071069f, 2.0265856f, -2.0265865f, -0.5000002f, 2.097226f, -2.0972266f, -0.25881884f, 2.12132f,
+	-2.1213205f, 1.7484555e-07f, 2.5980759f, -1.5000006f, 0.0f, 2.5685668f, -1.4829634f, 0.25881904f,
+	2.4820507f, -1.4330133f, 0.5f, 2.344423f, -1.3535539f, 0.70710677f, 2.1650631f, -1.2500004f,
+	0.86602545f, 1.9561946f, -1.1294099f, 0.9659259f, 1.7320507f, -1.0000004f, 1.0f, 1.5079069f,
+	-0.8705908f, 0.9659259f, 1.2990379f, -0.75000024f, 0.8660253f, 1.1196783f, -0.6464468f, 0.70710677f,
+	0.9820508f, -0.5669875f, 0.50000006f, 0.8955344f, -0.5170373f, 0.25881913f, 0.8660253f, -0.5000002f,
+	-8.742278e-08f, 0.8955344f, -0.5170373f, -0.25881907f, 0.9820508f, -0.5669875f, -0.49999994f, 1.1196783f,
+	-0.6464468f, -0.7071067f, 1.299038f, -0.7500003f, -0.86602545f, 1.5079069f, -0.8705908f, -0.9659259f,
+	1.7320507f, -1.0000004f, -1.0f, 1.9561944f, -1.1294099f, -0.9659259f, 2.1650631f, -1.2500004f,
+	-0.86602545f, 2.344423f, -1.3535538f, -0.7071069f, 2.4820507f, -1.4330133f, -0.5000002f, 2.5685668f,
+	-1.4829634f, -0.25881884f, 2.5980759f, -1.5000006f, 1.7484555e-07f, 2.8977776f, -0.77645653f, 0.0f,
+	2.8648643f, -0.7676375f, 0.25881904f, 2.768368f, -0.74178135f, 0.5f, 2.6148646f, -0.7006502f,
+	0.70710677f, 2.4148147f, -0.64704704f, 0.86602545f, 2.1818519f, -0.58462495f, 0.9659259f, 1.9318517f,
+	-0.51763767f, 1.0f, 1.6818519f, -0.45065042f, 0.9659259f, 1.4488888f, -0.3882282f, 0.8660253f,
+	1.2488389f, -0.33462512f, 0.70710677f, 1.0953355f, -0.293494f, 0.50000006f, 0.998839f, -0.26763785f,
+	0.25881913f, 0.9659259f, -0.25881884f, -8.742278e-08f, 0.998839f, -0.26763785f, -0.25881907f, 1.0953355f,
+	-0.293494f, -0.49999994f, 1.2488389f, -0.33462512f, -0.7071067f, 1.4488889f, -0.38822827f, -0.86602545f,
+	1.6818519f, -0.45065042f, -0.9659259f, 1.9318517f, -0.51763767f, -1.0f, 2.1818519f, -0.5846249f,
+	-0.9659259f, 2.4148147f, -0.64704704f, -0.86602545f, 2.6148643f, -0.7006502f, -0.7071069f, 2.768368f,
+	-0.74178135f, -0.5000002f, 2.8648643f, -0.7676375f, -0.25881884f, 2.8977776f, -0.77645653f, 1.7484555e-07f,
+	3.0f, 5.2453663e-07f, 0.0f, 2.9659257f, 5.1857893e-07f, 0.25881904f, 2.8660254f, 5.011118e-07f,
+	0.5f, 2.7071068f, 4.733256e-07f, 0.70710677f, 2.5f, 4.3711387e-07f, 0.86602545f, 2.258819f,
+	3.949445e-07f, 0.9659259f, 2.0f, 3.496911e-07f, 1.0f, 1.741181f, 3.0443775e-07f, 0.9659259f,
+	1.4999999f, 2.6226832e-07f, 0.8660253f, 1.2928932f, 2.2605663e-07f, 0.70710677f, 1.1339747f, 1.9827043e-07f,
+	0.50000006f, 1.0340742f, 1.8080327e-07f, 0.25881913f, 1.0f, 1.7484555e-07f, -8.742278e-08f, 1.0340742f,
+	1.8080327e-07f, -0.25881907f, 1.1339747f, 1.9827043e-07f, -0.49999994f, 1.2928932f, 2.2605663e-07f, -0.7071067f,
+	1.5000001f, 2.6226834e-07f, -0.86602545f, 1.741181f, 3.0443775e-07f, -0.9659259f, 2.0f, 3.496911e-07f,
+	-1.0f, 2.2588189f, 3.9494446e-07f, -0.9659259f, 2.5f, 4.3711387e-07f, -0.86602545f, 2.7071066f,
+	4.7332554e-07f, -0.7071069f, 2.8660254f, 5.011118e-07f, -0.5000002f, 2.9659257f, 5.1857893e-07f, -0.25881884f,
+	3.0f, 5.2453663e-07f, 1.7484555e-07f
+};
+static const float torusTexCoords[1250] =
+{
+	0.0f, 1.0f, 0.0f, 0.9583333f, 0.0f, 0.9166667f, 0.0f, 0.875f,
+	0.0f, 0.8333333f, 0.0f, 0.7916666f, 0.0f, 0.75f, 0.0f, 0.7083333f,
+	0.0f, 0.6666666f, 0.0f, 0.625f, 0.0f, 0.5833333f, 0.0f, 0.5416666f,
+	0.0f, 0.5f, 0.0f, 0.4583333f, 0.0f, 0.41666663f, 0.0f, 0.375f,
+	0.0f, 0.3333333f, 0.0f, 0.29166663f, 0.0f, 0.25f, 0.0f, 0.20833331f,
+	0.0f, 0.16666663f, 0.0f, 0.125f, 0.0f, 0.08333331f, 0.0f, 0.041666627f,
+	0.0f, 0.0f, 0.041666668f, 1.0f, 0.041666668f, 0.9583333f, 0.041666668f, 0.9166667f,
+	0.041666668f, 0.875f, 0.041666668f, 0.8333333f, 0.041666668f, 0.7916666f, 0.041666668f, 0.75f,
+	0.041666668f, 0.7083333f, 0.041666668f, 0.6666666f, 0.041666668f, 0.625f, 0.041666668f, 0.5833333f,
+	0.041666668f, 0.5416666f, 0.041666668f, 0.5f, 0.041666668f, 0.4583333f, 0.041666668f, 0.41666663f,
+	0.041666668f, 0.375f, 0.041666668f, 0.3333333f, 0.041666668f, 0.29166663f, 0.041666668f, 0.25f,
+	0.041666668f, 0.20833331f, 0.041666668f, 0.16666663f, 0.041666668f, 0.125f, 0.041666668f, 0.08333331f,
+	0.041666668f, 0.041666627f, 0.041666668f, 0.0f, 0.083333336f, 1.0f, 0.083333336f, 0.9583333f,
+	0.083333336f, 0.9166667f, 0.083333336f, 0.875f, 0.083333336f, 0.8333333f, 0.083333336f, 0.7916666f,
+	0.083333336f, 0.75f, 0.083333336f, 0.7083333f, 0.083333336f, 0.6666666f, 0.083333336f, 0.625f,
+	0.083333336f, 0.5833333f, 0.083333336f, 0.5416666f, 0.083333336f, 0.5f, 0.083333336f, 0.4583333f,
+	0.083333336f, 0.41666663f, 0.083333336f, 0.375f, 0.083333336f, 0.3333333f, 0.083333336f, 0.29166663f,
+	0.083333336f, 0.25f, 0.083333336f, 0.20833331f, 0.083333336f, 0.16666663f, 0.083333336f, 0.125f,
+	0.083333336f, 0.08333331f, 0.083333336f, 0.041666627f, 0.083333336f, 0.0f, 0.125f, 1.0f,
+	0.125f, 0.9583333f, 0.125f, 0.9166667f, 0.125f, 0.875f, 0.125f, 0.8333333f,
+	0.125f, 0.7916666f, 0.125f, 0.75f, 0.125f, 0.7083333f, 0.125f, 0.6666666f,
+	0.125f, 0.625f, 0.125f, 0.5833333f, 0.125f, 0.5416666f, 0.125f, 0.5f,
+	0.125f, 0.4583333f, 0.125f, 0.41666663f, 0.125f, 0.375f, 0.125f, 0.3333333f,
+	0.125f, 0.29166663f, 0.125f, 0.25f, 0.125f, 0.20833331f, 0.125f, 0.16666663f,
+	0.125f, 0.125f, 0.125f, 0.08333331f, 0.125f, 0.041666627f, 0.125f, 0.0f,
+	0.16666667f, 1.0f, 0.16666667f, 0.9583333f, 0.16666667f, 0.9166667f, 0.16666667f, 0.875f,
+	0.16666667f, 0.8333333f, 0.16666667f, 0.7916666f, 0.16666667f, 0.75f, 0.16666667f, 0.7083333f,
+	0.16666667f, 0.6666666f, 0.16666667f, 0.625f, 0.16666667f, 0.5833333f, 0.16666667f, 0.5416666f,
+	0.16666667f, 0.5f, 0.16666667f, 0.4583333f, 0.16666667f, 0.41666663f, 0.16666667f, 0.375f,
+	0.16666667f, 0.3333333f, 0.16666667f, 0.29166663f, 0.16666667f, 0.25f, 0.16666667f, 0.20833331f,
+	0.16666667f, 0.16666663f, 0.16666667f, 0.125f, 0.16666667f, 0.08333331f, 0.16666667f, 0.041666627f,
+	0.16666667f, 0.0f, 0.20833333f, 1.0f, 0.20833333f, 0.9583333f, 0.20833333f, 0.9166667f,
+	0.20833333f, 0.875f, 0.20833333f, 0.8333333f, 0.20833333f, 0.7916666f, 0.20833333f, 0.75f,
+	0.20833333f, 0.7083333f, 0.20833333f, 0.6666666f, 0.20833333f, 0.625f, 0.20833333f, 0.5833333f,
+	0.20833333f, 0.5416666f, 0.20833333f, 0.5f, 0.20833333f, 0.4583333f, 0.20833333f, 0.41666663f,
+	0.20833333f, 0.375f, 0.20833333f, 0.3333333f, 0.20833333f, 0.29166663f, 0.20833333f, 0.25f,
+	0.20833333f, 0.20833331f, 0.20833333f, 0.16666663f, 0.20833333f, 0.125f, 0.20833333f, 0.08333331f,
+	0.20833333f, 0.041666627f, 0.20833333f, 0.0f, 0.25f, 1.0f, 0.25f, 0.9583333f,
+	0.25f, 0.9166667f, 0.25f, 0.875f, 0.25f, 0.8333333f, 0.25f, 0.7916666f,
+	0.25f, 0.75f, 0.25f, 0.7083333f, 0.25f, 0.6666666f, 0.25f, 0.625f,
+	0.25f, 0.5833333f, 0.25f, 0.5416666f, 0.25f, 0.5f, 0.25f, 0.4583333f,
+	0.25f, 0.41666663f, 0.25f, 0.375f, 0.25f, 0.3333333f, 0.25f, 0.29166663f,
+	0.25f, 0.25f, 0.25f, 0.20833331f, 0.25f, 0.16666663f, 0.25f, 0.125f,
+	0.25f, 0.08333331f, 0.25f, 0.041666627f, 0.25f, 0.0f, 0.29166666f, 1.0f,
+	0.29166666f, 0.9583333f, 0.29166666f, 0.9166667f, 0.29166666f, 0.875f, 0.29166666f, 0.8333333f,
+	0.29166666f, 0.7916666f, 0.29166666f, 0.75f, 0.29166666f, 0.7083333f, 0.29166666f, 0.6666666f,
+	0.29166666f, 0.625f, 0.29166666f, 0.5833333f, 0.29166666f, 0.5416666f, 0.29166666f, 0.5f,
+	0.29166666f, 0.4583333f, 0.29166666f, 0.41666663f, 0.29166666f, 0.375f, 0.29166666f, 0.3333333f,
+	0.29166666f, 0.29166663f, 0.29166666f, 0.25f, 0.29166666f, 0.20833331f, 0.29166666f, 0.16666663f,
+	0.29166666f, 0.125f, 0.29166666f, 0.08333331f, 0.29166666f, 0.041666627f, 0.29166666f, 0.0f,
+	0.33333334f, 1.0f, 0.33333334f, 0.9583333f, 0.33333334f, 0.9166667f, 0.33333334f, 0.875f,
+	0.33333334f, 0.8333333f, 0.33333334f, 0.7916666f, 0.33333334f, 0.75f, 0.33333334f, 0.7083333f,
+	0.33333334f, 0.6666666f, 0.33333334f, 0.625f, 0.33333334f, 0.5833333f, 0.33333334f, 0.5416666f,
+	0.33333334f, 0.5f, 0.33333334f, 0.4583333f, 0.33333334f, 0.41666663f, 0.33333334f, 0.375f,
+	0.33333334f, 0.3333333f, 0.33333334f, 0.29166663f, 0.33333334f, 0.25f, 0.33333334f, 0.20833331f,
+	0.33333334f, 0.16666663f, 0.33333334f, 0.125f, 0.33333334f, 0.08333331f, 0.33333334f, 0.041666627f,
+	0.33333334f, 0.0f, 0.375f, 1.0f, 0.375f, 0.9583333f, 0.375f, 0.9166667f,
+	0.375f, 0.875f, 0.375f, 0.8333333f, 0.375f, 0.7916666f, 0.375f, 0.75f,
+	0.375f, 0.7083333f, 0.375f, 0.6666666f, 0.375f, 0.625f, 0.375f, 0.5833333f,
+	0.375f, 0.5416666f, 0.375f, 0.5f, 0.375f, 0.4583333f, 0.375f, 0.41666663f,
+	0.375f, 0.375f, 0.375f, 0.3333333f, 0.375f, 0.29166663f, 0.375f, 0.25f,
+	0.375f, 0.20833331f, 0.375f, 0.16666663f, 0.375f, 0.125f, 0.375f, 0.08333331f,
+	0.375f, 0.041666627f, 0.375f, 0.0f, 0.41666666f, 1.0f, 0.41666666f, 0.9583333f,
+	0.41666666f, 0.9166667f, 0.41666666f, 0.875f, 0.41666666f, 0.8333333f, 0.41666666f, 0.7916666f,
+	0.41666666f, 0.75f, 0.41666666f, 0.7083333f, 0.41666666f, 0.6666666f, 0.41666666f, 0.625f,
+	0.41666666f, 0.5833333f, 0.41666666f, 0.5416666f, 0.41666666f, 0.5f, 0.41666666f, 0.4583333f,
+	0.41666666f, 0.41666663f, 0.41666666f, 0.375f, 0.41666666f, 0.3333333f, 0.41666666f, 0.29166663f,
+	0.41666666f, 0.25f, 0.41666666f, 0.20833331f, 0.41666666f, 0.16666663f, 0.41666666f, 0.125f,
+	0.41666666f, 0.08333331f, 0.41666666f, 0.041666627f, 0.41666666f, 0.0f, 0.45833334f, 1.0f,
+	0.45833334f, 0.9583333f, 0.45833334f, 0.9166667f, 0.45833334f, 0.875f, 0.45833334f, 0.8333333f,
+	0.45833334f, 0.7916666f, 0.45833334f, 0.75f, 0.45833334f, 0.7083333f, 0.45833334f, 0.6666666f,
+	0.45833334f, 0.625f, 0.45833334f, 0.5833333f, 0.45833334f, 0.5416666f, 0.45833334f, 0.5f,
+	0.45833334f, 0.4583333f, 0.45833334f, 0.41666663f, 0.45833334f, 0.375f, 0.45833334f, 0.3333333f,
+	0.45833334f, 0.29166663f, 0.45833334f, 0.25f, 0.45833334f, 0.20833331f, 0.45833334f, 0.16666663f,
+	0.45833334f, 0.125f, 0.45833334f, 0.08333331f, 0.45833334f, 0.041666627f, 0.45833334f, 0.0f,
+	0.5f, 1.0f, 0.5f, 0.9583333f, 0.5f, 0.9166667f, 0.5f, 0.875f,
+	0.5f, 0.8333333f, 0.5f, 0.7916666f, 0.5f, 0.75f, 0.5f, 0.7083333f,
+	0.5f, 0.6666666f, 0.5f, 0.625f, 0.5f, 0.5833333f, 0.5f, 0.5416666f,
+	0.5f, 0.5f, 0.5f, 0.4583333f, 0.5f, 0.41666663f, 0.5f, 0.375f,
+	0.5f, 0.3333333f, 0.5f, 0.29166663f, 0.5f, 0.25f, 0.5f, 0.20833331f,
+	0.5f, 0.16666663f, 0.5f, 0.125f, 0.5f, 0.08333331f, 0.5f, 0.041666627f,
+	0.5f, 0.0f, 0.5416667f, 1.0f, 0.5416667f, 0.9583333f, 0.5416667f, 0.9166667f,
+	0.5416667f, 0.875f, 0.5416667f, 0.8333333f, 0.5416667f, 0.7916666f, 0.5416667f, 0.75f,
+	0.5416667f, 0.7083333f, 0.5416667f, 0.6666666f, 0.5416667f, 0.625f, 0.5416667f, 0.5833333f,
+	0.5416667f, 0.5416666f, 0.5416667f, 0.5f, 0.5416667f, 0.4583333f, 0.5416667f, 0.41666663f,
+	0.5416667f, 0.375f, 0.5416667f, 0.3333333f, 0.5416667f, 0.29166663f, 0.5416667f, 0.25f,
+	0.5416667f, 0.20833331f, 0.5416667f, 0.16666663f, 0.5416667f, 0.125f, 0.5416667f, 0.08333331f,
+	0.5416667f, 0.041666627f, 0.5416667f, 0.0f, 0.5833333f, 1.0f, 0.5833333f, 0.9583333f,
+	0.5833333f, 0.9166667f, 0.5833333f, 0.875f, 0.5833333f, 0.8333333f, 0.5833333f, 0.7916666f,
+	0.5833333f, 0.75f, 0.5833333f, 0.7083333f, 0.5833333f, 0.6666666f, 0.5833333f, 0.625f,
+	0.5833333f, 0.5833333f, 0.5833333f, 0.5416666f, 0.5833333f, 0.5f, 0.5833333f, 0.4583333f,
+	0.5833333f, 0.41666663f, 0.5833333f, 0.375f, 0.5833333f, 0.3333333f, 0.5833333f, 0.29166663f,
+	0.5833333f, 0.25f, 0.5833333f, 0.20833331f, 0.5833333f, 0.16666663f, 0.5833333f, 0.125f,
+	0.5833333f, 0.08333331f, 0.5833333f, 0.041666627f, 0.5833333f, 0.0f, 0.625f, 1.0f,
+	0.625f, 0.9583333f, 0.625f, 0.9166667f, 0.625f, 0.875f, 0.625f, 0.8333333f,
+	0.625f, 0.7916666f, 0.625f, 0.75f, 0.625f, 0.7083333f, 0.625f, 0.6666666f,
+	0.625f, 0.625f, 0.625f, 0.5833333f, 0.625f, 0.5416666f, 0.625f, 0.5f,
+	0.625f, 0.4583333f, 0.625f, 0.41666663f, 0.625f, 0.375f, 0.625f, 0.3333333f,
+	0.625f, 0.29166663f, 0.625f, 0.25f, 0.625f, 0.20833331f, 0.625f, 0.16666663f,
+	0.625f, 0.125f, 0.625f, 0.08333331f, 0.625f, 0.041666627f, 0.625f, 0.0f,
+	0.6666667f, 1.0f, 0.6666667f, 0.9583333f, 0.6666667f, 0.9166667f, 0.6666667f, 0.875f,
+	0.6666667f, 0.8333333f, 0.6666667f, 0.7916666f, 0.6666667f, 0.75f, 0.6666667f, 0.7083333f,
+	0.6666667f, 0.6666666f, 0.6666667f, 0.625f, 0.6666667f, 0.5833333f, 0.6666667f, 0.5416666f,
+	0.6666667f, 0.5f, 0.6666667f, 0.4583333f, 0.6666667f, 0.41666663f, 0.6666667f, 0.375f,
+	0.6666667f, 0.3333333f, 0.6666667f, 0.29166663f, 0.6666667f, 0.25f, 0.6666667f, 0.20833331f,
+	0.6666667f, 0.16666663f, 0.6666667f, 0.125f, 0.6666667f, 0.08333331f, 0.6666667f, 0.041666627f,
+	0.6666667f, 0.0f, 0.7083333f, 1.0f, 0.7083333f, 0.9583333f, 0.7083333f, 0.9166667f,
+	0.7083333f, 0.875f, 0.7083333f, 0.8333333f, 0.7083333f, 0.7916666f, 0.7083333f, 0.75f,
+	0.7083333f, 0.7083333f, 0.7083333f, 0.6666666f, 0.7083333f, 0.625f, 0.7083333f, 0.5833333f,
+	0.7083333f, 0.5416666f, 0.7083333f, 0.5f, 0.7083333f, 0.4583333f, 0.7083333f, 0.41666663f,
+	0.7083333f, 0.375f, 0.7083333f, 0.3333333f, 0.7083333f, 0.29166663f, 0.7083333f, 0.25f,
+	0.7083333f, 0.20833331f, 0.7083333f, 0.16666663f, 0.7083333f, 0.125f, 0.7083333f, 0.08333331f,
+	0.7083333f, 0.041666627f, 0.7083333f, 0.0f, 0.75f, 1.0f, 0.75f, 0.9583333f,
+	0.75f, 0.9166667f, 0.75f, 0.875f, 0.75f, 0.8333333f, 0.75f, 0.7916666f,
+	0.75f, 0.75f, 0.75f, 0.7083333f, 0.75f, 0.6666666f, 0.75f, 0.625f,
+	0.75f, 0.5833333f, 0.75f, 0.5416666f, 0.75f, 0.5f, 0.75f, 0.4583333f,
+	0.75f, 0.41666663f, 0.75f, 0.375f, 0.75f, 0.3333333f, 0.75f, 0.29166663f,
+	0.75f, 0.25f, 0.75f, 0.20833331f, 0.75f, 0.16666663f, 0.75f, 0.125f,
+	0.75f, 0.08333331f, 0.75f, 0.041666627f, 0.75f, 0.0f, 0.7916667f, 1.0f,
+	0.7916667f, 0.9583333f, 0.7916667f, 0.9166667f, 0.7916667f, 0.875f, 0.7916667f, 0.8333333f,
+	0.7916667f, 0.7916666f, 0.7916667f, 0.75f, 0.7916667f, 0.7083333f, 0.7916667f, 0.6666666f,
+	0.7916667f, 0.625f, 0.7916667f, 0.5833333f, 0.7916667f, 0.5416666f, 0.7916667f, 0.5f,
+	0.7916667f, 0.4583333f, 0.7916667f, 0.41666663f, 0.7916667f, 0.375f, 0.7916667f, 0.3333333f,
+	0.7916667f, 0.29166663f, 0.7916667f, 0.25f, 0.7916667f, 0.20833331f, 0.7916667f, 0.16666663f,
+	0.7916667f, 0.125f, 0.7916667f, 0.08333331f, 0.7916667f, 0.041666627f, 0.7916667f, 0.0f,
+	0.8333333f, 1.0f, 0.8333333f, 0.9583333f, 0.8333333f, 0.9166667f, 0.8333333f, 0.875f,
+	0.8333333f, 0.8333333f, 0.8333333f, 0.7916666f, 0.8333333f, 0.75f, 0.8333333f, 0.7083333f,
+	0.8333333f, 0.6666666f, 0.8333333f, 0.625f, 0.8333333f, 0.5833333f, 0.8333333f, 0.5416666f,
+	0.8333333f, 0.5f, 0.8333333f, 0.4583333f, 0.8333333f, 0.41666663f, 0.8333333f, 0.375f,
+	0.8333333f, 0.3333333f, 0.8333333f, 0.29166663f, 0.8333333f, 0.25f, 0.8333333f, 0.20833331f,
+	0.8333333f, 0.16666663f, 0.8333333f, 0.125f, 0.8333333f, 0.08333331f, 0.8333333f, 0.041666627f,
+	0.8333333f, 0.0f, 0.875f, 1.0f, 0.875f, 0.9583333f, 0.875f, 0.9166667f,
+	0.875f, 0.875f, 0.875f, 0.8333333f, 0.875f, 0.7916666f, 0.875f, 0.75f,
+	0.875f, 0.7083333f, 0.875f, 0.6666666f, 0.875f, 0.625f, 0.875f, 0.5833333f,
+	0.875f, 0.5416666f, 0.875f, 0.5f, 0.875f, 0.4583333f, 0.875f, 0.41666663f,
+	0.875f, 0.375f, 0.875f, 0.3333333f, 0.875f, 0.29166663f, 0.875f, 0.25f,
+	0.875f, 0.20833331f, 0.875f, 0.16666663f, 0.875f, 0.125f, 0.875f, 0.08333331f,
+	0.875f, 0.041666627f, 0.875f, 0.0f, 0.9166667f, 1.0f, 0.9166667f, 0.9583333f,
+	0.9166667f, 0.9166667f, 0.9166667f, 0.875f, 0.9166667f, 0.8333333f, 0.9166667f, 0.7916666f,
+	0.9166667f, 0.75f, 0.9166667f, 0.7083333f, 0.9166667f, 0.6666666f, 0.9166667f, 0.625f,
+	0.9166667f, 0.5833333f, 0.9166667f, 0.5416666f, 0.9166667f, 0.5f, 0.9166667f, 0.4583333f,
+	0.9166667f, 0.41666663f, 0.9166667f, 0.375f, 0.9166667f, 0.3333333f, 0.9166667f, 0.29166663f,
+	0.9166667f, 0.25f, 0.9166667f, 0.20833331f, 0.9166667f, 0.16666663f, 0.9166667f, 0.125f,
+	0.9166667f, 0.08333331f, 0.9166667f, 0.041666627f, 0.9166667f, 0.0f, 0.9583333f, 1.0f,
+	0.9583333f, 0.9583333f, 0.9583333f, 0.9166667f, 0.9583333f, 0.875f, 0.9583333f, 0.8333333f,
+	0.9583333f, 0.7916666f, 0.9583333f, 0.75f, 0.9583333f, 0.7083333f, 0.9583333f, 0.6666666f,
+	0.9583333f, 0.625f, 0.9583333f, 0.5833333f, 0.9583333f, 0.5416666f, 0.9583333f, 0.5f,
+	0.9583333f, 0.4583333f, 0.9583333f, 0.41666663f, 0.9583333f, 0.375f, 0.9583333f, 0.3333333f,
+	0.9583333f, 0.29166663f, 0.9583333f, 0.25f, 0.9583333f, 0.20833331f, 0.9583333f, 0.16666663f,
+	0.9583333f, 0.125f, 0.9583333f, 0.08333331f, 0.9583333f, 0.041666627f, 0.9583333f, 0.0f,
+	1.0f, 1.0f, 1.0f, 0.9583333f, 1.0f, 0.9166667f, 1.0f, 0.875f,
+	1.0f, 0.8333333f, 1.0f, 0.7916666f, 1.0f, 0.75f, 1.0f, 0.7083333f,
+	1.0f, 0.6666666f, 1.0f, 0.625f, 1.0f, 0.5833333f, 1.0f, 0.5416666f,
+	1.0f, 0.5f, 1.0f, 0.4583333f, 1.0f, 0.41666663f, 1.0f, 0.375f,
+	1.0f, 0.3333333f, 1.0f, 0.29166663f, 1.0f, 0.25f, 1.0f, 0.20833331f,
+	1.0f, 0.16666663f, 1.0f, 0.125f, 1.0f, 0.08333331f, 1.0f, 0.041666627f,
+	1.0f, 0.0f
+};
+static const GLuint torusIndices[3456] =
+{
+	0, 25, 26, 0, 26, 1, 1, 26, 27, 1, 27, 2, 2, 27, 28, 2,
+	28, 3, 3, 28, 29, 3, 29, 4, 4, 29, 30, 4, 30, 5, 5, 30,
+	31, 5, 31, 6, 6, 31, 32, 6, 32, 7, 7, 32, 33, 7, 33, 8,
+	8, 33, 34, 8, 34, 9, 9, 34, 35, 9, 35, 10, 10, 35, 36, 10,
+	36, 11, 11, 36, 37, 11, 37, 12, 12, 37, 38, 12, 38, 13, 13, 38,
+	39, 13, 39, 14, 14, 39, 40, 14, 40, 15, 15, 40, 41, 15, 41, 16,
+	16, 41, 42, 16, 42, 17, 17, 42, 43, 17, 43, 18, 18, 43, 44, 18,
+	44, 19, 19, 44, 45, 19, 45, 20, 20, 45, 46, 20, 46, 21, 21, 46,
+	47, 21, 47, 22, 22, 47, 48, 22, 48, 23, 23, 48, 49, 23, 49, 24,
+	25, 50, 51, 25, 51, 26, 26, 51, 52, 26, 52, 27, 27, 52, 53, 27,
+	53, 28, 28, 53, 54, 28, 54, 29, 29, 54, 55, 29, 55, 30, 30, 55,
+	56, 30, 56, 31, 31, 56, 57, 31, 57, 32, 32, 57, 58, 32, 58, 33,
+	33, 58, 59, 33, 59, 34, 34, 59, 60, 34, 60, 35, 35, 60, 61, 35,
+	61, 36, 36, 61, 62, 36, 62, 37, 37, 62, 63, 37, 63, 38, 38, 63,
+	64, 38, 64, 39, 39, 64, 65, 39, 65, 40, 40, 65, 66, 40, 66, 41,
+	41, 66, 67, 41, 67, 42, 42, 67, 68, 42, 68, 43, 43, 68, 69, 43,
+	69, 44, 44, 69, 70, 44, 70, 45, 45, 70, 71, 45, 71, 46, 46, 71,
+	72, 46, 72, 47, 47, 72, 73, 47, 73, 48, 48, 73, 74, 48, 74, 49,
+	50, 75, 76, 50, 76, 51, 51, 76, 77, 51, 77, 52, 52, 77, 78, 52,
+	78, 53, 53, 78, 79, 53, 79, 54, 54, 79, 80, 54, 80, 55, 55, 80,
+	81, 55, 81, 56, 56, 81, 82, 56, 82, 57, 57, 82, 83, 57, 83, 58,
+	58, 83, 84, 58, 84, 59, 59, 84, 85, 59, 85, 60, 60, 85, 86, 60,
+	86, 61, 61, 86, 87, 61, 87, 62, 62, 87, 88, 62, 88, 63, 63, 88,
+	89, 63, 89, 64, 64, 89, 90, 64, 90, 65, 65, 90, 91, 65, 91, 66,
+	66, 91, 92, 66, 92, 67, 67, 92, 93, 67, 93, 68, 68, 93, 94, 68,
+	94, 69, 69, 94, 95, 69, 95, 70, 70, 95, 96, 70, 96, 71, 71, 96,
+	97, 71, 97, 72, 72, 97, 98, 72, 98, 73, 73, 98, 99, 73, 99, 74,
+	75, 100, 101, 75, 101, 76, 76, 101, 102, 76, 102, 77, 77, 102, 103, 77,
+	103, 78, 78, 103, 104, 78, 104, 79, 79, 104, 105, 79, 105, 80, 80, 105,
+	106, 80, 106, 81, 81, 106, 107, 81, 107, 82, 82, 107, 108, 82, 108, 83,
+	83, 108, 109, 83, 109, 84, 84, 109, 110, 84, 110, 85, 85, 110, 111, 85,
+	111, 86, 86, 111, 112, 86, 112, 87, 87, 112, 113, 87, 113, 88, 88, 113,
+	114, 88, 114, 89, 89, 114, 115, 89, 115, 90, 90, 115, 116, 90, 116, 91,
+	91, 116, 117, 91, 117, 92, 92, 117, 118, 92, 118, 93, 93, 118, 119, 93,
+	119, 94, 94, 119, 120, 94, 120, 95, 95, 120, 121, 95, 121, 96, 96, 121,
+	122, 96, 122, 97, 97, 122, 123, 97, 123, 98, 98, 123, 124, 98, 124, 99,
+	100, 125, 126, 100, 126, 101, 101, 126, 127, 101, 127, 102, 102, 127, 128, 102,
+	128, 103, 103, 128, 129, 103, 129, 104, 104, 129, 130, 104, 130, 105, 105, 130,
+	131, 105, 131, 106, 106, 131, 132, 106, 132, 107, 107, 132, 133, 107, 133, 108,
+	108, 133, 134, 108, 134, 109, 109, 134, 135, 109, 135, 110, 110, 135, 136, 110,
+	136, 111, 111, 136, 137, 111, 137, 112, 112, 137, 138, 112, 138, 113, 113, 138,
+	139, 113, 139, 114, 114, 139, 140, 114, 140, 115, 115, 140, 141, 115, 141, 116,
+	116, 141, 142, 116, 142, 117, 117, 142, 143, 117, 143, 118, 118, 143, 144, 118,
+	144, 119, 119, 144, 145, 119, 145, 120, 120, 145, 146, 120, 146, 121, 121, 146,
+	147, 121, 147, 122, 122, 147, 148, 122, 148, 123, 123, 148, 149, 123, 149, 124,
+	125, 150, 151, 125, 151, 126, 126, 151, 152, 126, 152, 127, 127, 152, 153, 127,
+	153, 128, 128, 153, 154, 128, 154, 129, 129, 154, 155, 129, 155, 130, 130, 155,
+	156, 130, 156, 131, 131, 156, 157, 131, 157, 132, 132, 157, 158, 132, 158, 133,
+	133, 158, 159, 133, 159, 134, 134, 159, 160, 134, 160, 135, 135, 160, 161, 135,
+	161, 136, 136, 161, 162, 136, 162, 137, 137, 162, 163, 137, 163, 138, 138, 163,
+	164, 138, 164, 139, 139, 164, 165, 139, 165, 140, 140, 165, 166, 140, 166, 141,
+	141, 166, 167, 141, 167, 142, 142, 167, 168, 142, 168, 143, 143, 168, 169, 143,
+	169, 144, 144, 169, 170, 144, 170, 145, 145, 170, 171, 145, 171, 146, 146, 171,
+	172, 146, 172, 147, 147, 172, 173, 147, 173, 148, 148, 173, 174, 148, 174, 149,
+	150, 175, 176, 150, 176, 151, 151, 176, 177, 151, 177, 152, 152, 177, 178, 152,
+	178, 153, 153, 178, 179, 153, 179, 154, 154, 179, 180, 154, 180, 155, 155, 180,
+	181, 155, 181, 156, 156, 181, 182, 156, 182, 157, 157, 182, 183, 157, 183, 158,
+	158, 183, 184, 158, 184, 159, 159, 184, 185, 159, 185, 160, 160, 185, 186, 160,
+	186, 161, 161, 186, 187, 161, 187, 162, 162, 187, 188, 162, 188, 163, 163, 188,
+	189, 163, 189, 164, 164, 189, 190, 164, 190, 165, 165, 190, 191, 165, 191, 166,
+	166, 191, 192, 166, 192, 167, 167, 192, 193, 167, 193, 168, 168, 193, 194, 168,
+	194, 169, 169, 194, 195, 169, 195, 170, 170, 195, 196, 170, 196, 171, 171, 196,
+	197, 171, 197, 172, 172, 197, 198, 172, 198, 173, 173, 198, 199, 173, 199, 174,
+	175, 200, 201, 175, 201, 176, 176, 201, 202, 176, 202, 177, 177, 202, 203, 177,
+	203, 178, 178, 203, 204, 178, 204, 179, 179, 204, 205, 179, 205, 180, 180, 205,
+	206, 180, 206, 181, 181, 206, 207, 181, 207, 182, 182, 207, 208, 182, 208, 183,
+	183, 208, 209, 183, 209, 184, 184, 209, 210, 184, 210, 185, 185, 210, 211, 185,
+	211, 186, 186, 211, 212, 186, 212, 187, 187, 212, 213, 187, 213, 188, 188, 213,
+	214, 188, 214, 189, 189, 214, 215, 189, 215, 190, 190, 215, 216, 190, 216, 191,
+	191, 216, 217, 191, 217, 192, 192, 217, 218, 192, 218, 193, 193, 218, 219, 193,
+	219, 194, 194, 219, 220, 194, 220, 195, 195, 220, 221, 195, 221, 196, 196, 221,
+	222, 196, 222, 197, 197, 222, 223, 197, 223, 198, 198, 223, 224, 198, 224, 199,
+	200, 225, 226, 200, 226, 201, 201, 226, 227, 201, 227, 202, 202, 227, 228, 202,
+	228, 203, 203, 228, 229, 203, 229, 204, 204, 229, 230, 204, 230, 205, 205, 230,
+	231, 205, 231, 206, 206, 231, 232, 206, 232, 207, 207, 232, 233, 207, 233, 208,
+	208, 233, 234, 208, 234, 209, 209, 234, 235, 209, 235, 210, 210, 235, 236, 210,
+	236, 211, 211, 236, 237, 211, 237, 212, 212, 237, 238, 212, 238, 213, 213, 238,
+	239, 213, 239, 214, 214, 239, 240, 214, 240, 215, 215, 240, 241, 215, 241, 216,
+	216, 241, 242, 216, 242, 217, 217, 242, 243, 217, 243, 218, 218, 243, 244, 218,
+	244, 219, 219, 244, 245, 219, 245, 220, 220, 245, 246, 220, 246, 221, 221, 246,
+	247, 221, 247, 222, 222, 247, 248, 222, 248, 223, 223, 248, 249, 223, 249, 224,
+	225, 250, 251, 225, 251, 226, 226, 251, 252, 226, 252, 227, 227, 252, 253, 227,
+	253, 228, 228, 253, 254, 228, 254, 229, 229, 254, 255, 229, 255, 230, 230, 255,
+	256, 230, 256, 231, 231, 256, 257, 231, 257, 232, 232, 257, 258, 232, 258, 233,
+	233, 258, 259, 233, 259, 234, 234, 259, 260, 234, 260, 235, 235, 260, 261, 235,
+	261, 236, 236, 261, 262, 236, 262, 237, 237, 262, 263, 237, 263, 238, 238, 263,
+	264, 238, 264, 239, 239, 264, 265, 239, 265, 240, 240, 265, 266, 240, 266, 241,
+	241, 266, 267, 241, 267, 242, 242, 267, 268, 242, 268, 243, 243, 268, 269, 243,
+	269, 244, 244, 269, 270, 244, 270, 245, 245, 270, 271, 245, 271, 246, 246, 271,
+	272, 246, 272, 247, 247, 272, 273, 247, 273, 248, 248, 273, 274, 248, 274, 249,
+	250, 275, 276, 250, 276, 251, 251, 276, 277, 251, 277, 252, 252, 277, 278, 252,
+	278, 253, 253, 278, 279, 253, 279, 254, 254, 279, 280, 254, 280, 255, 255, 280,
+	281, 255, 281, 256, 256, 281, 282, 256, 282, 257, 257, 282, 283, 257, 283, 258,
+	258, 283, 284, 258, 284, 259, 259, 284, 285, 259, 285, 260, 260, 285, 286, 260,
+	286, 261, 261, 286, 287, 261, 287, 262, 262, 287, 288, 262, 288, 263, 263, 288,
+	289, 263, 289, 264, 264, 289, 290, 264, 290, 265, 265, 290, 291, 265, 291, 266,
+	266, 291, 292, 266, 292, 267, 267, 292, 293, 267, 293, 268, 268, 293, 294, 268,
+	294, 269, 269, 294, 295, 269, 295, 270, 270, 295, 296, 270, 296, 271, 271, 296,
+	297, 271, 297, 272, 272, 297, 298, 272, 298, 273, 273, 298, 299, 273, 299, 274,
+	275, 300, 301, 275, 301, 276, 276, 301, 302, 276, 302, 277, 277, 302, 303, 277,
+	303, 278, 278, 303, 304, 278, 304, 279, 279, 304, 305, 279, 305, 280, 280, 305,
+	306, 280, 306, 281, 281, 306, 307, 281, 307, 282, 282, 307, 308, 282, 308, 283,
+	283, 308, 309, 283, 309, 284, 284, 309, 310, 284, 310, 285, 285, 310, 311, 285,
+	311, 286, 286, 311, 312, 286, 312, 287, 287, 312, 313, 287, 313, 288, 288, 313,
+	314, 288, 314, 289, 289, 314, 315, 289, 315, 290, 290, 315, 316, 290, 316, 291,
+	291, 316, 317, 291, 317, 292, 292, 317, 318, 292, 318, 293, 293, 318, 319, 293,
+	319, 294, 294, 319, 320, 294, 320, 295, 295, 320, 321, 295, 321, 296, 296, 321,
+	322, 296, 322, 297, 297, 322, 323, 297, 323, 298, 298, 323, 324, 298, 324, 299,
+	300, 325, 326, 300, 326, 301, 301, 326, 327, 301, 327, 302, 302, 327, 328, 302,
+	328, 303, 303, 328, 329, 303, 329, 304, 304, 329, 330, 304, 330, 305, 305, 330,
+	331, 305, 331, 306, 306, 331, 332, 306, 332, 307, 307, 332, 333, 307, 333, 308,
+	308, 333, 334, 308, 334, 309, 309, 334, 335, 309, 335, 310, 310, 335, 336, 310,
+	336, 311, 311, 336, 337, 311, 337, 312, 312, 337, 338, 312, 338, 313, 313, 338,
+	339, 313, 339, 314, 314, 339, 340, 314, 340, 315, 315, 340, 341, 315, 341, 316,
+	316, 341, 342, 316, 342, 317, 317, 342, 343, 317, 343, 318, 318, 343, 344, 318,
+	344, 319, 319, 344, 345, 319, 345, 320, 320, 345, 346, 320, 346, 321, 321, 346,
+	347, 321, 347, 322, 322, 347, 348, 322, 348, 323, 323, 348, 349, 323, 349, 324,
+	325, 350, 351, 325, 351, 326, 326, 351, 352, 326, 352, 327, 327, 352, 353, 327,
+	353, 328, 328, 353, 354, 328, 354, 329, 329, 354, 355, 329, 355, 330, 330, 355,
+	356, 330, 356, 331, 331, 356, 357, 331, 357, 332, 332, 357, 358, 332, 358, 333,
+	333, 358, 359, 333, 359, 334, 334, 359, 360, 334, 360, 335, 335, 360, 361, 335,
+	361, 336, 336, 361, 362, 336, 362, 337, 337, 362, 363, 337, 363, 338, 338, 363,
+	364, 338, 364, 339, 339, 364, 365, 339, 365, 340, 340, 365, 366, 340, 366, 341,
+	341, 366, 367, 341, 367, 342, 342, 367, 368, 342, 368, 343, 343, 368, 369, 343,
+	369, 344, 344, 369, 370, 344, 370, 345, 345, 370, 371, 345, 371, 346, 346, 371,
+	372, 346, 372, 347, 347, 372, 373, 347, 373, 348, 348, 373, 374, 348, 374, 349,
+	350, 375, 376, 350, 376, 351, 351, 376, 377, 351, 377, 352, 352, 377, 378, 352,
+	378, 353, 353, 378, 379, 353, 379, 354, 354, 379, 380, 354, 380, 355, 355, 380,
+	381, 355, 381, 356, 356, 381, 382, 356, 382, 357, 357, 382, 383, 357, 383, 358,
+	358, 383, 384, 358, 384, 359, 359, 384, 385, 359, 385, 360, 360, 385, 386, 360,
+	386, 361, 361, 386, 387, 361, 387, 362, 362, 387, 388, 362, 388, 363, 363, 388,
+	389, 363, 389, 364, 364, 389, 390, 364, 390, 365, 365, 390, 391, 365, 391, 366,
+	366, 391, 392, 366, 392, 367, 367, 392, 393, 367, 393, 368, 368, 393, 394, 368,
+	394, 369, 369, 394, 395, 369, 395, 370, 370, 395, 396, 370, 396, 371, 371, 396,
+	397, 371, 397, 372, 372, 397, 398, 372, 398, 373, 373, 398, 399, 373, 399, 374,
+	375, 400, 401, 375, 401, 376, 376, 401, 402, 376, 402, 377, 377, 402, 403, 377,
+	403, 378, 378, 403, 404, 378, 404, 379, 379, 404, 405, 379, 405, 380, 380, 405,
+	406, 380, 406, 381, 381, 406, 407, 381, 407, 382, 382, 407, 408, 382, 408, 383,
+	383, 408, 409, 383, 409, 384, 384, 409, 410, 384, 410, 385, 385, 410, 411, 385,
+	411, 386, 386, 411, 412, 386, 412, 387, 387, 412, 413, 387, 413, 388, 388, 413,
+	414, 388, 414, 389, 389, 414, 415, 389, 415, 390, 390, 415, 416, 390, 416, 391,
+	391, 416, 417, 391, 417, 392, 392, 417, 418, 392, 418, 393, 393, 418, 419, 393,
+	419, 394, 394, 419, 420, 394, 420, 395, 395, 420, 421, 395, 421, 396, 396, 421,
+	422, 396, 422, 397, 397, 422, 423, 397, 423, 398, 398, 423, 424, 398, 424, 399,
+	400, 425, 426, 400, 426, 401, 401, 426, 427, 401, 427, 402, 402, 427, 428, 402,
+	428, 403, 403, 428, 429, 403, 429, 404, 404, 429, 430, 404, 430, 405, 405, 430,
+	431, 405, 431, 406, 406, 431, 432, 406, 432, 407, 407, 432, 433, 407, 433, 408,
+	408, 433, 434, 408, 434, 409, 409, 434, 435, 409, 435, 410, 410, 435, 436, 410,
+	436, 411, 411, 436, 437, 411, 437, 412, 412, 437, 438, 412, 438, 413, 413, 438,
+	439, 413, 439, 414, 414, 439, 440, 414, 440, 415, 415, 440, 441, 415, 441, 416,
+	416, 441, 442, 416, 442, 417, 417, 442, 443, 417, 443, 418, 418, 443, 444, 418,
+	444, 419, 419, 444, 445, 419, 445, 420, 420, 445, 446, 420, 446, 421, 421, 446,
+	447, 421, 447, 422, 422, 447, 448, 422, 448, 423, 423, 448, 449, 423, 449, 424,
+	425, 450, 451, 425, 451, 426, 426, 451, 452, 426, 452, 427, 427, 452, 453, 427,
+	453, 428, 428, 453, 454, 428, 454, 429, 429, 454, 455, 429, 455, 430, 430, 455,
+	456, 430, 456, 431, 431, 456, 457, 431, 457, 432, 432, 457, 458, 432, 458, 433,
+	433, 458, 459, 433, 459, 434, 434, 459, 460, 434, 460, 435, 435, 460, 461, 435,
+	461, 436, 436, 461, 462, 436, 462, 437, 437, 462, 463, 437, 463, 438, 438, 463,
+	464, 438, 464, 439, 439, 464, 465, 439, 465, 440, 440, 465, 466, 440, 466, 441,
+	441, 466, 467, 441, 467, 442, 442, 467, 468, 442, 468, 443, 443, 468, 469, 443,
+	469, 444, 444, 469, 470, 444, 470, 445, 445, 470, 471, 445, 471, 446, 446, 471,
+	472, 446, 472, 447, 447, 472, 473, 447, 473, 448, 448, 473, 474, 448, 474, 449,
+	450, 475, 476, 450, 476, 451, 451, 476, 477, 451, 477, 452, 452, 477, 478, 452,
+	478, 453, 453, 478, 479, 453, 479, 454, 454, 479, 480, 454, 480, 455, 455, 480,
+	481, 455, 481, 456, 456, 481, 482, 456, 482, 457, 457, 482, 483, 457, 483, 458,
+	458, 483, 484, 458, 484, 459, 459, 484, 485, 459, 485, 460, 460, 485, 486, 460,
+	486, 461, 461, 486, 487, 461, 487, 462, 462, 487, 488, 462, 488, 463, 463, 488,
+	489, 463, 489, 464, 464, 489, 490, 464, 490, 465, 465, 490, 491, 465, 491, 466,
+	466, 491, 492, 466, 492, 467, 467, 492, 493, 467, 493, 468, 468, 493, 494, 468,
+	494, 469, 469, 494, 495, 469, 495, 470, 470, 495, 496, 470, 496, 471, 471, 496,
+	497, 471, 497, 472, 472, 497, 498, 472, 498, 473, 473, 498, 499, 473, 499, 474,
+	475, 500, 501, 475, 501, 476, 476, 501, 502, 476, 502, 477, 477, 502, 503, 477,
+	503, 478, 478, 503, 504, 478, 504, 479, 479, 504, 505, 479, 505, 480, 480, 505,
+	506, 480, 506, 481, 481, 506, 507, 481, 507, 482, 482, 507, 508, 482, 508, 483,
+	483, 508, 509, 483, 509, 484, 484, 509, 510, 484, 510, 485, 485, 510, 511, 485,
+	511, 486, 486, 511, 512, 486, 512, 487, 487, 512, 513, 487, 513, 488, 488, 513,
+	514, 488, 514, 489, 489, 514, 515, 489, 515, 490, 490, 515, 516, 490, 516, 491,
+	491, 516, 517, 491, 517, 492, 492, 517, 518, 492, 518, 493, 493, 518, 519, 493,
+	519, 494, 494, 519, 520, 494, 520, 495, 495, 520, 521, 495, 521, 496, 496, 521,
+	522, 496, 522, 497, 497, 522, 523, 497, 523, 498, 498, 523, 524, 498, 524, 499,
+	500, 525, 526, 500, 526, 501, 501, 526, 527, 501, 527, 502, 502, 527, 528, 502,
+	528, 503, 503, 528, 529, 503, 529, 504, 504, 529, 530, 504, 530, 505, 505, 530,
+	531, 505, 531, 506, 506, 531, 532, 506, 532, 507, 507, 532, 533, 507, 533, 508,
+	508, 533, 534, 508, 534, 509, 509, 534, 535, 509, 535, 510, 510, 535, 536, 510,
+	536, 511, 511, 536, 537, 511, 537, 512, 512, 537, 538, 512, 538, 513, 513, 538,
+	539, 513, 539, 514, 514, 539, 540, 514, 540, 515, 515, 540, 541, 515, 541, 516,
+	516, 541, 542, 516, 542, 517, 517, 542, 543, 517, 543, 518, 518, 543, 544, 518,
+	544, 519, 519, 544, 545, 519, 545, 520, 520, 545, 546, 520, 546, 521, 521, 546,
+	547, 521, 547, 522, 522, 547, 548, 522, 548, 523, 523, 548, 549, 523, 549, 524,
+	525, 550, 551, 525, 551, 526, 526, 551, 552, 526, 552, 527, 527, 552, 553, 527,
+	553, 528, 528, 553, 554, 528, 554, 529, 529, 554, 555, 529, 555, 530, 530, 555,
+	556, 530, 556, 531, 531, 556, 557, 531, 557, 532, 532, 557, 558, 532, 558, 533,
+	533, 558, 559, 533, 559, 534, 534, 559, 560, 534, 560, 535, 535, 560, 561, 535,
+	561, 536, 536, 561, 562, 536, 562, 537, 537, 562, 563, 537, 563, 538, 538, 563,
+	564, 538, 564, 539, 539, 564, 565, 539, 565, 540, 540, 565, 566, 540, 566, 541,
+	541, 566, 567, 541, 567, 542, 542, 567, 568, 542, 568, 543, 543, 568, 569, 543,
+	569, 544, 544, 569, 570, 544, 570, 545, 545, 570, 571, 545, 571, 546, 546, 571,
+	572, 546, 572, 547, 547, 572, 573, 547, 573, 548, 548, 573, 574, 548, 574, 549,
+	550, 575, 576, 550, 576, 551, 551, 576, 577, 551, 577, 552, 552, 577, 578, 552,
+	578, 553, 553, 578, 579, 553, 579, 554, 554, 579, 580, 554, 580, 555, 555, 580,
+	581, 555, 581, 556, 556, 581, 582, 556, 582, 557, 557, 582, 583, 557, 583, 558,
+	558, 583, 584, 558, 584, 559, 559, 584, 585, 559, 585, 560, 560, 585, 586, 560,
+	586, 561, 561, 586, 587, 561, 587, 562, 562, 587, 588, 562, 588, 563, 563, 588,
+	589, 563, 589, 564, 564, 589, 590, 564, 590, 565, 565, 590, 591, 565, 591, 566,
+	566, 591, 592, 566, 592, 567, 567, 592, 593, 567, 593, 568, 568, 593, 594, 568,
+	594, 569, 569, 594, 595, 569, 595, 570, 570, 595, 596, 570, 596, 571, 571, 596,
+	597, 571, 597, 572, 572, 597, 598, 572, 598, 573, 573, 598, 599, 573, 599, 574,
+	575, 600, 601, 575, 601, 576, 576, 601, 602, 576, 602, 577, 577, 602, 603, 577,
+	603, 578, 578, 603, 604, 578, 604, 579, 579, 604, 605, 579, 605, 580, 580, 605,
+	606, 580, 606, 581, 581, 606, 607, 581, 607, 582, 582, 607, 608, 582, 608, 583,
+	583, 608, 609, 583, 609, 584, 584, 609, 610, 584, 610, 585, 585, 610, 611, 585,
+	611, 586, 586, 611, 612, 586, 612, 587, 587, 612, 613, 587, 613, 588, 588, 613,
+	614, 588, 614, 589, 589, 614, 615, 589, 615, 590, 590, 615, 616, 590, 616, 591,
+	591, 616, 617, 591, 617, 592, 592, 617, 618, 592, 618, 593, 593, 618, 619, 593,
+	619, 594, 594, 619, 620, 594, 620, 595, 595, 620, 621, 595, 621, 596, 596, 621,
+	622, 596, 622, 597, 597, 622, 623, 597, 623, 598, 598, 623, 624, 598, 624, 599
+};
+
+ShapeArrays BakedTables::torus()
+{
+	ShapeArrays arrays = { torusVertex, torusNormals, torusTexCoords, torusIndices, 625, 3456, 0.325f, 24.0f };
+	return arrays;
+}
+
+// ShapeGen::genPlane(1, 20)
+static const float planeVertex[2400] =
+{
+	0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	2.0f, 0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+	0.0f, 2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 1.0f, 3.0f,
+	0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f,
+	4.0f, 0.0f, 1.0f, 4.0f, 0.0f, 1.0f, 3.0f, 0.0f,
+	0.0f, 4.0f, 0.0f, 0.0f, 5.0f, 0.0f, 1.0f, 5.0f,
+	0.0f, 1.0f, 4.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.0f,
+	6.0f, 0.0f, 1.0f, 6.0f, 0.0f, 1.0f, 5.0f, 0.0f,
+	0.0f, 6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 1.0f, 7.0f,
+	0.0f, 1.0f, 6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.0f,
+	8.0f, 0.0f, 1.0f, 8.0f, 0.0f, 1.0f, 7.0f, 0.0f,
+	0.0f, 8.0f, 0.0f, 0.0f, 9.0f, 0.0f, 1.0f, 9.0f,
+	0.0f, 1.0f, 8.0f, 0.0f, 0.0f, 9.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 1.0f, 10.0f, 0.0f, 1.0f, 9.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 2.0f, 1.0f,
+	0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f,
+	2.0f, 0.0f, 2.0f, 2.0f, 0.0f, 2.0f, 1.0f, 0.0f,
+	1.0f, 2.0f, 0.0f, 1.0f, 3.0f, 0.0f, 2.0f, 3.0f,
+	0.0f, 2.0f, 2.0f, 0.0f, 1.0f, 3.0f, 0.0f, 1.0f,
+	4.0f, 0.0f, 2.0f, 4.0f, 0.0f, 2.0f, 3.0f, 0.0f,
+	1.0f, 4.0f, 0.0f, 1.0f, 5.0f, 0.0f, 2.0f, 5.0f,
+	0.0f, 2.0f, 4.0f, 0.0f, 1.0f, 5.0f, 0.0f, 1.0f,
+	6.0f, 0.0f, 2.0f, 6.0f, 0.0f, 2.0f, 5.0f, 0.0f,
+	1.0f, 6.0f, 0.0f, 1.0f, 7.0f, 0.0f, 2.0f, 7.0f,
+	0.0f, 2.0f, 6.0f, 0.0f, 1.0f, 7.0f, 0.0f, 1.0f,
+	8.0f, 0.0f, 2.0f, 8.0f, 0.0f, 2.0f, 7.0f, 0.0f,
+	1.0f, 8.0f, 0.0f, 1.0f, 9.0f, 0.0f, 2.0f, 9.0f,
+	0.0f, 2.0f, 8.0f, 0.0f, 1.0f, 9.0f, 0.0f, 1.0f,
+	10.0f, 0.0f, 2.0f, 10.0f, 0.0f, 2.0f, 9.0f, 0.0f,
+	2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 3.0f, 1.0f,
+	0.0f, 3.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 2.0f,
+	2.0f, 0.0f, 3.0f, 2.0f, 0.0f, 3.0f, 1.0f, 0.0f,
+	2.0f, 2.0f, 0.0f, 2.0f, 3.0f, 0.0f, 3.0f, 3.0f,
+	0.0f, 3.0f, 2.0f, 0.0f, 2.0f, 3.0f, 0.0f, 2.0f,
+	4.0f, 0.0f, 3.0f, 4.0f, 0.0f, 3.0f, 3.0f, 0.0f,
+	2.0f, 4.0f, 0.0f, 2.0f, 5.0f, 0.0f, 3.0f, 5.0f,
+	0.0f, 3.0f, 4.0f, 0.0f, 2.0f, 5.0f, 0.0f, 2.0f,
+	6.0f, 0.0f, 3.0f, 6.0f, 0.0f, 3.0f, 5.0f, 0.0f,
+	2.0f, 6.0f, 0.0f, 2.0f, 7.0f, 0.0f, 3.0f, 7.0f,
+	0.0f, 3.0f, 6.0f, 0.0f, 2.0f, 7.0f, 0.0f, 2.0f,
+	8.0f, 0.0f, 3.0f, 8.0f, 0.0f, 3.0f, 7.0f, 0.0f,
+	2.0f, 8.0f, 0.0f, 2.0f, 9.0f, 0.0f, 3.0f, 9.0f,
+	0.0f, 3.0f, 8.0f, 0.0f, 2.0f, 9.0f, 0.0f, 2.0f,
+	10.0f, 0.0f, 3.0f, 10.0f, 0.0f, 3.0f, 9.0f, 0.0f,
+	3.0f, 0.0f, 0.0f, 3.0f, 1.0f, 0.0f, 4.0f, 1.0f,
+	0.0f, 4.0f, 0.0f, 0.0f, 3.0f, 1.0f, 0.0f, 3.0f,
+	2.0f, 0.0f, 4.0f, 2.0f, 0.0f, 4.0f, 1.0f, 0.0f,
+	3.0f, 2.0f, 0.0f, 3.0f, 3.0f, 0.0f, 4.0f, 3.0f,
+	0.0f, 4.0f, 2.0f, 0.0f, 3.0f, 3.0f, 0.0f, 3.0f,
+	4.0f, 0.0f, 4.0f, 4.0f, 0.0f, 4.0f, 3.0f, 0.0f,
+	3.0f, 4.0f, 0.0f, 3.0f, 5.0f, 0.0f, 4.0f, 5.0f,
+	0.0f, 4.0f, 4.0f, 0.0f, 3.0f, 5.0f, 0.0f, 3.0f,
+	6.0f, 0.0f, 4.0f, 6.0f, 0.0f, 4.0f, 5.0f, 0.0f,
+	3.0f, 6.0f, 0.0f, 3.0f, 7.0f, 0.0f, 4.0f, 7.0f,
+	0.0f, 4.0f, 6.0f, 0.0f, 3.0f, 7.0f, 0.0f, 3.0f,
+	8.0f, 0.0f, 4.0f, 8.0f, 0.0f, 4.0f, 7.0f, 0.0f,
+	3.0f, 8.0f, 0.0f, 3.0f, 9.0f, 0.0f, 4.0f, 9.0f,
+	0.0f, 4.0f, 8.0f, 0.0f, 3.0f, 9.0f, 0.0f, 3.0f,
+	10.0f, 0.0f, 4.0f, 10.0f, 0.0f, 4.0f, 9.0f, 0.0f,
+	4.0f, 0.0f, 0.0f, 4.0f, 1.0f, 0.0f, 5.0f, 1.0f,
+	0.0f, 5.0f, 0.0f, 0.0f, 4.0f, 1.0f, 0.0f, 4.0f,
+	2.0f, 0.0f, 5.0f, 2.0f, 0.0f, 5.0f, 1.0f, 0.0f,
+	4.0f, 2.0f, 0.0f, 4.0f, 3.0f, 0.0f, 5.0f, 3.0f,
+	0.0f, 5.0f, 2.0f, 0.0f, 4.0f, 3.0f, 0.0f, 4.0f,
+	4.0f, 0.0f, 5.0f, 4.0f, 0.0f, 5.0f, 3.0f, 0.0f,
+	4.0f, 4.0f, 0.0f, 4.0f, 5.0f, 0.0f, 5.0f, 5.0f,
+	0.0f, 5.0f, 4.0f, 0.0f, 4.0f, 5.0f, 0.0f, 4.0f,
+	6.0f, 0.0f, 5.0f, 6.0f, 0.0f, 5.0f, 5.0f, 0.0f,
+	4.0f, 6.0f, 0.0f, 4.0f, 7.0f, 0.0f, 5.0f, 7.0f,
+	0.0f, 5.0f, 6.0f, 0.0f, 4.0f, 7.0f, 0.0f, 4.0f,
+	8.0f, 0.0f, 5.0f, 8.0f, 0.0f, 5.0f, 7.0f, 0.0f,
+	4.0f, 8.0f, 0.0f, 4.0f, 9.0f, 0.0f, 5.0f, 9.0f,
+	0.0f, 5.0f, 8.0f, 0.0f, 4.0f, 9.0f, 0.0f, 4.0f,
+	10.0f, 0.0f, 5.0f, 10.0f, 0.0f, 5.0f, 9.0f, 0.0f,
+	5.0f, 0.0f, 0.0f, 5.0f, 1.0f, 0.0f, 6.0f, 1.0f,
+	0.0f, 6.0f, 0.0f, 0.0f, 5.0f, 1.0f, 0.0f, 5.0f,
+	2.0f, 0.0f, 6.0f, 2.0f, 0.0f, 6.0f, 1.0f, 0.0f,
+	5.0f, 2.0f, 0.0f, 5.0f, 3.0f, 0.0f, 6.0f, 3.0f,
+	0.0f, 6.0f, 2.0f, 0.0f, 5.0f, 3.0f, 0.0f, 5.0f,
+	4.0f, 0.0f, 6.0f, 4.0f, 0.0f, 6.0f, 3.0f, 0.0f,
+	5.0f, 4.0f, 0.0f, 5.0f, 5.0f, 0.0f, 6.0f, 5.0f,
+	0.0f, 6.0f, 4.0f, 0.0f, 5.0f, 5.0f, 0.0f, 5.0f,
+	6.0f, 0.0f, 6.0f, 6.0f, 0.0f, 6.0f, 5.0f, 0.0f,
+	5.0f, 6.0f, 0.0f, 5.0f, 7.0f, 0.0f, 6.0f, 7.0f,
+	0.0f, 6.0f, 6.0f, 0.0f, 5.0f, 7.0f, 0.0f, 5.0f,
+	8.0f, 0.0f, 6.0f, 8.0f, 0.0f, 6.0f, 7.0f, 0.0f,
+	5.0f, 8.0f, 0.0f, 5.0f, 9.0f, 0.0f, 6.0f, 9.0f,
+	0.0f, 6.0f, 8.0f, 0.0f, 5.0f, 9.0f, 0.0f, 5.0f,
+	10.0f, 0.0f, 6.0f, 10.0f, 0.0f, 6.0f, 9.0f, 0.0f,
+	6.0f, 0.0f, 0.0f, 6.0f, 1.0f, 0.0f, 7.0f, 1.0f,
+	0.0f, 7.0f, 0.0f, 0.0f, 6.0f, 1.0f, 0.0f, 6.0f,
+	2.0f, 0.0f, 7.0f, 2.0f, 0.0f, 7.0f, 1.0f, 0.0f,
+	6.0f, 2.0f, 0.0f, 6.0f, 3.0f, 0.0f, 7.0f, 3.0f,
+	0.0f, 7.0f, 2.0f, 0.0f, 6.0f, 3.0f, 0.0f, 6.0f,
+	4.0f, 0.0f, 7.0f, 4.0f, 0.0f, 7.0f, 3.0f, 0.0f,
+	6.0f, 4.0f, 0.0f, 6.0f, 5.0f, 0.0f, 7.0f, 5.0f,
+	0.0f, 7.0f, 4.0f, 0.0f, 6.0f, 5.0f, 0.0f, 6.0f,
+	6.0f, 0.0f, 7.0f, 6.0f, 0.0f, 7.0f, 5.0f, 0.0f,
+	6.0f, 6.0f, 0.0f, 6.0f, 7.0f, 0.0f, 7.0f, 7.0f,
+	0.0f, 7.0f, 6.0f, 0.0f, 6.0f, 7.0f, 0.0f, 6.0f,
+	8.0f, 0.0f, 7.0f, 8.0f, 0.0f, 7.0f, 7.0f, 0.0f,
+	6.0f, 8.0f, 0.0f, 6.0f, 9.0f, 0.0f, 7.0f, 9.0f,
+	0.0f, 7.0f, 8.0f, 0.0f, 6.0f, 9.0f, 0.0f, 6.0f,
+	10.0f, 0.0f, 7.0f, 10.0f, 0.0f, 7.0f, 9.0f, 0.0f,
+	7.0f, 0.0f, 0.0f, 7.0f, 1.0f, 0.0f, 8.0f, 1.0f,
+	0.0f, 8.0f, 0.0f, 0.0f, 7.0f, 1.0f, 0.0f, 7.0f,
+	2.0f, 0.0f, 8.0f, 2.0f, 0.0f, 8.0f, 1.0f, 0.0f,
+	7.0f, 2.0f, 0.0f, 7.0f, 3.0f, 0.0f, 8.0f, 3.0f,
+	0.0f, 8.0f, 2.0f, 0.0f, 7.0f, 3.0f, 0.0f, 7.0f,
+	4.0f, 0.0f, 8.0f, 4.0f, 0.0f, 8.0f, 3.0f, 0.0f,
+	7.0f, 4.0f, 0.0f, 7.0f, 5.0f, 0.0f, 8.0f, 5.0f,
+	0.0f, 8.0f, 4.0f, 0.0f, 7.0f, 5.0f, 0.0f, 7.0f,
+	6.0f, 0.0f, 8.0f, 6.0f, 0.0f, 8.0f, 5.0f, 0.0f,
+	7.0f, 6.0f, 0.0f, 7.0f, 7.0f, 0.0f, 8.0f, 7.0f,
+	0.0f, 8.0f, 6.0f, 0.0f, 7.0f, 7.0f, 0.0f, 7.0f,
+	8.0f, 0.0f, 8.0f, 8.0f, 0.0f, 8.0f, 7.0f, 0.0f,
+	7.0f, 8.0f, 0.0f, 7.0f, 9.0f, 0.0f, 8.0f, 9.0f,
+	0.0f, 8.0f, 8.0f, 0.0f, 7.0f, 9.0f, 0.0f, 7.0f,
+	10.0f, 0.0f, 8.0f, 10.0f, 0.0f, 8.0f, 9.0f, 0.0f,
+	8.0f, 0.0f, 0.0f, 8.0f, 1.0f, 0.0f, 9.0f, 1.0f,
+	0.0f, 9.0f, 0.0f, 0.0f, 8.0f, 1.0f, 0.0f, 8.0f,
+	2.0f, 0.0f, 9.0f, 2.0f, 0.0f, 9.0f, 1.0f, 0.0f,
+	8.0f, 2.0f, 0.0f, 8.0f, 3.0f, 0.0f, 9.0f, 3.0f,
+	0.0f, 9.0f, 2.0f, 0.0f, 8.0f, 3.0f, 0.0f, 8.0f,
+	4.0f, 0.0f, 9.0f, 4.0f, 0.0f, 9.0f, 3.0f, 0.0f,
+	8.0f, 4.0f, 0.0f, 8.0f, 5.0f, 0.0f, 9.0f, 5.0f,
+	0.0f, 9.0f, 4.0f, 0.0f, 8.0f, 5.0f, 0.0f, 8.0f,
+	6.0f, 0.0f, 9.0f, 6.0f, 0.0f, 9.0f, 5.0f, 0.0f,
+	8.0f, 6.0f, 0.0f, 8.0f, 7.0f, 0.0f, 9.0f, 7.0f,
+	0.0f, 9.0f, 6.0f, 0.0f, 8.0f, 7.0f, 0.0f, 8.0f,
+	8.0f, 0.0f, 9.0f, 8.0f, 0.0f, 9.0f, 7.0f, 0.0f,
+	8.0f, 8.0f, 0.0f, 8.0f, 9.0f, 0.0f, 9.0f, 9.0f,
+	0.0f, 9.0f, 8.0f, 0.0f, 8.0f, 9.0f, 0.0f, 8.0f,
+	10.0f, 0.0f, 9.0f, 10.0f, 0.0f, 9.0f, 9.0f, 0.0f,
+	9.0f, 0.0f, 0.0f, 9.0f, 1.0f, 0.0f, 10.0f, 1.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 9.0f, 1.0f, 0.0f, 9.0f,
+	2.0f, 0.0f, 10.0f, 2.0f, 0.0f, 10.0f, 1.0f, 0.0f,
+	9.0f, 2.0f, 0.0f, 9.0f, 3.0f, 0.0f, 10.0f, 3.0f,
+	0.0f, 10.0f, 2.0f, 0.0f, 9.0f, 3.0f, 0.0f, 9.0f,
+	4.0f, 0.0f, 10.0f, 4.0f, 0.0f, 10.0f, 3.0f, 0.0f,
+	9.0f, 4.0f, 0.0f, 9.0f, 5.0f, 0.0f, 10.0f, 5.0f,
+	0.0f, 10.0f, 4.0f, 0.0f, 9.0f, 5.0f, 0.0f, 9.0f,
+	6.0f, 0.0f, 10.0f, 6.0f, 0.0f, 10.0f, 5.0f, 0.0f,
+	9.0f, 6.0f, 0.0f, 9.0f, 7.0f, 0.0f, 10.0f, 7.0f,
+	0.0f, 10.0f, 6.0f, 0.0f, 9.0f, 7.0f, 0.0f, 9.0f,
+	8.0f, 0.0f, 10.0f, 8.0f, 0.0f, 10.0f, 7.0f, 0.0f,
+	9.0f, 8.0f, 0.0f, 9.0f, 9.0f, 0.0f, 10.0f, 9.0f,
+	0.0f, 10.0f, 8.0f, 0.0f, 9.0f, 9.0f, 0.0f, 9.0f,
+	10.0f, 0.0f, 10.0f, 10.0f, 0.0f, 10.0f, 9.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 1.0f, 0.0f, 11.0f, 1.0f,
+	0.0f, 11.0f, 0.0f, 0.0f, 10.0f, 1.0f, 0.0f, 10.0f,
+	2.0f, 0.0f, 11.0f, 2.0f, 0.0f, 11.0f, 1.0f, 0.0f,
+	10.0f, 2.0f, 0.0f, 10.0f, 3.0f, 0.0f, 11.0f, 3.0f,
+	0.0f, 11.0f, 2.0f, 0.0f, 10.0f, 3.0f, 0.0f, 10.0f,
+	4.0f, 0.0f, 11.0f, 4.0f, 0.0f, 11.0f, 3.0f, 0.0f,
+	10.0f, 4.0f, 0.0f, 10.0f, 5.0f, 0.0f, 11.0f, 5.0f,
+	0.0f, 11.0f, 4.0f, 0.0f, 10.0f, 5.0f, 0.0f, 10.0f,
+	6.0f, 0.0f, 11.0f, 6.0f, 0.0f, 11.0f, 5.0f, 0.0f,
+	10.0f, 6.0f, 0.0f, 10.0f, 7.0f, 0.0f, 11.0f, 7.0f,
+	0.0f, 11.0f, 6.0f, 0.0f, 10.0f, 7.0f, 0.0f, 10.0f,
+	8.0f, 0.0f, 11.0f, 8.0f, 0.0f, 11.0f, 7.0f, 0.0f,
+	10.0f, 8.0f, 0.0f, 10.0f, 9.0f, 0.0f, 11.0f, 9.0f,
+	0.0f, 11.0f, 8.0f, 0.0f, 10.0f, 9.0f, 0.0f, 10.0f,
+	10.0f, 0.0f, 11.0f, 10.0f, 0.0f, 11.0f, 9.0f, 0.0f,
+	11.0f, 0.0f, 0.0f, 11.0f, 1.0f, 0.0f, 12.0f, 1.0f,
+	0.0f, 12.0f, 0.0f, 0.0f, 11.0f, 1.0f, 0.0f, 11.0f,
+	2.0f, 0.0f, 12.0f, 2.0f, 0.0f, 12.0f, 1.0f, 0.0f,
+	11.0f, 2.0f, 0.0f, 11.0f, 3.0f, 0.0f, 12.0f, 3.0f,
+	0.0f, 12.0f, 2.0f, 0.0f, 11.0f, 3.0f, 0.0f, 11.0f,
+	4.0f, 0.0f, 12.0f, 4.0f, 0.0f, 12.0f, 3.0f, 0.0f,
+	11.0f, 4.0f, 0.0f, 11.0f, 5.0f, 0.0f, 12.0f, 5.0f,
+	0.0f, 12.0f, 4.0f, 0.0f, 11.0f, 5.0f, 0.0f, 11.0f,
+	6.0f, 0.0f, 12.0f, 6.0f, 0.0f, 12.0f, 5.0f, 0.0f,
+	11.0f, 6.0f, 0.0f, 11.0f, 7.0f, 0.0f, 12.0f, 7.0f,
+	0.0f, 12.0f, 6.0f, 0.0f, 11.0f, 7.0f, 0.0f, 11.0f,
+	8.0f, 0.0f, 12.0f, 8.0f, 0.0f, 12.0f, 7.0f, 0.0f,
+	11.0f, 8.0f, 0.0f, 11.0f, 9.0f, 0.0f, 12.0f, 9.0f,
+	0.0f, 12.0f, 8.0f, 0.0f, 11.0f, 9.0f, 0.0f, 11.0f,
+	10.0f, 0.0f, 12.0f, 10.0f, 0.0f, 12.0f, 9.0f, 0.0f,
+	12.0f, 0.0f, 0.0f, 12.0f, 1.0f, 0.0f, 13.0f, 1.0f,
+	0.0f, 13.0f, 0.0f, 0.0f, 12.0f, 1.0f, 0.0f, 12.0f,
+	2.0f, 0.0f, 13.0f, 2.0f, 0.0f, 13.0f, 1.0f, 0.0f,
+	12.0f, 2.0f, 0.0f, 12.0f, 3.0f, 0.0f, 13.0f, 3.0f,
+	0.0f, 13.0f, 2.0f, 0.0f, 12.0f, 3.0f, 0.0f, 12.0f,
+	4.0f, 0.0f, 13.0f, 4.0f, 0.0f, 13.0f, 3.0f, 0.0f,
+	12.0f, 4.0f, 0.0f, 12.0f, 5.0f, 0.0f, 13.0f, 5.0f,
+	0.0f, 13.0f, 4.0f, 0.0f, 12.0f, 5.0f, 0.0f, 12.0f,
+	6.0f, 0.0f, 13.0f, 6.0f, 0.0f, 13.0f, 5.0f, 0.0f,
+	12.0f, 6.0f, 0.0f, 12.0f, 7.0f, 0.0f, 13.0f, 7.0f,
+	0.0f, 13.0f, 6.0f, 0.0f, 12.0f, 7.0f, 0.0f, 12.0f,
+	8.0f, 0.0f, 13.0f, 8.0f, 0.0f, 13.0f, 7.0f, 0.0f,
+	12.0f, 8.0f, 0.0f, 12.0f, 9.0f, 0.0f, 13.0f, 9.0f,
+	0.0f, 13.0f, 8.0f, 0.0f, 12.0f, 9.0f, 0.0f, 12.0f,
+	10.0f, 0.0f, 13.0f, 10.0f, 0.0f, 13.0f, 9.0f, 0.0f,
+	13.0f, 0.0f, 0.0f, 13.0f, 1.0f, 0.0f, 14.0f, 1.0f,
+	0.0f, 14.0f, 0.0f, 0.0f, 13.0f, 1.0f, 0.0f, 13.0f,
+	2.0f, 0.0f, 14.0f, 2.0f, 0.0f, 14.0f, 1.0f, 0.0f,
+	13.0f, 2.0f, 0.0f, 13.0f, 3.0f, 0.0f, 14.0f, 3.0f,
+	0.0f, 14.0f, 2.0f, 0.0f, 13.0f, 3.0f, 0.0f, 13.0f,
+	4.0f, 0.0f, 14.0f, 4.0f, 0.0f, 14.0f, 3.0f, 0.0f,
+	13.0f, 4.0f, 0.0f, 13.0f, 5.0f, 0.0f, 14.0f, 5.0f,
+	0.0f, 14.0f, 4.0f, 0.0f, 13.0f, 5.0f, 0.0f, 13.0f,
+	6.0f, 0.0f, 14.0f, 6.0f, 0.0f, 14.0f, 5.0f, 0.0f,
+	13.0f, 6.0f, 0.0f, 13.0f, 7.0f, 0.0f, 14.0f, 7.0f,
+	0.0f, 14.0f, 6.0f, 0.0f, 13.0f, 7.0f, 0.0f, 13.0f,
+	8.0f, 0.0f, 14.0f, 8.0f, 0.0f, 14.0f, 7.0f, 0.0f,
+	13.0f, 8.0f, 0.0f, 13.0f, 9.0f, 0.0f, 14.0f, 9.0f,
+	0.0f, 14.0f, 8.0f, 0.0f, 13.0f, 9.0f, 0.0f, 13.0f,
+	10.0f, 0.0f, 14.0f, 10.0f, 0.0f, 14.0f, 9.0f, 0.0f,
+	14.0f, 0.0f, 0.0f, 14.0f, 1.0f, 0.0f, 15.0f, 1.0f,
+	0.0f, 15.0f, 0.0f, 0.0f, 14.0f, 1.0f, 0.0f, 14.0f,
+	2.0f, 0.0f, 15.0f, 2.0f, 0.0f, 15.0f, 1.0f, 0.0f,
+	14.0f, 2.0f, 0.0f, 14.0f, 3.0f, 0.0f, 15.0f, 3.0f,
+	0.0f, 15.0f, 2.0f, 0.0f, 14.0f, 3.0f, 0.0f, 14.0f,
+	4.0f, 0.0f, 15.0f, 4.0f, 0.0f, 15.0f, 3.0f, 0.0f,
+	14.0f, 4.0f, 0.0f, 14.0f, 5.0f, 0.0f, 15.0f, 5.0f,
+	0.0f, 15.0f, 4.0f, 0.0f, 14.0f, 5.0f, 0.0f, 14.0f,
+	6.0f, 0.0f, 15.0f, 6.0f, 0.0f, 15.0f, 5.0f, 0.0f,
+	14.0f, 6.0f, 0.0f, 14.0f, 7.0f, 0.0f, 15.0f, 7.0f,
+	0.0f, 15.0f, 6.0f, 0.0f, 14.0f, 7.0f, 0.0f, 14.0f,
+	8.0f, 0.0f, 15.0f, 8.0f, 0.0f, 15.0f, 7.0f, 0.0f,
+	14.0f, 8.0f, 0.0f, 14.0f, 9.0f, 0.0f, 15.0f, 9.0f,
+	0.0f, 15.0f, 8.0f, 0.0f, 14.0f, 9.0f, 0.0f, 14.0f,
+	10.0f, 0.0f, 15.0f, 10.0f, 0.0f, 15.0f, 9.0f, 0.0f,
+	15.0f, 0.0f, 0.0f, 15.0f, 1.0f, 0.0f, 16.0f, 1.0f,
+	0.0f, 16.0f, 0.0f, 0.0f, 15.0f, 1.0f, 0.0f, 15.0f,
+	2.0f, 0.0f, 16.0f, 2.0f, 0.0f, 16.0f, 1.0f, 0.0f,
+	15.0f, 2.0f, 0.0f, 15.0f, 3.0f, 0.0f, 16.0f, 3.0f,
+	0.0f, 16.0f, 2.0f, 0.0f, 15.0f, 3.0f, 0.0f, 15.0f,
+	4.0f, 0.0f, 16.0f, 4.0f, 0.0f, 16.0f, 3.0f, 0.0f,
+	15.0f, 4.0f, 0.0f, 15.0f, 5.0f, 0.0f, 16.0f, 5.0f,
+	0.0f, 16.0f, 4.0f, 0.0f, 15.0f, 5.0f, 0.0f, 15.0f,
+	6.0f, 0.0f, 16.0f, 6.0f, 0.0f, 16.0f, 5.0f, 0.0f,
+	15.0f, 6.0f, 0.0f, 15.0f, 7.0f, 0.0f, 16.0f, 7.0f,
+	0.0f, 16.0f, 6.0f, 0.0f, 15.0f, 7.0f, 0.0f, 15.0f,
+	8.0f, 0.0f, 16.0f, 8.0f, 0.0f, 16.0f, 7.0f, 0.0f,
+	15.0f, 8.0f, 0.0f, 15.0f, 9.0f, 0.0f, 16.0f, 9.0f,
+	0.0f, 16.0f, 8.0f, 0.0f, 15.0f, 9.0f, 0.0f, 15.0f,
+	10.0f, 0.0f, 16.0f, 10.0f, 0.0f, 16.0f, 9.0f, 0.0f,
+	16.0f, 0.0f, 0.0f, 16.0f, 1.0f, 0.0f, 17.0f, 1.0f,
+	0.0f, 17.0f, 0.0f, 0.0f, 16.0f, 1.0f, 0.0f, 16.0f,
+	2.0f, 0.0f, 17.0f, 2.0f, 0.0f, 17.0f, 1.0f, 0.0f,
+	16.0f, 2.0f, 0.0f, 16.0f, 3.0f, 0.0f, 17.0f, 3.0f,
+	0.0f, 17.0f, 2.0f, 0.0f, 16.0f, 3.0f, 0.0f, 16.0f,
+	4.0f, 0.0f, 17.0f, 4.0f, 0.0f, 17.0f, 3.0f, 0.0f,
+	16.0f, 4.0f, 0.0f, 16.0f, 5.0f, 0.0f, 17.0f, 5.0f,
+	0.0f, 17.0f, 4.0f, 0.0f, 16.0f, 5.0f, 0.0f, 16.0f,
+	6.0f, 0.0f, 17.0f, 6.0f, 0.0f, 17.0f, 5.0f, 0.0f,
+	16.0f, 6.0f, 0.0f, 16.0f, 7.0f, 0.0f, 17.0f, 7.0f,
+	0.0f, 17.0f, 6.0f, 0.0f, 16.0f, 7.0f, 0.0f, 16.0f,
+	8.0f, 0.0f, 17.0f, 8.0f, 0.0f, 17.0f, 7.0f, 0.0f,
+	16.0f, 8.0f, 0.0f, 16.0f, 9.0f, 0.0f, 17.0f, 9.0f,
+	0.0f, 17.0f, 8.0f, 0.0f, 16.0f, 9.0f, 0.0f, 16.0f,
+	10.0f, 0.0f, 17.0f, 10.0f, 0.0f, 17.0f, 9.0f, 0.0f,
+	17.0f, 0.0f, 0.0f, 17.0f, 1.0f, 0.0f, 18.0f, 1.0f,
+	0.0f, 18.0f, 0.0f, 0.0f, 17.0f, 1.0f, 0.0f, 17.0f,
+	2.0f, 0.0f, 18.0f, 2.0f, 0.0f, 18.0f, 1.0f, 0.0f,
+	17.0f, 2.0f, 0.0f, 17.0f, 3.0f, 0.0f, 18.0f, 3.0f,
+	0.0f, 18.0f, 2.0f, 0.0f, 17.0f, 3.0f, 0.0f, 17.0f,
+	4.0f, 0.0f, 18.0f, 4.0f, 0.0f, 18.0f, 3.0f, 0.0f,
+	17.0f, 4.0f, 0.0f, 17.0f, 5.0f, 0.0f, 18.0f, 5.0f,
+	0.0f, 18.0f, 4.0f, 0.0f, 17.0f, 5.0f, 0.0f, 17.0f,
+	6.0f, 0.0f, 18.0f, 6.0f, 0.0f, 18.0f, 5.0f, 0.0f,
+	17.0f, 6.0f, 0.0f, 17.0f, 7.0f, 0.0f, 18.0f, 7.0f,
+	0.0f, 18.0f, 6.0f, 0.0f, 17.0f, 7.0f, 0.0f, 17.0f,
+	8.0f, 0.0f, 18.0f, 8.0f, 0.0f, 18.0f, 7.0f, 0.0f,
+	17.0f, 8.0f, 0.0f, 17.0f, 9.0f, 0.0f, 18.0f, 9.0f,
+	0.0f, 18.0f, 8.0f, 0.0f, 17.0f, 9.0f, 0.0f, 17.0f,
+	10.0f, 0.0f, 18.0f, 10.0f, 0.0f, 18.0f, 9.0f, 0.0f,
+	18.0f, 0.0f, 0.0f, 18.0f, 1.0f, 0.0f, 19.0f, 1.0f,
+	0.0f, 19.0f, 0.0f, 0.0f, 18.0f, 1.0f, 0.0f, 18.0f,
+	2.0f, 0.0f, 19.0f, 2.0f, 0.0f, 19.0f, 1.0f, 0.0f,
+	18.0f, 2.0f, 0.0f, 18.0f, 3.0f, 0.0f, 19.0f, 3.0f,
+	0.0f, 19.0f, 2.0f, 0.0f, 18.0f, 3.0f, 0.0f, 18.0f,
+	4.0f, 0.0f, 19.0f, 4.0f, 0.0f, 19.0f, 3.0f, 0.0f,
+	18.0f, 4.0f, 0.0f, 18.0f, 5.0f, 0.0f, 19.0f, 5.0f,
+	0.0f, 19.0f, 4.0f, 0.0f, 18.0f, 5.0f, 0.0f, 18.0f,
+	6.0f, 0.0f, 19.0f, 6.0f, 0.0f, 19.0f, 5.0f, 0.0f,
+	18.0f, 6.0f, 0.0f, 18.0f, 7.0f, 0.0f, 19.0f, 7.0f,
+	0.0f, 19.0f, 6.0f, 0.0f, 18.0f, 7.0f, 0.0f, 18.0f,
+	8.0f, 0.0f, 19.0f, 8.0f, 0.0f, 19.0f, 7.0f, 0.0f,
+	18.0f, 8.0f, 0.0f, 18.0f, 9.0f, 0.0f, 19.0f, 9.0f,
+	0.0f, 19.0f, 8.0f, 0.0f, 18.0f, 9.0f, 0.0f, 18.0f,
+	10.0f, 0.0f, 19.0f, 10.0f, 0.0f, 19.0f, 9.0f, 0.0f,
+	19.0f, 0.0f, 0.0f, 19.0f, 1.0f, 0.0f, 20.0f, 1.0f,
+	0.0f, 20.0f, 0.0f, 0.0f, 19.0f, 1.0f, 0.0f, 19.0f,
+	2.0f, 0.0f, 20.0f, 2.0f, 0.0f, 20.0f, 1.0f, 0.0f,
+	19.0f, 2.0f, 0.0f, 19.0f, 3.0f, 0.0f, 20.0f, 3.0f,
+	0.0f, 20.0f, 2.0f, 0.0f, 19.0f, 3.0f, 0.0f, 19.0f,
+	4.0f, 0.0f, 20.0f, 4.0f, 0.0f, 20.0f, 3.0f, 0.0f,
+	19.0f, 4.0f, 0.0f, 19.0f, 5.0f, 0.0f, 20.0f, 5.0f,
+	0.0f, 20.0f, 4.0f, 0.0f, 19.0f, 5.0f, 0.0f, 19.0f,
+	6.0f, 0.0f, 20.0f, 6.0f, 0.0f, 20.0f, 5.0f, 0.0f,
+	19.0f, 6.0f, 0.0f, 19.0f, 7.0f, 0.0f, 20.0f, 7.0f,
+	0.0f, 20.0f, 6.0f, 0.0f, 19.0f, 7.0f, 0.0f, 19.0f,
+	8.0f, 0.0f, 20.0f, 8.0f, 0.0f, 20.0f, 7.0f, 0.0f,
+	19.0f, 8.0f, 0.0f, 19.0f, 9.0f, 0.0f, 20.0f, 9.0f,
+	0.0f, 20.0f, 8.0f, 0.0f, 19.0f, 9.0f, 0.0f, 19.0f,
+	10.0f, 0.0f, 20.0f, 10.0f, 0.0f, 20.0f, 9.0f, 0.0f
+};
+static const float planeNormals[2400] =
+{
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f
+};
+static const float planeTexCoords[1600] =
+{
+	0.0f, 0.0f, 0.0f, 0.1f, 0.05f, 0.1f, 0.05f, 0.0f,
+	0.0f, 0.1f, 0.0f, 0.2f, 0.05f, 0.2f, 0.05f, 0.1f,
+	0.0f, 0.2f, 0.0f, 0.3f, 0.05f, 0.3f, 0.05f, 0.2f,
+	0.0f, 0.3f, 0.0f, 0.4f, 0.05f, 0.4f, 0.05f, 0.3f,
+	0.0f, 0.4f, 0.0f, 0.5f, 0.05f, 0.5f, 0.05f, 0.4f,
+	0.0f, 0.5f, 0.0f, 0.6f, 0.05f, 0.6f, 0.05f, 0.5f,
+	0.0f, 0.6f, 0.0f, 0.7f, 0.05f, 0.7f, 0.05f, 0.6f,
+	0.0f, 0.7f, 0.0f, 0.8f, 0.05f, 0.8f, 0.05f, 0.7f,
+	0.0f, 0.8f, 0.0f, 0.90000004f, 0.05f, 0.90000004f, 0.05f, 0.8f,
+	0.0f, 0.90000004f, 0.0f, 1.0f, 0.05f, 1.0f, 0.05f, 0.90000004f,
+	0.05f, 0.0f, 0.05f, 0.1f, 0.1f, 0.1f, 0.1f, 0.0f,
+	0.05f, 0.1f, 0.05f, 0.2f, 0.1f, 0.2f, 0.1f, 0.1f,
+	0.05f, 0.2f, 0.05f, 0.3f, 0.1f, 0.3f, 0.1f, 0.2f,
+	0.05f, 0.3f, 0.05f, 0.4f, 0.1f, 0.4f, 0.1f, 0.3f,
+	0.05f, 0.4f, 0.05f, 0.5f, 0.1f, 0.5f, 0.1f, 0.4f,
+	0.05f, 0.5f, 0.05f, 0.6f, 0.1f, 0.6f, 0.1f, 0.5f,
+	0.05f, 0.6f, 0.05f, 0.7f, 0.1f, 0.7f, 0.1f, 0.6f,
+	0.05f, 0.7f, 0.05f, 0.8f, 0.1f, 0.8f, 0.1f, 0.7f,
+	0.05f, 0.8f, 0.05f, 0.90000004f, 0.1f, 0.90000004f, 0.1f, 0.8f,
+	0.05f, 0.90000004f, 0.05f, 1.0f, 0.1f, 1.0f, 0.1f, 0.90000004f,
+	0.1f, 0.0f, 0.1f, 0.1f, 0.15f, 0.1f, 0.15f, 0.0f,
+	0.1f, 0.1f, 0.1f, 0.2f, 0.15f, 0.2f, 0.15f, 0.1f,
+	0.1f, 0.2f, 0.1f, 0.3f, 0.15f, 0.3f, 0.15f, 0.2f,
+	0.1f, 0.3f, 0.1f, 0.4f, 0.15f, 0.4f, 0.15f, 0.3f,
+	0.1f, 0.4f, 0.1f, 0.5f, 0.15f, 0.5f, 0.15f, 0.4f,
+	0.1f, 0.5f, 0.1f, 0.6f, 0.15f, 0.6f, 0.15f, 0.5f,
+	0.1f, 0.6f, 0.1f, 0.7f, 0.15f, 0.7f, 0.15f, 0.6f,
+	0.1f, 0.7f, 0.1f, 0.8f, 0.15f, 0.8f, 0.15f, 0.7f,
+	0.1f, 0.8f, 0.1f, 0.90000004f, 0.15f, 0.90000004f, 0.15f, 0.8f,
+	0.1f, 0.90000004f, 0.1f, 1.0f, 0.15f, 1.0f, 0.15f, 0.90000004f,
+	0.15f, 0.0f, 0.15f, 0.1f, 0.2f, 0.1f, 0.2f, 0.0f,
+	0.15f, 0.1f, 0.15f, 0.2f, 0.2f, 0.2f, 0.2f, 0.1f,
+	0.15f, 0.2f, 0.15f, 0.3f, 0.2f, 0.3f, 0.2f, 0.2f,
+	0.15f, 0.3f, 0.15f, 0.4f, 0.2f, 0.4f, 0.2f, 0.3f,
+	0.15f, 0.4f, 0.15f, 0.5f, 0.2f, 0.5f, 0.2f, 0.4f,
+	0.15f, 0.5f, 0.15f, 0.6f, 0.2f, 0.6f, 0.2f, 0.5f,
+	0.15f, 0.6f, 0.15f, 0.7f, 0.2f, 0.7f, 0.2f, 0.6f,
+	0.15f, 0.7f, 0.15f, 0.8f, 0.2f, 0.8f, 0.2f, 0.7f,
+	0.15f, 0.8f, 0.15f, 0.90000004f, 0.2f, 0.90000004f, 0.2f, 0.8f,
+	0.15f, 0.90000004f, 0.15f, 1.0f, 0.2f, 1.0f, 0.2f, 0.90000004f,
+	0.2f, 0.0f, 0.2f, 0.1f, 0.25f, 0.1f, 0.25f, 0.0f,
+	0.2f, 0.1f, 0.2f, 0.2f, 0.25f, 0.2f, 0.25f, 0.1f,
+	0.2f, 0.2f, 0.2f, 0.3f, 0.25f, 0.3f, 0.25f, 0.2f,
+	0.2f, 0.3f, 0.2f, 0.4f, 0.25f, 0.4f, 0.25f, 0.3f,
+	0.2f, 0.4f, 0.2f, 0.5f, 0.25f, 0.5f, 0.25f, 0.4f,
+	0.2f, 0.5f, 0.2f, 0.6f, 0.25f, 0.6f, 0.25f, 0.5f,
+	0.2f, 0.6f, 0.2f, 0.7f, 0.25f, 0.7f, 0.25f, 0.6f,
+	0.2f, 0.7f, 0.2f, 0.8f, 0.25f, 0.8f, 0.25f, 0.7f,
+	0.2f, 0.8f, 0.2f, 0.90000004f, 0.25f, 0.90000004f, 0.25f, 0.8f,
+	0.2f, 0.90000004f, 0.2f, 1.0f, 0.25f, 1.0f, 0.25f, 0.90000004f,
+	0.25f, 0.0f, 0.25f, 0.1f, 0.3f, 0.1f, 0.3f, 0.0f,
+	0.25f, 0.1f, 0.25f, 0.2f, 0.3f, 0.2f, 0.3f, 0.1f,
+	0.25f, 0.2f, 0.25f, 0.3f, 0.3f, 0.3f, 0.3f, 0.2f,
+	0.25f, 0.3f, 0.25f, 0.4f, 0.3f, 0.4f, 0.3f, 0.3f,
+	0.25f, 0.4f, 0.25f, 0.5f, 0.3f, 0.5f, 0.3f, 0.4f,
+	0.25f, 0.5f, 0.25f, 0.6f, 0.3f, 0.6f, 0.3f, 0.5f,
+	0.25f, 0.6f, 0.25f, 0.7f, 0.3f, 0.7f, 0.3f, 0.6f,
+	0.25f, 0.7f, 0.25f, 0.8f, 0.3f, 0.8f, 0.3f, 0.7f,
+	0.25f, 0.8f, 0.25f, 0.90000004f, 0.3f, 0.90000004f, 0.3f, 0.8f,
+	0.25f, 0.90000004f, 0.25f, 1.0f, 0.3f, 1.0f, 0.3f, 0.90000004f,
+	0.3f, 0.0f, 0.3f, 0.1f, 0.35f, 0.1f, 0.35f, 0.0f,
+	0.3f, 0.1f, 0.3f, 0.2f, 0.35f, 0.2f, 0.35f, 0.1f,
+	0.3f, 0.2f, 0.3f, 0.3f, 0.35f, 0.3f, 0.35f, 0.2f,
+	0.3f, 0.3f, 0.3f, 0.4f, 0.35f, 0.4f, 0.35f, 0.3f,
+	0.3f, 0.4f, 0.3f, 0.5f, 0.35f, 0.5f, 0.35f, 0.4f,
+	0.3f, 0.5f, 0.3f, 0.6f, 0.35f, 0.6f, 0.35f, 0.5f,
+	0.3f, 0.6f, 0.3f, 0.7f, 0.35f, 0.7f, 0.35f, 0.6f,
+	0.3f, 0.7f, 0.3f, 0.8f, 0.35f, 0.8f, 0.35f, 0.7f,
+	0.3f, 0.8f, 0.3f, 0.90000004f, 0.35f, 0.90000004f, 0.35f, 0.8f,
+	0.3f, 0.90000004f, 0.3f, 1.0f, 0.35f, 1.0f, 0.35f, 0.90000004f,
+	0.35f, 0.0f, 0.35f, 0.1f, 0.4f, 0.1f, 0.4f, 0.0f,
+	0.35f, 0.1f, 0.35f, 0.2f, 0.4f, 0.2f, 0.4f, 0.1f,
+	0.35f, 0.2f, 0.35f, 0.3f, 0.4f, 0.3f, 0.4f, 0.2f,
+	0.35f, 0.3f, 0.35f, 0.4f, 0.4f, 0.4f, 0.4f, 0.3f,
+	0.35f, 0.4f, 0.35f, 0.5f, 0.4f, 0.5f, 0.4f, 0.4f,
+	0.35f, 0.5f, 0.35f, 0.6f, 0.4f, 0.6f, 0.4f, 0.5f,
+	0.35f, 0.6f, 0.35f, 0.7f, 0.4f, 0.7f, 0.4f, 0.6f,
+	0.35f, 0.7f, 0.35f, 0.8f, 0.4f, 0.8f, 0.4f, 0.7f,
+	0.35f, 0.8f, 0.35f, 0.90000004f, 0.4f, 0.90000004f, 0.4f, 0.8f,
+	0.35f, 0.90000004f, 0.35f, 1.0f, 0.4f, 1.0f, 0.4f, 0.90000004f,
+	0.4f, 0.0f, 0.4f, 0.1f, 0.45000002f, 0.1f, 0.45000002f, 0.0f,
+	0.4f, 0.1f, 0.4f, 0.2f, 0.45000002f, 0.2f, 0.45000002f, 0.1f,
+	0.4f, 0.2f, 0.4f, 0.3f, 0.45000002f, 0.3f, 0.45000002f, 0.2f,
+	0.4f, 0.3f, 0.4f, 0.4f, 0.45000002f, 0.4f, 0.45000002f, 0.3f,
+	0.4f, 0.4f, 0.4f, 0.5f, 0.45000002f, 0.5f, 0.45000002f, 0.4f,
+	0.4f, 0.5f, 0.4f, 0.6f, 0.45000002f, 0.6f, 0.45000002f, 0.5f,
+	0.4f, 0.6f, 0.4f, 0.7f, 0.45000002f, 0.7f, 0.45000002f, 0.6f,
+	0.4f, 0.7f, 0.4f, 0.8f, 0.45000002f, 0.8f, 0.45000002f, 0.7f,
+	0.4f, 0.8f, 0.4f, 0.90000004f, 0.45000002f, 0.90000004f, 0.45000002f, 0.8f,
+	0.4f, 0.90000004f, 0.4f, 1.0f, 0.45000002f, 1.0f, 0.45000002f, 0.90000004f,
+	0.45000002f, 0.0f, 0.45000002f, 0.1f, 0.5f, 0.1f, 0.5f, 0.0f,
+	0.45000002f, 0.1f, 0.45000002f, 0.2f, 0.5f, 0.2f, 0.5f, 0.1f,
+	0.45000002f, 0.2f, 0.45000002f, 0.3f, 0.5f, 0.3f, 0.5f, 0.2f,
+	0.45000002f, 0.3f, 0.45000002f, 0.4f, 0.5f, 0.4f, 0.5f, 0.3f,
+	0.45000002f, 0.4f, 0.45000002f, 0.5f, 0.5f, 0.5f, 0.5f, 0.4f,
+	0.45000002f, 0.5f, 0.45000002f, 0.6f, 0.5f, 0.6f, 0.5f, 0.5f,
+	0.45000002f, 0.6f, 0.45000002f, 0.7f, 0.5f, 0.7f, 0.5f, 0.6f,
+	0.45000002f, 0.7f, 0.45000002f, 0.8f, 0.5f, 0.8f, 0.5f, 0.7f,
+	0.45000002f, 0.8f, 0.45000002f, 0.90000004f, 0.5f, 0.90000004f, 0.5f, 0.8f,
+	0.45000002f, 0.90000004f, 0.45000002f, 1.0f, 0.5f, 1.0f, 0.5f, 0.90000004f,
+	0.5f, 0.0f, 0.5f, 0.1f, 0.55f, 0.1f, 0.55f, 0.0f,
+	0.5f, 0.1f, 0.5f, 0.2f, 0.55f, 0.2f, 0.55f, 0.1f,
+	0.5f, 0.2f, 0.5f, 0.3f, 0.55f, 0.3f, 0.55f, 0.2f,
+	0.5f, 0.3f, 0.5f, 0.4f, 0.55f, 0.4f, 0.55f, 0.3f,
+	0.5f, 0.4f, 0.5f, 0.5f, 0.55f, 0.5f, 0.55f, 0.4f,
+	0.5f, 0.5f, 0.5f, 0.6f, 0.55f, 0.6f, 0.55f, 0.5f,
+	0.5f, 0.6f, 0.5f, 0.7f, 0.55f, 0.7f, 0.55f, 0.6f,
+	0.5f, 0.7f, 0.5f, 0.8f, 0.55f, 0.8f, 0.55f, 0.7f,
+	0.5f, 0.8f, 0.5f, 0.90000004f, 0.55f, 0.90000004f, 0.55f, 0.8f,
+	0.5f, 0.90000004f, 0.5f, 1.0f, 0.55f, 1.0f, 0.55f, 0.90000004f,
+	0.55f, 0.0f, 0.55f, 0.1f, 0.6f, 0.1f, 0.6f, 0.0f,
+	0.55f, 0.1f, 0.55f, 0.2f, 0.6f, 0.2f, 0.6f, 0.1f,
+	0.55f, 0.2f, 0.55f, 0.3f, 0.6f, 0.3f, 0.6f, 0.2f,
+	0.55f, 0.3f, 0.55f, 0.4f, 0.6f, 0.4f, 0.6f, 0.3f,
+	0.55f, 0.4f, 0.55f, 0.5f, 0.6f, 0.5f, 0.6f, 0.4f,
+	0.55f, 0.5f, 0.55f, 0.6f, 0.6f, 0.6f, 0.6f, 0.5f,
+	0.55f, 0.6f, 0.55f, 0.7f, 0.6f, 0.7f, 0.6f, 0.6f,
+	0.55f, 0.7f, 0.55f, 0.8f, 0.6f, 0.8f, 0.6f, 0.7f,
+	0.55f, 0.8f, 0.55f, 0.90000004f, 0.6f, 0.90000004f, 0.6f, 0.8f,
+	0.55f, 0.90000004f, 0.55f, 1.0f, 0.6f, 1.0f, 0.6f, 0.90000004f,
+	0.6f, 0.0f, 0.6f, 0.1f, 0.65000004f, 0.1f, 0.65000004f, 0.0f,
+	0.6f, 0.1f, 0.6f, 0.2f, 0.65000004f, 0.2f, 0.65000004f, 0.1f,
+	0.6f, 0.2f, 0.6f, 0.3f, 0.65000004f, 0.3f, 0.65000004f, 0.2f,
+	0.6f, 0.3f, 0.6f, 0.4f, 0.65000004f, 0.4f, 0.65000004f, 0.3f,
+	0.6f, 0.4f, 0.6f, 0.5f, 0.65000004f, 0.5f, 0.65000004f, 0.4f,
+	0.6f, 0.5f, 0.6f, 0.6f, 0.65000004f, 0.6f, 0.65000004f, 0.5f,
+	0.6f, 0.6f, 0.6f, 0.7f, 0.65000004f, 0.7f, 0.65000004f, 0.6f,
+	0.6f, 0.7f, 0.6f, 0.8f, 0.65000004f, 0.8f, 0.65000004f, 0.7f,
+	0.6f, 0.8f, 0.6f, 0.90000004f, 0.65000004f, 0.90000004f, 0.65000004f, 0.8f,
+	0.6f, 0.90000004f, 0.6f, 1.0f, 0.65000004f, 1.0f, 0.65000004f, 0.90000004f,
+	0.65000004f, 0.0f, 0.65000004f, 0.1f, 0.7f, 0.1f, 0.7f, 0.0f,
+	0.65000004f, 0.1f, 0.65000004f, 0.2f, 0.7f, 0.2f, 0.7f, 0.1f,
+	0.65000004f, 0.2f, 0.65000004f, 0.3f, 0.7f, 0.3f, 0.7f, 0.2f,
+	0.65000004f, 0.3f, 0.65000004f, 0.4f, 0.7f, 0.4f, 0.7f, 0.3f,
+	0.65000004f, 0.4f, 0.65000004f, 0.5f, 0.7f, 0.5f, 0.7f, 0.4f,
+	0.65000004f, 0.5f, 0.65000004f, 0.6f, 0.7f, 0.6f, 0.7f, 0.5f,
+	0.65000004f, 0.6f, 0.65000004f, 0.7f, 0.7f, 0.7f, 0.7f, 0.6f,
+	0.65000004f, 0.7f, 0.65000004f, 0.8f, 0.7f, 0.8f, 0.7f, 0.7f,
+	0.65000004f, 0.8f, 0.65000004f, 0.90000004f, 0.7f, 0.90000004f, 0.7f, 0.8f,
+	0.65000004f, 0.90000004f, 0.65000004f, 1.0f, 0.7f, 1.0f, 0.7f, 0.90000004f,
+	0.7f, 0.0f, 0.7f, 0.1f, 0.75f, 0.1f, 0.75f, 0.0f,
+	0.7f, 0.1f, 0.7f, 0.2f, 0.75f, 0.2f, 0.75f, 0.1f,
+	0.7f, 0.2f, 0.7f, 0.3f, 0.75f, 0.3f, 0.75f, 0.2f,
+	0.7f, 0.3f, 0.7f, 0.4f, 0.75f, 0.4f, 0.75f, 0.3f,
+	0.7f, 0.4f, 0.7f, 0.5f, 0.75f, 0.5f, 0.75f, 0.4f,
+	0.7f, 0.5f, 0.7f, 0.6f, 0.75f, 0.6f, 0.75f, 0.5f,
+	0.7f, 0.6f, 0.7f, 0.7f, 0.75f, 0.7f, 0.75f, 0.6f,
+	0.7f, 0.7f, 0.7f, 0.8f, 0.75f, 0.8f, 0.75f, 0.7f,
+	0.7f, 0.8f, 0.7f, 0.90000004f, 0.75f, 0.90000004f, 0.75f, 0.8f,
+	0.7f, 0.90000004f, 0.7f, 1.0f, 0.75f, 1.0f, 0.75f, 0.90000004f,
+	0.75f, 0.0f, 0.75f, 0.1f, 0.8f, 0.1f, 0.8f, 0.0f,
+	0.75f, 0.1f, 0.75f, 0.2f, 0.8f, 0.2f, 0.8f, 0.1f,
+	0.75f, 0.2f, 0.75f, 0.3f, 0.8f, 0.3f, 0.8f, 0.2f,
+	0.75f, 0.3f, 0.75f, 0.4f, 0.8f, 0.4f, 0.8f, 0.3f,
+	0.75f, 0.4f, 0.75f, 0.5f, 0.8f, 0.5f, 0.8f, 0.4f,
+	0.75f, 0.5f, 0.75f, 0.6f, 0.8f, 0.6f, 0.8f, 0.5f,
+	0.75f, 0.6f, 0.75f, 0.7f, 0.8f, 0.7f, 0.8f, 0.6f,
+	0.75f, 0.7f, 0.75f, 0.8f, 0.8f, 0.8f, 0.8f, 0.7f,
+	0.75f, 0.8f, 0.75f, 0.90000004f, 0.8f, 0.90000004f, 0.8f, 0.8f,
+	0.75f, 0.90000004f, 0.75f, 1.0f, 0.8f, 1.0f, 0.8f, 0.90000004f,
+	0.8f, 0.0f, 0.8f, 0.1f, 0.85f, 0.1f, 0.85f, 0.0f,
+	0.8f, 0.1f, 0.8f, 0.2f, 0.85f, 0.2f, 0.85f, 0.1f,
+	0.8f, 0.2f, 0.8f, 0.3f, 0.85f, 0.3f, 0.85f, 0.2f,
+	0.8f, 0.3f, 0.8f, 0.4f, 0.85f, 0.4f, 0.85f, 0.3f,
+	0.8f, 0.4f, 0.8f, 0.5f, 0.85f, 0.5f, 0.85f, 0.4f,
+	0.8f, 0.5f, 0.8f, 0.6f, 0.85f, 0.6f, 0.85f, 0.5f,
+	0.8f, 0.6f, 0.8f, 0.7f, 0.85f, 0.7f, 0.85f, 0.6f,
+	0.8f, 0.7f, 0.8f, 0.8f, 0.85f, 0.8f, 0.85f, 0.7f,
+	0.8f, 0.8f, 0.8f, 0.90000004f, 0.85f, 0.90000004f, 0.85f, 0.8f,
+	0.8f, 0.90000004f, 0.8f, 1.0f, 0.85f, 1.0f, 0.85f, 0.90000004f,
+	0.85f, 0.0f, 0.85f, 0.1f, 0.90000004f, 0.1f, 0.90000004f, 0.0f,
+	0.85f, 0.1f, 0.85f, 0.2f, 0.90000004f, 0.2f, 0.90000004f, 0.1f,
+	0.85f, 0.2f, 0.85f, 0.3f, 0.90000004f, 0.3f, 0.90000004f, 0.2f,
+	0.85f, 0.3f, 0.85f, 0.4f, 0.90000004f, 0.4f, 0.90000004f, 0.3f,
+	0.85f, 0.4f, 0.85f, 0.5f, 0.90000004f, 0.5f, 0.90000004f, 0.4f,
+	0.85f, 0.5f, 0.85f, 0.6f, 0.90000004f, 0.6f, 0.90000004f, 0.5f,
+	0.85f, 0.6f, 0.85f, 0.7f, 0.90000004f, 0.7f, 0.90000004f, 0.6f,
+	0.85f, 0.7f, 0.85f, 0.8f, 0.90000004f, 0.8f, 0.90000004f, 0.7f,
+	0.85f, 0.8f, 0.85f, 0.90000004f, 0.90000004f, 0.90000004f, 0.90000004f, 0.8f,
+	0.85f, 0.90000004f, 0.85f, 1.0f, 0.90000004f, 1.0f, 0.90000004f, 0.90000004f,
+	0.90000004f, 0.0f, 0.90000004f, 0.1f, 0.95f, 0.1f, 0.95f, 0.0f,
+	0.90000004f, 0.1f, 0.90000004f, 0.2f, 0.95f, 0.2f, 0.95f, 0.1f,
+	0.90000004f, 0.2f, 0.90000004f, 0.3f, 0.95f, 0.3f, 0.95f, 0.2f,
+	0.90000004f, 0.3f, 0.90000004f, 0.4f, 0.95f, 0.4f, 0.95f, 0.3f,
+	0.90000004f, 0.4f, 0.90000004f, 0.5f, 0.95f, 0.5f, 0.95f, 0.4f,
+	0.90000004f, 0.5f, 0.90000004f, 0.6f, 0.95f, 0.6f, 0.95f, 0.5f,
+	0.90000004f, 0.6f, 0.90000004f, 0.7f, 0.95f, 0.7f, 0.95f, 0.6f,
+	0.90000004f, 0.7f, 0.90000004f, 0.8f, 0.95f, 0.8f, 0.95f, 0.7f,
+	0.90000004f, 0.8f, 0.90000004f, 0.90000004f, 0.95f, 0.90000004f, 0.95f, 0.8f,
+	0.90000004f, 0.90000004f, 0.90000004f, 1.0f, 0.95f, 1.0f, 0.95f, 0.90000004f,
+	0.95f, 0.0f, 0.95f, 0.1f, 1.0f, 0.1f, 1.0f, 0.0f,
+	0.95f, 0.1f, 0.95f, 0.2f, 1.0f, 0.2f, 1.0f, 0.1f,
+	0.95f, 0.2f, 0.95f, 0.3f, 1.0f, 0.3f, 1.0f, 0.2f,
+	0.95f, 0.3f, 0.95f, 0.4f, 1.0f, 0.4f, 1.0f, 0.3f,
+	0.95f, 0.4f, 0.95f, 0.5f, 1.0f, 0.5f, 1.0f, 0.4f,
+	0.95f, 0.5f, 0.95f, 0.6f, 1.0f, 0.6f, 1.0f, 0.5f,
+	0.95f, 0.6f, 0.95f, 0.7f, 1.0f, 0.7f, 1.0f, 0.6f,
+	0.95f, 0.7f, 0.95f, 0.8f, 1.0f, 0.8f, 1.0f, 0.7f,
+	0.95f, 0.8f, 0.95f, 0.90000004f, 1.0f, 0.90000004f, 1.0f, 0.8f,
+	0.95f, 0.90000004f, 0.95f, 1.0f, 1.0f, 1.0f, 1.0f, 0.90000004f
+};
+
+ShapeArrays BakedTables::plane()
+{
+	ShapeArrays arrays = { planeVertex, planeNormals, planeTexCoords, NULL, 800, 0, 1.0f, 20.0f };
+	return arrays;
+}
+
+// ShapeGen::genCuboid(1, 20)
+static const float cuboidVertex[9600] =
+{
+	0.0f, 0.0f, 0.0f, 0.0f, 0.1f, 0.0f, 1.0f, 0.1f,
+	0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.1f, 0.0f, 0.0f,
+	0.2f, 0.0f, 1.0f, 0.2f, 0.0f, 1.0f, 0.1f, 0.0f,
+	0.0f, 0.2f, 0.0f, 0.0f, 0.3f, 0.0f, 1.0f, 0.3f,
+	0.0f, 1.0f, 0.2f, 0.0f, 0.0f, 0.3f, 0.0f, 0.0f,
+	0.4f, 0.0f, 1.0f, 0.4f, 0.0f, 1.0f, 0.3f, 0.0f,
+	0.0f, 0.4f, 0.0f, 0.0f, 0.5f, 0.0f, 1.0f, 0.5f,
+	0.0f, 1.0f, 0.4f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f,
+	0.6f, 0.0f, 1.0f, 0.6f, 0.0f, 1.0f, 0.5f, 0.0f,
+	0.0f, 0.6f, 0.0f, 0.0f, 0.7f, 0.0f, 1.0f, 0.7f,
+	0.0f, 1.0f, 0.6f, 0.0f, 0.0f, 0.7f, 0.0f, 0.0f,
+	0.8f, 0.0f, 1.0f, 0.8f, 0.0f, 1.0f, 0.7f, 0.0f,
+	0.0f, 0.8f, 0.0f, 0.0f, 0.90000004f, 0.0f, 1.0f, 0.90000004f,
+	0.0f, 1.0f, 0.8f, 0.0f, 0.0f, 0.90000004f, 0.0f, 0.0f,
+	1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.90000004f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.1f, 0.0f, 2.0f, 0.1f,
+	0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 0.1f, 0.0f, 1.0f,
+	0.2f, 0.0f, 2.0f, 0.2f, 0.0f, 2.0f, 0.1f, 0.0f,
+	1.0f, 0.2f, 0.0f, 1.0f, 0.3f, 0.0f, 2.0f, 0.3f,
+	0.0f, 2.0f, 0.2f, 0.0f, 1.0f, 0.3f, 0.0f, 1.0f,
+	0.4f, 0.0f, 2.0f, 0.4f, 0.0f, 2.0f, 0.3f, 0.0f,
+	1.0f, 0.4f, 0.0f, 1.0f, 0.5f, 0.0f, 2.0f, 0.5f,
+	0.0f, 2.0f, 0.4f, 0.0f, 1.0f, 0.5f, 0.0f, 1.0f,
+	0.6f, 0.0f, 2.0f, 0.6f, 0.0f, 2.0f, 0.5f, 0.0f,
+	1.0f, 0.6f, 0.0f, 1.0f, 0.7f, 0.0f, 2.0f, 0.7f,
+	0.0f, 2.0f, 0.6f, 0.0f, 1.0f, 0.7f, 0.0f, 1.0f,
+	0.8f, 0.0f, 2.0f, 0.8f, 0.0f, 2.0f, 0.7f, 0.0f,
+	1.0f, 0.8f, 0.0f, 1.0f, 0.90000004f, 0.0f, 2.0f, 0.90000004f,
+	0.0f, 2.0f, 0.8f, 0.0f, 1.0f, 0.90000004f, 0.0f, 1.0f,
+	1.0f, 0.0f, 2.0f, 1.0f, 0.0f, 2.0f, 0.90000004f, 0.0f,
+	2.0f, 0.0f, 0.0f, 2.0f, 0.1f, 0.0f, 3.0f, 0.1f,
+	0.0f, 3.0f, 0.0f, 0.0f, 2.0f, 0.1f, 0.0f, 2.0f,
+	0.2f, 0.0f, 3.0f, 0.2f, 0.0f, 3.0f, 0.1f, 0.0f,
+	2.0f, 0.2f, 0.0f, 2.0f, 0.3f, 0.0f, 3.0f, 0.3f,
+	0.0f, 3.0f, 0.2f, 0.0f, 2.0f, 0.3f, 0.0f, 2.0f,
+	0.4f, 0.0f, 3.0f, 0.4f, 0.0f, 3.0f, 0.3f, 0.0f,
+	2.0f, 0.4f, 0.0f, 2.0f, 0.5f, 0.0f, 3.0f, 0.5f,
+	0.0f, 3.0f, 0.4f, 0.0f, 2.0f, 0.5f, 0.0f, 2.0f,
+	0.6f, 0.0f, 3.0f, 0.6f, 0.0f, 3.0f, 0.5f, 0.0f,
+	2.0f, 0.6f, 0.0f, 2.0f, 0.7f, 0.0f, 3.0f, 0.7f,
+	0.0f, 3.0f, 0.6f, 0.0f, 2.0f, 0.7f, 0.0f, 2.0f,
+	0.8f, 0.0f, 3.0f, 0.8f, 0.0f, 3.0f, 0.7f, 0.0f,
+	2.0f, 0.8f, 0.0f, 2.0f, 0.90000004f, 0.0f, 3.0f, 0.90000004f,
+	0.0f, 3.0f, 0.8f, 0.0f, 2.0f, 0.90000004f, 0.0f, 2.0f,
+	1.0f, 0.0f, 3.0f, 1.0f, 0.0f, 3.0f, 0.90000004f, 0.0f,
+	3.0f, 0.0f, 0.0f, 3.0f, 0.1f, 0.0f, 4.0f, 0.1f,
+	0.0f, 4.0f, 0.0f, 0.0f, 3.0f, 0.1f, 0.0f, 3.0f,
+	0.2f, 0.0f, 4.0f, 0.2f, 0.0f, 4.0f, 0.1f, 0.0f,
+	3.0f, 0.2f, 0.0f, 3.0f, 0.3f, 0.0f, 4.0f, 0.3f,
+	0.0f, 4.0f, 0.2f, 0.0f, 3.0f, 0.3f, 0.0f, 3.0f,
+	0.4f, 0.0f, 4.0f, 0.4f, 0.0f, 4.0f, 0.3f, 0.0f,
+	3.0f, 0.4f, 0.0f, 3.0f, 0.5f, 0.0f, 4.0f, 0.5f,
+	0.0f, 4.0f, 0.4f, 0.0f, 3.0f, 0.5f, 0.0f, 3.0f,
+	0.6f, 0.0f, 4.0f, 0.6f, 0.0f, 4.0f, 0.5f, 0.0f,
+	3.0f, 0.6f, 0.0f, 3.0f, 0.7f, 0.0f, 4.0f, 0.7f,
+	0.0f, 4.0f, 0.6f, 0.0f, 3.0f, 0.7f, 0.0f, 3.0f,
+	0.8f, 0.0f, 4.0f, 0.8f, 0.0f, 4.0f, 0.7f, 0.0f,
+	3.0f, 0.8f, 0.0f, 3.0f, 0.90000004f, 0.0f, 4.0f, 0.90000004f,
+	0.0f, 4.0f, 0.8f, 0.0f, 3.0f, 0.90000004f, 0.0f, 3.0f,
+	1.0f, 0.0f, 4.0f, 1.0f, 0.0f, 4.0f, 0.90000004f, 0.0f,
+	4.0f, 0.0f, 0.0f, 4.0f, 0.1f, 0.0f, 5.0f, 0.1f,
+	0.0f, 5.0f, 0.0f, 0.0f, 4.0f, 0.1f, 0.0f, 4.0f,
+	0.2f, 0.0f, 5.0f, 0.2f, 0.0f, 5.0f, 0.1f, 0.0f,
+	4.0f, 0.2f, 0.0f, 4.0f, 0.3f, 0.0f, 5.0f, 0.3f,
+	0.0f, 5.0f, 0.2f, 0.0f, 4.0f, 0.3f, 0.0f, 4.0f,
+	0.4f, 0.0f, 5.0f, 0.4f, 0.0f, 5.0f, 0.3f, 0.0f,
+	4.0f, 0.4f, 0.0f, 4.0f, 0.5f, 0.0f, 5.0f, 0.5f,
+	0.0f, 5.0f, 0.4f, 0.0f, 4.0f, 0.5f, 0.0f, 4.0f,
+	0.6f, 0.0f, 5.0f, 0.6f, 0.0f, 5.0f, 0.5f, 0.0f,
+	4.0f, 0.6f, 0.0f, 4.0f, 0.7f, 0.0f, 5.0f, 0.7f,
+	0.0f, 5.0f, 0.6f, 0.0f, 4.0f, 0.7f, 0.0f, 4.0f,
+	0.8f, 0.0f, 5.0f, 0.8f, 0.0f, 5.0f, 0.7f, 0.0f,
+	4.0f, 0.8f, 0.0f, 4.0f, 0.90000004f, 0.0f, 5.0f, 0.90000004f,
+	0.0f, 5.0f, 0.8f, 0.0f, 4.0f, 0.90000004f, 0.0f, 4.0f,
+	1.0f, 0.0f, 5.0f, 1.0f, 0.0f, 5.0f, 0.90000004f, 0.0f,
+	5.0f, 0.0f, 0.0f, 5.0f, 0.1f, 0.0f, 6.0f, 0.1f,
+	0.0f, 6.0f, 0.0f, 0.0f, 5.0f, 0.1f, 0.0f, 5.0f,
+	0.2f, 0.0f, 6.0f, 0.2f, 0.0f, 6.0f, 0.1f, 0.0f,
+	5.0f, 0.2f, 0.0f, 5.0f, 0.3f, 0.0f, 6.0f, 0.3f,
+	0.0f, 6.0f, 0.2f, 0.0f, 5.0f, 0.3f, 0.0f, 5.0f,
+	0.4f, 0.0f, 6.0f, 0.4f, 0.0f, 6.0f, 0.3f, 0.0f,
+	5.0f, 0.4f, 0.0f, 5.0f, 0.5f, 0.0f, 6.0f, 0.5f,
+	0.0f, 6.0f, 0.4f, 0.0f, 5.0f, 0.5f, 0.0f, 5.0f,
+	0.6f, 0.0f, 6.0f, 0.6f, 0.0f, 6.0f, 0.5f, 0.0f,
+	5.0f, 0.6f, 0.0f, 5.0f, 0.7f, 0.0f, 6.0f, 0.7f,
+	0.0f, 6.0f, 0.6f, 0.0f, 5.0f, 0.7f, 0.0f, 5.0f,
+	0.8f, 0.0f, 6.0f, 0.8f, 0.0f, 6.0f, 0.7f, 0.0f,
+	5.0f, 0.8f, 0.0f, 5.0f, 0.90000004f, 0.0f, 6.0f, 0.90000004f,
+	0.0f, 6.0f, 0.8f, 0.0f, 5.0f, 0.90000004f, 0.0f, 5.0f,
+	1.0f, 0.0f, 6.0f, 1.0f, 0.0f, 6.0f, 0.90000004f, 0.0f,
+	6.0f, 0.0f, 0.0f, 6.0f, 0.1f, 0.0f, 7.0f, 0.1f,
+	0.0f, 7.0f, 0.0f, 0.0f, 6.0f, 0.1f, 0.0f, 6.0f,
+	0.2f, 0.0f, 7.0f, 0.2f, 0.0f, 7.0f, 0.1f, 0.0f,
+	6.0f, 0.2f, 0.0f, 6.0f, 0.3f, 0.0f, 7.0f, 0.3f,
+	0.0f, 7.0f, 0.2f, 0.0f, 6.0f, 0.3f, 0.0f, 6.0f,
+	0.4f, 0.0f, 7.0f, 0.4f, 0.0f, 7.0f, 0.3f, 0.0f,
+	6.0f, 0.4f, 0.0f, 6.0f, 0.5f, 0.0f, 7.0f, 0.5f,
+	0.0f, 7.0f, 0.4f, 0.0f, 6.0f, 0.5f, 0.0f, 6.0f,
+	0.6f, 0.0f, 7.0f, 0.6f, 0.0f, 7.0f, 0.5f, 0.0f,
+	6.0f, 0.6f, 0.0f, 6.0f, 0.7f, 0.0f, 7.0f, 0.7f,
+	0.0f, 7.0f, 0.6f, 0.0f, 6.0f, 0.7f, 0.0f, 6.0f,
+	0.8f, 0.0f, 7.0f, 0.8f, 0.0f, 7.0f, 0.7f, 0.0f,
+	6.0f, 0.8f, 0.0f, 6.0f, 0.90000004f, 0.0f, 7.0f, 0.90000004f,
+	0.0f, 7.0f, 0.8f, 0.0f, 6.0f, 0.90000004f, 0.0f, 6.0f,
+	1.0f, 0.0f, 7.0f, 1.0f, 0.0f, 7.0f, 0.90000004f, 0.0f,
+	7.0f, 0.0f, 0.0f, 7.0f, 0.1f, 0.0f, 8.0f, 0.1f,
+	0.0f, 8.0f, 0.0f, 0.0f, 7.0f, 0.1f, 0.0f, 7.0f,
+	0.2f, 0.0f, 8.0f, 0.2f, 0.0f, 8.0f, 0.1f, 0.0f,
+	7.0f, 0.2f, 0.0f, 7.0f, 0.3f, 0.0f, 8.0f, 0.3f,
+	0.0f, 8.0f, 0.2f, 0.0f, 7.0f, 0.3f, 0.0f, 7.0f,
+	0.4f, 0.0f, 8.0f, 0.4f, 0.0f, 8.0f, 0.3f, 0.0f,
+	7.0f, 0.4f, 0.0f, 7.0f, 0.5f, 0.0f, 8.0f, 0.5f,
+	0.0f, 8.0f, 0.4f, 0.0f, 7.0f, 0.5f, 0.0f, 7.0f,
+	0.6f, 0.0f, 8.0f, 0.6f, 0.0f, 8.0f, 0.5f, 0.0f,
+	7.0f, 0.6f, 0.0f, 7.0f, 0.7f, 0.0f, 8.0f, 0.7f,
+	0.0f, 8.0f, 0.6f, 0.0f, 7.0f, 0.7f, 0.0f, 7.0f,
+	0.8f, 0.0f, 8.0f, 0.8f, 0.0f, 8.0f, 0.7f, 0.0f,
+	7.0f, 0.8f, 0.0f, 7.0f, 0.90000004f, 0.0f, 8.0f, 0.90000004f,
+	0.0f, 8.0f, 0.8f, 0.0f, 7.0f, 0.90000004f, 0.0f, 7.0f,
+	1.0f, 0.0f, 8.0f, 1.0f, 0.0f, 8.0f, 0.90000004f, 0.0f,
+	8.0f, 0.0f, 0.0f, 8.0f, 0.1f, 0.0f, 9.0f, 0.1f,
+	0.0f, 9.0f, 0.0f, 0.0f, 8.0f, 0.1f, 0.0f, 8.0f,
+	0.2f, 0.0f, 9.0f, 0.2f, 0.0f, 9.0f, 0.1f, 0.0f,
+	8.0f, 0.2f, 0.0f, 8.0f, 0.3f, 0.0f, 9.0f, 0.3f,
+	0.0f, 9.0f, 0.2f, 0.0f, 8.0f, 0.3f, 0.0f, 8.0f,
+	0.4f, 0.0f, 9.0f, 0.4f, 0.0f, 9.0f, 0.3f, 0.0f,
+	8.0f, 0.4f, 0.0f, 8.0f, 0.5f, 0.0f, 9.0f, 0.5f,
+	0.0f, 9.0f, 0.4f, 0.0f, 8.0f, 0.5f, 0.0f, 8.0f,
+	0.6f, 0.0f, 9.0f, 0.6f, 0.0f, 9.0f, 0.5f, 0.0f,
+	8.0f, 0.6f, 0.0f, 8.0f, 0.7f, 0.0f, 9.0f, 0.7f,
+	0.0f, 9.0f, 0.6f, 0.0f, 8.0f, 0.7f, 0.0f, 8.0f,
+	0.8f, 0.0f, 9.0f, 0.8f, 0.0f, 9.0f, 0.7f, 0.0f,
+	8.0f, 0.8f, 0.0f, 8.0f, 0.90000004f, 0.0f, 9.0f, 0.90000004f,
+	0.0f, 9.0f, 0.8f, 0.0f, 8.0f, 0.90000004f, 0.0f, 8.0f,
+	1.0f, 0.0f, 9.0f, 1.0f, 0.0f, 9.0f, 0.90000004f, 0.0f,
+	9.0f, 0.0f, 0.0f, 9.0f, 0.1f, 0.0f, 10.0f, 0.1f,
+	0.0f, 10.0f, 0.0f, 0.0f, 9.0f, 0.1f, 0.0f, 9.0f,
+	0.2f, 0.0f, 10.0f, 0.2f, 0.0f, 10.0f, 0.1f, 0.0f,
+	9.0f, 0.2f, 0.0f, 9.0f, 0.3f, 0.0f, 10.0f, 0.3f,
+	0.0f, 10.0f, 0.2f, 0.0f, 9.0f, 0.3f, 0.0f, 9.0f,
+	0.4f, 0.0f, 10.0f, 0.4f, 0.0f, 10.0f, 0.3f, 0.0f,
+	9.0f, 0.4f, 0.0f, 9.0f, 0.5f, 0.0f, 10.0f, 0.5f,
+	0.0f, 10.0f, 0.4f, 0.0f, 9.0f, 0.5f, 0.0f, 9.0f,
+	0.6f, 0.0f, 10.0f, 0.6f, 0.0f, 10.0f, 0.5f, 0.0f,
+	9.0f, 0.6f, 0.0f, 9.0f, 0.7f, 0.0f, 10.0f, 0.7f,
+	0.0f, 10.0f, 0.6f, 0.0f, 9.0f, 0.7f, 0.0f, 9.0f,
+	0.8f, 0.0f, 10.0f, 0.8f, 0.0f, 10.0f, 0.7f, 0.0f,
+	9.0f, 0.8f, 0.0f, 9.0f, 0.90000004f, 0.0f, 10.0f, 0.90000004f,
+	0.0f, 10.0f, 0.8f, 0.0f, 9.0f, 0.90000004f, 0.0f, 9.0f,
+	1.0f, 0.0f, 10.0f, 1.0f, 0.0f, 10.0f, 0.90000004f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.1f, 0.0f, 11.0f, 0.1f,
+	0.0f, 11.0f, 0.0f, 0.0f, 10.0f, 0.1f, 0.0f, 10.0f,
+	0.2f, 0.0f, 11.0f, 0.2f, 0.0f, 11.0f, 0.1f, 0.0f,
+	10.0f, 0.2f, 0.0f, 10.0f, 0.3f, 0.0f, 11.0f, 0.3f,
+	0.0f, 11.0f, 0.2f, 0.0f, 10.0f, 0.3f, 0.0f, 10.0f,
+	0.4f, 0.0f, 11.0f, 0.4f, 0.0f, 11.0f, 0.3f, 0.0f,
+	10.0f, 0.4f, 0.0f, 10.0f, 0.5f, 0.0f, 11.0f, 0.5f,
+	0.0f, 11.0f, 0.4f, 0.0f, 10.0f, 0.5f, 0.0f, 10.0f,
+	0.6f, 0.0f, 11.0f, 0.6f, 0.0f, 11.0f, 0.5f, 0.0f,
+	10.0f, 0.6f, 0.0f, 10.0f, 0.7f, 0.0f, 11.0f, 0.7f,
+	0.0f, 11.0f, 0.6f, 0.0f, 10.0f, 0.7f, 0.0f, 10.0f,
+	0.8f, 0.0f, 11.0f, 0.8f, 0.0f, 11.0f, 0.7f, 0.0f,
+	10.0f, 0.8f, 0.0f, 10.0f, 0.90000004f, 0.0f, 11.0f, 0.90000004f,
+	0.0f, 11.0f, 0.8f, 0.0f, 10.0f, 0.90000004f, 0.0f, 10.0f,
+	1.0f, 0.0f, 11.0f, 1.0f, 0.0f, 11.0f, 0.90000004f, 0.0f,
+	11.0f, 0.0f, 0.0f, 11.0f, 0.1f, 0.0f, 12.0f, 0.1f,
+	0.0f, 12.0f, 0.0f, 0.0f, 11.0f, 0.1f, 0.0f, 11.0f,
+	0.2f, 0.0f, 12.0f, 0.2f, 0.0f, 12.0f, 0.1f, 0.0f,
+	11.0f, 0.2f, 0.0f, 11.0f, 0.3f, 0.0f, 12.0f, 0.3f,
+	0.0f, 12.0f, 0.2f, 0.0f, 11.0f, 0.3f, 0.0f, 11.0f,
+	0.4f, 0.0f, 12.0f, 0.4f, 0.0f, 12.0f, 0.3f, 0.0f,
+	11.0f, 0.4f, 0.0f, 11.0f, 0.5f, 0.0f, 12.0f, 0.5f,
+	0.0f, 12.0f, 0.4f, 0.0f, 11.0f, 0.5f, 0.0f, 11.0f,
+	0.6f, 0.0f, 12.0f, 0.6f, 0.0f, 12.0f, 0.5f, 0.0f,
+	11.0f, 0.6f, 0.0f, 11.0f, 0.7f, 0.0f, 12.0f, 0.7f,
+	0.0f, 12.0f, 0.6f, 0.0f, 11.0f, 0.7f, 0.0f, 11.0f,
+	0.8f, 0.0f, 12.0f, 0.8f, 0.0f, 12.0f, 0.7f, 0.0f,
+	11.0f, 0.8f, 0.0f, 11.0f, 0.90000004f, 0.0f, 12.0f, 0.90000004f,
+	0.0f, 12.0f, 0.8f, 0.0f, 11.0f, 0.90000004f, 0.0f, 11.0f,
+	1.0f, 0.0f, 12.0f, 1.0f, 0.0f, 12.0f, 0.90000004f, 0.0f,
+	12.0f, 0.0f, 0.0f, 12.0f, 0.1f, 0.0f, 13.0f, 0.1f,
+	0.0f, 13.0f, 0.0f, 0.0f, 12.0f, 0.1f, 0.0f, 12.0f,
+	0.2f, 0.0f, 13.0f, 0.2f, 0.0f, 13.0f, 0.1f, 0.0f,
+	12.0f, 0.2f, 0.0f, 12.0f, 0.3f, 0.0f, 13.0f, 0.3f,
+	0.0f, 13.0f, 0.2f, 0.0f, 12.0f, 0.3f, 0.0f, 12.0f,
+	0.4f, 0.0f, 13.0f, 0.4f, 0.0f, 13.0f, 0.3f, 0.0f,
+	12.0f, 0.4f, 0.0f, 12.0f, 0.5f, 0.0f, 13.0f, 0.5f,
+	0.0f, 13.0f, 0.4f, 0.0f, 12.0f, 0.5f, 0.0f, 12.0f,
+	0.6f, 0.0f, 13.0f, 0.6f, 0.0f, 13.0f, 0.5f, 0.0f,
+	12.0f, 0.6f, 0.0f, 12.0f, 0.7f, 0.0f, 13.0f, 0.7f,
+	0.0f, 13.0f, 0.6f, 0.0f, 12.0f, 0.7f, 0.0f, 12.0f,
+	0.8f, 0.0f, 13.0f, 0.8f, 0.0f, 13.0f, 0.7f, 0.0f,
+	12.0f, 0.8f, 0.0f, 12.0f, 0.90000004f, 0.0f, 13.0f, 0.90000004f,
+	0.0f, 13.0f, 0.8f, 0.0f, 12.0f, 0.90000004f, 0.0f, 12.0f,
+	1.0f, 0.0f, 13.0f, 1.0f, 0.0f, 13.0f, 0.90000004f, 0.0f,
+	13.0f, 0.0f, 0.0f, 13.0f, 0.1f, 0.0f, 14.0f, 0.1f,
+	0.0f, 14.0f, 0.0f, 0.0f, 13.0f, 0.1f, 0.0f, 13.0f,
+	0.2f, 0.0f, 14.0f, 0.2f, 0.0f, 14.0f, 0.1f, 0.0f,
+	13.0f, 0.2f, 0.0f, 13.0f, 0.3f, 0.0f, 14.0f, 0.3f,
+	0.0f, 14.0f, 0.2f, 0.0f, 13.0f, 0.3f, 0.0f, 13.0f,
+	0.4f, 0.0f, 14.0f, 0.4f, 0.0f, 14.0f, 0.3f, 0.0f,
+	13.0f, 0.4f, 0.0f, 13.0f, 0.5f, 0.0f, 14.0f, 0.5f,
+	0.0f, 14.0f, 0.4f, 0.0f, 13.0f, 0.5f, 0.0f, 13.0f,
+	0.6f, 0.0f, 14.0f, 0.6f, 0.0f, 14.0f, 0.5f, 0.0f,
+	13.0f, 0.6f, 0.0f, 13.0f, 0.7f, 0.0f, 14.0f, 0.7f,
+	0.0f, 14.0f, 0.6f, 0.0f, 13.0f, 0.7f, 0.0f, 13.0f,
+	0.8f, 0.0f, 14.0f, 0.8f, 0.0f, 14.0f, 0.7f, 0.0f,
+	13.0f, 0.8f, 0.0f, 13.0f, 0.90000004f, 0.0f, 14.0f, 0.90000004f,
+	0.0f, 14.0f, 0.8f, 0.0f, 13.0f, 0.90000004f, 0.0f, 13.0f,
+	1.0f, 0.0f, 14.0f, 1.0f, 0.0f, 14.0f, 0.90000004f, 0.0f,
+	14.0f, 0.0f, 0.0f, 14.0f, 0.1f, 0.0f, 15.0f, 0.1f,
+	0.0f, 15.0f, 0.0f, 0.0f, 14.0f, 0.1f, 0.0f, 14.0f,
+	0.2f, 0.0f, 15.0f, 0.2f, 0.0f, 15.0f, 0.1f, 0.0f,
+	14.0f, 0.2f, 0.0f, 14.0f, 0.3f, 0.0f, 15.0f, 0.3f,
+	0.0f, 15.0f, 0.2f, 0.0f, 14.0f, 0.3f, 0.0f, 14.0f,
+	0.4f, 0.0f, 15.0f, 0.4f, 0.0f, 15.0f, 0.3f, 0.0f,
+	14.0f, 0.4f, 0.0f, 14.0f, 0.5f, 0.0f, 15.0f, 0.5f,
+	0.0f, 15.0f, 0.4f, 0.0f, 14.0f, 0.5f, 0.0f, 14.0f,
+	0.6f, 0.0f, 15.0f, 0.6f, 0.0f, 15.0f, 0.5f, 0.0f,
+	14.0f, 0.6f, 0.0f, 14.0f, 0.7f, 0.0f, 15.0f, 0.7f,
+	0.0f, 15.0f, 0.6f, 0.0f, 14.0f, 0.7f, 0.0f, 14.0f,
+	0.8f, 0.0f, 15.0f, 0.8f, 0.0f, 15.0f, 0.7f, 0.0f,
+	14.0f, 0.8f, 0.0f, 14.0f, 0.90000004f, 0.0f, 15.0f, 0.90000004f,
+	0.0f, 15.0f, 0.8f, 0.0f, 14.0f, 0.90000004f, 0.0f, 14.0f,
+	1.0f, 0.0f, 15.0f, 1.0f, 0.0f, 15.0f, 0.90000004f, 0.0f,
+	15.0f, 0.0f, 0.0f, 15.0f, 0.1f, 0.0f, 16.0f, 0.1f,
+	0.0f, 16.0f, 0.0f, 0.0f, 15.0f, 0.1f, 0.0f, 15.0f,
+	0.2f, 0.0f, 16.0f, 0.2f, 0.0f, 16.0f, 0.1f, 0.0f,
+	15.0f, 0.2f, 0.0f, 15.0f, 0.3f, 0.0f, 16.0f, 0.3f,
+	0.0f, 16.0f, 0.2f, 0.0f, 15.0f, 0.3f, 0.0f, 15.0f,
+	0.4f, 0.0f, 16.0f, 0.4f, 0.0f, 16.0f, 0.3f, 0.0f,
+	15.0f, 0.4f, 0.0f, 15.0f, 0.5f, 0.0f, 16.0f, 0.5f,
+	0.0f, 16.0f, 0.4f, 0.0f, 15.0f, 0.5f, 0.0f, 15.0f,
+	0.6f, 0.0f, 16.0f, 0.6f, 0.0f, 16.0f, 0.5f, 0.0f,
+	15.0f, 0.6f, 0.0f, 15.0f, 0.7f, 0.0f, 16.0f, 0.7f,
+	0.0f, 16.0f, 0.6f, 0.0f, 15.0f, 0.7f, 0.0f, 15.0f,
+	0.8f, 0.0f, 16.0f, 0.8f, 0.0f, 16.0f, 0.7f, 0.0f,
+	15.0f, 0.8f, 0.0f, 15.0f, 0.90000004f, 0.0f, 16.0f, 0.90000004f,
+	0.0f, 16.0f, 0.8f, 0.0f, 15.0f, 0.90000004f, 0.0f, 15.0f,
+	1.0f, 0.0f, 16.0f, 1.0f, 0.0f, 16.0f, 0.90000004f, 0.0f,
+	16.0f, 0.0f, 0.0f, 16.0f, 0.1f, 0.0f, 17.0f, 0.1f,
+	0.0f, 17.0f, 0.0f, 0.0f, 16.0f, 0.1f, 0.0f, 16.0f,
+	0.2f, 0.0f, 17.0f, 0.2f, 0.0f, 17.0f, 0.1f, 0.0f,
+	16.0f, 0.2f, 0.0f, 16.0f, 0.3f, 0.0f, 17.0f, 0.3f,
+	0.0f, 17.0f, 0.2f, 0.0f, 16.0f, 0.3f, 0.0f, 16.0f,
+	0.4f, 0.0f, 17.0f, 0.4f, 0.0f, 17.0f, 0.3f, 0.0f,
+	16.0f, 0.4f, 0.0f, 16.0f, 0.5f, 0.0f, 17.0f, 0.5f,
+	0.0f, 17.0f, 0.4f, 0.0f, 16.0f, 0.5f, 0.0f, 16.0f,
+	0.6f, 0.0f, 17.0f, 0.6f, 0.0f, 17.0f, 0.5f, 0.0f,
+	16.0f, 0.6f, 0.0f, 16.0f, 0.7f, 0.0f, 17.0f, 0.7f,
+	0.0f, 17.0f, 0.6f, 0.0f, 16.0f, 0.7f, 0.0f, 16.0f,
+	0.8f, 0.0f, 17.0f, 0.8f, 0.0f, 17.0f, 0.7f, 0.0f,
+	16.0f, 0.8f, 0.0f, 16.0f, 0.90000004f, 0.0f, 17.0f, 0.90000004f,
+	0.0f, 17.0f, 0.8f, 0.0f, 16.0f, 0.90000004f, 0.0f, 16.0f,
+	1.0f, 0.0f, 17.0f, 1.0f, 0.0f, 17.0f, 0.90000004f, 0.0f,
+	17.0f, 0.0f, 0.0f, 17.0f, 0.1f, 0.0f, 18.0f, 0.1f,
+	0.0f, 18.0f, 0.0f, 0.0f, 17.0f, 0.1f, 0.0f, 17.0f,
+	0.2f, 0.0f, 18.0f, 0.2f, 0.0f, 18.0f, 0.1f, 0.0f,
+	17.0f, 0.2f, 0.0f, 17.0f, 0.3f, 0.0f, 18.0f, 0.3f,
+	0.0f, 18.0f, 0.2f, 0.0f, 17.0f, 0.3f, 0.0f, 17.0f,
+	0.4f, 0.0f, 18.0f, 0.4f, 0.0f, 18.0f, 0.3f, 0.0f,
+	17.0f, 0.4f, 0.0f, 17.0f, 0.5f, 0.0f, 18.0f, 0.5f,
+	0.0f, 18.0f, 0.4f, 0.0f, 17.0f, 0.5f, 0.0f, 17.0f,
+	0.6f, 0.0f, 18.0f, 0.6f, 0.0f, 18.0f, 0.5f, 0.0f,
+	17.0f, 0.6f, 0.0f, 17.0f, 0.7f, 0.0f, 18.0f, 0.7f,
+	0.0f, 18.0f, 0.6f, 0.0f, 17.0f, 0.7f, 0.0f, 17.0f,
+	0.8f, 0.0f, 18.0f, 0.8f, 0.0f, 18.0f, 0.7f, 0.0f,
+	17.0f, 0.8f, 0.0f, 17.0f, 0.90000004f, 0.0f, 18.0f, 0.90000004f,
+	0.0f, 18.0f, 0.8f, 0.0f, 17.0f, 0.90000004f, 0.0f, 17.0f,
+	1.0f, 0.0f, 18.0f, 1.0f, 0.0f, 18.0f, 0.90000004f, 0.0f,
+	18.0f, 0.0f, 0.0f, 18.0f, 0.1f, 0.0f, 19.0f, 0.1f,
+	0.0f, 19.0f, 0.0f, 0.0f, 18.0f, 0.1f, 0.0f, 18.0f,
+	0.2f, 0.0f, 19.0f, 0.2f, 0.0f, 19.0f, 0.1f, 0.0f,
+	18.0f, 0.2f, 0.0f, 18.0f, 0.3f, 0.0f, 19.0f, 0.3f,
+	0.0f, 19.0f, 0.2f, 0.0f, 18.0f, 0.3f, 0.0f, 18.0f,
+	0.4f, 0.0f, 19.0f, 0.4f, 0.0f, 19.0f, 0.3f, 0.0f,
+	18.0f, 0.4f, 0.0f, 18.0f, 0.5f, 0.0f, 19.0f, 0.5f,
+	0.0f, 19.0f, 0.4f, 0.0f, 18.0f, 0.5f, 0.0f, 18.0f,
+	0.6f, 0.0f, 19.0f, 0.6f, 0.0f, 19.0f, 0.5f, 0.0f,
+	18.0f, 0.6f, 0.0f, 18.0f, 0.7f, 0.0f, 19.0f, 0.7f,
+	0.0f, 19.0f, 0.6f, 0.0f, 18.0f, 0.7f, 0.0f, 18.0f,
+	0.8f, 0.0f, 19.0f, 0.8f, 0.0f, 19.0f, 0.7f, 0.0f,
+	18.0f, 0.8f, 0.0f, 18.0f, 0.90000004f, 0.0f, 19.0f, 0.90000004f,
+	0.0f, 19.0f, 0.8f, 0.0f, 18.0f, 0.90000004f, 0.0f, 18.0f,
+	1.0f, 0.0f, 19.0f, 1.0f, 0.0f, 19.0f, 0.90000004f, 0.0f,
+	19.0f, 0.0f, 0.0f, 19.0f, 0.1f, 0.0f, 20.0f, 0.1f,
+	0.0f, 20.0f, 0.0f, 0.0f, 19.0f, 0.1f, 0.0f, 19.0f,
+	0.2f, 0.0f, 20.0f, 0.2f, 0.0f, 20.0f, 0.1f, 0.0f,
+	19.0f, 0.2f, 0.0f, 19.0f, 0.3f, 0.0f, 20.0f, 0.3f,
+	0.0f, 20.0f, 0.2f, 0.0f, 19.0f, 0.3f, 0.0f, 19.0f,
+	0.4f, 0.0f, 20.0f, 0.4f, 0.0f, 20.0f, 0.3f, 0.0f,
+	19.0f, 0.4f, 0.0f, 19.0f, 0.5f, 0.0f, 20.0f, 0.5f,
+	0.0f, 20.0f, 0.4f, 0.0f, 19.0f, 0.5f, 0.0f, 19.0f,
+	0.6f, 0.0f, 20.0f, 0.6f, 0.0f, 20.0f, 0.5f, 0.0f,
+	19.0f, 0.6f, 0.0f, 19.0f, 0.7f, 0.0f, 20.0f, 0.7f,
+	0.0f, 20.0f, 0.6f, 0.0f, 19.0f, 0.7f, 0.0f, 19.0f,
+	0.8f, 0.0f, 20.0f, 0.8f, 0.0f, 20.0f, 0.7f, 0.0f,
+	19.0f, 0.8f, 0.0f, 19.0f, 0.90000004f, 0.0f, 20.0f, 0.90000004f,
+	0.0f, 20.0f, 0.8f, 0.0f, 19.0f, 0.90000004f, 0.0f, 19.0f,
+	1.0f, 0.0f, 20.0f, 1.0f, 0.0f, 20.0f, 0.90000004f, 0.0f,
+	0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.1f, 1.0f, 0.0f,
+	0.1f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.1f, 0.0f,
+	0.0f, 0.2f, 1.0f, 0.0f, 0.2f, 1.0f, 0.0f, 0.1f,
+	0.0f, 0.0f, 0.2f, 0.0f, 0.0f, 0.3f, 1.0f, 0.0f,
+	0.3f, 1.0f, 0.0f, 0.2f, 0.0f, 0.0f, 0.3f, 0.0f,
+	0.0f, 0.4f, 1.0f, 0.0f, 0.4f, 1.0f, 0.0f, 0.3f,
+	0.0f, 0.0f, 0.4f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f,
+	0.5f, 1.0f, 0.0f, 0.4f, 0.0f, 0.0f, 0.5f, 0.0f,
+	0.0f, 0.6f, 1.0f, 0.0f, 0.6f, 1.0f, 0.0f, 0.5f,
+	0.0f, 0.0f, 0.6f, 0.0f, 0.0f, 0.7f, 1.0f, 0.0f,
+	0.7f, 1.0f, 0.0f, 0.6f, 0.0f, 0.0f, 0.7f, 0.0f,
+	0.0f, 0.8f, 1.0f, 0.0f, 0.8f, 1.0f, 0.0f, 0.7f,
+	0.0f, 0.0f, 0.8f, 0.0f, 0.0f, 0.90000004f, 1.0f, 0.0f,
+	0.90000004f, 1.0f, 0.0f, 0.8f, 0.0f, 0.0f, 0.90000004f, 0.0f,
+	0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.90000004f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.1f, 2.0f, 0.0f,
+	0.1f, 2.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.1f, 1.0f,
+	0.0f, 0.2f, 2.0f, 0.0f, 0.2f, 2.0f, 0.0f, 0.1f,
+	1.0f, 0.0f, 0.2f, 1.0f, 0.0f, 0.3f, 2.0f, 0.0f,
+	0.3f, 2.0f, 0.0f, 0.2f, 1.0f, 0.0f, 0.3f, 1.0f,
+	0.0f, 0.4f, 2.0f, 0.0f, 0.4f, 2.0f, 0.0f, 0.3f,
+	1.0f, 0.0f, 0.4f, 1.0f, 0.0f, 0.5f, 2.0f, 0.0f,
+	0.5f, 2.0f, 0.0f, 0.4f, 1.0f, 0.0f, 0.5f, 1.0f,
+	0.0f, 0.6f, 2.0f, 0.0f, 0.6f, 2.0f, 0.0f, 0.5f,
+	1.0f, 0.0f, 0.6f, 1.0f, 0.0f, 0.7f, 2.0f, 0.0f,
+	0.7f, 2.0f, 0.0f, 0.6f, 1.0f, 0.0f, 0.7f, 1.0f,
+	0.0f, 0.8f, 2.0f, 0.0f, 0.8f, 2.0f, 0.0f, 0.7f,
+	1.0f, 0.0f, 0.8f, 1.0f, 0.0f, 0.90000004f, 2.0f, 0.0f,
+	0.90000004f, 2.0f, 0.0f, 0.8f, 1.0f, 0.0f, 0.90000004f, 1.0f,
+	0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f, 0.0f, 0.90000004f,
+	2.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.1f, 3.0f, 0.0f,
+	0.1f, 3.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.1f, 2.0f,
+	0.0f, 0.2f, 3.0f, 0.0f, 0.2f, 3.0f, 0.0f, 0.1f,
+	2.0f, 0.0f, 0.2f, 2.0f, 0.0f, 0.3f, 3.0f, 0.0f,
+	0.3f, 3.0f, 0.0f, 0.2f, 2.0f, 0.0f, 0.3f, 2.0f,
+	0.0f, 0.4f, 3.0f, 0.0f, 0.4f, 3.0f, 0.0f, 0.3f,
+	2.0f, 0.0f, 0.4f, 2.0f, 0.0f, 0.5f, 3.0f, 0.0f,
+	0.5f, 3.0f, 0.0f, 0.4f, 2.0f, 0.0f, 0.5f, 2.0f,
+	0.0f, 0.6f, 3.0f, 0.0f, 0.6f, 3.0f, 0.0f, 0.5f,
+	2.0f, 0.0f, 0.6f, 2.0f, 0.0f, 0.7f, 3.0f, 0.0f,
+	0.7f, 3.0f, 0.0f, 0.6f, 2.0f, 0.0f, 0.7f, 2.0f,
+	0.0f, 0.8f, 3.0f, 0.0f, 0.8f, 3.0f, 0.0f, 0.7f,
+	2.0f, 0.0f, 0.8f, 2.0f, 0.0f, 0.90000004f, 3.0f, 0.0f,
+	0.90000004f, 3.0f, 0.0f, 0.8f, 2.0f, 0.0f, 0.90000004f, 2.0f,
+	0.0f, 1.0f, 3.0f, 0.0f, 1.0f, 3.0f, 0.0f, 0.90000004f,
+	3.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.1f, 4.0f, 0.0f,
+	0.1f, 4.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.1f, 3.0f,
+	0.0f, 0.2f, 4.0f, 0.0f, 0.2f, 4.0f, 0.0f, 0.1f,
+	3.0f, 0.0f, 0.2f, 3.0f, 0.0f, 0.3f, 4.0f, 0.0f,
+	0.3f, 4.0f, 0.0f, 0.2f, 3.0f, 0.0f, 0.3f, 3.0f,
+	0.0f, 0.4f, 4.0f, 0.0f, 0.4f, 4.0f, 0.0f, 0.3f,
+	3.0f, 0.0f, 0.4f, 3.0f, 0.0f, 0.5f, 4.0f, 0.0f,
+	0.5f, 4.0f, 0.0f, 0.4f, 3.0f, 0.0f, 0.5f, 3.0f,
+	0.0f, 0.6f, 4.0f, 0.0f, 0.6f, 4.0f, 0.0f, 0.5f,
+	3.0f, 0.0f, 0.6f, 3.0f, 0.0f, 0.7f, 4.0f, 0.0f,
+	0.7f, 4.0f, 0.0f, 0.6f, 3.0f, 0.0f, 0.7f, 3.0f,
+	0.0f, 0.8f, 4.0f, 0.0f, 0.8f, 4.0f, 0.0f, 0.7f,
+	3.0f, 0.0f, 0.8f, 3.0f, 0.0f, 0.90000004f, 4.0f, 0.0f,
+	0.90000004f, 4.0f, 0.0f, 0.8f, 3.0f, 0.0f, 0.90000004f, 3.0f,
+	0.0f, 1.0f, 4.0f, 0.0f, 1.0f, 4.0f, 0.0f, 0.90000004f,
+	4.0f, 0.0f, 0.0f, 4.0f, 0.0f, 0.1f, 5.0f, 0.0f,
+	0.1f, 5.0f, 0.0f, 0.0f, 4.0f, 0.0f, 0.1f, 4.0f,
+	0.0f, 0.2f, 5.0f, 0.0f, 0.2f, 5.0f, 0.0f, 0.1f,
+	4.0f, 0.0f, 0.2f, 4.0f, 0.0f, 0.3f, 5.0f, 0.0f,
+	0.3f, 5.0f, 0.0f, 0.2f, 4.0f, 0.0f, 0.3f, 4.0f,
+	0.0f, 0.4f, 5.0f, 0.0f, 0.4f, 5.0f, 0.0f, 0.3f,
+	4.0f, 0.0f, 0.4f, 4.0f, 0.0f, 0.5f, 5.0f, 0.0f,
+	0.5f, 5.0f, 0.0f, 0.4f, 4.0f, 0.0f, 0.5f, 4.0f,
+	0.0f, 0.6f, 5.0f, 0.0f, 0.6f, 5.0f, 0.0f, 0.5f,
+	4.0f, 0.0f, 0.6f, 4.0f, 0.0f, 0.7f, 5.0f, 0.0f,
+	0.7f, 5.0f, 0.0f, 0.6f, 4.0f, 0.0f, 0.7f, 4.0f,
+	0.0f, 0.8f, 5.0f, 0.0f, 0.8f, 5.0f, 0.0f, 0.7f,
+	4.0f, 0.0f, 0.8f, 4.0f, 0.0f, 0.90000004f, 5.0f, 0.0f,
+	0.90000004f, 5.0f, 0.0f, 0.8f, 4.0f, 0.0f, 0.90000004f, 4.0f,
+	0.0f, 1.0f, 5.0f, 0.0f, 1.0f, 5.0f, 0.0f, 0.90000004f,
+	5.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.1f, 6.0f, 0.0f,
+	0.1f, 6.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.1f, 5.0f,
+	0.0f, 0.2f, 6.0f, 0.0f, 0.2f, 6.0f, 0.0f, 0.1f,
+	5.0f, 0.0f, 0.2f, 5.0f, 0.0f, 0.3f, 6.0f, 0.0f,
+	0.3f, 6.0f, 0.0f, 0.2f, 5.0f, 0.0f, 0.3f, 5.0f,
+	0.0f, 0.4f, 6.0f, 0.0f, 0.4f, 6.0f, 0.0f, 0.3f,
+	5.0f, 0.0f, 0.4f, 5.0f, 0.0f, 0.5f, 6.0f, 0.0f,
+	0.5f, 6.0f, 0.0f, 0.4f, 5.0f, 0.0f, 0.5f, 5.0f,
+	0.0f, 0.6f, 6.0f, 0.0f, 0.6f, 6.0f, 0.0f, 0.5f,
+	5.0f, 0.0f, 0.6f, 5.0f, 0.0f, 0.7f, 6.0f, 0.0f,
+	0.7f, 6.0f, 0.0f, 0.6f, 5.0f, 0.0f, 0.7f, 5.0f,
+	0.0f, 0.8f, 6.0f, 0.0f, 0.8f, 6.0f, 0.0f, 0.7f,
+	5.0f, 0.0f, 0.8f, 5.0f, 0.0f, 0.90000004f, 6.0f, 0.0f,
+	0.90000004f, 6.0f, 0.0f, 0.8f, 5.0f, 0.0f, 0.90000004f, 5.0f,
+	0.0f, 1.0f, 6.0f, 0.0f, 1.0f, 6.0f, 0.0f, 0.90000004f,
+	6.0f, 0.0f, 0.0f, 6.0f, 0.0f, 0.1f, 7.0f, 0.0f,
+	0.1f, 7.0f, 0.0f, 0.0f, 6.0f, 0.0f, 0.1f, 6.0f,
+	0.0f, 0.2f, 7.0f, 0.0f, 0.2f, 7.0f, 0.0f, 0.1f,
+	6.0f, 0.0f, 0.2f, 6.0f, 0.0f, 0.3f, 7.0f, 0.0f,
+	0.3f, 7.0f, 0.0f, 0.2f, 6.0f, 0.0f, 0.3f, 6.0f,
+	0.0f, 0.4f, 7.0f, 0.0f, 0.4f, 7.0f, 0.0f, 0.3f,
+	6.0f, 0.0f, 0.4f, 6.0f, 0.0f, 0.5f, 7.0f, 0.0f,
+	0.5f, 7.0f, 0.0f, 0.4f, 6.0f, 0.0f, 0.5f, 6.0f,
+	0.0f, 0.6f, 7.0f, 0.0f, 0.6f, 7.0f, 0.0f, 0.5f,
+	6.0f, 0.0f, 0.6f, 6.0f, 0.0f, 0.7f, 7.0f, 0.0f,
+	0.7f, 7.0f, 0.0f, 0.6f, 6.0f, 0.0f, 0.7f, 6.0f,
+	0.0f, 0.8f, 7.0f, 0.0f, 0.8f, 7.0f, 0.0f, 0.7f,
+	6.0f, 0.0f, 0.8f, 6.0f, 0.0f, 0.90000004f, 7.0f, 0.0f,
+	0.90000004f, 7.0f, 0.0f, 0.8f, 6.0f, 0.0f, 0.90000004f, 6.0f,
+	0.0f, 1.0f, 7.0f, 0.0f, 1.0f, 7.0f, 0.0f, 0.90000004f,
+	7.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.1f, 8.0f, 0.0f,
+	0.1f, 8.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.1f, 7.0f,
+	0.0f, 0.2f, 8.0f, 0.0f, 0.2f, 8.0f, 0.0f, 0.1f,
+	7.0f, 0.0f, 0.2f, 7.0f, 0.0f, 0.3f, 8.0f, 0.0f,
+	0.3f, 8.0f, 0.0f, 0.2f, 7.0f, 0.0f, 0.3f, 7.0f,
+	0.0f, 0.4f, 8.0f, 0.0f, 0.4f, 8.0f, 0.0f, 0.3f,
+	7.0f, 0.0f, 0.4f, 7.0f, 0.0f, 0.5f, 8.0f, 0.0f,
+	0.5f, 8.0f, 0.0f, 0.4f, 7.0f, 0.0f, 0.5f, 7.0f,
+	0.0f, 0.6f, 8.0f, 0.0f, 0.6f, 8.0f, 0.0f, 0.5f,
+	7.0f, 0.0f, 0.6f, 7.0f, 0.0f, 0.7f, 8.0f, 0.0f,
+	0.7f, 8.0f, 0.0f, 0.6f, 7.0f, 0.0f, 0.7f, 7.0f,
+	0.0f, 0.8f, 8.0f, 0.0f, 0.8f, 8.0f, 0.0f, 0.7f,
+	7.0f, 0.0f, 0.8f, 7.0f, 0.0f, 0.90000004f, 8.0f, 0.0f,
+	0.90000004f, 8.0f, 0.0f, 0.8f, 7.0f, 0.0f, 0.90000004f, 7.0f,
+	0.0f, 1.0f, 8.0f, 0.0f, 1.0f, 8.0f, 0.0f, 0.90000004f,
+	8.0f, 0.0f, 0.0f, 8.0f, 0.0f, 0.1f, 9.0f, 0.0f,
+	0.1f, 9.0f, 0.0f, 0.0f, 8.0f, 0.0f, 0.1f, 8.0f,
+	0.0f, 0.2f, 9.0f, 0.0f, 0.2f, 9.0f, 0.0f, 0.1f,
+	8.0f, 0.0f, 0.2f, 8.0f, 0.0f, 0.3f, 9.0f, 0.0f,
+	0.3f, 9.0f, 0.0f, 0.2f, 8.0f, 0.0f, 0.3f, 8.0f,
+	0.0f, 0.4f, 9.0f, 0.0f, 0.4f, 9.0f, 0.0f, 0.3f,
+	8.0f, 0.0f, 0.4f, 8.0f, 0.0f, 0.5f, 9.0f, 0.0f,
+	0.5f, 9.0f, 0.0f, 0.4f, 8.0f, 0.0f, 0.5f, 8.0f,
+	0.0f, 0.6f, 9.0f, 0.0f, 0.6f, 9.0f, 0.0f, 0.5f,
+	8.0f, 0.0f, 0.6f, 8.0f, 0.0f, 0.7f, 9.0f, 0.0f,
+	0.7f, 9.0f, 0.0f, 0.6f, 8.0f, 0.0f, 0.7f, 8.0f,
+	0.0f, 0.8f, 9.0f, 0.0f, 0.8f, 9.0f, 0.0f, 0.7f,
+	8.0f, 0.0f, 0.8f, 8.0f, 0.0f, 0.90000004f, 9.0f, 0.0f,
+	0.90000004f, 9.0f, 0.0f, 0.8f, 8.0f, 0.0f, 0.90000004f, 8.0f,
+	0.0f, 1.0f, 9.0f, 0.0f, 1.0f, 9.0f, 0.0f, 0.90000004f,
+	9.0f, 0.0f, 0.0f, 9.0f, 0.0f, 0.1f, 10.0f, 0.0f,
+	0.1f, 10.0f, 0.0f, 0.0f, 9.0f, 0.0f, 0.1f, 9.0f,
+	0.0f, 0.2f, 10.0f, 0.0f, 0.2f, 10.0f, 0.0f, 0.1f,
+	9.0f, 0.0f, 0.2f, 9.0f, 0.0f, 0.3f, 10.0f, 0.0f,
+	0.3f, 10.0f, 0.0f, 0.2f, 9.0f, 0.0f, 0.3f, 9.0f,
+	0.0f, 0.4f, 10.0f, 0.0f, 0.4f, 10.0f, 0.0f, 0.3f,
+	9.0f, 0.0f, 0.4f, 9.0f, 0.0f, 0.5f, 10.0f, 0.0f,
+	0.5f, 10.0f, 0.0f, 0.4f, 9.0f, 0.0f, 0.5f, 9.0f,
+	0.0f, 0.6f, 10.0f, 0.0f, 0.6f, 10.0f, 0.0f, 0.5f,
+	9.0f, 0.0f, 0.6f, 9.0f, 0.0f, 0.7f, 10.0f, 0.0f,
+	0.7f, 10.0f, 0.0f, 0.6f, 9.0f, 0.0f, 0.7f, 9.0f,
+	0.0f, 0.8f, 10.0f, 0.0f, 0.8f, 10.0f, 0.0f, 0.7f,
+	9.0f, 0.0f, 0.8f, 9.0f, 0.0f, 0.90000004f, 10.0f, 0.0f,
+	0.90000004f, 10.0f, 0.0f, 0.8f, 9.0f, 0.0f, 0.90000004f, 9.0f,
+	0.0f, 1.0f, 10.0f, 0.0f, 1.0f, 10.0f, 0.0f, 0.90000004f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.1f, 11.0f, 0.0f,
+	0.1f, 11.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.1f, 10.0f,
+	0.0f, 0.2f, 11.0f, 0.0f, 0.2f, 11.0f, 0.0f, 0.1f,
+	10.0f, 0.0f, 0.2f, 10.0f, 0.0f, 0.3f, 11.0f, 0.0f,
+	0.3f, 11.0f, 0.0f, 0.2f, 10.0f, 0.0f, 0.3f, 10.0f,
+	0.0f, 0.4f, 11.0f, 0.0f, 0.4f, 11.0f, 0.0f, 0.3f,
+	10.0f, 0.0f, 0.4f, 10.0f, 0.0f, 0.5f, 11.0f, 0.0f,
+	0.5f, 11.0f, 0.0f, 0.4f, 10.0f, 0.0f, 0.5f, 10.0f,
+	0.0f, 0.6f, 11.0f, 0.0f, 0.6f, 11.0f, 0.0f, 0.5f,
+	10.0f, 0.0f, 0.6f, 10.0f, 0.0f, 0.7f, 11.0f, 0.0f,
+	0.7f, 11.0f, 0.0f, 0.6f, 10.0f, 0.0f, 0.7f, 10.0f,
+	0.0f, 0.8f, 11.0f, 0.0f, 0.8f, 11.0f, 0.0f, 0.7f,
+	10.0f, 0.0f, 0.8f, 10.0f, 0.0f, 0.90000004f, 11.0f, 0.0f,
+	0.90000004f, 11.0f, 0.0f, 0.8f, 10.0f, 0.0f, 0.90000004f, 10.0f,
+	0.0f, 1.0f, 11.0f, 0.0f, 1.0f, 11.0f, 0.0f, 0.90000004f,
+	11.0f, 0.0f, 0.0f, 11.0f, 0.0f, 0.1f, 12.0f, 0.0f,
+	0.1f, 12.0f, 0.0f, 0.0f, 11.0f, 0.0f, 0.1f, 11.0f,
+	0.0f, 0.2f, 12.0f, 0.0f, 0.2f, 12.0f, 0.0f, 0.1f,
+	11.0f, 0.0f, 0.2f, 11.0f, 0.0f, 0.3f, 12.0f, 0.0f,
+	0.3f, 12.0f, 0.0f, 0.2f, 11.0f, 0.0f, 0.3f, 11.0f,
+	0.0f, 0.4f, 12.0f, 0.0f, 0.4f, 12.0f, 0.0f, 0.3f,
+	11.0f, 0.0f, 0.4f, 11.0f, 0.0f, 0.5f, 12.0f, 0.0f,
+	0.5f, 12.0f, 0.0f, 0.4f, 11.0f, 0.0f, 0.5f, 11.0f,
+	0.0f, 0.6f, 12.0f, 0.0f, 0.6f, 12.0f, 0.0f, 0.5f,
+	11.0f, 0.0f, 0.6f, 11.0f, 0.0f, 0.7f, 12.0f, 0.0f,
+	0.7f, 12.0f, 0.0f, 0.6f, 11.0f, 0.0f, 0.7f, 11.0f,
+	0.0f, 0.8f, 12.0f, 0.0f, 0.8f, 12.0f, 0.0f, 0.7f,
+	11.0f, 0.0f, 0.8f, 11.0f, 0.0f, 0.90000004f, 12.0f, 0.0f,
+	0.90000004f, 12.0f, 0.0f, 0.8f, 11.0f, 0.0f, 0.90000004f, 11.0f,
+	0.0f, 1.0f, 12.0f, 0.0f, 1.0f, 12.0f, 0.0f, 0.90000004f,
+	12.0f, 0.0f, 0.0f, 12.0f, 0.0f, 0.1f, 13.0f, 0.0f,
+	0.1f, 13.0f, 0.0f, 0.0f, 12.0f, 0.0f, 0.1f, 12.0f,
+	0.0f, 0.2f, 13.0f, 0.0f, 0.2f, 13.0f, 0.0f, 0.1f,
+	12.0f, 0.0f, 0.2f, 12.0f, 0.0f, 0.3f, 13.0f, 0.0f,
+	0.3f, 13.0f, 0.0f, 0.2f, 12.0f, 0.0f, 0.3f, 12.0f,
+	0.0f, 0.4f, 13.0f, 0.0f, 0.4f, 13.0f, 0.0f, 0.3f,
+	12.0f, 0.0f, 0.4f, 12.0f, 0.0f, 0.5f, 13.0f, 0.0f,
+	0.5f, 13.0f, 0.0f, 0.4f, 12.0f, 0.0f, 0.5f, 12.0f,
+	0.0f, 0.6f, 13.0f, 0.0f, 0.6f, 13.0f, 0.0f, 0.5f,
+	12.0f, 0.0f, 0.6f, 12.0f, 0.0f, 0.7f, 13.0f, 0.0f,
+	0.7f, 13.0f, 0.0f, 0.6f, 12.0f, 0.0f, 0.7f, 12.0f,
+	0.0f, 0.8f, 13.0f, 0.0f, 0.8f, 13.0f, 0.0f, 0.7f,
+	12.0f, 0.0f, 0.8f, 12.0f, 0.0f, 0.90000004f, 13.0f, 0.0f,
+	0.90000004f, 13.0f, 0.0f, 0.8f, 12.0f, 0.0f, 0.90000004f, 12.0f,
+	0.0f, 1.0f, 13.0f, 0.0f, 1.0f, 13.0f, 0.0f, 0.90000004f,
+	13.0f, 0.0f, 0.0f, 13.0f, 0.0f, 0.1f, 14.0f, 0.0f,
+	0.1f, 14.0f, 0.0f, 0.0f, 13.0f, 0.0f, 0.1f, 13.0f,
+	0.0f, 0.2f, 14.0f, 0.0f, 0.2f, 14.0f, 0.0f, 0.1f,
+	13.0f, 0.0f, 0.2f, 13.0f, 0.0f, 0.3f, 14.0f, 0.0f,
+	0.3f, 14.0f, 0.0f, 0.2f, 13.0f, 0.0f, 0.3f, 13.0f,
+	0.0f, 0.4f, 14.0f, 0.0f, 0.4f, 14.0f, 0.0f, 0.3f,
+	13.0f, 0.0f, 0.4f, 13.0f, 0.0f, 0.5f, 14.0f, 0.0f,
+	0.5f, 14.0f, 0.0f, 0.4f, 13.0f, 0.0f, 0.5f, 13.0f,
+	0.0f, 0.6f, 14.0f, 0.0f, 0.6f, 14.0f, 0.0f, 0.5f,
+	13.0f, 0.0f, 0.6f, 13.0f, 0.0f, 0.7f, 14.0f, 0.0f,
+	0.7f, 14.0f, 0.0f, 0.6f, 13.0f, 0.0f, 0.7f, 13.0f,
+	0.0f, 0.8f, 14.0f, 0.0f, 0.8f, 14.0f, 0.0f, 0.7f,
+	13.0f, 0.0f, 0.8f, 13.0f, 0.0f, 0.90000004f, 14.0f, 0.0f,
+	0.90000004f, 14.0f, 0.0f, 0.8f, 13.0f, 0.0f, 0.90000004f, 13.0f,
+	0.0f, 1.0f, 14.0f, 0.0f, 1.0f, 14.0f, 0.0f, 0.90000004f,
+	14.0f, 0.0f, 0.0f, 14.0f, 0.0f, 0.1f, 15.0f, 0.0f,
+	0.1f, 15.0f, 0.0f, 0.0f, 14.0f, 0.0f, 0.1f, 14.0f,
+	0.0f, 0.2f, 15.0f, 0.0f, 0.2f, 15.0f, 0.0f, 0.1f,
+	14.0f, 0.0f, 0.2f, 14.0f, 0.0f, 0.3f, 15.0f, 0.0f,
+	0.3f, 15.0f, 0.0f, 0.2f, 14.0f, 0.0f, 0.3f, 14.0f,
+	0.0f, 0.4f, 15.0f, 0.0f, 0.4f, 15.0f, 0.0f, 0.3f,
+	14.0f, 0.0f, 0.4f, 14.0f, 0.0f, 0.5f, 15.0f, 0.0f,
+	0.5f, 15.0f, 0.0f, 0.4f, 14.0f, 0.0f, 0.5f, 14.0f,
+	0.0f, 0.6f, 15.0f, 0.0f, 0.6f, 15.0f, 0.0f, 0.5f,
+	14.0f, 0.0f, 0.6f, 14.0f, 0.0f, 0.7f, 15.0f, 0.0f,
+	0.7f, 15.0f, 0.0f, 0.6f, 14.0f, 0.0f, 0.7f, 14.0f,
+	0.0f, 0.8f, 15.0f, 0.0f, 0.8f, 15.0f, 0.0f, 0.7f,
+	14.0f, 0.0f, 0.8f, 14.0f, 0.0f, 0.90000004f, 15.0f, 0.0f,
+	0.90000004f, 15.0f, 0.0f, 0.8f, 14.0f, 0.0f, 0.90000004f, 14.0f,
+	0.0f, 1.0f, 15.0f, 0.0f, 1.0f, 15.0f, 0.0f, 0.90000004f,
+	15.0f, 0.0f, 0.0f, 15.0f, 0.0f, 0.1f, 16.0f, 0.0f,
+	0.1f, 16.0f, 0.0f, 0.0f, 15.0f, 0.0f, 0.1f, 15.0f,
+	0.0f, 0.2f, 16.0f, 0.0f, 0.2f, 16.0f, 0.0f, 0.1f,
+	15.0f, 0.0f, 0.2f, 15.0f, 0.0f, 0.3f, 16.0f, 0.0f,
+	0.3f, 16.0f, 0.0f, 0.2f, 15.0f, 0.0f, 0.3f, 15.0f,
+	0.0f, 0.4f, 16.0f, 0.0f, 0.4f, 16.0f, 0.0f, 0.3f,
+	15.0f, 0.0f, 0.4f, 15.0f, 0.0f, 0.5f, 16.0f, 0.0f,
+	0.5f, 16.0f, 0.0f, 0.4f, 15.0f, 0.0f, 0.5f, 15.0f,
+	0.0f, 0.6f, 16.0f, 0.0f, 0.6f, 16.0f, 0.0f, 0.5f,
+	15.0f, 0.0f, 0.6f, 15.0f, 0.0f, 0.7f, 16.0f, 0.0f,
+	0.7f, 16.0f, 0.0f, 0.6f, 15.0f, 0.0f, 0.7f, 15.0f,
+	0.0f, 0.8f, 16.0f, 0.0f, 0.8f, 16.0f, 0.0f, 0.7f,
+	15.0f, 0.0f, 0.8f, 15.0f, 0.0f, 0.90000004f, 16.0f, 0.0f,
+	0.90000004f, 16.0f, 0.0f, 0.8f, 15.0f, 0.0f, 0.90000004f, 15.0f,
+	0.0f, 1.0f, 16.0f, 0.0f, 1.0f, 16.0f, 0.0f, 0.90000004f,
+	16.0f, 0.0f, 0.0f, 16.0f, 0.0f, 0.1f, 17.0f, 0.0f,
+	0.1f, 17.0f, 0.0f, 0.0f, 16.0f, 0.0f, 0.1f, 16.0f,
+	0.0f, 0.2f, 17.0f, 0.0f, 0.2f, 17.0f, 0.0f, 0.1f,
+	16.0f, 0.0f, 0.2f, 16.0f, 0.0f, 0.3f, 17.0f, 0.0f,
+	0.3f, 17.0f, 0.0f, 0.2f, 16.0f, 0.0f, 0.3f, 16.0f,
+	0.0f, 0.4f, 17.0f, 0.0f, 0.4f, 17.0f, 0.0f, 0.3f,
+	16.0f, 0.0f, 0.4f, 16.0f, 0.0f, 0.5f, 17.0f, 0.0f,
+	0.5f, 17.0f, 0.0f, 0.4f, 16.0f, 0.0f, 0.5f, 16.0f,
+	0.0f, 0.6f, 17.0f, 0.0f, 0.6f, 17.0f, 0.0f, 0.5f,
+	16.0f, 0.0f, 0.6f, 16.0f, 0.0f, 0.7f, 17.0f, 0.0f,
+	0.7f, 17.0f, 0.0f, 0.6f, 16.0f, 0.0f, 0.7f, 16.0f,
+	0.0f, 0.8f, 17.0f, 0.0f, 0.8f, 17.0f, 0.0f, 0.7f,
+	16.0f, 0.0f, 0.8f, 16.0f, 0.0f, 0.90000004f, 17.0f, 0.0f,
+	0.90000004f, 17.0f, 0.0f, 0.8f, 16.0f, 0.0f, 0.90000004f, 16.0f,
+	0.0f, 1.0f, 17.0f, 0.0f, 1.0f, 17.0f, 0.0f, 0.90000004f,
+	17.0f, 0.0f, 0.0f, 17.0f, 0.0f, 0.1f, 18.0f, 0.0f,
+	0.1f, 18.0f, 0.0f, 0.0f, 17.0f, 0.0f, 0.1f, 17.0f,
+	0.0f, 0.2f, 18.0f, 0.0f, 0.2f, 18.0f, 0.0f, 0.1f,
+	17.0f, 0.0f, 0.2f, 17.0f, 0.0f, 0.3f, 18.0f, 0.0f,
+	0.3f, 18.0f, 0.0f, 0.2f, 17.0f, 0.0f, 0.3f, 17.0f,
+	0.0f, 0.4f, 18.0f, 0.0f, 0.4f, 18.0f, 0.0f, 0.3f,
+	17.0f, 0.0f, 0.4f, 17.0f, 0.0f, 0.5f, 18.0f, 0.0f,
+	0.5f, 18.0f, 0.0f, 0.4f, 17.0f, 0.0f, 0.5f, 17.0f,
+	0.0f, 0.6f, 18.0f, 0.0f, 0.6f, 18.0f, 0.0f, 0.5f,
+	17.0f, 0.0f, 0.6f, 17.0f, 0.0f, 0.7f, 18.0f, 0.0f,
+	0.7f, 18.0f, 0.0f, 0.6f, 17.0f, 0.0f, 0.7f, 17.0f,
+	0.0f, 0.8f, 18.0f, 0.0f, 0.8f, 18.0f, 0.0f, 0.7f,
+	17.0f, 0.0f, 0.8f, 17.0f, 0.0f, 0.90000004f, 18.0f, 0.0f,
+	0.90000004f, 18.0f, 0.0f, 0.8f, 17.0f, 0.0f, 0.90000004f, 17.0f,
+	0.0f, 1.0f, 18.0f, 0.0f, 1.0f, 18.0f, 0.0f, 0.90000004f,
+	18.0f, 0.0f, 0.0f, 18.0f, 0.0f, 0.1f, 19.0f, 0.0f,
+	0.1f, 19.0f, 0.0f, 0.0f, 18.0f, 0.0f, 0.1f, 18.0f,
+	0.0f, 0.2f, 19.0f, 0.0f, 0.2f, 19.0f, 0.0f, 0.1f,
+	18.0f, 0.0f, 0.2f, 18.0f, 0.0f, 0.3f, 19.0f, 0.0f,
+	0.3f, 19.0f, 0.0f, 0.2f, 18.0f, 0.0f, 0.3f, 18.0f,
+	0.0f, 0.4f, 19.0f, 0.0f, 0.4f, 19.0f, 0.0f, 0.3f,
+	18.0f, 0.0f, 0.4f, 18.0f, 0.0f, 0.5f, 19.0f, 0.0f,
+	0.5f, 19.0f, 0.0f, 0.4f, 18.0f, 0.0f, 0.5f, 18.0f,
+	0.0f, 0.6f, 19.0f, 0.0f, 0.6f, 19.0f, 0.0f, 0.5f,
+	18.0f, 0.0f, 0.6f, 18.0f, 0.0f, 0.7f, 19.0f, 0.0f,
+	0.7f, 19.0f, 0.0f, 0.6f, 18.0f, 0.0f, 0.7f, 18.0f,
+	0.0f, 0.8f, 19.0f, 0.0f, 0.8f, 19.0f, 0.0f, 0.7f,
+	18.0f, 0.0f, 0.8f, 18.0f, 0.0f, 0.90000004f, 19.0f, 0.0f,
+	0.90000004f, 19.0f, 0.0f, 0.8f, 18.0f, 0.0f, 0.90000004f, 18.0f,
+	0.0f, 1.0f, 19.0f, 0.0f, 1.0f, 19.0f, 0.0f, 0.90000004f,
+	19.0f, 0.0f, 0.0f, 19.0f, 0.0f, 0.1f, 20.0f, 0.0f,
+	0.1f, 20.0f, 0.0f, 0.0f, 19.0f, 0.0f, 0.1f, 19.0f,
+	0.0f, 0.2f, 20.0f, 0.0f, 0.2f, 20.0f, 0.0f, 0.1f,
+	19.0f, 0.0f, 0.2f, 19.0f, 0.0f, 0.3f, 20.0f, 0.0f,
+	0.3f, 20.0f, 0.0f, 0.2f, 19.0f, 0.0f, 0.3f, 19.0f,
+	0.0f, 0.4f, 20.0f, 0.0f, 0.4f, 20.0f, 0.0f, 0.3f,
+	19.0f, 0.0f, 0.4f, 19.0f, 0.0f, 0.5f, 20.0f, 0.0f,
+	0.5f, 20.0f, 0.0f, 0.4f, 19.0f, 0.0f, 0.5f, 19.0f,
+	0.0f, 0.6f, 20.0f, 0.0f, 0.6f, 20.0f, 0.0f, 0.5f,
+	19.0f, 0.0f, 0.6f, 19.0f, 0.0f, 0.7f, 20.0f, 0.0f,
+	0.7f, 20.0f, 0.0f, 0.6f, 19.0f, 0.0f, 0.7f, 19.0f,
+	0.0f, 0.8f, 20.0f, 0.0f, 0.8f, 20.0f, 0.0f, 0.7f,
+	19.0f, 0.0f, 0.8f, 19.0f, 0.0f, 0.90000004f, 20.0f, 0.0f,
+	0.90000004f, 20.0f, 0.0f, 0.8f, 19.0f, 0.0f, 0.90000004f, 19.0f,
+	0.0f, 1.0f, 20.0f, 0.0f, 1.0f, 20.0f, 0.0f, 0.90000004f,
+	0.0f, 1.0f, 1.0f, 0.0f, 0.9f, 1.0f, 1.0f, 0.9f,
+	1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.9f, 1.0f, 0.0f,
+	0.8f, 1.0f, 1.0f, 0.8f, 1.0f, 1.0f, 0.9f, 1.0f,
+	0.0f, 0.8f, 1.0f, 0.0f, 0.7f, 1.0f, 1.0f, 0.7f,
+	1.0f, 1.0f, 0.8f, 1.0f, 0.0f, 0.7f, 1.0f, 0.0f,
+	0.6f, 1.0f, 1.0f, 0.6f, 1.0f, 1.0f, 0.7f, 1.0f,
+	0.0f, 0.6f, 1.0f, 0.0f, 0.5f, 1.0f, 1.0f, 0.5f,
+	1.0f, 1.0f, 0.6f, 1.0f, 0.0f, 0.5f, 1.0f, 0.0f,
+	0.39999998f, 1.0f, 1.0f, 0.39999998f, 1.0f, 1.0f, 0.5f, 1.0f,
+	0.0f, 0.39999998f, 1.0f, 0.0f, 0.3f, 1.0f, 1.0f, 0.3f,
+	1.0f, 1.0f, 0.39999998f, 1.0f, 0.0f, 0.3f, 1.0f, 0.0f,
+	0.19999999f, 1.0f, 1.0f, 0.19999999f, 1.0f, 1.0f, 0.3f, 1.0f,
+	0.0f, 0.19999999f, 1.0f, 0.0f, 0.099999964f, 1.0f, 1.0f, 0.099999964f,
+	1.0f, 1.0f, 0.19999999f, 1.0f, 0.0f, 0.099999964f, 1.0f, 0.0f,
+	0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.099999964f, 1.0f,
+	1.0f, 1.0f, 1.0f, 1.0f, 0.9f, 1.0f, 2.0f, 0.9f,
+	1.0f, 2.0f, 1.0f, 1.0f, 1.0f, 0.9f, 1.0f, 1.0f,
+	0.8f, 1.0f, 2.0f, 0.8f, 1.0f, 2.0f, 0.9f, 1.0f,
+	1.0f, 0.8f, 1.0f, 1.0f, 0.7f, 1.0f, 2.0f, 0.7f,
+	1.0f, 2.0f, 0.8f, 1.0f, 1.0f, 0.7f, 1.0f, 1.0f,
+	0.6f, 1.0f, 2.0f, 0.6f, 1.0f, 2.0f, 0.7f, 1.0f,
+	1.0f, 0.6f, 1.0f, 1.0f, 0.5f, 1.0f, 2.0f, 0.5f,
+	1.0f, 2.0f, 0.6f, 1.0f, 1.0f, 0.5f, 1.0f, 1.0f,
+	0.39999998f, 1.0f, 2.0f, 0.39999998f, 1.0f, 2.0f, 0.5f, 1.0f,
+	1.0f, 0.39999998f, 1.0f, 1.0f, 0.3f, 1.0f, 2.0f, 0.3f,
+	1.0f, 2.0f, 0.39999998f, 1.0f, 1.0f, 0.3f, 1.0f, 1.0f,
+	0.19999999f, 1.0f, 2.0f, 0.19999999f, 1.0f, 2.0f, 0.3f, 1.0f,
+	1.0f, 0.19999999f, 1.0f, 1.0f, 0.099999964f, 1.0f, 2.0f, 0.099999964f,
+	1.0f, 2.0f, 0.19999999f, 1.0f, 1.0f, 0.099999964f, 1.0f, 1.0f,
+	0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f, 0.099999964f, 1.0f,
+	2.0f, 1.0f, 1.0f, 2.0f, 0.9f, 1.0f, 3.0f, 0.9f,
+	1.0f, 3.0f, 1.0f, 1.0f, 2.0f, 0.9f, 1.0f, 2.0f,
+	0.8f, 1.0f, 3.0f, 0.8f, 1.0f, 3.0f, 0.9f, 1.0f,
+	2.0f, 0.8f, 1.0f, 2.0f, 0.7f, 1.0f, 3.0f, 0.7f,
+	1.0f, 3.0f, 0.8f, 1.0f, 2.0f, 0.7f, 1.0f, 2.0f,
+	0.6f, 1.0f, 3.0f, 0.6f, 1.0f, 3.0f, 0.7f, 1.0f,
+	2.0f, 0.6f, 1.0f, 2.0f, 0.5f, 1.0f, 3.0f, 0.5f,
+	1.0f, 3.0f, 0.6f, 1.0f, 2.0f, 0.5f, 1.0f, 2.0f,
+	0.39999998f, 1.0f, 3.0f, 0.39999998f, 1.0f, 3.0f, 0.5f, 1.0f,
+	2.0f, 0.39999998f, 1.0f, 2.0f, 0.3f, 1.0f, 3.0f, 0.3f,
+	1.0f, 3.0f, 0.39999998f, 1.0f, 2.0f, 0.3f, 1.0f, 2.0f,
+	0.19999999f, 1.0f, 3.0f, 0.19999999f, 1.0f, 3.0f, 0.3f, 1.0f,
+	2.0f, 0.19999999f, 1.0f, 2.0f, 0.099999964f, 1.0f, 3.0f, 0.099999964f,
+	1.0f, 3.0f, 0.19999999f, 1.0f, 2.0f, 0.099999964f, 1.0f, 2.0f,
+	0.0f, 1.0f, 3.0f, 0.0f, 1.0f, 3.0f, 0.099999964f, 1.0f,
+	3.0f, 1.0f, 1.0f, 3.0f, 0.9f, 1.0f, 4.0f, 0.9f,
+	1.0f, 4.0f, 1.0f, 1.0f, 3.0f, 0.9f, 1.0f, 3.0f,
+	0.8f, 1.0f, 4.0f, 0.8f, 1.0f, 4.0f, 0.9f, 1.0f,
+	3.0f, 0.8f, 1.0f, 3.0f, 0.7f, 1.0f, 4.0f, 0.7f,
+	1.0f, 4.0f, 0.8f, 1.0f, 3.0f, 0.7f, 1.0f, 3.0f,
+	0.6f, 1.0f, 4.0f, 0.6f, 1.0f, 4.0f, 0.7f, 1.0f,
+	3.0f, 0.6f, 1.0f, 3.0f, 0.5f, 1.0f, 4.0f, 0.5f,
+	1.0f, 4.0f, 0.6f, 1.0f, 3.0f, 0.5f, 1.0f, 3.0f,
+	0.39999998f, 1.0f, 4.0f, 0.39999998f, 1.0f, 4.0f, 0.5f, 1.0f,
+	3.0f, 0.39999998f, 1.0f, 3.0f, 0.3f, 1.0f, 4.0f, 0.3f,
+	1.0f, 4.0f, 0.39999998f, 1.0f, 3.0f, 0.3f, 1.0f, 3.0f,
+	0.19999999f, 1.0f, 4.0f, 0.19999999f, 1.0f, 4.0f, 0.3f, 1.0f,
+	3.0f, 0.19999999f, 1.0f, 3.0f, 0.099999964f, 1.0f, 4.0f, 0.099999964f,
+	1.0f, 4.0f, 0.19999999f, 1.0f, 3.0f, 0.099999964f, 1.0f, 3.0f,
+	0.0f, 1.0f, 4.0f, 0.0f, 1.0f, 4.0f, 0.099999964f, 1.0f,
+	4.0f, 1.0f, 1.0f, 4.0f, 0.9f, 1.0f, 5.0f, 0.9f,
+	1.0f, 5.0f, 1.0f, 1.0f, 4.0f, 0.9f, 1.0f, 4.0f,
+	0.8f, 1.0f, 5.0f, 0.8f, 1.0f, 5.0f, 0.9f, 1.0f,
+	4.0f, 0.8f, 1.0f, 4.0f, 0.7f, 1.0f, 5.0f, 0.7f,
+	1.0f, 5.0f, 0.8f, 1.0f, 4.0f, 0.7f, 1.0f, 4.0f,
+	0.6f, 1.0f, 5.0f, 0.6f, 1.0f, 5.0f, 0.7f, 1.0f,
+	4.0f, 0.6f, 1.0f, 4.0f, 0.5f, 1.0f, 5.0f, 0.5f,
+	1.0f, 5.0f, 0.6f, 1.0f, 4.0f, 0.5f, 1.0f, 4.0f,
+	0.39999998f, 1.0f, 5.0f, 0.39999998f, 1.0f, 5.0f, 0.5f, 1.0f,
+	4.0f, 0.39999998f, 1.0f, 4.0f, 0.3f, 1.0f, 5.0f, 0.3f,
+	1.0f, 5.0f, 0.39999998f, 1.0f, 4.0f, 0.3f, 1.0f, 4.0f,
+	0.19999999f, 1.0f, 5.0f, 0.19999999f, 1.0f, 5.0f, 0.3f, 1.0f,
+	4.0f, 0.19999999f, 1.0f, 4.0f, 0.099999964f, 1.0f, 5.0f, 0.099999964f,
+	1.0f, 5.0f, 0.19999999f, 1.0f, 4.0f, 0.099999964f, 1.0f, 4.0f,
+	0.0f, 1.0f, 5.0f, 0.0f, 1.0f, 5.0f, 0.099999964f, 1.0f,
+	5.0f, 1.0f, 1.0f, 5.0f, 0.9f, 1.0f, 6.0f, 0.9f,
+	1.0f, 6.0f, 1.0f, 1.0f, 5.0f, 0.9f, 1.0f, 5.0f,
+	0.8f, 1.0f, 6.0f, 0.8f, 1.0f, 6.0f, 0.9f, 1.0f,
+	5.0f, 0.8f, 1.0f, 5.0f, 0.7f, 1.0f, 6.0f, 0.7f,
+	1.0f, 6.0f, 0.8f, 1.0f, 5.0f, 0.7f, 1.0f, 5.0f,
+	0.6f, 1.0f, 6.0f, 0.6f, 1.0f, 6.0f, 0.7f, 1.0f,
+	5.0f, 0.6f, 1.0f, 5.0f, 0.5f, 1.0f, 6.0f, 0.5f,
+	1.0f, 6.0f, 0.6f, 1.0f, 5.0f, 0.5f, 1.0f, 5.0f,
+	0.39999998f, 1.0f, 6.0f, 0.39999998f, 1.0f, 6.0f, 0.5f, 1.0f,
+	5.0f, 0.39999998f, 1.0f, 5.0f, 0.3f, 1.0f, 6.0f, 0.3f,
+	1.0f, 6.0f, 0.39999998f, 1.0f, 5.0f, 0.3f, 1.0f, 5.0f,
+	0.19999999f, 1.0f, 6.0f, 0.19999999f, 1.0f, 6.0f, 0.3f, 1.0f,
+	5.0f, 0.19999999f, 1.0f, 5.0f, 0.099999964f, 1.0f, 6.0f, 0.099999964f,
+	1.0f, 6.0f, 0.19999999f, 1.0f, 5.0f, 0.099999964f, 1.0f, 5.0f,
+	0.0f, 1.0f, 6.0f, 0.0f, 1.0f, 6.0f, 0.099999964f, 1.0f,
+	6.0f, 1.0f, 1.0f, 6.0f, 0.9f, 1.0f, 7.0f, 0.9f,
+	1.0f, 7.0f, 1.0f, 1.0f, 6.0f, 0.9f, 1.0f, 6.0f,
+	0.8f, 1.0f, 7.0f, 0.8f, 1.0f, 7.0f, 0.9f, 1.0f,
+	6.0f, 0.8f, 1.0f, 6.0f, 0.7f, 1.0f, 7.0f, 0.7f,
+	1.0f, 7.0f, 0.8f, 1.0f, 6.0f, 0.7f, 1.0f, 6.0f,
+	0.6f, 1.0f, 7.0f, 0.6f, 1.0f, 7.0f, 0.7f, 1.0f,
+	6.0f, 0.6f, 1.0f, 6.0f, 0.5f, 1.0f, 7.0f, 0.5f,
+	1.0f, 7.0f, 0.6f, 1.0f, 6.0f, 0.5f, 1.0f, 6.0f,
+	0.39999998f, 1.0f, 7.0f, 0.39999998f, 1.0f, 7.0f, 0.5f, 1.0f,
+	6.0f, 0.39999998f, 1.0f, 6.0f, 0.3f, 1.0f, 7.0f, 0.3f,
+	1.0f, 7.0f, 0.39999998f, 1.0f, 6.0f, 0.3f, 1.0f, 6.0f,
+	0.19999999f, 1.0f, 7.0f, 0.19999999f, 1.0f, 7.0f, 0.3f, 1.0f,
+	6.0f, 0.19999999f, 1.0f, 6.0f, 0.099999964f, 1.0f, 7.0f, 0.099999964f,
+	1.0f, 7.0f, 0.19999999f, 1.0f, 6.0f, 0.099999964f, 1.0f, 6.0f,
+	0.0f, 1.0f, 7.0f, 0.0f, 1.0f, 7.0f, 0.099999964f, 1.0f,
+	7.0f, 1.0f, 1.0f, 7.0f, 0.9f, 1.0f, 8.0f, 0.9f,
+	1.0f, 8.0f, 1.0f, 1.0f, 7.0f, 0.9f, 1.0f, 7.0f,
+	0.8f, 1.0f, 8.0f, 0.8f, 1.0f, 8.0f, 0.9f, 1.0f,
+	7.0f, 0.8f, 1.0f, 7.0f, 0.7f, 1.0f, 8.0f, 0.7f,
+	1.0f, 8.0f, 0.8f, 1.0f, 7.0f, 0.7f, 1.0f, 7.0f,
+	0.6f, 1.0f, 8.0f, 0.6f, 1.0f, 8.0f, 0.7f, 1.0f,
+	7.0f, 0.6f, 1.0f, 7.0f, 0.5f, 1.0f, 8.0f, 0.5f,
+	1.0f, 8.0f, 0.6f, 1.0f, 7.0f, 0.5f, 1.0f, 7.0f,
+	0.39999998f, 1.0f, 8.0f, 0.39999998f, 1.0f, 8.0f, 0.5f, 1.0f,
+	7.0f, 0.39999998f, 1.0f, 7.0f, 0.3f, 1.0f, 8.0f, 0.3f,
+	1.0f, 8.0f, 0.39999998f, 1.0f, 7.0f, 0.3f, 1.0f, 7.0f,
+	0.19999999f, 1.0f, 8.0f, 0.19999999f, 1.0f, 8.0f, 0.3f, 1.0f,
+	7.0f, 0.19999999f, 1.0f, 7.0f, 0.099999964f, 1.0f, 8.0f, 0.099999964f,
+	1.0f, 8.0f, 0.19999999f, 1.0f, 7.0f, 0.099999964f, 1.0f, 7.0f,
+	0.0f, 1.0f, 8.0f, 0.0f, 1.0f, 8.0f, 0.099999964f, 1.0f,
+	8.0f, 1.0f, 1.0f, 8.0f, 0.9f, 1.0f, 9.0f, 0.9f,
+	1.0f, 9.0f, 1.0f, 1.0f, 8.0f, 0.9f, 1.0f, 8.0f,
+	0.8f, 1.0f, 9.0f, 0.8f, 1.0f, 9.0f, 0.9f, 1.0f,
+	8.0f, 0.8f, 1.0f, 8.0f, 0.7f, 1.0f, 9.0f, 0.7f,
+	1.0f, 9.0f, 0.8f, 1.0f, 8.0f, 0.7f, 1.0f, 8.0f,
+	0.6f, 1.0f, 9.0f, 0.6f, 1.0f, 9.0f, 0.7f, 1.0f,
+	8.0f, 0.6f, 1.0f, 8.0f, 0.5f, 1.0f, 9.0f, 0.5f,
+	1.0f, 9.0f, 0.6f, 1.0f, 8.0f, 0.5f, 1.0f, 8.0f,
+	0.39999998f, 1.0f, 9.0f, 0.39999998f, 1.0f, 9.0f, 0.5f, 1.0f,
+	8.0f, 0.39999998f, 1.0f, 8.0f, 0.3f, 1.0f, 9.0f, 0.3f,
+	1.0f, 9.0f, 0.39999998f, 1.0f, 8.0f, 0.3f, 1.0f, 8.0f,
+	0.19999999f, 1.0f, 9.0f, 0.19999999f, 1.0f, 9.0f, 0.3f, 1.0f,
+	8.0f, 0.19999999f, 1.0f, 8.0f, 0.099999964f, 1.0f, 9.0f, 0.099999964f,
+	1.0f, 9.0f, 0.19999999f, 1.0f, 8.0f, 0.099999964f, 1.0f, 8.0f,
+	0.0f, 1.0f, 9.0f, 0.0f, 1.0f, 9.0f, 0.099999964f, 1.0f,
+	9.0f, 1.0f, 1.0f, 9.0f, 0.9f, 1.0f, 10.0f, 0.9f,
+	1.0f, 10.0f, 1.0f, 1.0f, 9.0f, 0.9f, 1.0f, 9.0f,
+	0.8f, 1.0f, 10.0f, 0.8f, 1.0f, 10.0f, 0.9f, 1.0f,
+	9.0f, 0.8f, 1.0f, 9.0f, 0.7f, 1.0f, 10.0f, 0.7f,
+	1.0f, 10.0f, 0.8f, 1.0f, 9.0f, 0.7f, 1.0f, 9.0f,
+	0.6f, 1.0f, 10.0f, 0.6f, 1.0f, 10.0f, 0.7f, 1.0f,
+	9.0f, 0.6f, 1.0f, 9.0f, 0.5f, 1.0f, 10.0f, 0.5f,
+	1.0f, 10.0f, 0.6f, 1.0f, 9.0f, 0.5f, 1.0f, 9.0f,
+	0.39999998f, 1.0f, 10.0f, 0.39999998f, 1.0f, 10.0f, 0.5f, 1.0f,
+	9.0f, 0.39999998f, 1.0f, 9.0f, 0.3f, 1.0f, 10.0f, 0.3f,
+	1.0f, 10.0f, 0.39999998f, 1.0f, 9.0f, 0.3f, 1.0f, 9.0f,
+	0.19999999f, 1.0f, 10.0f, 0.19999999f, 1.0f, 10.0f, 0.3f, 1.0f,
+	9.0f, 0.19999999f, 1.0f, 9.0f, 0.099999964f, 1.0f, 10.0f, 0.099999964f,
+	1.0f, 10.0f, 0.19999999f, 1.0f, 9.0f, 0.099999964f, 1.0f, 9.0f,
+	0.0f, 1.0f, 10.0f, 0.0f, 1.0f, 10.0f, 0.099999964f, 1.0f,
+	10.0f, 1.0f, 1.0f, 10.0f, 0.9f, 1.0f, 11.0f, 0.9f,
+	1.0f, 11.0f, 1.0f, 1.0f, 10.0f, 0.9f, 1.0f, 10.0f,
+	0.8f, 1.0f, 11.0f, 0.8f, 1.0f, 11.0f, 0.9f, 1.0f,
+	10.0f, 0.8f, 1.0f, 10.0f, 0.7f, 1.0f, 11.0f, 0.7f,
+	1.0f, 11.0f, 0.8f, 1.0f, 10.0f, 0.7f, 1.0f, 10.0f,
+	0.6f, 1.0f, 11.0f, 0.6f, 1.0f, 11.0f, 0.7f, 1.0f,
+	10.0f, 0.6f, 1.0f, 10.0f, 0.5f, 1.0f, 11.0f, 0.5f,
+	1.0f, 11.0f, 0.6f, 1.0f, 10.0f, 0.5f, 1.0f, 10.0f,
+	0.39999998f, 1.0f, 11.0f, 0.39999998f, 1.0f, 11.0f, 0.5f, 1.0f,
+	10.0f, 0.39999998f, 1.0f, 10.0f, 0.3f, 1.0f, 11.0f, 0.3f,
+	1.0f, 11.0f, 0.39999998f, 1.0f, 10.0f, 0.3f, 1.0f, 10.0f,
+	0.19999999f, 1.0f, 11.0f, 0.19999999f, 1.0f, 11.0f, 0.3f, 1.0f,
+	10.0f, 0.19999999f, 1.0f, 10.0f, 0.099999964f, 1.0f, 11.0f, 0.099999964f,
+	1.0f, 11.0f, 0.19999999f, 1.0f, 10.0f, 0.099999964f, 1.0f, 10.0f,
+	0.0f, 1.0f, 11.0f, 0.0f, 1.0f, 11.0f, 0.099999964f, 1.0f,
+	11.0f, 1.0f, 1.0f, 11.0f, 0.9f, 1.0f, 12.0f, 0.9f,
+	1.0f, 12.0f, 1.0f, 1.0f, 11.0f, 0.9f, 1.0f, 11.0f,
+	0.8f, 1.0f, 12.0f, 0.8f, 1.0f, 12.0f, 0.9f, 1.0f,
+	11.0f, 0.8f, 1.0f, 11.0f, 0.7f, 1.0f, 12.0f, 0.7f,
+	1.0f, 12.0f, 0.8f, 1.0f, 11.0f, 0.7f, 1.0f, 11.0f,
+	0.6f, 1.0f, 12.0f, 0.6f, 1.0f, 12.0f, 0.7f, 1.0f,
+	11.0f, 0.6f, 1.0f, 11.0f, 0.5f, 1.0f, 12.0f, 0.5f,
+	1.0f, 12.0f, 0.6f, 1.0f, 11.0f, 0.5f, 1.0f, 11.0f,
+	0.39999998f, 1.0f, 12.0f, 0.39999998f, 1.0f, 12.0f, 0.5f, 1.0f,
+	11.0f, 0.39999998f, 1.0f, 11.0f, 0.3f, 1.0f, 12.0f, 0.3f,
+	1.0f, 12.0f, 0.39999998f, 1.0f, 11.0f, 0.3f, 1.0f, 11.0f,
+	0.19999999f, 1.0f, 12.0f, 0.19999999f, 1.0f, 12.0f, 0.3f, 1.0f,
+	11.0f, 0.19999999f, 1.0f, 11.0f, 0.099999964f, 1.0f, 12.0f, 0.099999964f,
+	1.0f, 12.0f, 0.19999999f, 1.0f, 11.0f, 0.099999964f, 1.0f, 11.0f,
+	0.0f, 1.0f, 12.0f, 0.0f, 1.0f, 12.0f, 0.099999964f, 1.0f,
+	12.0f, 1.0f, 1.0f, 12.0f, 0.9f, 1.0f, 13.0f, 0.9f,
+	1.0f, 13.0f, 1.0f, 1.0f, 12.0f, 0.9f, 1.0f, 12.0f,
+	0.8f, 1.0f, 13.0f, 0.8f, 1.0f, 13.0f, 0.9f, 1.0f,
+	12.0f, 0.8f, 1.0f, 12.0f, 0.7f, 1.0f, 13.0f, 0.7f,
+	1.0f, 13.0f, 0.8f, 1.0f, 12.0f, 0.7f, 1.0f, 12.0f,
+	0.6f, 1.0f, 13.0f, 0.6f, 1.0f, 13.0f, 0.7f, 1.0f,
+	12.0f, 0.6f, 1.0f, 12.0f, 0.5f, 1.0f, 13.0f, 0.5f,
+	1.0f, 13.0f, 0.6f, 1.0f, 12.0f, 0.5f, 1.0f, 12.0f,
+	0.39999998f, 1.0f, 13.0f, 0.39999998f, 1.0f, 13.0f, 0.5f, 1.0f,
+	12.0f, 0.39999998f, 1.0f, 12.0f, 0.3f, 1.0f, 13.0f, 0.3f,
+	1.0f, 13.0f, 0.39999998f, 1.0f, 12.0f, 0.3f, 1.0f, 12.0f,
+	0.19999999f, 1.0f, 13.0f, 0.19999999f, 1.0f, 13.0f, 0.3f, 1.0f,
+	12.0f, 0.19999999f, 1.0f, 12.0f, 0.099999964f, 1.0f, 13.0f, 0.099999964f,
+	1.0f, 13.0f, 0.19999999f, 1.0f, 12.0f, 0.099999964f, 1.0f, 12.0f,
+	0.0f, 1.0f, 13.0f, 0.0f, 1.0f, 13.0f, 0.099999964f, 1.0f,
+	13.0f, 1.0f, 1.0f, 13.0f, 0.9f, 1.0f, 14.0f, 0.9f,
+	1.0f, 14.0f, 1.0f, 1.0f, 13.0f, 0.9f, 1.0f, 13.0f,
+	0.8f, 1.0f, 14.0f, 0.8f, 1.0f, 14.0f, 0.9f, 1.0f,
+	13.0f, 0.8f, 1.0f, 13.0f, 0.7f, 1.0f, 14.0f, 0.7f,
+	1.0f, 14.0f, 0.8f, 1.0f, 13.0f, 0.7f, 1.0f, 13.0f,
+	0.6f, 1.0f, 14.0f, 0.6f, 1.0f, 14.0f, 0.7f, 1.0f,
+	13.0f, 0.6f, 1.0f, 13.0f, 0.5f, 1.0f, 14.0f, 0.5f,
+	1.0f, 14.0f, 0.6f, 1.0f, 13.0f, 0.5f, 1.0f, 13.0f,
+	0.39999998f, 1.0f, 14.0f, 0.39999998f, 1.0f, 14.0f, 0.5f, 1.0f,
+	13.0f, 0.39999998f, 1.0f, 13.0f, 0.3f, 1.0f, 14.0f, 0.3f,
+	1.0f, 14.0f, 0.39999998f, 1.0f, 13.0f, 0.3f, 1.0f, 13.0f,
+	0.19999999f, 1.0f, 14.0f, 0.19999999f, 1.0f, 14.0f, 0.3f, 1.0f,
+	13.0f, 0.19999999f, 1.0f, 13.0f, 0.099999964f, 1.0f, 14.0f, 0.099999964f,
+	1.0f, 14.0f, 0.19999999f, 1.0f, 13.0f, 0.099999964f, 1.0f, 13.0f,
+	0.0f, 1.0f, 14.0f, 0.0f, 1.0f, 14.0f, 0.099999964f, 1.0f,
+	14.0f, 1.0f, 1.0f, 14.0f, 0.9f, 1.0f, 15.0f, 0.9f,
+	1.0f, 15.0f, 1.0f, 1.0f, 14.0f, 0.9f, 1.0f, 14.0f,
+	0.8f, 1.0f, 15.0f, 0.8f, 1.0f, 15.0f, 0.9f, 1.0f,
+	14.0f, 0.8f, 1.0f, 14.0f, 0.7f, 1.0f, 15.0f, 0.7f,
+	1.0f, 15.0f, 0.8f, 1.0f, 14.0f, 0.7f, 1.0f, 14.0f,
+	0.6f, 1.0f, 15.0f, 0.6f, 1.0f, 15.0f, 0.7f, 1.0f,
+	14.0f, 0.6f, 1.0f, 14.0f, 0.5f, 1.0f, 15.0f, 0.5f,
+	1.0f, 15.0f, 0.6f, 1.0f, 14.0f, 0.5f, 1.0f, 14.0f,
+	0.39999998f, 1.0f, 15.0f, 0.39999998f, 1.0f, 15.0f, 0.5f, 1.0f,
+	14.0f, 0.39999998f, 1.0f, 14.0f, 0.3f, 1.0f, 15.0f, 0.3f,
+	1.0f, 15.0f, 0.39999998f, 1.0f, 14.0f, 0.3f, 1.0f, 14.0f,
+	0.19999999f, 1.0f, 15.0f, 0.19999999f, 1.0f, 15.0f, 0.3f, 1.0f,
+	14.0f, 0.19999999f, 1.0f, 14.0f, 0.099999964f, 1.0f, 15.0f, 0.099999964f,
+	1.0f, 15.0f, 0.19999999f, 1.0f, 14.0f, 0.099999964f, 1.0f, 14.0f,
+	0.0f, 1.0f, 15.0f, 0.0f, 1.0f, 15.0f, 0.099999964f, 1.0f,
+	15.0f, 1.0f, 1.0f, 15.0f, 0.9f, 1.0f, 16.0f, 0.9f,
+	1.0f, 16.0f, 1.0f, 1.0f, 15.0f, 0.9f, 1.0f, 15.0f,
+	0.8f, 1.0f, 16.0f, 0.8f, 1.0f, 16.0f, 0.9f, 1.0f,
+	15.0f, 0.8f, 1.0f, 15.0f, 0.7f, 1.0f, 16.0f, 0.7f,
+	1.0f, 16.0f, 0.8f, 1.0f, 15.0f, 0.7f, 1.0f, 15.0f,
+	0.6f, 1.0f, 16.0f, 0.6f, 1.0f, 16.0f, 0.7f, 1.0f,
+	15.0f, 0.6f, 1.0f, 15.0f, 0.5f, 1.0f, 16.0f, 0.5f,
+	1.0f, 16.0f, 0.6f, 1.0f, 15.0f, 0.5f, 1.0f, 15.0f,
+	0.39999998f, 1.0f, 16.0f, 0.39999998f, 1.0f, 16.0f, 0.5f, 1.0f,
+	15.0f, 0.39999998f, 1.0f, 15.0f, 0.3f, 1.0f, 16.0f, 0.3f,
+	1.0f, 16.0f, 0.39999998f, 1.0f, 15.0f, 0.3f, 1.0f, 15.0f,
+	0.19999999f, 1.0f, 16.0f, 0.19999999f, 1.0f, 16.0f, 0.3f, 1.0f,
+	15.0f, 0.19999999f, 1.0f, 15.0f, 0.099999964f, 1.0f, 16.0f, 0.099999964f,
+	1.0f, 16.0f, 0.19999999f, 1.0f, 15.0f, 0.099999964f, 1.0f, 15.0f,
+	0.0f, 1.0f, 16.0f, 0.0f, 1.0f, 16.0f, 0.099999964f, 1.0f,
+	16.0f, 1.0f, 1.0f, 16.0f, 0.9f, 1.0f, 17.0f, 0.9f,
+	1.0f, 17.0f, 1.0f, 1.0f, 16.0f, 0.9f, 1.0f, 16.0f,
+	0.8f, 1.0f, 17.0f, 0.8f, 1.0f, 17.0f, 0.9f, 1.0f,
+	16.0f, 0.8f, 1.0f, 16.0f, 0.7f, 1.0f, 17.0f, 0.7f,
+	1.0f, 17.0f, 0.8f, 1.0f, 16.0f, 0.7f, 1.0f, 16.0f,
+	0.6f, 1.0f, 17.0f, 0.6f, 1.0f, 17.0f, 0.7f, 1.0f,
+	16.0f, 0.6f, 1.0f, 16.0f, 0.5f, 1.0f, 17.0f, 0.5f,
+	1.0f, 17.0f, 0.6f, 1.0f, 16.0f, 0.5f, 1.0f, 16.0f,
+	0.39999998f, 1.0f, 17.0f, 0.39999998f, 1.0f, 17.0f, 0.5f, 1.0f,
+	16.0f, 0.39999998f, 1.0f, 16.0f, 0.3f, 1.0f, 17.0f, 0.3f,
+	1.0f, 17.0f, 0.39999998f, 1.0f, 16.0f, 0.3f, 1.0f, 16.0f,
+	0.19999999f, 1.0f, 17.0f, 0.19999999f, 1.0f, 17.0f, 0.3f, 1.0f,
+	16.0f, 0.19999999f, 1.0f, 16.0f, 0.099999964f, 1.0f, 17.0f, 0.099999964f,
+	1.0f, 17.0f, 0.19999999f, 1.0f, 16.0f, 0.099999964f, 1.0f, 16.0f,
+	0.0f, 1.0f, 17.0f, 0.0f, 1.0f, 17.0f, 0.099999964f, 1.0f,
+	17.0f, 1.0f, 1.0f, 17.0f, 0.9f, 1.0f, 18.0f, 0.9f,
+	1.0f, 18.0f, 1.0f, 1.0f, 17.0f, 0.9f, 1.0f, 17.0f,
+	0.8f, 1.0f, 18.0f, 0.8f, 1.0f, 18.0f, 0.9f, 1.0f,
+	17.0f, 0.8f, 1.0f, 17.0f, 0.7f, 1.0f, 18.0f, 0.7f,
+	1.0f, 18.0f, 0.8f, 1.0f, 17.0f, 0.7f, 1.0f, 17.0f,
+	0.6f, 1.0f, 18.0f, 0.6f, 1.0f, 18.0f, 0.7f, 1.0f,
+	17.0f, 0.6f, 1.0f, 17.0f, 0.5f, 1.0f, 18.0f, 0.5f,
+	1.0f, 18.0f, 0.6f, 1.0f, 17.0f, 0.5f, 1.0f, 17.0f,
+	0.39999998f, 1.0f, 18.0f, 0.39999998f, 1.0f, 18.0f, 0.5f, 1.0f,
+	17.0f, 0.39999998f, 1.0f, 17.0f, 0.3f, 1.0f, 18.0f, 0.3f,
+	1.0f, 18.0f, 0.39999998f, 1.0f, 17.0f, 0.3f, 1.0f, 17.0f,
+	0.19999999f, 1.0f, 18.0f, 0.19999999f, 1.0f, 18.0f, 0.3f, 1.0f,
+	17.0f, 0.19999999f, 1.0f, 17.0f, 0.099999964f, 1.0f, 18.0f, 0.099999964f,
+	1.0f, 18.0f, 0.19999999f, 1.0f, 17.0f, 0.099999964f, 1.0f, 17.0f,
+	0.0f, 1.0f, 18.0f, 0.0f, 1.0f, 18.0f, 0.099999964f, 1.0f,
+	18.0f, 1.0f, 1.0f, 18.0f, 0.9f, 1.0f, 19.0f, 0.9f,
+	1.0f, 19.0f, 1.0f, 1.0f, 18.0f, 0.9f, 1.0f, 18.0f,
+	0.8f, 1.0f, 19.0f, 0.8f, 1.0f, 19.0f, 0.9f, 1.0f,
+	18.0f, 0.8f, 1.0f, 18.0f, 0.7f, 1.0f, 19.0f, 0.7f,
+	1.0f, 19.0f, 0.8f, 1.0f, 18.0f, 0.7f, 1.0f, 18.0f,
+	0.6f, 1.0f, 19.0f, 0.6f, 1.0f, 19.0f, 0.7f, 1.0f,
+	18.0f, 0.6f, 1.0f, 18.0f, 0.5f, 1.0f, 19.0f, 0.5f,
+	1.0f, 19.0f, 0.6f, 1.0f, 18.0f, 0.5f, 1.0f, 18.0f,
+	0.39999998f, 1.0f, 19.0f, 0.39999998f, 1.0f, 19.0f, 0.5f, 1.0f,
+	18.0f, 0.39999998f, 1.0f, 18.0f, 0.3f, 1.0f, 19.0f, 0.3f,
+	1.0f, 19.0f, 0.39999998f, 1.0f, 18.0f, 0.3f, 1.0f, 18.0f,
+	0.19999999f, 1.0f, 19.0f, 0.19999999f, 1.0f, 19.0f, 0.3f, 1.0f,
+	18.0f, 0.19999999f, 1.0f, 18.0f, 0.099999964f, 1.0f, 19.0f, 0.099999964f,
+	1.0f, 19.0f, 0.19999999f, 1.0f, 18.0f, 0.099999964f, 1.0f, 18.0f,
+	0.0f, 1.0f, 19.0f, 0.0f, 1.0f, 19.0f, 0.099999964f, 1.0f,
+	19.0f, 1.0f, 1.0f, 19.0f, 0.9f, 1.0f, 20.0f, 0.9f,
+	1.0f, 20.0f, 1.0f, 1.0f, 19.0f, 0.9f, 1.0f, 19.0f,
+	0.8f, 1.0f, 20.0f, 0.8f, 1.0f, 20.0f, 0.9f, 1.0f,
+	19.0f, 0.8f, 1.0f, 19.0f, 0.7f, 1.0f, 20.0f, 0.7f,
+	1.0f, 20.0f, 0.8f, 1.0f, 19.0f, 0.7f, 1.0f, 19.0f,
+	0.6f, 1.0f, 20.0f, 0.6f, 1.0f, 20.0f, 0.7f, 1.0f,
+	19.0f, 0.6f, 1.0f, 19.0f, 0.5f, 1.0f, 20.0f, 0.5f,
+	1.0f, 20.0f, 0.6f, 1.0f, 19.0f, 0.5f, 1.0f, 19.0f,
+	0.39999998f, 1.0f, 20.0f, 0.39999998f, 1.0f, 20.0f, 0.5f, 1.0f,
+	19.0f, 0.39999998f, 1.0f, 19.0f, 0.3f, 1.0f, 20.0f, 0.3f,
+	1.0f, 20.0f, 0.39999998f, 1.0f, 19.0f, 0.3f, 1.0f, 19.0f,
+	0.19999999f, 1.0f, 20.0f, 0.19999999f, 1.0f, 20.0f, 0.3f, 1.0f,
+	19.0f, 0.19999999f, 1.0f, 19.0f, 0.099999964f, 1.0f, 20.0f, 0.099999964f,
+	1.0f, 20.0f, 0.19999999f, 1.0f, 19.0f, 0.099999964f, 1.0f, 19.0f,
+	0.0f, 1.0f, 20.0f, 0.0f, 1.0f, 20.0f, 0.099999964f, 1.0f,
+	0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.9f, 1.0f, 1.0f,
+	0.9f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.9f, 0.0f,
+	1.0f, 0.8f, 1.0f, 1.0f, 0.8f, 1.0f, 1.0f, 0.9f,
+	0.0f, 1.0f, 0.8f, 0.0f, 1.0f, 0.7f, 1.0f, 1.0f,
+	0.7f, 1.0f, 1.0f, 0.8f, 0.0f, 1.0f, 0.7f, 0.0f,
+	1.0f, 0.6f, 1.0f, 1.0f, 0.6f, 1.0f, 1.0f, 0.7f,
+	0.0f, 1.0f, 0.6f, 0.0f, 1.0f, 0.5f, 1.0f, 1.0f,
+	0.5f, 1.0f, 1.0f, 0.6f, 0.0f, 1.0f, 0.5f, 0.0f,
+	1.0f, 0.39999998f, 1.0f, 1.0f, 0.39999998f, 1.0f, 1.0f, 0.5f,
+	0.0f, 1.0f, 0.39999998f, 0.0f, 1.0f, 0.3f, 1.0f, 1.0f,
+	0.3f, 1.0f, 1.0f, 0.39999998f, 0.0f, 1.0f, 0.3f, 0.0f,
+	1.0f, 0.19999999f, 1.0f, 1.0f, 0.19999999f, 1.0f, 1.0f, 0.3f,
+	0.0f, 1.0f, 0.19999999f, 0.0f, 1.0f, 0.099999964f, 1.0f, 1.0f,
+	0.099999964f, 1.0f, 1.0f, 0.19999999f, 0.0f, 1.0f, 0.099999964f, 0.0f,
+	1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.099999964f,
+	1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.9f, 2.0f, 1.0f,
+	0.9f, 2.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.9f, 1.0f,
+	1.0f, 0.8f, 2.0f, 1.0f, 0.8f, 2.0f, 1.0f, 0.9f,
+	1.0f, 1.0f, 0.8f, 1.0f, 1.0f, 0.7f, 2.0f, 1.0f,
+	0.7f, 2.0f, 1.0f, 0.8f, 1.0f, 1.0f, 0.7f, 1.0f,
+	1.0f, 0.6f, 2.0f, 1.0f, 0.6f, 2.0f, 1.0f, 0.7f,
+	1.0f, 1.0f, 0.6f, 1.0f, 1.0f, 0.5f, 2.0f, 1.0f,
+	0.5f, 2.0f, 1.0f, 0.6f, 1.0f, 1.0f, 0.5f, 1.0f,
+	1.0f, 0.39999998f, 2.0f, 1.0f, 0.39999998f, 2.0f, 1.0f, 0.5f,
+	1.0f, 1.0f, 0.39999998f, 1.0f, 1.0f, 0.3f, 2.0f, 1.0f,
+	0.3f, 2.0f, 1.0f, 0.39999998f, 1.0f, 1.0f, 0.3f, 1.0f,
+	1.0f, 0.19999999f, 2.0f, 1.0f, 0.19999999f, 2.0f, 1.0f, 0.3f,
+	1.0f, 1.0f, 0.19999999f, 1.0f, 1.0f, 0.099999964f, 2.0f, 1.0f,
+	0.099999964f, 2.0f, 1.0f, 0.19999999f, 1.0f, 1.0f, 0.099999964f, 1.0f,
+	1.0f, 0.0f, 2.0f, 1.0f, 0.0f, 2.0f, 1.0f, 0.099999964f,
+	2.0f, 1.0f, 1.0f, 2.0f, 1.0f, 0.9f, 3.0f, 1.0f,
+	0.9f, 3.0f, 1.0f, 1.0f, 2.0f, 1.0f, 0.9f, 2.0f,
+	1.0f, 0.8f, 3.0f, 1.0f, 0.8f, 3.0f, 1.0f, 0.9f,
+	2.0f, 1.0f, 0.8f, 2.0f, 1.0f, 0.7f, 3.0f, 1.0f,
+	0.7f, 3.0f, 1.0f, 0.8f, 2.0f, 1.0f, 0.7f, 2.0f,
+	1.0f, 0.6f, 3.0f, 1.0f, 0.6f, 3.0f, 1.0f, 0.7f,
+	2.0f, 1.0f, 0.6f, 2.0f, 1.0f, 0.5f, 3.0f, 1.0f,
+	0.5f, 3.0f, 1.0f, 0.6f, 2.0f, 1.0f, 0.5f, 2.0f,
+	1.0f, 0.39999998f, 3.0f, 1.0f, 0.39999998f, 3.0f, 1.0f, 0.5f,
+	2.0f, 1.0f, 0.39999998f, 2.0f, 1.0f, 0.3f, 3.0f, 1.0f,
+	0.3f, 3.0f, 1.0f, 0.39999998f, 2.0f, 1.0f, 0.3f, 2.0f,
+	1.0f, 0.19999999f, 3.0f, 1.0f, 0.19999999f, 3.0f, 1.0f, 0.3f,
+	2.0f, 1.0f, 0.19999999f, 2.0f, 1.0f, 0.099999964f, 3.0f, 1.0f,
+	0.099999964f, 3.0f, 1.0f, 0.19999999f, 2.0f, 1.0f, 0.099999964f, 2.0f,
+	1.0f, 0.0f, 3.0f, 1.0f, 0.0f, 3.0f, 1.0f, 0.099999964f,
+	3.0f, 1.0f, 1.0f, 3.0f, 1.0f, 0.9f, 4.0f, 1.0f,
+	0.9f, 4.0f, 1.0f, 1.0f, 3.0f, 1.0f, 0.9f, 3.0f,
+	1.0f, 0.8f, 4.0f, 1.0f, 0.8f, 4.0f, 1.0f, 0.9f,
+	3.0f, 1.0f, 0.8f, 3.0f, 1.0f, 0.7f, 4.0f, 1.0f,
+	0.7f, 4.0f, 1.0f, 0.8f, 3.0f, 1.0f, 0.7f, 3.0f,
+	1.0f, 0.6f, 4.0f, 1.0f, 0.6f, 4.0f, 1.0f, 0.7f,
+	3.0f, 1.0f, 0.6f, 3.0f, 1.0f, 0.5f, 4.0f, 1.0f,
+	0.5f, 4.0f, 1.0f, 0.6f, 3.0f, 1.0f, 0.5f, 3.0f,
+	1.0f, 0.39999998f, 4.0f, 1.0f, 0.39999998f, 4.0f, 1.0f, 0.5f,
+	3.0f, 1.0f, 0.39999998f, 3.0f, 1.0f, 0.3f, 4.0f, 1.0f,
+	0.3f, 4.0f, 1.0f, 0.39999998f, 3.0f, 1.0f, 0.3f, 3.0f,
+	1.0f, 0.19999999f, 4.0f, 1.0f, 0.19999999f, 4.0f, 1.0f, 0.3f,
+	3.0f, 1.0f, 0.19999999f, 3.0f, 1.0f, 0.099999964f, 4.0f, 1.0f,
+	0.099999964f, 4.0f, 1.0f, 0.19999999f, 3.0f, 1.0f, 0.099999964f, 3.0f,
+	1.0f, 0.0f, 4.0f, 1.0f, 0.0f, 4.0f, 1.0f, 0.099999964f,
+	4.0f, 1.0f, 1.0f, 4.0f, 1.0f, 0.9f, 5.0f, 1.0f,
+	0.9f, 5.0f, 1.0f, 1.0f, 4.0f, 1.0f, 0.9f, 4.0f,
+	1.0f, 0.8f, 5.0f, 1.0f, 0.8f, 5.0f, 1.0f, 0.9f,
+	4.0f, 1.0f, 0.8f, 4.0f, 1.0f, 0.7f, 5.0f, 1.0f,
+	0.7f, 5.0f, 1.0f, 0.8f, 4.0f, 1.0f, 0.7f, 4.0f,
+	1.0f, 0.6f, 5.0f, 1.0f, 0.6f, 5.0f, 1.0f, 0.7f,
+	4.0f, 1.0f, 0.6f, 4.0f, 1.0f, 0.5f, 5.0f, 1.0f,
+	0.5f, 5.0f, 1.0f, 0.6f, 4.0f, 1.0f, 0.5f, 4.0f,
+	1.0f, 0.39999998f, 5.0f, 1.0f, 0.39999998f, 5.0f, 1.0f, 0.5f,
+	4.0f, 1.0f, 0.39999998f, 4.0f, 1.0f, 0.3f, 5.0f, 1.0f,
+	0.3f, 5.0f, 1.0f, 0.39999998f, 4.0f, 1.0f, 0.3f, 4.0f,
+	1.0f, 0.19999999f, 5.0f, 1.0f, 0.19999999f, 5.0f, 1.0f, 0.3f,
+	4.0f, 1.0f, 0.19999999f, 4.0f, 1.0f, 0.099999964f, 5.0f, 1.0f,
+	0.099999964f, 5.0f, 1.0f, 0.19999999f, 4.0f, 1.0f, 0.099999964f, 4.0f,
+	1.0f, 0.0f, 5.0f, 1.0f, 0.0f, 5.0f, 1.0f, 0.099999964f,
+	5.0f, 1.0f, 1.0f, 5.0f, 1.0f, 0.9f, 6.0f, 1.0f,
+	0.9f, 6.0f, 1.0f, 1.0f, 5.0f, 1.0f, 0.9f, 5.0f,
+	1.0f, 0.8f, 6.0f, 1.0f, 0.8f, 6.0f, 1.0f, 0.9f,
+	5.0f, 1.0f, 0.8f, 5.0f, 1.0f, 0.7f, 6.0f, 1.0f,
+	0.7f, 6.0f, 1.0f, 0.8f, 5.0f, 1.0f, 0.7f, 5.0f,
+	1.0f, 0.6f, 6.0f, 1.0f, 0.6f, 6.0f, 1.0f, 0.7f,
+	5.0f, 1.0f, 0.6f, 5.0f, 1.0f, 0.5f, 6.0f, 1.0f,
+	0.5f, 6.0f, 1.0f, 0.6f, 5.0f, 1.0f, 0.5f, 5.0f,
+	1.0f, 0.39999998f, 6.0f, 1.0f, 0.39999998f, 6.0f, 1.0f, 0.5f,
+	5.0f, 1.0f, 0.39999998f, 5.0f, 1.0f, 0.3f, 6.0f, 1.0f,
+	0.3f, 6.0f, 1.0f, 0.39999998f, 5.0f, 1.0f, 0.3f, 5.0f,
+	1.0f, 0.19999999f, 6.0f, 1.0f, 0.19999999f, 6.0f, 1.0f, 0.3f,
+	5.0f, 1.0f, 0.19999999f, 5.0f, 1.0f, 0.099999964f, 6.0f, 1.0f,
+	0.099999964f, 6.0f, 1.0f, 0.19999999f, 5.0f, 1.0f, 0.099999964f, 5.0f,
+	1.0f, 0.0f, 6.0f, 1.0f, 0.0f, 6.0f, 1.0f, 0.099999964f,
+	6.0f, 1.0f, 1.0f, 6.0f, 1.0f, 0.9f, 7.0f, 1.0f,
+	0.9f, 7.0f, 1.0f, 1.0f, 6.0f, 1.0f, 0.9f, 6.0f,
+	1.0f, 0.8f, 7.0f, 1.0f, 0.8f, 7.0f, 1.0f, 0.9f,
+	6.0f, 1.0f, 0.8f, 6.0f, 1.0f, 0.7f, 7.0f, 1.0f,
+	0.7f, 7.0f, 1.0f, 0.8f, 6.0f, 1.0f, 0.7f, 6.0f,
+	1.0f, 0.6f, 7.0f, 1.0f, 0.6f, 7.0f, 1.0f, 0.7f,
+	6.0f, 1.0f, 0.6f, 6.0f, 1.0f, 0.5f, 7.0f, 1.0f,
+	0.5f, 7.0f, 1.0f, 0.6f, 6.0f, 1.0f, 0.5f, 6.0f,
+	1.0f, 0.39999998f, 7.0f, 1.0f, 0.39999998f, 7.0f, 1.0f, 0.5f,
+	6.0f, 1.0f, 0.39999998f, 6.0f, 1.0f, 0.3f, 7.0f, 1.0f,
+	0.3f, 7.0f, 1.0f, 0.39999998f, 6.0f, 1.0f, 0.3f, 6.0f,
+	1.0f, 0.19999999f, 7.0f, 1.0f, 0.19999999f, 7.0f, 1.0f, 0.3f,
+	6.0f, 1.0f, 0.19999999f, 6.0f, 1.0f, 0.099999964f, 7.0f, 1.0f,
+	0.099999964f, 7.0f, 1.0f, 0.19999999f, 6.0f, 1.0f, 0.099999964f, 6.0f,
+	1.0f, 0.0f, 7.0f, 1.0f, 0.0f, 7.0f, 1.0f, 0.099999964f,
+	7.0f, 1.0f, 1.0f, 7.0f, 1.0f, 0.9f, 8.0f, 1.0f,
+	0.9f, 8.0f, 1.0f, 1.0f, 7.0f, 1.0f, 0.9f, 7.0f,
+	1.0f, 0.8f, 8.0f, 1.0f, 0.8f, 8.0f, 1.0f, 0.9f,
+	7.0f, 1.0f, 0.8f, 7.0f, 1.0f, 0.7f, 8.0f, 1.0f,
+	0.7f, 8.0f, 1.0f, 0.8f, 7.0f, 1.0f, 0.7f, 7.0f,
+	1.0f, 0.6f, 8.0f, 1.0f, 0.6f, 8.0f, 1.0f, 0.7f,
+	7.0f, 1.0f, 0.6f, 7.0f, 1.0f, 0.5f, 8.0f, 1.0f,
+	0.5f, 8.0f, 1.0f, 0.6f, 7.0f, 1.0f, 0.5f, 7.0f,
+	1.0f, 0.39999998f, 8.0f, 1.0f, 0.39999998f, 8.0f, 1.0f, 0.5f,
+	7.0f, 1.0f, 0.39999998f, 7.0f, 1.0f, 0.3f, 8.0f, 1.0f,
+	0.3f, 8.0f, 1.0f, 0.39999998f, 7.0f, 1.0f, 0.3f, 7.0f,
+	1.0f, 0.19999999f, 8.0f, 1.0f, 0.19999999f, 8.0f, 1.0f, 0.3f,
+	7.0f, 1.0f, 0.19999999f, 7.0f, 1.0f, 0.099999964f, 8.0f, 1.0f,
+	0.099999964f, 8.0f, 1.0f, 0.19999999f, 7.0f, 1.0f, 0.099999964f, 7.0f,
+	1.0f, 0.0f, 8.0f, 1.0f, 0.0f, 8.0f, 1.0f, 0.099999964f,
+	8.0f, 1.0f, 1.0f, 8.0f, 1.0f, 0.9f, 9.0f, 1.0f,
+	0.9f, 9.0f, 1.0f, 1.0f, 8.0f, 1.0f, 0.9f, 8.0f,
+	1.0f, 0.8f, 9.0f, 1.0f, 0.8f, 9.0f, 1.0f, 0.9f,
+	8.0f, 1.0f, 0.8f, 8.0f, 1.0f, 0.7f, 9.0f, 1.0f,
+	0.7f, 9.0f, 1.0f, 0.8f, 8.0f, 1.0f, 0.7f, 8.0f,
+	1.0f, 0.6f, 9.0f, 1.0f, 0.6f, 9.0f, 1.0f, 0.7f,
+	8.0f, 1.0f, 0.6f, 8.0f, 1.0f, 0.5f, 9.0f, 1.0f,
+	0.5f, 9.0f, 1.0f, 0.6f, 8.0f, 1.0f, 0.5f, 8.0f,
+	1.0f, 0.39999998f, 9.0f, 1.0f, 0.39999998f, 9.0f, 1.0f, 0.5f,
+	8.0f, 1.0f, 0.39999998f, 8.0f, 1.0f, 0.3f, 9.0f, 1.0f,
+	0.3f, 9.0f, 1.0f, 0.39999998f, 8.0f, 1.0f, 0.3f, 8.0f,
+	1.0f, 0.19999999f, 9.0f, 1.0f, 0.19999999f, 9.0f, 1.0f, 0.3f,
+	8.0f, 1.0f, 0.19999999f, 8.0f, 1.0f, 0.099999964f, 9.0f, 1.0f,
+	0.099999964f, 9.0f, 1.0f, 0.19999999f, 8.0f, 1.0f, 0.099999964f, 8.0f,
+	1.0f, 0.0f, 9.0f, 1.0f, 0.0f, 9.0f, 1.0f, 0.099999964f,
+	9.0f, 1.0f, 1.0f, 9.0f, 1.0f, 0.9f, 10.0f, 1.0f,
+	0.9f, 10.0f, 1.0f, 1.0f, 9.0f, 1.0f, 0.9f, 9.0f,
+	1.0f, 0.8f, 10.0f, 1.0f, 0.8f, 10.0f, 1.0f, 0.9f,
+	9.0f, 1.0f, 0.8f, 9.0f, 1.0f, 0.7f, 10.0f, 1.0f,
+	0.7f, 10.0f, 1.0f, 0.8f, 9.0f, 1.0f, 0.7f, 9.0f,
+	1.0f, 0.6f, 10.0f, 1.0f, 0.6f, 10.0f, 1.0f, 0.7f,
+	9.0f, 1.0f, 0.6f, 9.0f, 1.0f, 0.5f, 10.0f, 1.0f,
+	0.5f, 10.0f, 1.0f, 0.6f, 9.0f, 1.0f, 0.5f, 9.0f,
+	1.0f, 0.39999998f, 10.0f, 1.0f, 0.39999998f, 10.0f, 1.0f, 0.5f,
+	9.0f, 1.0f, 0.39999998f, 9.0f, 1.0f, 0.3f, 10.0f, 1.0f,
+	0.3f, 10.0f, 1.0f, 0.39999998f, 9.0f, 1.0f, 0.3f, 9.0f,
+	1.0f, 0.19999999f, 10.0f, 1.0f, 0.19999999f, 10.0f, 1.0f, 0.3f,
+	9.0f, 1.0f, 0.19999999f, 9.0f, 1.0f, 0.099999964f, 10.0f, 1.0f,
+	0.099999964f, 10.0f, 1.0f, 0.19999999f, 9.0f, 1.0f, 0.099999964f, 9.0f,
+	1.0f, 0.0f, 10.0f, 1.0f, 0.0f, 10.0f, 1.0f, 0.099999964f,
+	10.0f, 1.0f, 1.0f, 10.0f, 1.0f, 0.9f, 11.0f, 1.0f,
+	0.9f, 11.0f, 1.0f, 1.0f, 10.0f, 1.0f, 0.9f, 10.0f,
+	1.0f, 0.8f, 11.0f, 1.0f, 0.8f, 11.0f, 1.0f, 0.9f,
+	10.0f, 1.0f, 0.8f, 10.0f, 1.0f, 0.7f, 11.0f, 1.0f,
+	0.7f, 11.0f, 1.0f, 0.8f, 10.0f, 1.0f, 0.7f, 10.0f,
+	1.0f, 0.6f, 11.0f, 1.0f, 0.6f, 11.0f, 1.0f, 0.7f,
+	10.0f, 1.0f, 0.6f, 10.0f, 1.0f, 0.5f, 11.0f, 1.0f,
+	0.5f, 11.0f, 1.0f, 0.6f, 10.0f, 1.0f, 0.5f, 10.0f,
+	1.0f, 0.39999998f, 11.0f, 1.0f, 0.39999998f, 11.0f, 1.0f, 0.5f,
+	10.0f, 1.0f, 0.39999998f, 10.0f, 1.0f, 0.3f, 11.0f, 1.0f,
+	0.3f, 11.0f, 1.0f, 0.39999998f, 10.0f, 1.0f, 0.3f, 10.0f,
+	1.0f, 0.19999999f, 11.0f, 1.0f, 0.19999999f, 11.0f, 1.0f, 0.3f,
+	10.0f, 1.0f, 0.19999999f, 10.0f, 1.0f, 0.099999964f, 11.0f, 1.0f,
+	0.099999964f, 11.0f, 1.0f, 0.19999999f, 10.0f, 1.0f, 0.099999964f, 10.0f,
+	1.0f, 0.0f, 11.0f, 1.0f, 0.0f, 11.0f, 1.0f, 0.099999964f,
+	11.0f, 1.0f, 1.0f, 11.0f, 1.0f, 0.9f, 12.0f, 1.0f,
+	0.9f, 12.0f, 1.0f, 1.0f, 11.0f, 1.0f, 0.9f, 11.0f,
+	1.0f, 0.8f, 12.0f, 1.0f, 0.8f, 12.0f, 1.0f, 0.9f,
+	11.0f, 1.0f, 0.8f, 11.0f, 1.0f, 0.7f, 12.0f, 1.0f,
+	0.7f, 12.0f, 1.0f, 0.8f, 11.0f, 1.0f, 0.7f, 11.0f,
+	1.0f, 0.6f, 12.0f, 1.0f, 0.6f, 12.0f, 1.0f, 0.7f,
+	11.0f, 1.0f, 0.6f, 11.0f, 1.0f, 0.5f, 12.0f, 1.0f,
+	0.5f, 12.0f, 1.0f, 0.6f, 11.0f, 1.0f, 0.5f, 11.0f,
+	1.0f, 0.39999998f, 12.0f, 1.0f, 0.39999998f, 12.0f, 1.0f, 0.5f,
+	11.0f, 1.0f, 0.39999998f, 11.0f, 1.0f, 0.3f, 12.0f, 1.0f,
+	0.3f, 12.0f, 1.0f, 0.39999998f, 11.0f, 1.0f, 0.3f, 11.0f,
+	1.0f, 0.19999999f, 12.0f, 1.0f, 0.19999999f, 12.0f, 1.0f, 0.3f,
+	11.0f, 1.0f, 0.19999999f, 11.0f, 1.0f, 0.099999964f, 12.0f, 1.0f,
+	0.099999964f, 12.0f, 1.0f, 0.19999999f, 11.0f, 1.0f, 0.099999964f, 11.0f,
+	1.0f, 0.0f, 12.0f, 1.0f, 0.0f, 12.0f, 1.0f, 0.099999964f,
+	12.0f, 1.0f, 1.0f, 12.0f, 1.0f, 0.9f, 13.0f, 1.0f,
+	0.9f, 13.0f, 1.0f, 1.0f, 12.0f, 1.0f, 0.9f, 12.0f,
+	1.0f, 0.8f, 13.0f, 1.0f, 0.8f, 13.0f, 1.0f, 0.9f,
+	12.0f, 1.0f, 0.8f, 12.0f, 1.0f, 0.7f, 13.0f, 1.0f,
+	0.7f, 13.0f, 1.0f, 0.8f, 12.0f, 1.0f, 0.7f, 12.0f,
+	1.0f, 0.6f, 13.0f, 1.0f, 0.6f, 13.0f, 1.0f, 0.7f,
+	12.0f, 1.0f, 0.6f, 12.0f, 1.0f, 0.5f, 13.0f, 1.0f,
+	0.5f, 13.0f, 1.0f, 0.6f, 12.0f, 1.0f, 0.5f, 12.0f,
+	1.0f, 0.39999998f, 13.0f, 1.0f, 0.39999998f, 13.0f, 1.0f, 0.5f,
+	12.0f, 1.0f, 0.39999998f, 12.0f, 1.0f, 0.3f, 13.0f, 1.0f,
+	0.3f, 13.0f, 1.0f, 0.39999998f, 12.0f, 1.0f, 0.3f, 12.0f,
+	1.0f, 0.19999999f, 13.0f, 1.0f, 0.19999999f, 13.0f, 1.0f, 0.3f,
+	12.0f, 1.0f, 0.19999999f, 12.0f, 1.0f, 0.099999964f, 13.0f, 1.0f,
+	0.099999964f, 13.0f, 1.0f, 0.19999999f, 12.0f, 1.0f, 0.099999964f, 12.0f,
+	1.0f, 0.0f, 13.0f, 1.0f, 0.0f, 13.0f, 1.0f, 0.099999964f,
+	13.0f, 1.0f, 1.0f, 13.0f, 1.0f, 0.9f, 14.0f, 1.0f,
+	0.9f, 14.0f, 1.0f, 1.0f, 13.0f, 1.0f, 0.9f, 13.0f,
+	1.0f, 0.8f, 14.0f, 1.0f, 0.8f, 14.0f, 1.0f, 0.9f,
+	13.0f, 1.0f, 0.8f, 13.0f, 1.0f, 0.7f, 14.0f, 1.0f,
+	0.7f, 14.0f, 1.0f, 0.8f, 13.0f, 1.0f, 0.7f, 13.0f,
+	1.0f, 0.6f, 14.0f, 1.0f, 0.6f, 14.0f, 1.0f, 0.7f,
+	13.0f, 1.0f, 0.6f, 13.0f, 1.0f, 0.5f, 14.0f, 1.0f,
+	0.5f, 14.0f, 1.0f, 0.6f, 13.0f, 1.0f, 0.5f, 13.0f,
+	1.0f, 0.39999998f, 14.0f, 1.0f, 0.39999998f, 14.0f, 1.0f, 0.5f,
+	13.0f, 1.0f, 0.39999998f, 13.0f, 1.0f, 0.3f, 14.0f, 1.0f,
+	0.3f, 14.0f, 1.0f, 0.39999998f, 13.0f, 1.0f, 0.3f, 13.0f,
+	1.0f, 0.19999999f, 14.0f, 1.0f, 0.19999999f, 14.0f, 1.0f, 0.3f,
+	13.0f, 1.0f, 0.19999999f, 13.0f, 1.0f, 0.099999964f, 14.0f, 1.0f,
+	0.099999964f, 14.0f, 1.0f, 0.19999999f, 13.0f, 1.0f, 0.099999964f, 13.0f,
+	1.0f, 0.0f, 14.0f, 1.0f, 0.0f, 14.0f, 1.0f, 0.099999964f,
+	14.0f, 1.0f, 1.0f, 14.0f, 1.0f, 0.9f, 15.0f, 1.0f,
+	0.9f, 15.0f, 1.0f, 1.0f, 14.0f, 1.0f, 0.9f, 14.0f,
+	1.0f, 0.8f, 15.0f, 1.0f, 0.8f, 15.0f, 1.0f, 0.9f,
+	14.0f, 1.0f, 0.8f, 14.0f, 1.0f, 0.7f, 15.0f, 1.0f,
+	0.7f, 15.0f, 1.0f, 0.8f, 14.0f, 1.0f, 0.7f, 14.0f,
+	1.0f, 0.6f, 15.0f, 1.0f, 0.6f, 15.0f, 1.0f, 0.7f,
+	14.0f, 1.0f, 0.6f, 14.0f, 1.0f, 0.5f, 15.0f, 1.0f,
+	0.5f, 15.0f, 1.0f, 0.6f, 14.0f, 1.0f, 0.5f, 14.0f,
+	1.0f, 0.39999998f, 15.0f, 1.0f, 0.39999998f, 15.0f, 1.0f, 0.5f,
+	14.0f, 1.0f, 0.39999998f, 14.0f, 1.0f, 0.3f, 15.0f, 1.0f,
+	0.3f, 15.0f, 1.0f, 0.39999998f, 14.0f, 1.0f, 0.3f, 14.0f,
+	1.0f, 0.19999999f, 15.0f, 1.0f, 0.19999999f, 15.0f, 1.0f, 0.3f,
+	14.0f, 1.0f, 0.19999999f, 14.0f, 1.0f, 0.099999964f, 15.0f, 1.0f,
+	0.099999964f, 15.0f, 1.0f, 0.19999999f, 14.0f, 1.0f, 0.099999964f, 14.0f,
+	1.0f, 0.0f, 15.0f, 1.0f, 0.0f, 15.0f, 1.0f, 0.099999964f,
+	15.0f, 1.0f, 1.0f, 15.0f, 1.0f, 0.9f, 16.0f, 1.0f,
+	0.9f, 16.0f, 1.0f, 1.0f, 15.0f, 1.0f, 0.9f, 15.0f,
+	1.0f, 0.8f, 16.0f, 1.0f, 0.8f, 16.0f, 1.0f, 0.9f,
+	15.0f, 1.0f, 0.8f, 15.0f, 1.0f, 0.7f, 16.0f, 1.0f,
+	0.7f, 16.0f, 1.0f, 0.8f, 15.0f, 1.0f, 0.7f, 15.0f,
+	1.0f, 0.6f, 16.0f, 1.0f, 0.6f, 16.0f, 1.0f, 0.7f,
+	15.0f, 1.0f, 0.6f, 15.0f, 1.0f, 0.5f, 16.0f, 1.0f,
+	0.5f, 16.0f, 1.0f, 0.6f, 15.0f, 1.0f, 0.5f, 15.0f,
+	1.0f, 0.39999998f, 16.0f, 1.0f, 0.39999998f, 16.0f, 1.0f, 0.5f,
+	15.0f, 1.0f, 0.39999998f, 15.0f, 1.0f, 0.3f, 16.0f, 1.0f,
+	0.3f, 16.0f, 1.0f, 0.39999998f, 15.0f, 1.0f, 0.3f, 15.0f,
+	1.0f, 0.19999999f, 16.0f, 1.0f, 0.19999999f, 16.0f, 1.0f, 0.3f,
+	15.0f, 1.0f, 0.19999999f, 15.0f, 1.0f, 0.099999964f, 16.0f, 1.0f,
+	0.099999964f, 16.0f, 1.0f, 0.19999999f, 15.0f, 1.0f, 0.099999964f, 15.0f,
+	1.0f, 0.0f, 16.0f, 1.0f, 0.0f, 16.0f, 1.0f, 0.099999964f,
+	16.0f, 1.0f, 1.0f, 16.0f, 1.0f, 0.9f, 17.0f, 1.0f,
+	0.9f, 17.0f, 1.0f, 1.0f, 16.0f, 1.0f, 0.9f, 16.0f,
+	1.0f, 0.8f, 17.0f, 1.0f, 0.8f, 17.0f, 1.0f, 0.9f,
+	16.0f, 1.0f, 0.8f, 16.0f, 1.0f, 0.7f, 17.0f, 1.0f,
+	0.7f, 17.0f, 1.0f, 0.8f, 16.0f, 1.0f, 0.7f, 16.0f,
+	1.0f, 0.6f, 17.0f, 1.0f, 0.6f, 17.0f, 1.0f, 0.7f,
+	16.0f, 1.0f, 0.6f, 16.0f, 1.0f, 0.5f, 17.0f, 1.0f,
+	0.5f, 17.0f, 1.0f, 0.6f, 16.0f, 1.0f, 0.5f, 16.0f,
+	1.0f, 0.39999998f, 17.0f, 1.0f, 0.39999998f, 17.0f, 1.0f, 0.5f,
+	16.0f, 1.0f, 0.39999998f, 16.0f, 1.0f, 0.3f, 17.0f, 1.0f,
+	0.3f, 17.0f, 1.0f, 0.39999998f, 16.0f, 1.0f, 0.3f, 16.0f,
+	1.0f, 0.19999999f, 17.0f, 1.0f, 0.19999999f, 17.0f, 1.0f, 0.3f,
+	16.0f, 1.0f, 0.19999999f, 16.0f, 1.0f, 0.099999964f, 17.0f, 1.0f,
+	0.099999964f, 17.0f, 1.0f, 0.19999999f, 16.0f, 1.0f, 0.099999964f, 16.0f,
+	1.0f, 0.0f, 17.0f, 1.0f, 0.0f, 17.0f, 1.0f, 0.099999964f,
+	17.0f, 1.0f, 1.0f, 17.0f, 1.0f, 0.9f, 18.0f, 1.0f,
+	0.9f, 18.0f, 1.0f, 1.0f, 17.0f, 1.0f, 0.9f, 17.0f,
+	1.0f, 0.8f, 18.0f, 1.0f, 0.8f, 18.0f, 1.0f, 0.9f,
+	17.0f, 1.0f, 0.8f, 17.0f, 1.0f, 0.7f, 18.0f, 1.0f,
+	0.7f, 18.0f, 1.0f, 0.8f, 17.0f, 1.0f, 0.7f, 17.0f,
+	1.0f, 0.6f, 18.0f, 1.0f, 0.6f, 18.0f, 1.0f, 0.7f,
+	17.0f, 1.0f, 0.6f, 17.0f, 1.0f, 0.5f, 18.0f, 1.0f,
+	0.5f, 18.0f, 1.0f, 0.6f, 17.0f, 1.0f, 0.5f, 17.0f,
+	1.0f, 0.39999998f, 18.0f, 1.0f, 0.39999998f, 18.0f, 1.0f, 0.5f,
+	17.0f, 1.0f, 0.39999998f, 17.0f, 1.0f, 0.3f, 18.0f, 1.0f,
+	0.3f, 18.0f, 1.0f, 0.39999998f, 17.0f, 1.0f, 0.3f, 17.0f,
+	1.0f, 0.19999999f, 18.0f, 1.0f, 0.19999999f, 18.0f, 1.0f, 0.3f,
+	17.0f, 1.0f, 0.19999999f, 17.0f, 1.0f, 0.099999964f, 18.0f, 1.0f,
+	0.099999964f, 18.0f, 1.0f, 0.19999999f, 17.0f, 1.0f, 0.099999964f, 17.0f,
+	1.0f, 0.0f, 18.0f, 1.0f, 0.0f, 18.0f, 1.0f, 0.099999964f,
+	18.0f, 1.0f, 1.0f, 18.0f, 1.0f, 0.9f, 19.0f, 1.0f,
+	0.9f, 19.0f, 1.0f, 1.0f, 18.0f, 1.0f, 0.9f, 18.0f,
+	1.0f, 0.8f, 19.0f, 1.0f, 0.8f, 19.0f, 1.0f, 0.9f,
+	18.0f, 1.0f, 0.8f, 18.0f, 1.0f, 0.7f, 19.0f, 1.0f,
+	0.7f, 19.0f, 1.0f, 0.8f, 18.0f, 1.0f, 0.7f, 18.0f,
+	1.0f, 0.6f, 19.0f, 1.0f, 0.6f, 19.0f, 1.0f, 0.7f,
+	18.0f, 1.0f, 0.6f, 18.0f, 1.0f, 0.5f, 19.0f, 1.0f,
+	0.5f, 19.0f, 1.0f, 0.6f, 18.0f, 1.0f, 0.5f, 18.0f,
+	1.0f, 0.39999998f, 19.0f, 1.0f, 0.39999998f, 19.0f, 1.0f, 0.5f,
+	18.0f, 1.0f, 0.39999998f, 18.0f, 1.0f, 0.3f, 19.0f, 1.0f,
+	0.3f, 19.0f, 1.0f, 0.39999998f, 18.0f, 1.0f, 0.3f, 18.0f,
+	1.0f, 0.19999999f, 19.0f, 1.0f, 0.19999999f, 19.0f, 1.0f, 0.3f,
+	18.0f, 1.0f, 0.19999999f, 18.0f, 1.0f, 0.099999964f, 19.0f, 1.0f,
+	0.099999964f, 19.0f, 1.0f, 0.19999999f, 18.0f, 1.0f, 0.099999964f, 18.0f,
+	1.0f, 0.0f, 19.0f, 1.0f, 0.0f, 19.0f, 1.0f, 0.099999964f,
+	19.0f, 1.0f, 1.0f, 19.0f, 1.0f, 0.9f, 20.0f, 1.0f,
+	0.9f, 20.0f, 1.0f, 1.0f, 19.0f, 1.0f, 0.9f, 19.0f,
+	1.0f, 0.8f, 20.0f, 1.0f, 0.8f, 20.0f, 1.0f, 0.9f,
+	19.0f, 1.0f, 0.8f, 19.0f, 1.0f, 0.7f, 20.0f, 1.0f,
+	0.7f, 20.0f, 1.0f, 0.8f, 19.0f, 1.0f, 0.7f, 19.0f,
+	1.0f, 0.6f, 20.0f, 1.0f, 0.6f, 20.0f, 1.0f, 0.7f,
+	19.0f, 1.0f, 0.6f, 19.0f, 1.0f, 0.5f, 20.0f, 1.0f,
+	0.5f, 20.0f, 1.0f, 0.6f, 19.0f, 1.0f, 0.5f, 19.0f,
+	1.0f, 0.39999998f, 20.0f, 1.0f, 0.39999998f, 20.0f, 1.0f, 0.5f,
+	19.0f, 1.0f, 0.39999998f, 19.0f, 1.0f, 0.3f, 20.0f, 1.0f,
+	0.3f, 20.0f, 1.0f, 0.39999998f, 19.0f, 1.0f, 0.3f, 19.0f,
+	1.0f, 0.19999999f, 20.0f, 1.0f, 0.19999999f, 20.0f, 1.0f, 0.3f,
+	19.0f, 1.0f, 0.19999999f, 19.0f, 1.0f, 0.099999964f, 20.0f, 1.0f,
+	0.099999964f, 20.0f, 1.0f, 0.19999999f, 19.0f, 1.0f, 0.099999964f, 19.0f,
+	1.0f, 0.0f, 20.0f, 1.0f, 0.0f, 20.0f, 1.0f, 0.099999964f
+};
+static const float cuboidNormals[9600] =
+{
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f,
+	-10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f,
+	0.0f, -10.0f, 0.0f, 0.0f, -10.0f, 0.0f, 0.0f, -10.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f,
+	0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 10.0f, 0.0f
+};
+static const float cuboidTexCoords[6400] =
+{
+	0.0f, 0.0f, 0.0f, 0.1f, 0.05f, 0.1f, 0.05f, 0.0f,
+	0.0f, 0.1f, 0.0f, 0.2f, 0.05f, 0.2f, 0.05f, 0.1f,
+	0.0f, 0.2f, 0.0f, 0.3f, 0.05f, 0.3f, 0.05f, 0.2f,
+	0.0f, 0.3f, 0.0f, 0.4f, 0.05f, 0.4f, 0.05f, 0.3f,
+	0.0f, 0.4f, 0.0f, 0.5f, 0.05f, 0.5f, 0.05f, 0.4f,
+	0.0f, 0.5f, 0.0f, 0.6f, 0.05f, 0.6f, 0.05f, 0.5f,
+	0.0f, 0.6f, 0.0f, 0.7f, 0.05f, 0.7f, 0.05f, 0.6f,
+	0.0f, 0.7f, 0.0f, 0.8f, 0.05f, 0.8f, 0.05f, 0.7f,
+	0.0f, 0.8f, 0.0f, 0.90000004f, 0.05f, 0.90000004f, 0.05f, 0.8f,
+	0.0f, 0.90000004f, 0.0f, 1.0f, 0.05f, 1.0f, 0.05f, 0.90000004f,
+	0.05f, 0.0f, 0.05f, 0.1f, 0.1f, 0.1f, 0.1f, 0.0f,
+	0.05f, 0.1f, 0.05f, 0.2f, 0.1f, 0.2f, 0.1f, 0.1f,
+	0.05f, 0.2f, 0.05f, 0.3f, 0.1f, 0.3f, 0.1f, 0.2f,
+	0.05f, 0.3f, 0.05f, 0.4f, 0.1f, 0.4f, 0.1f, 0.3f,
+	0.05f, 0.4f, 0.05f, 0.5f, 0.1f, 0.5f, 0.1f, 0.4f,
+	0.05f, 0.5f, 0.05f, 0.6f, 0.1f, 0.6f, 0.1f, 0.5f,
+	0.05f, 0.6f, 0.05f, 0.7f, 0.1f, 0.7f, 0.1f, 0.6f,
+	0.05f, 0.7f, 0.05f, 0.8f, 0.1f, 0.8f, 0.1f, 0.7f,
+	0.05f, 0.8f, 0.05f, 0.90000004f, 0.1f, 0.90000004f, 0.1f, 0.8f,
+	0.05f, 0.90000004f, 0.05f, 1.0f, 0.1f, 1.0f, 0.1f, 0.90000004f,
+	0.1f, 0.0f, 0.1f, 0.1f, 0.15f, 0.1f, 0.15f, 0.0f,
+	0.1f, 0.1f, 0.1f, 0.2f, 0.15f, 0.2f, 0.15f, 0.1f,
+	0.1f, 0.2f, 0.1f, 0.3f, 0.15f, 0.3f, 0.15f, 0.2f,
+	0.1f, 0.3f, 0.1f, 0.4f, 0.15f, 0.4f, 0.15f, 0.3f,
+	0.1f, 0.4f, 0.1f, 0.5f, 0.15f, 0.5f, 0.15f, 0.4f,
+	0.1f, 0.5f, 0.1f, 0.6f, 0.15f, 0.6f, 0.15f, 0.5f,
+	0.1f, 0.6f, 0.1f, 0.7f, 0.15f, 0.7f, 0.15f, 0.6f,
+	0.1f, 0.7f, 0.1f, 0.8f, 0.15f, 0.8f, 0.15f, 0.7f,
+	0.1f, 0.8f, 0.1f, 0.90000004f, 0.15f, 0.90000004f, 0.15f, 0.8f,
+	0.1f, 0.90000004f, 0.1f, 1.0f, 0.15f, 1.0f, 0.15f, 0.90000004f,
+	0.15f, 0.0f, 0.15f, 0.1f, 0.2f, 0.1f, 0.2f, 0.0f,
+	0.15f, 0.1f, 0.15f, 0.2f, 0.2f, 0.2f, 0.2f, 0.1f,
+	0.15f, 0.2f, 0.15f, 0.3f, 0.2f, 0.3f, 0.2f, 0.2f,
+	0.15f, 0.3f, 0.15f, 0.4f, 0.2f, 0.4f, 0.2f, 0.3f,
+	0.15f, 0.4f, 0.15f, 0.5f, 0.2f, 0.5f, 0.2f, 0.4f,
+	0.15f, 0.5f, 0.15f, 0.6f, 0.2f, 0.6f, 0.2f, 0.5f,
+	0.15f, 0.6f, 0.15f, 0.7f, 0.2f, 0.7f, 0.2f, 0.6f,
+	0.15f, 0.7f, 0.15f, 0.8f, 0.2f, 0.8f, 0.2f, 0.7f,
+	0.15f, 0.8f, 0.15f, 0.90000004f, 0.2f, 0.90000004f, 0.2f, 0.8f,
+	0.15f, 0.90000004f, 0.15f, 1.0f, 0.2f, 1.0f, 0.2f, 0.90000004f,
+	0.2f, 0.0f, 0.2f, 0.1f, 0.25f, 0.1f, 0.25f, 0.0f,
+	0.2f, 0.1f, 0.2f, 0.2f, 0.25f, 0.2f, 0.25f, 0.1f,
+	0.2f, 0.2f, 0.2f, 0.3f, 0.25f, 0.3f, 0.25f, 0.2f,
+	0.2f, 0.3f, 0.2f, 0.4f, 0.25f, 0.4f, 0.25f, 0.3f,
+	0.2f, 0.4f, 0.2f, 0.5f, 0.25f, 0.5f, 0.25f, 0.4f,
+	0.2f, 0.5f, 0.2f, 0.6f, 0.25f, 0.6f, 0.25f, 0.5f,
+	0.2f, 0.6f, 0.2f, 0.7f, 0.25f, 0.7f, 0.25f, 0.6f,
+	0.2f, 0.7f, 0.2f, 0.8f, 0.25f, 0.8f, 0.25f, 0.7f,
+	0.2f, 0.8f, 0.2f, 0.90000004f, 0.25f, 0.90000004f, 0.25f, 0.8f,
+	0.2f, 0.90000004f, 0.2f, 1.0f, 0.25f, 1.0f, 0.25f, 0.90000004f,
+	0.25f, 0.0f, 0.25f, 0.1f, 0.3f, 0.1f, 0.3f, 0.0f,
+	0.25f, 0.1f, 0.25f, 0.2f, 0.3f, 0.2f, 0.3f, 0.1f,
+	0.25f, 0.2f, 0.25f, 0.3f, 0.3f, 0.3f, 0.3f, 0.2f,
+	0.25f, 0.3f, 0.25f, 0.4f, 0.3f, 0.4f, 0.3f, 0.3f,
+	0.25f, 0.4f, 0.25f, 0.5f, 0.3f, 0.5f, 0.3f, 0.4f,
+	0.25f, 0.5f, 0.25f, 0.6f, 0.3f, 0.6f, 0.3f, 0.5f,
+	0.25f, 0.6f, 0.25f, 0.7f, 0.3f, 0.7f, 0.3f, 0.6f,
+	0.25f, 0.7f, 0.25f, 0.8f, 0.3f, 0.8f, 0.3f, 0.7f,
+	0.25f, 0.8f, 0.25f, 0.90000004f, 0.3f, 0.90000004f, 0.3f, 0.8f,
+	0.25f, 0.90000004f, 0.25f, 1.0f, 0.3f, 1.0f, 0.3f, 0.90000004f,
+	0.3f, 0.0f, 0.3f, 0.1f, 0.35f, 0.1f, 0.35f, 0.0f,
+	0.3f, 0.1f, 0.3f, 0.2f, 0.35f, 0.2f, 0.35f, 0.1f,
+	0.3f, 0.2f, 0.3f, 0.3f, 0.35f, 0.3f, 0.35f, 0.2f,
+	0.3f, 0.3f, 0.3f, 0.4f, 0.35f, 0.4f, 0.35f, 0.3f,
+	0.3f, 0.4f, 0.3f, 0.5f, 0.35f, 0.5f, 0.35f, 0.4f,
+	0.3f, 0.5f, 0.3f, 0.6f, 0.35f, 0.6f, 0.35f, 0.5f,
+	0.3f, 0.6f, 0.3f, 0.7f, 0.35f, 0.7f, 0.35f, 0.6f,
+	0.3f, 0.7f, 0.3f, 0.8f, 0.35f, 0.8f, 0.35f, 0.7f,
+	0.3f, 0.8f, 0.3f, 0.90000004f, 0.35f, 0.90000004f, 0.35f, 0.8f,
+	0.3f, 0.90000004f, 0.3f, 1.0f, 0.35f, 1.0f, 0.35f, 0.90000004f,
+	0.35f, 0.0f, 0.35f, 0.1f, 0.4f, 0.1f, 0.4f, 0.0f,
+	0.35f, 0.1f, 0.35f, 0.2f, 0.4f, 0.2f, 0.4f, 0.1f,
+	0.35f, 0.2f, 0.35f, 0.3f, 0.4f, 0.3f, 0.4f, 0.2f,
+	0.35f, 0.3f, 0.35f, 0.4f, 0.4f, 0.4f, 0.4f, 0.3f,
+	0.35f, 0.4f, 0.35f, 0.5f, 0.4f, 0.5f, 0.4f, 0.4f,
+	0.35f, 0.5f, 0.35f, 0.6f, 0.4f, 0.6f, 0.4f, 0.5f,
+	0.35f, 0.6f, 0.35f, 0.7f, 0.4f, 0.7f, 0.4f, 0.6f,
+	0.35f, 0.7f, 0.35f, 0.8f, 0.4f, 0.8f, 0.4f, 0.7f,
+	0.35f, 0.8f, 0.35f, 0.90000004f, 0.4f, 0.90000004f, 0.4f, 0.8f,
+	0.35f, 0.90000004f, 0.35f, 1.0f, 0.4f, 1.0f, 0.4f, 0.90000004f,
+	0.4f, 0.0f, 0.4f, 0.1f, 0.45000002f, 0.1f, 0.45000002f, 0.0f,
+	0.4f, 0.1f, 0.4f, 0.2f, 0.45000002f, 0.2f, 0.45000002f, 0.1f,
+	0.4f, 0.2f, 0.4f, 0.3f, 0.45000002f, 0.3f, 0.45000002f, 0.2f,
+	0.4f, 0.3f, 0.4f, 0.4f, 0.45000002f, 0.4f, 0.45000002f, 0.3f,
+	0.4f, 0.4f, 0.4f, 0.5f, 0.45000002f, 0.5f, 0.45000002f, 0.4f,
+	0.4f, 0.5f, 0.4f, 0.6f, 0.45000002f, 0.6f, 0.45000002f, 0.5f,
+	0.4f, 0.6f, 0.4f, 0.7f, 0.45000002f, 0.7f, 0.45000002f, 0.6f,
+	0.4f, 0.7f, 0.4f, 0.8f, 0.45000002f, 0.8f, 0.45000002f, 0.7f,
+	0.4f, 0.8f, 0.4f, 0.90000004f, 0.45000002f, 0.90000004f, 0.45000002f, 0.8f,
+	0.4f, 0.90000004f, 0.4f, 1.0f, 0.45000002f, 1.0f, 0.45000002f, 0.90000004f,
+	0.45000002f, 0.0f, 0.45000002f, 0.1f, 0.5f, 0.1f, 0.5f, 0.0f,
+	0.45000002f, 0.1f, 0.45000002f, 0.2f, 0.5f, 0.2f, 0.5f, 0.1f,
+	0.45000002f, 0.2f, 0.45000002f, 0.3f, 0.5f, 0.3f, 0.5f, 0.2f,
+	0.45000002f, 0.3f, 0.45000002f, 0.4f, 0.5f, 0.4f, 0.5f, 0.3f,
+	0.45000002f, 0.4f, 0.45000002f, 0.5f, 0.5f, 0.5f, 0.5f, 0.4f,
+	0.45000002f, 0.5f, 0.45000002f, 0.6f, 0.5f, 0.6f, 0.5f, 0.5f,
+	0.45000002f, 0.6f, 0.45000002f, 0.7f, 0.5f, 0.7f, 0.5f, 0.6f,
+	0.45000002f, 0.7f, 0.45000002f, 0.8f, 0.5f, 0.8f, 0.5f, 0.7f,
+	0.45000002f, 0.8f, 0.45000002f, 0.90000004f, 0.5f, 0.90000004f, 0.5f, 0.8f,
+	0.45000002f, 0.90000004f, 0.45000002f, 1.0f, 0.5f, 1.0f, 0.5f, 0.90000004f,
+	0.5f, 0.0f, 0.5f, 0.1f, 0.55f, 0.1f, 0.55f, 0.0f,
+	0.5f, 0.1f, 0.5f, 0.2f, 0.55f, 0.2f, 0.55f, 0.1f,
+	0.5f, 0.2f, 0.5f, 0.3f, 0.55f, 0.3f, 0.55f, 0.2f,
+	0.5f, 0.3f, 0.5f, 0.4f, 0.55f, 0.4f, 0.55f, 0.3f,
+	0.5f, 0.4f, 0.5f, 0.5f, 0.55f, 0.5f, 0.55f, 0.4f,
+	0.5f, 0.5f, 0.5f, 0.6f, 0.55f, 0.6f, 0.55f, 0.5f,
+	0.5f, 0.6f, 0.5f, 0.7f, 0.55f, 0.7f, 0.55f, 0.6f,
+	0.5f, 0.7f, 0.5f, 0.8f, 0.55f, 0.8f, 0.55f, 0.7f,
+	0.5f, 0.8f, 0.5f, 0.90000004f, 0.55f, 0.90000004f, 0.55f, 0.8f,
+	0.5f, 0.90000004f, 0.5f, 1.0f, 0.55f, 1.0f, 0.55f, 0.90000004f,
+	0.55f, 0.0f, 0.55f, 0.1f, 0.6f, 0.1f, 0.6f, 0.0f,
+	0.55f, 0.1f, 0.55f, 0.2f, 0.6f, 0.2f, 0.6f, 0.1f,
+	0.55f, 0.2f, 0.55f, 0.3f, 0.6f, 0.3f, 0.6f, 0.2f,
+	0.55f, 0.3f, 0.55f, 0.4f, 0.6f, 0.4f, 0.6f, 0.3f,
+	0.55f, 0.4f, 0.55f, 0.5f, 0.6f, 0.5f, 0.6f, 0.4f,
+	0.55f, 0.5f, 0.55f, 0.6f, 0.6f, 0.6f, 0.6f, 0.5f,
+	0.55f, 0.6f, 0.55f, 0.7f, 0.6f, 0.7f, 0.6f, 0.6f,
+	0.55f, 0.7f, 0.55f, 0.8f, 0.6f, 0.8f, 0.6f, 0.7f,
+	0.55f, 0.8f, 0.55f, 0.90000004f, 0.6f, 0.90000004f, 0.6f, 0.8f,
+	0.55f, 0.90000004f, 0.55f, 1.0f, 0.6f, 1.0f, 0.6f, 0.90000004f,
+	0.6f, 0.0f, 0.6f, 0.1f, 0.65000004f, 0.1f, 0.65000004f, 0.0f,
+	0.6f, 0.1f, 0.6f, 0.2f, 0.65000004f, 0.2f, 0.65000004f, 0.1f,
+	0.6f, 0.2f, 0.6f, 0.3f, 0.65000004f, 0.3f, 0.65000004f, 0.2f,
+	0.6f, 0.3f, 0.6f, 0.4f, 0.65000004f, 0.4f, 0.65000004f, 0.3f,
+	0.6f, 0.4f, 0.6f, 0.5f, 0.65000004f, 0.5f, 0.65000004f, 0.4f,
+	0.6f, 0.5f, 0.6f, 0.6f, 0.65000004f, 0.6f, 0.65000004f, 0.5f,
+	0.6f, 0.6f, 0.6f, 0.7f, 0.65000004f, 0.7f, 0.65000004f, 0.6f,
+	0.6f, 0.7f, 0.6f, 0.8f, 0.65000004f, 0.8f, 0.65000004f, 0.7f,
+	0.6f, 0.8f, 0.6f, 0.90000004f, 0.65000004f, 0.90000004f, 0.65000004f, 0.8f,
+	0.6f, 0.90000004f, 0.6f, 1.0f, 0.65000004f, 1.0f, 0.65000004f, 0.90000004f,
+	0.65000004f, 0.0f, 0.65000004f, 0.1f, 0.7f, 0.1f, 0.7f, 0.0f,
+	0.65000004f, 0.1f, 0.65000004f, 0.2f, 0.7f, 0.2f, 0.7f, 0.1f,
+	0.65000004f, 0.2f, 0.65000004f, 0.3f, 0.7f, 0.3f, 0.7f, 0.2f,
+	0.65000004f, 0.3f, 0.65000004f, 0.4f, 0.7f, 0.4f, 0.7f, 0.3f,
+	0.65000004f, 0.4f, 0.65000004f, 0.5f, 0.7f, 0.5f, 0.7f, 0.4f,
+	0.65000004f, 0.5f, 0.65000004f, 0.6f, 0.7f, 0.6f, 0.7f, 0.5f,
+	0.65000004f, 0.6f, 0.65000004f, 0.7f, 0.7f, 0.7f, 0.7f, 0.6f,
+	0.65000004f, 0.7f, 0.65000004f, 0.8f, 0.7f, 0.8f, 0.7f, 0.7f,
+	0.65000004f, 0.8f, 0.65000004f, 0.90000004f, 0.7f, 0.90000004f, 0.7f, 0.8f,
+	0.65000004f, 0.90000004f, 0.65000004f, 1.0f, 0.7f, 1.0f, 0.7f, 0.90000004f,
+	0.7f, 0.0f, 0.7f, 0.1f, 0.75f, 0.1f, 0.75f, 0.0f,
+	0.7f, 0.1f, 0.7f, 0.2f, 0.75f, 0.2f, 0.75f, 0.1f,
+	0.7f, 0.2f, 0.7f, 0.3f, 0.75f, 0.3f, 0.75f, 0.2f,
+	0.7f, 0.3f, 0.7f, 0.4f, 0.75f, 0.4f, 0.75f, 0.3f,
+	0.7f, 0.4f, 0.7f, 0.5f, 0.75f, 0.5f, 0.75f, 0.4f,
+	0.7f, 0.5f, 0.7f, 0.6f, 0.75f, 0.6f, 0.75f, 0.5f,
+	0.7f, 0.6f, 0.7f, 0.7f, 0.75f, 0.7f, 0.75f, 0.6f,
+	0.7f, 0.7f, 0.7f, 0.8f, 0.75f, 0.8f, 0.75f, 0.7f,
+	0.7f, 0.8f, 0.7f, 0.90000004f, 0.75f, 0.90000004f, 0.75f, 0.8f,
+	0.7f, 0.90000004f, 0.7f, 1.0f, 0.75f, 1.0f, 0.75f, 0.90000004f,
+	0.75f, 0.0f, 0.75f, 0.1f, 0.8f, 0.1f, 0.8f, 0.0f,
+	0.75f, 0.1f, 0.75f, 0.2f, 0.8f, 0.2f, 0.8f, 0.1f,
+	0.75f, 0.2f, 0.75f, 0.3f, 0.8f, 0.3f, 0.8f, 0.2f,
+	0.75f, 0.3f, 0.75f, 0.4f, 0.8f, 0.4f, 0.8f, 0.3f,
+	0.75f, 0.4f, 0.75f, 0.5f, 0.8f, 0.5f, 0.8f, 0.4f,
+	0.75f, 0.5f, 0.75f, 0.6f, 0.8f, 0.6f, 0.8f, 0.5f,
+	0.75f, 0.6f, 0.75f, 0.7f, 0.8f, 0.7f, 0.8f, 0.6f,
+	0.75f, 0.7f, 0.75f, 0.8f, 0.8f, 0.8f, 0.8f, 0.7f,
+	0.75f, 0.8f, 0.75f, 0.90000004f, 0.8f, 0.90000004f, 0.8f, 0.8f,
+	0.75f, 0.90000004f, 0.75f, 1.0f, 0.8f, 1.0f, 0.8f, 0.90000004f,
+	0.8f, 0.0f, 0.8f, 0.1f, 0.85f, 0.1f, 0.85f, 0.0f,
+	0.8f, 0.1f, 0.8f, 0.2f, 0.85f, 0.2f, 0.85f, 0.1f,
+	0.8f, 0.2f, 0.8f, 0.3f, 0.85f, 0.3f, 0.85f, 0.2f,
+	0.8f, 0.3f, 0.8f, 0.4f, 0.85f, 0.4f, 0.85f, 0.3f,
+	0.8f, 0.4f, 0.8f, 0.5f, 0.85f, 0.5f, 0.85f, 0.4f,
+	0.8f, 0.5f, 0.8f, 0.6f, 0.85f, 0.6f, 0.85f, 0.5f,
+	0.8f, 0.6f, 0.8f, 0.7f, 0.85f, 0.7f, 0.85f, 0.6f,
+	0.8f, 0.7f, 0.8f, 0.8f, 0.85f, 0.8f, 0.85f, 0.7f,
+	0.8f, 0.8f, 0.8f, 0.90000004f, 0.85f, 0.90000004f, 0.85f, 0.8f,
+	0.8f, 0.90000004f, 0.8f, 1.0f, 0.85f, 1.0f, 0.85f, 0.90000004f,
+	0.85f, 0.0f, 0.85f, 0.1f, 0.90000004f, 0.1f, 0.90000004f, 0.0f,
+	0.85f, 0.1f, 0.85f, 0.2f, 0.90000004f, 0.2f, 0.90000004f, 0.1f,
+	0.85f, 0.2f, 0.85f, 0.3f, 0.90000004f, 0.3f, 0.90000004f, 0.2f,
+	0.85f, 0.3f, 0.85f, 0.4f, 0.90000004f, 0.4f, 0.90000004f, 0.3f,
+	0.85f, 0.4f, 0.85f, 0.5f, 0.90000004f, 0.5f, 0.90000004f, 0.4f,
+	0.85f, 0.5f, 0.85f, 0.6f, 0.90000004f, 0.6f, 0.90000004f, 0.5f,
+	0.85f, 0.6f, 0.85f, 0.7f, 0.90000004f, 0.7f, 0.90000004f, 0.6f,
+	0.85f, 0.7f, 0.85f, 0.8f, 0.90000004f, 0.8f, 0.90000004f, 0.7f,
+	0.85f, 0.8f, 0.85f, 0.90000004f, 0.90000004f, 0.90000004f, 0.90000004f, 0.8f,
+	0.85f, 0.90000004f, 0.85f, 1.0f, 0.90000004f, 1.0f, 0.90000004f, 0.90000004f,
+	0.90000004f, 0.0f, 0.90000004f, 0.1f, 0.95f, 0.1f, 0.95f, 0.0f,
+	0.90000004f, 0.1f, 0.90000004f, 0.2f, 0.95f, 0.2f, 0.95f, 0.1f,
+	0.90000004f, 0.2f, 0.90000004f, 0.3f, 0.95f, 0.3f, 0.95f, 0.2f,
+	0.90000004f, 0.3f, 0.90000004f, 0.4f, 0.95f, 0.4f, 0.95f, 0.3f,
+	0.90000004f, 0.4f, 0.90000004f, 0.5f, 0.95f, 0.5f, 0.95f, 0.4f,
+	0.90000004f, 0.5f, 0.90000004f, 0.6f, 0.95f, 0.6f, 0.95f, 0.5f,
+	0.90000004f, 0.6f, 0.90000004f, 0.7f, 0.95f, 0.7f, 0.95f, 0.6f,
+	0.90000004f, 0.7f, 0.90000004f, 0.8f, 0.95f, 0.8f, 0.95f, 0.7f,
+	0.90000004f, 0.8f, 0.90000004f, 0.90000004f, 0.95f, 0.90000004f, 0.95f, 0.8f,
+	0.90000004f, 0.90000004f, 0.90000004f, 1.0f, 0.95f, 1.0f, 0.95f, 0.90000004f,
+	0.95f, 0.0f, 0.95f, 0.1f, 1.0f, 0.1f, 1.0f, 0.0f,
+	0.95f, 0.1f, 0.95f, 0.2f, 1.0f, 0.2f, 1.0f, 0.1f,
+	0.95f, 0.2f, 0.95f, 0.3f, 1.0f, 0.3f, 1.0f, 0.2f,
+	0.95f, 0.3f, 0.95f, 0.4f, 1.0f, 0.4f, 1.0f, 0.3f,
+	0.95f, 0.4f, 0.95f, 0.5f, 1.0f, 0.5f, 1.0f, 0.4f,
+	0.95f, 0.5f, 0.95f, 0.6f, 1.0f, 0.6f, 1.0f, 0.5f,
+	0.95f, 0.6f, 0.95f, 0.7f, 1.0f, 0.7f, 1.0f, 0.6f,
+	0.95f, 0.7f, 0.95f, 0.8f, 1.0f, 0.8f, 1.0f, 0.7f,
+	0.95f, 0.8f, 0.95f, 0.90000004f, 1.0f, 0.90000004f, 1.0f, 0.8f,
+	0.95f, 0.90000004f, 0.95f, 1.0f, 1.0f, 1.0f, 1.0f, 0.90000004f,
+	0.0f, 0.0f, 0.0f, 0.1f, 0.05f, 0.1f, 0.05f, 0.0f,
+	0.0f, 0.1f, 0.0f, 0.2f, 0.05f, 0.2f, 0.05f, 0.1f,
+	0.0f, 0.2f, 0.0f, 0.3f, 0.05f, 0.3f, 0.05f, 0.2f,
+	0.0f, 0.3f, 0.0f, 0.4f, 0.05f, 0.4f, 0.05f, 0.3f,
+	0.0f, 0.4f, 0.0f, 0.5f, 0.05f, 0.5f, 0.05f, 0.4f,
+	0.0f, 0.5f, 0.0f, 0.6f, 0.05f, 0.6f, 0.05f, 0.5f,
+	0.0f, 0.6f, 0.0f, 0.7f, 0.05f, 0.7f, 0.05f, 0.6f,
+	0.0f, 0.7f, 0.0f, 0.8f, 0.05f, 0.8f, 0.05f, 0.7f,
+	0.0f, 0.8f, 0.0f, 0.90000004f, 0.05f, 0.90000004f, 0.05f, 0.8f,
+	0.0f, 0.90000004f, 0.0f, 1.0f, 0.05f, 1.0f, 0.05f, 0.90000004f,
+	0.05f, 0.0f, 0.05f, 0.1f, 0.1f, 0.1f, 0.1f, 0.0f,
+	0.05f, 0.1f, 0.05f, 0.2f, 0.1f, 0.2f, 0.1f, 0.1f,
+	0.05f, 0.2f, 0.05f, 0.3f, 0.1f, 0.3f, 0.1f, 0.2f,
+	0.05f, 0.3f, 0.05f, 0.4f, 0.1f, 0.4f, 0.1f, 0.3f,
+	0.05f, 0.4f, 0.05f, 0.5f, 0.1f, 0.5f, 0.1f, 0.4f,
+	0.05f, 0.5f, 0.05f, 0.6f, 0.1f, 0.6f, 0.1f, 0.5f,
+	0.05f, 0.6f, 0.05f, 0.7f, 0.1f, 0.7f, 0.1f, 0.6f,
+	0.05f, 0.7f, 0.05f, 0.8f, 0.1f, 0.8f, 0.1f, 0.7f,
+	0.05f, 0.8f, 0.05f, 0.90000004f, 0.1f, 0.90000004f, 0.1f, 0.8f,
+	0.05f, 0.90000004f, 0.05f, 1.0f, 0.1f, 1.0f, 0.1f, 0.90000004f,
+	0.1f, 0.0f, 0.1f, 0.1f, 0.15f, 0.1f, 0.15f, 0.0f,
+	0.1f, 0.1f, 0.1f, 0.2f, 0.15f, 0.2f, 0.15f, 0.1f,
+	0.1f, 0.2f, 0.1f, 0.3f, 0.15f, 0.3f, 0.15f, 0.2f,
+	0.1f, 0.3f, 0.1f, 0.4f, 0.15f, 0.4f, 0.15f, 0.3f,
+	0.1f, 0.4f, 0.1f, 0.5f, 0.15f, 0.5f, 0.15f, 0.4f,
+	0.1f, 0.5f, 0.1f, 0.6f, 0.15f, 0.6f, 0.15f, 0.5f,
+	0.1f, 0.6f, 0.1f, 0.7f, 0.15f, 0.7f, 0.15f, 0.6f,
+	0.1f, 0.7f, 0.1f, 0.8f, 0.15f, 0.8f, 0.15f, 0.7f,
+	0.1f, 0.8f, 0.1f, 0.90000004f, 0.15f, 0.90000004f, 0.15f, 0.8f,
+	0.1f, 0.90000004f, 0.1f, 1.0f, 0.15f, 1.0f, 0.15f, 0.90000004f,
+	0.15f, 0.0f, 0.15f, 0.1f, 0.2f, 0.1f, 0.2f, 0.0f,
+	0.15f, 0.1f, 0.15f, 0.2f, 0.2f, 0.2f, 0.2f, 0.1f,
+	0.15f, 0.2f, 0.15f, 0.3f, 0.2f, 0.3f, 0.2f, 0.2f,
+	0.15f, 0.3f, 0.15f, 0.4f, 0.2f, 0.4f, 0.2f, 0.3f,
+	0.15f, 0.4f, 0.15f, 0.5f, 0.2f, 0.5f, 0.2f, 0.4f,
+	0.15f, 0.5f, 0.15f, 0.6f, 0.2f, 0.6f, 0.2f, 0.5f,
+	0.15f, 0.6f, 0.15f, 0.7f, 0.2f, 0.7f, 0.2f, 0.6f,
+	0.15f, 0.7f, 0.15f, 0.8f, 0.2f, 0.8f, 0.2f, 0.7f,
+	0.15f, 0.8f, 0.15f, 0.90000004f, 0.2f, 0.90000004f, 0.2f, 0.8f,
+	0.15f, 0.90000004f, 0.15f, 1.0f, 0.2f, 1.0f, 0.2f, 0.90000004f,
+	0.2f, 0.0f, 0.2f, 0.1f, 0.25f, 0.1f, 0.25f, 0.0f,
+	0.2f, 0.1f, 0.2f, 0.2f, 0.25f, 0.2f, 0.25f, 0.1f,
+	0.2f, 0.2f, 0.2f, 0.3f, 0.25f, 0.3f, 0.25f, 0.2f,
+	0.2f, 0.3f, 0.2f, 0.4f, 0.25f, 0.4f, 0.25f, 0.3f,
+	0.2f, 0.4f, 0.2f, 0.5f, 0.25f, 0.5f, 0.25f, 0.4f,
+	0.2f, 0.5f, 0.2f, 0.6f, 0.25f, 0.6f, 0.25f, 0.5f,
+	0.2f, 0.6f, 0.2f, 0.7f, 0.25f, 0.7f, 0.25f, 0.6f,
+	0.2f, 0.7f, 0.2f, 0.8f, 0.25f, 0.8f, 0.25f, 0.7f,
+	0.2f, 0.8f, 0.2f, 0.90000004f, 0.25f, 0.90000004f, 0.25f, 0.8f,
+	0.2f, 0.90000004f, 0.2f, 1.0f, 0.25f, 1.0f, 0.25f, 0.90000004f,
+	0.25f, 0.0f, 0.25f, 0.1f, 0.3f, 0.1f, 0.3f, 0.0f,
+	0.25f, 0.1f, 0.25f, 0.2f, 0.3f, 0.2f, 0.3f, 0.1f,
+	0.25f, 0.2f, 0.25f, 0.3f, 0.3f, 0.3f, 0.3f, 0.2f,
+	0.25f, 0.3f, 0.25f, 0.4f, 0.3f, 0.4f, 0.3f, 0.3f,
+	0.25f, 0.4f, 0.25f, 0.5f, 0.3f, 0.5f, 0.3f, 0.4f,
+	0.25f, 0.5f, 0.25f, 0.6f, 0.3f, 0.6f, 0.3f, 0.5f,
+	0.25f, 0.6f, 0.25f, 0.7f, 0.3f, 0.7f, 0.3f, 0.6f,
+	0.25f, 0.7f, 0.25f, 0.8f, 0.3f, 0.8f, 0.3f, 0.7f,
+	0.25f, 0.8f, 0.25f, 0.90000004f, 0.3f, 0.90000004f, 0.3f, 0.8f,
+	0.25f, 0.90000004f, 0.25f, 1.0f, 0.3f, 1.0f, 0.3f, 0.90000004f,
+	0.3f, 0.0f, 0.3f, 0.1f, 0.35f, 0.1f, 0.35f, 0.0f,
+	0.3f, 0.1f, 0.3f, 0.2f, 0.35f, 0.2f, 0.35f, 0.1f,
+	0.3f, 0.2f, 0.3f, 0.3f, 0.35f, 0.3f, 0.35f, 0.2f,
+	0.3f, 0.3f, 0.3f, 0.4f, 0.35f, 0.4f, 0.35f, 0.3f,
+	0.3f, 0.4f, 0.3f, 0.5f, 0.35f, 0.5f, 0.35f, 0.4f,
+	0.3f, 0.5f, 0.3f, 0.6f, 0.35f, 0.6f, 0.35f, 0.5f,
+	0.3f, 0.6f, 0.3f, 0.7f, 0.35f, 0.7f, 0.35f, 0.6f,
+	0.3f, 0.7f, 0.3f, 0.8f, 0.35f, 0.8f, 0.35f, 0.7f,
+	0.3f, 0.8f, 0.3f, 0.90000004f, 0.35f, 0.90000004f, 0.35f, 0.8f,
+	0.3f, 0.90000004f, 0.3f, 1.0f, 0.35f, 1.0f, 0.35f, 0.90000004f,
+	0.35f, 0.0f, 0.35f, 0.1f, 0.4f, 0.1f, 0.4f, 0.0f,
+	0.35f, 0.1f, 0.35f, 0.2f, 0.4f, 0.2f, 0.4f, 0.1f,
+	0.35f, 0.2f, 0.35f, 0.3f, 0.4f, 0.3f, 0.4f, 0.2f,
+	0.35f, 0.3f, 0.35f, 0.4f, 0.4f, 0.4f, 0.4f, 0.3f,
+	0.35f, 0.4f, 0.35f, 0.5f, 0.4f, 0.5f, 0.4f, 0.4f,
+	0.35f, 0.5f, 0.35f, 0.6f, 0.4f, 0.6f, 0.4f, 0.5f,
+	0.35f, 0.6f, 0.35f, 0.7f, 0.4f, 0.7f, 0.4f, 0.6f,
+	0.35f, 0.7f, 0.35f, 0.8f, 0.4f, 0.8f, 0.4f, 0.7f,
+	0.35f, 0.8f, 0.35f, 0.90000004f, 0.4f, 0.90000004f, 0.4f, 0.8f,
+	0.35f, 0.90000004f, 0.35f, 1.0f, 0.4f, 1.0f, 0.4f, 0.90000004f,
+	0.4f, 0.0f, 0.4f, 0.1f, 0.45000002f, 0.1f, 0.45000002f, 0.0f,
+	0.4f, 0.1f, 0.4f, 0.2f, 0.45000002f, 0.2f, 0.45000002f, 0.1f,
+	0.4f, 0.2f, 0.4f, 0.3f, 0.45000002f, 0.3f, 0.45000002f, 0.2f,
+	0.4f, 0.3f, 0.4f, 0.4f, 0.45000002f, 0.4f, 0.45000002f, 0.3f,
+	0.4f, 0.4f, 0.4f, 0.5f, 0.45000002f, 0.5f, 0.45000002f, 0.4f,
+	0.4f, 0.5f, 0.4f, 0.6f, 0.45000002f, 0.6f, 0.45000002f, 0.5f,
+	0.4f, 0.6f, 0.4f, 0.7f, 0.45000002f, 0.7f, 0.45000002f, 0.6f,
+	0.4f, 0.7f, 0.4f, 0.8f, 0.45000002f, 0.8f, 0.45000002f, 0.7f,
+	0.4f, 0.8f, 0.4f, 0.90000004f, 0.45000002f, 0.90000004f, 0.45000002f, 0.8f,
+	0.4f, 0.90000004f, 0.4f, 1.0f, 0.45000002f, 1.0f, 0.45000002f, 0.90000004f,
+	0.45000002f, 0.0f, 0.45000002f, 0.1f, 0.5f, 0.1f, 0.5f, 0.0f,
+	0.45000002f, 0.1f, 0.45000002f, 0.2f, 0.5f, 0.2f, 0.5f, 0.1f,
+	0.45000002f, 0.2f, 0.45000002f, 0.3f, 0.5f, 0.3f, 0.5f, 0.2f,
+	0.45000002f, 0.3f, 0.45000002f, 0.4f, 0.5f, 0.4f, 0.5f, 0.3f,
+	0.45000002f, 0.4f, 0.45000002f, 0.5f, 0.5f, 0.5f, 0.5f, 0.4f,
+	0.45000002f, 0.5f, 0.45000002f, 0.6f, 0.5f, 0.6f, 0.5f, 0.5f,
+	0.45000002f, 0.6f, 0.45000002f, 0.7f, 0.5f, 0.7f, 0.5f, 0.6f,
+	0.45000002f, 0.7f, 0.45000002f, 0.8f, 0.5f, 0.8f, 0.5f, 0.7f,
+	0.45000002f, 0.8f, 0.45000002f, 0.90000004f, 0.5f, 0.90000004f, 0.5f, 0.8f,
+	0.45000002f, 0.90000004f, 0.45000002f, 1.0f, 0.5f, 1.0f, 0.5f, 0.90000004f,
+	0.5f, 0.0f, 0.5f, 0.1f, 0.55f, 0.1f, 0.55f, 0.0f,
+	0.5f, 0.1f, 0.5f, 0.2f, 0.55f, 0.2f, 0.55f, 0.1f,
+	0.5f, 0.2f, 0.5f, 0.3f, 0.55f, 0.3f, 0.55f, 0.2f,
+	0.5f, 0.3f, 0.5f, 0.4f, 0.55f, 0.4f, 0.55f, 0.3f,
+	0.5f, 0.4f, 0.5f, 0.5f, 0.55f, 0.5f, 0.55f, 0.4f,
+	0.5f, 0.5f, 0.5f, 0.6f, 0.55f, 0.6f, 0.55f, 0.5f,
+	0.5f, 0.6f, 0.5f, 0.7f, 0.55f, 0.7f, 0.55f, 0.6f,
+	0.5f, 0.7f, 0.5f, 0.8f, 0.55f, 0.8f, 0.55f, 0.7f,
+	0.5f, 0.8f, 0.5f, 0.90000004f, 0.55f, 0.90000004f, 0.55f, 0.8f,
+	0.5f, 0.90000004f, 0.5f, 1.0f, 0.55f, 1.0f, 0.55f, 0.90000004f,
+	0.55f, 0.0f, 0.55f, 0.1f, 0.6f, 0.1f, 0.6f, 0.0f,
+	0.55f, 0.1f, 0.55f, 0.2f, 0.6f, 0.2f, 0.6f, 0.1f,
+	0.55f, 0.2f, 0.55f, 0.3f, 0.6f, 0.3f, 0.6f, 0.2f,
+	0.55f, 0.3f, 0.55f, 0.4f, 0.6f, 0.4f, 0.6f, 0.3f,
+	0.55f, 0.4f, 0.55f, 0.5f, 0.6f, 0.5f, 0.6f, 0.4f,
+	0.55f, 0.5f, 0.55f, 0.6f, 0.6f, 0.6f, 0.6f, 0.5f,
+	0.55f, 0.6f, 0.55f, 0.7f, 0.6f, 0.7f, 0.6f, 0.6f,
+	0.55f, 0.7f, 0.55f, 0.8f, 0.6f, 0.8f, 0.6f, 0.7f,
+	0.55f, 0.8f, 0.55f, 0.90000004f, 0.6f, 0.90000004f, 0.6f, 0.8f,
+	0.55f, 0.90000004f, 0.55f, 1.0f, 0.6f, 1.0f, 0.6f, 0.90000004f,
+	0.6f, 0.0f, 0.6f, 0.1f, 0.65000004f, 0.1f, 0.65000004f, 0.0f,
+	0.6f, 0.1f, 0.6f, 0.2f, 0.65000004f, 0.2f, 0.65000004f, 0.1f,
+	0.6f, 0.2f, 0.6f, 0.3f, 0.65000004f, 0.3f, 0.65000004f, 0.2f,
+	0.6f, 0.3f, 0.6f, 0.4f, 0.65000004f, 0.4f, 0.65000004f, 0.3f,
+	0.6f, 0.4f, 0.6f, 0.5f, 0.65000004f, 0.5f, 0.65000004f, 0.4f,
+	0.6f, 0.5f, 0.6f, 0.6f, 0.65000004f, 0.6f, 0.65000004f, 0.5f,
+	0.6f, 0.6f, 0.6f, 0.7f, 0.65000004f, 0.7f, 0.65000004f, 0.6f,
+	0.6f, 0.7f, 0.6f, 0.8f, 0.65000004f, 0.8f, 0.65000004f, 0.7f,
+	0.6f, 0.8f, 0.6f, 0.90000004f, 0.65000004f, 0.90000004f, 0.65000004f, 0.8f,
+	0.6f, 0.90000004f, 0.6f, 1.0f, 0.65000004f, 1.0f, 0.65000004f, 0.90000004f,
+	0.65000004f, 0.0f, 0.65000004f, 0.1f, 0.7f, 0.1f, 0.7f, 0.0f,
+	0.65000004f, 0.1f, 0.65000004f, 0.2f, 0.7f, 0.2f, 0.7f, 0.1f,
+	0.65000004f, 0.2f, 0.65000004f, 0.3f, 0.7f, 0.3f, 0.7f, 0.2f,
+	0.65000004f, 0.3f, 0.65000004f, 0.4f, 0.7f, 0.4f, 0.7f, 0.3f,
+	0.65000004f, 0.4f, 0.65000004f, 0.5f, 0.7f, 0.5f, 0.7f, 0.4f,
+	0.65000004f, 0.5f, 0.65000004f, 0.6f, 0.7f, 0.6f, 0.7f, 0.5f,
+	0.65000004f, 0.6f, 0.65000004f, 0.7f, 0.7f, 0.7f, 0.7f, 0.6f,
+	0.65000004f, 0.7f, 0.65000004f, 0.8f, 0.7f, 0.8f, 0.7f, 0.7f,
+	0.65000004f, 0.8f, 0.65000004f, 0.90000004f, 0.7f, 0.90000004f, 0.7f, 0.8f,
+	0.65000004f, 0.90000004f, 0.65000004f, 1.0f, 0.7f, 1.0f, 0.7f, 0.90000004f,
+	0.7f, 0.0f, 0.7f, 0.1f, 0.75f, 0.1f, 0.75f, 0.0f,
+	0.7f, 0.1f, 0.7f, 0.2f, 0.75f, 0.2f, 0.75f, 0.1f,
+	0.7f, 0.2f, 0.7f, 0.3f, 0.75f, 0.3f, 0.75f, 0.2f,
+	0.7f, 0.3f, 0.7f, 0.4f, 0.75f, 0.4f, 0.75f, 0.3f,
+	0.7f, 0.4f, 0.7f, 0.5f, 0.75f, 0.5f, 0.75f, 0.4f,
+	0.7f, 0.5f, 0.7f, 0.6f, 0.75f, 0.6f, 0.75f, 0.5f,
+	0.7f, 0.6f, 0.7f, 0.7f, 0.75f, 0.7f, 0.75f, 0.6f,
+	0.7f, 0.7f, 0.7f, 0.8f, 0.75f, 0.8f, 0.75f, 0.7f,
+	0.7f, 0.8f, 0.7f, 0.90000004f, 0.75f, 0.90000004f, 0.75f, 0.8f,
+	0.7f, 0.90000004f, 0.7f, 1.0f, 0.75f, 1.0f, 0.75f, 0.90000004f,
+	0.75f, 0.0f, 0.75f, 0.1f, 0.8f, 0.1f, 0.8f, 0.0f,
+	0.75f, 0.1f, 0.75f, 0.2f, 0.8f, 0.2f, 0.8f, 0.1f,
+	0.75f, 0.2f, 0.75f, 0.3f, 0.8f, 0.3f, 0.8f, 0.2f,
+	0.75f, 0.3f, 0.75f, 0.4f, 0.8f, 0.4f, 0.8f, 0.3f,
+	0.75f, 0.4f, 0.75f, 0.5f, 0.8f, 0.5f, 0.8f, 0.4f,
+	0.75f, 0.5f, 0.75f, 0.6f, 0.8f, 0.6f, 0.8f, 0.5f,
+	0.75f, 0.6f, 0.75f, 0.7f, 0.8f, 0.7f, 0.8f, 0.6f,
+	0.75f, 0.7f, 0.75f, 0.8f, 0.8f, 0.8f, 0.8f, 0.7f,
+	0.75f, 0.8f, 0.75f, 0.90000004f, 0.8f, 0.90000004f, 0.8f, 0.8f,
+	0.75f, 0.90000004f, 0.75f, 1.0f, 0.8f, 1.0f, 0.8f, 0.90000004f,
+	0.8f, 0.0f, 0.8f, 0.1f, 0.85f, 0.1f, 0.85f, 0.0f,
+	0.8f, 0.1f, 0.8f, 0.2f, 0.85f, 0.2f, 0.85f, 0.1f,
+	0.8f, 0.2f, 0.8f, 0.3f, 0.85f, 0.3f, 0.85f, 0.2f,
+	0.8f, 0.3f, 0.8f, 0.4f, 0.85f, 0.4f, 0.85f, 0.3f,
+	0.8f, 0.4f, 0.8f, 0.5f, 0.85f, 0.5f, 0.85f, 0.4f,
+	0.8f, 0.5f, 0.8f, 0.6f, 0.85f, 0.6f, 0.85f, 0.5f,
+	0.8f, 0.6f, 0.8f, 0.7f, 0.85f, 0.7f, 0.85f, 0.6f,
+	0.8f, 0.7f, 0.8f, 0.8f, 0.85f, 0.8f, 0.85f, 0.7f,
+	0.8f, 0.8f, 0.8f, 0.90000004f, 0.85f, 0.90000004f, 0.85f, 0.8f,
+	0.8f, 0.90000004f, 0.8f, 1.0f, 0.85f, 1.0f, 0.85f, 0.90000004f,
+	0.85f, 0.0f, 0.85f, 0.1f, 0.90000004f, 0.1f, 0.90000004f, 0.0f,
+	0.85f, 0.1f, 0.85f, 0.2f, 0.90000004f, 0.2f, 0.90000004f, 0.1f,
+	0.85f, 0.2f, 0.85f, 0.3f, 0.90000004f, 0.3f, 0.90000004f, 0.2f,
+	0.85f, 0.3f, 0.85f, 0.4f, 0.90000004f, 0.4f, 0.90000004f, 0.3f,
+	0.85f, 0.4f, 0.85f, 0.5f, 0.90000004f, 0.5f, 0.90000004f, 0.4f,
+	0.85f, 0.5f, 0.85f, 0.6f, 0.90000004f, 0.6f, 0.90000004f, 0.5f,
+	0.85f, 0.6f, 0.85f, 0.7f, 0.90000004f, 0.7f, 0.90000004f, 0.6f,
+	0.85f, 0.7f, 0.85f, 0.8f, 0.90000004f, 0.8f, 0.90000004f, 0.7f,
+	0.85f, 0.8f, 0.85f, 0.90000004f, 0.90000004f, 0.90000004f, 0.90000004f, 0.8f,
+	0.85f, 0.90000004f, 0.85f, 1.0f, 0.90000004f, 1.0f, 0.90000004f, 0.90000004f,
+	0.90000004f, 0.0f, 0.90000004f, 0.1f, 0.95f, 0.1f, 0.95f, 0.0f,
+	0.90000004f, 0.1f, 0.90000004f, 0.2f, 0.95f, 0.2f, 0.95f, 0.1f,
+	0.90000004f, 0.2f, 0.90000004f, 0.3f, 0.95f, 0.3f, 0.95f, 0.2f,
+	0.90000004f, 0.3f, 0.90000004f, 0.4f, 0.95f, 0.4f, 0.95f, 0.3f,
+	0.90000004f, 0.4f, 0.90000004f, 0.5f, 0.95f, 0.5f, 0.95f, 0.4f,
+	0.90000004f, 0.5f, 0.90000004f, 0.6f, 0.95f, 0.6f, 0.95f, 0.5f,
+	0.90000004f, 0.6f, 0.90000004f, 0.7f, 0.95f, 0.7f, 0.95f, 0.6f,
+	0.90000004f, 0.7f, 0.90000004f, 0.8f, 0.95f, 0.8f, 0.95f, 0.7f,
+	0.90000004f, 0.8f, 0.90000004f, 0.90000004f, 0.95f, 0.90000004f, 0.95f, 0.8f,
+	0.90000004f, 0.90000004f, 0.90000004f, 1.0f, 0.95f, 1.0f, 0.95f, 0.90000004f,
+	0.95f, 0.0f, 0.95f, 0.1f, 1.0f, 0.1f, 1.0f, 0.0f,
+	0.95f, 0.1f, 0.95f, 0.2f, 1.0f, 0.2f, 1.0f, 0.1f,
+	0.95f, 0.2f, 0.95f, 0.3f, 1.0f, 0.3f, 1.0f, 0.2f,
+	0.95f, 0.3f, 0.95f, 0.4f, 1.0f, 0.4f, 1.0f, 0.3f,
+	0.95f, 0.4f, 0.95f, 0.5f, 1.0f, 0.5f, 1.0f, 0.4f,
+	0.95f, 0.5f, 0.95f, 0.6f, 1.0f, 0.6f, 1.0f, 0.5f,
+	0.95f, 0.6f, 0.95f, 0.7f, 1.0f, 0.7f, 1.0f, 0.6f,
+	0.95f, 0.7f, 0.95f, 0.8f, 1.0f, 0.8f, 1.0f, 0.7f,
+	0.95f, 0.8f, 0.95f, 0.90000004f, 1.0f, 0.90000004f, 1.0f, 0.8f,
+	0.95f, 0.90000004f, 0.95f, 1.0f, 1.0f, 1.0f, 1.0f, 0.90000004f,
+	0.0f, 0.0f, 0.0f, 0.1f, 0.05f, 0.1f, 0.05f, 0.0f,
+	0.0f, 0.1f, 0.0f, 0.2f, 0.05f, 0.2f, 0.05f, 0.1f,
+	0.0f, 0.2f, 0.0f, 0.3f, 0.05f, 0.3f, 0.05f, 0.2f,
+	0.0f, 0.3f, 0.0f, 0.4f, 0.05f, 0.4f, 0.05f, 0.3f,
+	0.0f, 0.4f, 0.0f, 0.5f, 0.05f, 0.5f, 0.05f, 0.4f,
+	0.0f, 0.5f, 0.0f, 0.6f, 0.05f, 0.6f, 0.05f, 0.5f,
+	0.0f, 0.6f, 0.0f, 0.7f, 0.05f, 0.7f, 0.05f, 0.6f,
+	0.0f, 0.7f, 0.0f, 0.8f, 0.05f, 0.8f, 0.05f, 0.7f,
+	0.0f, 0.8f, 0.0f, 0.90000004f, 0.05f, 0.90000004f, 0.05f, 0.8f,
+	0.0f, 0.90000004f, 0.0f, 1.0f, 0.05f, 1.0f, 0.05f, 0.90000004f,
+	0.05f, 0.0f, 0.05f, 0.1f, 0.1f, 0.1f, 0.1f, 0.0f,
+	0.05f, 0.1f, 0.05f, 0.2f, 0.1f, 0.2f, 0.1f, 0.1f,
+	0.05f, 0.2f, 0.05f, 0.3f, 0.1f, 0.3f, 0.1f, 0.2f,
+	0.05f, 0.3f, 0.05f, 0.4f, 0.1f, 0.4f, 0.1f, 0.3f,
+	0.05f, 0.4f, 0.05f, 0.5f, 0.1f, 0.5f, 0.1f, 0.4f,
+	0.05f, 0.5f, 0.05f, 0.6f, 0.1f, 0.6f, 0.1f, 0.5f,
+	0.05f, 0.6f, 0.05f, 0.7f, 0.1f, 0.7f, 0.1f, 0.6f,
+	0.05f, 0.7f, 0.05f, 0.8f, 0.1f, 0.8f, 0.1f, 0.7f,
+	0.05f, 0.8f, 0.05f, 0.90000004f, 0.1f, 0.90000004f, 0.1f, 0.8f,
+	0.05f, 0.90000004f, 0.05f, 1.0f, 0.1f, 1.0f, 0.1f, 0.90000004f,
+	0.1f, 0.0f, 0.1f, 0.1f, 0.15f, 0.1f, 0.15f, 0.0f,
+	0.1f, 0.1f, 0.1f, 0.2f, 0.15f, 0.2f, 0.15f, 0.1f,
+	0.1f, 0.2f, 0.1f, 0.3f, 0.15f, 0.3f, 0.15f, 0.2f,
+	0.1f, 0.3f, 0.1f, 0.4f, 0.15f, 0.4f, 0.15f, 0.3f,
+	0.1f, 0.4f, 0.1f, 0.5f, 0.15f, 0.5f, 0.15f, 0.4f,
+	0.1f, 0.5f, 0.1f, 0.6f, 0.15f, 0.6f, 0.15f, 0.5f,
+	0.1f, 0.6f, 0.1f, 0.7f, 0.15f, 0.7f, 0.15f, 0.6f,
+	0.1f, 0.7f, 0.1f, 0.8f, 0.15f, 0.8f, 0.15f, 0.7f,
+	0.1f, 0.8f, 0.1f, 0.90000004f, 0.15f, 0.90000004f, 0.15f, 0.8f,
+	0.1f, 0.90000004f, 0.1f, 1.0f, 0.15f, 1.0f, 0.15f, 0.90000004f,
+	0.15f, 0.0f, 0.15f, 0.1f, 0.2f, 0.1f, 0.2f, 0.0f,
+	0.15f, 0.1f, 0.15f, 0.2f, 0.2f, 0.2f, 0.2f, 0.1f,
+	0.15f, 0.2f, 0.15f, 0.3f, 0.2f, 0.3f, 0.2f, 0.2f,
+	0.15f, 0.3f, 0.15f, 0.4f, 0.2f, 0.4f, 0.2f, 0.3f,
+	0.15f, 0.4f, 0.15f, 0.5f, 0.2f, 0.5f, 0.2f, 0.4f,
+	0.15f, 0.5f, 0.15f, 0.6f, 0.2f, 0.6f, 0.2f, 0.5f,
+	0.15f, 0.6f, 0.15f, 0.7f, 0.2f, 0.7f, 0.2f, 0.6f,
+	0.15f, 0.7f, 0.15f, 0.8f, 0.2f, 0.8f, 0.2f, 0.7f,
+	0.15f, 0.8f, 0.15f, 0.90000004f, 0.2f, 0.90000004f, 0.2f, 0.8f,
+	0.15f, 0.90000004f, 0.15f, 1.0f, 0.2f, 1.0f, 0.2f, 0.90000004f,
+	0.2f, 0.0f, 0.2f, 0.1f, 0.25f, 0.1f, 0.25f, 0.0f,
+	0.2f, 0.1f, 0.2f, 0.2f, 0.25f, 0.2f, 0.25f, 0.1f,
+	0.2f, 0.2f, 0.2f, 0.3f, 0.25f, 0.3f, 0.25f, 0.2f,
+	0.2f, 0.3f, 0.2f, 0.4f, 0.25f, 0.4f, 0.25f, 0.3f,
+	0.2f, 0.4f, 0.2f, 0.5f, 0.25f, 0.5f, 0.25f, 0.4f,
+	0.2f, 0.5f, 0.2f, 0.6f, 0.25f, 0.6f, 0.25f, 0.5f,
+	0.2f, 0.6f, 0.2f, 0.7f, 0.25f, 0.7f, 0.25f, 0.6f,
+	0.2f, 0.7f, 0.2f, 0.8f, 0.25f, 0.8f, 0.25f, 0.7f,
+	0.2f, 0.8f, 0.2f, 0.90000004f, 0.25f, 0.90000004f, 0.25f, 0.8f,
+	0.2f, 0.90000004f, 0.2f, 1.0f, 0.25f, 1.0f, 0.25f, 0.90000004f,
+	0.25f, 0.0f, 0.25f, 0.1f, 0.3f, 0.1f, 0.3f, 0.0f,
+	0.25f, 0.1f, 0.25f, 0.2f, 0.3f, 0.2f, 0.3f, 0.1f,
+	0.25f, 0.2f, 0.25f, 0.3f, 0.3f, 0.3f, 0.3f, 0.2f,
+	0.25f, 0.3f, 0.25f, 0.4f, 0.3f, 0.4f, 0.3f, 0.3f,
+	0.25f, 0.4f, 0.25f, 0.5f, 0.3f, 0.5f, 0.3f, 0.4f,
+	0.25f, 0.5f, 0.25f, 0.6f, 0.3f, 0.6f, 0.3f, 0.5f,
+	0.25f, 0.6f, 0.25f, 0.7f, 0.3f, 0.7f, 0.3f, 0.6f,
+	0.25f, 0.7f, 0.25f, 0.8f, 0.3f, 0.8f, 0.3f, 0.7f,
+	0.25f, 0.8f, 0.25f, 0.90000004f, 0.3f, 0.90000004f, 0.3f, 0.8f,
+	0.25f, 0.90000004f, 0.25f, 1.0f, 0.3f, 1.0f, 0.3f, 0.90000004f,
+	0.3f, 0.0f, 0.3f, 0.1f, 0.35f, 0.1f, 0.35f, 0.0f,
+	0.3f, 0.1f, 0.3f, 0.2f, 0.35f, 0.2f, 0.35f, 0.1f,
+	0.3f, 0.2f, 0.3f, 0.3f, 0.35f, 0.3f, 0.35f, 0.2f,
+	0.3f, 0.3f, 0.3f, 0.4f, 0.35f, 0.4f, 0.35f, 0.3f,
+	0.3f, 0.4f, 0.3f, 0.5f, 0.35f, 0.5f, 0.35f, 0.4f,
+	0.3f, 0.5f, 0.3f, 0.6f, 0.35f, 0.6f, 0.35f, 0.5f,
+	0.3f, 0.6f, 0.3f, 0.7f, 0.35f, 0.7f, 0.35f, 0.6f,
+	0.3f, 0.7f, 0.3f, 0.8f, 0.35f, 0.8f, 0.35f, 0.7f,
+	0.3f, 0.8f, 0.3f, 0.90000004f, 0.35f, 0.90000004f, 0.35f, 0.8f,
+	0.3f, 0.90000004f, 0.3f, 1.0f, 0.35f, 1.0f, 0.35f, 0.90000004f,
+	0.35f, 0.0f, 0.35f, 0.1f, 0.4f, 0.1f, 0.4f, 0.0f,
+	0.35f, 0.1f, 0.35f, 0.2f, 0.4f, 0.2f, 0.4f, 0.1f,
+	0.35f, 0.2f, 0.35f, 0.3f, 0.4f, 0.3f, 0.4f, 0.2f,
+	0.35f, 0.3f, 0.35f, 0.4f, 0.4f, 0.4f, 0.4f, 0.3f,
+	0.35f, 0.4f, 0.35f, 0.5f, 0.4f, 0.5f, 0.4f, 0.4f,
+	0.35f, 0.5f, 0.35f, 0.6f, 0.4f, 0.6f, 0.4f, 0.5f,
+	0.35f, 0.6f, 0.35f, 0.7f, 0.4f, 0.7f, 0.4f, 0.6f,
+	0.35f, 0.7f, 0.35f, 0.8f, 0.4f, 0.8f, 0.4f, 0.7f,
+	0.35f, 0.8f, 0.35f, 0.90000004f, 0.4f, 0.90000004f, 0.4f, 0.8f,
+	0.35f, 0.90000004f, 0.35f, 1.0f, 0.4f, 1.0f, 0.4f, 0.90000004f,
+	0.4f, 0.0f, 0.4f, 0.1f, 0.45000002f, 0.1f, 0.45000002f, 0.0f,
+	0.4f, 0.1f, 0.4f, 0.2f, 0.45000002f, 0.2f, 0.45000002f, 0.1f,
+	0.4f, 0.2f, 0.4f, 0.3f, 0.45000002f, 0.3f, 0.45000002f, 0.2f,
+	0.4f, 0.3f, 0.4f, 0.4f, 0.45000002f, 0.4f, 0.45000002f, 0.3f,
+	0.4f, 0.4f, 0.4f, 0.5f, 0.45000002f, 0.5f, 0.45000002f, 0.4f,
+	0.4f, 0.5f, 0.4f, 0.6f, 0.45000002f, 0.6f, 0.45000002f, 0.5f,
+	0.4f, 0.6f, 0.4f, 0.7f, 0.45000002f, 0.7f, 0.45000002f, 0.6f,
+	0.4f, 0.7f, 0.4f, 0.8f, 0.45000002f, 0.8f, 0.45000002f, 0.7f,
+	0.4f, 0.8f, 0.4f, 0.90000004f, 0.45000002f, 0.90000004f, 0.45000002f, 0.8f,
+	0.4f, 0.90000004f, 0.4f, 1.0f, 0.45000002f, 1.0f, 0.45000002f, 0.90000004f,
+	0.45000002f, 0.0f, 0.45000002f, 0.1f, 0.5f, 0.1f, 0.5f, 0.0f,
+	0.45000002f, 0.1f, 0.45000002f, 0.2f, 0.5f, 0.2f, 0.5f, 0.1f,
+	0.45000002f, 0.2f, 0.45000002f, 0.3f, 0.5f, 0.3f, 0.5f, 0.2f,
+	0.45000002f, 0.3f, 0.45000002f, 0.4f, 0.5f, 0.4f, 0.5f, 0.3f,
+	0.45000002f, 0.4f, 0.45000002f, 0.5f, 0.5f, 0.5f, 0.5f, 0.4f,
+	0.45000002f, 0.5f, 0.45000002f, 0.6f, 0.5f, 0.6f, 0.5f, 0.5f,
+	0.45000002f, 0.6f, 0.45000002f, 0.7f, 0.5f, 0.7f, 0.5f, 0.6f,
+	0.45000002f, 0.7f, 0.45000002f, 0.8f, 0.5f, 0.8f, 0.5f, 0.7f,
+	0.45000002f, 0.8f, 0.45000002f, 0.90000004f, 0.5f, 0.90000004f, 0.5f, 0.8f,
+	0.45000002f, 0.90000004f, 0.45000002f, 1.0f, 0.5f, 1.0f, 0.5f, 0.90000004f,
+	0.5f, 0.0f, 0.5f, 0.1f, 0.55f, 0.1f, 0.55f, 0.0f,
+	0.5f, 0.1f, 0.5f, 0.2f, 0.55f, 0.2f, 0.55f, 0.1f,
+	0.5f, 0.2f, 0.5f, 0.3f, 0.55f, 0.3f, 0.55f, 0.2f,
+	0.5f, 0.3f, 0.5f, 0.4f, 0.55f, 0.4f, 0.55f, 0.3f,
+	0.5f, 0.4f, 0.5f, 0.5f, 0.55f, 0.5f, 0.55f, 0.4f,
+	0.5f, 0.5f, 0.5f, 0.6f, 0.55f, 0.6f, 0.55f, 0.5f,
+	0.5f, 0.6f, 0.5f, 0.7f, 0.55f, 0.7f, 0.55f, 0.6f,
+	0.5f, 0.7f, 0.5f, 0.8f, 0.55f, 0.8f, 0.55f, 0.7f,
+	0.5f, 0.8f, 0.5f, 0.90000004f, 0.55f, 0.90000004f, 0.55f, 0.8f,
+	0.5f, 0.90000004f, 0.5f, 1.0f, 0.55f, 1.0f, 0.55f, 0.90000004f,
+	0.55f, 0.0f, 0.55f, 0.1f, 0.6f, 0.1f, 0.6f, 0.0f,
+	0.55f, 0.1f, 0.55f, 0.2f, 0.6f, 0.2f, 0.6f, 0.1f,
+	0.55f, 0.2f, 0.55f, 0.3f, 0.6f, 0.3f, 0.6f, 0.2f,
+	0.55f, 0.3f, 0.55f, 0.4f, 0.6f, 0.4f, 0.6f, 0.3f,
+	0.55f, 0.4f, 0.55f, 0.5f, 0.6f, 0.5f, 0.6f, 0.4f,
+	0.55f, 0.5f, 0.55f, 0.6f, 0.6f, 0.6f, 0.6f, 0.5f,
+	0.55f, 0.6f, 0.55f, 0.7f, 0.6f, 0.7f, 0.6f, 0.6f,
+	0.55f, 0.7f, 0.55f, 0.8f, 0.6f, 0.8f, 0.6f, 0.7f,
+	0.55f, 0.8f, 0.55f, 0.90000004f, 0.6f, 0.90000004f, 0.6f, 0.8f,
+	0.55f, 0.90000004f, 0.55f, 1.0f, 0.6f, 1.0f, 0.6f, 0.90000004f,
+	0.6f, 0.0f, 0.6f, 0.1f, 0.65000004f, 0.1f, 0.65000004f, 0.0f,
+	0.6f, 0.1f, 0.6f, 0.2f, 0.65000004f, 0.2f, 0.65000004f, 0.1f,
+	0.6f, 0.2f, 0.6f, 0.3f, 0.65000004f, 0.3f, 0.65000004f, 0.2f,
+	0.6f, 0.3f, 0.6f, 0.4f, 0.65000004f, 0.4f, 0.65000004f, 0.3f,
+	0.6f, 0.4f, 0.6f, 0.5f, 0.65000004f, 0.5f, 0.65000004f, 0.4f,
+	0.6f, 0.5f, 0.6f, 0.6f, 0.65000004f, 0.6f, 0.65000004f, 0.5f,
+	0.6f, 0.6f, 0.6f, 0.7f, 0.65000004f, 0.7f, 0.65000004f, 0.6f,
+	0.6f, 0.7f, 0.6f, 0.8f, 0.65000004f, 0.8f, 0.65000004f, 0.7f,
+	0.6f, 0.8f, 0.6f, 0.90000004f, 0.65000004f, 0.90000004f, 0.65000004f, 0.8f,
+	0.6f, 0.90000004f, 0.6f, 1.0f, 0.65000004f, 1.0f, 0.65000004f, 0.90000004f,
+	0.65000004f, 0.0f, 0.65000004f, 0.1f, 0.7f, 0.1f, 0.7f, 0.0f,
+	0.65000004f, 0.1f, 0.65000004f, 0.2f, 0.7f, 0.2f, 0.7f, 0.1f,
+	0.65000004f, 0.2f, 0.65000004f, 0.3f, 0.7f, 0.3f, 0.7f, 0.2f,
+	0.65000004f, 0.3f, 0.65000004f, 0.4f, 0.7f, 0.4f, 0.7f, 0.3f,
+	0.65000004f, 0.4f, 0.65000004f, 0.5f, 0.7f, 0.5f, 0.7f, 0.4f,
+	0.65000004f, 0.5f, 0.65000004f, 0.6f, 0.7f, 0.6f, 0.7f, 0.5f,
+	0.65000004f, 0.6f, 0.65000004f, 0.7f, 0.7f, 0.7f, 0.7f, 0.6f,
+	0.65000004f, 0.7f, 0.65000004f, 0.8f, 0.7f, 0.8f, 0.7f, 0.7f,
+	0.65000004f, 0.8f, 0.65000004f, 0.90000004f, 0.7f, 0.90000004f, 0.7f, 0.8f,
+	0.65000004f, 0.90000004f, 0.65000004f, 1.0f, 0.7f, 1.0f, 0.7f, 0.90000004f,
+	0.7f, 0.0f, 0.7f, 0.1f, 0.75f, 0.1f, 0.75f, 0.0f,
+	0.7f, 0.1f, 0.7f, 0.2f, 0.75f, 0.2f, 0.75f, 0.1f,
+	0.7f, 0.2f, 0.7f, 0.3f, 0.75f, 0.3f, 0.75f, 0.2f,
+	0.7f, 0.3f, 0.7f, 0.4f, 0.75f, 0.4f, 0.75f, 0.3f,
+	0.7f, 0.4f, 0.7f, 0.5f, 0.75f, 0.5f, 0.75f, 0.4f,
+	0.7f, 0.5f, 0.7f, 0.6f, 0.75f, 0.6f, 0.75f, 0.5f,
+	0.7f, 0.6f, 0.7f, 0.7f, 0.75f, 0.7f, 0.75f, 0.6f,
+	0.7f, 0.7f, 0.7f, 0.8f, 0.75f, 0.8f, 0.75f, 0.7f,
+	0.7f, 0.8f, 0.7f, 0.90000004f, 0.75f, 0.90000004f, 0.75f, 0.8f,
+	0.7f, 0.90000004f, 0.7f, 1.0f, 0.75f, 1.0f, 0.75f, 0.90000004f,
+	0.75f, 0.0f, 0.75f, 0.1f, 0.8f, 0.1f, 0.8f, 0.0f,
+	0.75f, 0.1f, 0.75f, 0.2f, 0.8f, 0.2f, 0.8f, 0.1f,
+	0.75f, 0.2f, 0.75f, 0.3f, 0.8f, 0.3f, 0.8f, 0.2f,
+	0.75f, 0.3f, 0.75f, 0.4f, 0.8f, 0.4f, 0.8f, 0.3f,
+	0.75f, 0.4f, 0.75f, 0.5f, 0.8f, 0.5f, 0.8f, 0.4f,
+	0.75f, 0.5f, 0.75f, 0.6f, 0.8f, 0.6f, 0.8f, 0.5f,
+	0.75f, 0.6f, 0.75f, 0.7f, 0.8f, 0.7f, 0.8f, 0.6f,
+	0.75f, 0.7f, 0.75f, 0.8f, 0.8f, 0.8f, 0.8f, 0.7f,
+	0.75f, 0.8f, 0.75f, 0.90000004f, 0.8f, 0.90000004f, 0.8f, 0.8f,
+	0.75f, 0.90000004f, 0.75f, 1.0f, 0.8f, 1.0f, 0.8f, 0.90000004f,
+	0.8f, 0.0f, 0.8f, 0.1f, 0.85f, 0.1f, 0.85f, 0.0f,
+	0.8f, 0.1f, 0.8f, 0.2f, 0.85f, 0.2f, 0.85f, 0.1f,
+	0.8f, 0.2f, 0.8f, 0.3f, 0.85f, 0.3f, 0.85f, 0.2f,
+	0.8f, 0.3f, 0.8f, 0.4f, 0.85f, 0.4f, 0.85f, 0.3f,
+	0.8f, 0.4f, 0.8f, 0.5f, 0.85f, 0.5f, 0.85f, 0.4f,
+	0.8f, 0.5f, 0.8f, 0.6f, 0.85f, 0.6f, 0.85f, 0.5f,
+	0.8f, 0.6f, 0.8f, 0.7f, 0.85f, 0.7f, 0.85f, 0.6f,
+	0.8f, 0.7f, 0.8f, 0.8f, 0.85f, 0.8f, 0.85f, 0.7f,
+	0.8f, 0.8f, 0.8f, 0.90000004f, 0.85f, 0.90000004f, 0.85f, 0.8f,
+	0.8f, 0.90000004f, 0.8f, 1.0f, 0.85f, 1.0f, 0.85f, 0.90000004f,
+	0.85f, 0.0f, 0.85f, 0.1f, 0.90000004f, 0.1f, 0.90000004f, 0.0f,
+	0.85f, 0.1f, 0.85f, 0.2f, 0.90000004f, 0.2f, 0.90000004f, 0.1f,
+	0.85f, 0.2f, 0.85f, 0.3f, 0.90000004f, 0.3f, 0.90000004f, 0.2f,
+	0.85f, 0.3f, 0.85f, 0.4f, 0.90000004f, 0.4f, 0.90000004f, 0.3f,
+	0.85f, 0.4f, 0.85f, 0.5f, 0.90000004f, 0.5f, 0.90000004f, 0.4f,
+	0.85f, 0.5f, 0.85f, 0.6f, 0.90000004f, 0.6f, 0.90000004f, 0.5f,
+	0.85f, 0.6f, 0.85f, 0.7f, 0.90000004f, 0.7f, 0.90000004f, 0.6f,
+	0.85f, 0.7f, 0.85f, 0.8f, 0.90000004f, 0.8f, 0.90000004f, 0.7f,
+	0.85f, 0.8f, 0.85f, 0.90000004f, 0.90000004f, 0.90000004f, 0.90000004f, 0.8f,
+	0.85f, 0.90000004f, 0.85f, 1.0f, 0.90000004f, 1.0f, 0.90000004f, 0.90000004f,
+	0.90000004f, 0.0f, 0.90000004f, 0.1f, 0.95f, 0.1f, 0.95f, 0.0f,
+	0.90000004f, 0.1f, 0.90000004f, 0.2f, 0.95f, 0.2f, 0.95f, 0.1f,
+	0.90000004f, 0.2f, 0.90000004f, 0.3f, 0.95f, 0.3f, 0.95f, 0.2f,
+	0.90000004f, 0.3f, 0.90000004f, 0.4f, 0.95f, 0.4f, 0.95f, 0.3f,
+	0.90000004f, 0.4f, 0.90000004f, 0.5f, 0.95f, 0.5f, 0.95f, 0.4f,
+	0.90000004f, 0.5f, 0.90000004f, 0.6f, 0.95f, 0.6f, 0.95f, 0.5f,
+	0.90000004f, 0.6f, 0.90000004f, 0.7f, 0.95f, 0.7f, 0.95f, 0.6f,
+	0.90000004f, 0.7f, 0.90000004f, 0.8f, 0.95f, 0.8f, 0.95f, 0.7f,
+	0.90000004f, 0.8f, 0.90000004f, 0.90000004f, 0.95f, 0.90000004f, 0.95f, 0.8f,
+	0.90000004f, 0.90000004f, 0.90000004f, 1.0f, 0.95f, 1.0f, 0.95f, 0.90000004f,
+	0.95f, 0.0f, 0.95f, 0.1f, 1.0f, 0.1f, 1.0f, 0.0f,
+	0.95f, 0.1f, 0.95f, 0.2f, 1.0f, 0.2f, 1.0f, 0.1f,
+	0.95f, 0.2f, 0.95f, 0.3f, 1.0f, 0.3f, 1.0f, 0.2f,
+	0.95f, 0.3f, 0.95f, 0.4f, 1.0f, 0.4f, 1.0f, 0.3f,
+	0.95f, 0.4f, 0.95f, 0.5f, 1.0f, 0.5f, 1.0f, 0.4f,
+	0.95f, 0.5f, 0.95f, 0.6f, 1.0f, 0.6f, 1.0f, 0.5f,
+	0.95f, 0.6f, 0.95f, 0.7f, 1.0f, 0.7f, 1.0f, 0.6f,
+	0.95f, 0.7f, 0.95f, 0.8f, 1.0f, 0.8f, 1.0f, 0.7f,
+	0.95f, 0.8f, 0.95f, 0.90000004f, 1.0f, 0.90000004f, 1.0f, 0.8f,
+	0.95f, 0.90000004f, 0.95f, 1.0f, 1.0f, 1.0f, 1.0f, 0.90000004f,
+	0.0f, 0.0f, 0.0f, 0.1f, 0.05f, 0.1f, 0.05f, 0.0f,
+	0.0f, 0.1f, 0.0f, 0.2f, 0.05f, 0.2f, 0.05f, 0.1f,
+	0.0f, 0.2f, 0.0f, 0.3f, 0.05f, 0.3f, 0.05f, 0.2f,
+	0.0f, 0.3f, 0.0f, 0.4f, 0.05f, 0.4f, 0.05f, 0.3f,
+	0.0f, 0.4f, 0.0f, 0.5f, 0.05f, 0.5f, 0.05f, 0.4f,
+	0.0f, 0.5f, 0.0f, 0.6f, 0.05f, 0.6f, 0.05f, 0.5f,
+	0.0f, 0.6f, 0.0f, 0.7f, 0.05f, 0.7f, 0.05f, 0.6f,
+	0.0f, 0.7f, 0.0f, 0.8f, 0.05f, 0.8f, 0.05f, 0.7f,
+	0.0f, 0.8f, 0.0f, 0.90000004f, 0.05f, 0.90000004f, 0.05f, 0.8f,
+	0.0f, 0.90000004f, 0.0f, 1.0f, 0.05f, 1.0f, 0.05f, 0.90000004f,
+	0.05f, 0.0f, 0.05f, 0.1f, 0.1f, 0.1f, 0.1f, 0.0f,
+	0.05f, 0.1f, 0.05f, 0.2f, 0.1f, 0.2f, 0.1f, 0.1f,
+	0.05f, 0.2f, 0.05f, 0.3f, 0.1f, 0.3f, 0.1f, 0.2f,
+	0.05f, 0.3f, 0.05f, 0.4f, 0.1f, 0.4f, 0.1f, 0.3f,
+	0.05f, 0.4f, 0.05f, 0.5f, 0.1f, 0.5f, 0.1f, 0.4f,
+	0.05f, 0.5f, 0.05f, 0.6f, 0.1f, 0.6f, 0.1f, 0.5f,
+	0.05f, 0.6f, 0.05f, 0.7f, 0.1f, 0.7f, 0.1f, 0.6f,
+	0.05f, 0.7f, 0.05f, 0.8f, 0.1f, 0.8f, 0.1f, 0.7f,
+	0.05f, 0.8f, 0.05f, 0.90000004f, 0.1f, 0.90000004f, 0.1f, 0.8f,
+	0.05f, 0.90000004f, 0.05f, 1.0f, 0.1f, 1.0f, 0.1f, 0.90000004f,
+	0.1f, 0.0f, 0.1f, 0.1f, 0.15f, 0.1f, 0.15f, 0.0f,
+	0.1f, 0.1f, 0.1f, 0.2f, 0.15f, 0.2f, 0.15f, 0.1f,
+	0.1f, 0.2f, 0.1f, 0.3f, 0.15f, 0.3f, 0.15f, 0.2f,
+	0.1f, 0.3f, 0.1f, 0.4f, 0.15f, 0.4f, 0.15f, 0.3f,
+	0.1f, 0.4f, 0.1f, 0.5f, 0.15f, 0.5f, 0.15f, 0.4f,
+	0.1f, 0.5f, 0.1f, 0.6f, 0.15f, 0.6f, 0.15f, 0.5f,
+	0.1f, 0.6f, 0.1f, 0.7f, 0.15f, 0.7f, 0.15f, 0.6f,
+	0.1f, 0.7f, 0.1f, 0.8f, 0.15f, 0.8f, 0.15f, 0.7f,
+	0.1f, 0.8f, 0.1f, 0.90000004f, 0.15f, 0.90000004f, 0.15f, 0.8f,
+	0.1f, 0.90000004f, 0.1f, 1.0f, 0.15f, 1.0f, 0.15f, 0.90000004f,
+	0.15f, 0.0f, 0.15f, 0.1f, 0.2f, 0.1f, 0.2f, 0.0f,
+	0.15f, 0.1f, 0.15f, 0.2f, 0.2f, 0.2f, 0.2f, 0.1f,
+	0.15f, 0.2f, 0.15f, 0.3f, 0.2f, 0.3f, 0.2f, 0.2f,
+	0.15f, 0.3f, 0.15f, 0.4f, 0.2f, 0.4f, 0.2f, 0.3f,
+	0.15f, 0.4f, 0.15f, 0.5f, 0.2f, 0.5f, 0.2f, 0.4f,
+	0.15f, 0.5f, 0.15f, 0.6f, 0.2f, 0.6f, 0.2f, 0.5f,
+	0.15f, 0.6f, 0.15f, 0.7f, 0.2f, 0.7f, 0.2f, 0.6f,
+	0.15f, 0.7f, 0.15f, 0.8f, 0.2f, 0.8f, 0.2f, 0.7f,
+	0.15f, 0.8f, 0.15f, 0.90000004f, 0.2f, 0.90000004f, 0.2f, 0.8f,
+	0.15f, 0.90000004f, 0.15f, 1.0f, 0.2f, 1.0f, 0.2f, 0.90000004f,
+	0.2f, 0.0f, 0.2f, 0.1f, 0.25f, 0.1f, 0.25f, 0.0f,
+	0.2f, 0.1f, 0.2f, 0.2f, 0.25f, 0.2f, 0.25f, 0.1f,
+	0.2f, 0.2f, 0.2f, 0.3f, 0.25f, 0.3f, 0.25f, 0.2f,
+	0.2f, 0.3f, 0.2f, 0.4f, 0.25f, 0.4f, 0.25f, 0.3f,
+	0.2f, 0.4f, 0.2f, 0.5f, 0.25f, 0.5f, 0.25f, 0.4f,
+	0.2f, 0.5f, 0.2f, 0.6f, 0.25f, 0.6f, 0.25f, 0.5f,
+	0.2f, 0.6f, 0.2f, 0.7f, 0.25f, 0.7f, 0.25f, 0.6f,
+	0.2f, 0.7f, 0.2f, 0.8f, 0.25f, 0.8f, 0.25f, 0.7f,
+	0.2f, 0.8f, 0.2f, 0.90000004f, 0.25f, 0.90000004f, 0.25f, 0.8f,
+	0.2f, 0.90000004f, 0.2f, 1.0f, 0.25f, 1.0f, 0.25f, 0.90000004f,
+	0.25f, 0.0f, 0.25f, 0.1f, 0.3f, 0.1f, 0.3f, 0.0f,
+	0.25f, 0.1f, 0.25f, 0.2f, 0.3f, 0.2f, 0.3f, 0.1f,
+	0.25f, 0.2f, 0.25f, 0.3f, 0.3f, 0.3f, 0.3f, 0.2f,
+	0.25f, 0.3f, 0.25f, 0.4f, 0.3f, 0.4f, 0.3f, 0.3f,
+	0.25f, 0.4f, 0.25f, 0.5f, 0.3f, 0.5f, 0.3f, 0.4f,
+	0.25f, 0.5f, 0.25f, 0.6f, 0.3f, 0.6f, 0.3f, 0.5f,
+	0.25f, 0.6f, 0.25f, 0.7f, 0.3f, 0.7f, 0.3f, 0.6f,
+	0.25f, 0.7f, 0.25f, 0.8f, 0.3f, 0.8f, 0.3f, 0.7f,
+	0.25f, 0.8f, 0.25f, 0.90000004f, 0.3f, 0.90000004f, 0.3f, 0.8f,
+	0.25f, 0.90000004f, 0.25f, 1.0f, 0.3f, 1.0f, 0.3f, 0.90000004f,
+	0.3f, 0.0f, 0.3f, 0.1f, 0.35f, 0.1f, 0.35f, 0.0f,
+	0.3f, 0.1f, 0.3f, 0.2f, 0.35f, 0.2f, 0.35f, 0.1f,
+	0.3f, 0.2f, 0.3f, 0.3f, 0.35f, 0.3f, 0.35f, 0.2f,
+	0.3f, 0.3f, 0.3f, 0.4f, 0.35f, 0.4f, 0.35f, 0.3f,
+	0.3f, 0.4f, 0.3f, 0.5f, 0.35f, 0.5f, 0.35f, 0.4f,
+	0.3f, 0.5f, 0.3f, 0.6f, 0.35f, 0.6f, 0.35f, 0.5f,
+	0.3f, 0.6f, 0.3f, 0.7f, 0.35f, 0.7f, 0.35f, 0.6f,
+	0.3f, 0.7f, 0.3f, 0.8f, 0.35f, 0.8f, 0.35f, 0.7f,
+	0.3f, 0.8f, 0.3f, 0.90000004f, 0.35f, 0.90000004f, 0.35f, 0.8f,
+	0.3f, 0.90000004f, 0.3f, 1.0f, 0.35f, 1.0f, 0.35f, 0.90000004f,
+	0.35f, 0.0f, 0.35f, 0.1f, 0.4f, 0.1f, 0.4f, 0.0f,
+	0.35f, 0.1f, 0.35f, 0.2f, 0.4f, 0.2f, 0.4f, 0.1f,
+	0.35f, 0.2f, 0.35f, 0.3f, 0.4f, 0.3f, 0.4f, 0.2f,
+	0.35f, 0.3f, 0.35f, 0.4f, 0.4f, 0.4f, 0.4f, 0.3f,
+	0.35f, 0.4f, 0.35f, 0.5f, 0.4f, 0.5f, 0.4f, 0.4f,
+	0.35f, 0.5f, 0.35f, 0.6f, 0.4f, 0.6f, 0.4f, 0.5f,
+	0.35f, 0.6f, 0.35f, 0.7f, 0.4f, 0.7f, 0.4f, 0.6f,
+	0.35f, 0.7f, 0.35f, 0.8f, 0.4f, 0.8f, 0.4f, 0.7f,
+	0.35f, 0.8f, 0.35f, 0.90000004f, 0.4f, 0.90000004f, 0.4f, 0.8f,
+	0.35f, 0.90000004f, 0.35f, 1.0f, 0.4f, 1.0f, 0.4f, 0.90000004f,
+	0.4f, 0.0f, 0.4f, 0.1f, 0.45000002f, 0.1f, 0.45000002f, 0.0f,
+	0.4f, 0.1f, 0.4f, 0.2f, 0.45000002f, 0.2f, 0.45000002f, 0.1f,
+	0.4f, 0.2f, 0.4f, 0.3f, 0.45000002f, 0.3f, 0.45000002f, 0.2f,
+	0.4f, 0.3f, 0.4f, 0.4f, 0.45000002f, 0.4f, 0.45000002f, 0.3f,
+	0.4f, 0.4f, 0.4f, 0.5f, 0.45000002f, 0.5f, 0.45000002f, 0.4f,
+	0.4f, 0.5f, 0.4f, 0.6f, 0.45000002f, 0.6f, 0.45000002f, 0.5f,
+	0.4f, 0.6f, 0.4f, 0.7f, 0.45000002f, 0.7f, 0.45000002f, 0.6f,
+	0.4f, 0.7f, 0.4f, 0.8f, 0.45000002f, 0.8f, 0.45000002f, 0.7f,
+	0.4f, 0.8f, 0.4f, 0.90000004f, 0.45000002f, 0.90000004f, 0.45000002f, 0.8f,
+	0.4f, 0.90000004f, 0.4f, 1.0f, 0.45000002f, 1.0f, 0.45000002f, 0.90000004f,
+	0.45000002f, 0.0f, 0.45000002f, 0.1f, 0.5f, 0.1f, 0.5f, 0.0f,
+	0.45000002f, 0.1f, 0.45000002f, 0.2f, 0.5f, 0.2f, 0.5f, 0.1f,
+	0.45000002f, 0.2f, 0.45000002f, 0.3f, 0.5f, 0.3f, 0.5f, 0.2f,
+	0.45000002f, 0.3f, 0.45000002f, 0.4f, 0.5f, 0.4f, 0.5f, 0.3f,
+	0.45000002f, 0.4f, 0.45000002f, 0.5f, 0.5f, 0.5f, 0.5f, 0.4f,
+	0.45000002f, 0.5f, 0.45000002f, 0.6f, 0.5f, 0.6f, 0.5f, 0.5f,
+	0.45000002f, 0.6f, 0.45000002f, 0.7f, 0.5f, 0.7f, 0.5f, 0.6f,
+	0.45000002f, 0.7f, 0.45000002f, 0.8f, 0.5f, 0.8f, 0.5f, 0.7f,
+	0.45000002f, 0.8f, 0.45000002f, 0.90000004f, 0.5f, 0.90000004f, 0.5f, 0.8f,
+	0.45000002f, 0.90000004f, 0.45000002f, 1.0f, 0.5f, 1.0f, 0.5f, 0.90000004f,
+	0.5f, 0.0f, 0.5f, 0.1f, 0.55f, 0.1f, 0.55f, 0.0f,
+	0.5f, 0.1f, 0.5f, 0.2f, 0.55f, 0.2f, 0.55f, 0.1f,
+	0.5f, 0.2f, 0.5f, 0.3f, 0.55f, 0.3f, 0.55f, 0.2f,
+	0.5f, 0.3f, 0.5f, 0.4f, 0.55f, 0.4f, 0.55f, 0.3f,
+	0.5f, 0.4f, 0.5f, 0.5f, 0.55f, 0.5f, 0.55f, 0.4f,
+	0.5f, 0.5f, 0.5f, 0.6f, 0.55f, 0.6f, 0.55f, 0.5f,
+	0.5f, 0.6f, 0.5f, 0.7f, 0.55f, 0.7f, 0.55f, 0.6f,
+	0.5f, 0.7f, 0.5f, 0.8f, 0.55f, 0.8f, 0.55f, 0.7f,
+	0.5f, 0.8f, 0.5f, 0.90000004f, 0.55f, 0.90000004f, 0.55f, 0.8f,
+	0.5f, 0.90000004f, 0.5f, 1.0f, 0.55f, 1.0f, 0.55f, 0.90000004f,
+	0.55f, 0.0f, 0.55f, 0.1f, 0.6f, 0.1f, 0.6f, 0.0f,
+	0.55f, 0.1f, 0.55f, 0.2f, 0.6f, 0.2f, 0.6f, 0.1f,
+	0.55f, 0.2f, 0.55f, 0.3f, 0.6f, 0.3f, 0.6f, 0.2f,
+	0.55f, 0.3f, 0.55f, 0.4f, 0.6f, 0.4f, 0.6f, 0.3f,
+	0.55f, 0.4f, 0.55f, 0.5f, 0.6f, 0.5f, 0.6f, 0.4f,
+	0.55f, 0.5f, 0.55f, 0.6f, 0.6f, 0.6f, 0.6f, 0.5f,
+	0.55f, 0.6f, 0.55f, 0.7f, 0.6f, 0.7f, 0.6f, 0.6f,
+	0.55f, 0.7f, 0.55f, 0.8f, 0.6f, 0.8f, 0.6f, 0.7f,
+	0.55f, 0.8f, 0.55f, 0.90000004f, 0.6f, 0.90000004f, 0.6f, 0.8f,
+	0.55f, 0.90000004f, 0.55f, 1.0f, 0.6f, 1.0f, 0.6f, 0.90000004f,
+	0.6f, 0.0f, 0.6f, 0.1f, 0.65000004f, 0.1f, 0.65000004f, 0.0f,
+	0.6f, 0.1f, 0.6f, 0.2f, 0.65000004f, 0.2f, 0.65000004f, 0.1f,
+	0.6f, 0.2f, 0.6f, 0.3f, 0.65000004f, 0.3f, 0.65000004f, 0.2f,
+	0.6f, 0.3f, 0.6f, 0.4f, 0.65000004f, 0.4f, 0.65000004f, 0.3f,
+	0.6f, 0.4f, 0.6f, 0.5f, 0.65000004f, 0.5f, 0.65000004f, 0.4f,
+	0.6f, 0.5f, 0.6f, 0.6f, 0.65000004f, 0.6f, 0.65000004f, 0.5f,
+	0.6f, 0.6f, 0.6f, 0.7f, 0.65000004f, 0.7f, 0.65000004f, 0.6f,
+	0.6f, 0.7f, 0.6f, 0.8f, 0.65000004f, 0.8f, 0.65000004f, 0.7f,
+	0.6f, 0.8f, 0.6f, 0.90000004f, 0.65000004f, 0.90000004f, 0.65000004f, 0.8f,
+	0.6f, 0.90000004f, 0.6f, 1.0f, 0.65000004f, 1.0f, 0.65000004f, 0.90000004f,
+	0.65000004f, 0.0f, 0.65000004f, 0.1f, 0.7f, 0.1f, 0.7f, 0.0f,
+	0.65000004f, 0.1f, 0.65000004f, 0.2f, 0.7f, 0.2f, 0.7f, 0.1f,
+	0.65000004f, 0.2f, 0.65000004f, 0.3f, 0.7f, 0.3f, 0.7f, 0.2f,
+	0.65000004f, 0.3f, 0.65000004f, 0.4f, 0.7f, 0.4f, 0.7f, 0.3f,
+	0.65000004f, 0.4f, 0.65000004f, 0.5f, 0.7f, 0.5f, 0.7f, 0.4f,
+	0.65000004f, 0.5f, 0.65000004f, 0.6f, 0.7f, 0.6f, 0.7f, 0.5f,
+	0.65000004f, 0.6f, 0.65000004f, 0.7f, 0.7f, 0.7f, 0.7f, 0.6f,
+	0.65000004f, 0.7f, 0.65000004f, 0.8f, 0.7f, 0.8f, 0.7f, 0.7f,
+	0.65000004f, 0.8f, 0.65000004f, 0.90000004f, 0.7f, 0.90000004f, 0.7f, 0.8f,
+	0.65000004f, 0.90000004f, 0.65000004f, 1.0f, 0.7f, 1.0f, 0.7f, 0.90000004f,
+	0.7f, 0.0f, 0.7f, 0.1f, 0.75f, 0.1f, 0.75f, 0.0f,
+	0.7f, 0.1f, 0.7f, 0.2f, 0.75f, 0.2f, 0.75f, 0.1f,
+	0.7f, 0.2f, 0.7f, 0.3f, 0.75f, 0.3f, 0.75f, 0.2f,
+	0.7f, 0.3f, 0.7f, 0.4f, 0.75f, 0.4f, 0.75f, 0.3f,
+	0.7f, 0.4f, 0.7f, 0.5f, 0.75f, 0.5f, 0.75f, 0.4f,
+	0.7f, 0.5f, 0.7f, 0.6f, 0.75f, 0.6f, 0.75f, 0.5f,
+	0.7f, 0.6f, 0.7f, 0.7f, 0.75f, 0.7f, 0.75f, 0.6f,
+	0.7f, 0.7f, 0.7f, 0.8f, 0.75f, 0.8f, 0.75f, 0.7f,
+	0.7f, 0.8f, 0.7f, 0.90000004f, 0.75f, 0.90000004f, 0.75f, 0.8f,
+	0.7f, 0.90000004f, 0.7f, 1.0f, 0.75f, 1.0f, 0.75f, 0.90000004f,
+	0.75f, 0.0f, 0.75f, 0.1f, 0.8f, 0.1f, 0.8f, 0.0f,
+	0.75f, 0.1f, 0.75f, 0.2f, 0.8f, 0.2f, 0.8f, 0.1f,
+	0.75f, 0.2f, 0.75f, 0.3f, 0.8f, 0.3f, 0.8f, 0.2f,
+	0.75f, 0.3f, 0.75f, 0.4f, 0.8f, 0.4f, 0.8f, 0.3f,
+	0.75f, 0.4f, 0.75f, 0.5f, 0.8f, 0.5f, 0.8f, 0.4f,
+	0.75f, 0.5f, 0.75f, 0.6f, 0.8f, 0.6f, 0.8f, 0.5f,
+	0.75f, 0.6f, 0.75f, 0.7f, 0.8f, 0.7f, 0.8f, 0.6f,
+	0.75f, 0.7f, 0.75f, 0.8f, 0.8f, 0.8f, 0.8f, 0.7f,
+	0.75f, 0.8f, 0.75f, 0.90000004f, 0.8f, 0.90000004f, 0.8f, 0.8f,
+	0.75f, 0.90000004f, 0.75f, 1.0f, 0.8f, 1.0f, 0.8f, 0.90000004f,
+	0.8f, 0.0f, 0.8f, 0.1f, 0.85f, 0.1f, 0.85f, 0.0f,
+	0.8f, 0.1f, 0.8f, 0.2f, 0.85f, 0.2f, 0.85f, 0.1f,
+	0.8f, 0.2f, 0.8f, 0.3f, 0.85f, 0.3f, 0.85f, 0.2f,
+	0.8f, 0.3f, 0.8f, 0.4f, 0.85f, 0.4f, 0.85f, 0.3f,
+	0.8f, 0.4f, 0.8f, 0.5f, 0.85f, 0.5f, 0.85f, 0.4f,
+	0.8f, 0.5f, 0.8f, 0.6f, 0.85f, 0.6f, 0.85f, 0.5f,
+	0.8f, 0.6f, 0.8f, 0.7f, 0.85f, 0.7f, 0.85f, 0.6f,
+	0.8f, 0.7f, 0.8f, 0.8f, 0.85f, 0.8f, 0.85f, 0.7f,
+	0.8f, 0.8f, 0.8f, 0.90000004f, 0.85f, 0.90000004f, 0.85f, 0.8f,
+	0.8f, 0.90000004f, 0.8f, 1.0f, 0.85f, 1.0f, 0.85f, 0.90000004f,
+	0.85f, 0.0f, 0.85f, 0.1f, 0.90000004f, 0.1f, 0.90000004f, 0.0f,
+	0.85f, 0.1f, 0.85f, 0.2f, 0.90000004f, 0.2f, 0.90000004f, 0.1f,
+	0.85f, 0.2f, 0.85f, 0.3f, 0.90000004f, 0.3f, 0.90000004f, 0.2f,
+	0.85f, 0.3f, 0.85f, 0.4f, 0.90000004f, 0.4f, 0.90000004f, 0.3f,
+	0.85f, 0.4f, 0.85f, 0.5f, 0.90000004f, 0.5f, 0.90000004f, 0.4f,
+	0.85f, 0.5f, 0.85f, 0.6f, 0.90000004f, 0.6f, 0.90000004f, 0.5f,
+	0.85f, 0.6f, 0.85f, 0.7f, 0.90000004f, 0.7f, 0.90000004f, 0.6f,
+	0.85f, 0.7f, 0.85f, 0.8f, 0.90000004f, 0.8f, 0.90000004f, 0.7f,
+	0.85f, 0.8f, 0.85f, 0.90000004f, 0.90000004f, 0.90000004f, 0.90000004f, 0.8f,
+	0.85f, 0.90000004f, 0.85f, 1.0f, 0.90000004f, 1.0f, 0.90000004f, 0.90000004f,
+	0.90000004f, 0.0f, 0.90000004f, 0.1f, 0.95f, 0.1f, 0.95f, 0.0f,
+	0.90000004f, 0.1f, 0.90000004f, 0.2f, 0.95f, 0.2f, 0.95f, 0.1f,
+	0.90000004f, 0.2f, 0.90000004f, 0.3f, 0.95f, 0.3f, 0.95f, 0.2f,
+	0.90000004f, 0.3f, 0.90000004f, 0.4f, 0.95f, 0.4f, 0.95f, 0.3f,
+	0.90000004f, 0.4f, 0.90000004f, 0.5f, 0.95f, 0.5f, 0.95f, 0.4f,
+	0.90000004f, 0.5f, 0.90000004f, 0.6f, 0.95f, 0.6f, 0.95f, 0.5f,
+	0.90000004f, 0.6f, 0.90000004f, 0.7f, 0.95f, 0.7f, 0.95f, 0.6f,
+	0.90000004f, 0.7f, 0.90000004f, 0.8f, 0.95f, 0.8f, 0.95f, 0.7f,
+	0.90000004f, 0.8f, 0.90000004f, 0.90000004f, 0.95f, 0.90000004f, 0.95f, 0.8f,
+	0.90000004f, 0.90000004f, 0.90000004f, 1.0f, 0.95f, 1.0f, 0.95f, 0.90000004f,
+	0.95f, 0.0f, 0.95f, 0.1f, 1.0f, 0.1f, 1.0f, 0.0f,
+	0.95f, 0.1f, 0.95f, 0.2f, 1.0f, 0.2f, 1.0f, 0.1f,
+	0.95f, 0.2f, 0.95f, 0.3f, 1.0f, 0.3f, 1.0f, 0.2f,
+	0.95f, 0.3f, 0.95f, 0.4f, 1.0f, 0.4f, 1.0f, 0.3f,
+	0.95f, 0.4f, 0.95f, 0.5f, 1.0f, 0.5f, 1.0f, 0.4f,
+	0.95f, 0.5f, 0.95f, 0.6f, 1.0f, 0.6f, 1.0f, 0.5f,
+	0.95f, 0.6f, 0.95f, 0.7f, 1.0f, 0.7f, 1.0f, 0.6f,
+	0.95f, 0.7f, 0.95f, 0.8f, 1.0f, 0.8f, 1.0f, 0.7f,
+	0.95f, 0.8f, 0.95f, 0.90000004f, 1.0f, 0.90000004f, 1.0f, 0.8f,
+	0.95f, 0.90000004f, 0.95f, 1.0f, 1.0f, 1.0f, 1.0f, 0.90000004f
+};
+
+ShapeArrays BakedTables::cuboid()
+{
+	ShapeArrays arrays = { cuboidVertex, cuboidNormals, cuboidTexCoords, NULL, 3200, 0, 1.0f, 20.0f };
+	return arrays;
+}
+
+static const float cuboidAtlas[6400] =
+{
+	0.05f, 0.0f, 0.05f, 0.1f, 0.07f, 0.1f, 0.07f, 0.0f,
+	0.05f, 0.1f, 0.05f, 0.2f, 0.07f, 0.2f, 0.07f, 0.1f,
+	0.05f, 0.2f, 0.05f, 0.3f, 0.07f, 0.3f, 0.07f, 0.2f,
+	0.05f, 0.3f, 0.05f, 0.4f, 0.07f, 0.4f, 0.07f, 0.3f,
+	0.05f, 0.4f, 0.05f, 0.5f, 0.07f, 0.5f, 0.07f, 0.4f,
+	0.05f, 0.5f, 0.05f, 0.6f, 0.07f, 0.6f, 0.07f, 0.5f,
+	0.05f, 0.6f, 0.05f, 0.7f, 0.07f, 0.7f, 0.07f, 0.6f,
+	0.05f, 0.7f, 0.05f, 0.8f, 0.07f, 0.8f, 0.07f, 0.7f,
+	0.05f, 0.8f, 0.05f, 0.90000004f, 0.07f, 0.90000004f, 0.07f, 0.8f,
+	0.05f, 0.90000004f, 0.05f, 1.0f, 0.07f, 1.0f, 0.07f, 0.90000004f,
+	0.07f, 0.0f, 0.07f, 0.1f, 0.09f, 0.1f, 0.09f, 0.0f,
+	0.07f, 0.1f, 0.07f, 0.2f, 0.09f, 0.2f, 0.09f, 0.1f,
+	0.07f, 0.2f, 0.07f, 0.3f, 0.09f, 0.3f, 0.09f, 0.2f,
+	0.07f, 0.3f, 0.07f, 0.4f, 0.09f, 0.4f, 0.09f, 0.3f,
+	0.07f, 0.4f, 0.07f, 0.5f, 0.09f, 0.5f, 0.09f, 0.4f,
+	0.07f, 0.5f, 0.07f, 0.6f, 0.09f, 0.6f, 0.09f, 0.5f,
+	0.07f, 0.6f, 0.07f, 0.7f, 0.09f, 0.7f, 0.09f, 0.6f,
+	0.07f, 0.7f, 0.07f, 0.8f, 0.09f, 0.8f, 0.09f, 0.7f,
+	0.07f, 0.8f, 0.07f, 0.90000004f, 0.09f, 0.90000004f, 0.09f, 0.8f,
+	0.07f, 0.90000004f, 0.07f, 1.0f, 0.09f, 1.0f, 0.09f, 0.90000004f,
+	0.09f, 0.0f, 0.09f, 0.1f, 0.11f, 0.1f, 0.11f, 0.0f,
+	0.09f, 0.1f, 0.09f, 0.2f, 0.11f, 0.2f, 0.11f, 0.1f,
+	0.09f, 0.2f, 0.09f, 0.3f, 0.11f, 0.3f, 0.11f, 0.2f,
+	0.09f, 0.3f, 0.09f, 0.4f, 0.11f, 0.4f, 0.11f, 0.3f,
+	0.09f, 0.4f, 0.09f, 0.5f, 0.11f, 0.5f, 0.11f, 0.4f,
+	0.09f, 0.5f, 0.09f, 0.6f, 0.11f, 0.6f, 0.11f, 0.5f,
+	0.09f, 0.6f, 0.09f, 0.7f, 0.11f, 0.7f, 0.11f, 0.6f,
+	0.09f, 0.7f, 0.09f, 0.8f, 0.11f, 0.8f, 0.11f, 0.7f,
+	0.09f, 0.8f, 0.09f, 0.90000004f, 0.11f, 0.90000004f, 0.11f, 0.8f,
+	0.09f, 0.90000004f, 0.09f, 1.0f, 0.11f, 1.0f, 0.11f, 0.90000004f,
+	0.11f, 0.0f, 0.11f, 0.1f, 0.13000001f, 0.1f, 0.13000001f, 0.0f,
+	0.11f, 0.1f, 0.11f, 0.2f, 0.13000001f, 0.2f, 0.13000001f, 0.1f,
+	0.11f, 0.2f, 0.11f, 0.3f, 0.13000001f, 0.3f, 0.13000001f, 0.2f,
+	0.11f, 0.3f, 0.11f, 0.4f, 0.13000001f, 0.4f, 0.13000001f, 0.3f,
+	0.11f, 0.4f, 0.11f, 0.5f, 0.13000001f, 0.5f, 0.13000001f, 0.4f,
+	0.11f, 0.5f, 0.11f, 0.6f, 0.13000001f, 0.6f, 0.13000001f, 0.5f,
+	0.11f, 0.6f, 0.11f, 0.7f, 0.13000001f, 0.7f, 0.13000001f, 0.6f,
+	0.11f, 0.7f, 0.11f, 0.8f, 0.13000001f, 0.8f, 0.13000001f, 0.7f,
+	0.11f, 0.8f, 0.11f, 0.90000004f, 0.13000001f, 0.90000004f, 0.13000001f, 0.8f,
+	0.11f, 0.90000004f, 0.11f, 1.0f, 0.13000001f, 1.0f, 0.13000001f, 0.90000004f,
+	0.13000001f, 0.0f, 0.13000001f, 0.1f, 0.15f, 0.1f, 0.15f, 0.0f,
+	0.13000001f, 0.1f, 0.13000001f, 0.2f, 0.15f, 0.2f, 0.15f, 0.1f,
+	0.13000001f, 0.2f, 0.13000001f, 0.3f, 0.15f, 0.3f, 0.15f, 0.2f,
+	0.13000001f, 0.3f, 0.13000001f, 0.4f, 0.15f, 0.4f, 0.15f, 0.3f,
+	0.13000001f, 0.4f, 0.13000001f, 0.5f, 0.15f, 0.5f, 0.15f, 0.4f,
+	0.13000001f, 0.5f, 0.13000001f, 0.6f, 0.15f, 0.6f, 0.15f, 0.5f,
+	0.13000001f, 0.6f, 0.13000001f, 0.7f, 0.15f, 0.7f, 0.15f, 0.6f,
+	0.13000001f, 0.7f, 0.13000001f, 0.8f, 0.15f, 0.8f, 0.15f, 0.7f,
+	0.13000001f, 0.8f, 0.13000001f, 0.90000004f, 0.15f, 0.90000004f, 0.15f, 0.8f,
+	0.13000001f, 0.90000004f, 0.13000001f, 1.0f, 0.15f, 1.0f, 0.15f, 0.90000004f,
+	0.15f, 0.0f, 0.15f, 0.1f, 0.17f, 0.1f, 0.17f, 0.0f,
+	0.15f, 0.1f, 0.15f, 0.2f, 0.17f, 0.2f, 0.17f, 0.1f,
+	0.15f, 0.2f, 0.15f, 0.3f, 0.17f, 0.3f, 0.17f, 0.2f,
+	0.15f, 0.3f, 0.15f, 0.4f, 0.17f, 0.4f, 0.17f, 0.3f,
+	0.15f, 0.4f, 0.15f, 0.5f, 0.17f, 0.5f, 0.17f, 0.4f,
+	0.15f, 0.5f, 0.15f, 0.6f, 0.17f, 0.6f, 0.17f, 0.5f,
+	0.15f, 0.6f, 0.15f, 0.7f, 0.17f, 0.7f, 0.17f, 0.6f,
+	0.15f, 0.7f, 0.15f, 0.8f, 0.17f, 0.8f, 0.17f, 0.7f,
+	0.15f, 0.8f, 0.15f, 0.90000004f, 0.17f, 0.90000004f, 0.17f, 0.8f,
+	0.15f, 0.90000004f, 0.15f, 1.0f, 0.17f, 1.0f, 0.17f, 0.90000004f,
+	0.17f, 0.0f, 0.17f, 0.1f, 0.19f, 0.1f, 0.19f, 0.0f,
+	0.17f, 0.1f, 0.17f, 0.2f, 0.19f, 0.2f, 0.19f, 0.1f,
+	0.17f, 0.2f, 0.17f, 0.3f, 0.19f, 0.3f, 0.19f, 0.2f,
+	0.17f, 0.3f, 0.17f, 0.4f, 0.19f, 0.4f, 0.19f, 0.3f,
+	0.17f, 0.4f, 0.17f, 0.5f, 0.19f, 0.5f, 0.19f, 0.4f,
+	0.17f, 0.5f, 0.17f, 0.6f, 0.19f, 0.6f, 0.19f, 0.5f,
+	0.17f, 0.6f, 0.17f, 0.7f, 0.19f, 0.7f, 0.19f, 0.6f,
+	0.17f, 0.7f, 0.17f, 0.8f, 0.19f, 0.8f, 0.19f, 0.7f,
+	0.17f, 0.8f, 0.17f, 0.90000004f, 0.19f, 0.90000004f, 0.19f, 0.8f,
+	0.17f, 0.90000004f, 0.17f, 1.0f, 0.19f, 1.0f, 0.19f, 0.90000004f,
+	0.19f, 0.0f, 0.19f, 0.1f, 0.21000001f, 0.1f, 0.21000001f, 0.0f,
+	0.19f, 0.1f, 0.19f, 0.2f, 0.21000001f, 0.2f, 0.21000001f, 0.1f,
+	0.19f, 0.2f, 0.19f, 0.3f, 0.21000001f, 0.3f, 0.21000001f, 0.2f,
+	0.19f, 0.3f, 0.19f, 0.4f, 0.21000001f, 0.4f, 0.21000001f, 0.3f,
+	0.19f, 0.4f, 0.19f, 0.5f, 0.21000001f, 0.5f, 0.21000001f, 0.4f,
+	0.19f, 0.5f, 0.19f, 0.6f, 0.21000001f, 0.6f, 0.21000001f, 0.5f,
+	0.19f, 0.6f, 0.19f, 0.7f, 0.21000001f, 0.7f, 0.21000001f, 0.6f,
+	0.19f, 0.7f, 0.19f, 0.8f, 0.21000001f, 0.8f, 0.21000001f, 0.7f,
+	0.19f, 0.8f, 0.19f, 0.90000004f, 0.21000001f, 0.90000004f, 0.21000001f, 0.8f,
+	0.19f, 0.90000004f, 0.19f, 1.0f, 0.21000001f, 1.0f, 0.21000001f, 0.90000004f,
+	0.21000001f, 0.0f, 0.21000001f, 0.1f, 0.23f, 0.1f, 0.23f, 0.0f,
+	0.21000001f, 0.1f, 0.21000001f, 0.2f, 0.23f, 0.2f, 0.23f, 0.1f,
+	0.21000001f, 0.2f, 0.21000001f, 0.3f, 0.23f, 0.3f, 0.23f, 0.2f,
+	0.21000001f, 0.3f, 0.21000001f, 0.4f, 0.23f, 0.4f, 0.23f, 0.3f,
+	0.21000001f, 0.4f, 0.21000001f, 0.5f, 0.23f, 0.5f, 0.23f, 0.4f,
+	0.21000001f, 0.5f, 0.21000001f, 0.6f, 0.23f, 0.6f, 0.23f, 0.5f,
+	0.21000001f, 0.6f, 0.21000001f, 0.7f, 0.23f, 0.7f, 0.23f, 0.6f,
+	0.21000001f, 0.7f, 0.21000001f, 0.8f, 0.23f, 0.8f, 0.23f, 0.7f,
+	0.21000001f, 0.8f, 0.21000001f, 0.90000004f, 0.23f, 0.90000004f, 0.23f, 0.8f,
+	0.21000001f, 0.90000004f, 0.21000001f, 1.0f, 0.23f, 1.0f, 0.23f, 0.90000004f,
+	0.23f, 0.0f, 0.23f, 0.1f, 0.25f, 0.1f, 0.25f, 0.0f,
+	0.23f, 0.1f, 0.23f, 0.2f, 0.25f, 0.2f, 0.25f, 0.1f,
+	0.23f, 0.2f, 0.23f, 0.3f, 0.25f, 0.3f, 0.25f, 0.2f,
+	0.23f, 0.3f, 0.23f, 0.4f, 0.25f, 0.4f, 0.25f, 0.3f,
+	0.23f, 0.4f, 0.23f, 0.5f, 0.25f, 0.5f, 0.25f, 0.4f,
+	0.23f, 0.5f, 0.23f, 0.6f, 0.25f, 0.6f, 0.25f, 0.5f,
+	0.23f, 0.6f, 0.23f, 0.7f, 0.25f, 0.7f, 0.25f, 0.6f,
+	0.23f, 0.7f, 0.23f, 0.8f, 0.25f, 0.8f, 0.25f, 0.7f,
+	0.23f, 0.8f, 0.23f, 0.90000004f, 0.25f, 0.90000004f, 0.25f, 0.8f,
+	0.23f, 0.90000004f, 0.23f, 1.0f, 0.25f, 1.0f, 0.25f, 0.90000004f,
+	0.25f, 0.0f, 0.25f, 0.1f, 0.27f, 0.1f, 0.27f, 0.0f,
+	0.25f, 0.1f, 0.25f, 0.2f, 0.27f, 0.2f, 0.27f, 0.1f,
+	0.25f, 0.2f, 0.25f, 0.3f, 0.27f, 0.3f, 0.27f, 0.2f,
+	0.25f, 0.3f, 0.25f, 0.4f, 0.27f, 0.4f, 0.27f, 0.3f,
+	0.25f, 0.4f, 0.25f, 0.5f, 0.27f, 0.5f, 0.27f, 0.4f,
+	0.25f, 0.5f, 0.25f, 0.6f, 0.27f, 0.6f, 0.27f, 0.5f,
+	0.25f, 0.6f, 0.25f, 0.7f, 0.27f, 0.7f, 0.27f, 0.6f,
+	0.25f, 0.7f, 0.25f, 0.8f, 0.27f, 0.8f, 0.27f, 0.7f,
+	0.25f, 0.8f, 0.25f, 0.90000004f, 0.27f, 0.90000004f, 0.27f, 0.8f,
+	0.25f, 0.90000004f, 0.25f, 1.0f, 0.27f, 1.0f, 0.27f, 0.90000004f,
+	0.27f, 0.0f, 0.27f, 0.1f, 0.29000002f, 0.1f, 0.29000002f, 0.0f,
+	0.27f, 0.1f, 0.27f, 0.2f, 0.29000002f, 0.2f, 0.29000002f, 0.1f,
+	0.27f, 0.2f, 0.27f, 0.3f, 0.29000002f, 0.3f, 0.29000002f, 0.2f,
+	0.27f, 0.3f, 0.27f, 0.4f, 0.29000002f, 0.4f, 0.29000002f, 0.3f,
+	0.27f, 0.4f, 0.27f, 0.5f, 0.29000002f, 0.5f, 0.29000002f, 0.4f,
+	0.27f, 0.5f, 0.27f, 0.6f, 0.29000002f, 0.6f, 0.29000002f, 0.5f,
+	0.27f, 0.6f, 0.27f, 0.7f, 0.29000002f, 0.7f, 0.29000002f, 0.6f,
+	0.27f, 0.7f, 0.27f, 0.8f, 0.29000002f, 0.8f, 0.29000002f, 0.7f,
+	0.27f, 0.8f, 0.27f, 0.90000004f, 0.29000002f, 0.90000004f, 0.29000002f, 0.8f,
+	0.27f, 0.90000004f, 0.27f, 1.0f, 0.29000002f, 1.0f, 0.29000002f, 0.90000004f,
+	0.29000002f, 0.0f, 0.29000002f, 0.1f, 0.31000003f, 0.1f, 0.31000003f, 0.0f,
+	0.29000002f, 0.1f, 0.29000002f, 0.2f, 0.31000003f, 0.2f, 0.31000003f, 0.1f,
+	0.29000002f, 0.2f, 0.29000002f, 0.3f, 0.31000003f, 0.3f, 0.31000003f, 0.2f,
+	0.29000002f, 0.3f, 0.29000002f, 0.4f, 0.31000003f, 0.4f, 0.31000003f, 0.3f,
+	0.29000002f, 0.4f, 0.29000002f, 0.5f, 0.31000003f, 0.5f, 0.31000003f, 0.4f,
+	0.29000002f, 0.5f, 0.29000002f, 0.6f, 0.31000003f, 0.6f, 0.31000003f, 0.5f,
+	0.29000002f, 0.6f, 0.29000002f, 0.7f, 0.31000003f, 0.7f, 0.31000003f, 0.6f,
+	0.29000002f, 0.7f, 0.29000002f, 0.8f, 0.31000003f, 0.8f, 0.31000003f, 0.7f,
+	0.29000002f, 0.8f, 0.29000002f, 0.90000004f, 0.31000003f, 0.90000004f, 0.31000003f, 0.8f,
+	0.29000002f, 0.90000004f, 0.29000002f, 1.0f, 0.31000003f, 1.0f, 0.31000003f, 0.90000004f,
+	0.31000003f, 0.0f, 0.31000003f, 0.1f, 0.33f, 0.1f, 0.33f, 0.0f,
+	0.31000003f, 0.1f, 0.31000003f, 0.2f, 0.33f, 0.2f, 0.33f, 0.1f,
+	0.31000003f, 0.2f, 0.31000003f, 0.3f, 0.33f, 0.3f, 0.33f, 0.2f,
+	0.31000003f, 0.3f, 0.31000003f, 0.4f, 0.33f, 0.4f, 0.33f, 0.3f,
+	0.31000003f, 0.4f, 0.31000003f, 0.5f, 0.33f, 0.5f, 0.33f, 0.4f,
+	0.31000003f, 0.5f, 0.31000003f, 0.6f, 0.33f, 0.6f, 0.33f, 0.5f,
+	0.31000003f, 0.6f, 0.31000003f, 0.7f, 0.33f, 0.7f, 0.33f, 0.6f,
+	0.31000003f, 0.7f, 0.31000003f, 0.8f, 0.33f, 0.8f, 0.33f, 0.7f,
+	0.31000003f, 0.8f, 0.31000003f, 0.90000004f, 0.33f, 0.90000004f, 0.33f, 0.8f,
+	0.31000003f, 0.90000004f, 0.31000003f, 1.0f, 0.33f, 1.0f, 0.33f, 0.90000004f,
+	0.33f, 0.0f, 0.33f, 0.1f, 0.35000002f, 0.1f, 0.35000002f, 0.0f,
+	0.33f, 0.1f, 0.33f, 0.2f, 0.35000002f, 0.2f, 0.35000002f, 0.1f,
+	0.33f, 0.2f, 0.33f, 0.3f, 0.35000002f, 0.3f, 0.35000002f, 0.2f,
+	0.33f, 0.3f, 0.33f, 0.4f, 0.35000002f, 0.4f, 0.35000002f, 0.3f,
+	0.33f, 0.4f, 0.33f, 0.5f, 0.35000002f, 0.5f, 0.35000002f, 0.4f,
+	0.33f, 0.5f, 0.33f, 0.6f, 0.35000002f, 0.6f, 0.35000002f, 0.5f,
+	0.33f, 0.6f, 0.33f, 0.7f, 0.35000002f, 0.7f, 0.35000002f, 0.6f,
+	0.33f, 0.7f, 0.33f, 0.8f, 0.35000002f, 0.8f, 0.35000002f, 0.7f,
+	0.33f, 0.8f, 0.33f, 0.90000004f, 0.35000002f, 0.90000004f, 0.35000002f, 0.8f,
+	0.33f, 0.90000004f, 0.33f, 1.0f, 0.35000002f, 1.0f, 0.35000002f, 0.90000004f,
+	0.35000002f, 0.0f, 0.35000002f, 0.1f, 0.37000003f, 0.1f, 0.37000003f, 0.0f,
+	0.35000002f, 0.1f, 0.35000002f, 0.2f, 0.37000003f, 0.2f, 0.37000003f, 0.1f,
+	0.35000002f, 0.2f, 0.35000002f, 0.3f, 0.37000003f, 0.3f, 0.37000003f, 0.2f,
+	0.35000002f, 0.3f, 0.35000002f, 0.4f, 0.37000003f, 0.4f, 0.37000003f, 0.3f,
+	0.35000002f, 0.4f, 0.35000002f, 0.5f, 0.37000003f, 0.5f, 0.37000003f, 0.4f,
+	0.35000002f, 0.5f, 0.35000002f, 0.6f, 0.37000003f, 0.6f, 0.37000003f, 0.5f,
+	0.35000002f, 0.6f, 0.35000002f, 0.7f, 0.37000003f, 0.7f, 0.37000003f, 0.6f,
+	0.35000002f, 0.7f, 0.35000002f, 0.8f, 0.37000003f, 0.8f, 0.37000003f, 0.7f,
+	0.35000002f, 0.8f, 0.35000002f, 0.90000004f, 0.37000003f, 0.90000004f, 0.37000003f, 0.8f,
+	0.35000002f, 0.90000004f, 0.35000002f, 1.0f, 0.37000003f, 1.0f, 0.37000003f, 0.90000004f,
+	0.37000003f, 0.0f, 0.37000003f, 0.1f, 0.39000002f, 0.1f, 0.39000002f, 0.0f,
+	0.37000003f, 0.1f, 0.37000003f, 0.2f, 0.39000002f, 0.2f, 0.39000002f, 0.1f,
+	0.37000003f, 0.2f, 0.37000003f, 0.3f, 0.39000002f, 0.3f, 0.39000002f, 0.2f,
+	0.37000003f, 0.3f, 0.37000003f, 0.4f, 0.39000002f, 0.4f, 0.39000002f, 0.3f,
+	0.37000003f, 0.4f, 0.37000003f, 0.5f, 0.39000002f, 0.5f, 0.39000002f, 0.4f,
+	0.37000003f, 0.5f, 0.37000003f, 0.6f, 0.39000002f, 0.6f, 0.39000002f, 0.5f,
+	0.37000003f, 0.6f, 0.37000003f, 0.7f, 0.39000002f, 0.7f, 0.39000002f, 0.6f,
+	0.37000003f, 0.7f, 0.37000003f, 0.8f, 0.39000002f, 0.8f, 0.39000002f, 0.7f,
+	0.37000003f, 0.8f, 0.37000003f, 0.90000004f, 0.39000002f, 0.90000004f, 0.39000002f, 0.8f,
+	0.37000003f, 0.90000004f, 0.37000003f, 1.0f, 0.39000002f, 1.0f, 0.39000002f, 0.90000004f,
+	0.39000002f, 0.0f, 0.39000002f, 0.1f, 0.41000003f, 0.1f, 0.41000003f, 0.0f,
+	0.39000002f, 0.1f, 0.39000002f, 0.2f, 0.41000003f, 0.2f, 0.41000003f, 0.1f,
+	0.39000002f, 0.2f, 0.39000002f, 0.3f, 0.41000003f, 0.3f, 0.41000003f, 0.2f,
+	0.39000002f, 0.3f, 0.39000002f, 0.4f, 0.41000003f, 0.4f, 0.41000003f, 0.3f,
+	0.39000002f, 0.4f, 0.39000002f, 0.5f, 0.41000003f, 0.5f, 0.41000003f, 0.4f,
+	0.39000002f, 0.5f, 0.39000002f, 0.6f, 0.41000003f, 0.6f, 0.41000003f, 0.5f,
+	0.39000002f, 0.6f, 0.39000002f, 0.7f, 0.41000003f, 0.7f, 0.41000003f, 0.6f,
+	0.39000002f, 0.7f, 0.39000002f, 0.8f, 0.41000003f, 0.8f, 0.41000003f, 0.7f,
+	0.39000002f, 0.8f, 0.39000002f, 0.90000004f, 0.41000003f, 0.90000004f, 0.41000003f, 0.8f,
+	0.39000002f, 0.90000004f, 0.39000002f, 1.0f, 0.41000003f, 1.0f, 0.41000003f, 0.90000004f,
+	0.41000003f, 0.0f, 0.41000003f, 0.1f, 0.43f, 0.1f, 0.43f, 0.0f,
+	0.41000003f, 0.1f, 0.41000003f, 0.2f, 0.43f, 0.2f, 0.43f, 0.1f,
+	0.41000003f, 0.2f, 0.41000003f, 0.3f, 0.43f, 0.3f, 0.43f, 0.2f,
+	0.41000003f, 0.3f, 0.41000003f, 0.4f, 0.43f, 0.4f, 0.43f, 0.3f,
+	0.41000003f, 0.4f, 0.41000003f, 0.5f, 0.43f, 0.5f, 0.43f, 0.4f,
+	0.41000003f, 0.5f, 0.41000003f, 0.6f, 0.43f, 0.6f, 0.43f, 0.5f,
+	0.41000003f, 0.6f, 0.41000003f, 0.7f, 0.43f, 0.7f, 0.43f, 0.6f,
+	0.41000003f, 0.7f, 0.41000003f, 0.8f, 0.43f, 0.8f, 0.43f, 0.7f,
+	0.41000003f, 0.8f, 0.41000003f, 0.90000004f, 0.43f, 0.90000004f, 0.43f, 0.8f,
+	0.41000003f, 0.90000004f, 0.41000003f, 1.0f, 0.43f, 1.0f, 0.43f, 0.90000004f,
+	0.43f, 0.0f, 0.43f, 0.1f, 0.45000002f, 0.1f, 0.45000002f, 0.0f,
+	0.43f, 0.1f, 0.43f, 0.2f, 0.45000002f, 0.2f, 0.45000002f, 0.1f,
+	0.43f, 0.2f, 0.43f, 0.3f, 0.45000002f, 0.3f, 0.45000002f, 0.2f,
+	0.43f, 0.3f, 0.43f, 0.4f, 0.45000002f, 0.4f, 0.45000002f, 0.3f,
+	0.43f, 0.4f, 0.43f, 0.5f, 0.45000002f, 0.5f, 0.45000002f, 0.4f,
+	0.43f, 0.5f, 0.43f, 0.6f, 0.45000002f, 0.6f, 0.45000002f, 0.5f,
+	0.43f, 0.6f, 0.43f, 0.7f, 0.45000002f, 0.7f, 0.45000002f, 0.6f,
+	0.43f, 0.7f, 0.43f, 0.8f, 0.45000002f, 0.8f, 0.45000002f, 0.7f,
+	0.43f, 0.8f, 0.43f, 0.90000004f, 0.45000002f, 0.90000004f, 0.45000002f, 0.8f,
+	0.43f, 0.90000004f, 0.43f, 1.0f, 0.45000002f, 1.0f, 0.45000002f, 0.90000004f,
+	0.05f, 0.0f, 0.05f, 0.1f, 0.07f, 0.1f, 0.07f, 0.0f,
+	0.05f, 0.1f, 0.05f, 0.2f, 0.07f, 0.2f, 0.07f, 0.1f,
+	0.05f, 0.2f, 0.05f, 0.3f, 0.07f, 0.3f, 0.07f, 0.2f,
+	0.05f, 0.3f, 0.05f, 0.4f, 0.07f, 0.4f, 0.07f, 0.3f,
+	0.05f, 0.4f, 0.05f, 0.5f, 0.07f, 0.5f, 0.07f, 0.4f,
+	0.05f, 0.5f, 0.05f, 0.6f, 0.07f, 0.6f, 0.07f, 0.5f,
+	0.05f, 0.6f, 0.05f, 0.7f, 0.07f, 0.7f, 0.07f, 0.6f,
+	0.05f, 0.7f, 0.05f, 0.8f, 0.07f, 0.8f, 0.07f, 0.7f,
+	0.05f, 0.8f, 0.05f, 0.90000004f, 0.07f, 0.90000004f, 0.07f, 0.8f,
+	0.05f, 0.90000004f, 0.05f, 1.0f, 0.07f, 1.0f, 0.07f, 0.90000004f,
+	0.07f, 0.0f, 0.07f, 0.1f, 0.09f, 0.1f, 0.09f, 0.0f,
+	0.07f, 0.1f, 0.07f, 0.2f, 0.09f, 0.2f, 0.09f, 0.1f,
+	0.07f, 0.2f, 0.07f, 0.3f, 0.09f, 0.3f, 0.09f, 0.2f,
+	0.07f, 0.3f, 0.07f, 0.4f, 0.09f, 0.4f, 0.09f, 0.3f,
+	0.07f, 0.4f, 0.07f, 0.5f, 0.09f, 0.5f, 0.09f, 0.4f,
+	0.07f, 0.5f, 0.07f, 0.6f, 0.09f, 0.6f, 0.09f, 0.5f,
+	0.07f, 0.6f, 0.07f, 0.7f, 0.09f, 0.7f, 0.09f, 0.6f,
+	0.07f, 0.7f, 0.07f, 0.8f, 0.09f, 0.8f, 0.09f, 0.7f,
+	0.07f, 0.8f, 0.07f, 0.90000004f, 0.09f, 0.90000004f, 0.09f, 0.8f,
+	0.07f, 0.90000004f, 0.07f, 1.0f, 0.09f, 1.0f, 0.09f, 0.90000004f,
+	0.09f, 0.0f, 0.09f, 0.1f, 0.11f, 0.1f, 0.11f, 0.0f,
+	0.09f, 0.1f, 0.09f, 0.2f, 0.11f, 0.2f, 0.11f, 0.1f,
+	0.09f, 0.2f, 0.09f, 0.3f, 0.11f, 0.3f, 0.11f, 0.2f,
+	0.09f, 0.3f, 0.09f, 0.4f, 0.11f, 0.4f, 0.11f, 0.3f,
+	0.09f, 0.4f, 0.09f, 0.5f, 0.11f, 0.5f, 0.11f, 0.4f,
+	0.09f, 0.5f, 0.09f, 0.6f, 0.11f, 0.6f, 0.11f, 0.5f,
+	0.09f, 0.6f, 0.09f, 0.7f, 0.11f, 0.7f, 0.11f, 0.6f,
+	0.09f, 0.7f, 0.09f, 0.8f, 0.11f, 0.8f, 0.11f, 0.7f,
+	0.09f, 0.8f, 0.09f, 0.90000004f, 0.11f, 0.90000004f, 0.11f, 0.8f,
+	0.09f, 0.90000004f, 0.09f, 1.0f, 0.11f, 1.0f, 0.11f, 0.90000004f,
+	0.11f, 0.0f, 0.11f, 0.1f, 0.13000001f, 0.1f, 0.13000001f, 0.0f,
+	0.11f, 0.1f, 0.11f, 0.2f, 0.13000001f, 0.2f, 0.13000001f, 0.1f,
+	0.11f, 0.2f, 0.11f, 0.3f, 0.13000001f, 0.3f, 0.13000001f, 0.2f,
+	0.11f, 0.3f, 0.11f, 0.4f, 0.13000001f, 0.4f, 0.13000001f, 0.3f,
+	0.11f, 0.4f, 0.11f, 0.5f, 0.13000001f, 0.5f, 0.13000001f, 0.4f,
+	0.11f, 0.5f, 0.11f, 0.6f, 0.13000001f, 0.6f, 0.13000001f, 0.5f,
+	0.11f, 0.6f, 0.11f, 0.7f, 0.13000001f, 0.7f, 0.13000001f, 0.6f,
+	0.11f, 0.7f, 0.11f, 0.8f, 0.13000001f, 0.8f, 0.13000001f, 0.7f,
+	0.11f, 0.8f, 0.11f, 0.90000004f, 0.13000001f, 0.90000004f, 0.13000001f, 0.8f,
+	0.11f, 0.90000004f, 0.11f, 1.0f, 0.13000001f, 1.0f, 0.13000001f, 0.90000004f,
+	0.13000001f, 0.0f, 0.13000001f, 0.1f, 0.15f, 0.1f, 0.15f, 0.0f,
+	0.13000001f, 0.1f, 0.13000001f, 0.2f, 0.15f, 0.2f, 0.15f, 0.1f,
+	0.13000001f, 0.2f, 0.13000001f, 0.3f, 0.15f, 0.3f, 0.15f, 0.2f,
+	0.13000001f, 0.3f, 0.13000001f, 0.4f, 0.15f, 0.4f, 0.15f, 0.3f,
+	0.13000001f, 0.4f, 0.13000001f, 0.5f, 0.15f, 0.5f, 0.15f, 0.4f,
+	0.13000001f, 0.5f, 0.13000001f, 0.6f, 0.15f, 0.6f, 0.15f, 0.5f,
+	0.13000001f, 0.6f, 0.13000001f, 0.7f, 0.15f, 0.7f, 0.15f, 0.6f,
+	0.13000001f, 0.7f, 0.13000001f, 0.8f, 0.15f, 0.8f, 0.15f, 0.7f,
+	0.13000001f, 0.8f, 0.13000001f, 0.90000004f, 0.15f, 0.90000004f, 0.15f, 0.8f,
+	0.13000001f, 0.90000004f, 0.13000001f, 1.0f, 0.15f, 1.0f, 0.15f, 0.90000004f,
+	0.15f, 0.0f, 0.15f, 0.1f, 0.17f, 0.1f, 0.17f, 0.0f,
+	0.15f, 0.1f, 0.15f, 0.2f, 0.17f, 0.2f, 0.17f, 0.1f,
+	0.15f, 0.2f, 0.15f, 0.3f, 0.17f, 0.3f, 0.17f, 0.2f,
+	0.15f, 0.3f, 0.15f, 0.4f, 0.17f, 0.4f, 0.17f, 0.3f,
+	0.15f, 0.4f, 0.15f, 0.5f, 0.17f, 0.5f, 0.17f, 0.4f,
+	0.15f, 0.5f, 0.15f, 0.6f, 0.17f, 0.6f, 0.17f, 0.5f,
+	0.15f, 0.6f, 0.15f, 0.7f, 0.17f, 0.7f, 0.17f, 0.6f,
+	0.15f, 0.7f, 0.15f, 0.8f, 0.17f, 0.8f, 0.17f, 0.7f,
+	0.15f, 0.8f, 0.15f, 0.90000004f, 0.17f, 0.90000004f, 0.17f, 0.8f,
+	0.15f, 0.90000004f, 0.15f, 1.0f, 0.17f, 1.0f, 0.17f, 0.90000004f,
+	0.17f, 0.0f, 0.17f, 0.1f, 0.19f, 0.1f, 0.19f, 0.0f,
+	0.17f, 0.1f, 0.17f, 0.2f, 0.19f, 0.2f, 0.19f, 0.1f,
+	0.17f, 0.2f, 0.17f, 0.3f, 0.19f, 0.3f, 0.19f, 0.2f,
+	0.17f, 0.3f, 0.17f, 0.4f, 0.19f, 0.4f, 0.19f, 0.3f,
+	0.17f, 0.4f, 0.17f, 0.5f, 0.19f, 0.5f, 0.19f, 0.4f,
+	0.17f, 0.5f, 0.17f, 0.6f, 0.19f, 0.6f, 0.19f, 0.5f,
+	0.17f, 0.6f, 0.17f, 0.7f, 0.19f, 0.7f, 0.19f, 0.6f,
+	0.17f, 0.7f, 0.17f, 0.8f, 0.19f, 0.8f, 0.19f, 0.7f,
+	0.17f, 0.8f, 0.17f, 0.90000004f, 0.19f, 0.90000004f, 0.19f, 0.8f,
+	0.17f, 0.90000004f, 0.17f, 1.0f, 0.19f, 1.0f, 0.19f, 0.90000004f,
+	0.19f, 0.0f, 0.19f, 0.1f, 0.21000001f, 0.1f, 0.21000001f, 0.0f,
+	0.19f, 0.1f, 0.19f, 0.2f, 0.21000001f, 0.2f, 0.21000001f, 0.1f,
+	0.19f, 0.2f, 0.19f, 0.3f, 0.21000001f, 0.3f, 0.21000001f, 0.2f,
+	0.19f, 0.3f, 0.19f, 0.4f, 0.21000001f, 0.4f, 0.21000001f, 0.3f,
+	0.19f, 0.4f, 0.19f, 0.5f, 0.21000001f, 0.5f, 0.21000001f, 0.4f,
+	0.19f, 0.5f, 0.19f, 0.6f, 0.21000001f, 0.6f, 0.21000001f, 0.5f,
+	0.19f, 0.6f, 0.19f, 0.7f, 0.21000001f, 0.7f, 0.21000001f, 0.6f,
+	0.19f, 0.7f, 0.19f, 0.8f, 0.21000001f, 0.8f, 0.21000001f, 0.7f,
+	0.19f, 0.8f, 0.19f, 0.90000004f, 0.21000001f, 0.90000004f, 0.21000001f, 0.8f,
+	0.19f, 0.90000004f, 0.19f, 1.0f, 0.21000001f, 1.0f, 0.21000001f, 0.90000004f,
+	0.21000001f, 0.0f, 0.21000001f, 0.1f, 0.23f, 0.1f, 0.23f, 0.0f,
+	0.21000001f, 0.1f, 0.21000001f, 0.2f, 0.23f, 0.2f, 0.23f, 0.1f,
+	0.21000001f, 0.2f, 0.21000001f, 0.3f, 0.23f, 0.3f, 0.23f, 0.2f,
+	0.21000001f, 0.3f, 0.21000001f, 0.4f, 0.23f, 0.4f, 0.23f, 0.3f,
+	0.21000001f, 0.4f, 0.21000001f, 0.5f, 0.23f, 0.5f, 0.23f, 0.4f,
+	0.21000001f, 0.5f, 0.21000001f, 0.6f, 0.23f, 0.6f, 0.23f, 0.5f,
+	0.21000001f, 0.6f, 0.21000001f, 0.7f, 0.23f, 0.7f, 0.23f, 0.6f,
+	0.21000001f, 0.7f, 0.21000001f, 0.8f, 0.23f, 0.8f, 0.23f, 0.7f,
+	0.21000001f, 0.8f, 0.21000001f, 0.90000004f, 0.23f, 0.90000004f, 0.23f, 0.8f,
+	0.21000001f, 0.90000004f, 0.21000001f, 1.0f, 0.23f, 1.0f, 0.23f, 0.90000004f,
+	0.23f, 0.0f, 0.23f, 0.1f, 0.25f, 0.1f, 0.25f, 0.0f,
+	0.23f, 0.1f, 0.23f, 0.2f, 0.25f, 0.2f, 0.25f, 0.1f,
+	0.23f, 0.2f, 0.23f, 0.3f, 0.25f, 0.3f, 0.25f, 0.2f,
+	0.23f, 0.3f, 0.23f, 0.4f, 0.25f, 0.4f, 0.25f, 0.3f,
+	0.23f, 0.4f, 0.23f, 0.5f, 0.25f, 0.5f, 0.25f, 0.4f,
+	0.23f, 0.5f, 0.23f, 0.6f, 0.25f, 0.6f, 0.25f, 0.5f,
+	0.23f, 0.6f, 0.23f, 0.7f, 0.25f, 0.7f, 0.25f, 0.6f,
+	0.23f, 0.7f, 0.23f, 0.8f, 0.25f, 0.8f, 0.25f, 0.7f,
+	0.23f, 0.8f, 0.23f, 0.90000004f, 0.25f, 0.90000004f, 0.25f, 0.8f,
+	0.23f, 0.90000004f, 0.23f, 1.0f, 0.25f, 1.0f, 0.25f, 0.90000004f,
+	0.25f, 0.0f, 0.25f, 0.1f, 0.27f, 0.1f, 0.27f, 0.0f,
+	0.25f, 0.1f, 0.25f, 0.2f, 0.27f, 0.2f, 0.27f, 0.1f,
+	0.25f, 0.2f, 0.25f, 0.3f, 0.27f, 0.3f, 0.27f, 0.2f,
+	0.25f, 0.3f, 0.25f, 0.4f, 0.27f, 0.4f, 0.27f, 0.3f,
+	0.25f, 0.4f, 0.25f, 0.5f, 0.27f, 0.5f, 0.27f, 0.4f,
+	0.25f, 0.5f, 0.25f, 0.6f, 0.27f, 0.6f, 0.27f, 0.5f,
+	0.25f, 0.6f, 0.25f, 0.7f, 0.27f, 0.7f, 0.27f, 0.6f,
+	0.25f, 0.7f, 0.25f, 0.8f, 0.27f, 0.8f, 0.27f, 0.7f,
+	0.25f, 0.8f, 0.25f, 0.90000004f, 0.27f, 0.90000004f, 0.27f, 0.8f,
+	0.25f, 0.90000004f, 0.25f, 1.0f, 0.27f, 1.0f, 0.27f, 0.90000004f,
+	0.27f, 0.0f, 0.27f, 0.1f, 0.29000002f, 0.1f, 0.29000002f, 0.0f,
+	0.27f, 0.1f, 0.27f, 0.2f, 0.29000002f, 0.2f, 0.29000002f, 0.1f,
+	0.27f, 0.2f, 0.27f, 0.3f, 0.29000002f, 0.3f, 0.29000002f, 0.2f,
+	0.27f, 0.3f, 0.27f, 0.4f, 0.29000002f, 0.4f, 0.29000002f, 0.3f,
+	0.27f, 0.4f, 0.27f, 0.5f, 0.29000002f, 0.5f, 0.29000002f, 0.4f,
+	0.27f, 0.5f, 0.27f, 0.6f, 0.29000002f, 0.6f, 0.29000002f, 0.5f,
+	0.27f, 0.6f, 0.27f, 0.7f, 0.29000002f, 0.7f, 0.29000002f, 0.6f,
+	0.27f, 0.7f, 0.27f, 0.8f, 0.29000002f, 0.8f, 0.29000002f, 0.7f,
+	0.27f, 0.8f, 0.27f, 0.90000004f, 0.29000002f, 0.90000004f, 0.29000002f, 0.8f,
+	0.27f, 0.90000004f, 0.27f, 1.0f, 0.29000002f, 1.0f, 0.29000002f, 0.90000004f,
+	0.29000002f, 0.0f, 0.29000002f, 0.1f, 0.31000003f, 0.1f, 0.31000003f, 0.0f,
+	0.29000002f, 0.1f, 0.29000002f, 0.2f, 0.31000003f, 0.2f, 0.31000003f, 0.1f,
+	0.29000002f, 0.2f, 0.29000002f, 0.3f, 0.31000003f, 0.3f, 0.31000003f, 0.2f,
+	0.29000002f, 0.3f, 0.29000002f, 0.4f, 0.31000003f, 0.4f, 0.31000003f, 0.3f,
+	0.29000002f, 0.4f, 0.29000002f, 0.5f, 0.31000003f, 0.5f, 0.31000003f, 0.4f,
+	0.29000002f, 0.5f, 0.29000002f, 0.6f, 0.31000003f, 0.6f, 0.31000003f, 0.5f,
+	0.29000002f, 0.6f, 0.29000002f, 0.7f, 0.31000003f, 0.7f, 0.31000003f, 0.6f,
+	0.29000002f, 0.7f, 0.29000002f, 0.8f, 0.31000003f, 0.8f, 0.31000003f, 0.7f,
+	0.29000002f, 0.8f, 0.29000002f, 0.90000004f, 0.31000003f, 0.90000004f, 0.31000003f, 0.8f,
+	0.29000002f, 0.90000004f, 0.29000002f, 1.0f, 0.31000003f, 1.0f, 0.31000003f, 0.90000004f,
+	0.31000003f, 0.0f, 0.31000003f, 0.1f, 0.33f, 0.1f, 0.33f, 0.0f,
+	0.31000003f, 0.1f, 0.31000003f, 0.2f, 0.33f, 0.2f, 0.33f, 0.1f,
+	0.31000003f, 0.2f, 0.31000003f, 0.3f, 0.33f, 0.3f, 0.33f, 0.2f,
+	0.31000003f, 0.3f, 0.31000003f, 0.4f, 0.33f, 0.4f, 0.33f, 0.3f,
+	0.31000003f, 0.4f, 0.31000003f, 0.5f, 0.33f, 0.5f, 0.33f, 0.4f,
+	0.31000003f, 0.5f, 0.31000003f, 0.6f, 0.33f, 0.6f, 0.33f, 0.5f,
+	0.31000003f, 0.6f, 0.31000003f, 0.7f, 0.33f, 0.7f, 0.33f, 0.6f,
+	0.31000003f, 0.7f, 0.31000003f, 0.8f, 0.33f, 0.8f, 0.33f, 0.7f,
+	0.31000003f, 0.8f, 0.31000003f, 0.90000004f, 0.33f, 0.90000004f, 0.33f, 0.8f,
+	0.31000003f, 0.90000004f, 0.31000003f, 1.0f, 0.33f, 1.0f, 0.33f, 0.90000004f,
+	0.33f, 0.0f, 0.33f, 0.1f, 0.35000002f, 0.1f, 0.35000002f, 0.0f,
+	0.33f, 0.1f, 0.33f, 0.2f, 0.35000002f, 0.2f, 0.35000002f, 0.1f,
+	0.33f, 0.2f, 0.33f, 0.3f, 0.35000002f, 0.3f, 0.35000002f, 0.2f,
+	0.33f, 0.3f, 0.33f, 0.4f, 0.35000002f, 0.4f, 0.35000002f, 0.3f,
+	0.33f, 0.4f, 0.33f, 0.5f, 0.35000002f, 0.5f, 0.35000002f, 0.4f,
+	0.33f, 0.5f, 0.33f, 0.6f, 0.35000002f, 0.6f, 0.35000002f, 0.5f,
+	0.33f, 0.6f, 0.33f, 0.7f, 0.35000002f, 0.7f, 0.35000002f, 0.6f,
+	0.33f, 0.7f, 0.33f, 0.8f, 0.35000002f, 0.8f, 0.35000002f, 0.7f,
+	0.33f, 0.8f, 0.33f, 0.90000004f, 0.35000002f, 0.90000004f, 0.35000002f, 0.8f,
+	0.33f, 0.90000004f, 0.33f, 1.0f, 0.35000002f, 1.0f, 0.35000002f, 0.90000004f,
+	0.35000002f, 0.0f, 0.35000002f, 0.1f, 0.37000003f, 0.1f, 0.37000003f, 0.0f,
+	0.35000002f, 0.1f, 0.35000002f, 0.2f, 0.37000003f, 0.2f, 0.37000003f, 0.1f,
+	0.35000002f, 0.2f, 0.35000002f, 0.3f, 0.37000003f, 0.3f, 0.37000003f, 0.2f,
+	0.35000002f, 0.3f, 0.35000002f, 0.4f, 0.37000003f, 0.4f, 0.37000003f, 0.3f,
+	0.35000002f, 0.4f, 0.35000002f, 0.5f, 0.37000003f, 0.5f, 0.37000003f, 0.4f,
+	0.35000002f, 0.5f, 0.35000002f, 0.6f, 0.37000003f, 0.6f, 0.37000003f, 0.5f,
+	0.35000002f, 0.6f, 0.35000002f, 0.7f, 0.37000003f, 0.7f, 0.37000003f, 0.6f,
+	0.35000002f, 0.7f, 0.35000002f, 0.8f, 0.37000003f, 0.8f, 0.37000003f, 0.7f,
+	0.35000002f, 0.8f, 0.35000002f, 0.90000004f, 0.37000003f, 0.90000004f, 0.37000003f, 0.8f,
+	0.35000002f, 0.90000004f, 0.35000002f, 1.0f, 0.37000003f, 1.0f, 0.37000003f, 0.90000004f,
+	0.37000003f, 0.0f, 0.37000003f, 0.1f, 0.39000002f, 0.1f, 0.39000002f, 0.0f,
+	0.37000003f, 0.1f, 0.37000003f, 0.2f, 0.39000002f, 0.2f, 0.39000002f, 0.1f,
+	0.37000003f, 0.2f, 0.37000003f, 0.3f, 0.39000002f, 0.3f, 0.39000002f, 0.2f,
+	0.37000003f, 0.3f, 0.37000003f, 0.4f, 0.39000002f, 0.4f, 0.39000002f, 0.3f,
+	0.37000003f, 0.4f, 0.37000003f, 0.5f, 0.39000002f, 0.5f, 0.39000002f, 0.4f,
+	0.37000003f, 0.5f, 0.37000003f, 0.6f, 0.39000002f, 0.6f, 0.39000002f, 0.5f,
+	0.37000003f, 0.6f, 0.37000003f, 0.7f, 0.39000002f, 0.7f, 0.39000002f, 0.6f,
+	0.37000003f, 0.7f, 0.37000003f, 0.8f, 0.39000002f, 0.8f, 0.39000002f, 0.7f,
+	0.37000003f, 0.8f, 0.37000003f, 0.90000004f, 0.39000002f, 0.90000004f, 0.39000002f, 0.8f,
+	0.37000003f, 0.90000004f, 0.37000003f, 1.0f, 0.39000002f, 1.0f, 0.39000002f, 0.90000004f,
+	0.39000002f, 0.0f, 0.39000002f, 0.1f, 0.41000003f, 0.1f, 0.41000003f, 0.0f,
+	0.39000002f, 0.1f, 0.39000002f, 0.2f, 0.41000003f, 0.2f, 0.41000003f, 0.1f,
+	0.39000002f, 0.2f, 0.39000002f, 0.3f, 0.41000003f, 0.3f, 0.41000003f, 0.2f,
+	0.39000002f, 0.3f, 0.39000002f, 0.4f, 0.41000003f, 0.4f, 0.41000003f, 0.3f,
+	0.39000002f, 0.4f, 0.39000002f, 0.5f, 0.41000003f, 0.5f, 0.41000003f, 0.4f,
+	0.39000002f, 0.5f, 0.39000002f, 0.6f, 0.41000003f, 0.6f, 0.41000003f, 0.5f,
+	0.39000002f, 0.6f, 0.39000002f, 0.7f, 0.41000003f, 0.7f, 0.41000003f, 0.6f,
+	0.39000002f, 0.7f, 0.39000002f, 0.8f, 0.41000003f, 0.8f, 0.41000003f, 0.7f,
+	0.39000002f, 0.8f, 0.39000002f, 0.90000004f, 0.41000003f, 0.90000004f, 0.41000003f, 0.8f,
+	0.39000002f, 0.90000004f, 0.39000002f, 1.0f, 0.41000003f, 1.0f, 0.41000003f, 0.90000004f,
+	0.41000003f, 0.0f, 0.41000003f, 0.1f, 0.43f, 0.1f, 0.43f, 0.0f,
+	0.41000003f, 0.1f, 0.41000003f, 0.2f, 0.43f, 0.2f, 0.43f, 0.1f,
+	0.41000003f, 0.2f, 0.41000003f, 0.3f, 0.43f, 0.3f, 0.43f, 0.2f,
+	0.41000003f, 0.3f, 0.41000003f, 0.4f, 0.43f, 0.4f, 0.43f, 0.3f,
+	0.41000003f, 0.4f, 0.41000003f, 0.5f, 0.43f, 0.5f, 0.43f, 0.4f,
+	0.41000003f, 0.5f, 0.41000003f, 0.6f, 0.43f, 0.6f, 0.43f, 0.5f,
+	0.41000003f, 0.6f, 0.41000003f, 0.7f, 0.43f, 0.7f, 0.43f, 0.6f,
+	0.41000003f, 0.7f, 0.41000003f, 0.8f, 0.43f, 0.8f, 0.43f, 0.7f,
+	0.41000003f, 0.8f, 0.41000003f, 0.90000004f, 0.43f, 0.90000004f, 0.43f, 0.8f,
+	0.41000003f, 0.90000004f, 0.41000003f, 1.0f, 0.43f, 1.0f, 0.43f, 0.90000004f,
+	0.43f, 0.0f, 0.43f, 0.1f, 0.45000002f, 0.1f, 0.45000002f, 0.0f,
+	0.43f, 0.1f, 0.43f, 0.2f, 0.45000002f, 0.2f, 0.45000002f, 0.1f,
+	0.43f, 0.2f, 0.43f, 0.3f, 0.45000002f, 0.3f, 0.45000002f, 0.2f,
+	0.43f, 0.3f, 0.43f, 0.4f, 0.45000002f, 0.4f, 0.45000002f, 0.3f,
+	0.43f, 0.4f, 0.43f, 0.5f, 0.45000002f, 0.5f, 0.45000002f, 0.4f,
+	0.43f, 0.5f, 0.43f, 0.6f, 0.45000002f, 0.6f, 0.45000002f, 0.5f,
+	0.43f, 0.6f, 0.43f, 0.7f, 0.45000002f, 0.7f, 0.45000002f, 0.6f,
+	0.43f, 0.7f, 0.43f, 0.8f, 0.45000002f, 0.8f, 0.45000002f, 0.7f,
+	0.43f, 0.8f, 0.43f, 0.90000004f, 0.45000002f, 0.90000004f, 0.45000002f, 0.8f,
+	0.43f, 0.90000004f, 0.43f, 1.0f, 0.45000002f, 1.0f, 0.45000002f, 0.90000004f,
+	0.55f, 0.0f, 0.55f, 0.1f, 0.57f, 0.1f, 0.57f, 0.0f,
+	0.55f, 0.1f, 0.55f, 0.2f, 0.57f, 0.2f, 0.57f, 0.1f,
+	0.55f, 0.2f, 0.55f, 0.3f, 0.57f, 0.3f, 0.57f, 0.2f,
+	0.55f, 0.3f, 0.55f, 0.4f, 0.57f, 0.4f, 0.57f, 0.3f,
+	0.55f, 0.4f, 0.55f, 0.5f, 0.57f, 0.5f, 0.57f, 0.4f,
+	0.55f, 0.5f, 0.55f, 0.6f, 0.57f, 0.6f, 0.57f, 0.5f,
+	0.55f, 0.6f, 0.55f, 0.7f, 0.57f, 0.7f, 0.57f, 0.6f,
+	0.55f, 0.7f, 0.55f, 0.8f, 0.57f, 0.8f, 0.57f, 0.7f,
+	0.55f, 0.8f, 0.55f, 0.90000004f, 0.57f, 0.90000004f, 0.57f, 0.8f,
+	0.55f, 0.90000004f, 0.55f, 1.0f, 0.57f, 1.0f, 0.57f, 0.90000004f,
+	0.57f, 0.0f, 0.57f, 0.1f, 0.59000003f, 0.1f, 0.59000003f, 0.0f,
+	0.57f, 0.1f, 0.57f, 0.2f, 0.59000003f, 0.2f, 0.59000003f, 0.1f,
+	0.57f, 0.2f, 0.57f, 0.3f, 0.59000003f, 0.3f, 0.59000003f, 0.2f,
+	0.57f, 0.3f, 0.57f, 0.4f, 0.59000003f, 0.4f, 0.59000003f, 0.3f,
+	0.57f, 0.4f, 0.57f, 0.5f, 0.59000003f, 0.5f, 0.59000003f, 0.4f,
+	0.57f, 0.5f, 0.57f, 0.6f, 0.59000003f, 0.6f, 0.59000003f, 0.5f,
+	0.57f, 0.6f, 0.57f, 0.7f, 0.59000003f, 0.7f, 0.59000003f, 0.6f,
+	0.57f, 0.7f, 0.57f, 0.8f, 0.59000003f, 0.8f, 0.59000003f, 0.7f,
+	0.57f, 0.8f, 0.57f, 0.90000004f, 0.59000003f, 0.90000004f, 0.59000003f, 0.8f,
+	0.57f, 0.90000004f, 0.57f, 1.0f, 0.59000003f, 1.0f, 0.59000003f, 0.90000004f,
+	0.59000003f, 0.0f, 0.59000003f, 0.1f, 0.61f, 0.1f, 0.61f, 0.0f,
+	0.59000003f, 0.1f, 0.59000003f, 0.2f, 0.61f, 0.2f, 0.61f, 0.1f,
+	0.59000003f, 0.2f, 0.59000003f, 0.3f, 0.61f, 0.3f, 0.61f, 0.2f,
+	0.59000003f, 0.3f, 0.59000003f, 0.4f, 0.61f, 0.4f, 0.61f, 0.3f,
+	0.59000003f, 0.4f, 0.59000003f, 0.5f, 0.61f, 0.5f, 0.61f, 0.4f,
+	0.59000003f, 0.5f, 0.59000003f, 0.6f, 0.61f, 0.6f, 0.61f, 0.5f,
+	0.59000003f, 0.6f, 0.59000003f, 0.7f, 0.61f, 0.7f, 0.61f, 0.6f,
+	0.59000003f, 0.7f, 0.59000003f, 0.8f, 0.61f, 0.8f, 0.61f, 0.7f,
+	0.59000003f, 0.8f, 0.59000003f, 0.90000004f, 0.61f, 0.90000004f, 0.61f, 0.8f,
+	0.59000003f, 0.90000004f, 0.59000003f, 1.0f, 0.61f, 1.0f, 0.61f, 0.90000004f,
+	0.61f, 0.0f, 0.61f, 0.1f, 0.63f, 0.1f, 0.63f, 0.0f,
+	0.61f, 0.1f, 0.61f, 0.2f, 0.63f, 0.2f, 0.63f, 0.1f,
+	0.61f, 0.2f, 0.61f, 0.3f, 0.63f, 0.3f, 0.63f, 0.2f,
+	0.61f, 0.3f, 0.61f, 0.4f, 0.63f, 0.4f, 0.63f, 0.3f,
+	0.61f, 0.4f, 0.61f, 0.5f, 0.63f, 0.5f, 0.63f, 0.4f,
+	0.61f, 0.5f, 0.61f, 0.6f, 0.63f, 0.6f, 0.63f, 0.5f,
+	0.61f, 0.6f, 0.61f, 0.7f, 0.63f, 0.7f, 0.63f, 0.6f,
+	0.61f, 0.7f, 0.61f, 0.8f, 0.63f, 0.8f, 0.63f, 0.7f,
+	0.61f, 0.8f, 0.61f, 0.90000004f, 0.63f, 0.90000004f, 0.63f, 0.8f,
+	0.61f, 0.90000004f, 0.61f, 1.0f, 0.63f, 1.0f, 0.63f, 0.90000004f,
+	0.63f, 0.0f, 0.63f, 0.1f, 0.65000004f, 0.1f, 0.65000004f, 0.0f,
+	0.63f, 0.1f, 0.63f, 0.2f, 0.65000004f, 0.2f, 0.65000004f, 0.1f,
+	0.63f, 0.2f, 0.63f, 0.3f, 0.65000004f, 0.3f, 0.65000004f, 0.2f,
+	0.63f, 0.3f, 0.63f, 0.4f, 0.65000004f, 0.4f, 0.65000004f, 0.3f,
+	0.63f, 0.4f, 0.63f, 0.5f, 0.65000004f, 0.5f, 0.65000004f, 0.4f,
+	0.63f, 0.5f, 0.63f, 0.6f, 0.65000004f, 0.6f, 0.65000004f, 0.5f,
+	0.63f, 0.6f, 0.63f, 0.7f, 0.65000004f, 0.7f, 0.65000004f, 0.6f,
+	0.63f, 0.7f, 0.63f, 0.8f, 0.65000004f, 0.8f, 0.65000004f, 0.7f,
+	0.63f, 0.8f, 0.63f, 0.90000004f, 0.65000004f, 0.90000004f, 0.65000004f, 0.8f,
+	0.63f, 0.90000004f, 0.63f, 1.0f, 0.65000004f, 1.0f, 0.65000004f, 0.90000004f,
+	0.65000004f, 0.0f, 0.65000004f, 0.1f, 0.67f, 0.1f, 0.67f, 0.0f,
+	0.65000004f, 0.1f, 0.65000004f, 0.2f, 0.67f, 0.2f, 0.67f, 0.1f,
+	0.65000004f, 0.2f, 0.65000004f, 0.3f, 0.67f, 0.3f, 0.67f, 0.2f,
+	0.65000004f, 0.3f, 0.65000004f, 0.4f, 0.67f, 0.4f, 0.67f, 0.3f,
+	0.65000004f, 0.4f, 0.65000004f, 0.5f, 0.67f, 0.5f, 0.67f, 0.4f,
+	0.65000004f, 0.5f, 0.65000004f, 0.6f, 0.67f, 0.6f, 0.67f, 0.5f,
+	0.65000004f, 0.6f, 0.65000004f, 0.7f, 0.67f, 0.7f, 0.67f, 0.6f,
+	0.65000004f, 0.7f, 0.65000004f, 0.8f, 0.67f, 0.8f, 0.67f, 0.7f,
+	0.65000004f, 0.8f, 0.65000004f, 0.90000004f, 0.67f, 0.90000004f, 0.67f, 0.8f,
+	0.65000004f, 0.90000004f, 0.65000004f, 1.0f, 0.67f, 1.0f, 0.67f, 0.90000004f,
+	0.67f, 0.0f, 0.67f, 0.1f, 0.69f, 0.1f, 0.69f, 0.0f,
+	0.67f, 0.1f, 0.67f, 0.2f, 0.69f, 0.2f, 0.69f, 0.1f,
+	0.67f, 0.2f, 0.67f, 0.3f, 0.69f, 0.3f, 0.69f, 0.2f,
+	0.67f, 0.3f, 0.67f, 0.4f, 0.69f, 0.4f, 0.69f, 0.3f,
+	0.67f, 0.4f, 0.67f, 0.5f, 0.69f, 0.5f, 0.69f, 0.4f,
+	0.67f, 0.5f, 0.67f, 0.6f, 0.69f, 0.6f, 0.69f, 0.5f,
+	0.67f, 0.6f, 0.67f, 0.7f, 0.69f, 0.7f, 0.69f, 0.6f,
+	0.67f, 0.7f, 0.67f, 0.8f, 0.69f, 0.8f, 0.69f, 0.7f,
+	0.67f, 0.8f, 0.67f, 0.90000004f, 0.69f, 0.90000004f, 0.69f, 0.8f,
+	0.67f, 0.90000004f, 0.67f, 1.0f, 0.69f, 1.0f, 0.69f, 0.90000004f,
+	0.69f, 0.0f, 0.69f, 0.1f, 0.71000004f, 0.1f, 0.71000004f, 0.0f,
+	0.69f, 0.1f, 0.69f, 0.2f, 0.71000004f, 0.2f, 0.71000004f, 0.1f,
+	0.69f, 0.2f, 0.69f, 0.3f, 0.71000004f, 0.3f, 0.71000004f, 0.2f,
+	0.69f, 0.3f, 0.69f, 0.4f, 0.71000004f, 0.4f, 0.71000004f, 0.3f,
+	0.69f, 0.4f, 0.69f, 0.5f, 0.71000004f, 0.5f, 0.71000004f, 0.4f,
+	0.69f, 0.5f, 0.69f, 0.6f, 0.71000004f, 0.6f, 0.71000004f, 0.5f,
+	0.69f, 0.6f, 0.69f, 0.7f, 0.71000004f, 0.7f, 0.71000004f, 0.6f,
+	0.69f, 0.7f, 0.69f, 0.8f, 0.71000004f, 0.8f, 0.71000004f, 0.7f,
+	0.69f, 0.8f, 0.69f, 0.90000004f, 0.71000004f, 0.90000004f, 0.71000004f, 0.8f,
+	0.69f, 0.90000004f, 0.69f, 1.0f, 0.71000004f, 1.0f, 0.71000004f, 0.90000004f,
+	0.71000004f, 0.0f, 0.71000004f, 0.1f, 0.73f, 0.1f, 0.73f, 0.0f,
+	0.71000004f, 0.1f, 0.71000004f, 0.2f, 0.73f, 0.2f, 0.73f, 0.1f,
+	0.71000004f, 0.2f, 0.71000004f, 0.3f, 0.73f, 0.3f, 0.73f, 0.2f,
+	0.71000004f, 0.3f, 0.71000004f, 0.4f, 0.73f, 0.4f, 0.73f, 0.3f,
+	0.71000004f, 0.4f, 0.71000004f, 0.5f, 0.73f, 0.5f, 0.73f, 0.4f,
+	0.71000004f, 0.5f, 0.71000004f, 0.6f, 0.73f, 0.6f, 0.73f, 0.5f,
+	0.71000004f, 0.6f, 0.71000004f, 0.7f, 0.73f, 0.7f, 0.73f, 0.6f,
+	0.71000004f, 0.7f, 0.71000004f, 0.8f, 0.73f, 0.8f, 0.73f, 0.7f,
+	0.71000004f, 0.8f, 0.71000004f, 0.90000004f, 0.73f, 0.90000004f, 0.73f, 0.8f,
+	0.71000004f, 0.90000004f, 0.71000004f, 1.0f, 0.73f, 1.0f, 0.73f, 0.90000004f,
+	0.73f, 0.0f, 0.73f, 0.1f, 0.75f, 0.1f, 0.75f, 0.0f,
+	0.73f, 0.1f, 0.73f, 0.2f, 0.75f, 0.2f, 0.75f, 0.1f,
+	0.73f, 0.2f, 0.73f, 0.3f, 0.75f, 0.3f, 0.75f, 0.2f,
+	0.73f, 0.3f, 0.73f, 0.4f, 0.75f, 0.4f, 0.75f, 0.3f,
+	0.73f, 0.4f, 0.73f, 0.5f, 0.75f, 0.5f, 0.75f, 0.4f,
+	0.73f, 0.5f, 0.73f, 0.6f, 0.75f, 0.6f, 0.75f, 0.5f,
+	0.73f, 0.6f, 0.73f, 0.7f, 0.75f, 0.7f, 0.75f, 0.6f,
+	0.73f, 0.7f, 0.73f, 0.8f, 0.75f, 0.8f, 0.75f, 0.7f,
+	0.73f, 0.8f, 0.73f, 0.90000004f, 0.75f, 0.90000004f, 0.75f, 0.8f,
+	0.73f, 0.90000004f, 0.73f, 1.0f, 0.75f, 1.0f, 0.75f, 0.90000004f,
+	0.75f, 0.0f, 0.75f, 0.1f, 0.77000004f, 0.1f, 0.77000004f, 0.0f,
+	0.75f, 0.1f, 0.75f, 0.2f, 0.77000004f, 0.2f, 0.77000004f, 0.1f,
+	0.75f, 0.2f, 0.75f, 0.3f, 0.77000004f, 0.3f, 0.77000004f, 0.2f,
+	0.75f, 0.3f, 0.75f, 0.4f, 0.77000004f, 0.4f, 0.77000004f, 0.3f,
+	0.75f, 0.4f, 0.75f, 0.5f, 0.77000004f, 0.5f, 0.77000004f, 0.4f,
+	0.75f, 0.5f, 0.75f, 0.6f, 0.77000004f, 0.6f, 0.77000004f, 0.5f,
+	0.75f, 0.6f, 0.75f, 0.7f, 0.77000004f, 0.7f, 0.77000004f, 0.6f,
+	0.75f, 0.7f, 0.75f, 0.8f, 0.77000004f, 0.8f, 0.77000004f, 0.7f,
+	0.75f, 0.8f, 0.75f, 0.90000004f, 0.77000004f, 0.90000004f, 0.77000004f, 0.8f,
+	0.75f, 0.90000004f, 0.75f, 1.0f, 0.77000004f, 1.0f, 0.77000004f, 0.90000004f,
+	0.77000004f, 0.0f, 0.77000004f, 0.1f, 0.79f, 0.1f, 0.79f, 0.0f,
+	0.77000004f, 0.1f, 0.77000004f, 0.2f, 0.79f, 0.2f, 0.79f, 0.1f,
+	0.77000004f, 0.2f, 0.77000004f, 0.3f, 0.79f, 0.3f, 0.79f, 0.2f,
+	0.77000004f, 0.3f, 0.77000004f, 0.4f, 0.79f, 0.4f, 0.79f, 0.3f,
+	0.77000004f, 0.4f, 0.77000004f, 0.5f, 0.79f, 0.5f, 0.79f, 0.4f,
+	0.77000004f, 0.5f, 0.77000004f, 0.6f, 0.79f, 0.6f, 0.79f, 0.5f,
+	0.77000004f, 0.6f, 0.77000004f, 0.7f, 0.79f, 0.7f, 0.79f, 0.6f,
+	0.77000004f, 0.7f, 0.77000004f, 0.8f, 0.79f, 0.8f, 0.79f, 0.7f,
+	0.77000004f, 0.8f, 0.77000004f, 0.90000004f, 0.79f, 0.90000004f, 0.79f, 0.8f,
+	0.77000004f, 0.90000004f, 0.77000004f, 1.0f, 0.79f, 1.0f, 0.79f, 0.90000004f,
+	0.79f, 0.0f, 0.79f, 0.1f, 0.81000006f, 0.1f, 0.81000006f, 0.0f,
+	0.79f, 0.1f, 0.79f, 0.2f, 0.81000006f, 0.2f, 0.81000006f, 0.1f,
+	0.79f, 0.2f, 0.79f, 0.3f, 0.81000006f, 0.3f, 0.81000006f, 0.2f,
+	0.79f, 0.3f, 0.79f, 0.4f, 0.81000006f, 0.4f, 0.81000006f, 0.3f,
+	0.79f, 0.4f, 0.79f, 0.5f, 0.81000006f, 0.5f, 0.81000006f, 0.4f,
+	0.79f, 0.5f, 0.79f, 0.6f, 0.81000006f, 0.6f, 0.81000006f, 0.5f,
+	0.79f, 0.6f, 0.79f, 0.7f, 0.81000006f, 0.7f, 0.81000006f, 0.6f,
+	0.79f, 0.7f, 0.79f, 0.8f, 0.81000006f, 0.8f, 0.81000006f, 0.7f,
+	0.79f, 0.8f, 0.79f, 0.90000004f, 0.81000006f, 0.90000004f, 0.81000006f, 0.8f,
+	0.79f, 0.90000004f, 0.79f, 1.0f, 0.81000006f, 1.0f, 0.81000006f, 0.90000004f,
+	0.81000006f, 0.0f, 0.81000006f, 0.1f, 0.83000004f, 0.1f, 0.83000004f, 0.0f,
+	0.81000006f, 0.1f, 0.81000006f, 0.2f, 0.83000004f, 0.2f, 0.83000004f, 0.1f,
+	0.81000006f, 0.2f, 0.81000006f, 0.3f, 0.83000004f, 0.3f, 0.83000004f, 0.2f,
+	0.81000006f, 0.3f, 0.81000006f, 0.4f, 0.83000004f, 0.4f, 0.83000004f, 0.3f,
+	0.81000006f, 0.4f, 0.81000006f, 0.5f, 0.83000004f, 0.5f, 0.83000004f, 0.4f,
+	0.81000006f, 0.5f, 0.81000006f, 0.6f, 0.83000004f, 0.6f, 0.83000004f, 0.5f,
+	0.81000006f, 0.6f, 0.81000006f, 0.7f, 0.83000004f, 0.7f, 0.83000004f, 0.6f,
+	0.81000006f, 0.7f, 0.81000006f, 0.8f, 0.83000004f, 0.8f, 0.83000004f, 0.7f,
+	0.81000006f, 0.8f, 0.81000006f, 0.90000004f, 0.83000004f, 0.90000004f, 0.83000004f, 0.8f,
+	0.81000006f, 0.90000004f, 0.81000006f, 1.0f, 0.83000004f, 1.0f, 0.83000004f, 0.90000004f,
+	0.83000004f, 0.0f, 0.83000004f, 0.1f, 0.85f, 0.1f, 0.85f, 0.0f,
+	0.83000004f, 0.1f, 0.83000004f, 0.2f, 0.85f, 0.2f, 0.85f, 0.1f,
+	0.83000004f, 0.2f, 0.83000004f, 0.3f, 0.85f, 0.3f, 0.85f, 0.2f,
+	0.83000004f, 0.3f, 0.83000004f, 0.4f, 0.85f, 0.4f, 0.85f, 0.3f,
+	0.83000004f, 0.4f, 0.83000004f, 0.5f, 0.85f, 0.5f, 0.85f, 0.4f,
+	0.83000004f, 0.5f, 0.83000004f, 0.6f, 0.85f, 0.6f, 0.85f, 0.5f,
+	0.83000004f, 0.6f, 0.83000004f, 0.7f, 0.85f, 0.7f, 0.85f, 0.6f,
+	0.83000004f, 0.7f, 0.83000004f, 0.8f, 0.85f, 0.8f, 0.85f, 0.7f,
+	0.83000004f, 0.8f, 0.83000004f, 0.90000004f, 0.85f, 0.90000004f, 0.85f, 0.8f,
+	0.83000004f, 0.90000004f, 0.83000004f, 1.0f, 0.85f, 1.0f, 0.85f, 0.90000004f,
+	0.85f, 0.0f, 0.85f, 0.1f, 0.87f, 0.1f, 0.87f, 0.0f,
+	0.85f, 0.1f, 0.85f, 0.2f, 0.87f, 0.2f, 0.87f, 0.1f,
+	0.85f, 0.2f, 0.85f, 0.3f, 0.87f, 0.3f, 0.87f, 0.2f,
+	0.85f, 0.3f, 0.85f, 0.4f, 0.87f, 0.4f, 0.87f, 0.3f,
+	0.85f, 0.4f, 0.85f, 0.5f, 0.87f, 0.5f, 0.87f, 0.4f,
+	0.85f, 0.5f, 0.85f, 0.6f, 0.87f, 0.6f, 0.87f, 0.5f,
+	0.85f, 0.6f, 0.85f, 0.7f, 0.87f, 0.7f, 0.87f, 0.6f,
+	0.85f, 0.7f, 0.85f, 0.8f, 0.87f, 0.8f, 0.87f, 0.7f,
+	0.85f, 0.8f, 0.85f, 0.90000004f, 0.87f, 0.90000004f, 0.87f, 0.8f,
+	0.85f, 0.90000004f, 0.85f, 1.0f, 0.87f, 1.0f, 0.87f, 0.90000004f,
+	0.87f, 0.0f, 0.87f, 0.1f, 0.89f, 0.1f, 0.89f, 0.0f,
+	0.87f, 0.1f, 0.87f, 0.2f, 0.89f, 0.2f, 0.89f, 0.1f,
+	0.87f, 0.2f, 0.87f, 0.3f, 0.89f, 0.3f, 0.89f, 0.2f,
+	0.87f, 0.3f, 0.87f, 0.4f, 0.89f, 0.4f, 0.89f, 0.3f,
+	0.87f, 0.4f, 0.87f, 0.5f, 0.89f, 0.5f, 0.89f, 0.4f,
+	0.87f, 0.5f, 0.87f, 0.6f, 0.89f, 0.6f, 0.89f, 0.5f,
+	0.87f, 0.6f, 0.87f, 0.7f, 0.89f, 0.7f, 0.89f, 0.6f,
+	0.87f, 0.7f, 0.87f, 0.8f, 0.89f, 0.8f, 0.89f, 0.7f,
+	0.87f, 0.8f, 0.87f, 0.90000004f, 0.89f, 0.90000004f, 0.89f, 0.8f,
+	0.87f, 0.90000004f, 0.87f, 1.0f, 0.89f, 1.0f, 0.89f, 0.90000004f,
+	0.89f, 0.0f, 0.89f, 0.1f, 0.91f, 0.1f, 0.91f, 0.0f,
+	0.89f, 0.1f, 0.89f, 0.2f, 0.91f, 0.2f, 0.91f, 0.1f,
+	0.89f, 0.2f, 0.89f, 0.3f, 0.91f, 0.3f, 0.91f, 0.2f,
+	0.89f, 0.3f, 0.89f, 0.4f, 0.91f, 0.4f, 0.91f, 0.3f,
+	0.89f, 0.4f, 0.89f, 0.5f, 0.91f, 0.5f, 0.91f, 0.4f,
+	0.89f, 0.5f, 0.89f, 0.6f, 0.91f, 0.6f, 0.91f, 0.5f,
+	0.89f, 0.6f, 0.89f, 0.7f, 0.91f, 0.7f, 0.91f, 0.6f,
+	0.89f, 0.7f, 0.89f, 0.8f, 0.91f, 0.8f, 0.91f, 0.7f,
+	0.89f, 0.8f, 0.89f, 0.90000004f, 0.91f, 0.90000004f, 0.91f, 0.8f,
+	0.89f, 0.90000004f, 0.89f, 1.0f, 0.91f, 1.0f, 0.91f, 0.90000004f,
+	0.91f, 0.0f, 0.91f, 0.1f, 0.93f, 0.1f, 0.93f, 0.0f,
+	0.91f, 0.1f, 0.91f, 0.2f, 0.93f, 0.2f, 0.93f, 0.1f,
+	0.91f, 0.2f, 0.91f, 0.3f, 0.93f, 0.3f, 0.93f, 0.2f,
+	0.91f, 0.3f, 0.91f, 0.4f, 0.93f, 0.4f, 0.93f, 0.3f,
+	0.91f, 0.4f, 0.91f, 0.5f, 0.93f, 0.5f, 0.93f, 0.4f,
+	0.91f, 0.5f, 0.91f, 0.6f, 0.93f, 0.6f, 0.93f, 0.5f,
+	0.91f, 0.6f, 0.91f, 0.7f, 0.93f, 0.7f, 0.93f, 0.6f,
+	0.91f, 0.7f, 0.91f, 0.8f, 0.93f, 0.8f, 0.93f, 0.7f,
+	0.91f, 0.8f, 0.91f, 0.90000004f, 0.93f, 0.90000004f, 0.93f, 0.8f,
+	0.91f, 0.90000004f, 0.91f, 1.0f, 0.93f, 1.0f, 0.93f, 0.90000004f,
+	0.93f, 0.0f, 0.93f, 0.1f, 0.95000005f, 0.1f, 0.95000005f, 0.0f,
+	0.93f, 0.1f, 0.93f, 0.2f, 0.95000005f, 0.2f, 0.95000005f, 0.1f,
+	0.93f, 0.2f, 0.93f, 0.3f, 0.95000005f, 0.3f, 0.95000005f, 0.2f,
+	0.93f, 0.3f, 0.93f, 0.4f, 0.95000005f, 0.4f, 0.95000005f, 0.3f,
+	0.93f, 0.4f, 0.93f, 0.5f, 0.95000005f, 0.5f, 0.95000005f, 0.4f,
+	0.93f, 0.5f, 0.93f, 0.6f, 0.95000005f, 0.6f, 0.95000005f, 0.5f,
+	0.93f, 0.6f, 0.93f, 0.7f, 0.95000005f, 0.7f, 0.95000005f, 0.6f,
+	0.93f, 0.7f, 0.93f, 0.8f, 0.95000005f, 0.8f, 0.95000005f, 0.7f,
+	0.93f, 0.8f, 0.93f, 0.90000004f, 0.95000005f, 0.90000004f, 0.95000005f, 0.8f,
+	0.93f, 0.90000004f, 0.93f, 1.0f, 0.95000005f, 1.0f, 0.95000005f, 0.90000004f,
+	0.55f, 0.0f, 0.55f, 0.1f, 0.57f, 0.1f, 0.57f, 0.0f,
+	0.55f, 0.1f, 0.55f, 0.2f, 0.57f, 0.2f, 0.57f, 0.1f,
+	0.55f, 0.2f, 0.55f, 0.3f, 0.57f, 0.3f, 0.57f, 0.2f,
+	0.55f, 0.3f, 0.55f, 0.4f, 0.57f, 0.4f, 0.57f, 0.3f,
+	0.55f, 0.4f, 0.55f, 0.5f, 0.57f, 0.5f, 0.57f, 0.4f,
+	0.55f, 0.5f, 0.55f, 0.6f, 0.57f, 0.6f, 0.57f, 0.5f,
+	0.55f, 0.6f, 0.55f, 0.7f, 0.57f, 0.7f, 0.57f, 0.6f,
+	0.55f, 0.7f, 0.55f, 0.8f, 0.57f, 0.8f, 0.57f, 0.7f,
+	0.55f, 0.8f, 0.55f, 0.90000004f, 0.57f, 0.90000004f, 0.57f, 0.8f,
+	0.55f, 0.90000004f, 0.55f, 1.0f, 0.57f, 1.0f, 0.57f, 0.90000004f,
+	0.57f, 0.0f, 0.57f, 0.1f, 0.59000003f, 0.1f, 0.59000003f, 0.0f,
+	0.57f, 0.1f, 0.57f, 0.2f, 0.59000003f, 0.2f, 0.59000003f, 0.1f,
+	0.57f, 0.2f, 0.57f, 0.3f, 0.59000003f, 0.3f, 0.59000003f, 0.2f,
+	0.57f, 0.3f, 0.57f, 0.4f, 0.59000003f, 0.4f, 0.59000003f, 0.3f,
+	0.57f, 0.4f, 0.57f, 0.5f, 0.59000003f, 0.5f, 0.59000003f, 0.4f,
+	0.57f, 0.5f, 0.57f, 0.6f, 0.59000003f, 0.6f, 0.59000003f, 0.5f,
+	0.57f, 0.6f, 0.57f, 0.7f, 0.59000003f, 0.7f, 0.59000003f, 0.6f,
+	0.57f, 0.7f, 0.57f, 0.8f, 0.59000003f, 0.8f, 0.59000003f, 0.7f,
+	0.57f, 0.8f, 0.57f, 0.90000004f, 0.59000003f, 0.90000004f, 0.59000003f, 0.8f,
+	0.57f, 0.90000004f, 0.57f, 1.0f, 0.59000003f, 1.0f, 0.59000003f, 0.90000004f,
+	0.59000003f, 0.0f, 0.59000003f, 0.1f, 0.61f, 0.1f, 0.61f, 0.0f,
+	0.59000003f, 0.1f, 0.59000003f, 0.2f, 0.61f, 0.2f, 0.61f, 0.1f,
+	0.59000003f, 0.2f, 0.59000003f, 0.3f, 0.61f, 0.3f, 0.61f, 0.2f,
+	0.59000003f, 0.3f, 0.59000003f, 0.4f, 0.61f, 0.4f, 0.61f, 0.3f,
+	0.59000003f, 0.4f, 0.59000003f, 0.5f, 0.61f, 0.5f, 0.61f, 0.4f,
+	0.59000003f, 0.5f, 0.59000003f, 0.6f, 0.61f, 0.6f, 0.61f, 0.5f,
+	0.59000003f, 0.6f, 0.59000003f, 0.7f, 0.61f, 0.7f, 0.61f, 0.6f,
+	0.59000003f, 0.7f, 0.59000003f, 0.8f, 0.61f, 0.8f, 0.61f, 0.7f,
+	0.59000003f, 0.8f, 0.59000003f, 0.90000004f, 0.61f, 0.90000004f, 0.61f, 0.8f,
+	0.59000003f, 0.90000004f, 0.59000003f, 1.0f, 0.61f, 1.0f, 0.61f, 0.90000004f,
+	0.61f, 0.0f, 0.61f, 0.1f, 0.63f, 0.1f, 0.63f, 0.0f,
+	0.61f, 0.1f, 0.61f, 0.2f, 0.63f, 0.2f, 0.63f, 0.1f,
+	0.61f, 0.2f, 0.61f, 0.3f, 0.63f, 0.3f, 0.63f, 0.2f,
+	0.61f, 0.3f, 0.61f, 0.4f, 0.63f, 0.4f, 0.63f, 0.3f,
+	0.61f, 0.4f, 0.61f, 0.5f, 0.63f, 0.5f, 0.63f, 0.4f,
+	0.61f, 0.5f, 0.61f, 0.6f, 0.63f, 0.6f, 0.63f, 0.5f,
+	0.61f, 0.6f, 0.61f, 0.7f, 0.63f, 0.7f, 0.63f, 0.6f,
+	0.61f, 0.7f, 0.61f, 0.8f, 0.63f, 0.8f, 0.63f, 0.7f,
+	0.61f, 0.8f, 0.61f, 0.90000004f, 0.63f, 0.90000004f, 0.63f, 0.8f,
+	0.61f, 0.90000004f, 0.61f, 1.0f, 0.63f, 1.0f, 0.63f, 0.90000004f,
+	0.63f, 0.0f, 0.63f, 0.1f, 0.65000004f, 0.1f, 0.65000004f, 0.0f,
+	0.63f, 0.1f, 0.63f, 0.2f, 0.65000004f, 0.2f, 0.65000004f, 0.1f,
+	0.63f, 0.2f, 0.63f, 0.3f, 0.65000004f, 0.3f, 0.65000004f, 0.2f,
+	0.63f, 0.3f, 0.63f, 0.4f, 0.65000004f, 0.4f, 0.65000004f, 0.3f,
+	0.63f, 0.4f, 0.63f, 0.5f, 0.65000004f, 0.5f, 0.65000004f, 0.4f,
+	0.63f, 0.5f, 0.63f, 0.6f, 0.65000004f, 0.6f, 0.65000004f, 0.5f,
+	0.63f, 0.6f, 0.63f, 0.7f, 0.65000004f, 0.7f, 0.65000004f, 0.6f,
+	0.63f, 0.7f, 0.63f, 0.8f, 0.65000004f, 0.8f, 0.65000004f, 0.7f,
+	0.63f, 0.8f, 0.63f, 0.90000004f, 0.65000004f, 0.90000004f, 0.65000004f, 0.8f,
+	0.63f, 0.90000004f, 0.63f, 1.0f, 0.65000004f, 1.0f, 0.65000004f, 0.90000004f,
+	0.65000004f, 0.0f, 0.65000004f, 0.1f, 0.67f, 0.1f, 0.67f, 0.0f,
+	0.65000004f, 0.1f, 0.65000004f, 0.2f, 0.67f, 0.2f, 0.67f, 0.1f,
+	0.65000004f, 0.2f, 0.65000004f, 0.3f, 0.67f, 0.3f, 0.67f, 0.2f,
+	0.65000004f, 0.3f, 0.65000004f, 0.4f, 0.67f, 0.4f, 0.67f, 0.3f,
+	0.65000004f, 0.4f, 0.65000004f, 0.5f, 0.67f, 0.5f, 0.67f, 0.4f,
+	0.65000004f, 0.5f, 0.65000004f, 0.6f, 0.67f, 0.6f, 0.67f, 0.5f,
+	0.65000004f, 0.6f, 0.65000004f, 0.7f, 0.67f, 0.7f, 0.67f, 0.6f,
+	0.65000004f, 0.7f, 0.65000004f, 0.8f, 0.67f, 0.8f, 0.67f, 0.7f,
+	0.65000004f, 0.8f, 0.65000004f, 0.90000004f, 0.67f, 0.90000004f, 0.67f, 0.8f,
+	0.65000004f, 0.90000004f, 0.65000004f, 1.0f, 0.67f, 1.0f, 0.67f, 0.90000004f,
+	0.67f, 0.0f, 0.67f, 0.1f, 0.69f, 0.1f, 0.69f, 0.0f,
+	0.67f, 0.1f, 0.67f, 0.2f, 0.69f, 0.2f, 0.69f, 0.1f,
+	0.67f, 0.2f, 0.67f, 0.3f, 0.69f, 0.3f, 0.69f, 0.2f,
+	0.67f, 0.3f, 0.67f, 0.4f, 0.69f, 0.4f, 0.69f, 0.3f,
+	0.67f, 0.4f, 0.67f, 0.5f, 0.69f, 0.5f, 0.69f, 0.4f,
+	0.67f, 0.5f, 0.67f, 0.6f, 0.69f, 0.6f, 0.69f, 0.5f,
+	0.67f, 0.6f, 0.67f, 0.7f, 0.69f, 0.7f, 0.69f, 0.6f,
+	0.67f, 0.7f, 0.67f, 0.8f, 0.69f, 0.8f, 0.69f, 0.7f,
+	0.67f, 0.8f, 0.67f, 0.90000004f, 0.69f, 0.90000004f, 0.69f, 0.8f,
+	0.67f, 0.90000004f, 0.67f, 1.0f, 0.69f, 1.0f, 0.69f, 0.90000004f,
+	0.69f, 0.0f, 0.69f, 0.1f, 0.71000004f, 0.1f, 0.71000004f, 0.0f,
+	0.69f, 0.1f, 0.69f, 0.2f, 0.71000004f, 0.2f, 0.71000004f, 0.1f,
+	0.69f, 0.2f, 0.69f, 0.3f, 0.71000004f, 0.3f, 0.71000004f, 0.2f,
+	0.69f, 0.3f, 0.69f, 0.4f, 0.71000004f, 0.4f, 0.71000004f, 0.3f,
+	0.69f, 0.4f, 0.69f, 0.5f, 0.71000004f, 0.5f, 0.71000004f, 0.4f,
+	0.69f, 0.5f, 0.69f, 0.6f, 0.71000004f, 0.6f, 0.71000004f, 0.5f,
+	0.69f, 0.6f, 0.69f, 0.7f, 0.71000004f, 0.7f, 0.71000004f, 0.6f,
+	0.69f, 0.7f, 0.69f, 0.8f, 0.71000004f, 0.8f, 0.71000004f, 0.7f,
+	0.69f, 0.8f, 0.69f, 0.90000004f, 0.71000004f, 0.90000004f, 0.71000004f, 0.8f,
+	0.69f, 0.90000004f, 0.69f, 1.0f, 0.71000004f, 1.0f, 0.71000004f, 0.90000004f,
+	0.71000004f, 0.0f, 0.71000004f, 0.1f, 0.73f, 0.1f, 0.73f, 0.0f,
+	0.71000004f, 0.1f, 0.71000004f, 0.2f, 0.73f, 0.2f, 0.73f, 0.1f,
+	0.71000004f, 0.2f, 0.71000004f, 0.3f, 0.73f, 0.3f, 0.73f, 0.2f,
+	0.71000004f, 0.3f, 0.71000004f, 0.4f, 0.73f, 0.4f, 0.73f, 0.3f,
+	0.71000004f, 0.4f, 0.71000004f, 0.5f, 0.73f, 0.5f, 0.73f, 0.4f,
+	0.71000004f, 0.5f, 0.71000004f, 0.6f, 0.73f, 0.6f, 0.73f, 0.5f,
+	0.71000004f, 0.6f, 0.71000004f, 0.7f, 0.73f, 0.7f, 0.73f, 0.6f,
+	0.71000004f, 0.7f, 0.71000004f, 0.8f, 0.73f, 0.8f, 0.73f, 0.7f,
+	0.71000004f, 0.8f, 0.71000004f, 0.90000004f, 0.73f, 0.90000004f, 0.73f, 0.8f,
+	0.71000004f, 0.90000004f, 0.71000004f, 1.0f, 0.73f, 1.0f, 0.73f, 0.90000004f,
+	0.73f, 0.0f, 0.73f, 0.1f, 0.75f, 0.1f, 0.75f, 0.0f,
+	0.73f, 0.1f, 0.73f, 0.2f, 0.75f, 0.2f, 0.75f, 0.1f,
+	0.73f, 0.2f, 0.73f, 0.3f, 0.75f, 0.3f, 0.75f, 0.2f,
+	0.73f, 0.3f, 0.73f, 0.4f, 0.75f, 0.4f, 0.75f, 0.3f,
+	0.73f, 0.4f, 0.73f, 0.5f, 0.75f, 0.5f, 0.75f, 0.4f,
+	0.73f, 0.5f, 0.73f, 0.6f, 0.75f, 0.6f, 0.75f, 0.5f,
+	0.73f, 0.6f, 0.73f, 0.7f, 0.75f, 0.7f, 0.75f, 0.6f,
+	0.73f, 0.7f, 0.73f, 0.8f, 0.75f, 0.8f, 0.75f, 0.7f,
+	0.73f, 0.8f, 0.73f, 0.90000004f, 0.75f, 0.90000004f, 0.75f, 0.8f,
+	0.73f, 0.90000004f, 0.73f, 1.0f, 0.75f, 1.0f, 0.75f, 0.90000004f,
+	0.75f, 0.0f, 0.75f, 0.1f, 0.77000004f, 0.1f, 0.77000004f, 0.0f,
+	0.75f, 0.1f, 0.75f, 0.2f, 0.77000004f, 0.2f, 0.77000004f, 0.1f,
+	0.75f, 0.2f, 0.75f, 0.3f, 0.77000004f, 0.3f, 0.77000004f, 0.2f,
+	0.75f, 0.3f, 0.75f, 0.4f, 0.77000004f, 0.4f, 0.77000004f, 0.3f,
+	0.75f, 0.4f, 0.75f, 0.5f, 0.77000004f, 0.5f, 0.77000004f, 0.4f,
+	0.75f, 0.5f, 0.75f, 0.6f, 0.77000004f, 0.6f, 0.77000004f, 0.5f,
+	0.75f, 0.6f, 0.75f, 0.7f, 0.77000004f, 0.7f, 0.77000004f, 0.6f,
+	0.75f, 0.7f, 0.75f, 0.8f, 0.77000004f, 0.8f, 0.77000004f, 0.7f,
+	0.75f, 0.8f, 0.75f, 0.90000004f, 0.77000004f, 0.90000004f, 0.77000004f, 0.8f,
+	0.75f, 0.90000004f, 0.75f, 1.0f, 0.77000004f, 1.0f, 0.77000004f, 0.90000004f,
+	0.77000004f, 0.0f, 0.77000004f, 0.1f, 0.79f, 0.1f, 0.79f, 0.0f,
+	0.77000004f, 0.1f, 0.77000004f, 0.2f, 0.79f, 0.2f, 0.79f, 0.1f,
+	0.77000004f, 0.2f, 0.77000004f, 0.3f, 0.79f, 0.3f, 0.79f, 0.2f,
+	0.77000004f, 0.3f, 0.77000004f, 0.4f, 0.79f, 0.4f, 0.79f, 0.3f,
+	0.77000004f, 0.4f, 0.77000004f, 0.5f, 0.79f, 0.5f, 0.79f, 0.4f,
+	0.77000004f, 0.5f, 0.77000004f, 0.6f, 0.79f, 0.6f, 0.79f, 0.5f,
+	0.77000004f, 0.6f, 0.77000004f, 0.7f, 0.79f, 0.7f, 0.79f, 0.6f,
+	0.77000004f, 0.7f, 0.77000004f, 0.8f, 0.79f, 0.8f, 0.79f, 0.7f,
+	0.77000004f, 0.8f, 0.77000004f, 0.90000004f, 0.79f, 0.90000004f, 0.79f, 0.8f,
+	0.77000004f, 0.90000004f, 0.77000004f, 1.0f, 0.79f, 1.0f, 0.79f, 0.90000004f,
+	0.79f, 0.0f, 0.79f, 0.1f, 0.81000006f, 0.1f, 0.81000006f, 0.0f,
+	0.79f, 0.1f, 0.79f, 0.2f, 0.81000006f, 0.2f, 0.81000006f, 0.1f,
+	0.79f, 0.2f, 0.79f, 0.3f, 0.81000006f, 0.3f, 0.81000006f, 0.2f,
+	0.79f, 0.3f, 0.79f, 0.4f, 0.81000006f, 0.4f, 0.81000006f, 0.3f,
+	0.79f, 0.4f, 0.79f, 0.5f, 0.81000006f, 0.5f, 0.81000006f, 0.4f,
+	0.79f, 0.5f, 0.79f, 0.6f, 0.81000006f, 0.6f, 0.81000006f, 0.5f,
+	0.79f, 0.6f, 0.79f, 0.7f, 0.81000006f, 0.7f, 0.81000006f, 0.6f,
+	0.79f, 0.7f, 0.79f, 0.8f, 0.81000006f, 0.8f, 0.81000006f, 0.7f,
+	0.79f, 0.8f, 0.79f, 0.90000004f, 0.81000006f, 0.90000004f, 0.81000006f, 0.8f,
+	0.79f, 0.90000004f, 0.79f, 1.0f, 0.81000006f, 1.0f, 0.81000006f, 0.90000004f,
+	0.81000006f, 0.0f, 0.81000006f, 0.1f, 0.83000004f, 0.1f, 0.83000004f, 0.0f,
+	0.81000006f, 0.1f, 0.81000006f, 0.2f, 0.83000004f, 0.2f, 0.83000004f, 0.1f,
+	0.81000006f, 0.2f, 0.81000006f, 0.3f, 0.83000004f, 0.3f, 0.83000004f, 0.2f,
+	0.81000006f, 0.3f, 0.81000006f, 0.4f, 0.83000004f, 0.4f, 0.83000004f, 0.3f,
+	0.81000006f, 0.4f, 0.81000006f, 0.5f, 0.83000004f, 0.5f, 0.83000004f, 0.4f,
+	0.81000006f, 0.5f, 0.81000006f, 0.6f, 0.83000004f, 0.6f, 0.83000004f, 0.5f,
+	0.81000006f, 0.6f, 0.81000006f, 0.7f, 0.83000004f, 0.7f, 0.83000004f, 0.6f,
+	0.81000006f, 0.7f, 0.81000006f, 0.8f, 0.83000004f, 0.8f, 0.83000004f, 0.7f,
+	0.81000006f, 0.8f, 0.81000006f, 0.90000004f, 0.83000004f, 0.90000004f, 0.83000004f, 0.8f,
+	0.81000006f, 0.90000004f, 0.81000006f, 1.0f, 0.83000004f, 1.0f, 0.83000004f, 0.90000004f,
+	0.83000004f, 0.0f, 0.83000004f, 0.1f, 0.85f, 0.1f, 0.85f, 0.0f,
+	0.83000004f, 0.1f, 0.83000004f, 0.2f, 0.85f, 0.2f, 0.85f, 0.1f,
+	0.83000004f, 0.2f, 0.83000004f, 0.3f, 0.85f, 0.3f, 0.85f, 0.2f,
+	0.83000004f, 0.3f, 0.83000004f, 0.4f, 0.85f, 0.4f, 0.85f, 0.3f,
+	0.83000004f, 0.4f, 0.83000004f, 0.5f, 0.85f, 0.5f, 0.85f, 0.4f,
+	0.83000004f, 0.5f, 0.83000004f, 0.6f, 0.85f, 0.6f, 0.85f, 0.5f,
+	0.83000004f, 0.6f, 0.83000004f, 0.7f, 0.85f, 0.7f, 0.85f, 0.6f,
+	0.83000004f, 0.7f, 0.83000004f, 0.8f, 0.85f, 0.8f, 0.85f, 0.7f,
+	0.83000004f, 0.8f, 0.83000004f, 0.90000004f, 0.85f, 0.90000004f, 0.85f, 0.8f,
+	0.83000004f, 0.90000004f, 0.83000004f, 1.0f, 0.85f, 1.0f, 0.85f, 0.90000004f,
+	0.85f, 0.0f, 0.85f, 0.1f, 0.87f, 0.1f, 0.87f, 0.0f,
+	0.85f, 0.1f, 0.85f, 0.2f, 0.87f, 0.2f, 0.87f, 0.1f,
+	0.85f, 0.2f, 0.85f, 0.3f, 0.87f, 0.3f, 0.87f, 0.2f,
+	0.85f, 0.3f, 0.85f, 0.4f, 0.87f, 0.4f, 0.87f, 0.3f,
+	0.85f, 0.4f, 0.85f, 0.5f, 0.87f, 0.5f, 0.87f, 0.4f,
+	0.85f, 0.5f, 0.85f, 0.6f, 0.87f, 0.6f, 0.87f, 0.5f,
+	0.85f, 0.6f, 0.85f, 0.7f, 0.87f, 0.7f, 0.87f, 0.6f,
+	0.85f, 0.7f, 0.85f, 0.8f, 0.87f, 0.8f, 0.87f, 0.7f,
+	0.85f, 0.8f, 0.85f, 0.90000004f, 0.87f, 0.90000004f, 0.87f, 0.8f,
+	0.85f, 0.90000004f, 0.85f, 1.0f, 0.87f, 1.0f, 0.87f, 0.90000004f,
+	0.87f, 0.0f, 0.87f, 0.1f, 0.89f, 0.1f, 0.89f, 0.0f,
+	0.87f, 0.1f, 0.87f, 0.2f, 0.89f, 0.2f, 0.89f, 0.1f,
+	0.87f, 0.2f, 0.87f, 0.3f, 0.89f, 0.3f, 0.89f, 0.2f,
+	0.87f, 0.3f, 0.87f, 0.4f, 0.89f, 0.4f, 0.89f, 0.3f,
+	0.87f, 0.4f, 0.87f, 0.5f, 0.89f, 0.5f, 0.89f, 0.4f,
+	0.87f, 0.5f, 0.87f, 0.6f, 0.89f, 0.6f, 0.89f, 0.5f,
+	0.87f, 0.6f, 0.87f, 0.7f, 0.89f, 0.7f, 0.89f, 0.6f,
+	0.87f, 0.7f, 0.87f, 0.8f, 0.89f, 0.8f, 0.89f, 0.7f,
+	0.87f, 0.8f, 0.87f, 0.90000004f, 0.89f, 0.90000004f, 0.89f, 0.8f,
+	0.87f, 0.90000004f, 0.87f, 1.0f, 0.89f, 1.0f, 0.89f, 0.90000004f,
+	0.89f, 0.0f, 0.89f, 0.1f, 0.91f, 0.1f, 0.91f, 0.0f,
+	0.89f, 0.1f, 0.89f, 0.2f, 0.91f, 0.2f, 0.91f, 0.1f,
+	0.89f, 0.2f, 0.89f, 0.3f, 0.91f, 0.3f, 0.91f, 0.2f,
+	0.89f, 0.3f, 0.89f, 0.4f, 0.91f, 0.4f, 0.91f, 0.3f,
+	0.89f, 0.4f, 0.89f, 0.5f, 0.91f, 0.5f, 0.91f, 0.4f,
+	0.89f, 0.5f, 0.89f, 0.6f, 0.91f, 0.6f, 0.91f, 0.5f,
+	0.89f, 0.6f, 0.89f, 0.7f, 0.91f, 0.7f, 0.91f, 0.6f,
+	0.89f, 0.7f, 0.89f, 0.8f, 0.91f, 0.8f, 0.91f, 0.7f,
+	0.89f, 0.8f, 0.89f, 0.90000004f, 0.91f, 0.90000004f, 0.91f, 0.8f,
+	0.89f, 0.90000004f, 0.89f, 1.0f, 0.91f, 1.0f, 0.91f, 0.90000004f,
+	0.91f, 0.0f, 0.91f, 0.1f, 0.93f, 0.1f, 0.93f, 0.0f,
+	0.91f, 0.1f, 0.91f, 0.2f, 0.93f, 0.2f, 0.93f, 0.1f,
+	0.91f, 0.2f, 0.91f, 0.3f, 0.93f, 0.3f, 0.93f, 0.2f,
+	0.91f, 0.3f, 0.91f, 0.4f, 0.93f, 0.4f, 0.93f, 0.3f,
+	0.91f, 0.4f, 0.91f, 0.5f, 0.93f, 0.5f, 0.93f, 0.4f,
+	0.91f, 0.5f, 0.91f, 0.6f, 0.93f, 0.6f, 0.93f, 0.5f,
+	0.91f, 0.6f, 0.91f, 0.7f, 0.93f, 0.7f, 0.93f, 0.6f,
+	0.91f, 0.7f, 0.91f, 0.8f, 0.93f, 0.8f, 0.93f, 0.7f,
+	0.91f, 0.8f, 0.91f, 0.90000004f, 0.93f, 0.90000004f, 0.93f, 0.8f,
+	0.91f, 0.90000004f, 0.91f, 1.0f, 0.93f, 1.0f, 0.93f, 0.90000004f,
+	0.93f, 0.0f, 0.93f, 0.1f, 0.95000005f, 0.1f, 0.95000005f, 0.0f,
+	0.93f, 0.1f, 0.93f, 0.2f, 0.95000005f, 0.2f, 0.95000005f, 0.1f,
+	0.93f, 0.2f, 0.93f, 0.3f, 0.95000005f, 0.3f, 0.95000005f, 0.2f,
+	0.93f, 0.3f, 0.93f, 0.4f, 0.95000005f, 0.4f, 0.95000005f, 0.3f,
+	0.93f, 0.4f, 0.93f, 0.5f, 0.95000005f, 0.5f, 0.95000005f, 0.4f,
+	0.93f, 0.5f, 0.93f, 0.6f, 0.95000005f, 0.6f, 0.95000005f, 0.5f,
+	0.93f, 0.6f, 0.93f, 0.7f, 0.95000005f, 0.7f, 0.95000005f, 0.6f,
+	0.93f, 0.7f, 0.93f, 0.8f, 0.95000005f, 0.8f, 0.95000005f, 0.7f,
+	0.93f, 0.8f, 0.93f, 0.90000004f, 0.95000005f, 0.90000004f, 0.95000005f, 0.8f,
+	0.93f, 0.90000004f, 0.93f, 1.0f, 0.95000005f, 1.0f, 0.95000005f, 0.90000004f
+};
+
+const float* BakedTables::cuboidAtlasTexCoords()
+{
+	return cuboidAtlas;
+}
+
+// ShapeGen::genWall(1, 20, &ShapeGen::doorway, 1)
+static const float wallVertex[2208] =
+{
+	0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	2.0f, 0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+	0.0f, 2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 1.0f, 3.0f,
+	0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f,
+	4.0f, 0.0f, 1.0f, 4.0f, 0.0f, 1.0f, 3.0f, 0.0f,
+	0.0f, 4.0f, 0.0f, 0.0f, 5.0f, 0.0f, 1.0f, 5.0f,
+	0.0f, 1.0f, 4.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.0f,
+	6.0f, 0.0f, 1.0f, 6.0f, 0.0f, 1.0f, 5.0f, 0.0f,
+	0.0f, 6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 1.0f, 7.0f,
+	0.0f, 1.0f, 6.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.0f,
+	8.0f, 0.0f, 1.0f, 8.0f, 0.0f, 1.0f, 7.0f, 0.0f,
+	0.0f, 8.0f, 0.0f, 0.0f, 9.0f, 0.0f, 1.0f, 9.0f,
+	0.0f, 1.0f, 8.0f, 0.0f, 0.0f, 9.0f, 0.0f, 0.0f,
+	10.0f, 0.0f, 1.0f, 10.0f, 0.0f, 1.0f, 9.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 2.0f, 1.0f,
+	0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f,
+	2.0f, 0.0f, 2.0f, 2.0f, 0.0f, 2.0f, 1.0f, 0.0f,
+	1.0f, 2.0f, 0.0f, 1.0f, 3.0f, 0.0f, 2.0f, 3.0f,
+	0.0f, 2.0f, 2.0f, 0.0f, 1.0f, 3.0f, 0.0f, 1.0f,
+	4.0f, 0.0f, 2.0f, 4.0f, 0.0f, 2.0f, 3.0f, 0.0f,
+	1.0f, 4.0f, 0.0f, 1.0f, 5.0f, 0.0f, 2.0f, 5.0f,
+	0.0f, 2.0f, 4.0f, 0.0f, 1.0f, 5.0f, 0.0f, 1.0f,
+	6.0f, 0.0f, 2.0f, 6.0f, 0.0f, 2.0f, 5.0f, 0.0f,
+	1.0f, 6.0f, 0.0f, 1.0f, 7.0f, 0.0f, 2.0f, 7.0f,
+	0.0f, 2.0f, 6.0f, 0.0f, 1.0f, 7.0f, 0.0f, 1.0f,
+	8.0f, 0.0f, 2.0f, 8.0f, 0.0f, 2.0f, 7.0f, 0.0f,
+	1.0f, 8.0f, 0.0f, 1.0f, 9.0f, 0.0f, 2.0f, 9.0f,
+	0.0f, 2.0f, 8.0f, 0.0f, 1.0f, 9.0f, 0.0f, 1.0f,
+	10.0f, 0.0f, 2.0f, 10.0f, 0.0f, 2.0f, 9.0f, 0.0f,
+	2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 3.0f, 1.0f,
+	0.0f, 3.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 2.0f,
+	2.0f, 0.0f, 3.0f, 2.0f, 0.0f, 3.0f, 1.0f, 0.0f,
+	2.0f, 2.0f, 0.0f, 2.0f, 3.0f, 0.0f, 3.0f, 3.0f,
+	0.0f, 3.0f, 2.0f, 0.0f, 2.0f, 3.0f, 0.0f, 2.0f,
+	4.0f, 0.0f, 3.0f, 4.0f, 0.0f, 3.0f, 3.0f, 0.0f,
+	2.0f, 4.0f, 0.0f, 2.0f, 5.0f, 0.0f, 3.0f, 5.0f,
+	0.0f, 3.0f, 4.0f, 0.0f, 2.0f, 5.0f, 0.0f, 2.0f,
+	6.0f, 0.0f, 3.0f, 6.0f, 0.0f, 3.0f, 5.0f, 0.0f,
+	2.0f, 6.0f, 0.0f, 2.0f, 7.0f, 0.0f, 3.0f, 7.0f,
+	0.0f, 3.0f, 6.0f, 0.0f, 2.0f, 7.0f, 0.0f, 2.0f,
+	8.0f, 0.0f, 3.0f, 8.0f, 0.0f, 3.0f, 7.0f, 0.0f,
+	2.0f, 8.0f, 0.0f, 2.0f, 9.0f, 0.0f, 3.0f, 9.0f,
+	0.0f, 3.0f, 8.0f, 0.0f, 2.0f, 9.0f, 0.0f, 2.0f,
+	10.0f, 0.0f, 3.0f, 10.0f, 0.0f, 3.0f, 9.0f, 0.0f,
+	3.0f, 0.0f, 0.0f, 3.0f, 1.0f, 0.0f, 4.0f, 1.0f,
+	0.0f, 4.0f, 0.0f, 0.0f, 3.0f, 1.0f, 0.0f, 3.0f,
+	2.0f, 0.0f, 4.0f, 2.0f, 0.0f, 4.0f, 1.0f, 0.0f,
+	3.0f, 2.0f, 0.0f, 3.0f, 3.0f, 0.0f, 4.0f, 3.0f,
+	0.0f, 4.0f, 2.0f, 0.0f, 3.0f, 3.0f, 0.0f, 3.0f,
+	4.0f, 0.0f, 4.0f, 4.0f, 0.0f, 4.0f, 3.0f, 0.0f,
+	3.0f, 4.0f, 0.0f, 3.0f, 5.0f, 0.0f, 4.0f, 5.0f,
+	0.0f, 4.0f, 4.0f, 0.0f, 3.0f, 5.0f, 0.0f, 3.0f,
+	6.0f, 0.0f, 4.0f, 6.0f, 0.0f, 4.0f, 5.0f, 0.0f,
+	3.0f, 6.0f, 0.0f, 3.0f, 7.0f, 0.0f, 4.0f, 7.0f,
+	0.0f, 4.0f, 6.0f, 0.0f, 3.0f, 7.0f, 0.0f, 3.0f,
+	8.0f, 0.0f, 4.0f, 8.0f, 0.0f, 4.0f, 7.0f, 0.0f,
+	3.0f, 8.0f, 0.0f, 3.0f, 9.0f, 0.0f, 4.0f, 9.0f,
+	0.0f, 4.0f, 8.0f, 0.0f, 3.0f, 9.0f, 0.0f, 3.0f,
+	10.0f, 0.0f, 4.0f, 10.0f, 0.0f, 4.0f, 9.0f, 0.0f,
+	4.0f, 0.0f, 0.0f, 4.0f, 1.0f, 0.0f, 5.0f, 1.0f,
+	0.0f, 5.0f, 0.0f, 0.0f, 4.0f, 1.0f, 0.0f, 4.0f,
+	2.0f, 0.0f, 5.0f, 2.0f, 0.0f, 5.0f, 1.0f, 0.0f,
+	4.0f, 2.0f, 0.0f, 4.0f, 3.0f, 0.0f, 5.0f, 3.0f,
+	0.0f, 5.0f, 2.0f, 0.0f, 4.0f, 3.0f, 0.0f, 4.0f,
+	4.0f, 0.0f, 5.0f, 4.0f, 0.0f, 5.0f, 3.0f, 0.0f,
+	4.0f, 4.0f, 0.0f, 4.0f, 5.0f, 0.0f, 5.0f, 5.0f,
+	0.0f, 5.0f, 4.0f, 0.0f, 4.0f, 5.0f, 0.0f, 4.0f,
+	6.0f, 0.0f, 5.0f, 6.0f, 0.0f, 5.0f, 5.0f, 0.0f,
+	4.0f, 6.0f, 0.0f, 4.0f, 7.0f, 0.0f, 5.0f, 7.0f,
+	0.0f, 5.0f, 6.0f, 0.0f, 4.0f, 7.0f, 0.0f, 4.0f,
+	8.0f, 0.0f, 5.0f, 8.0f, 0.0f, 5.0f, 7.0f, 0.0f,
+	4.0f, 8.0f, 0.0f, 4.0f, 9.0f, 0.0f, 5.0f, 9.0f,
+	0.0f, 5.0f, 8.0f, 0.0f, 4.0f, 9.0f, 0.0f, 4.0f,
+	10.0f, 0.0f, 5.0f, 10.0f, 0.0f, 5.0f, 9.0f, 0.0f,
+	5.0f, 0.0f, 0.0f, 5.0f, 1.0f, 0.0f, 6.0f, 1.0f,
+	0.0f, 6.0f, 0.0f, 0.0f, 5.0f, 1.0f, 0.0f, 5.0f,
+	2.0f, 0.0f, 6.0f, 2.0f, 0.0f, 6.0f, 1.0f, 0.0f,
+	5.0f, 2.0f, 0.0f, 5.0f, 3.0f, 0.0f, 6.0f, 3.0f,
+	0.0f, 6.0f, 2.0f, 0.0f, 5.0f, 3.0f, 0.0f, 5.0f,
+	4.0f, 0.0f, 6.0f, 4.0f, 0.0f, 6.0f, 3.0f, 0.0f,
+	5.0f, 4.0f, 0.0f, 5.0f, 5.0f, 0.0f, 6.0f, 5.0f,
+	0.0f, 6.0f, 4.0f, 0.0f, 5.0f, 5.0f, 0.0f, 5.0f,
+	6.0f, 0.0f, 6.0f, 6.0f, 0.0f, 6.0f, 5.0f, 0.0f,
+	5.0f, 6.0f, 0.0f, 5.0f, 7.0f, 0.0f, 6.0f, 7.0f,
+	0.0f, 6.0f, 6.0f, 0.0f, 5.0f, 7.0f, 0.0f, 5.0f,
+	8.0f, 0.0f, 6.0f, 8.0f, 0.0f, 6.0f, 7.0f, 0.0f,
+	5.0f, 8.0f, 0.0f, 5.0f, 9.0f, 0.0f, 6.0f, 9.0f,
+	0.0f, 6.0f, 8.0f, 0.0f, 5.0f, 9.0f, 0.0f, 5.0f,
+	10.0f, 0.0f, 6.0f, 10.0f, 0.0f, 6.0f, 9.0f, 0.0f,
+	6.0f, 0.0f, 0.0f, 6.0f, 1.0f, 0.0f, 7.0f, 1.0f,
+	0.0f, 7.0f, 0.0f, 0.0f, 6.0f, 1.0f, 0.0f, 6.0f,
+	2.0f, 0.0f, 7.0f, 2.0f, 0.0f, 7.0f, 1.0f, 0.0f,
+	6.0f, 2.0f, 0.0f, 6.0f, 3.0f, 0.0f, 7.0f, 3.0f,
+	0.0f, 7.0f, 2.0f, 0.0f, 6.0f, 3.0f, 0.0f, 6.0f,
+	4.0f, 0.0f, 7.0f, 4.0f, 0.0f, 7.0f, 3.0f, 0.0f,
+	6.0f, 4.0f, 0.0f, 6.0f, 5.0f, 0.0f, 7.0f, 5.0f,
+	0.0f, 7.0f, 4.0f, 0.0f, 6.0f, 7.0f, 0.0f, 6.0f,
+	8.0f, 0.0f, 7.0f, 8.0f, 0.0f, 7.0f, 7.0f, 0.0f,
+	6.0f, 8.0f, 0.0f, 6.0f, 9.0f, 0.0f, 7.0f, 9.0f,
+	0.0f, 7.0f, 8.0f, 0.0f, 6.0f, 9.0f, 0.0f, 6.0f,
+	10.0f, 0.0f, 7.0f, 10.0f, 0.0f, 7.0f, 9.0f, 0.0f,
+	7.0f, 0.0f, 0.0f, 7.0f, 1.0f, 0.0f, 8.0f, 1.0f,
+	0.0f, 8.0f, 0.0f, 0.0f, 7.0f, 1.0f, 0.0f, 7.0f,
+	2.0f, 0.0f, 8.0f, 2.0f, 0.0f, 8.0f, 1.0f, 0.0f,
+	7.0f, 2.0f, 0.0f, 7.0f, 3.0f, 0.0f, 8.0f, 3.0f,
+	0.0f, 8.0f, 2.0f, 0.0f, 7.0f, 3.0f, 0.0f, 7.0f,
+	4.0f, 0.0f, 8.0f, 4.0f, 0.0f, 8.0f, 3.0f, 0.0f,
+	7.0f, 4.0f, 0.0f, 7.0f, 5.0f, 0.0f, 8.0f, 5.0f,
+	0.0f, 8.0f, 4.0f, 0.0f, 7.0f, 7.0f, 0.0f, 7.0f,
+	8.0f, 0.0f, 8.0f, 8.0f, 0.0f, 8.0f, 7.0f, 0.0f,
+	7.0f, 8.0f, 0.0f, 7.0f, 9.0f, 0.0f, 8.0f, 9.0f,
+	0.0f, 8.0f, 8.0f, 0.0f, 7.0f, 9.0f, 0.0f, 7.0f,
+	10.0f, 0.0f, 8.0f, 10.0f, 0.0f, 8.0f, 9.0f, 0.0f,
+	8.0f, 0.0f, 0.0f, 8.0f, 1.0f, 0.0f, 9.0f, 1.0f,
+	0.0f, 9.0f, 0.0f, 0.0f, 8.0f, 1.0f, 0.0f, 8.0f,
+	2.0f, 0.0f, 9.0f, 2.0f, 0.0f, 9.0f, 1.0f, 0.0f,
+	8.0f, 2.0f, 0.0f, 8.0f, 3.0f, 0.0f, 9.0f, 3.0f,
+	0.0f, 9.0f, 2.0f, 0.0f, 8.0f, 3.0f, 0.0f, 8.0f,
+	4.0f, 0.0f, 9.0f, 4.0f, 0.0f, 9.0f, 3.0f, 0.0f,
+	8.0f, 4.0f, 0.0f, 8.0f, 5.0f, 0.0f, 9.0f, 5.0f,
+	0.0f, 9.0f, 4.0f, 0.0f, 8.0f, 7.0f, 0.0f, 8.0f,
+	8.0f, 0.0f, 9.0f, 8.0f, 0.0f, 9.0f, 7.0f, 0.0f,
+	8.0f, 8.0f, 0.0f, 8.0f, 9.0f, 0.0f, 9.0f, 9.0f,
+	0.0f, 9.0f, 8.0f, 0.0f, 8.0f, 9.0f, 0.0f, 8.0f,
+	10.0f, 0.0f, 9.0f, 10.0f, 0.0f, 9.0f, 9.0f, 0.0f,
+	9.0f, 0.0f, 0.0f, 9.0f, 1.0f, 0.0f, 10.0f, 1.0f,
+	0.0f, 10.0f, 0.0f, 0.0f, 9.0f, 1.0f, 0.0f, 9.0f,
+	2.0f, 0.0f, 10.0f, 2.0f, 0.0f, 10.0f, 1.0f, 0.0f,
+	9.0f, 2.0f, 0.0f, 9.0f, 3.0f, 0.0f, 10.0f, 3.0f,
+	0.0f, 10.0f, 2.0f, 0.0f, 9.0f, 3.0f, 0.0f, 9.0f,
+	4.0f, 0.0f, 10.0f, 4.0f, 0.0f, 10.0f, 3.0f, 0.0f,
+	9.0f, 4.0f, 0.0f, 9.0f, 5.0f, 0.0f, 10.0f, 5.0f,
+	0.0f, 10.0f, 4.0f, 0.0f, 9.0f, 7.0f, 0.0f, 9.0f,
+	8.0f, 0.0f, 10.0f, 8.0f, 0.0f, 10.0f, 7.0f, 0.0f,
+	9.0f, 8.0f, 0.0f, 9.0f, 9.0f, 0.0f, 10.0f, 9.0f,
+	0.0f, 10.0f, 8.0f, 0.0f, 9.0f, 9.0f, 0.0f, 9.0f,
+	10.0f, 0.0f, 10.0f, 10.0f, 0.0f, 10.0f, 9.0f, 0.0f,
+	10.0f, 0.0f, 0.0f, 10.0f, 1.0f, 0.0f, 11.0f, 1.0f,
+	0.0f, 11.0f, 0.0f, 0.0f, 10.0f, 1.0f, 0.0f, 10.0f,
+	2.0f, 0.0f, 11.0f, 2.0f, 0.0f, 11.0f, 1.0f, 0.0f,
+	10.0f, 2.0f, 0.0f, 10.0f, 3.0f, 0.0f, 11.0f, 3.0f,
+	0.0f, 11.0f, 2.0f, 0.0f, 10.0f, 3.0f, 0.0f, 10.0f,
+	4.0f, 0.0f, 11.0f, 4.0f, 0.0f, 11.0f, 3.0f, 0.0f,
+	10.0f, 4.0f, 0.0f, 10.0f, 5.0f, 0.0f, 11.0f, 5.0f,
+	0.0f, 11.0f, 4.0f, 0.0f, 10.0f, 7.0f, 0.0f, 10.0f,
+	8.0f, 0.0f, 11.0f, 8.0f, 0.0f, 11.0f, 7.0f, 0.0f,
+	10.0f, 8.0f, 0.0f, 10.0f, 9.0f, 0.0f, 11.0f, 9.0f,
+	0.0f, 11.0f, 8.0f, 0.0f, 10.0f, 9.0f, 0.0f, 10.0f,
+	10.0f, 0.0f, 11.0f, 10.0f, 0.0f, 11.0f, 9.0f, 0.0f,
+	11.0f, 0.0f, 0.0f, 11.0f, 1.0f, 0.0f, 12.0f, 1.0f,
+	0.0f, 12.0f, 0.0f, 0.0f, 11.0f, 1.0f, 0.0f, 11.0f,
+	2.0f, 0.0f, 12.0f, 2.0f, 0.0f, 12.0f, 1.0f, 0.0f,
+	11.0f, 2.0f, 0.0f, 11.0f, 3.0f, 0.0f, 12.0f, 3.0f,
+	0.0f, 12.0f, 2.0f, 0.0f, 11.0f, 3.0f, 0.0f, 11.0f,
+	4.0f, 0.0f, 12.0f, 4.0f, 0.0f, 12.0f, 3.0f, 0.0f,
+	11.0f, 4.0f, 0.0f, 11.0f, 5.0f, 0.0f, 12.0f, 5.0f,
+	0.0f, 12.0f, 4.0f, 0.0f, 11.0f, 7.0f, 0.0f, 11.0f,
+	8.0f, 0.0f, 12.0f, 8.0f, 0.0f, 12.0f, 7.0f, 0.0f,
+	11.0f, 8.0f, 0.0f, 11.0f, 9.0f, 0.0f, 12.0f, 9.0f,
+	0.0f, 12.0f, 8.0f, 0.0f, 11.0f, 9.0f, 0.0f, 11.0f,
+	10.0f, 0.0f, 12.0f, 10.0f, 0.0f, 12.0f, 9.0f, 0.0f,
+	12.0f, 0.0f, 0.0f, 12.0f, 1.0f, 0.0f, 13.0f, 1.0f,
+	0.0f, 13.0f, 0.0f, 0.0f, 12.0f, 1.0f, 0.0f, 12.0f,
+	2.0f, 0.0f, 13.0f, 2.0f, 0.0f, 13.0f, 1.0f, 0.0f,
+	12.0f, 2.0f, 0.0f, 12.0f, 3.0f, 0.0f, 13.0f, 3.0f,
+	0.0f, 13.0f, 2.0f, 0.0f, 12.0f, 3.0f, 0.0f, 12.0f,
+	4.0f, 0.0f, 13.0f, 4.0f, 0.0f, 13.0f, 3.0f, 0.0f,
+	12.0f, 4.0f, 0.0f, 12.0f, 5.0f, 0.0f, 13.0f, 5.0f,
+	0.0f, 13.0f, 4.0f, 0.0f, 12.0f, 7.0f, 0.0f, 12.0f,
+	8.0f, 0.0f, 13.0f, 8.0f, 0.0f, 13.0f, 7.0f, 0.0f,
+	12.0f, 8.0f, 0.0f, 12.0f, 9.0f, 0.0f, 13.0f, 9.0f,
+	0.0f, 13.0f, 8.0f, 0.0f, 12.0f, 9.0f, 0.0f, 12.0f,
+	10.0f, 0.0f, 13.0f, 10.0f, 0.0f, 13.0f, 9.0f, 0.0f,
+	13.0f, 0.0f, 0.0f, 13.0f, 1.0f, 0.0f, 14.0f, 1.0f,
+	0.0f, 14.0f, 0.0f, 0.0f, 13.0f, 1.0f, 0.0f, 13.0f,
+	2.0f, 0.0f, 14.0f, 2.0f, 0.0f, 14.0f, 1.0f, 0.0f,
+	13.0f, 2.0f, 0.0f, 13.0f, 3.0f, 0.0f, 14.0f, 3.0f,
+	0.0f, 14.0f, 2.0f, 0.0f, 13.0f, 3.0f, 0.0f, 13.0f,
+	4.0f, 0.0f, 14.0f, 4.0f, 0.0f, 14.0f, 3.0f, 0.0f,
+	13.0f, 4.0f, 0.0f, 13.0f, 5.0f, 0.0f, 14.0f, 5.0f,
+	0.0f, 14.0f, 4.0f, 0.0f, 13.0f, 7.0f, 0.0f, 13.0f,
+	8.0f, 0.0f, 14.0f, 8.0f, 0.0f, 14.0f, 7.0f, 0.0f,
+	13.0f, 8.0f, 0.0f, 13.0f, 9.0f, 0.0f, 14.0f, 9.0f,
+	0.0f, 14.0f, 8.0f, 0.0f, 13.0f, 9.0f, 0.0f, 13.0f,
+	10.0f, 0.0f, 14.0f, 10.0f, 0.0f, 14.0f, 9.0f, 0.0f,
+	14.0f, 0.0f, 0.0f, 14.0f, 1.0f, 0.0f, 15.0f, 1.0f,
+	0.0f, 15.0f, 0.0f, 0.0f, 14.0f, 1.0f, 0.0f, 14.0f,
+	2.0f, 0.0f, 15.0f, 2.0f, 0.0f, 15.0f, 1.0f, 0.0f,
+	14.0f, 2.0f, 0.0f, 14.0f, 3.0f, 0.0f, 15.0f, 3.0f,
+	0.0f, 15.0f, 2.0f, 0.0f, 14.0f, 3.0f, 0.0f, 14.0f,
+	4.0f, 0.0f, 15.0f, 4.0f, 0.0f, 15.0f, 3.0f, 0.0f,
+	14.0f, 4.0f, 0.0f, 14.0f, 5.0f, 0.0f, 15.0f, 5.0f,
+	0.0f, 15.0f, 4.0f, 0.0f, 14.0f, 5.0f, 0.0f, 14.0f,
+	6.0f, 0.0f, 15.0f, 6.0f, 0.0f, 15.0f, 5.0f, 0.0f,
+	14.0f, 6.0f, 0.0f, 14.0f, 7.0f, 0.0f, 15.0f, 7.0f,
+	0.0f, 15.0f, 6.0f, 0.0f, 14.0f, 7.0f, 0.0f, 14.0f,
+	8.0f, 0.0f, 15.0f, 8.0f, 0.0f, 15.0f, 7.0f, 0.0f,
+	14.0f, 8.0f, 0.0f, 14.0f, 9.0f, 0.0f, 15.0f, 9.0f,
+	0.0f, 15.0f, 8.0f, 0.0f, 14.0f, 9.0f, 0.0f, 14.0f,
+	10.0f, 0.0f, 15.0f, 10.0f, 0.0f, 15.0f, 9.0f, 0.0f,
+	15.0f, 0.0f, 0.0f, 15.0f, 1.0f, 0.0f, 16.0f, 1.0f,
+	0.0f, 16.0f, 0.0f, 0.0f, 15.0f, 1.0f, 0.0f, 15.0f,
+	2.0f, 0.0f, 16.0f, 2.0f, 0.0f, 16.0f, 1.0f, 0.0f,
+	15.0f, 2.0f, 0.0f, 15.0f, 3.0f, 0.0f, 16.0f, 3.0f,
+	0.0f, 16.0f, 2.0f, 0.0f, 15.0f, 3.0f, 0.0f, 15.0f,
+	4.0f, 0.0f, 16.0f, 4.0f, 0.0f, 16.0f, 3.0f, 0.0f,
+	15.0f, 4.0f, 0.0f, 15.0f, 5.0f, 0.0f, 16.0f, 5.0f,
+	0.0f, 16.0f, 4.0f, 0.0f, 15.0f, 5.0f, 0.0f, 15.0f,
+	6.0f, 0.0f, 16.0f, 6.0f, 0.0f, 16.0f, 5.0f, 0.0f,
+	15.0f, 6.0f, 0.0f, 15.0f, 7.0f, 0.0f, 16.0f, 7.0f,
+	0.0f, 16.0f, 6.0f, 0.0f, 15.0f, 7.0f, 0.0f, 15.0f,
+	8.0f, 0.0f, 16.0f, 8.0f, 0.0f, 16.0f, 7.0f, 0.0f,
+	15.0f, 8.0f, 0.0f, 15.0f, 9.0f, 0.0f, 16.0f, 9.0f,
+	0.0f, 16.0f, 8.0f, 0.0f, 15.0f, 9.0f, 0.0f, 15.0f,
+	10.0f, 0.0f, 16.0f, 10.0f, 0.0f, 16.0f, 9.0f, 0.0f,
+	16.0f, 0.0f, 0.0f, 16.0f, 1.0f, 0.0f, 17.0f, 1.0f,
+	0.0f, 17.0f, 0.0f, 0.0f, 16.0f, 1.0f, 0.0f, 16.0f,
+	2.0f, 0.0f, 17.0f, 2.0f, 0.0f, 17.0f, 1.0f, 0.0f,
+	16.0f, 2.0f, 0.0f, 16.0f, 3.0f, 0.0f, 17.0f, 3.0f,
+	0.0f, 17.0f, 2.0f, 0.0f, 16.0f, 3.0f, 0.0f, 16.0f,
+	4.0f, 0.0f, 17.0f, 4.0f, 0.0f, 17.0f, 3.0f, 0.0f,
+	16.0f, 4.0f, 0.0f, 16.0f, 5.0f, 0.0f, 17.0f, 5.0f,
+	0.0f, 17.0f, 4.0f, 0.0f, 16.0f, 5.0f, 0.0f, 16.0f,
+	6.0f, 0.0f, 17.0f, 6.0f, 0.0f, 17.0f, 5.0f, 0.0f,
+	16.0f, 6.0f, 0.0f, 16.0f, 7.0f, 0.0f, 17.0f, 7.0f,
+	0.0f, 17.0f, 6.0f, 0.0f, 16.0f, 7.0f, 0.0f, 16.0f,
+	8.0f, 0.0f, 17.0f, 8.0f, 0.0f, 17.0f, 7.0f, 0.0f,
+	16.0f, 8.0f, 0.0f, 16.0f, 9.0f, 0.0f, 17.0f, 9.0f,
+	0.0f, 17.0f, 8.0f, 0.0f, 16.0f, 9.0f, 0.0f, 16.0f,
+	10.0f, 0.0f, 17.0f, 10.0f, 0.0f, 17.0f, 9.0f, 0.0f,
+	17.0f, 0.0f, 0.0f, 17.0f, 1.0f, 0.0f, 18.0f, 1.0f,
+	0.0f, 18.0f, 0.0f, 0.0f, 17.0f, 1.0f, 0.0f, 17.0f,
+	2.0f, 0.0f, 18.0f, 2.0f, 0.0f, 18.0f, 1.0f, 0.0f,
+	17.0f, 2.0f, 0.0f, 17.0f, 3.0f, 0.0f, 18.0f, 3.0f,
+	0.0f, 18.0f, 2.0f, 0.0f, 17.0f, 3.0f, 0.0f, 17.0f,
+	4.0f, 0.0f, 18.0f, 4.0f, 0.0f, 18.0f, 3.0f, 0.0f,
+	17.0f, 4.0f, 0.0f, 17.0f, 5.0f, 0.0f, 18.0f, 5.0f,
+	0.0f, 18.0f, 4.0f, 0.0f, 17.0f, 5.0f, 0.0f, 17.0f,
+	6.0f, 0.0f, 18.0f, 6.0f, 0.0f, 18.0f, 5.0f, 0.0f,
+	17.0f, 6.0f, 0.0f, 17.0f, 7.0f, 0.0f, 18.0f, 7.0f,
+	0.0f, 18.0f, 6.0f, 0.0f, 17.0f, 7.0f, 0.0f, 17.0f,
+	8.0f, 0.0f, 18.0f, 8.0f, 0.0f, 18.0f, 7.0f, 0.0f,
+	17.0f, 8.0f, 0.0f, 17.0f, 9.0f, 0.0f, 18.0f, 9.0f,
+	0.0f, 18.0f, 8.0f, 0.0f, 17.0f, 9.0f, 0.0f, 17.0f,
+	10.0f, 0.0f, 18.0f, 10.0f, 0.0f, 18.0f, 9.0f, 0.0f,
+	18.0f, 0.0f, 0.0f, 18.0f, 1.0f, 0.0f, 19.0f, 1.0f,
+	0.0f, 19.0f, 0.0f, 0.0f, 18.0f, 1.0f, 0.0f, 18.0f,
+	2.0f, 0.0f, 19.0f, 2.0f, 0.0f, 19.0f, 1.0f, 0.0f,
+	18.0f, 2.0f, 0.0f, 18.0f, 3.0f, 0.0f, 19.0f, 3.0f,
+	0.0f, 19.0f, 2.0f, 0.0f, 18.0f, 3.0f, 0.0f, 18.0f,
+	4.0f, 0.0f, 19.0f, 4.0f, 0.0f, 19.0f, 3.0f, 0.0f,
+	18.0f, 4.0f, 0.0f, 18.0f, 5.0f, 0.0f, 19.0f, 5.0f,
+	0.0f, 19.0f, 4.0f, 0.0f, 18.0f, 5.0f, 0.0f, 18.0f,
+	6.0f, 0.0f, 19.0f, 6.0f, 0.0f, 19.0f, 5.0f, 0.0f,
+	18.0f, 6.0f, 0.0f, 18.0f, 7.0f, 0.0f, 19.0f, 7.0f,
+	0.0f, 19.0f, 6.0f, 0.0f, 18.0f, 7.0f, 0.0f, 18.0f,
+	8.0f, 0.0f, 19.0f, 8.0f, 0.0f, 19.0f, 7.0f, 0.0f,
+	18.0f, 8.0f, 0.0f, 18.0f, 9.0f, 0.0f, 19.0f, 9.0f,
+	0.0f, 19.0f, 8.0f, 0.0f, 18.0f, 9.0f, 0.0f, 18.0f,
+	10.0f, 0.0f, 19.0f, 10.0f, 0.0f, 19.0f, 9.0f, 0.0f,
+	19.0f, 0.0f, 0.0f, 19.0f, 1.0f, 0.0f, 20.0f, 1.0f,
+	0.0f, 20.0f, 0.0f, 0.0f, 19.0f, 1.0f, 0.0f, 19.0f,
+	2.0f, 0.0f, 20.0f, 2.0f, 0.0f, 20.0f, 1.0f, 0.0f,
+	19.0f, 2.0f, 0.0f, 19.0f, 3.0f, 0.0f, 20.0f, 3.0f,
+	0.0f, 20.0f, 2.0f, 0.0f, 19.0f, 3.0f, 0.0f, 19.0f,
+	4.0f, 0.0f, 20.0f, 4.0f, 0.0f, 20.0f, 3.0f, 0.0f,
+	19.0f, 4.0f, 0.0f, 19.0f, 5.0f, 0.0f, 20.0f, 5.0f,
+	0.0f, 20.0f, 4.0f, 0.0f, 19.0f, 5.0f, 0.0f, 19.0f,
+	6.0f, 0.0f, 20.0f, 6.0f, 0.0f, 20.0f, 5.0f, 0.0f,
+	19.0f, 6.0f, 0.0f, 19.0f, 7.0f, 0.0f, 20.0f, 7.0f,
+	0.0f, 20.0f, 6.0f, 0.0f, 19.0f, 7.0f, 0.0f, 19.0f,
+	8.0f, 0.0f, 20.0f, 8.0f, 0.0f, 20.0f, 7.0f, 0.0f,
+	19.0f, 8.0f, 0.0f, 19.0f, 9.0f, 0.0f, 20.0f, 9.0f,
+	0.0f, 20.0f, 8.0f, 0.0f, 19.0f, 9.0f, 0.0f, 19.0f,
+	10.0f, 0.0f, 20.0f, 10.0f, 0.0f, 20.0f, 9.0f, 0.0f
+};
+static const float wallNormals[2208] =
+{
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f
+};
+static const float wallTexCoords[1472] =
+{
+	0.0f, 0.0f, 0.1f, 0.0f, 0.1f, 0.05f, 0.0f, 0.05f,
+	0.1f, 0.0f, 0.2f, 0.0f, 0.2f, 0.05f, 0.1f, 0.05f,
+	0.2f, 0.0f, 0.3f, 0.0f, 0.3f, 0.05f, 0.2f, 0.05f,
+	0.3f, 0.0f, 0.4f, 0.0f, 0.4f, 0.05f, 0.3f, 0.05f,
+	0.4f, 0.0f, 0.5f, 0.0f, 0.5f, 0.05f, 0.4f, 0.05f,
+	0.5f, 0.0f, 0.6f, 0.0f, 0.6f, 0.05f, 0.5f, 0.05f,
+	0.6f, 0.0f, 0.7f, 0.0f, 0.7f, 0.05f, 0.6f, 0.05f,
+	0.7f, 0.0f, 0.8f, 0.0f, 0.8f, 0.05f, 0.7f, 0.05f,
+	0.8f, 0.0f, 0.90000004f, 0.0f, 0.90000004f, 0.05f, 0.8f, 0.05f,
+	0.90000004f, 0.0f, 1.0f, 0.0f, 1.0f, 0.05f, 0.90000004f, 0.05f,
+	0.0f, 0.05f, 0.1f, 0.05f, 0.1f, 0.1f, 0.0f, 0.1f,
+	0.1f, 0.05f, 0.2f, 0.05f, 0.2f, 0.1f, 0.1f, 0.1f,
+	0.2f, 0.05f, 0.3f, 0.05f, 0.3f, 0.1f, 0.2f, 0.1f,
+	0.3f, 0.05f, 0.4f, 0.05f, 0.4f, 0.1f, 0.3f, 0.1f,
+	0.4f, 0.05f, 0.5f, 0.05f, 0.5f, 0.1f, 0.4f, 0.1f,
+	0.5f, 0.05f, 0.6f, 0.05f, 0.6f, 0.1f, 0.5f, 0.1f,
+	0.6f, 0.05f, 0.7f, 0.05f, 0.7f, 0.1f, 0.6f, 0.1f,
+	0.7f, 0.05f, 0.8f, 0.05f, 0.8f, 0.1f, 0.7f, 0.1f,
+	0.8f, 0.05f, 0.90000004f, 0.05f, 0.90000004f, 0.1f, 0.8f, 0.1f,
+	0.90000004f, 0.05f, 1.0f, 0.05f, 1.0f, 0.1f, 0.90000004f, 0.1f,
+	0.0f, 0.1f, 0.1f, 0.1f, 0.1f, 0.15f, 0.0f, 0.15f,
+	0.1f, 0.1f, 0.2f, 0.1f, 0.2f, 0.15f, 0.1f, 0.15f,
+	0.2f, 0.1f, 0.3f, 0.1f, 0.3f, 0.15f, 0.2f, 0.15f,
+	0.3f, 0.1f, 0.4f, 0.1f, 0.4f, 0.15f, 0.3f, 0.15f,
+	0.4f, 0.1f, 0.5f, 0.1f, 0.5f, 0.15f, 0.4f, 0.15f,
+	0.5f, 0.1f, 0.6f, 0.1f, 0.6f, 0.15f, 0.5f, 0.15f,
+	0.6f, 0.1f, 0.7f, 0.1f, 0.7f, 0.15f, 0.6f, 0.15f,
+	0.7f, 0.1f, 0.8f, 0.1f, 0.8f, 0.15f, 0.7f, 0.15f,
+	0.8f, 0.1f, 0.90000004f, 0.1f, 0.90000004f, 0.15f, 0.8f, 0.15f,
+	0.90000004f, 0.1f, 1.0f, 0.1f, 1.0f, 0.15f, 0.90000004f, 0.15f,
+	0.0f, 0.15f, 0.1f, 0.15f, 0.1f, 0.2f, 0.0f, 0.2f,
+	0.1f, 0.15f, 0.2f, 0.15f, 0.2f, 0.2f, 0.1f, 0.2f,
+	0.2f, 0.15f, 0.3f, 0.15f, 0.3f, 0.2f, 0.2f, 0.2f,
+	0.3f, 0.15f, 0.4f, 0.15f, 0.4f, 0.2f, 0.3f, 0.2f,
+	0.4f, 0.15f, 0.5f, 0.15f, 0.5f, 0.2f, 0.4f, 0.2f,
+	0.5f, 0.15f, 0.6f, 0.15f, 0.6f, 0.2f, 0.5f, 0.2f,
+	0.6f, 0.15f, 0.7f, 0.15f, 0.7f, 0.2f, 0.6f, 0.2f,
+	0.7f, 0.15f, 0.8f, 0.15f, 0.8f, 0.2f, 0.7f, 0.2f,
+	0.8f, 0.15f, 0.90000004f, 0.15f, 0.90000004f, 0.2f, 0.8f, 0.2f,
+	0.90000004f, 0.15f, 1.0f, 0.15f, 1.0f, 0.2f, 0.90000004f, 0.2f,
+	0.0f, 0.2f, 0.1f, 0.2f, 0.1f, 0.25f, 0.0f, 0.25f,
+	0.1f, 0.2f, 0.2f, 0.2f, 0.2f, 0.25f, 0.1f, 0.25f,
+	0.2f, 0.2f, 0.3f, 0.2f, 0.3f, 0.25f, 0.2f, 0.25f,
+	0.3f, 0.2f, 0.4f, 0.2f, 0.4f, 0.25f, 0.3f, 0.25f,
+	0.4f, 0.2f, 0.5f, 0.2f, 0.5f, 0.25f, 0.4f, 0.25f,
+	0.5f, 0.2f, 0.6f, 0.2f, 0.6f, 0.25f, 0.5f, 0.25f,
+	0.6f, 0.2f, 0.7f, 0.2f, 0.7f, 0.25f, 0.6f, 0.25f,
+	0.7f, 0.2f, 0.8f, 0.2f, 0.8f, 0.25f, 0.7f, 0.25f,
+	0.8f, 0.2f, 0.90000004f, 0.2f, 0.90000004f, 0.25f, 0.8f, 0.25f,
+	0.90000004f, 0.2f, 1.0f, 0.2f, 1.0f, 0.25f, 0.90000004f, 0.25f,
+	0.0f, 0.25f, 0.1f, 0.25f, 0.1f, 0.3f, 0.0f, 0.3f,
+	0.1f, 0.25f, 0.2f, 0.25f, 0.2f, 0.3f, 0.1f, 0.3f,
+	0.2f, 0.25f, 0.3f, 0.25f, 0.3f, 0.3f, 0.2f, 0.3f,
+	0.3f, 0.25f, 0.4f, 0.25f, 0.4f, 0.3f, 0.3f, 0.3f,
+	0.4f, 0.25f, 0.5f, 0.25f, 0.5f, 0.3f, 0.4f, 0.3f,
+	0.5f, 0.25f, 0.6f, 0.25f, 0.6f, 0.3f, 0.5f, 0.3f,
+	0.6f, 0.25f, 0.7f, 0.25f, 0.7f, 0.3f, 0.6f, 0.3f,
+	0.7f, 0.25f, 0.8f, 0.25f, 0.8f, 0.3f, 0.7f, 0.3f,
+	0.8f, 0.25f, 0.90000004f, 0.25f, 0.90000004f, 0.3f, 0.8f, 0.3f,
+	0.90000004f, 0.25f, 1.0f, 0.25f, 1.0f, 0.3f, 0.90000004f, 0.3f,
+	0.0f, 0.3f, 0.1f, 0.3f, 0.1f, 0.35f, 0.0f, 0.35f,
+	0.1f, 0.3f, 0.2f, 0.3f, 0.2f, 0.35f, 0.1f, 0.35f,
+	0.2f, 0.3f, 0.3f, 0.3f, 0.3f, 0.35f, 0.2f, 0.35f,
+	0.3f, 0.3f, 0.4f, 0.3f, 0.4f, 0.35f, 0.3f, 0.35f,
+	0.4f, 0.3f, 0.5f, 0.3f, 0.5f, 0.35f, 0.4f, 0.35f,
+	0.7f, 0.3f, 0.8f, 0.3f, 0.8f, 0.35f, 0.7f, 0.35f,
+	0.8f, 0.3f, 0.90000004f, 0.3f, 0.90000004f, 0.35f, 0.8f, 0.35f,
+	0.90000004f, 0.3f, 1.0f, 0.3f, 1.0f, 0.35f, 0.90000004f, 0.35f,
+	0.0f, 0.35f, 0.1f, 0.35f, 0.1f, 0.4f, 0.0f, 0.4f,
+	0.1f, 0.35f, 0.2f, 0.35f, 0.2f, 0.4f, 0.1f, 0.4f,
+	0.2f, 0.35f, 0.3f, 0.35f, 0.3f, 0.4f, 0.2f, 0.4f,
+	0.3f, 0.35f, 0.4f, 0.35f, 0.4f, 0.4f, 0.3f, 0.4f,
+	0.4f, 0.35f, 0.5f, 0.35f, 0.5f, 0.4f, 0.4f, 0.4f,
+	0.7f, 0.35f, 0.8f, 0.35f, 0.8f, 0.4f, 0.7f, 0.4f,
+	0.8f, 0.35f, 0.90000004f, 0.35f, 0.90000004f, 0.4f, 0.8f, 0.4f,
+	0.90000004f, 0.35f, 1.0f, 0.35f, 1.0f, 0.4f, 0.90000004f, 0.4f,
+	0.0f, 0.4f, 0.1f, 0.4f, 0.1f, 0.45000002f, 0.0f, 0.45000002f,
+	0.1f, 0.4f, 0.2f, 0.4f, 0.2f, 0.45000002f, 0.1f, 0.45000002f,
+	0.2f, 0.4f, 0.3f, 0.4f, 0.3f, 0.45000002f, 0.2f, 0.45000002f,
+	0.3f, 0.4f, 0.4f, 0.4f, 0.4f, 0.45000002f, 0.3f, 0.45000002f,
+	0.4f, 0.4f, 0.5f, 0.4f, 0.5f, 0.45000002f, 0.4f, 0.45000002f,
+	0.7f, 0.4f, 0.8f, 0.4f, 0.8f, 0.45000002f, 0.7f, 0.45000002f,
+	0.8f, 0.4f, 0.90000004f, 0.4f, 0.90000004f, 0.45000002f, 0.8f, 0.45000002f,
+	0.90000004f, 0.4f, 1.0f, 0.4f, 1.0f, 0.45000002f, 0.90000004f, 0.45000002f,
+	0.0f, 0.45000002f, 0.1f, 0.45000002f, 0.1f, 0.5f, 0.0f, 0.5f,
+	0.1f, 0.45000002f, 0.2f, 0.45000002f, 0.2f, 0.5f, 0.1f, 0.5f,
+	0.2f, 0.45000002f, 0.3f, 0.45000002f, 0.3f, 0.5f, 0.2f, 0.5f,
+	0.3f, 0.45000002f, 0.4f, 0.45000002f, 0.4f, 0.5f, 0.3f, 0.5f,
+	0.4f, 0.45000002f, 0.5f, 0.45000002f, 0.5f, 0.5f, 0.4f, 0.5f,
+	0.7f, 0.45000002f, 0.8f, 0.45000002f, 0.8f, 0.5f, 0.7f, 0.5f,
+	0.8f, 0.45000002f, 0.90000004f, 0.45000002f, 0.90000004f, 0.5f, 0.8f, 0.5f,
+	0.90000004f, 0.45000002f, 1.0f, 0.45000002f, 1.0f, 0.5f, 0.90000004f, 0.5f,
+	0.0f, 0.5f, 0.1f, 0.5f, 0.1f, 0.55f, 0.0f, 0.55f,
+	0.1f, 0.5f, 0.2f, 0.5f, 0.2f, 0.55f, 0.1f, 0.55f,
+	0.2f, 0.5f, 0.3f, 0.5f, 0.3f, 0.55f, 0.2f, 0.55f,
+	0.3f, 0.5f, 0.4f, 0.5f, 0.4f, 0.55f, 0.3f, 0.55f,
+	0.4f, 0.5f, 0.5f, 0.5f, 0.5f, 0.55f, 0.4f, 0.55f,
+	0.7f, 0.5f, 0.8f, 0.5f, 0.8f, 0.55f, 0.7f, 0.55f,
+	0.8f, 0.5f, 0.90000004f, 0.5f, 0.90000004f, 0.55f, 0.8f, 0.55f,
+	0.90000004f, 0.5f, 1.0f, 0.5f, 1.0f, 0.55f, 0.90000004f, 0.55f,
+	0.0f, 0.55f, 0.1f, 0.55f, 0.1f, 0.6f, 0.0f, 0.6f,
+	0.1f, 0.55f, 0.2f, 0.55f, 0.2f, 0.6f, 0.1f, 0.6f,
+	0.2f, 0.55f, 0.3f, 0.55f, 0.3f, 0.6f, 0.2f, 0.6f,
+	0.3f, 0.55f, 0.4f, 0.55f, 0.4f, 0.6f, 0.3f, 0.6f,
+	0.4f, 0.55f, 0.5f, 0.55f, 0.5f, 0.6f, 0.4f, 0.6f,
+	0.7f, 0.55f, 0.8f, 0.55f, 0.8f, 0.6f, 0.7f, 0.6f,
+	0.8f, 0.55f, 0.90000004f, 0.55f, 0.90000004f, 0.6f, 0.8f, 0.6f,
+	0.90000004f, 0.55f, 1.0f, 0.55f, 1.0f, 0.6f, 0.90000004f, 0.6f,
+	0.0f, 0.6f, 0.1f, 0.6f, 0.1f, 0.65000004f, 0.0f, 0.65000004f,
+	0.1f, 0.6f, 0.2f, 0.6f, 0.2f, 0.65000004f, 0.1f, 0.65000004f,
+	0.2f, 0.6f, 0.3f, 0.6f, 0.3f, 0.65000004f, 0.2f, 0.65000004f,
+	0.3f, 0.6f, 0.4f, 0.6f, 0.4f, 0.65000004f, 0.3f, 0.65000004f,
+	0.4f, 0.6f, 0.5f, 0.6f, 0.5f, 0.65000004f, 0.4f, 0.65000004f,
+	0.7f, 0.6f, 0.8f, 0.6f, 0.8f, 0.65000004f, 0.7f, 0.65000004f,
+	0.8f, 0.6f, 0.90000004f, 0.6f, 0.90000004f, 0.65000004f, 0.8f, 0.65000004f,
+	0.90000004f, 0.6f, 1.0f, 0.6f, 1.0f, 0.65000004f, 0.90000004f, 0.65000004f,
+	0.0f, 0.65000004f, 0.1f, 0.65000004f, 0.1f, 0.7f, 0.0f, 0.7f,
+	0.1f, 0.65000004f, 0.2f, 0.65000004f, 0.2f, 0.7f, 0.1f, 0.7f,
+	0.2f, 0.65000004f, 0.3f, 0.65000004f, 0.3f, 0.7f, 0.2f, 0.7f,
+	0.3f, 0.65000004f, 0.4f, 0.65000004f, 0.4f, 0.7f, 0.3f, 0.7f,
+	0.4f, 0.65000004f, 0.5f, 0.65000004f, 0.5f, 0.7f, 0.4f, 0.7f,
+	0.7f, 0.65000004f, 0.8f, 0.65000004f, 0.8f, 0.7f, 0.7f, 0.7f,
+	0.8f, 0.65000004f, 0.90000004f, 0.65000004f, 0.90000004f, 0.7f, 0.8f, 0.7f,
+	0.90000004f, 0.65000004f, 1.0f, 0.65000004f, 1.0f, 0.7f, 0.90000004f, 0.7f,
+	0.0f, 0.7f, 0.1f, 0.7f, 0.1f, 0.75f, 0.0f, 0.75f,
+	0.1f, 0.7f, 0.2f, 0.7f, 0.2f, 0.75f, 0.1f, 0.75f,
+	0.2f, 0.7f, 0.3f, 0.7f, 0.3f, 0.75f, 0.2f, 0.75f,
+	0.3f, 0.7f, 0.4f, 0.7f, 0.4f, 0.75f, 0.3f, 0.75f,
+	0.4f, 0.7f, 0.5f, 0.7f, 0.5f, 0.75f, 0.4f, 0.75f,
+	0.5f, 0.7f, 0.6f, 0.7f, 0.6f, 0.75f, 0.5f, 0.75f,
+	0.6f, 0.7f, 0.7f, 0.7f, 0.7f, 0.75f, 0.6f, 0.75f,
+	0.7f, 0.7f, 0.8f, 0.7f, 0.8f, 0.75f, 0.7f, 0.75f,
+	0.8f, 0.7f, 0.90000004f, 0.7f, 0.90000004f, 0.75f, 0.8f, 0.75f,
+	0.90000004f, 0.7f, 1.0f, 0.7f, 1.0f, 0.75f, 0.90000004f, 0.75f,
+	0.0f, 0.75f, 0.1f, 0.75f, 0.1f, 0.8f, 0.0f, 0.8f,
+	0.1f, 0.75f, 0.2f, 0.75f, 0.2f, 0.8f, 0.1f, 0.8f,
+	0.2f, 0.75f, 0.3f, 0.75f, 0.3f, 0.8f, 0.2f, 0.8f,
+	0.3f, 0.75f, 0.4f, 0.75f, 0.4f, 0.8f, 0.3f, 0.8f,
+	0.4f, 0.75f, 0.5f, 0.75f, 0.5f, 0.8f, 0.4f, 0.8f,
+	0.5f, 0.75f, 0.6f, 0.75f, 0.6f, 0.8f, 0.5f, 0.8f,
+	0.6f, 0.75f, 0.7f, 0.75f, 0.7f, 0.8f, 0.6f, 0.8f,
+	0.7f, 0.75f, 0.8f, 0.75f, 0.8f, 0.8f, 0.7f, 0.8f,
+	0.8f, 0.75f, 0.90000004f, 0.75f, 0.90000004f, 0.8f, 0.8f, 0.8f,
+	0.90000004f, 0.75f, 1.0f, 0.75f, 1.0f, 0.8f, 0.90000004f, 0.8f,
+	0.0f, 0.8f, 0.1f, 0.8f, 0.1f, 0.85f, 0.0f, 0.85f,
+	0.1f, 0.8f, 0.2f, 0.8f, 0.2f, 0.85f, 0.1f, 0.85f,
+	0.2f, 0.8f, 0.3f, 0.8f, 0.3f, 0.85f, 0.2f, 0.85f,
+	0.3f, 0.8f, 0.4f, 0.8f, 0.4f, 0.85f, 0.3f, 0.85f,
+	0.4f, 0.8f, 0.5f, 0.8f, 0.5f, 0.85f, 0.4f, 0.85f,
+	0.5f, 0.8f, 0.6f, 0.8f, 0.6f, 0.85f, 0.5f, 0.85f,
+	0.6f, 0.8f, 0.7f, 0.8f, 0.7f, 0.85f, 0.6f, 0.85f,
+	0.7f, 0.8f, 0.8f, 0.8f, 0.8f, 0.85f, 0.7f, 0.85f,
+	0.8f, 0.8f, 0.90000004f, 0.8f, 0.90000004f, 0.85f, 0.8f, 0.85f,
+	0.90000004f, 0.8f, 1.0f, 0.8f, 1.0f, 0.85f, 0.90000004f, 0.85f,
+	0.0f, 0.85f, 0.1f, 0.85f, 0.1f, 0.90000004f, 0.0f, 0.90000004f,
+	0.1f, 0.85f, 0.2f, 0.85f, 0.2f, 0.90000004f, 0.1f, 0.90000004f,
+	0.2f, 0.85f, 0.3f, 0.85f, 0.3f, 0.90000004f, 0.2f, 0.90000004f,
+	0.3f, 0.85f, 0.4f, 0.85f, 0.4f, 0.90000004f, 0.3f, 0.90000004f,
+	0.4f, 0.85f, 0.5f, 0.85f, 0.5f, 0.90000004f, 0.4f, 0.90000004f,
+	0.5f, 0.85f, 0.6f, 0.85f, 0.6f, 0.90000004f, 0.5f, 0.90000004f,
+	0.6f, 0.85f, 0.7f, 0.85f, 0.7f, 0.90000004f, 0.6f, 0.90000004f,
+	0.7f, 0.85f, 0.8f, 0.85f, 0.8f, 0.90000004f, 0.7f, 0.90000004f,
+	0.8f, 0.85f, 0.90000004f, 0.85f, 0.90000004f, 0.90000004f, 0.8f, 0.90000004f,
+	0.90000004f, 0.85f, 1.0f, 0.85f, 1.0f, 0.90000004f, 0.90000004f, 0.90000004f,
+	0.0f, 0.90000004f, 0.1f, 0.90000004f, 0.1f, 0.95f, 0.0f, 0.95f,
+	0.1f, 0.90000004f, 0.2f, 0.90000004f, 0.2f, 0.95f, 0.1f, 0.95f,
+	0.2f, 0.90000004f, 0.3f, 0.90000004f, 0.3f, 0.95f, 0.2f, 0.95f,
+	0.3f, 0.90000004f, 0.4f, 0.90000004f, 0.4f, 0.95f, 0.3f, 0.95f,
+	0.4f, 0.90000004f, 0.5f, 0.90000004f, 0.5f, 0.95f, 0.4f, 0.95f,
+	0.5f, 0.90000004f, 0.6f, 0.90000004f, 0.6f, 0.95f, 0.5f, 0.95f,
+	0.6f, 0.90000004f, 0.7f, 0.90000004f, 0.7f, 0.95f, 0.6f, 0.95f,
+	0.7f, 0.90000004f, 0.8f, 0.90000004f, 0.8f, 0.95f, 0.7f, 0.95f,
+	0.8f, 0.90000004f, 0.90000004f, 0.90000004f, 0.90000004f, 0.95f, 0.8f, 0.95f,
+	0.90000004f, 0.90000004f, 1.0f, 0.90000004f, 1.0f, 0.95f, 0.90000004f, 0.95f,
+	0.0f, 0.95f, 0.1f, 0.95f, 0.1f, 1.0f, 0.0f, 1.0f,
+	0.1f, 0.95f, 0.2f, 0.95f, 0.2f, 1.0f, 0.1f, 1.0f,
+	0.2f, 0.95f, 0.3f, 0.95f, 0.3f, 1.0f, 0.2f, 1.0f,
+	0.3f, 0.95f, 0.4f, 0.95f, 0.4f, 1.0f, 0.3f, 1.0f,
+	0.4f, 0.95f, 0.5f, 0.95f, 0.5f, 1.0f, 0.4f, 1.0f,
+	0.5f, 0.95f, 0.6f, 0.95f, 0.6f, 1.0f, 0.5f, 1.0f,
+	0.6f, 0.95f, 0.7f, 0.95f, 0.7f, 1.0f, 0.6f, 1.0f,
+	0.7f, 0.95f, 0.8f, 0.95f, 0.8f, 1.0f, 0.7f, 1.0f,
+	0.8f, 0.95f, 0.90000004f, 0.95f, 0.90000004f, 1.0f, 0.8f, 1.0f,
+	0.90000004f, 0.95f, 1.0f, 0.95f, 1.0f, 1.0f, 0.90000004f, 1.0f
+};
+
+ShapeArrays BakedTables::wall()
+{
+	ShapeArrays arrays = { wallVertex, wallNormals, wallTexCoords, NULL, 736, 0, 1.0f, 20.0f };
+	return arrays;
+}
@@ -0,0 +1,76 @@
+#include "Bounds.h"
+#include <algorithm>
+
+Bounds::Bounds() : radius(0.0f), empty(true)
+{
+}
+
+Bounds::Bounds(const Vector3& min, const Vector3& max) : min(min), max(max), empty(false)
+{
+	Vector3 size = max;
+	size.subtract(min);
+	centre = min;
+	centre.add(size, 0.5f);
+	radius = size.length() * 0.5f;
+}
+
+Bounds Bounds::fromVertices(const float* vertex, int count)
+{
+	if (vertex == NULL || count <= 0)
+	{
+		return Bounds();
+	}
+
+	Vector3 low(vertex[0], vertex[1], vertex[2]);
+	Vector3 high = low;
+	for (int i = 1; i < count; i++)
+	{
+		const float* v = vertex + i * 3;
+		low.x = std::min(low.x, v[0]);
+		low.y = std::min(low.y, v[1]);
+		low.z = std::min(low.z, v[2]);
+		high.x = std::max(high.x, v[0]);
+		high.y = std::max(high.y, v[1]);
+		high.z = std::max(high.z, v[2]);
+	}
+	return Bounds(low, high);
+}
+
+void Bounds::add(const Bounds& other, const GLfloat* matrix)
+{
+	if (other.empty)
+	{
+		return;
+	}
+
+	// The box round the other's corners, which is itself when there's no transform.
+	float corners[8 * 3];
+	for (int i = 0; i < 8; i++)
+	{
+		float x = (i & 1) ? other.max.x : other.min.x;
+		float y = (i & 2) ? other.max.y : other.min.y;
+		float z = (i & 4) ? other.max.z : other.min.z;
+		float* corner = corners + i * 3;
+		if (matrix != NULL)
+		{
+			corner[0] = matrix[0] * x + matrix[4] * y + matrix[8] * z + matrix[12];
+			corner[1] = matrix[1] * x + matrix[5] * y + matrix[9] * z + matrix[13];
+			corner[2] = matrix[2] * x + matrix[6] * y + matrix[10] * z + matrix[14];
+		}
+		else
+		{
+			corner[0] = x;
+			corner[1] = y;
+			corner[2] = z;
+		}
+	}
+	Bounds box = fromVertices(corners, 8);
+
+	if (empty)
+	{
+		*this = box;
+		return;
+	}
+	*this = Bounds(Vector3(std::min(min.x, box.min.x), std::min(min.y, box.min.y), std::min(min.z, box.min.z)),
+		Vector3(std::max(max.x, box.max.x), std::max(max.y, box.max.y), std::max(max.z, box.max.z)));
+}
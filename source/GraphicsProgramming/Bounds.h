@@ -0,0 +1,32 @@
+// Bounds struct, an axis aligned box and the sphere round it, in the space of the vertices they were made from.
+// Made once when a mesh is loaded or generated and tested against a Frustum each draw. Empty bounds, e.g. of a model
+// still loading, are treated as covering everything so nothing is culled before it's known.
+#ifndef _BOUNDS_H_
+#define _BOUNDS_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include "Vector3.h"
+
+struct Bounds
+{
+	// Empty.
+	Bounds();
+	Bounds(const Vector3& min, const Vector3& max);
+
+	// Box round count xyz positions.
+	static Bounds fromVertices(const float* vertex, int count);
+
+	// Grows to take in other, its box transformed by matrix if it isn't NULL (column major, as glMultMatrixf).
+	void add(const Bounds& other, const GLfloat* matrix = NULL);
+
+	bool isEmpty() const { return empty; };
+
+	Vector3 min, max;
+	// Sphere round the box.
+	Vector3 centre;
+	float radius;
+	bool empty;
+};
+
+#endif
@@ -0,0 +1,308 @@
+#include "BoundsArray.h"
+#include <intrin.h>
+#include <immintrin.h>
+#include <algorithm>
+#include <limits>
+#include <math.h>
+#include <string.h>
+
+BoundsArray::Kernel BoundsArray::current = BoundsArray::Scalar;
+bool BoundsArray::chosen = false;
+
+// A plane and the size of its normal's components, as every kernel wants them.
+struct CullPlane
+{
+	float a, b, c, d;
+	float absA, absB, absC;
+};
+
+// The arrays a kernel reads, count entries padded to whole groups.
+struct CullArrays
+{
+	const float* centreX;
+	const float* centreY;
+	const float* centreZ;
+	const float* extentX;
+	const float* extentY;
+	const float* extentZ;
+	const float* radius;
+	int count;
+};
+
+// Writes n flags from a mask with a bit set for each bounds outside, returns how many were visible.
+static int storeVisible(int outside, int n, unsigned char* visible)
+{
+	int visibleCount = 0;
+	for (int k = 0; k < n; k++)
+	{
+		unsigned char flag = (unsigned char)(~outside >> k & 1);
+		visible[k] = flag;
+		visibleCount += flag;
+	}
+	return visibleCount;
+}
+
+// Bounds are outside if, for any plane, the centre's distance plus how far the box (or sphere) reaches towards the
+// plane's inside is still behind it. The wider kernels do the same sums in the same order so they agree exactly.
+static int cullScalar(const CullArrays& arrays, const CullPlane* planes, bool box, unsigned char* visible)
+{
+	int visibleCount = 0;
+	for (int i = 0; i < arrays.count; i++)
+	{
+		int outside = 0;
+		for (int p = 0; p < 6; p++)
+		{
+			const CullPlane& plane = planes[p];
+			float distance = plane.a * arrays.centreX[i] + plane.b * arrays.centreY[i] + plane.c * arrays.centreZ[i] + plane.d;
+			float reach = box ? plane.absA * arrays.extentX[i] + plane.absB * arrays.extentY[i] + plane.absC * arrays.extentZ[i] :
+				arrays.radius[i];
+			outside |= distance + reach < 0.0f ? 1 : 0;
+		}
+		visibleCount += storeVisible(outside, 1, visible + i);
+	}
+	return visibleCount;
+}
+
+// 4 bounds a step.
+static int cullSSE(const CullArrays& arrays, const CullPlane* planes, bool box, unsigned char* visible)
+{
+	__m128 a[6], b[6], c[6], d[6], absA[6], absB[6], absC[6];
+	for (int p = 0; p < 6; p++)
+	{
+		a[p] = _mm_set1_ps(planes[p].a);
+		b[p] = _mm_set1_ps(planes[p].b);
+		c[p] = _mm_set1_ps(planes[p].c);
+		d[p] = _mm_set1_ps(planes[p].d);
+		absA[p] = _mm_set1_ps(planes[p].absA);
+		absB[p] = _mm_set1_ps(planes[p].absB);
+		absC[p] = _mm_set1_ps(planes[p].absC);
+	}
+	const __m128 zero = _mm_setzero_ps();
+
+	int visibleCount = 0;
+	for (int i = 0; i < arrays.count; i += 4)
+	{
+		__m128 x = _mm_loadu_ps(arrays.centreX + i);
+		__m128 y = _mm_loadu_ps(arrays.centreY + i);
+		__m128 z = _mm_loadu_ps(arrays.centreZ + i);
+		__m128 extentX = _mm_loadu_ps(arrays.extentX + i);
+		__m128 extentY = _mm_loadu_ps(arrays.extentY + i);
+		__m128 extentZ = _mm_loadu_ps(arrays.extentZ + i);
+		__m128 radius = _mm_loadu_ps(arrays.radius + i);
+
+		__m128 outside = zero;
+		for (int p = 0; p < 6; p++)
+		{
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a[p], x), _mm_mul_ps(b[p], y)), _mm_mul_ps(c[p], z)), d[p]);
+			__m128 reach = box ? _mm_add_ps(_mm_add_ps(_mm_mul_ps(absA[p], extentX), _mm_mul_ps(absB[p], extentY)),
+				_mm_mul_ps(absC[p], extentZ)) : radius;
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, reach), zero));
+		}
+		visibleCount += storeVisible(_mm_movemask_ps(outside), std::min(4, arrays.count - i), visible + i);
+	}
+	return visibleCount;
+}
+
+// 8 bounds a step. Only uses AVX's float instructions, which VC++ emits without /arch:AVX, so the rest of the program
+// still runs on older CPUs.
+static int cullAVX(const CullArrays& arrays, const CullPlane* planes, bool box, unsigned char* visible)
+{
+	__m256 a[6], b[6], c[6], d[6], absA[6], absB[6], absC[6];
+	for (int p = 0; p < 6; p++)
+	{
+		a[p] = _mm256_set1_ps(planes[p].a);
+		b[p] = _mm256_set1_ps(planes[p].b);
+		c[p] = _mm256_set1_ps(planes[p].c);
+		d[p] = _mm256_set1_ps(planes[p].d);
+		absA[p] = _mm256_set1_ps(planes[p].absA);
+		absB[p] = _mm256_set1_ps(planes[p].absB);
+		absC[p] = _mm256_set1_ps(planes[p].absC);
+	}
+	const __m256 zero = _mm256_setzero_ps();
+
+	int visibleCount = 0;
+	for (int i = 0; i < arrays.count; i += 8)
+	{
+		__m256 x = _mm256_loadu_ps(arrays.centreX + i);
+		__m256 y = _mm256_loadu_ps(arrays.centreY + i);
+		__m256 z = _mm256_loadu_ps(arrays.centreZ + i);
+		__m256 extentX = _mm256_loadu_ps(arrays.extentX + i);
+		__m256 extentY = _mm256_loadu_ps(arrays.extentY + i);
+		__m256 extentZ = _mm256_loadu_ps(arrays.extentZ + i);
+		__m256 radius = _mm256_loadu_ps(arrays.radius + i);
+
+		__m256 outside = zero;
+		for (int p = 0; p < 6; p++)
+		{
+			__m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[p], x), _mm256_mul_ps(b[p], y)),
+				_mm256_mul_ps(c[p], z)), d[p]);
+			__m256 reach = box ? _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(absA[p], extentX), _mm256_mul_ps(absB[p], extentY)),
+				_mm256_mul_ps(absC[p], extentZ)) : radius;
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, reach), zero, _CMP_LT_OQ));
+		}
+		visibleCount += storeVisible(_mm256_movemask_ps(outside), std::min(8, arrays.count - i), visible + i);
+	}
+
+	// Avoids the penalty of mixing with the SSE code the compiler generates elsewhere.
+	_mm256_zeroupper();
+	return visibleCount;
+}
+
+BoundsArray::BoundsArray() : count(0)
+{
+}
+
+void BoundsArray::add(const Bounds& bounds)
+{
+	// Another group, of padding until later adds fill it in. Infinite bounds are inside every plane.
+	const float everywhere = std::numeric_limits<float>::infinity();
+	if (count == (int)centreX.size())
+	{
+		size_t padded = centreX.size() + width;
+		centreX.resize(padded, 0.0f);
+		centreY.resize(padded, 0.0f);
+		centreZ.resize(padded, 0.0f);
+		extentX.resize(padded, everywhere);
+		extentY.resize(padded, everywhere);
+		extentZ.resize(padded, everywhere);
+		radius.resize(padded, everywhere);
+	}
+
+	if (bounds.empty)
+	{
+		centreX[count] = centreY[count] = centreZ[count] = 0.0f;
+		extentX[count] = extentY[count] = extentZ[count] = radius[count] = everywhere;
+	}
+	else
+	{
+		centreX[count] = bounds.centre.x;
+		centreY[count] = bounds.centre.y;
+		centreZ[count] = bounds.centre.z;
+		extentX[count] = (bounds.max.x - bounds.min.x) * 0.5f;
+		extentY[count] = (bounds.max.y - bounds.min.y) * 0.5f;
+		extentZ[count] = (bounds.max.z - bounds.min.z) * 0.5f;
+		radius[count] = bounds.radius;
+	}
+	count++;
+}
+
+void BoundsArray::clear()
+{
+	count = 0;
+	centreX.clear();
+	centreY.clear();
+	centreZ.clear();
+	extentX.clear();
+	extentY.clear();
+	extentZ.clear();
+	radius.clear();
+}
+
+int BoundsArray::cull(const Frustum& frustum, unsigned char* visible, Test test) const
+{
+	return cull(frustum, visible, test, kernel());
+}
+
+int BoundsArray::cull(const Frustum& frustum, unsigned char* visible, Test test, Kernel kernel) const
+{
+	if (frustum.isEverything())
+	{
+		memset(visible, 1, count);
+		return count;
+	}
+
+	CullPlane planes[6];
+	for (int p = 0; p < 6; p++)
+	{
+		const GLfloat* plane = frustum.plane(p);
+		planes[p].a = plane[0];
+		planes[p].b = plane[1];
+		planes[p].c = plane[2];
+		planes[p].d = plane[3];
+		planes[p].absA = fabsf(plane[0]);
+		planes[p].absB = fabsf(plane[1]);
+		planes[p].absC = fabsf(plane[2]);
+	}
+
+	CullArrays arrays = { centreX.data(), centreY.data(), centreZ.data(), extentX.data(), extentY.data(), extentZ.data(),
+		radius.data(), count };
+	bool box = test == BoxTest;
+	switch (supported(kernel) ? kernel : Scalar)
+	{
+	case AVX:
+		return cullAVX(arrays, planes, box, visible);
+	case SSE:
+		return cullSSE(arrays, planes, box, visible);
+	default:
+		return cullScalar(arrays, planes, box, visible);
+	}
+}
+
+bool BoundsArray::supported(Kernel kernel)
+{
+	// Asked of the CPU once.
+	static int support = -1;
+	if (support < 0)
+	{
+		support = 1 << Scalar;
+
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] >= 1)
+		{
+			__cpuid(info, 1);
+			if ((info[3] & (1 << 25)) != 0)
+			{
+				support |= 1 << SSE;
+			}
+
+			// AVX also needs the OS to save the upper halves of the registers, which it says through XGETBV.
+			bool osSaves = (info[2] & (1 << 27)) != 0;
+			bool avx = (info[2] & (1 << 28)) != 0;
+			if (osSaves && avx && (_xgetbv(0) & 6) == 6)
+			{
+				support |= 1 << AVX;
+			}
+		}
+	}
+	return kernel >= 0 && kernel < KernelCount && (support & (1 << kernel)) != 0;
+}
+
+const char* BoundsArray::name(Kernel kernel)
+{
+	switch (kernel)
+	{
+	case SSE:
+		return "SSE";
+	case AVX:
+		return "AVX";
+	default:
+		return "Scalar";
+	}
+}
+
+BoundsArray::Kernel BoundsArray::kernel()
+{
+	if (!chosen)
+	{
+		current = supported(AVX) ? AVX : supported(SSE) ? SSE : Scalar;
+		chosen = true;
+	}
+	return current;
+}
+
+void BoundsArray::setKernel(Kernel kernel)
+{
+	current = supported(kernel) ? kernel : Scalar;
+	chosen = true;
+}
+
+void BoundsArray::nextKernel()
+{
+	Kernel next = kernel();
+	do
+	{
+		next = (Kernel)((next + 1) % KernelCount);
+	} while (!supported(next));
+	setKernel(next);
+}
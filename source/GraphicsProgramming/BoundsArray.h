@@ -0,0 +1,54 @@
+// BoundsArray class, many Bounds kept as separate arrays of each component, for culling them against a Frustum at once.
+// Each box is stored as its centre, half size and the radius of the sphere round it, one array per component, so a
+// kernel can load the same component of 4 or 8 bounds at a time and test them against all six planes with SSE or AVX.
+// The scalar kernel is the reference the others must agree with, bounds for bounds. Which kernel runs is picked from
+// what the CPU supports when first used and can be switched at runtime for comparison.
+// Gives the same answers as testing each with Frustum::intersects, empty bounds are never culled.
+#ifndef _BOUNDSARRAY_H_
+#define _BOUNDSARRAY_H_
+
+#include <vector>
+#include "Frustum.h"
+
+class BoundsArray
+{
+
+public:
+	enum Kernel { Scalar, SSE, AVX, KernelCount };
+	// The box is exact, the sphere is looser but saves three multiplies a plane.
+	enum Test { BoxTest, SphereTest };
+
+	BoundsArray();
+
+	void add(const Bounds& bounds);
+	void clear();
+	int size() const { return count; };
+
+	// Sets visible[i] to 1 if bounds i may be in frustum, 0 if it's wholly outside. visible must hold size() entries.
+	// Returns how many are visible. The first form uses the current kernel.
+	int cull(const Frustum& frustum, unsigned char* visible, Test test = BoxTest) const;
+	int cull(const Frustum& frustum, unsigned char* visible, Test test, Kernel kernel) const;
+
+	// True if the CPU and OS can run kernel.
+	static bool supported(Kernel kernel);
+	static const char* name(Kernel kernel);
+	// The kernel cull uses, the widest supported unless set. Setting one that isn't supported falls back to Scalar.
+	static Kernel kernel();
+	static void setKernel(Kernel kernel);
+	// Moves to the next supported kernel, wrapping round to Scalar.
+	static void nextKernel();
+
+private:
+	// Rounds count up to this so every kernel reads whole groups, the padding is never culled.
+	static const int width = 8;
+
+	int count;
+	std::vector<float> centreX, centreY, centreZ;
+	std::vector<float> extentX, extentY, extentZ;
+	std::vector<float> radius;
+
+	static Kernel current;
+	static bool chosen;
+};
+
+#endif
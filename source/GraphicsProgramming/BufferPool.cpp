@@ -0,0 +1,70 @@
+#include "BufferPool.h"
+
+BufferPool::BufferPool(size_t maxBuffers) : maxIdle(maxBuffers), allocated(0), reused(0)
+{
+}
+
+BufferPool& BufferPool::shared()
+{
+	static BufferPool pool;
+	return pool;
+}
+
+BufferPool::Buffer BufferPool::acquire(size_t size)
+{
+	Buffer result;
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+
+		// Smallest idle buffer that fits, so big buffers stay free for big images.
+		size_t best = idle.size();
+		for (size_t i = 0; i < idle.size(); i++)
+		{
+			if (idle[i].capacity() >= size && (best == idle.size() || idle[i].capacity() < idle[best].capacity()))
+			{
+				best = i;
+			}
+		}
+
+		if (best < idle.size())
+		{
+			result.swap(idle[best]);
+			idle.erase(idle.begin() + best);
+			reused++;
+		}
+		else
+		{
+			allocated++;
+		}
+	}
+
+	result.resize(size);
+	return result;
+}
+
+void BufferPool::release(Buffer& buffer)
+{
+	if (buffer.capacity() == 0)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(poolMutex);
+	idle.push_back(Buffer());
+	idle.back().swap(buffer);
+	buffer.clear();
+
+	// Over the limit, drop the smallest.
+	if (idle.size() > maxIdle)
+	{
+		size_t smallest = 0;
+		for (size_t i = 1; i < idle.size(); i++)
+		{
+			if (idle[i].capacity() < idle[smallest].capacity())
+			{
+				smallest = i;
+			}
+		}
+		idle.erase(idle.begin() + smallest);
+	}
+}
@@ -0,0 +1,41 @@
+// BufferPool class, recycles byte buffers so loading a batch of images doesn't allocate and free one per file.
+// Buffers are handed out by value and moved back in with release(), the pool keeps the largest few.
+// Safe to use from any thread.
+#ifndef _BUFFERPOOL_H_
+#define _BUFFERPOOL_H_
+
+#include <vector>
+#include <mutex>
+
+class BufferPool
+{
+
+public:
+	typedef std::vector<unsigned char> Buffer;
+
+	// maxBuffers idle buffers are kept, anything beyond that is freed on release.
+	BufferPool(size_t maxBuffers = 8);
+
+	// Process wide pool used by the texture loaders.
+	static BufferPool& shared();
+
+	// Returns a buffer resized to size, reusing the smallest idle one that is big enough.
+	Buffer acquire(size_t size);
+	// Gives a buffer back for reuse, buffer is left empty.
+	void release(Buffer& buffer);
+
+	// Buffers newly allocated and reused, for profiling.
+	int allocations() const { return allocated; };
+	int reuses() const { return reused; };
+
+private:
+	BufferPool(const BufferPool&);
+	BufferPool& operator=(const BufferPool&);
+
+	std::mutex poolMutex;
+	std::vector<Buffer> idle;
+	size_t maxIdle;
+	int allocated, reused;
+};
+
+#endif
@@ -0,0 +1,300 @@
+// Below ifdef required to remove warnings for unsafe version of fopen.
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "DdsCache.h"
+#include "GLExtensions.h"
+#include "MeshCache.h"
+#include "BufferPool.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+// DDS file layout, see the DirectDraw Surface documentation. All fields are little endian 32 bit.
+struct DdsPixelFormat
+{
+	unsigned int size;
+	unsigned int flags;
+	unsigned int fourCC;
+	unsigned int rgbBitCount;
+	unsigned int rBitMask, gBitMask, bBitMask, aBitMask;
+};
+
+struct DdsHeader
+{
+	unsigned int size;
+	unsigned int flags;
+	unsigned int height;
+	unsigned int width;
+	unsigned int linearSize;
+	unsigned int depth;
+	unsigned int mipMapCount;
+	unsigned int reserved1[11];
+	DdsPixelFormat format;
+	unsigned int caps, caps2, caps3, caps4;
+	unsigned int reserved2;
+};
+
+// What's stored in reserved1, tagged so DDS files from elsewhere are never mistaken for a cache.
+struct DdsCacheInfo
+{
+	char tag[4];						// "TXCK"
+	unsigned int version;
+	unsigned int flags;
+	unsigned int sourceSize[2];
+	unsigned int sourceTime[2];
+	unsigned int sourceHash[2];
+	unsigned int unused[2];
+};
+
+static const unsigned int DDSD_CAPS = 0x1, DDSD_HEIGHT = 0x2, DDSD_WIDTH = 0x4, DDSD_PIXELFORMAT = 0x1000;
+static const unsigned int DDSD_MIPMAPCOUNT = 0x20000, DDSD_LINEARSIZE = 0x80000;
+static const unsigned int DDPF_FOURCC = 0x4;
+static const unsigned int DDSCAPS_COMPLEX = 0x8, DDSCAPS_TEXTURE = 0x1000, DDSCAPS_MIPMAP = 0x400000;
+
+static unsigned int fourCC(const char* code)
+{
+	return (unsigned int)(unsigned char)code[0] | ((unsigned int)(unsigned char)code[1] << 8) |
+		((unsigned int)(unsigned char)code[2] << 16) | ((unsigned int)(unsigned char)code[3] << 24);
+}
+
+// Bytes per 4x4 block, 0 if the format isn't one DDS can hold.
+static int blockSize(GLenum format)
+{
+	switch (format)
+	{
+	case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+	case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		return 8;
+	case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+	case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+		return 16;
+	}
+	return 0;
+}
+
+static size_t levelSize(int width, int height, int block)
+{
+	return (size_t)((width + 3) / 4) * ((height + 3) / 4) * block;
+}
+
+static void split(unsigned long long value, unsigned int* out)
+{
+	out[0] = (unsigned int)value;
+	out[1] = (unsigned int)(value >> 32);
+}
+
+static unsigned long long join(const unsigned int* in)
+{
+	return (unsigned long long)in[0] | ((unsigned long long)in[1] << 32);
+}
+
+std::string DdsCache::cachePath(const char* sourceFilename)
+{
+	return std::string(sourceFilename) + ".dds";
+}
+
+bool DdsCache::write(const char* sourceFilename, unsigned int flags, GLuint texture)
+{
+	if (!GLExtensions::textureCompression)
+	{
+		return false;
+	}
+
+	DdsHeader header;
+	memset(&header, 0, sizeof(header));
+	DdsCacheInfo* info = (DdsCacheInfo*)header.reserved1;
+	memcpy(info->tag, "TXCK", 4);
+	info->version = version;
+	info->flags = flags;
+
+	unsigned long long size, time;
+	if (!MeshCache::sourceInfo(sourceFilename, size, time))
+	{
+		return false;
+	}
+	MappedFile source;
+	if (!source.open(sourceFilename))
+	{
+		return false;
+	}
+	split(size, info->sourceSize);
+	split(time, info->sourceTime);
+	split(MeshCache::hash(source.data(), source.size()), info->sourceHash);
+	source.close();
+
+	// Read the compressed levels back, SOIL leaves the texture uncompressed if the driver refused.
+	GLint previous = 0;
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glBindTexture(GL_TEXTURE_2D, texture);
+
+	GLint compressed = 0, format = 0, width = 0, height = 0;
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &compressed);
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+	int block = blockSize((GLenum)format);
+	if (!compressed || block == 0 || width == 0 || height == 0)
+	{
+		glBindTexture(GL_TEXTURE_2D, previous);
+		return false;
+	}
+
+	std::vector<unsigned char> data;
+	int levels = 0;
+	for (int w = width, h = height; ; w = w > 1 ? w / 2 : 1, h = h > 1 ? h / 2 : 1)
+	{
+		GLint levelWidth = 0;
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, levels, GL_TEXTURE_WIDTH, &levelWidth);
+		if (levelWidth != w)
+		{
+			break;
+		}
+		size_t offset = data.size();
+		data.resize(offset + levelSize(w, h, block));
+		GLExtensions::getCompressedTexImage(GL_TEXTURE_2D, levels, &data[offset]);
+		levels++;
+		if (w == 1 && h == 1)
+		{
+			break;
+		}
+	}
+	glBindTexture(GL_TEXTURE_2D, previous);
+
+	header.size = sizeof(DdsHeader);
+	header.flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE;
+	header.width = (unsigned int)width;
+	header.height = (unsigned int)height;
+	header.linearSize = (unsigned int)levelSize(width, height, block);
+	header.mipMapCount = (unsigned int)levels;
+	header.format.size = sizeof(DdsPixelFormat);
+	header.format.flags = DDPF_FOURCC;
+	header.format.fourCC = fourCC(block == 8 ? "DXT1" : (format == GL_COMPRESSED_RGBA_S3TC_DXT3_EXT ? "DXT3" : "DXT5"));
+	header.caps = DDSCAPS_TEXTURE;
+	if (levels > 1)
+	{
+		header.flags |= DDSD_MIPMAPCOUNT;
+		header.caps |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+	}
+
+	// Write to a temporary file first so a half written cache is never picked up.
+	std::string path = cachePath(sourceFilename);
+	std::string tempPath = path + ".tmp";
+	FILE* file = fopen(tempPath.c_str(), "wb");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	bool result = fwrite("DDS ", 4, 1, file) == 1;
+	result = result && fwrite(&header, sizeof(header), 1, file) == 1;
+	result = result && fwrite(data.data(), 1, data.size(), file) == data.size();
+	fclose(file);
+
+	if (!result)
+	{
+		remove(tempPath.c_str());
+		return false;
+	}
+
+	remove(path.c_str());
+	return rename(tempPath.c_str(), path.c_str()) == 0;
+}
+
+bool DdsCache::load(const char* sourceFilename, unsigned int flags, DecodedImage& out)
+{
+	if (!GLExtensions::textureCompression)
+	{
+		return false;
+	}
+
+	unsigned long long size, time;
+	if (!MeshCache::sourceInfo(sourceFilename, size, time))
+	{
+		return false;
+	}
+
+	std::string path = cachePath(sourceFilename);
+	FILE* file = fopen(path.c_str(), "rb");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	char magic[4];
+	DdsHeader header;
+	const DdsCacheInfo* info = (const DdsCacheInfo*)header.reserved1;
+	if (fread(magic, 4, 1, file) != 1 || memcmp(magic, "DDS ", 4) != 0 || fread(&header, sizeof(header), 1, file) != 1 ||
+		header.size != sizeof(DdsHeader) || memcmp(info->tag, "TXCK", 4) != 0 || info->version != version || info->flags != flags)
+	{
+		fclose(file);
+		return false;
+	}
+
+	// Same checks as MeshCache, size and time first then the content hash if only the time differs.
+	if (join(info->sourceSize) != size)
+	{
+		fclose(file);
+		return false;
+	}
+	if (join(info->sourceTime) != time)
+	{
+		MappedFile source;
+		if (!source.open(sourceFilename) || MeshCache::hash(source.data(), source.size()) != join(info->sourceHash))
+		{
+			fclose(file);
+			return false;
+		}
+	}
+
+	GLenum format;
+	if (header.format.fourCC == fourCC("DXT1"))
+	{
+		format = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+	}
+	else if (header.format.fourCC == fourCC("DXT3"))
+	{
+		format = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+	}
+	else if (header.format.fourCC == fourCC("DXT5"))
+	{
+		format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+	}
+	else
+	{
+		fclose(file);
+		return false;
+	}
+
+	int levels = header.mipMapCount > 0 ? (int)header.mipMapCount : 1;
+	size_t expected = 0;
+	int block = blockSize(format);
+	for (int i = 0, w = (int)header.width, h = (int)header.height; i < levels; i++, w = w > 1 ? w / 2 : 1, h = h > 1 ? h / 2 : 1)
+	{
+		expected += levelSize(w, h, block);
+	}
+	if (header.width == 0 || header.height == 0)
+	{
+		fclose(file);
+		return false;
+	}
+
+	// Read the levels straight into a pooled buffer, released by TextureLoader::release.
+	out.compressed = BufferPool::shared().acquire(expected);
+	bool result = fread(out.compressed.data(), 1, expected, file) == expected;
+	fclose(file);
+	if (!result)
+	{
+		BufferPool::shared().release(out.compressed);
+		return false;
+	}
+
+	out.pixels = NULL;
+	out.width = (int)header.width;
+	out.height = (int)header.height;
+	out.channels = block == 8 ? 3 : 4;
+	out.compressedFormat = format;
+	out.levels = levels;
+	return true;
+}
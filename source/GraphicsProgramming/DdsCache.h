@@ -0,0 +1,30 @@
+// DdsCache class, reads and writes cooked copies of textures next to their source image.
+// The first load decodes the image and lets SOIL build and DXT compress the mip chain, the compressed
+// levels are then read back from GL and saved as a standard DDS file. Later loads upload them directly
+// with glCompressedTexImage2D, skipping decoding, mipmapping and compression.
+// Source size, modified time, content hash and the SOIL flags used are kept in the DDS header's reserved
+// words, the cache is rebuilt when any of them no longer match.
+#ifndef _DDSCACHE_H_
+#define _DDSCACHE_H_
+
+#include <string>
+#include "TextureLoader.h"
+
+class DdsCache
+{
+
+public:
+	// Bump when the layout changes, older caches are rebuilt.
+	static const unsigned int version = 1;
+
+	// Path of the cache file for a source image.
+	static std::string cachePath(const char* sourceFilename);
+	// Reads back the compressed mip chain of texture and writes it as the cache for sourceFilename.
+	// Must be called on the GL thread. Returns false if the texture isn't DXT compressed or the file can't be written.
+	static bool write(const char* sourceFilename, unsigned int flags, GLuint texture);
+	// Reads the cache for sourceFilename into out's compressed fields. Safe to call from any thread.
+	// Returns false if there is no cache, it is out of date or was made with different flags.
+	static bool load(const char* sourceFilename, unsigned int flags, DecodedImage& out);
+};
+
+#endif
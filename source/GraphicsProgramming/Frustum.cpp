@@ -0,0 +1,126 @@
+#include "Frustum.h"
+#include <math.h>
+#include <algorithm>
+
+Frustum::Frustum() : everything(true)
+{
+}
+
+void Frustum::extract(const GLfloat* clip, const float* window)
+{
+	// Rows of the matrix, a point is inside where each clip co-ordinate is within -w to w, or the window's share of it.
+	GLfloat rows[4][4];
+	for (int row = 0; row < 4; row++)
+	{
+		for (int column = 0; column < 4; column++)
+		{
+			rows[row][column] = clip[column * 4 + row];
+		}
+	}
+	float left = window != NULL ? window[0] : -1.0f;
+	float bottom = window != NULL ? window[1] : -1.0f;
+	float right = window != NULL ? window[2] : 1.0f;
+	float top = window != NULL ? window[3] : 1.0f;
+
+	for (int i = 0; i < 4; i++)
+	{
+		planes[0][i] = rows[0][i] - left * rows[3][i];		// x >= left * w
+		planes[1][i] = right * rows[3][i] - rows[0][i];		// x <= right * w
+		planes[2][i] = rows[1][i] - bottom * rows[3][i];	// y >= bottom * w
+		planes[3][i] = top * rows[3][i] - rows[1][i];		// y <= top * w
+		planes[4][i] = rows[3][i] + rows[2][i];				// Near
+		planes[5][i] = rows[3][i] - rows[2][i];				// Far
+	}
+
+	for (int p = 0; p < 6; p++)
+	{
+		float length = sqrtf(planes[p][0] * planes[p][0] + planes[p][1] * planes[p][1] + planes[p][2] * planes[p][2]);
+		if (length > 0.0f)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				planes[p][i] /= length;
+			}
+		}
+	}
+	everything = false;
+}
+
+bool Frustum::intersects(const Bounds& bounds) const
+{
+	if (everything || bounds.empty)
+	{
+		return true;
+	}
+
+	for (int p = 0; p < 6; p++)
+	{
+		const GLfloat* plane = planes[p];
+		float distance = plane[0] * bounds.centre.x + plane[1] * bounds.centre.y + plane[2] * bounds.centre.z + plane[3];
+		if (distance < -bounds.radius)
+		{
+			return false;
+		}
+		if (distance >= bounds.radius)
+		{
+			continue;
+		}
+
+		// The sphere straddles the plane, try the box's corner furthest along its normal.
+		float x = plane[0] >= 0.0f ? bounds.max.x : bounds.min.x;
+		float y = plane[1] >= 0.0f ? bounds.max.y : bounds.min.y;
+		float z = plane[2] >= 0.0f ? bounds.max.z : bounds.min.z;
+		if (plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.0f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool Frustum::screenRect(const GLfloat* clip, const Bounds& bounds, float* rect)
+{
+	rect[0] = rect[1] = -1.0f;
+	rect[2] = rect[3] = 1.0f;
+	if (bounds.empty)
+	{
+		return true;
+	}
+
+	float left = 1.0f, bottom = 1.0f, right = -1.0f, top = -1.0f;
+	for (int i = 0; i < 8; i++)
+	{
+		float x = (i & 1) ? bounds.max.x : bounds.min.x;
+		float y = (i & 2) ? bounds.max.y : bounds.min.y;
+		float z = (i & 4) ? bounds.max.z : bounds.min.z;
+		float w = clip[3] * x + clip[7] * y + clip[11] * z + clip[15];
+		if (w <= 0.0f)
+		{
+			return true;
+		}
+		float screenX = (clip[0] * x + clip[4] * y + clip[8] * z + clip[12]) / w;
+		float screenY = (clip[1] * x + clip[5] * y + clip[9] * z + clip[13]) / w;
+		left = i == 0 ? screenX : std::min(left, screenX);
+		right = i == 0 ? screenX : std::max(right, screenX);
+		bottom = i == 0 ? screenY : std::min(bottom, screenY);
+		top = i == 0 ? screenY : std::max(top, screenY);
+	}
+
+	rect[0] = std::max(left, -1.0f);
+	rect[1] = std::max(bottom, -1.0f);
+	rect[2] = std::min(right, 1.0f);
+	rect[3] = std::min(top, 1.0f);
+	return rect[0] < rect[2] && rect[1] < rect[3];
+}
+
+void Frustum::multiply(const GLfloat* a, const GLfloat* b, GLfloat* out)
+{
+	for (int column = 0; column < 4; column++)
+	{
+		for (int row = 0; row < 4; row++)
+		{
+			out[column * 4 + row] = a[row] * b[column * 4] + a[4 + row] * b[column * 4 + 1] + a[8 + row] * b[column * 4 + 2] +
+				a[12 + row] * b[column * 4 + 3];
+		}
+	}
+}
@@ -0,0 +1,44 @@
+// Frustum class, the six planes of a view volume for culling whatever lies wholly outside it.
+// The planes are taken straight from a projection times modelview matrix, so they're in the space the modelview maps
+// from and a mesh's own Bounds can be tested without transforming them. A mirrored modelview gives the mirrored
+// frustum the same way. The sides can be narrowed to part of the screen, e.g. to what's seen through a mirror.
+#ifndef _FRUSTUM_H_
+#define _FRUSTUM_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include "Bounds.h"
+
+class Frustum
+{
+
+public:
+	// Everything inside.
+	Frustum();
+
+	// Planes of clip, a projection times modelview (column major, as glLoadMatrixf). window, if not NULL, is the
+	// rectangle of normalized device co-ordinates the sides are narrowed to, left, bottom, right and top.
+	void extract(const GLfloat* clip, const float* window = NULL);
+
+	// False only if bounds are wholly outside. Tests the sphere first, then the box against any plane the sphere
+	// straddles.
+	bool intersects(const Bounds& bounds) const;
+
+	// Plane p, a, b, c and d, for testing many bounds at once, see BoundsArray. Meaningless if isEverything.
+	const GLfloat* plane(int p) const { return planes[p]; };
+	bool isEverything() const { return everything; };
+
+	// Rectangle of normalized device co-ordinates bounds cover under clip, as extract's window, clamped to the screen.
+	// False if they're off screen. Bounds reaching behind the eye are taken to cover the whole screen.
+	static bool screenRect(const GLfloat* clip, const Bounds& bounds, float* rect);
+
+	// out = a * b, all column major. out must not be a or b.
+	static void multiply(const GLfloat* a, const GLfloat* b, GLfloat* out);
+
+private:
+	// a, b, c, d of ax + by + cz + d >= 0 inside, normalised so d is a distance.
+	GLfloat planes[6][4];
+	bool everything;
+};
+
+#endif
@@ -0,0 +1,144 @@
+// Below ifdef required to remove warnings for unsafe version of sscanf.
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "GLExtensions.h"
+#include "freeglut_ext.h"
+#include <stdio.h>
+#include <string.h>
+
+bool GLExtensions::loaded = false;
+bool GLExtensions::textureCompression = false;
+CompressedTexImage2DProc GLExtensions::compressedTexImage2D = NULL;
+GetCompressedTexImageProc GLExtensions::getCompressedTexImage = NULL;
+bool GLExtensions::vertexBuffers = false;
+GenBuffersProc GLExtensions::genBuffers = NULL;
+DeleteBuffersProc GLExtensions::deleteBuffers = NULL;
+BindBufferProc GLExtensions::bindBuffer = NULL;
+BufferDataProc GLExtensions::bufferData = NULL;
+BufferSubDataProc GLExtensions::bufferSubData = NULL;
+bool GLExtensions::packedVertices = false;
+bool GLExtensions::shaders = false;
+CreateShaderProc GLExtensions::createShader = NULL;
+ShaderSourceProc GLExtensions::shaderSource = NULL;
+CompileShaderProc GLExtensions::compileShader = NULL;
+GetShaderivProc GLExtensions::getShaderiv = NULL;
+GetShaderInfoLogProc GLExtensions::getShaderInfoLog = NULL;
+DeleteShaderProc GLExtensions::deleteShader = NULL;
+CreateProgramProc GLExtensions::createProgram = NULL;
+AttachShaderProc GLExtensions::attachShader = NULL;
+BindAttribLocationProc GLExtensions::bindAttribLocation = NULL;
+LinkProgramProc GLExtensions::linkProgram = NULL;
+GetProgramivProc GLExtensions::getProgramiv = NULL;
+GetProgramInfoLogProc GLExtensions::getProgramInfoLog = NULL;
+UseProgramProc GLExtensions::useProgram = NULL;
+GetUniformLocationProc GLExtensions::getUniformLocation = NULL;
+Uniform1iProc GLExtensions::uniform1i = NULL;
+Uniform1ivProc GLExtensions::uniform1iv = NULL;
+UniformMatrix4fvProc GLExtensions::uniformMatrix4fv = NULL;
+VertexAttribPointerProc GLExtensions::vertexAttribPointer = NULL;
+EnableVertexAttribArrayProc GLExtensions::enableVertexAttribArray = NULL;
+DisableVertexAttribArrayProc GLExtensions::disableVertexAttribArray = NULL;
+bool GLExtensions::instancing = false;
+VertexAttribDivisorProc GLExtensions::vertexAttribDivisor = NULL;
+DrawArraysInstancedProc GLExtensions::drawArraysInstanced = NULL;
+DrawElementsInstancedProc GLExtensions::drawElementsInstanced = NULL;
+
+// Core name first, then the ARB name older drivers export it under.
+static void* getProc(const char* name, const char* arbName)
+{
+	void* proc = (void*)glutGetProcAddress(name);
+	if (proc == NULL && arbName != NULL)
+	{
+		proc = (void*)glutGetProcAddress(arbName);
+	}
+	return proc;
+}
+
+bool GLExtensions::hasExtension(const char* extension)
+{
+	const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+	if (extensions == NULL)
+	{
+		return false;
+	}
+
+	// Match whole names only, one extension name can be the start of another.
+	size_t length = strlen(extension);
+	for (const char* found = strstr(extensions, extension); found != NULL; found = strstr(found + 1, extension))
+	{
+		if ((found == extensions || found[-1] == ' ') && (found[length] == ' ' || found[length] == '\0'))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool GLExtensions::hasVersion(int major, int minor)
+{
+	const char* version = (const char*)glGetString(GL_VERSION);
+	int contextMajor = 0, contextMinor = 0;
+	if (version == NULL || sscanf(version, "%d.%d", &contextMajor, &contextMinor) != 2)
+	{
+		return false;
+	}
+	return contextMajor > major || (contextMajor == major && contextMinor >= minor);
+}
+
+void GLExtensions::load()
+{
+	if (loaded)
+	{
+		return;
+	}
+	loaded = true;
+
+	compressedTexImage2D = (CompressedTexImage2DProc)getProc("glCompressedTexImage2D", "glCompressedTexImage2DARB");
+	getCompressedTexImage = (GetCompressedTexImageProc)getProc("glGetCompressedTexImage", "glGetCompressedTexImageARB");
+	textureCompression = compressedTexImage2D != NULL && getCompressedTexImage != NULL && hasExtension("GL_EXT_texture_compression_s3tc");
+
+	genBuffers = (GenBuffersProc)getProc("glGenBuffers", "glGenBuffersARB");
+	deleteBuffers = (DeleteBuffersProc)getProc("glDeleteBuffers", "glDeleteBuffersARB");
+	bindBuffer = (BindBufferProc)getProc("glBindBuffer", "glBindBufferARB");
+	bufferData = (BufferDataProc)getProc("glBufferData", "glBufferDataARB");
+	bufferSubData = (BufferSubDataProc)getProc("glBufferSubData", "glBufferSubDataARB");
+	vertexBuffers = genBuffers != NULL && deleteBuffers != NULL && bindBuffer != NULL && bufferData != NULL && bufferSubData != NULL;
+
+	packedVertices = hasVersion(3, 3) ||
+		(hasExtension("GL_ARB_vertex_type_2_10_10_10_rev") && (hasVersion(3, 0) || hasExtension("GL_ARB_half_float_vertex")));
+
+	// Shader objects only go by their core names, the ARB_shader_objects versions use different handle types.
+	createShader = (CreateShaderProc)getProc("glCreateShader", NULL);
+	shaderSource = (ShaderSourceProc)getProc("glShaderSource", NULL);
+	compileShader = (CompileShaderProc)getProc("glCompileShader", NULL);
+	getShaderiv = (GetShaderivProc)getProc("glGetShaderiv", NULL);
+	getShaderInfoLog = (GetShaderInfoLogProc)getProc("glGetShaderInfoLog", NULL);
+	deleteShader = (DeleteShaderProc)getProc("glDeleteShader", NULL);
+	createProgram = (CreateProgramProc)getProc("glCreateProgram", NULL);
+	attachShader = (AttachShaderProc)getProc("glAttachShader", NULL);
+	bindAttribLocation = (BindAttribLocationProc)getProc("glBindAttribLocation", NULL);
+	linkProgram = (LinkProgramProc)getProc("glLinkProgram", NULL);
+	getProgramiv = (GetProgramivProc)getProc("glGetProgramiv", NULL);
+	getProgramInfoLog = (GetProgramInfoLogProc)getProc("glGetProgramInfoLog", NULL);
+	useProgram = (UseProgramProc)getProc("glUseProgram", NULL);
+	getUniformLocation = (GetUniformLocationProc)getProc("glGetUniformLocation", NULL);
+	uniform1i = (Uniform1iProc)getProc("glUniform1i", NULL);
+	uniform1iv = (Uniform1ivProc)getProc("glUniform1iv", NULL);
+	uniformMatrix4fv = (UniformMatrix4fvProc)getProc("glUniformMatrix4fv", NULL);
+	vertexAttribPointer = (VertexAttribPointerProc)getProc("glVertexAttribPointer", "glVertexAttribPointerARB");
+	enableVertexAttribArray = (EnableVertexAttribArrayProc)getProc("glEnableVertexAttribArray", "glEnableVertexAttribArrayARB");
+	disableVertexAttribArray = (DisableVertexAttribArrayProc)getProc("glDisableVertexAttribArray", "glDisableVertexAttribArrayARB");
+	shaders = hasVersion(2, 0) && createShader != NULL && shaderSource != NULL && compileShader != NULL && getShaderiv != NULL &&
+		getShaderInfoLog != NULL && deleteShader != NULL && createProgram != NULL && attachShader != NULL && bindAttribLocation != NULL &&
+		linkProgram != NULL && getProgramiv != NULL && getProgramInfoLog != NULL && useProgram != NULL && getUniformLocation != NULL &&
+		uniform1i != NULL && uniform1iv != NULL && uniformMatrix4fv != NULL && vertexAttribPointer != NULL &&
+		enableVertexAttribArray != NULL && disableVertexAttribArray != NULL;
+
+	vertexAttribDivisor = (VertexAttribDivisorProc)getProc("glVertexAttribDivisor", "glVertexAttribDivisorARB");
+	drawArraysInstanced = (DrawArraysInstancedProc)getProc("glDrawArraysInstanced", "glDrawArraysInstancedARB");
+	drawElementsInstanced = (DrawElementsInstancedProc)getProc("glDrawElementsInstanced", "glDrawElementsInstancedARB");
+	instancing = shaders && vertexBuffers && vertexAttribDivisor != NULL && drawArraysInstanced != NULL && drawElementsInstanced != NULL &&
+		(hasVersion(3, 3) || (hasExtension("GL_ARB_draw_instanced") && hasExtension("GL_ARB_instanced_arrays")));
+}
@@ -0,0 +1,155 @@
+// GLExtensions class, loads the OpenGL entry points newer than the 1.1 ones opengl32.lib exports.
+// load() must be called once a context is current, after that the function pointers and feature
+// flags can be read from any thread. Pointers are NULL when the driver doesn't support them.
+#ifndef _GLEXTENSIONS_H_
+#define _GLEXTENSIONS_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <stddef.h>
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+// GL 1.2 / 1.3 and EXT_texture_compression_s3tc constants, not in the Windows gl.h.
+#ifndef GL_CLAMP_TO_EDGE
+#define GL_CLAMP_TO_EDGE 0x812F
+#endif
+#ifndef GL_TEXTURE_MAX_LEVEL
+#define GL_TEXTURE_MAX_LEVEL 0x813D
+#endif
+#ifndef GL_TEXTURE_COMPRESSED_IMAGE_SIZE
+#define GL_TEXTURE_COMPRESSED_IMAGE_SIZE 0x86A0
+#endif
+#ifndef GL_TEXTURE_COMPRESSED
+#define GL_TEXTURE_COMPRESSED 0x86A1
+#endif
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+// GL 1.5 / ARB_vertex_buffer_object constants.
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER 0x8892
+#define GL_ELEMENT_ARRAY_BUFFER 0x8893
+#define GL_STATIC_DRAW 0x88E4
+#endif
+
+// Packed vertex types, GL 3.0 half floats and GL 3.3 / ARB_vertex_type_2_10_10_10_rev normals.
+#ifndef GL_HALF_FLOAT
+#define GL_HALF_FLOAT 0x140B
+#endif
+#ifndef GL_INT_2_10_10_10_REV
+#define GL_INT_2_10_10_10_REV 0x8D9F
+#endif
+
+// GL 2.0 shader constants, used by the instanced draw path.
+#ifndef GL_VERTEX_SHADER
+#define GL_FRAGMENT_SHADER 0x8B30
+#define GL_VERTEX_SHADER 0x8B31
+#define GL_COMPILE_STATUS 0x8B81
+#define GL_LINK_STATUS 0x8B82
+#define GL_INFO_LOG_LENGTH 0x8B84
+#endif
+#ifndef GL_STREAM_DRAW
+#define GL_STREAM_DRAW 0x88E0
+#endif
+
+typedef void (APIENTRY* CompressedTexImage2DProc)(GLenum target, GLint level, GLenum internalFormat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid* data);
+typedef void (APIENTRY* GetCompressedTexImageProc)(GLenum target, GLint level, GLvoid* data);
+typedef void (APIENTRY* GenBuffersProc)(GLsizei n, GLuint* buffers);
+typedef void (APIENTRY* DeleteBuffersProc)(GLsizei n, const GLuint* buffers);
+typedef void (APIENTRY* BindBufferProc)(GLenum target, GLuint buffer);
+typedef void (APIENTRY* BufferDataProc)(GLenum target, ptrdiff_t size, const GLvoid* data, GLenum usage);
+typedef void (APIENTRY* BufferSubDataProc)(GLenum target, ptrdiff_t offset, ptrdiff_t size, const GLvoid* data);
+typedef GLuint (APIENTRY* CreateShaderProc)(GLenum type);
+typedef void (APIENTRY* ShaderSourceProc)(GLuint shader, GLsizei count, const char* const* strings, const GLint* lengths);
+typedef void (APIENTRY* CompileShaderProc)(GLuint shader);
+typedef void (APIENTRY* GetShaderivProc)(GLuint shader, GLenum name, GLint* value);
+typedef void (APIENTRY* GetShaderInfoLogProc)(GLuint shader, GLsizei size, GLsizei* length, char* log);
+typedef void (APIENTRY* DeleteShaderProc)(GLuint shader);
+typedef GLuint (APIENTRY* CreateProgramProc)();
+typedef void (APIENTRY* AttachShaderProc)(GLuint program, GLuint shader);
+typedef void (APIENTRY* BindAttribLocationProc)(GLuint program, GLuint index, const char* name);
+typedef void (APIENTRY* LinkProgramProc)(GLuint program);
+typedef void (APIENTRY* GetProgramivProc)(GLuint program, GLenum name, GLint* value);
+typedef void (APIENTRY* GetProgramInfoLogProc)(GLuint program, GLsizei size, GLsizei* length, char* log);
+typedef void (APIENTRY* UseProgramProc)(GLuint program);
+typedef GLint (APIENTRY* GetUniformLocationProc)(GLuint program, const char* name);
+typedef void (APIENTRY* Uniform1iProc)(GLint location, GLint value);
+typedef void (APIENTRY* Uniform1ivProc)(GLint location, GLsizei count, const GLint* values);
+typedef void (APIENTRY* UniformMatrix4fvProc)(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
+typedef void (APIENTRY* VertexAttribPointerProc)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid* pointer);
+typedef void (APIENTRY* EnableVertexAttribArrayProc)(GLuint index);
+typedef void (APIENTRY* DisableVertexAttribArrayProc)(GLuint index);
+typedef void (APIENTRY* VertexAttribDivisorProc)(GLuint index, GLuint divisor);
+typedef void (APIENTRY* DrawArraysInstancedProc)(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount);
+typedef void (APIENTRY* DrawElementsInstancedProc)(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instanceCount);
+
+class GLExtensions
+{
+
+public:
+	// Looks up every entry point, safe to call more than once.
+	static void load();
+
+	// True if extension is in the GL_EXTENSIONS string.
+	static bool hasExtension(const char* extension);
+	// True if the context's GL_VERSION is at least major.minor.
+	static bool hasVersion(int major, int minor);
+
+	// Compressed textures, GL 1.3 with S3TC formats.
+	static bool textureCompression;
+	static CompressedTexImage2DProc compressedTexImage2D;
+	static GetCompressedTexImageProc getCompressedTexImage;
+
+	// Vertex buffer objects, GL 1.5 or ARB_vertex_buffer_object.
+	static bool vertexBuffers;
+	static GenBuffersProc genBuffers;
+	static DeleteBuffersProc deleteBuffers;
+	static BindBufferProc bindBuffer;
+	static BufferDataProc bufferData;
+	static BufferSubDataProc bufferSubData;
+
+	// GL_INT_2_10_10_10_REV normals and GL_HALF_FLOAT texture co-ordinates in the fixed function arrays.
+	static bool packedVertices;
+
+	// GLSL programs, GL 2.0.
+	static bool shaders;
+	static CreateShaderProc createShader;
+	static ShaderSourceProc shaderSource;
+	static CompileShaderProc compileShader;
+	static GetShaderivProc getShaderiv;
+	static GetShaderInfoLogProc getShaderInfoLog;
+	static DeleteShaderProc deleteShader;
+	static CreateProgramProc createProgram;
+	static AttachShaderProc attachShader;
+	static BindAttribLocationProc bindAttribLocation;
+	static LinkProgramProc linkProgram;
+	static GetProgramivProc getProgramiv;
+	static GetProgramInfoLogProc getProgramInfoLog;
+	static UseProgramProc useProgram;
+	static GetUniformLocationProc getUniformLocation;
+	static Uniform1iProc uniform1i;
+	static Uniform1ivProc uniform1iv;
+	static UniformMatrix4fvProc uniformMatrix4fv;
+	static VertexAttribPointerProc vertexAttribPointer;
+	static EnableVertexAttribArrayProc enableVertexAttribArray;
+	static DisableVertexAttribArrayProc disableVertexAttribArray;
+
+	// Instanced draws with per instance vertex attributes, GL 3.3 or ARB_draw_instanced and ARB_instanced_arrays.
+	// Needs shaders and vertex buffers as well.
+	static bool instancing;
+	static VertexAttribDivisorProc vertexAttribDivisor;
+	static DrawArraysInstancedProc drawArraysInstanced;
+	static DrawElementsInstancedProc drawElementsInstanced;
+
+private:
+	static bool loaded;
+};
+
+#endif
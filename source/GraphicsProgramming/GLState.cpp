@@ -0,0 +1,195 @@
+#include "GLState.h"
+#include <string.h>
+
+bool GLState::useCache = true;
+GLState::Copy GLState::current = {};
+std::vector<GLState::Saved> GLState::stack;
+int GLState::issuedCount = 0;
+int GLState::elidedCount = 0;
+
+// Tracked enables, the lights last. Their order is their index in the copy.
+static const GLenum caps[] = { GL_LIGHTING, GL_COLOR_MATERIAL, GL_BLEND, GL_DEPTH_TEST, GL_STENCIL_TEST, GL_TEXTURE_2D, GL_NORMALIZE,
+	GL_LIGHT0, GL_LIGHT1, GL_LIGHT2, GL_LIGHT3, GL_LIGHT4, GL_LIGHT5, GL_LIGHT6, GL_LIGHT7 };
+static const int firstLight = 7;
+
+int GLState::capIndex(GLenum cap)
+{
+	if (cap >= GL_LIGHT0 && cap <= GL_LIGHT7)
+	{
+		return firstLight + (int)(cap - GL_LIGHT0);
+	}
+	for (int i = 0; i < firstLight; i++)
+	{
+		if (caps[i] == cap)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+void GLState::enable(GLenum cap)
+{
+	set(cap, true);
+}
+
+void GLState::disable(GLenum cap)
+{
+	set(cap, false);
+}
+
+void GLState::set(GLenum cap, bool on)
+{
+	int i = capIndex(cap);
+	if (useCache && i >= 0 && current.enabledKnown[i] && current.enabled[i] == on)
+	{
+		elidedCount++;
+		return;
+	}
+
+	if (on)
+	{
+		glEnable(cap);
+	}
+	else
+	{
+		glDisable(cap);
+	}
+	issuedCount++;
+
+	if (i >= 0)
+	{
+		current.enabled[i] = on;
+		current.enabledKnown[i] = true;
+	}
+}
+
+bool GLState::isEnabled(GLenum cap)
+{
+	int i = capIndex(cap);
+	if (useCache && i >= 0 && current.enabledKnown[i])
+	{
+		return current.enabled[i];
+	}
+	return glIsEnabled(cap) == GL_TRUE;
+}
+
+void GLState::bindTexture(GLuint texture)
+{
+	if (useCache && current.textureKnown && current.texture == texture)
+	{
+		elidedCount++;
+		return;
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+	issuedCount++;
+	current.texture = texture;
+	current.textureKnown = true;
+}
+
+void GLState::deleteTextures(GLsizei count, const GLuint* textures)
+{
+	glDeleteTextures(count, textures);
+	for (GLsizei i = 0; i < count; i++)
+	{
+		if (current.textureKnown && current.texture == textures[i])
+		{
+			current.texture = 0;
+		}
+	}
+}
+
+void GLState::colour(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+	if (useCache && current.colourKnown && current.rgba[0] == r && current.rgba[1] == g && current.rgba[2] == b && current.rgba[3] == a)
+	{
+		elidedCount++;
+		return;
+	}
+
+	glColor4f(r, g, b, a);
+	issuedCount++;
+	current.rgba[0] = r;
+	current.rgba[1] = g;
+	current.rgba[2] = b;
+	current.rgba[3] = a;
+	current.colourKnown = true;
+}
+
+void GLState::colour(const GLfloat* rgba)
+{
+	colour(rgba[0], rgba[1], rgba[2], rgba[3]);
+}
+
+void GLState::pushAttrib(GLbitfield mask)
+{
+	glPushAttrib(mask);
+	Saved saved;
+	saved.mask = mask;
+	saved.copy = current;
+	stack.push_back(saved);
+}
+
+void GLState::popAttrib()
+{
+	glPopAttrib();
+	if (stack.empty())
+	{
+		forget();
+		return;
+	}
+
+	const Saved& saved = stack.back();
+	GLbitfield mask = saved.mask;
+
+	// Which groups each enable is saved with, see the glPushAttrib attribute groups.
+	for (int i = 0; i < capCount; i++)
+	{
+		GLbitfield groups = GL_ENABLE_BIT;
+		switch (caps[i])
+		{
+		case GL_BLEND: groups |= GL_COLOR_BUFFER_BIT; break;
+		case GL_DEPTH_TEST: groups |= GL_DEPTH_BUFFER_BIT; break;
+		case GL_STENCIL_TEST: groups |= GL_STENCIL_BUFFER_BIT; break;
+		case GL_TEXTURE_2D: groups |= GL_TEXTURE_BIT; break;
+		case GL_NORMALIZE: groups |= GL_TRANSFORM_BIT; break;
+		default: groups |= GL_LIGHTING_BIT; break;		// Lighting, colour material and the lights
+		}
+		if ((mask & groups) != 0)
+		{
+			current.enabled[i] = saved.copy.enabled[i];
+			current.enabledKnown[i] = saved.copy.enabledKnown[i];
+		}
+	}
+	if ((mask & GL_TEXTURE_BIT) != 0)
+	{
+		current.texture = saved.copy.texture;
+		current.textureKnown = saved.copy.textureKnown;
+	}
+	if ((mask & GL_CURRENT_BIT) != 0)
+	{
+		memcpy(current.rgba, saved.copy.rgba, sizeof(current.rgba));
+		current.colourKnown = saved.copy.colourKnown;
+	}
+
+	stack.pop_back();
+}
+
+void GLState::forgetTexture()
+{
+	current.textureKnown = false;
+}
+
+void GLState::forget()
+{
+	memset(current.enabledKnown, 0, sizeof(current.enabledKnown));
+	current.textureKnown = false;
+	current.colourKnown = false;
+}
+
+void GLState::resetCounts()
+{
+	issuedCount = 0;
+	elidedCount = 0;
+}
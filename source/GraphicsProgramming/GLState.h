@@ -0,0 +1,75 @@
+// GLState class, a CPU copy of the GL state the scene changes most, so asking for what is already set costs nothing.
+// Covers the enables drawing toggles (lighting, the lights, blending, depth and stencil testing, texturing, normalising,
+// colour material), the 2D texture binding and the current colour. Other enables pass straight through.
+// Use these in place of the gl calls they wrap. Anything changed behind its back, e.g. by a library, must be forgotten
+// so the next change is issued, and glPushAttrib/glPopAttrib must go through it so the copy follows the attribute stack.
+// GL thread only.
+#ifndef _GLSTATE_H_
+#define _GLSTATE_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <vector>
+
+class GLState
+{
+
+public:
+	static void enable(GLenum cap);
+	static void disable(GLenum cap);
+	static void set(GLenum cap, bool on);
+	// From the copy when it's known, saving a round trip to the driver.
+	static bool isEnabled(GLenum cap);
+
+	// Binds to GL_TEXTURE_2D.
+	static void bindTexture(GLuint texture);
+	// Deleting the bound texture binds 0, as glDeleteTextures does.
+	static void deleteTextures(GLsizei count, const GLuint* textures);
+
+	static void colour(GLfloat r, GLfloat g, GLfloat b, GLfloat a = 1.0f);
+	static void colour(const GLfloat* rgba);
+
+	static void pushAttrib(GLbitfield mask);
+	static void popAttrib();
+
+	// Treat the texture binding, or everything, as unknown.
+	static void forgetTexture();
+	static void forget();
+
+	// False to issue every call, switchable at runtime for comparison.
+	static bool useCache;
+
+	// Calls made to GL and calls dropped as already set, since resetCounts.
+	static int issued() { return issuedCount; };
+	static int elided() { return elidedCount; };
+	static void resetCounts();
+
+private:
+	// Index of a tracked enable, or -1.
+	static int capIndex(GLenum cap);
+
+	static const int capCount = 15;
+	struct Copy
+	{
+		bool enabled[capCount];
+		bool enabledKnown[capCount];
+		GLuint texture;
+		bool textureKnown;
+		GLfloat rgba[4];
+		bool colourKnown;
+	};
+	static Copy current;
+
+	// The copy at each glPushAttrib and the mask it was pushed with.
+	struct Saved
+	{
+		GLbitfield mask;
+		Copy copy;
+	};
+	static std::vector<Saved> stack;
+
+	static int issuedCount;
+	static int elidedCount;
+};
+
+#endif
@@ -0,0 +1,369 @@
+#include "Instancing.h"
+#include "GLExtensions.h"
+#include "GLState.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+bool Instancing::useHardware = true;
+const Instancing::Instance* Instancing::current = NULL;
+int Instancing::currentCount = 0;
+bool Instancing::currentHardware = false;
+GLfloat Instancing::currentColour[4];
+GLuint Instancing::program = 0;
+bool Instancing::programFailed = false;
+GLuint Instancing::instanceBuffer = 0;
+GLint Instancing::localLocation = -1;
+GLint Instancing::lightingLocation = -1;
+GLint Instancing::lightsLocation = -1;
+GLint Instancing::colourMaterialLocation = -1;
+GLint Instancing::normalizeLocation = -1;
+GLint Instancing::texturingLocation = -1;
+GLint Instancing::textureLocation = -1;
+int Instancing::calls = 0;
+int Instancing::drawn = 0;
+
+// Attribute slots for the instance data. Clear of the ones some drivers alias to gl_Vertex, gl_Normal, gl_Color
+// and gl_MultiTexCoord0, which the bound arrays use.
+static const GLuint transformAttribute = 9;			// Four columns, 9 to 12
+static const GLuint tintAttribute = 13;
+
+static const GLfloat identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+
+// Fixed function's per vertex lighting equation (GL 2.1 spec 2.14.1), for the lights that are enabled,
+// with GL_COLOR_MATERIAL's ambient and diffuse tracking the colour, and a non local viewer.
+static const char* vertexShaderSource =
+	"#version 120\n"
+	"attribute vec4 instanceColumn0, instanceColumn1, instanceColumn2, instanceColumn3;\n"
+	"attribute vec4 instanceTint;\n"
+	"uniform mat4 local;\n"
+	"uniform bool lighting;\n"
+	"uniform int lights[8];\n"
+	"uniform bool colourMaterial;\n"
+	"uniform bool normalizeNormals;\n"
+	"varying vec2 texCoord;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"	mat4 instance = mat4(instanceColumn0, instanceColumn1, instanceColumn2, instanceColumn3) * local;\n"
+	"	vec4 eyePosition = gl_ModelViewMatrix * (instance * gl_Vertex);\n"
+	"	gl_Position = gl_ProjectionMatrix * eyePosition;\n"
+	"	texCoord = gl_MultiTexCoord0.xy;\n"
+	"\n"
+	"	vec4 colour = gl_Color * instanceTint;\n"
+	"	if (!lighting)\n"
+	"	{\n"
+	"		gl_FrontColor = colour;\n"
+	"		return;\n"
+	"	}\n"
+	"\n"
+	"	// The inverse transpose of the instance's 3x3 is its cofactor matrix over the determinant. Like fixed function the\n"
+	"	// result is only normalised with GL_NORMALIZE, so scaled copies light the same as they would drawn one at a time.\n"
+	"	vec3 c0 = instance[0].xyz;\n"
+	"	vec3 c1 = instance[1].xyz;\n"
+	"	vec3 c2 = instance[2].xyz;\n"
+	"	mat3 cofactor = mat3(cross(c1, c2), cross(c2, c0), cross(c0, c1));\n"
+	"	vec3 normal = gl_NormalMatrix * (cofactor * gl_Normal) / dot(c0, cross(c1, c2));\n"
+	"	if (normalizeNormals)\n"
+	"	{\n"
+	"		normal = normalize(normal);\n"
+	"	}\n"
+	"\n"
+	"	vec4 ambient = colourMaterial ? colour : gl_FrontMaterial.ambient;\n"
+	"	vec4 diffuse = colourMaterial ? colour : gl_FrontMaterial.diffuse;\n"
+	"	vec4 result = gl_FrontMaterial.emission + ambient * gl_LightModel.ambient;\n"
+	"	for (int i = 0; i < 8; i++)\n"
+	"	{\n"
+	"		if (lights[i] == 0)\n"
+	"		{\n"
+	"			continue;\n"
+	"		}\n"
+	"		vec3 toLight;\n"
+	"		float attenuation = 1.0;\n"
+	"		if (gl_LightSource[i].position.w == 0.0)\n"
+	"		{\n"
+	"			toLight = normalize(gl_LightSource[i].position.xyz);\n"
+	"		}\n"
+	"		else\n"
+	"		{\n"
+	"			vec3 offset = gl_LightSource[i].position.xyz / gl_LightSource[i].position.w - eyePosition.xyz / eyePosition.w;\n"
+	"			float distance = length(offset);\n"
+	"			toLight = offset / distance;\n"
+	"			attenuation = 1.0 / (gl_LightSource[i].constantAttenuation + gl_LightSource[i].linearAttenuation * distance +\n"
+	"				gl_LightSource[i].quadraticAttenuation * distance * distance);\n"
+	"			if (gl_LightSource[i].spotCutoff != 180.0)\n"
+	"			{\n"
+	"				float spot = dot(-toLight, normalize(gl_LightSource[i].spotDirection));\n"
+	"				attenuation *= spot >= gl_LightSource[i].spotCosCutoff ? pow(max(spot, 0.0001), gl_LightSource[i].spotExponent) : 0.0;\n"
+	"			}\n"
+	"		}\n"
+	"\n"
+	"		float diffuseFactor = max(dot(normal, toLight), 0.0);\n"
+	"		vec4 term = ambient * gl_LightSource[i].ambient + diffuseFactor * diffuse * gl_LightSource[i].diffuse;\n"
+	"		if (diffuseFactor > 0.0)\n"
+	"		{\n"
+	"			float specularFactor = max(dot(normal, normalize(toLight + vec3(0.0, 0.0, 1.0))), 0.0001);\n"
+	"			term += pow(specularFactor, gl_FrontMaterial.shininess) * gl_FrontMaterial.specular * gl_LightSource[i].specular;\n"
+	"		}\n"
+	"		result += attenuation * term;\n"
+	"	}\n"
+	"	gl_FrontColor = vec4(result.rgb, diffuse.a);\n"
+	"}\n";
+
+// GL_MODULATE texturing.
+static const char* fragmentShaderSource =
+	"#version 120\n"
+	"uniform bool texturing;\n"
+	"uniform sampler2D diffuseMap;\n"
+	"varying vec2 texCoord;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"	vec4 colour = gl_Color;\n"
+	"	if (texturing)\n"
+	"	{\n"
+	"		colour *= texture2D(diffuseMap, texCoord);\n"
+	"	}\n"
+	"	gl_FragColor = colour;\n"
+	"}\n";
+
+// Compiles one stage, printing the log and returning 0 on failure.
+static GLuint compileShader(GLenum type, const char* source)
+{
+	GLuint shader = GLExtensions::createShader(type);
+	GLExtensions::shaderSource(shader, 1, &source, NULL);
+	GLExtensions::compileShader(shader);
+
+	GLint status = 0;
+	GLExtensions::getShaderiv(shader, GL_COMPILE_STATUS, &status);
+	if (status == 0)
+	{
+		GLint length = 0;
+		GLExtensions::getShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+		std::vector<char> log(length + 1, '\0');
+		GLExtensions::getShaderInfoLog(shader, length, NULL, log.data());
+		printf("Instancing: %s shader failed to compile\n%s\n", type == GL_VERTEX_SHADER ? "vertex" : "fragment", log.data());
+		GLExtensions::deleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
+
+Instancing::Instance::Instance()
+{
+	memcpy(transform, identity, sizeof(transform));
+	tint[0] = tint[1] = tint[2] = tint[3] = 1.0f;
+}
+
+Instancing::Instance Instancing::capture(float r, float g, float b, float a)
+{
+	Instance instance;
+	glGetFloatv(GL_MODELVIEW_MATRIX, instance.transform);
+	instance.tint[0] = r;
+	instance.tint[1] = g;
+	instance.tint[2] = b;
+	instance.tint[3] = a;
+	return instance;
+}
+
+bool Instancing::hardware()
+{
+	return useHardware && GLExtensions::instancing && createProgram();
+}
+
+bool Instancing::createProgram()
+{
+	if (program != 0)
+	{
+		return true;
+	}
+	if (programFailed)
+	{
+		return false;
+	}
+
+	// Only tried once, after a failure every draw takes the loop.
+	programFailed = true;
+	GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexShaderSource);
+	GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
+	if (vertexShader == 0 || fragmentShader == 0)
+	{
+		if (vertexShader != 0)
+		{
+			GLExtensions::deleteShader(vertexShader);
+		}
+		if (fragmentShader != 0)
+		{
+			GLExtensions::deleteShader(fragmentShader);
+		}
+		return false;
+	}
+
+	GLuint linked = GLExtensions::createProgram();
+	GLExtensions::attachShader(linked, vertexShader);
+	GLExtensions::attachShader(linked, fragmentShader);
+	const char* columns[4] = { "instanceColumn0", "instanceColumn1", "instanceColumn2", "instanceColumn3" };
+	for (GLuint i = 0; i < 4; i++)
+	{
+		GLExtensions::bindAttribLocation(linked, transformAttribute + i, columns[i]);
+	}
+	GLExtensions::bindAttribLocation(linked, tintAttribute, "instanceTint");
+	GLExtensions::linkProgram(linked);
+	// Flagged for deletion, they go with the program.
+	GLExtensions::deleteShader(vertexShader);
+	GLExtensions::deleteShader(fragmentShader);
+
+	GLint status = 0;
+	GLExtensions::getProgramiv(linked, GL_LINK_STATUS, &status);
+	if (status == 0)
+	{
+		GLint length = 0;
+		GLExtensions::getProgramiv(linked, GL_INFO_LOG_LENGTH, &length);
+		std::vector<char> log(length + 1, '\0');
+		GLExtensions::getProgramInfoLog(linked, length, NULL, log.data());
+		printf("Instancing: program failed to link\n%s\n", log.data());
+		return false;
+	}
+
+	program = linked;
+	localLocation = GLExtensions::getUniformLocation(program, "local");
+	lightingLocation = GLExtensions::getUniformLocation(program, "lighting");
+	lightsLocation = GLExtensions::getUniformLocation(program, "lights");
+	colourMaterialLocation = GLExtensions::getUniformLocation(program, "colourMaterial");
+	normalizeLocation = GLExtensions::getUniformLocation(program, "normalizeNormals");
+	texturingLocation = GLExtensions::getUniformLocation(program, "texturing");
+	textureLocation = GLExtensions::getUniformLocation(program, "diffuseMap");
+	GLExtensions::genBuffers(1, &instanceBuffer);
+	programFailed = false;
+	return true;
+}
+
+void Instancing::begin(const Instance* instances, int count)
+{
+	current = instances;
+	currentCount = count;
+	currentHardware = count > 0 && hardware();
+	if (!currentHardware)
+	{
+		// Tints multiply the colour the caller set, put back in end.
+		glGetFloatv(GL_CURRENT_COLOR, currentColour);
+		return;
+	}
+
+	// Upload the instances once for every draw up to end, re-specifying the store so the driver needn't wait on the last frame's.
+	GLExtensions::bindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	GLExtensions::bufferData(GL_ARRAY_BUFFER, count * sizeof(Instance), NULL, GL_STREAM_DRAW);
+	GLExtensions::bufferData(GL_ARRAY_BUFFER, count * sizeof(Instance), instances, GL_STREAM_DRAW);
+	for (GLuint i = 0; i < 4; i++)
+	{
+		GLExtensions::vertexAttribPointer(transformAttribute + i, 4, GL_FLOAT, GL_FALSE, sizeof(Instance),
+			(const GLvoid*)(offsetof(Instance, transform) + i * 4 * sizeof(GLfloat)));
+		GLExtensions::enableVertexAttribArray(transformAttribute + i);
+		GLExtensions::vertexAttribDivisor(transformAttribute + i, 1);
+	}
+	GLExtensions::vertexAttribPointer(tintAttribute, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (const GLvoid*)offsetof(Instance, tint));
+	GLExtensions::enableVertexAttribArray(tintAttribute);
+	GLExtensions::vertexAttribDivisor(tintAttribute, 1);
+	GLExtensions::bindBuffer(GL_ARRAY_BUFFER, 0);
+
+	GLExtensions::useProgram(program);
+}
+
+void Instancing::setUniforms(const GLfloat* local)
+{
+	GLExtensions::uniformMatrix4fv(localLocation, 1, GL_FALSE, local != NULL ? local : identity);
+	GLExtensions::uniform1i(lightingLocation, GLState::isEnabled(GL_LIGHTING));
+	GLint lights[8];
+	for (int i = 0; i < 8; i++)
+	{
+		lights[i] = GLState::isEnabled(GL_LIGHT0 + i);
+	}
+	GLExtensions::uniform1iv(lightsLocation, 8, lights);
+	GLExtensions::uniform1i(colourMaterialLocation, GLState::isEnabled(GL_COLOR_MATERIAL));
+	GLExtensions::uniform1i(normalizeLocation, GLState::isEnabled(GL_NORMALIZE));
+	GLExtensions::uniform1i(texturingLocation, GLState::isEnabled(GL_TEXTURE_2D));
+	GLExtensions::uniform1i(textureLocation, 0);
+}
+
+void Instancing::drawArrays(GLenum mode, GLint first, GLsizei count, const GLfloat* local)
+{
+	drawn += currentCount;
+	if (currentHardware)
+	{
+		setUniforms(local);
+		GLExtensions::drawArraysInstanced(mode, first, count, currentCount);
+		calls++;
+		return;
+	}
+
+	for (int i = 0; i < currentCount; i++)
+	{
+		const Instance& instance = current[i];
+		glPushMatrix();
+		glMultMatrixf(instance.transform);
+		if (local != NULL)
+		{
+			glMultMatrixf(local);
+		}
+		GLState::colour(currentColour[0] * instance.tint[0], currentColour[1] * instance.tint[1],
+			currentColour[2] * instance.tint[2], currentColour[3] * instance.tint[3]);
+		glDrawArrays(mode, first, count);
+		glPopMatrix();
+	}
+	calls += currentCount;
+}
+
+void Instancing::drawElements(GLenum mode, GLsizei count, GLenum type, const void* indices, const GLfloat* local)
+{
+	drawn += currentCount;
+	if (currentHardware)
+	{
+		setUniforms(local);
+		GLExtensions::drawElementsInstanced(mode, count, type, indices, currentCount);
+		calls++;
+		return;
+	}
+
+	for (int i = 0; i < currentCount; i++)
+	{
+		const Instance& instance = current[i];
+		glPushMatrix();
+		glMultMatrixf(instance.transform);
+		if (local != NULL)
+		{
+			glMultMatrixf(local);
+		}
+		GLState::colour(currentColour[0] * instance.tint[0], currentColour[1] * instance.tint[1],
+			currentColour[2] * instance.tint[2], currentColour[3] * instance.tint[3]);
+		glDrawElements(mode, count, type, indices);
+		glPopMatrix();
+	}
+	calls += currentCount;
+}
+
+void Instancing::end()
+{
+	if (currentHardware)
+	{
+		GLExtensions::useProgram(0);
+		for (GLuint i = 0; i < 4; i++)
+		{
+			GLExtensions::vertexAttribDivisor(transformAttribute + i, 0);
+			GLExtensions::disableVertexAttribArray(transformAttribute + i);
+		}
+		GLExtensions::vertexAttribDivisor(tintAttribute, 0);
+		GLExtensions::disableVertexAttribArray(tintAttribute);
+	}
+	else if (currentCount > 0)
+	{
+		GLState::colour(currentColour);
+	}
+	current = NULL;
+	currentCount = 0;
+}
+
+void Instancing::resetCounts()
+{
+	calls = 0;
+	drawn = 0;
+}
@@ -0,0 +1,71 @@
+// Instancing class, draws the same geometry many times in one call, each copy with its own transform and tint.
+// Uses glDraw*Instanced with the transforms as per instance vertex attributes when the driver supports it. The fixed
+// function pipeline can't read those, so the copies are drawn with a small GLSL program that lights them the way
+// fixed function would, reading the current GL lights, material and enables. Otherwise falls back to a loop of
+// ordinary draws, one glMultMatrixf and glColor per copy, which still saves re-binding the arrays for each.
+// Usage: bind the arrays (e.g. VertexBuffer::bind), begin, any number of drawArrays/drawElements, end.
+#ifndef _INSTANCING_H_
+#define _INSTANCING_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <stddef.h>
+
+class Instancing
+{
+
+public:
+	// One copy of the geometry.
+	struct Instance
+	{
+		// Identity transform, white tint.
+		Instance();
+
+		GLfloat transform[16];			// Column major as glMultMatrixf, applied on top of the current modelview
+		GLfloat tint[4];				// Multiplies the current colour
+	};
+
+	// Instance with the current modelview as its transform. Handy for building transforms with the matrix stack
+	// after a glLoadIdentity.
+	static Instance capture(float r = 1.0f, float g = 1.0f, float b = 1.0f, float a = 1.0f);
+
+	// Starts drawing count copies, the instance data is uploaded once here for every draw up to end.
+	// The array must stay valid until end.
+	static void begin(const Instance* instances, int count);
+	// Draws the bound arrays once per instance. local, if not NULL, is a column major matrix applied before the
+	// instance's own transform, e.g. to place one face of a shape.
+	static void drawArrays(GLenum mode, GLint first, GLsizei count, const GLfloat* local = NULL);
+	static void drawElements(GLenum mode, GLsizei count, GLenum type, const void* indices, const GLfloat* local = NULL);
+	static void end();
+
+	// True if begin will use the hardware path.
+	static bool hardware();
+	// True to use instanced draws when supported, false for the loop, switchable at runtime for comparison.
+	static bool useHardware;
+
+	// Draw calls and copies drawn since resetCounts.
+	static int drawCalls() { return calls; };
+	static int instancesDrawn() { return drawn; };
+	static void resetCounts();
+
+private:
+	// Compiles the program on first use, false if it failed.
+	static bool createProgram();
+	// Applies a draw's local matrix and the current GL state to the program.
+	static void setUniforms(const GLfloat* local);
+
+	static const Instance* current;
+	static int currentCount;
+	static bool currentHardware;
+	static GLfloat currentColour[4];
+
+	static GLuint program;
+	static bool programFailed;
+	static GLuint instanceBuffer;
+	static GLint localLocation, lightingLocation, lightsLocation, colourMaterialLocation, normalizeLocation, texturingLocation, textureLocation;
+
+	static int calls;
+	static int drawn;
+};
+
+#endif
@@ -0,0 +1,260 @@
+#include "Mesh.h"
+#include <algorithm>
+
+// Slot in the open addressed triplet table, v == 0 marks an empty slot as OBJ indices start at 1.
+struct TripletSlot
+{
+	unsigned int v, vt, vn;
+	unsigned int index;
+};
+
+static inline unsigned int hashTriplet(unsigned int v, unsigned int vt, unsigned int vn)
+{
+	unsigned int h = v * 0x9E3779B1u;
+	h ^= vt * 0x85EBCA77u + (h << 6) + (h >> 2);
+	h ^= vn * 0xC2B2AE3Du + (h << 6) + (h >> 2);
+	return h ^ (h >> 15);
+}
+
+bool Mesh::buildFromObj(const ObjData& obj)
+{
+	clear();
+
+	const std::vector<unsigned int>& faces = obj.faces;
+	size_t corners = faces.size() / 3;
+
+	// Table at least twice the number of corners keeps probe chains short.
+	size_t tableSize = 16;
+	while (tableSize < corners * 2)
+	{
+		tableSize <<= 1;
+	}
+	std::vector<TripletSlot> table(tableSize);
+	for (size_t i = 0; i < tableSize; i++)
+	{
+		table[i].v = 0;
+	}
+	size_t mask = tableSize - 1;
+
+	indices.reserve(corners);
+
+	// Material of each triangle kept, offset by one so 0 is no material.
+	std::vector<int> triangleMaterials;
+	triangleMaterials.reserve(corners / 3);
+	size_t nextRange = 0;
+	int material = -1;
+
+	for (size_t i = 0; i < faces.size(); i += 9)
+	{
+		size_t face = i / 9;
+		while (nextRange < obj.materialRanges.size() && obj.materialRanges[nextRange].firstFace <= face)
+		{
+			material = obj.materialRanges[nextRange].material;
+			nextRange++;
+		}
+
+		if (faces[i + 1] == 0 || faces[i + 4] == 0 || faces[i + 7] == 0)
+		{
+			continue;
+		}
+		triangleMaterials.push_back(material + 1);
+
+		for (size_t c = i; c < i + 9; c += 3)
+		{
+			unsigned int v = faces[c], vt = faces[c + 1], vn = faces[c + 2];
+			if (v == 0 || v > obj.verts.size() || vt > obj.texCs.size() || vn == 0 || vn > obj.norms.size())
+			{
+				clear();
+				return false;
+			}
+
+			size_t slot = hashTriplet(v, vt, vn) & mask;
+			while (table[slot].v != 0 && (table[slot].v != v || table[slot].vt != vt || table[slot].vn != vn))
+			{
+				slot = (slot + 1) & mask;
+			}
+
+			if (table[slot].v == 0)
+			{
+				// First time this triplet is seen, add a new vertex.
+				table[slot].v = v;
+				table[slot].vt = vt;
+				table[slot].vn = vn;
+				table[slot].index = (unsigned int)(vertex.size() / 3);
+
+				const Vector3& position = obj.verts[v - 1];
+				const Vector3& uv = obj.texCs[vt - 1];
+				const Vector3& normal = obj.norms[vn - 1];
+				vertex.push_back(position.x);
+				vertex.push_back(position.y);
+				vertex.push_back(position.z);
+				normals.push_back(normal.x);
+				normals.push_back(normal.y);
+				normals.push_back(normal.z);
+				texCoords.push_back(uv.x);
+				texCoords.push_back(uv.y);
+			}
+
+			indices.push_back(table[slot].index);
+		}
+	}
+
+	materialNames = obj.materialNames;
+	groupByMaterial(triangleMaterials, obj.materialNames);
+	return true;
+}
+
+void Mesh::groupByMaterial(const std::vector<int>& triangleMaterials, const std::vector<std::string>& materialNames)
+{
+	// Counting sort of the triangles by material, keeping file order within each material.
+	size_t buckets = materialNames.size() + 1;
+	std::vector<unsigned int> offsets(buckets + 1, 0);
+	for (size_t t = 0; t < triangleMaterials.size(); t++)
+	{
+		offsets[triangleMaterials[t] + 1]++;
+	}
+	for (size_t b = 0; b < buckets; b++)
+	{
+		offsets[b + 1] += offsets[b];
+	}
+
+	subMeshes.clear();
+	for (size_t b = 0; b < buckets; b++)
+	{
+		if (offsets[b + 1] == offsets[b])
+		{
+			continue;
+		}
+		SubMesh subMesh;
+		subMesh.material = (int)b - 1;
+		subMesh.firstIndex = offsets[b] * 3;
+		subMesh.indexCount = (offsets[b + 1] - offsets[b]) * 3;
+		subMeshes.push_back(subMesh);
+	}
+
+	if (subMeshes.size() <= 1)
+	{
+		return;
+	}
+
+	std::vector<unsigned int> sorted(indices.size());
+	for (size_t t = 0; t < triangleMaterials.size(); t++)
+	{
+		unsigned int target = offsets[triangleMaterials[t]]++ * 3;
+		sorted[target] = indices[t * 3];
+		sorted[target + 1] = indices[t * 3 + 1];
+		sorted[target + 2] = indices[t * 3 + 2];
+	}
+	indices.swap(sorted);
+}
+
+void Mesh::compactIndices()
+{
+	if (indices.empty() || vertexCount() > 65536)
+	{
+		return;
+	}
+
+	shortIndices.assign(indices.begin(), indices.end());
+	std::vector<unsigned int>().swap(indices);
+}
+
+void Mesh::clear()
+{
+	vertex.clear();
+	normals.clear();
+	texCoords.clear();
+	indices.clear();
+	shortIndices.clear();
+	subMeshes.clear();
+	materialNames.clear();
+	lods.clear();
+}
+
+void Mesh::copyFrom(const MeshView& view)
+{
+	clear();
+	vertex.assign(view.vertex, view.vertex + view.vertexCount * 3);
+	normals.assign(view.normals, view.normals + view.vertexCount * 3);
+	texCoords.assign(view.texCoords, view.texCoords + view.vertexCount * 2);
+	if (view.shortIndices)
+	{
+		const unsigned short* source = (const unsigned short*)view.indices;
+		indices.assign(source, source + view.indexCount);
+	}
+	else
+	{
+		const unsigned int* source = (const unsigned int*)view.indices;
+		indices.assign(source, source + view.indexCount);
+	}
+	subMeshes.assign(view.subMeshes, view.subMeshes + view.subMeshCount);
+	materialNames.assign(view.materialNames.begin(), view.materialNames.end());
+	lods.assign(view.lods, view.lods + view.lodCount);
+	boundsMin = view.boundsMin;
+	boundsMax = view.boundsMax;
+}
+
+void Mesh::computeBounds()
+{
+	if (vertex.empty())
+	{
+		boundsMin = Vector3(0, 0, 0);
+		boundsMax = Vector3(0, 0, 0);
+		return;
+	}
+
+	boundsMin = Vector3(vertex[0], vertex[1], vertex[2]);
+	boundsMax = boundsMin;
+	for (size_t i = 3; i < vertex.size(); i += 3)
+	{
+		boundsMin.x = std::min(boundsMin.x, vertex[i]);
+		boundsMin.y = std::min(boundsMin.y, vertex[i + 1]);
+		boundsMin.z = std::min(boundsMin.z, vertex[i + 2]);
+		boundsMax.x = std::max(boundsMax.x, vertex[i]);
+		boundsMax.y = std::max(boundsMax.y, vertex[i + 1]);
+		boundsMax.z = std::max(boundsMax.z, vertex[i + 2]);
+	}
+}
+
+MeshView Mesh::view() const
+{
+	MeshView result;
+	result.vertex = vertex.data();
+	result.normals = normals.data();
+	result.texCoords = texCoords.data();
+	result.indices = indexData();
+	result.vertexCount = vertexCount();
+	result.indexCount = indexCount();
+	result.shortIndices = hasShortIndices();
+	result.subMeshes = subMeshes.data();
+	result.subMeshCount = (int)subMeshes.size();
+	result.lods = lods.data();
+	result.lodCount = (int)lods.size();
+	result.boundsMin = boundsMin;
+	result.boundsMax = boundsMax;
+	for (size_t i = 0; i < materialNames.size(); i++)
+	{
+		result.materialNames.push_back(materialNames[i].c_str());
+	}
+	return result;
+}
+
+const void* Mesh::indexData() const
+{
+	if (hasShortIndices())
+	{
+		return shortIndices.data();
+	}
+	return indices.data();
+}
+
+size_t Mesh::memoryUsage() const
+{
+	return (vertex.size() + normals.size() + texCoords.size()) * sizeof(float) +
+		indices.size() * sizeof(unsigned int) + shortIndices.size() * sizeof(unsigned short);
+}
+
+size_t Mesh::expandedMemoryUsage() const
+{
+	return (size_t)indexCount() * 8 * sizeof(float);
+}
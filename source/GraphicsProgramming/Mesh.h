@@ -0,0 +1,93 @@
+// Mesh class, an indexed triangle mesh built from parsed OBJ data.
+// Each distinct v/vt/vn triplet becomes one vertex, faces index into them.
+// Holds no GL state so it can be shared between Model and the offline tools.
+#ifndef _MESH_H_
+#define _MESH_H_
+
+#include <vector>
+#include <string>
+#include "ObjParser.h"
+
+// A run of the index buffer drawn with one material. Plain data so it can be stored in the mesh cache as is.
+struct SubMesh
+{
+	int material;					// Index into the mesh's material names, -1 if the faces had no usemtl
+	unsigned int firstIndex;
+	unsigned int indexCount;
+};
+
+// A level of detail, a run of submeshes drawn in place of the full detail ones. Plain data for the mesh cache.
+struct MeshLod
+{
+	unsigned int firstSubMesh;
+	unsigned int subMeshCount;
+	unsigned int indexCount;		// Over all of its submeshes
+	float error;					// Furthest the surface moved from full detail, in model units
+};
+
+// Read-only pointers to mesh arrays, pointing into either a Mesh or a mapped cache file.
+struct MeshView
+{
+	const float* vertex;
+	const float* normals;
+	const float* texCoords;
+	const void* indices;
+	int vertexCount;
+	int indexCount;
+	bool shortIndices;
+	const SubMesh* subMeshes;
+	int subMeshCount;
+	const MeshLod* lods;
+	int lodCount;
+	Vector3 boundsMin, boundsMax;
+	// usemtl names indexed by SubMesh::material, pointing into the mesh's strings or the cache's name table.
+	std::vector<const char*> materialNames;
+};
+
+class Mesh
+{
+
+public:
+	// Builds unique vertices and the index buffer from the OBJ faces, with triangles grouped into one SubMesh per material.
+	// Triangles with a corner missing its texture co-ordinate are skipped. Returns false if an index is out of range.
+	bool buildFromObj(const ObjData& obj);
+	// Switches to 16 bit indices when every index fits, freeing the 32 bit ones.
+	void compactIndices();
+	void clear();
+	// Copies the arrays a view points at, expanding 16 bit indices to 32 bit.
+	void copyFrom(const MeshView& view);
+	// Recalculates the axis aligned bounding box from the vertex positions.
+	void computeBounds();
+	// Pointers to this mesh's arrays, valid until it is modified.
+	MeshView view() const;
+
+	int vertexCount() const { return (int)(vertex.size() / 3); };
+	int indexCount() const { return (int)(indices.empty() ? shortIndices.size() : indices.size()); };
+	bool hasShortIndices() const { return indices.empty() && !shortIndices.empty(); };
+	const void* indexData() const;
+
+	// Bytes used by the vertex and index arrays.
+	size_t memoryUsage() const;
+	// Bytes the same triangles would use as unindexed vertex arrays (one vertex per corner).
+	size_t expandedMemoryUsage() const;
+
+	// Per vertex data, 3 floats position, 3 floats normal, 2 floats texture co-ordinate.
+	std::vector<float> vertex, normals, texCoords;
+	// Triangle list indices, only one of these is filled.
+	std::vector<unsigned int> indices;
+	std::vector<unsigned short> shortIndices;
+	// Index ranges per material, in order of first use in the file.
+	std::vector<SubMesh> subMeshes;
+	// usemtl names from the OBJ, indexed by SubMesh::material.
+	std::vector<std::string> materialNames;
+	// Levels of detail finest first, see MeshSimplifier. Empty if only the full detail mesh was built, which is then every submesh.
+	std::vector<MeshLod> lods;
+	// Axis aligned bounding box, see computeBounds.
+	Vector3 boundsMin, boundsMax;
+
+private:
+	// Reorders indices so each material's triangles are contiguous and fills subMeshes.
+	void groupByMaterial(const std::vector<int>& triangleMaterials, const std::vector<std::string>& materialNames);
+};
+
+#endif
@@ -0,0 +1,314 @@
+// Below ifdef required to remove warnings for unsafe version of fopen.
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "MeshCache.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+std::string MeshCache::cachePath(const char* sourceFilename)
+{
+	return std::string(sourceFilename) + ".meshcache";
+}
+
+unsigned long long MeshCache::hash(const char* data, size_t size)
+{
+	const unsigned long long prime = 0x100000001B3ull;
+	unsigned long long h = 0xCBF29CE484222325ull ^ size;
+
+	// Mix a word at a time, the tail a byte at a time.
+	size_t words = size / 8;
+	for (size_t i = 0; i < words; i++)
+	{
+		unsigned long long word;
+		memcpy(&word, data + i * 8, 8);
+		h = (h ^ word) * prime;
+		h ^= h >> 29;
+	}
+	for (size_t i = words * 8; i < size; i++)
+	{
+		h = (h ^ (unsigned char)data[i]) * prime;
+	}
+
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDull;
+	h ^= h >> 33;
+	return h;
+}
+
+bool MeshCache::sourceInfo(const char* filename, unsigned long long& size, unsigned long long& time)
+{
+	struct stat info;
+	if (stat(filename, &info) != 0)
+	{
+		return false;
+	}
+	size = (unsigned long long)info.st_size;
+	time = (unsigned long long)info.st_mtime;
+	return true;
+}
+
+bool MeshCache::write(const char* sourceFilename, const Mesh& mesh)
+{
+	MeshCacheHeader source;
+	memset(&source, 0, sizeof(source));
+	if (!sourceInfo(sourceFilename, source.sourceSize, source.sourceTime))
+	{
+		return false;
+	}
+	MappedFile sourceFile;
+	if (!sourceFile.open(sourceFilename))
+	{
+		return false;
+	}
+	source.sourceHash = hash(sourceFile.data(), sourceFile.size());
+	sourceFile.close();
+
+	return writeFile(cachePath(sourceFilename).c_str(), mesh, source);
+}
+
+bool MeshCache::writeFile(const char* cacheFilename, const Mesh& mesh, const MeshCacheHeader& source)
+{
+	MeshCacheHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "MSHC", 4);
+	header.version = version;
+	header.sourceSize = source.sourceSize;
+	header.sourceTime = source.sourceTime;
+	header.sourceHash = source.sourceHash;
+
+	header.boundsMin[0] = mesh.boundsMin.x;
+	header.boundsMin[1] = mesh.boundsMin.y;
+	header.boundsMin[2] = mesh.boundsMin.z;
+	header.boundsMax[0] = mesh.boundsMax.x;
+	header.boundsMax[1] = mesh.boundsMax.y;
+	header.boundsMax[2] = mesh.boundsMax.z;
+	header.vertexCount = (unsigned int)mesh.vertexCount();
+	header.indexCount = (unsigned int)mesh.indexCount();
+	header.indexSize = mesh.hasShortIndices() ? 2 : 4;
+	header.subMeshCount = (unsigned int)mesh.subMeshes.size();
+	header.lodCount = (unsigned int)mesh.lods.size();
+	header.materialCount = (unsigned int)mesh.materialNames.size();
+	for (size_t i = 0; i < mesh.materialNames.size(); i++)
+	{
+		header.materialTableSize += (unsigned int)materialEntrySize(mesh.materialNames[i].size());
+	}
+
+	// Write to a temporary file first so a half written cache is never picked up.
+	std::string path = cacheFilename;
+	std::string tempPath = path + ".tmp";
+	FILE* file = fopen(tempPath.c_str(), "wb");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	bool result = fwrite(&header, sizeof(header), 1, file) == 1;
+	result = result && fwrite(mesh.subMeshes.data(), sizeof(SubMesh), mesh.subMeshes.size(), file) == mesh.subMeshes.size();
+	result = result && fwrite(mesh.lods.data(), sizeof(MeshLod), mesh.lods.size(), file) == mesh.lods.size();
+	result = result && fwrite(mesh.vertex.data(), sizeof(float), mesh.vertex.size(), file) == mesh.vertex.size();
+	result = result && fwrite(mesh.normals.data(), sizeof(float), mesh.normals.size(), file) == mesh.normals.size();
+	result = result && fwrite(mesh.texCoords.data(), sizeof(float), mesh.texCoords.size(), file) == mesh.texCoords.size();
+	result = result && fwrite(mesh.indexData(), header.indexSize, header.indexCount, file) == header.indexCount;
+	if (header.indexSize == 2 && (header.indexCount & 1) != 0)
+	{
+		// Pad so the file stays a multiple of 4 bytes.
+		unsigned short padding = 0;
+		result = result && fwrite(&padding, sizeof(padding), 1, file) == 1;
+	}
+	for (size_t i = 0; i < mesh.materialNames.size() && result; i++)
+	{
+		// Length, characters, then the terminator and padding as zeros.
+		const std::string& name = mesh.materialNames[i];
+		unsigned int length = (unsigned int)name.size();
+		const char zeros[4] = { 0, 0, 0, 0 };
+		size_t padding = materialEntrySize(name.size()) - sizeof(length) - name.size();
+		result = fwrite(&length, sizeof(length), 1, file) == 1 && fwrite(name.c_str(), 1, name.size(), file) == name.size() &&
+			fwrite(zeros, 1, padding, file) == padding;
+	}
+	fclose(file);
+
+	if (!result)
+	{
+		remove(tempPath.c_str());
+		return false;
+	}
+
+	remove(path.c_str());
+	return rename(tempPath.c_str(), path.c_str()) == 0;
+}
+
+size_t MeshCache::materialEntrySize(size_t length)
+{
+	return (sizeof(unsigned int) + length + 1 + 3) / 4 * 4;
+}
+
+bool MeshCache::readMapped(const MappedFile& file, MeshView& view)
+{
+	if (file.size() < sizeof(MeshCacheHeader))
+	{
+		return false;
+	}
+
+	const MeshCacheHeader* header = (const MeshCacheHeader*)file.data();
+	if (memcmp(header->magic, "MSHC", 4) != 0 || header->version != version ||
+		(header->indexSize != 2 && header->indexSize != 4))
+	{
+		return false;
+	}
+
+	unsigned long long arrays = (unsigned long long)header->subMeshCount * sizeof(SubMesh) +
+		(unsigned long long)header->lodCount * sizeof(MeshLod) +
+		(unsigned long long)header->vertexCount * 8 * sizeof(float) +
+		((unsigned long long)header->indexCount * header->indexSize + 3) / 4 * 4 +
+		header->materialTableSize;
+	if (file.size() < sizeof(MeshCacheHeader) + arrays)
+	{
+		return false;
+	}
+
+	const SubMesh* subMeshes = (const SubMesh*)(file.data() + sizeof(MeshCacheHeader));
+	const MeshLod* lods = (const MeshLod*)(subMeshes + header->subMeshCount);
+	for (unsigned int i = 0; i < header->lodCount; i++)
+	{
+		if ((unsigned long long)lods[i].firstSubMesh + lods[i].subMeshCount > header->subMeshCount)
+		{
+			return false;
+		}
+	}
+	for (unsigned int i = 0; i < header->subMeshCount; i++)
+	{
+		if ((unsigned long long)subMeshes[i].firstIndex + subMeshes[i].indexCount > header->indexCount ||
+			subMeshes[i].material < -1 || subMeshes[i].material >= (int)header->materialCount)
+		{
+			return false;
+		}
+	}
+	const float* floats = (const float*)(lods + header->lodCount);
+
+	// Every index must name a vertex, or a corrupt cache would have glDrawElements read past the arrays.
+	const void* indices = floats + header->vertexCount * 8;
+	if (header->indexSize == 2)
+	{
+		const unsigned short* shortIndices = (const unsigned short*)indices;
+		for (unsigned int i = 0; i < header->indexCount; i++)
+		{
+			if (shortIndices[i] >= header->vertexCount)
+			{
+				return false;
+			}
+		}
+	}
+	else
+	{
+		const unsigned int* longIndices = (const unsigned int*)indices;
+		for (unsigned int i = 0; i < header->indexCount; i++)
+		{
+			if (longIndices[i] >= header->vertexCount)
+			{
+				return false;
+			}
+		}
+	}
+
+	// Each name must fit in the table and end in its terminator, so the view can hand them out as C strings.
+	const char* table = (const char*)indices + ((size_t)header->indexCount * header->indexSize + 3) / 4 * 4;
+	std::vector<const char*> materialNames;
+	size_t offset = 0;
+	for (unsigned int i = 0; i < header->materialCount; i++)
+	{
+		unsigned int length;
+		if (header->materialTableSize - offset < sizeof(length))
+		{
+			return false;
+		}
+		memcpy(&length, table + offset, sizeof(length));
+		if (length >= header->materialTableSize - offset || header->materialTableSize - offset < materialEntrySize(length) ||
+			table[offset + sizeof(length) + length] != '\0')
+		{
+			return false;
+		}
+		materialNames.push_back(table + offset + sizeof(length));
+		offset += materialEntrySize(length);
+	}
+
+	view.vertex = floats;
+	view.normals = floats + header->vertexCount * 3;
+	view.texCoords = floats + header->vertexCount * 6;
+	view.indices = indices;
+	view.vertexCount = (int)header->vertexCount;
+	view.indexCount = (int)header->indexCount;
+	view.shortIndices = header->indexSize == 2;
+	view.subMeshes = subMeshes;
+	view.subMeshCount = (int)header->subMeshCount;
+	view.lods = lods;
+	view.lodCount = (int)header->lodCount;
+	view.boundsMin = Vector3(header->boundsMin[0], header->boundsMin[1], header->boundsMin[2]);
+	view.boundsMax = Vector3(header->boundsMax[0], header->boundsMax[1], header->boundsMax[2]);
+	view.materialNames.swap(materialNames);
+	return true;
+}
+
+bool MeshCache::loadFile(const char* cacheFilename, MappedFile& file, MeshView& view)
+{
+	if (!file.open(cacheFilename))
+	{
+		return false;
+	}
+	if (!readMapped(file, view))
+	{
+		file.close();
+		return false;
+	}
+	return true;
+}
+
+bool MeshCache::load(const char* sourceFilename, MappedFile& file, MeshView& view)
+{
+	unsigned long long size, time;
+	if (!sourceInfo(sourceFilename, size, time))
+	{
+		return false;
+	}
+
+	std::string path = cachePath(sourceFilename);
+	if (!loadFile(path.c_str(), file, view))
+	{
+		return false;
+	}
+
+	const MeshCacheHeader* header = (const MeshCacheHeader*)file.data();
+	if (header->sourceSize == size && header->sourceTime == time)
+	{
+		return true;
+	}
+
+	// Modified time changed (e.g. a fresh checkout), the cache is still good if the content is the same.
+	if (header->sourceSize == size)
+	{
+		MappedFile source;
+		if (source.open(sourceFilename) && hash(source.data(), source.size()) == header->sourceHash)
+		{
+			// Record the new time so later loads don't hash the source again. The mapping is read only, so the
+			// header is patched through the file and the cache mapped again.
+			file.close();
+			FILE* cache = fopen(path.c_str(), "r+b");
+			if (cache != NULL)
+			{
+				if (fseek(cache, (long)offsetof(MeshCacheHeader, sourceTime), SEEK_SET) == 0)
+				{
+					fwrite(&time, sizeof(time), 1, cache);
+				}
+				fclose(cache);
+			}
+			return loadFile(path.c_str(), file, view);
+		}
+	}
+
+	file.close();
+	return false;
+}
@@ -0,0 +1,66 @@
+// MeshCache class, reads and writes cooked binary copies of a Mesh next to its source OBJ file.
+// The cache is a fixed header followed by the submesh table and the flat vertex, normal, texture co-ordinate and index arrays,
+// so a valid cache can be mapped and its arrays handed to GL without any parsing.
+// A cache is valid while the source size and modified time match, or failing that its content hash.
+#ifndef _MESHCACHE_H_
+#define _MESHCACHE_H_
+
+#include <string>
+#include "Mesh.h"
+#include "ObjParser.h"
+
+// On disk header, arrays follow in the order subMeshes, lods, vertex, normals, texCoords, indices, then the material name
+// table. Each name is its unsigned int length, its characters and a terminating 0, padded to a multiple of 4 bytes.
+struct MeshCacheHeader
+{
+	char magic[4];						// "MSHC"
+	unsigned int version;
+	unsigned long long sourceSize;
+	unsigned long long sourceTime;
+	unsigned long long sourceHash;
+	float boundsMin[3];
+	float boundsMax[3];
+	unsigned int vertexCount;
+	unsigned int indexCount;
+	unsigned int indexSize;				// 2 or 4 bytes
+	unsigned int subMeshCount;
+	unsigned int lodCount;
+	unsigned int materialCount;
+	unsigned int materialTableSize;		// Bytes
+};
+
+class MeshCache
+{
+
+public:
+	// Bump when the layout or content changes, older caches are rebuilt.
+	// 3: triangles and vertices are stored in MeshOptimizer order.
+	// 4: level of detail chain from MeshSimplifier.
+	// 5: submeshes index a material name table instead of holding a fixed length name.
+	static const unsigned int version = 5;
+
+	// Path of the cache file for a source file.
+	static std::string cachePath(const char* sourceFilename);
+	// Writes the cache for a mesh built from sourceFilename. Returns false if it couldn't be written.
+	static bool write(const char* sourceFilename, const Mesh& mesh);
+	// Writes a cache file directly, taking the source size, time and hash from source (e.g. the header of the cache it replaces).
+	static bool writeFile(const char* cacheFilename, const Mesh& mesh, const MeshCacheHeader& source);
+	// Maps the cache for sourceFilename into file and points view at its arrays.
+	// Returns false if there is no cache, or it is out of date.
+	static bool load(const char* sourceFilename, MappedFile& file, MeshView& view);
+	// Maps a cache file directly, without checking it against its source.
+	static bool loadFile(const char* cacheFilename, MappedFile& file, MeshView& view);
+
+	// 64 bit content hash used to validate caches.
+	static unsigned long long hash(const char* data, size_t size);
+	// Fills the size and modified time of a file, false if it doesn't exist.
+	static bool sourceInfo(const char* filename, unsigned long long& size, unsigned long long& time);
+
+private:
+	// Bytes a material name of length characters takes in the name table.
+	static size_t materialEntrySize(size_t length);
+	// Checks a mapped cache's header and sizes, and points view at its arrays.
+	static bool readMapped(const MappedFile& file, MeshView& view);
+};
+
+#endif
@@ -0,0 +1,283 @@
+#include "MeshOptimizer.h"
+#include <math.h>
+#include <vector>
+
+// Score of a vertex from its position in the simulated cache (-1 if not in it) and the
+// number of triangles still to be drawn that use it. Constants from Forsyth's paper.
+static float vertexScore(int cachePosition, int remainingValence)
+{
+	if (remainingValence == 0)
+	{
+		return -1.0f;
+	}
+
+	float score = 0.0f;
+	if (cachePosition >= 0)
+	{
+		if (cachePosition < 3)
+		{
+			// Used by the triangle just drawn, a fixed score so the next triangle doesn't just strip along.
+			score = 0.75f;
+		}
+		else
+		{
+			float scale = 1.0f - (float)(cachePosition - 3) / (MeshOptimizer::cacheSize - 3);
+			score = powf(scale, 1.5f);
+		}
+	}
+
+	// Boost vertices with few triangles left, so lone triangles get finished off.
+	score += 2.0f / sqrtf((float)remainingValence);
+	return score;
+}
+
+void MeshOptimizer::optimizeVertexCache(unsigned int* indices, size_t indexCount, int vertexCount)
+{
+	size_t triangleCount = indexCount / 3;
+	if (triangleCount < 2)
+	{
+		return;
+	}
+
+	// Triangles using each vertex, the first remaining[v] of each list are the ones not yet drawn.
+	std::vector<unsigned int> offsets(vertexCount + 1, 0);
+	for (size_t i = 0; i < triangleCount * 3; i++)
+	{
+		offsets[indices[i] + 1]++;
+	}
+	for (int v = 0; v < vertexCount; v++)
+	{
+		offsets[v + 1] += offsets[v];
+	}
+	std::vector<unsigned int> adjacency(triangleCount * 3);
+	std::vector<int> remaining(vertexCount, 0);
+	for (size_t i = 0; i < triangleCount * 3; i++)
+	{
+		unsigned int v = indices[i];
+		adjacency[offsets[v] + remaining[v]++] = (unsigned int)(i / 3);
+	}
+
+	std::vector<int> cachePosition(vertexCount, -1);
+	std::vector<float> score(vertexCount);
+	for (int v = 0; v < vertexCount; v++)
+	{
+		score[v] = vertexScore(-1, remaining[v]);
+	}
+	std::vector<float> triangleScore(triangleCount);
+	for (size_t t = 0; t < triangleCount; t++)
+	{
+		triangleScore[t] = score[indices[t * 3]] + score[indices[t * 3 + 1]] + score[indices[t * 3 + 2]];
+	}
+
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<unsigned int> output;
+	output.reserve(triangleCount * 3);
+
+	int cache[cacheSize + 3];
+	int cacheCount = 0;
+	size_t scanCursor = 0;
+	long long best = -1;
+
+	while (output.size() < triangleCount * 3)
+	{
+		if (best < 0)
+		{
+			// Nothing in the cache has triangles left, carry on with the next undrawn triangle in file order.
+			while (emitted[scanCursor])
+			{
+				scanCursor++;
+			}
+			best = (long long)scanCursor;
+		}
+
+		const unsigned int* triangle = indices + best * 3;
+		emitted[best] = true;
+		for (int c = 0; c < 3; c++)
+		{
+			unsigned int v = triangle[c];
+			output.push_back(v);
+
+			// Take the triangle off the vertex's undrawn list.
+			unsigned int* list = &adjacency[offsets[v]];
+			for (int j = 0; j < remaining[v]; j++)
+			{
+				if (list[j] == (unsigned int)best)
+				{
+					list[j] = list[remaining[v] - 1];
+					remaining[v]--;
+					break;
+				}
+			}
+		}
+
+		// Move the triangle's vertices to the front of the LRU cache, anything past cacheSize drops out.
+		int newCache[cacheSize + 3];
+		int newCount = 0;
+		for (int c = 0; c < 3; c++)
+		{
+			int v = (int)triangle[c];
+			if (newCount == 0 || (newCache[0] != v && (newCount < 2 || newCache[1] != v)))
+			{
+				newCache[newCount++] = v;
+			}
+		}
+		int fresh = newCount;
+		for (int i = 0; i < cacheCount; i++)
+		{
+			int v = cache[i];
+			bool inTriangle = false;
+			for (int c = 0; c < fresh; c++)
+			{
+				inTriangle = inTriangle || newCache[c] == v;
+			}
+			if (!inTriangle)
+			{
+				newCache[newCount++] = v;
+			}
+		}
+
+		// Rescore everything that moved and pass the change on to its undrawn triangles.
+		for (int i = 0; i < newCount; i++)
+		{
+			int v = newCache[i];
+			cachePosition[v] = i < cacheSize ? i : -1;
+			float newScore = vertexScore(cachePosition[v], remaining[v]);
+			float delta = newScore - score[v];
+			score[v] = newScore;
+
+			const unsigned int* list = &adjacency[offsets[v]];
+			for (int j = 0; j < remaining[v]; j++)
+			{
+				triangleScore[list[j]] += delta;
+			}
+		}
+
+		cacheCount = newCount < cacheSize ? newCount : cacheSize;
+		for (int i = 0; i < cacheCount; i++)
+		{
+			cache[i] = newCache[i];
+		}
+
+		// Next triangle is the best scoring one using a cached vertex.
+		best = -1;
+		float bestScore = -1.0f;
+		for (int i = 0; i < cacheCount; i++)
+		{
+			int v = cache[i];
+			const unsigned int* list = &adjacency[offsets[v]];
+			for (int j = 0; j < remaining[v]; j++)
+			{
+				if (triangleScore[list[j]] > bestScore)
+				{
+					bestScore = triangleScore[list[j]];
+					best = list[j];
+				}
+			}
+		}
+	}
+
+	for (size_t i = 0; i < output.size(); i++)
+	{
+		indices[i] = output[i];
+	}
+}
+
+void MeshOptimizer::optimizeVertexFetch(Mesh& mesh)
+{
+	int vertexCount = mesh.vertexCount();
+	const unsigned int unused = 0xFFFFFFFFu;
+	std::vector<unsigned int> remap(vertexCount, unused);
+	unsigned int next = 0;
+	for (size_t i = 0; i < mesh.indices.size(); i++)
+	{
+		unsigned int& index = mesh.indices[i];
+		if (remap[index] == unused)
+		{
+			remap[index] = next++;
+		}
+		index = remap[index];
+	}
+
+	std::vector<float> vertex(next * 3), normals(next * 3), texCoords(next * 2);
+	for (int v = 0; v < vertexCount; v++)
+	{
+		unsigned int target = remap[v];
+		if (target == unused)
+		{
+			continue;
+		}
+		for (int c = 0; c < 3; c++)
+		{
+			vertex[target * 3 + c] = mesh.vertex[v * 3 + c];
+			normals[target * 3 + c] = mesh.normals[v * 3 + c];
+		}
+		texCoords[target * 2] = mesh.texCoords[v * 2];
+		texCoords[target * 2 + 1] = mesh.texCoords[v * 2 + 1];
+	}
+	mesh.vertex.swap(vertex);
+	mesh.normals.swap(normals);
+	mesh.texCoords.swap(texCoords);
+}
+
+void MeshOptimizer::optimize(Mesh& mesh)
+{
+	if (mesh.indices.empty())
+	{
+		return;
+	}
+
+	// Per submesh, so each material's index range stays where it is.
+	if (mesh.subMeshes.empty())
+	{
+		optimizeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertexCount());
+	}
+	for (size_t i = 0; i < mesh.subMeshes.size(); i++)
+	{
+		const SubMesh& subMesh = mesh.subMeshes[i];
+		optimizeVertexCache(mesh.indices.data() + subMesh.firstIndex, subMesh.indexCount, mesh.vertexCount());
+	}
+
+	optimizeVertexFetch(mesh);
+}
+
+template<typename Index>
+static float simulateFifo(const Index* indices, size_t indexCount, int vertexCount, int fifoSize)
+{
+	if (indexCount < 3)
+	{
+		return 0.0f;
+	}
+
+	// Each vertex remembers when it entered the FIFO, it's still cached while fewer than fifoSize misses followed.
+	std::vector<long long> entered(vertexCount, -(long long)fifoSize - 1);
+	long long misses = 0;
+	for (size_t i = 0; i < indexCount; i++)
+	{
+		Index v = indices[i];
+		if (misses - entered[v] > fifoSize)
+		{
+			entered[v] = misses;
+			misses++;
+		}
+	}
+	return (float)misses / (indexCount / 3);
+}
+
+float MeshOptimizer::acmr(const unsigned int* indices, size_t indexCount, int vertexCount, int fifoSize)
+{
+	return simulateFifo(indices, indexCount, vertexCount, fifoSize);
+}
+
+float MeshOptimizer::acmr(const unsigned short* indices, size_t indexCount, int vertexCount, int fifoSize)
+{
+	return simulateFifo(indices, indexCount, vertexCount, fifoSize);
+}
+
+float MeshOptimizer::acmr(const Mesh& mesh, int fifoSize)
+{
+	if (mesh.hasShortIndices())
+	{
+		return acmr(mesh.shortIndices.data(), mesh.shortIndices.size(), mesh.vertexCount(), fifoSize);
+	}
+	return acmr(mesh.indices.data(), mesh.indices.size(), mesh.vertexCount(), fifoSize);
+}
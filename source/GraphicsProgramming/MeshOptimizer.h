@@ -0,0 +1,34 @@
+// MeshOptimizer class, reorders an indexed Mesh so the GPU transforms fewer vertices and fetches them in order.
+// Triangles are reordered for the post-transform vertex cache with Tom Forsyth's "Linear-Speed Vertex Cache
+// Optimisation", then vertices are renumbered in the order the triangles first use them.
+// Holds no GL state so it can be shared between Model and the offline tools.
+#ifndef _MESHOPTIMIZER_H_
+#define _MESHOPTIMIZER_H_
+
+#include <stddef.h>
+#include "Mesh.h"
+
+class MeshOptimizer
+{
+
+public:
+	// Size of the LRU cache the triangle order is tuned for.
+	static const int cacheSize = 32;
+
+	// Reorders each submesh's triangles for the vertex cache, then the vertices for fetch order.
+	// The mesh must have 32 bit indices, i.e. be called before Mesh::compactIndices.
+	static void optimize(Mesh& mesh);
+	// Reorders the triangles of one triangle list in place.
+	static void optimizeVertexCache(unsigned int* indices, size_t indexCount, int vertexCount);
+	// Renumbers vertices in the order the indices first use them, dropping any that aren't used.
+	static void optimizeVertexFetch(Mesh& mesh);
+
+	// Average cache miss ratio, vertices transformed per triangle with a FIFO cache of fifoSize entries.
+	// 3 means no reuse at all, a regular grid approaches 0.5.
+	static float acmr(const unsigned int* indices, size_t indexCount, int vertexCount, int fifoSize = 16);
+	static float acmr(const unsigned short* indices, size_t indexCount, int vertexCount, int fifoSize = 16);
+	// ACMR over a whole mesh, whichever index size it has.
+	static float acmr(const Mesh& mesh, int fifoSize = 16);
+};
+
+#endif
@@ -0,0 +1,640 @@
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+// Sum of squared distances to a set of planes, stored as the upper half of a symmetric 4x4 matrix.
+// Weighted by area so error() is the average squared distance rather than growing with the number of planes.
+struct Quadric
+{
+	double a00, a01, a02, a11, a12, a22;
+	double b0, b1, b2;
+	double c;
+	double weight;
+
+	void clear()
+	{
+		memset(this, 0, sizeof(*this));
+	}
+
+	// Plane n.p + d = 0, n unit length.
+	void addPlane(double nx, double ny, double nz, double d, double w)
+	{
+		a00 += w * nx * nx; a01 += w * nx * ny; a02 += w * nx * nz;
+		a11 += w * ny * ny; a12 += w * ny * nz; a22 += w * nz * nz;
+		b0 += w * nx * d; b1 += w * ny * d; b2 += w * nz * d;
+		c += w * d * d;
+		weight += w;
+	}
+
+	void add(const Quadric& q)
+	{
+		a00 += q.a00; a01 += q.a01; a02 += q.a02;
+		a11 += q.a11; a12 += q.a12; a22 += q.a22;
+		b0 += q.b0; b1 += q.b1; b2 += q.b2;
+		c += q.c;
+		weight += q.weight;
+	}
+
+	double error(const float* p) const
+	{
+		if (weight <= 0.0)
+		{
+			return 0.0;
+		}
+		double x = p[0], y = p[1], z = p[2];
+		double result = a00 * x * x + a11 * y * y + a22 * z * z
+			+ 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+			+ 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+		return std::max(result / weight, 0.0);
+	}
+};
+
+// What a vertex is allowed to do when one of its edges is collapsed.
+enum VertexKind
+{
+	Manifold,		// Unique position inside the surface, can move onto any neighbour
+	Border,			// On an open edge, can only move along it
+	Seam,			// One of two vertices sharing a position (UV seam or hard normal), moves along the seam with its twin
+	Locked			// Anything else, e.g. shared by two materials, never moves
+};
+
+// Border planes are weighted up so open edges keep their outline.
+static const double borderWeight = 10.0;
+// Scale of the penalty for moving a vertex onto a neighbour with a different normal.
+static const double normalWeight = 1.0;
+
+static void triangleNormal(const float* a, const float* b, const float* c, double* n)
+{
+	double e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+	double e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+	n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+	n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+	n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+// State of one simplification run, kept between levels so later levels carry the error of earlier ones.
+class Simplifier
+{
+
+public:
+	Simplifier(const Mesh& mesh, std::vector<unsigned int>& indices, std::vector<unsigned int>& subMeshes);
+
+	// Collapses edges until at most targetIndexCount indices are left, or the next collapse costs more than maxError.
+	// Returns the furthest the surface has moved so far, in model units. The shading penalty only orders the collapses.
+	float run(size_t targetIndexCount, float maxError);
+
+private:
+	void buildAdjacency();
+	void classify();
+	void buildQuadrics();
+
+	// Triangles using the vertices a and b.
+	int vertexEdgeCount(unsigned int a, unsigned int b) const;
+	// Triangles using any vertex at a's position and any at b's.
+	int positionEdgeCount(unsigned int a, unsigned int b) const;
+	// Twin of a vertex split by a seam, or the vertex itself if its position is unique.
+	unsigned int twin(unsigned int v) const { return wedge[v]; };
+	// Works out whether u can move onto v, and the vertex its twin would move onto.
+	bool canCollapse(unsigned int u, unsigned int v, unsigned int& twinTarget) const;
+	// Cost of moving u onto v, the surface error plus a penalty for changing the shading. error is set to the surface
+	// error alone, the squared distance the surface moves.
+	double collapseCost(unsigned int u, unsigned int v, unsigned int twinTarget, double& error) const;
+	// True if moving u onto v would turn any of u's remaining triangles over.
+	bool flips(unsigned int u, unsigned int v) const;
+
+	const Mesh& mesh;
+	std::vector<unsigned int>& indices;
+	std::vector<unsigned int>& subMeshes;
+
+	// Positions scaled into a unit box so errors are relative to the mesh size.
+	std::vector<float> positions;
+	float extent;
+	// Vertices at the same position share a group, and its quadric.
+	std::vector<unsigned int> group;
+	std::vector<unsigned int> wedge;
+	std::vector<int> wedgeCount;
+	std::vector<Quadric> quadrics;
+	std::vector<unsigned char> kinds;
+	// Largest surface error of any collapse so far, without the shading penalty.
+	double maxSurfaceError;
+
+	// Triangles using each vertex, rebuilt every pass.
+	std::vector<unsigned int> offsets;
+	std::vector<unsigned int> adjacency;
+};
+
+Simplifier::Simplifier(const Mesh& mesh, std::vector<unsigned int>& indices, std::vector<unsigned int>& subMeshes) :
+	mesh(mesh), indices(indices), subMeshes(subMeshes), extent(1.0f), maxSurfaceError(0.0)
+{
+	int vertexCount = mesh.vertexCount();
+	Vector3 size = mesh.boundsMax;
+	size.subtract(mesh.boundsMin);
+	extent = std::max(size.x, std::max(size.y, size.z));
+	if (extent <= 0.0f)
+	{
+		extent = 1.0f;
+	}
+
+	positions.resize(vertexCount * 3);
+	for (int v = 0; v < vertexCount; v++)
+	{
+		positions[v * 3] = (mesh.vertex[v * 3] - mesh.boundsMin.x) / extent;
+		positions[v * 3 + 1] = (mesh.vertex[v * 3 + 1] - mesh.boundsMin.y) / extent;
+		positions[v * 3 + 2] = (mesh.vertex[v * 3 + 2] - mesh.boundsMin.z) / extent;
+	}
+
+	// Group vertices with exactly the same position, they differ only in normal or texture co-ordinate.
+	std::vector<unsigned int> order(vertexCount);
+	for (int v = 0; v < vertexCount; v++)
+	{
+		order[v] = v;
+	}
+	const float* vertex = mesh.vertex.data();
+	std::sort(order.begin(), order.end(), [vertex](unsigned int a, unsigned int b)
+	{
+		return memcmp(vertex + a * 3, vertex + b * 3, sizeof(float) * 3) < 0;
+	});
+
+	group.resize(vertexCount);
+	wedge.resize(vertexCount);
+	wedgeCount.resize(vertexCount);
+	unsigned int groupCount = 0;
+	for (int i = 0; i < vertexCount;)
+	{
+		int end = i + 1;
+		while (end < vertexCount && memcmp(vertex + order[i] * 3, vertex + order[end] * 3, sizeof(float) * 3) == 0)
+		{
+			end++;
+		}
+		// Link the group into a ring through wedge.
+		for (int j = i; j < end; j++)
+		{
+			group[order[j]] = groupCount;
+			wedge[order[j]] = order[j + 1 < end ? j + 1 : i];
+			wedgeCount[order[j]] = end - i;
+		}
+		groupCount++;
+		i = end;
+	}
+	quadrics.resize(groupCount);
+
+	buildAdjacency();
+	buildQuadrics();
+}
+
+void Simplifier::buildAdjacency()
+{
+	int vertexCount = mesh.vertexCount();
+	offsets.assign(vertexCount + 1, 0);
+	for (size_t i = 0; i < indices.size(); i++)
+	{
+		offsets[indices[i] + 1]++;
+	}
+	for (int v = 0; v < vertexCount; v++)
+	{
+		offsets[v + 1] += offsets[v];
+	}
+	adjacency.resize(indices.size());
+	std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+	for (size_t i = 0; i < indices.size(); i++)
+	{
+		adjacency[fill[indices[i]]++] = (unsigned int)(i / 3);
+	}
+}
+
+int Simplifier::vertexEdgeCount(unsigned int a, unsigned int b) const
+{
+	int count = 0;
+	for (unsigned int i = offsets[a]; i < offsets[a + 1]; i++)
+	{
+		const unsigned int* triangle = &indices[adjacency[i] * 3];
+		if (triangle[0] == b || triangle[1] == b || triangle[2] == b)
+		{
+			count++;
+		}
+	}
+	return count;
+}
+
+int Simplifier::positionEdgeCount(unsigned int a, unsigned int b) const
+{
+	int count = 0;
+	unsigned int target = group[b];
+	unsigned int w = a;
+	do
+	{
+		for (unsigned int i = offsets[w]; i < offsets[w + 1]; i++)
+		{
+			const unsigned int* triangle = &indices[adjacency[i] * 3];
+			if (group[triangle[0]] == target || group[triangle[1]] == target || group[triangle[2]] == target)
+			{
+				count++;
+			}
+		}
+		w = wedge[w];
+	} while (w != a);
+	return count;
+}
+
+void Simplifier::classify()
+{
+	int vertexCount = mesh.vertexCount();
+	kinds.assign(vertexCount, Locked);
+	for (int v = 0; v < vertexCount; v++)
+	{
+		if (offsets[v] == offsets[v + 1] || wedgeCount[v] > 2)
+		{
+			continue;
+		}
+
+		// Every triangle at this position has to be in the same submesh, or moving it would shift a material edge.
+		bool border = false;
+		bool locked = false;
+		unsigned int subMesh = subMeshes[adjacency[offsets[v]]];
+		unsigned int w = v;
+		do
+		{
+			for (unsigned int i = offsets[w]; i < offsets[w + 1] && !locked; i++)
+			{
+				unsigned int t = adjacency[i];
+				locked = subMeshes[t] != subMesh;
+				for (int c = 0; c < 3 && !locked; c++)
+				{
+					unsigned int corner = indices[t * 3 + c];
+					if (group[corner] == group[v])
+					{
+						continue;
+					}
+					int count = positionEdgeCount(v, corner);
+					border = border || count == 1;
+					locked = count > 2;
+				}
+			}
+			w = wedge[w];
+		} while (w != (unsigned int)v && !locked);
+
+		if (locked)
+		{
+			continue;
+		}
+		if (wedgeCount[v] == 1)
+		{
+			kinds[v] = border ? Border : Manifold;
+		}
+		else if (!border)
+		{
+			kinds[v] = Seam;
+		}
+	}
+}
+
+void Simplifier::buildQuadrics()
+{
+	for (size_t g = 0; g < quadrics.size(); g++)
+	{
+		quadrics[g].clear();
+	}
+
+	for (size_t t = 0; t < indices.size() / 3; t++)
+	{
+		const unsigned int* triangle = &indices[t * 3];
+		const float* p[3] = { &positions[triangle[0] * 3], &positions[triangle[1] * 3], &positions[triangle[2] * 3] };
+		double n[3];
+		triangleNormal(p[0], p[1], p[2], n);
+		double length = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+		if (length <= 0.0)
+		{
+			continue;
+		}
+		n[0] /= length; n[1] /= length; n[2] /= length;
+		double d = -(n[0] * p[0][0] + n[1] * p[0][1] + n[2] * p[0][2]);
+		double area = length * 0.5;
+
+		for (int c = 0; c < 3; c++)
+		{
+			quadrics[group[triangle[c]]].addPlane(n[0], n[1], n[2], d, area);
+		}
+
+		// Open edges get a plane through the edge at right angles to the triangle, which holds them in place.
+		for (int c = 0; c < 3; c++)
+		{
+			unsigned int a = triangle[c], b = triangle[(c + 1) % 3];
+			if (positionEdgeCount(a, b) != 1)
+			{
+				continue;
+			}
+			const float* pa = &positions[a * 3];
+			const float* pb = &positions[b * 3];
+			double edge[3] = { pb[0] - pa[0], pb[1] - pa[1], pb[2] - pa[2] };
+			double edgeLengthSquared = edge[0] * edge[0] + edge[1] * edge[1] + edge[2] * edge[2];
+			double m[3] = { edge[1] * n[2] - edge[2] * n[1], edge[2] * n[0] - edge[0] * n[2], edge[0] * n[1] - edge[1] * n[0] };
+			double mLength = sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+			if (mLength <= 0.0)
+			{
+				continue;
+			}
+			m[0] /= mLength; m[1] /= mLength; m[2] /= mLength;
+			double md = -(m[0] * pa[0] + m[1] * pa[1] + m[2] * pa[2]);
+			quadrics[group[a]].addPlane(m[0], m[1], m[2], md, edgeLengthSquared * borderWeight);
+			quadrics[group[b]].addPlane(m[0], m[1], m[2], md, edgeLengthSquared * borderWeight);
+		}
+	}
+}
+
+bool Simplifier::canCollapse(unsigned int u, unsigned int v, unsigned int& twinTarget) const
+{
+	twinTarget = v;
+	if (group[u] == group[v])
+	{
+		return false;
+	}
+
+	// A unique vertex next to a seam has to be on v's side of it, or the triangles on the other side would take v's attributes.
+	if (twin(u) == u && twin(v) != v && vertexEdgeCount(u, twin(v)) != 0)
+	{
+		return false;
+	}
+
+	switch (kinds[u])
+	{
+	case Manifold:
+		return true;
+	case Border:
+		return positionEdgeCount(u, v) == 1;
+	case Seam:
+		{
+			// Only along the seam itself, an edge with one triangle on each side of it at each of the two vertices.
+			if (wedgeCount[v] > 2 || vertexEdgeCount(u, v) != 1 || positionEdgeCount(u, v) != 2)
+			{
+				return false;
+			}
+			unsigned int u2 = twin(u);
+			twinTarget = twin(v);
+			return vertexEdgeCount(u2, twinTarget) == 1;
+		}
+	default:
+		return false;
+	}
+}
+
+double Simplifier::collapseCost(unsigned int u, unsigned int v, unsigned int twinTarget, double& error) const
+{
+	error = quadrics[group[u]].error(&positions[v * 3]);
+
+	// Moving onto a vertex with a different normal changes the shading over the whole fan, not just the shape.
+	const float* pu = &positions[u * 3];
+	const float* pv = &positions[v * 3];
+	double distanceSquared = (pv[0] - pu[0]) * (pv[0] - pu[0]) + (pv[1] - pu[1]) * (pv[1] - pu[1]) + (pv[2] - pu[2]) * (pv[2] - pu[2]);
+	unsigned int pairs[2][2] = { { u, v }, { twin(u), twinTarget } };
+	double normalCost = 0.0;
+	for (int i = 0; i < 2; i++)
+	{
+		const float* nu = &mesh.normals[pairs[i][0] * 3];
+		const float* nv = &mesh.normals[pairs[i][1] * 3];
+		double dot = nu[0] * nv[0] + nu[1] * nv[1] + nu[2] * nv[2];
+		normalCost = std::max(normalCost, (1.0 - std::min(dot, 1.0)) * distanceSquared * normalWeight);
+	}
+	return error + normalCost;
+}
+
+bool Simplifier::flips(unsigned int u, unsigned int v) const
+{
+	unsigned int moved[2] = { u, twin(u) };
+	int count = moved[1] == u ? 1 : 2;
+	for (int m = 0; m < count; m++)
+	{
+		for (unsigned int i = offsets[moved[m]]; i < offsets[moved[m] + 1]; i++)
+		{
+			const unsigned int* triangle = &indices[adjacency[i] * 3];
+			if (group[triangle[0]] == group[v] || group[triangle[1]] == group[v] || group[triangle[2]] == group[v])
+			{
+				continue;		// Collapses away
+			}
+
+			const float* before[3];
+			const float* after[3];
+			for (int c = 0; c < 3; c++)
+			{
+				before[c] = &positions[triangle[c] * 3];
+				after[c] = group[triangle[c]] == group[u] ? &positions[v * 3] : before[c];
+			}
+			double n0[3], n1[3];
+			triangleNormal(before[0], before[1], before[2], n0);
+			triangleNormal(after[0], after[1], after[2], n1);
+			double lengthSquared = n0[0] * n0[0] + n0[1] * n0[1] + n0[2] * n0[2];
+			if (lengthSquared > 0.0 && n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2] <= 0.0)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+float Simplifier::run(size_t targetIndexCount, float maxError)
+{
+	struct Collapse
+	{
+		unsigned int u, v, twinTarget;
+		double cost, error;
+	};
+
+	double costLimit = (double)(maxError / extent) * (maxError / extent);
+	int vertexCount = mesh.vertexCount();
+	std::vector<Collapse> collapses;
+	std::vector<unsigned int> remap(vertexCount);
+	std::vector<bool> touched(vertexCount);
+
+	while (indices.size() > targetIndexCount)
+	{
+		buildAdjacency();
+		classify();
+
+		// Every allowed collapse of every edge, cheapest first.
+		collapses.clear();
+		for (size_t i = 0; i < indices.size(); i++)
+		{
+			unsigned int u = indices[i];
+			unsigned int v = indices[i % 3 == 2 ? i - 2 : i + 1];
+			for (int direction = 0; direction < 2; direction++)
+			{
+				Collapse collapse;
+				if (canCollapse(u, v, collapse.twinTarget))
+				{
+					collapse.u = u;
+					collapse.v = v;
+					collapse.cost = collapseCost(u, v, collapse.twinTarget, collapse.error);
+					if (collapse.cost <= costLimit)
+					{
+						collapses.push_back(collapse);
+					}
+				}
+				std::swap(u, v);
+			}
+		}
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b)
+		{
+			return a.cost < b.cost;
+		});
+
+		// Take the cheapest collapses that don't share any triangles, so each can be checked on its own.
+		for (int v = 0; v < vertexCount; v++)
+		{
+			remap[v] = v;
+			touched[v] = false;
+		}
+		size_t removable = (indices.size() - targetIndexCount) / 3;
+		size_t removed = 0;
+		for (size_t i = 0; i < collapses.size() && removed < removable; i++)
+		{
+			const Collapse& collapse = collapses[i];
+			unsigned int u2 = twin(collapse.u);
+			if (touched[collapse.u] || touched[collapse.v] || touched[u2] || touched[collapse.twinTarget] ||
+				flips(collapse.u, collapse.v))
+			{
+				continue;
+			}
+
+			unsigned int moved[2] = { collapse.u, u2 };
+			for (int m = 0; m < (u2 == collapse.u ? 1 : 2); m++)
+			{
+				for (unsigned int a = offsets[moved[m]]; a < offsets[moved[m] + 1]; a++)
+				{
+					const unsigned int* triangle = &indices[adjacency[a] * 3];
+					touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = true;
+					if (group[triangle[0]] == group[collapse.v] || group[triangle[1]] == group[collapse.v] || group[triangle[2]] == group[collapse.v])
+					{
+						removed++;
+					}
+				}
+			}
+			touched[collapse.v] = touched[collapse.twinTarget] = true;
+
+			remap[collapse.u] = collapse.v;
+			remap[u2] = collapse.twinTarget;
+			quadrics[group[collapse.v]].add(quadrics[group[collapse.u]]);
+			maxSurfaceError = std::max(maxSurfaceError, collapse.error);
+		}
+
+		if (removed == 0)
+		{
+			break;		// Nothing left under the error limit
+		}
+
+		// Rewrite the triangles, dropping the ones that now have two corners in the same place.
+		size_t kept = 0;
+		for (size_t t = 0; t < indices.size() / 3; t++)
+		{
+			unsigned int a = remap[indices[t * 3]], b = remap[indices[t * 3 + 1]], c = remap[indices[t * 3 + 2]];
+			if (group[a] == group[b] || group[b] == group[c] || group[a] == group[c])
+			{
+				continue;
+			}
+			indices[kept * 3] = a;
+			indices[kept * 3 + 1] = b;
+			indices[kept * 3 + 2] = c;
+			subMeshes[kept] = subMeshes[t];
+			kept++;
+		}
+		indices.resize(kept * 3);
+		subMeshes.resize(kept);
+	}
+
+	return (float)sqrt(maxSurfaceError) * extent;
+}
+
+float MeshSimplifier::simplify(const Mesh& mesh, std::vector<unsigned int>& indices, std::vector<unsigned int>& subMeshes,
+	size_t targetIndexCount, float maxError)
+{
+	Simplifier simplifier(mesh, indices, subMeshes);
+	return simplifier.run(targetIndexCount, maxError);
+}
+
+void MeshSimplifier::buildLods(Mesh& mesh, int maxLods, float maxError)
+{
+	if (mesh.indices.empty())
+	{
+		return;
+	}
+
+	// Level 0 is the mesh as it is.
+	mesh.lods.clear();
+	MeshLod full;
+	full.firstSubMesh = 0;
+	full.subMeshCount = (unsigned int)mesh.subMeshes.size();
+	full.indexCount = (unsigned int)mesh.indices.size();
+	full.error = 0.0f;
+	mesh.lods.push_back(full);
+
+	std::vector<unsigned int> indices(mesh.indices);
+	std::vector<unsigned int> subMeshes(indices.size() / 3, 0);
+	for (unsigned int s = 0; s < full.subMeshCount; s++)
+	{
+		const SubMesh& subMesh = mesh.subMeshes[s];
+		std::fill(subMeshes.begin() + subMesh.firstIndex / 3, subMeshes.begin() + (subMesh.firstIndex + subMesh.indexCount) / 3, s);
+	}
+
+	Vector3 size = mesh.boundsMax;
+	size.subtract(mesh.boundsMin);
+	float limit = maxError * std::max(size.x, std::max(size.y, size.z));
+
+	// One run for the whole chain, each level carries on collapsing from the last.
+	Simplifier simplifier(mesh, indices, subMeshes);
+	size_t previous = indices.size();
+	for (int lod = 1; lod <= maxLods; lod++)
+	{
+		float error = simplifier.run(previous / 2, limit);
+		if (indices.size() > previous * 3 / 4)
+		{
+			break;		// Not enough fewer triangles to be worth a level
+		}
+		previous = indices.size();
+
+		// Regroup the triangles by submesh, keeping the material order of level 0.
+		std::vector<unsigned int> counts(full.subMeshCount + 1, 0);
+		for (size_t t = 0; t < subMeshes.size(); t++)
+		{
+			counts[subMeshes[t] + 1]++;
+		}
+		for (unsigned int s = 0; s < full.subMeshCount; s++)
+		{
+			counts[s + 1] += counts[s];
+		}
+		std::vector<unsigned int> sorted(indices.size());
+		std::vector<unsigned int> fill(counts.begin(), counts.end() - 1);
+		for (size_t t = 0; t < subMeshes.size(); t++)
+		{
+			unsigned int target = fill[subMeshes[t]]++ * 3;
+			sorted[target] = indices[t * 3];
+			sorted[target + 1] = indices[t * 3 + 1];
+			sorted[target + 2] = indices[t * 3 + 2];
+		}
+
+		MeshLod level;
+		level.firstSubMesh = (unsigned int)mesh.subMeshes.size();
+		level.subMeshCount = 0;
+		level.indexCount = (unsigned int)sorted.size();
+		level.error = error;
+		unsigned int base = (unsigned int)mesh.indices.size();
+		for (unsigned int s = 0; s < full.subMeshCount; s++)
+		{
+			unsigned int first = counts[s] * 3;
+			unsigned int count = (counts[s + 1] - counts[s]) * 3;
+			if (count == 0)
+			{
+				continue;
+			}
+			MeshOptimizer::optimizeVertexCache(&sorted[first], count, mesh.vertexCount());
+
+			SubMesh subMesh = mesh.subMeshes[s];
+			subMesh.firstIndex = base + first;
+			subMesh.indexCount = count;
+			mesh.subMeshes.push_back(subMesh);
+			level.subMeshCount++;
+		}
+		mesh.indices.insert(mesh.indices.end(), sorted.begin(), sorted.end());
+		mesh.lods.push_back(level);
+	}
+}
@@ -0,0 +1,30 @@
+// MeshSimplifier class, builds coarser levels of detail for an indexed Mesh with quadric error metrics (Garland & Heckbert).
+// Edges are collapsed onto one of their existing vertices, so every level indexes the same vertex arrays and only adds indices.
+// Vertices split by a UV seam or hard normal only move along that seam, together with their twin, and open borders only along
+// the border, so texture co-ordinates and normals are never interpolated or torn apart.
+// Holds no GL state so it can be shared between Model and the offline tools.
+#ifndef _MESHSIMPLIFIER_H_
+#define _MESHSIMPLIFIER_H_
+
+#include <stddef.h>
+#include <vector>
+#include "Mesh.h"
+
+class MeshSimplifier
+{
+
+public:
+	// Appends up to maxLods coarser levels to the mesh's lods, each with about half the triangles of the one before.
+	// Stops early once a level would move the surface further than maxError, a fraction of the mesh's largest dimension.
+	// The mesh must have 32 bit indices and every submesh must be full detail, i.e. call after MeshOptimizer::optimize
+	// and before Mesh::compactIndices.
+	static void buildLods(Mesh& mesh, int maxLods = 4, float maxError = 0.05f);
+
+	// Collapses edges until indices has at most targetIndexCount left or the next collapse would move the surface
+	// further than maxError (model units). subMeshes holds each triangle's submesh and is kept in step with indices.
+	// Returns the largest error of the collapses made.
+	static float simplify(const Mesh& mesh, std::vector<unsigned int>& indices, std::vector<unsigned int>& subMeshes,
+		size_t targetIndexCount, float maxError);
+};
+
+#endif
@@ -5,14 +5,44 @@
 #endif
 
 #include "model.h"
+#include "GLState.h"
 
-bool Model::load(char* modelFilename, char* textureFilename, char* mtlFilename)
+// Depending on texture file type some need inverted others don't.
+static const unsigned int textureFlags = TextureLoader::defaultFlags | SOIL_FLAG_INVERT_Y;
+
+// Fraction either side of the pixel tolerance a level has to be before selectLod switches to or from it.
+static const float lodHysteresis = 0.25f;
+
+Model::Model() : m_vertexCount(0), texture(0), requestedFormat(VertexBuffer::FloatArrays), m_numberOfMaterials(0), dataReady(false), resident(false)
 {
-	bool result;
+	view = MeshView();
+}
 
-	// Load in the model data,
-	result = loadModel(modelFilename);
-	if (!result)
+Model::~Model()
+{
+	for (size_t i = 0; i < pendingTextures.size(); i++)
+	{
+		TextureLoader::release(pendingTextures[i].image);
+	}
+
+	// Hand back the references taken from the texture cache.
+	TextureCache& cache = TextureCache::shared();
+	if (texture != 0)
+	{
+		cache.release(texture);
+	}
+	for (size_t i = 0; i < m_materials.size(); i++)
+	{
+		if (m_materials[i].texture != 0)
+		{
+			cache.release(m_materials[i].texture);
+		}
+	}
+}
+
+bool Model::load(char* modelFilename, char* textureFilename, char* mtlFilename)
+{
+	if (!loadData(modelFilename, textureFilename, mtlFilename))
 	{
 #ifdef _DEBUG
 		MessageBox(NULL,"Model failed to load", "Error", MB_OK);
@@ -22,170 +52,469 @@ bool Model::load(char* modelFilename, char* textureFilename, char* mtlFilename)
 		return false;
 	}
 
-	// Load the texture for this model.
-	loadTexture(textureFilename);
+	while (!uploadStep())
+	{
+	}
+	return true;
+}
+
+bool Model::loadData(const char* modelFilename, const char* textureFilename, const char* mtlFilename)
+{
+	// Load in the model data,
+	if (!loadModel(modelFilename))
+	{
+		return false;
+	}
+
+	// Queue the texture for this model.
+	if (textureFilename != NULL)
+	{
+		queueTexture(textureFilename, -1);
+	}
 
 	// Load the MTL file for the model. (If applicable)
-	//loadMTL(mtlFilename);
+	if (mtlFilename != NULL)
+	{
+		loadMTL(mtlFilename);
+	}
+
+	// Decode everything queued above at once.
+	decodeTextures();
 
+	// Publish the mesh to the render thread, its bounds are used for the placeholder.
+	dataReady = true;
 	return true;
 }
 
-void Model::render()
+bool Model::uploadStep()
 {
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	
-	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
-	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ord arrays
-
-	glVertexPointer(3, GL_FLOAT, 0, vertex.data());				// Pointer to vertex array
-	glNormalPointer(GL_FLOAT, 0, normals.data());				// Pointer to normals array
-	glTexCoordPointer(2, GL_FLOAT, 0, texCoords.data());		// Pointer to texture co-ords array
-
-	glDrawArrays(GL_TRIANGLES, 0, (vertex.size() / 3));
-
-	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
-	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+	if (resident)
+	{
+		return true;
+	}
+	if (!dataReady)
+	{
+		return false;
+	}
+
+	if (!pendingTextures.empty())
+	{
+		PendingTexture& pending = pendingTextures.back();
+		TextureCache& cache = TextureCache::shared();
+		GLuint result = cache.add(pending.filename.c_str(), textureFlags, pending.image);
+		TextureLoader::release(pending.image);
+
+		if (result != 0)
+		{
+			// Every further user of the image takes its own reference.
+			for (size_t i = 0; i < pending.materials.size(); i++)
+			{
+				setTexture(pending.materials[i], i == 0 ? result : cache.find(pending.filename.c_str(), textureFlags));
+			}
+		}
+		pendingTextures.pop_back();
+		return false;
+	}
+
+	// Upload the vertex and index arrays once, they're drawn from the VBO from then on.
+	size_t indexSize = view.shortIndices ? sizeof(GLushort) : sizeof(GLuint);
+	buffer.create(view.vertex, view.normals, view.texCoords, view.vertexCount, view.indices, view.indexCount * indexSize, requestedFormat);
+
+	// Work out the draw order of the per material submeshes.
+	buildDraws();
+	resident = true;
+	return true;
+}
+
+void Model::render(int lod)
+{
+	if (!resident)
+	{
+		renderPlaceholder();
+		return;
+	}
+	renderDraws(lod, NULL, 0);
+}
+
+void Model::renderInstanced(const Instancing::Instance* instances, int instanceCount, int lod)
+{
+	if (!resident)
+	{
+		for (int i = 0; i < instanceCount; i++)
+		{
+			glPushMatrix();
+				glMultMatrixf(instances[i].transform);
+				renderPlaceholder();
+			glPopMatrix();
+		}
+		return;
+	}
+	renderDraws(lod, instances, instanceCount);
 }
 
+void Model::renderDraws(int lod, const Instancing::Instance* instances, int instanceCount)
+{
+	const vector<MaterialDraw>& draws = lodDraws[std::max(0, std::min(lod, lodCount() - 1))];
+
+	// Materials change the specular and shininess, restore them for whatever is drawn next.
+	GLState::pushAttrib(GL_LIGHTING_BIT);
+
+	buffer.bind();										// Enable and point the arrays at the model's data
+	if (instances)
+	{
+		Instancing::begin(instances, instanceCount);
+	}
+
+	// Shared vertices are indexed, using 16 bit indices when the model is small enough.
+	GLenum indexType = view.shortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+	size_t indexSize = view.shortIndices ? sizeof(GLushort) : sizeof(GLuint);
+
+	// One draw per material, sorted by texture so each texture is only bound once.
+	for (size_t i = 0; i < draws.size(); i++)
+	{
+		const MaterialDraw& draw = draws[i];
+		if (i == 0 || draw.texture != draws[i - 1].texture)
+		{
+			GLState::bindTexture(draw.texture);
+		}
+		if (draw.material >= 0)
+		{
+			// Ambient and diffuse follow glColor while GL_COLOR_MATERIAL is enabled, specular and shininess don't.
+			const Material& material = m_materials[draw.material];
+			glMaterialfv(GL_FRONT, GL_AMBIENT, material.ambient);
+			glMaterialfv(GL_FRONT, GL_DIFFUSE, material.diffuse);
+			glMaterialfv(GL_FRONT, GL_SPECULAR, material.specular);
+			glMaterialf(GL_FRONT, GL_SHININESS, material.shininess * 128.0f);
+		}
+		if (instances)
+		{
+			Instancing::drawElements(GL_TRIANGLES, draw.indexCount, indexType, buffer.indices(draw.firstIndex * indexSize));
+		}
+		else
+		{
+			glDrawElements(GL_TRIANGLES, draw.indexCount, indexType, buffer.indices(draw.firstIndex * indexSize));
+		}
+	}
+
+	if (instances)
+	{
+		Instancing::end();
+	}
+	buffer.unbind();									// Disable the arrays
+
+	GLState::popAttrib();
+}
 
 // Modified from a mulit-threaded version by Mark Ropper.
-bool Model::loadModel(char* filename)
+bool Model::loadModel(const char* filename)
 {
-	vector<Vector3> verts;
-	vector<Vector3> norms;
-	vector<Vector3> texCs;
-	vector<unsigned int> faces;
-	int line = 0;
-	int activeMaterial = 0;
-	char name[80];
-	std::map<std::string, int>::const_iterator iter;
-	
-	FILE* file = fopen(filename, "r");
-	if (file == NULL)
+	// Use the cooked binary copy if it's still up to date, its arrays are drawn straight from the mapping.
+	if (MeshCache::load(filename, cacheFile, view))
+	{
+		mesh.clear();
+		m_vertexCount = view.vertexCount;
+		printf("Model '%s': loaded %d vertices, %d indices from %s\n", filename, view.vertexCount, view.indexCount, MeshCache::cachePath(filename).c_str());
+		return true;
+	}
+
+	// Map the file and parse it in place, split across the worker threads for large files, see ObjParser.
+	ObjData obj;
+	if (!ObjParser::parseFileParallel(filename, obj))
 	{
 		return false;
 	}
-	while (true)
+
+	materialNames = obj.materialNames;
+
+	// Collapse each unique v/vt/vn triplet into a single indexed vertex.
+	if (!mesh.buildFromObj(obj))
 	{
-		char lineHeader[128];
+		return false;
+	}
+	m_vertexCount = mesh.vertexCount();
 
-		// Read first word of the line
-		int res = fscanf(file, "%s", lineHeader);
-		if (res == EOF)
+	// Full detail figures for the report, before the levels of detail add their indices.
+	int corners = mesh.indexCount();
+	size_t expanded = mesh.expandedMemoryUsage();
+	mesh.computeBounds();
+
+	// Reorder triangles for the vertex cache and vertices for fetch order before cooking.
+	float acmrBefore = MeshOptimizer::acmr(mesh);
+	MeshOptimizer::optimize(mesh);
+	printf("Model '%s': ACMR %.3f -> %.3f\n", filename, acmrBefore, MeshOptimizer::acmr(mesh));
+
+	// Cook the simplified levels too, they share the vertices and only add indices.
+	MeshSimplifier::buildLods(mesh);
+	for (size_t i = 1; i < mesh.lods.size(); i++)
+	{
+		printf("Model '%s': LOD %d, %d triangles, error %f\n", filename, (int)i, mesh.lods[i].indexCount / 3, mesh.lods[i].error);
+	}
+
+	mesh.compactIndices();
+	view = mesh.view();
+
+	// Cook the mesh so later runs skip parsing.
+	if (!MeshCache::write(filename, mesh))
+	{
+		printf("Model '%s': failed to write %s\n", filename, MeshCache::cachePath(filename).c_str());
+	}
+
+	size_t lodIndices = (size_t)(mesh.indexCount() - corners) * (mesh.hasShortIndices() ? sizeof(unsigned short) : sizeof(unsigned int));
+	size_t indexed = mesh.memoryUsage() - lodIndices;
+	printf("Model '%s': %d corners -> %d vertices (%.2fx dedup), %d KB -> %d KB (%d KB saved)\n",
+		filename, corners, mesh.vertexCount(),
+		mesh.vertexCount() > 0 ? (float)corners / mesh.vertexCount() : 0.0f,
+		(int)(expanded / 1024), (int)(indexed / 1024),
+		((int)expanded - (int)indexed) / 1024);
+
+	return true;
+}
+
+int Model::indexCount(int lod) const
+{
+	if (lodIndexCounts.empty())
+	{
+		return view.indexCount;
+	}
+	return lodIndexCounts[std::max(0, std::min(lod, lodCount() - 1))];
+}
+
+Bounds Model::bounds() const
+{
+	return dataReady ? Bounds(view.boundsMin, view.boundsMax) : Bounds();
+}
+
+float Model::screenSize() const
+{
+	GLfloat modelview[16], projection[16];
+	GLint viewport[4];
+	glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+	glGetFloatv(GL_PROJECTION_MATRIX, projection);
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	// Bounding sphere in eye space, the radius scaled by the largest axis of the modelview.
+	Vector3 centre = view.boundsMin;
+	centre.add(view.boundsMax);
+	centre.scale(0.5f);
+	Vector3 size = view.boundsMax;
+	size.subtract(view.boundsMin);
+	float scale = 0.0f;
+	for (int axis = 0; axis < 3; axis++)
+	{
+		Vector3 column(modelview[axis * 4], modelview[axis * 4 + 1], modelview[axis * 4 + 2]);
+		scale = std::max(scale, column.length());
+	}
+	float radius = size.length() * 0.5f * scale;
+	float distance = -(modelview[2] * centre.x + modelview[6] * centre.y + modelview[10] * centre.z + modelview[14]);
+
+	// Inside the sphere it covers the whole screen.
+	if (distance <= radius)
+	{
+		return (float)viewport[3] * 2.0f;
+	}
+	return radius * projection[5] / distance * viewport[3];
+}
+
+int Model::selectLod(float screenSize, int current, float pixelError) const
+{
+	if (lodErrors.size() <= 1)
+	{
+		return 0;
+	}
+
+	// Errors are in model units, the bounding sphere's diameter covers screenSize pixels.
+	Vector3 size = view.boundsMax;
+	size.subtract(view.boundsMin);
+	float diameter = size.length();
+	float pixelsPerUnit = diameter > 0.0f ? screenSize / diameter : 0.0f;
+
+	// Coarsest level comfortably inside the tolerance.
+	int target = 0;
+	for (int i = 1; i < (int)lodErrors.size(); i++)
+	{
+		if (lodErrors[i] * pixelsPerUnit * (1.0f + lodHysteresis) <= pixelError)
 		{
-			break; // exit loop
+			target = i;
 		}
-		else // Parse
+	}
+
+	// Keep a coarser level until it's clearly outside the tolerance.
+	current = std::max(0, std::min(current, (int)lodErrors.size() - 1));
+	if (current > target && lodErrors[current] * pixelsPerUnit <= pixelError * (1.0f + lodHysteresis))
+	{
+		return current;
+	}
+	return target;
+}
+
+void Model::setVertexFormat(VertexBuffer::Format format)
+{
+	requestedFormat = format;
+	if (resident)
+	{
+		size_t indexSize = view.shortIndices ? sizeof(GLushort) : sizeof(GLuint);
+		buffer.create(view.vertex, view.normals, view.texCoords, view.vertexCount, view.indices, view.indexCount * indexSize, requestedFormat);
+	}
+}
+
+void Model::renderPlaceholder()
+{
+	if (!dataReady)
+	{
+		return;
+	}
+
+	// Untextured wire box over the mesh bounds, in whatever colour the caller has set.
+	Vector3 centre = view.boundsMin;
+	centre.add(view.boundsMax);
+	centre.scale(0.5f);
+	Vector3 size = view.boundsMax;
+	size.subtract(view.boundsMin);
+	GLState::bindTexture(0);
+	glPushMatrix();
+		glTranslatef(centre.x, centre.y, centre.z);
+		glScalef(size.x, size.y, size.z);
+		glutWireCube(1.0);
+	glPopMatrix();
+}
+
+void Model::queueTexture(const char* filename, int material)
+{
+	GLuint cached = TextureCache::shared().find(filename, textureFlags);
+	if (cached != 0)
+	{
+		// Already uploaded by another model with these flags, so its wrap mode is set too.
+		if (material < 0)
 		{
-			if (strcmp(lineHeader, "v") == 0) // Vertex
-			{
-				Vector3 vertex;
-				fscanf(file, "%f %f %f\n", &vertex.x, &vertex.y, &vertex.z);
-				verts.push_back(vertex);
-				line++;
-			}
-			else if (strcmp(lineHeader, "vt") == 0) // Tex Coord
-			{
-				Vector3 uv;
-				fscanf(file, "%f %f\n", &uv.x, &uv.y);
-				texCs.push_back(uv);
-				line++;
-			}
-			else if (strcmp(lineHeader, "vn") == 0) // Normal
-			{
-				Vector3 normal;
-				fscanf(file, "%f %f %f\n", &normal.x, &normal.y, &normal.z);
-				norms.push_back(normal);
-				line++;
-			}
-			else if (strcmp(lineHeader, "f") == 0) // Face
-			{
-				unsigned int face[9];
-				int matches = fscanf(file, "%d/%d/%d %d/%d/%d %d/%d/%d\n", &face[0], &face[1], &face[2],
-																			&face[3], &face[4], &face[5],
-																			&face[6], &face[7], &face[8]);
-				if (matches != 9)
-				{
-					// Parser error, or not triangle faces
-					return false;
-				}
-				
-				for (int i = 0; i < 9; i++)
-				{
-					faces.push_back(face[i]);
-				}
-				line++;
-			}
-			else if (strcmp(lineHeader, "usemtl") == 0) // MTL specific texture
-			{
-				// parse the material name
-				fscanf(file, "%s", &name);
-				if (std::find(materialNames.begin(), materialNames.end(), name) == materialNames.end())
-				{
-					materialNames.push_back(name);
-				}
-				line++;
-			}
+			texture = cached;
 		}
+		else
+		{
+			m_materials[material].texture = cached;
+		}
+		return;
 	}
 
-	// Store the vertex, normal and texCoord data read in from the .obj file.
-	for (int i = 0; i < faces.size(); i += 3)
+	// Materials sharing an image only decode it once.
+	for (size_t i = 0; i < pendingTextures.size(); i++)
 	{
-		if (faces[i + 1] > 0)
+		if (pendingTextures[i].filename == filename)
 		{
-			texCoords.push_back(texCs[faces[i + 1] - 1].x);	// Get x pos from texCs vector at pos face[i]
-			texCoords.push_back(texCs[faces[i + 1] - 1].y);	// Get y pos from texCs vector at pos face[i]
+			pendingTextures[i].materials.push_back(material);
+			return;
+		}
+	}
+
+	PendingTexture pending;
+	pending.filename = filename;
+	pending.materials.push_back(material);
+	pendingTextures.push_back(pending);
+}
 
-			vertex.push_back(verts[faces[i] - 1].x);	// Get x pos from verts vector at pos face[i]
-			vertex.push_back(verts[faces[i] - 1].y);	// Get y pos from verts vector at pos face[i]
-			vertex.push_back(verts[faces[i] - 1].z);	// Get z pos from verts vector at pos face[i]
+void Model::decodeTextures()
+{
+	// Each image decodes on its own worker, the same pool parseFileParallel uses.
+	ThreadPool& pool = ThreadPool::shared();
+	vector<std::future<bool> > decoded;
+	for (size_t i = 0; i < pendingTextures.size(); i++)
+	{
+		PendingTexture* pending = &pendingTextures[i];
+		decoded.push_back(pool.submit([pending]()
+		{
+			return TextureLoader::decode(pending->filename.c_str(), textureFlags, pending->image);
+		}));
+	}
 
-			normals.push_back(norms[faces[i + 2] - 1].x);	// Get x pos from norms vector at pos face[i]
-			normals.push_back(norms[faces[i + 2] - 1].y);	// Get y pos from norms vector at pos face[i]
-			normals.push_back(norms[faces[i + 2] - 1].z);	// Get z pos from norms vector at pos face[i]
+	// Drop any that failed, their materials keep the model texture.
+	size_t kept = 0;
+	for (size_t i = 0; i < pendingTextures.size(); i++)
+	{
+		if (decoded[i].get())
+		{
+			if (kept != i)
+			{
+				pendingTextures[kept] = std::move(pendingTextures[i]);
+			}
+			kept++;
 		}
 	}
-	
-	// Once data has been sorted clear read data (which has been copied and are not longer needed).
-	verts.clear();
-	norms.clear();
-	texCs.clear();
-	faces.clear();
+	pendingTextures.resize(kept);
+}
 
-	return true;
+void Model::setTexture(int material, GLuint result)
+{
+	if (result != 0)
+	{
+		// Model texture co-ordinates wrap, set once here rather than every render.
+		GLState::bindTexture(result);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		GLState::bindTexture(0);
+	}
+
+	if (material < 0)
+	{
+		texture = result;
+	}
+	else
+	{
+		m_materials[material].texture = result;
+	}
 }
 
-void Model::loadTexture(char* filename)
+// map_Kd paths are often absolute paths on the exporting machine, so if the path doesn't exist
+// look for the file name next to the MTL file, then in a "<mtl name>Textures" folder beside it.
+static string resolveTexturePath(const char* mtlFilename, const string& mapName)
 {
-	if (filename != NULL)
-	{
-		texture = SOIL_load_OGL_texture
-		(
-			filename,
-			SOIL_LOAD_AUTO,
-			SOIL_CREATE_NEW_ID,
-			SOIL_FLAG_MIPMAPS | SOIL_FLAG_NTSC_SAFE_RGB | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_INVERT_Y // Depending on texture file type some need inverted others don't.
-		);
-
-		//check for an error during the load process
-		if (texture == 0)
+	string mtlPath = mtlFilename;
+	size_t slash = mtlPath.find_last_of("/\\");
+	string directory = (slash == string::npos) ? "" : mtlPath.substr(0, slash + 1);
+	string stem = mtlPath.substr(directory.size());
+	stem = stem.substr(0, stem.find_last_of('.'));
+
+	size_t mapSlash = mapName.find_last_of("/\\");
+	string baseName = (mapSlash == string::npos) ? mapName : mapName.substr(mapSlash + 1);
+
+	string candidates[] = { mapName, directory + mapName, directory + baseName, directory + stem + "Textures/" + baseName };
+	for (int i = 0; i < 4; i++)
+	{
+		FILE* file = fopen(candidates[i].c_str(), "rb");
+		if (file != NULL)
 		{
-			printf("SOIL loading error: '%s'\n", SOIL_last_result());
+			fclose(file);
+			return candidates[i];
 		}
 	}
+	return mapName;
+}
+
+// Reads the rest of the current line into buffer, without leading whitespace or the trailing newline.
+static void readRestOfLine(FILE* file, char* buffer, int size)
+{
+	buffer[0] = '\0';
+	if (fgets(buffer, size, file) == NULL)
+	{
+		buffer[0] = '\0';
+		return;
+	}
 
+	char* start = buffer;
+	while (*start == ' ' || *start == '\t')
+	{
+		start++;
+	}
+	size_t length = strlen(start);
+	while (length > 0 && (start[length - 1] == '\n' || start[length - 1] == '\r' || start[length - 1] == ' ' || start[length - 1] == '\t'))
+	{
+		length--;
+	}
+	memmove(buffer, start, length);
+	buffer[length] = '\0';
 }
 
-void Model::loadMTL(char * filename)
+bool Model::loadMTL(const char* filename)
 {
 	// parse the mtl file name
-	
 	FILE* file = fopen(filename, "r");
 	if (file == NULL)
 	{
@@ -194,202 +523,187 @@ void Model::loadMTL(char * filename)
 #else
 		MessageBox(NULL, L"MTL File failed to load", L"Error", MB_OK);
 #endif
+		return false;
 	}
 
 	Material *pMaterial = 0;
 	int illum = 0;
-	int numMaterials = 0;
 	char lineHeader[128];
+	char line[512];
+
+	m_materials.clear();
+	m_materialCache.clear();
 
-	// Count the number of materials in the MTL file.
 	while (true)
 	{
 		// Read first word of the line
-		int res = fscanf(file, "%s", lineHeader);
+		int res = fscanf(file, "%127s", lineHeader);
 		if (res == EOF)
 		{
 			break; // exit loop
 		}
-		else // Parse
+
+		if (strcmp(lineHeader, "newmtl") == 0) // newmtl
 		{
-			if (strcmp(lineHeader, "newmtl") == 0) // MTL specific texture
-			{
-				++numMaterials;
-			}
-			else if (strcmp(lineHeader, "Ns") == 0) // Ns
-			{
-				fscanf(file, "%d\n", &pMaterial->shininess);
+			readRestOfLine(file, line, sizeof(line));
+
+			Material material;
+			material.ambient[0] = 0.2f;
+			material.ambient[1] = 0.2f;
+			material.ambient[2] = 0.2f;
+			material.ambient[3] = 1.0f;
+			material.diffuse[0] = 0.8f;
+			material.diffuse[1] = 0.8f;
+			material.diffuse[2] = 0.8f;
+			material.diffuse[3] = 1.0f;
+			material.specular[0] = 0.0f;
+			material.specular[1] = 0.0f;
+			material.specular[2] = 0.0f;
+			material.specular[3] = 1.0f;
+			material.shininess = 0.0f;
+			material.alpha = 1.0f;
+			material.name = line;
+			material.texture = 0;
+
+			m_materialCache[material.name] = (int)m_materials.size();
+			m_materials.push_back(material);
+			pMaterial = &m_materials.back();
+			continue;
+		}
+		else if (pMaterial == NULL)
+		{
+			// Nothing to apply values to before the first newmtl.
+		}
+		else if (strcmp(lineHeader, "Ns") == 0) // Ns
+		{
+			fscanf(file, "%f", &pMaterial->shininess);
 
-				// Wavefront .MTL file shininess is from [0,1000].
-				// Scale back to a generic [0,1] range.
-				pMaterial->shininess /= 1000.0f;
-			}
-			else if (strcmp(lineHeader, "Ka") == 0) // Ka
-			{
-				fscanf(file, "%f %f %f",
-					&pMaterial->ambient[0],
-					&pMaterial->ambient[1],
-					&pMaterial->ambient[2]);
-				pMaterial->ambient[3] = 1.0f;
-			}
-			else if (strcmp(lineHeader, "Kd") == 0) // Kd
-			{
-				fscanf(file, "%f %f %f",
-					&pMaterial->diffuse[0],
-					&pMaterial->diffuse[1],
-					&pMaterial->diffuse[2]);
-				pMaterial->diffuse[3] = 1.0f;
-			}
-			else if (strcmp(lineHeader, "Ks") == 0) // Ks
-			{
-				fscanf(file, "%f %f %f",
-					&pMaterial->specular[0],
-					&pMaterial->specular[1],
-					&pMaterial->specular[2]);
-				pMaterial->specular[3] = 1.0f;
-			}
-			else if (strcmp(lineHeader, "d") == 0) // d
-			{
-				fscanf(file, "%f", &pMaterial->alpha);
-			}
-			else if (strcmp(lineHeader, "i") == 0) // i
-			{
-				fscanf(file, "%d", &illum);
-
-				if (illum == 1)
-				{
-					pMaterial->specular[0] = 0.0f;
-					pMaterial->specular[1] = 0.0f;
-					pMaterial->specular[2] = 0.0f;
-					pMaterial->specular[3] = 1.0f;
-				}
-			}
-			else if (strcmp(lineHeader, "map_Kd") == 0) // map_Kd
-			{
-				fgets(lineHeader, sizeof(lineHeader), file);
-				sscanf(lineHeader, "%s %s", lineHeader, lineHeader);
-				pMaterial->colorMapFilename = lineHeader;
-			}
-			else if (strcmp(lineHeader, "n") == 0) // newmtl
+			// Wavefront .MTL file shininess is from [0,1000].
+			// Scale back to a generic [0,1] range.
+			pMaterial->shininess /= 1000.0f;
+		}
+		else if (strcmp(lineHeader, "Ka") == 0) // Ka
+		{
+			fscanf(file, "%f %f %f",
+				&pMaterial->ambient[0],
+				&pMaterial->ambient[1],
+				&pMaterial->ambient[2]);
+			pMaterial->ambient[3] = 1.0f;
+		}
+		else if (strcmp(lineHeader, "Kd") == 0) // Kd
+		{
+			fscanf(file, "%f %f %f",
+				&pMaterial->diffuse[0],
+				&pMaterial->diffuse[1],
+				&pMaterial->diffuse[2]);
+			pMaterial->diffuse[3] = 1.0f;
+		}
+		else if (strcmp(lineHeader, "Ks") == 0) // Ks
+		{
+			fscanf(file, "%f %f %f",
+				&pMaterial->specular[0],
+				&pMaterial->specular[1],
+				&pMaterial->specular[2]);
+			pMaterial->specular[3] = 1.0f;
+		}
+		else if (strcmp(lineHeader, "d") == 0) // d
+		{
+			fscanf(file, "%f", &pMaterial->alpha);
+		}
+		else if (strcmp(lineHeader, "illum") == 0) // illum
+		{
+			fscanf(file, "%d", &illum);
+
+			if (illum == 1)
 			{
-				fgets(lineHeader, sizeof(lineHeader), file);
-				sscanf(lineHeader, "%s %s", lineHeader, lineHeader);
-
-				pMaterial = &m_materials[numMaterials];
-				pMaterial->ambient[0] = 0.2f;
-				pMaterial->ambient[1] = 0.2f;
-				pMaterial->ambient[2] = 0.2f;
-				pMaterial->ambient[3] = 1.0f;
-				pMaterial->diffuse[0] = 0.8f;
-				pMaterial->diffuse[1] = 0.8f;
-				pMaterial->diffuse[2] = 0.8f;
-				pMaterial->diffuse[3] = 1.0f;
 				pMaterial->specular[0] = 0.0f;
 				pMaterial->specular[1] = 0.0f;
 				pMaterial->specular[2] = 0.0f;
 				pMaterial->specular[3] = 1.0f;
-				pMaterial->shininess = 0.0f;
-				pMaterial->alpha = 1.0f;
-				pMaterial->name = lineHeader;
-				pMaterial->colorMapFilename.clear();
-				pMaterial->bumpMapFilename.clear();
-
-				m_materialCache[pMaterial->name] = numMaterials;
-				++numMaterials;
 			}
 		}
+		else if (strcmp(lineHeader, "map_Kd") == 0) // map_Kd
+		{
+			// Path can contain spaces, take the rest of the line.
+			readRestOfLine(file, line, sizeof(line));
+			pMaterial->colorMapFilename = line;
+			continue;
+		}
+
+		// Skip anything left on the line, including unsupported statements and comments.
+		readRestOfLine(file, line, sizeof(line));
+	}
+	fclose(file);
+
+	m_numberOfMaterials = (int)m_materials.size();
+
+	// Queue each material's diffuse texture, they're decoded by decodeTextures and uploaded by uploadStep.
+	for (int i = 0; i < m_numberOfMaterials; i++)
+	{
+		Material& material = m_materials[i];
+		if (!material.colorMapFilename.empty())
+		{
+			string path = resolveTexturePath(filename, material.colorMapFilename);
+			queueTexture(path.c_str(), i);
+		}
 	}
 
-	m_numberOfMaterials = numMaterials;
-	numMaterials = 0;
-	m_materials.resize(m_numberOfMaterials);
-
-	//// Load the materials in the MTL file.
-	//while (true)
-	//{
-	//	if (strcmp(lineHeader, "Ns") == 0) // Ns
-	//	{
-	//		fscanf(file, "%f", &pMaterial->shininess);
-
-	//		// Wavefront .MTL file shininess is from [0,1000].
-	//		// Scale back to a generic [0,1] range.
-	//		pMaterial->shininess /= 1000.0f;
-	//	}
-	//	else if (strcmp(lineHeader, "Ka") == 0) // Ka
-	//	{
-	//		fscanf(file, "%f %f %f",
-	//			&pMaterial->ambient[0],
-	//			&pMaterial->ambient[1],
-	//			&pMaterial->ambient[2]);
-	//		pMaterial->ambient[3] = 1.0f;
-	//	}
-	//	else if (strcmp(lineHeader, "Kd") == 0) // Kd
-	//	{
-	//		fscanf(file, "%f %f %f",
-	//			&pMaterial->diffuse[0],
-	//			&pMaterial->diffuse[1],
-	//			&pMaterial->diffuse[2]);
-	//		pMaterial->diffuse[3] = 1.0f;
-	//	}
-	//	else if (strcmp(lineHeader, "Ks") == 0) // Ks
-	//	{
-	//		fscanf(file, "%f %f %f",
-	//			&pMaterial->specular[0],
-	//			&pMaterial->specular[1],
-	//			&pMaterial->specular[2]);
-	//		pMaterial->specular[3] = 1.0f;
-	//	}
-	//	else if (strcmp(lineHeader, "d") == 0) // d
-	//	{
-	//		fscanf(file, "%f", &pMaterial->alpha);
-	//	}
-	//	else if (strcmp(lineHeader, "i") == 0) // i
-	//	{
-	//		fscanf(file, "%d", &illum);
-
-	//		if (illum == 1)
-	//		{
-	//			pMaterial->specular[0] = 0.0f;
-	//			pMaterial->specular[1] = 0.0f;
-	//			pMaterial->specular[2] = 0.0f;
-	//			pMaterial->specular[3] = 1.0f;
-	//		}
-	//	}
-	//	else if (strcmp(lineHeader, "map_Kd") == 0) // map_Kd
-	//	{
-	//		fgets(lineHeader, sizeof(lineHeader), file);
-	//		sscanf(lineHeader, "%s %s", lineHeader, lineHeader);
-	//		pMaterial->colorMapFilename = lineHeader;
-	//	}
-	//	else if (strcmp(lineHeader, "n") == 0) // newmtl
-	//	{
-	//		fgets(lineHeader, sizeof(lineHeader), file);
-	//		sscanf(lineHeader, "%s %s", lineHeader, lineHeader);
-
-	//		pMaterial = &m_materials[numMaterials];
-	//		pMaterial->ambient[0] = 0.2f;
-	//		pMaterial->ambient[1] = 0.2f;
-	//		pMaterial->ambient[2] = 0.2f;
-	//		pMaterial->ambient[3] = 1.0f;
-	//		pMaterial->diffuse[0] = 0.8f;
-	//		pMaterial->diffuse[1] = 0.8f;
-	//		pMaterial->diffuse[2] = 0.8f;
-	//		pMaterial->diffuse[3] = 1.0f;
-	//		pMaterial->specular[0] = 0.0f;
-	//		pMaterial->specular[1] = 0.0f;
-	//		pMaterial->specular[2] = 0.0f;
-	//		pMaterial->specular[3] = 1.0f;
-	//		pMaterial->shininess = 0.0f;
-	//		pMaterial->alpha = 1.0f;
-	//		pMaterial->name = lineHeader;
-	//		pMaterial->colorMapFilename.clear();
-	//		pMaterial->bumpMapFilename.clear();
-
-	//		m_materialCache[pMaterial->name] = numMaterials;
-	//		++numMaterials;
-	//	}
-	//}
+	return true;
+}
+
+void Model::buildDraws()
+{
+	// Meshes cooked without levels of detail are one level made of every submesh.
+	MeshLod full;
+	full.firstSubMesh = 0;
+	full.subMeshCount = (unsigned int)view.subMeshCount;
+	full.indexCount = (unsigned int)view.indexCount;
+	full.error = 0.0f;
+	const MeshLod* lods = view.lodCount > 0 ? view.lods : &full;
+	int count = view.lodCount > 0 ? view.lodCount : 1;
+
+	lodDraws.assign(count, vector<MaterialDraw>());
+	lodErrors.resize(count);
+	lodIndexCounts.resize(count);
+	for (int lod = 0; lod < count; lod++)
+	{
+		lodErrors[lod] = lods[lod].error;
+		lodIndexCounts[lod] = (int)lods[lod].indexCount;
+		buildDraws(lods[lod], lodDraws[lod]);
+	}
 }
 
+void Model::buildDraws(const MeshLod& lod, vector<MaterialDraw>& draws)
+{
+	for (unsigned int i = lod.firstSubMesh; i < lod.firstSubMesh + lod.subMeshCount; i++)
+	{
+		const SubMesh& subMesh = view.subMeshes[i];
 
+		MaterialDraw draw;
+		draw.material = -1;
+		draw.texture = texture;
+		draw.firstIndex = subMesh.firstIndex;
+		draw.indexCount = subMesh.indexCount;
+
+		std::map<std::string, int>::const_iterator found = m_materialCache.end();
+		if (subMesh.material >= 0 && subMesh.material < (int)view.materialNames.size())
+		{
+			found = m_materialCache.find(view.materialNames[subMesh.material]);
+		}
+		if (found != m_materialCache.end())
+		{
+			draw.material = found->second;
+			if (m_materials[draw.material].texture != 0)
+			{
+				draw.texture = m_materials[draw.material].texture;
+			}
+		}
+		draws.push_back(draw);
+	}
 
+	// Group draws sharing a texture, then by material.
+	std::sort(draws.begin(), draws.end(), [](const MaterialDraw& a, const MaterialDraw& b)
+	{
+		return a.texture != b.texture ? a.texture < b.texture : a.material < b.material;
+	});
+}
@@ -16,27 +16,92 @@ using namespace std;
 #include <vector>
 #include <map>
 #include <string>
+#include <algorithm>
+#include <atomic>
 #include "Vector3.h"
 #include "SOIL.h"
+#include "ObjParser.h"
+#include "Mesh.h"
+#include "MeshCache.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "TextureLoader.h"
+#include "TextureCache.h"
+#include "VertexBuffer.h"
+#include "Instancing.h"
+#include "Bounds.h"
 
 class Model
 {
 
 public:
+	Model();
+	~Model();
 
+	// Loads everything on the calling thread, loadData then uploadStep until resident.
 	bool load(char* modelFilename, char* textureFilename, char* mtlFilename);
-	void render();
+	// First half of load, reads the mesh and MTL file and decodes textures. Makes no GL calls so can run on a worker thread,
+	// but not one of ThreadPool::shared()'s.
+	bool loadData(const char* modelFilename, const char* textureFilename, const char* mtlFilename);
+	// Second half of load, must be on the GL thread once loadData has returned.
+	// Uploads one decoded texture per call so the work can be spread over frames, returns true once resident.
+	bool uploadStep();
+	// True once the model can be drawn with its textures, until then render draws a placeholder.
+	bool isResident() const { return resident; };
+	// Draws a level of detail, 0 is full detail. Levels past the coarsest draw the coarsest.
+	void render(int lod = 0);
+	// Draws a copy of the level per instance in one submission per material, see Instancing.
+	void renderInstanced(const Instancing::Instance* instances, int instanceCount, int lod = 0);
+
+	// Number of levels of detail, at least 1 once resident.
+	int lodCount() const { return (int)lodDraws.size(); };
+	// Box and sphere round the mesh, empty until its data is loaded.
+	Bounds bounds() const;
+	// Height in pixels of the model's bounding sphere under the current modelview, projection and viewport.
+	float screenSize() const;
+	// Coarsest level whose error covers fewer than pixelError pixels at the given screen size.
+	// current is the level used last frame, a level is only dropped once it's comfortably inside the tolerance
+	// and only taken back once it's clearly outside it, so models near a threshold don't flicker between levels.
+	int selectLod(float screenSize, int current, float pixelError = 1.0f) const;
+
+	// Vertex layout of the model's VBO. Set before loading, or on the GL thread to re-upload a resident model.
+	void setVertexFormat(VertexBuffer::Format format);
+	VertexBuffer::Format vertexFormat() const { return buffer.format(); };
+	// Bytes of vertex and index data uploaded to the GPU.
+	size_t bufferMemory() const { return buffer.memoryUsage(); };
+	int indexCount(int lod = 0) const;
 
 private:
 
-	void loadTexture(char*);
-	void loadMTL(char*);
-	bool loadModel(char*);
+	// Takes the texture from the cache if it's loaded, otherwise queues it for decodeTextures.
+	// material -1 is the model's own texture.
+	void queueTexture(const char*, int material);
+	// Decodes the queued textures in parallel on ThreadPool::shared(), ready for uploadStep.
+	// Must not be called from one of that pool's workers.
+	void decodeTextures();
+	// Sets the model or material texture, and its wrap mode.
+	void setTexture(int material, GLuint);
+	bool loadMTL(const char*);
+	bool loadModel(const char*);
+	// Draws the bounding box once the mesh is known, or nothing before then.
+	void renderPlaceholder();
+	// Builds the per material draw lists of each level of detail from the submeshes and loaded materials.
+	void buildDraws();
+	// Draws a resident level's material draws, once per instance if instances isn't NULL.
+	void renderDraws(int lod, const Instancing::Instance* instances, int instanceCount);
 
 	int m_vertexCount;
 	GLuint texture;
 
-	vector<float> vertex, normals, texCoords;
+	// Indexed vertex data, one vertex per unique v/vt/vn triplet.
+	Mesh mesh;
+	// Mapped cache file, when the model was loaded from one.
+	MappedFile cacheFile;
+	// Arrays used for drawing, pointing into either mesh or cacheFile.
+	MeshView view;
+	// Static VBO copy of view, see VertexBuffer.
+	VertexBuffer buffer;
+	VertexBuffer::Format requestedFormat;
 
 	struct Material {
 		float ambient[4];
@@ -48,13 +113,40 @@ private:
 		std::string name;
 		std::string colorMapFilename;
 		std::string bumpMapFilename;
+		GLuint texture;			// Loaded from colorMapFilename, 0 if none
+	};
+
+	// One glDrawElements call, a submesh and the state it's drawn with.
+	struct MaterialDraw {
+		GLuint texture;
+		int material;			// Index into m_materials, -1 if the submesh's material wasn't in the MTL file
+		unsigned int firstIndex;
+		unsigned int indexCount;
 	};
+	// Draw lists per level of detail, finest first.
+	vector<vector<MaterialDraw> > lodDraws;
+	vector<float> lodErrors;
+	vector<int> lodIndexCounts;
+	// Draw list of one level, sorted by texture.
+	void buildDraws(const MeshLod& lod, vector<MaterialDraw>& draws);
 
 	vector<string> materialNames;
 	std::map<std::string, int> m_materialCache;
 	int m_numberOfMaterials;
 	vector<Material> m_materials;
 
+	// Textures decoded by loadData waiting to be uploaded by uploadStep.
+	struct PendingTexture {
+		std::string filename;
+		vector<int> materials;	// Indices into m_materials using the image, -1 for the model texture
+		DecodedImage image;
+	};
+	vector<PendingTexture> pendingTextures;
+
+	// Set by loadData once the mesh arrays are complete, and by uploadStep once everything is on the GPU.
+	std::atomic<bool> dataReady;
+	std::atomic<bool> resident;
+
 };
 
 #endif
\ No newline at end of file
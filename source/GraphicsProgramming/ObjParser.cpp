@@ -0,0 +1,610 @@
+#include "ObjParser.h"
+#include <algorithm>
+#include <math.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() : fileData(NULL), fileSize(0), fileHandle(NULL), mappingHandle(NULL)
+{
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const char* filename)
+{
+	close();
+
+	HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	fileHandle = file;
+
+	LARGE_INTEGER length;
+	if (!GetFileSizeEx(file, &length) || length.QuadPart == 0)
+	{
+		close();
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping == NULL)
+	{
+		close();
+		return false;
+	}
+	mappingHandle = mapping;
+
+	fileData = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (fileData == NULL)
+	{
+		close();
+		return false;
+	}
+	fileSize = (size_t)length.QuadPart;
+
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (fileData != NULL)
+	{
+		UnmapViewOfFile(fileData);
+	}
+	if (mappingHandle != NULL)
+	{
+		CloseHandle((HANDLE)mappingHandle);
+	}
+	if (fileHandle != NULL)
+	{
+		CloseHandle((HANDLE)fileHandle);
+	}
+	fileData = NULL;
+	fileSize = 0;
+	fileHandle = NULL;
+	mappingHandle = NULL;
+}
+
+#else
+
+bool MappedFile::open(const char* filename)
+{
+	close();
+
+	int fd = ::open(filename, O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0)
+	{
+		::close(fd);
+		return false;
+	}
+
+	void* mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (mapped == MAP_FAILED)
+	{
+		return false;
+	}
+	madvise(mapped, (size_t)info.st_size, MADV_SEQUENTIAL);
+
+	fileData = (const char*)mapped;
+	fileSize = (size_t)info.st_size;
+
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (fileData != NULL)
+	{
+		munmap((void*)fileData, fileSize);
+	}
+	fileData = NULL;
+	fileSize = 0;
+}
+
+#endif
+
+void ObjData::clear()
+{
+	verts.clear();
+	texCs.clear();
+	norms.clear();
+	faces.clear();
+	materialNames.clear();
+	materialRanges.clear();
+	relativeIndices.clear();
+}
+
+// Powers of ten which are exactly representable as a double.
+static const double powersOfTen[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+	1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static inline bool isDigit(char c)
+{
+	return (unsigned char)(c - '0') < 10;
+}
+
+static inline bool isSpace(char c)
+{
+	return c == ' ' || c == '\t';
+}
+
+static inline bool isEndOfLine(char c)
+{
+	return c == '\n' || c == '\r';
+}
+
+static inline const char* skipSpaces(const char* p, const char* end)
+{
+	while (p < end && isSpace(*p))
+	{
+		p++;
+	}
+	return p;
+}
+
+static inline const char* skipLine(const char* p, const char* end)
+{
+	while (p < end && *p != '\n')
+	{
+		p++;
+	}
+	return p;
+}
+
+// Returns true if the keyword at p matches word and is followed by whitespace.
+static inline bool matchKeyword(const char* p, const char* end, const char* word, int length)
+{
+	if (end - p <= length)
+	{
+		return false;
+	}
+	for (int i = 0; i < length; i++)
+	{
+		if (p[i] != word[i])
+		{
+			return false;
+		}
+	}
+	return isSpace(p[length]);
+}
+
+const char* ObjParser::parseUInt(const char* p, const char* end, unsigned int& out)
+{
+	unsigned int value = 0;
+	while (p < end && isDigit(*p))
+	{
+		value = value * 10 + (unsigned int)(*p - '0');
+		p++;
+	}
+	out = value;
+	return p;
+}
+
+const char* ObjParser::parseFloat(const char* p, const char* end, float& out)
+{
+	bool negative = false;
+	if (p < end && (*p == '-' || *p == '+'))
+	{
+		negative = (*p == '-');
+		p++;
+	}
+
+	// Gather up to 19 significant digits into an integer mantissa, anything past that only shifts the exponent.
+	unsigned long long mantissa = 0;
+	int digits = 0;
+	int exponent = 0;
+	while (p < end && isDigit(*p))
+	{
+		if (digits < 19)
+		{
+			mantissa = mantissa * 10 + (unsigned int)(*p - '0');
+			if (mantissa != 0)
+			{
+				digits++;
+			}
+		}
+		else
+		{
+			exponent++;
+		}
+		p++;
+	}
+	if (p < end && *p == '.')
+	{
+		p++;
+		while (p < end && isDigit(*p))
+		{
+			if (digits < 19)
+			{
+				mantissa = mantissa * 10 + (unsigned int)(*p - '0');
+				if (mantissa != 0)
+				{
+					digits++;
+				}
+				exponent--;
+			}
+			p++;
+		}
+	}
+	if (p < end && (*p == 'e' || *p == 'E'))
+	{
+		const char* e = p + 1;
+		bool negativeExp = false;
+		if (e < end && (*e == '-' || *e == '+'))
+		{
+			negativeExp = (*e == '-');
+			e++;
+		}
+		if (e < end && isDigit(*e))
+		{
+			unsigned int expValue;
+			p = parseUInt(e, end, expValue);
+			exponent += negativeExp ? -(int)expValue : (int)expValue;
+		}
+	}
+
+	double value = (double)mantissa;
+	if (exponent < 0)
+	{
+		value = (exponent >= -22) ? value / powersOfTen[-exponent] : value * pow(10.0, exponent);
+	}
+	else if (exponent > 0)
+	{
+		value = (exponent <= 22) ? value * powersOfTen[exponent] : value * pow(10.0, exponent);
+	}
+
+	out = (float)(negative ? -value : value);
+	return p;
+}
+
+// Parses a face index, negative values are relative to the end of the current array.
+// Relative indices are resolved against count and their position recorded for merging.
+// Returns NULL for -0, which refers to nothing.
+static inline const char* parseIndex(const char* p, const char* end, size_t count, unsigned int& out, bool& relative)
+{
+	relative = false;
+	if (p < end && *p == '-')
+	{
+		unsigned int back;
+		p = ObjParser::parseUInt(p + 1, end, back);
+		if (back == 0)
+		{
+			return NULL;
+		}
+		// Wraps for chunks referring back into earlier chunks, merge adds the offset back on.
+		out = (unsigned int)count + 1 - back;
+		relative = true;
+		return p;
+	}
+	return ObjParser::parseUInt(p, end, out);
+}
+
+bool ObjParser::relativeInRange(const ObjData& data)
+{
+	// A relative index reaching back past the first element resolves to 0 or wraps past the end.
+	const size_t sizes[3] = { data.verts.size(), data.texCs.size(), data.norms.size() };
+	for (size_t r = 0; r < data.relativeIndices.size(); r++)
+	{
+		size_t position = data.relativeIndices[r];
+		unsigned int index = data.faces[position];
+		if (index == 0 || index > sizes[position % 3])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ObjParser::parseFile(const char* filename, ObjData& out)
+{
+	MappedFile file;
+	if (!file.open(filename))
+	{
+		return false;
+	}
+	return parse(file.data(), file.data() + file.size(), out) && relativeInRange(out);
+}
+
+bool ObjParser::parse(const char* begin, const char* end, ObjData& out)
+{
+	const char* p = begin;
+
+	while (p < end)
+	{
+		p = skipSpaces(p, end);
+		if (p >= end)
+		{
+			break;
+		}
+
+		if (p[0] == 'v' && p + 1 < end)
+		{
+			if (isSpace(p[1])) // Vertex
+			{
+				Vector3 vertex;
+				p = parseFloat(skipSpaces(p + 2, end), end, vertex.x);
+				p = parseFloat(skipSpaces(p, end), end, vertex.y);
+				p = parseFloat(skipSpaces(p, end), end, vertex.z);
+				out.verts.push_back(vertex);
+			}
+			else if (p[1] == 't' && p + 2 < end && isSpace(p[2])) // Tex Coord
+			{
+				Vector3 uv;
+				p = parseFloat(skipSpaces(p + 3, end), end, uv.x);
+				p = parseFloat(skipSpaces(p, end), end, uv.y);
+				out.texCs.push_back(uv);
+			}
+			else if (p[1] == 'n' && p + 2 < end && isSpace(p[2])) // Normal
+			{
+				Vector3 normal;
+				p = parseFloat(skipSpaces(p + 3, end), end, normal.x);
+				p = parseFloat(skipSpaces(p, end), end, normal.y);
+				p = parseFloat(skipSpaces(p, end), end, normal.z);
+				out.norms.push_back(normal);
+			}
+		}
+		else if (p[0] == 'f' && p + 1 < end && isSpace(p[1])) // Face
+		{
+			unsigned int face[9];
+			bool relative[9];
+			int corners = 0;
+			p = skipSpaces(p + 2, end);
+			while (p < end && (isDigit(*p) || *p == '-'))
+			{
+				if (corners == 3)
+				{
+					// Not triangle faces
+					return false;
+				}
+				unsigned int* corner = &face[corners * 3];
+				bool* cornerRelative = &relative[corners * 3];
+				corner[1] = 0;
+				corner[2] = 0;
+				cornerRelative[1] = false;
+				cornerRelative[2] = false;
+				p = parseIndex(p, end, out.verts.size(), corner[0], cornerRelative[0]);
+				if (p != NULL && p < end && *p == '/')
+				{
+					p = parseIndex(p + 1, end, out.texCs.size(), corner[1], cornerRelative[1]);	// Empty for v//vn, leaves 0
+					if (p != NULL && p < end && *p == '/')
+					{
+						p = parseIndex(p + 1, end, out.norms.size(), corner[2], cornerRelative[2]);
+					}
+				}
+				if (p == NULL)
+				{
+					// Parser error, -0 index
+					return false;
+				}
+				if ((corner[0] == 0 && !cornerRelative[0]) || (corner[2] == 0 && !cornerRelative[2]))
+				{
+					// Parser error, position and normal are required
+					return false;
+				}
+				corners++;
+				p = skipSpaces(p, end);
+			}
+			if (corners != 3)
+			{
+				// Parser error, or not triangle faces
+				return false;
+			}
+
+			for (int i = 0; i < 9; i++)
+			{
+				if (relative[i])
+				{
+					out.relativeIndices.push_back(out.faces.size() + i);
+				}
+			}
+			out.faces.insert(out.faces.end(), face, face + 9);
+		}
+		else if (matchKeyword(p, end, "usemtl", 6)) // MTL specific texture
+		{
+			// parse the material name
+			const char* nameStart = skipSpaces(p + 7, end);
+			const char* nameEnd = nameStart;
+			while (nameEnd < end && !isSpace(*nameEnd) && !isEndOfLine(*nameEnd))
+			{
+				nameEnd++;
+			}
+			std::string name(nameStart, nameEnd);
+			std::vector<std::string>::iterator found = std::find(out.materialNames.begin(), out.materialNames.end(), name);
+			int material = (int)(found - out.materialNames.begin());
+			if (found == out.materialNames.end())
+			{
+				out.materialNames.push_back(name);
+			}
+
+			// Faces from here on use this material.
+			ObjMaterialRange range;
+			range.firstFace = (unsigned int)(out.faces.size() / 9);
+			range.material = material;
+			if (!out.materialRanges.empty() && out.materialRanges.back().firstFace == range.firstFace)
+			{
+				out.materialRanges.back() = range;
+			}
+			else
+			{
+				out.materialRanges.push_back(range);
+			}
+			p = nameEnd;
+		}
+
+		p = skipLine(p, end);
+		if (p < end)
+		{
+			p++;	// Step over '\n'
+		}
+	}
+
+	return true;
+}
+
+bool ObjParser::parseFileParallel(const char* filename, ObjData& out, ThreadPool& pool)
+{
+	// Chunks smaller than this aren't worth handing to another thread.
+	const size_t minChunkSize = 1 << 20;
+
+	MappedFile file;
+	if (!file.open(filename))
+	{
+		return false;
+	}
+
+	const char* begin = file.data();
+	const char* end = begin + file.size();
+
+	size_t chunkCount = file.size() / minChunkSize;
+	if (chunkCount > pool.size() * 4)
+	{
+		chunkCount = pool.size() * 4;
+	}
+	if (chunkCount <= 1 || pool.size() < 2)
+	{
+		return parse(begin, end, out) && relativeInRange(out);
+	}
+
+	// Split on line boundaries, each chunk starts just after a '\n'.
+	std::vector<const char*> bounds;
+	bounds.push_back(begin);
+	for (size_t i = 1; i < chunkCount; i++)
+	{
+		const char* split = begin + (file.size() * i) / chunkCount;
+		if (split <= bounds.back())
+		{
+			split = bounds.back();
+		}
+		else
+		{
+			while (split < end && split[-1] != '\n')
+			{
+				split++;
+			}
+		}
+		bounds.push_back(split);
+	}
+	bounds.push_back(end);
+
+	std::vector<ObjData> chunks(chunkCount);
+	std::vector<std::future<bool> > results;
+	for (size_t i = 0; i < chunkCount; i++)
+	{
+		const char* chunkBegin = bounds[i];
+		const char* chunkEnd = bounds[i + 1];
+		ObjData* chunk = &chunks[i];
+		results.push_back(pool.submit([chunkBegin, chunkEnd, chunk]() { return ObjParser::parse(chunkBegin, chunkEnd, *chunk); }));
+	}
+
+	bool result = true;
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		if (!results[i].get())
+		{
+			result = false;
+		}
+	}
+	if (!result)
+	{
+		return false;
+	}
+
+	return merge(chunks, out);
+}
+
+bool ObjParser::merge(std::vector<ObjData>& chunks, ObjData& out)
+{
+	size_t vertCount = out.verts.size(), texCount = out.texCs.size(), normCount = out.norms.size(), faceCount = out.faces.size();
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		vertCount += chunks[i].verts.size();
+		texCount += chunks[i].texCs.size();
+		normCount += chunks[i].norms.size();
+		faceCount += chunks[i].faces.size();
+	}
+	out.verts.reserve(vertCount);
+	out.texCs.reserve(texCount);
+	out.norms.reserve(normCount);
+	out.faces.reserve(faceCount);
+
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		ObjData& chunk = chunks[i];
+
+		// Everything already in out comes before this chunk in the file.
+		unsigned int offsets[3] = { (unsigned int)out.verts.size(), (unsigned int)out.texCs.size(), (unsigned int)out.norms.size() };
+		size_t faceBase = out.faces.size();
+
+		out.verts.insert(out.verts.end(), chunk.verts.begin(), chunk.verts.end());
+		out.texCs.insert(out.texCs.end(), chunk.texCs.begin(), chunk.texCs.end());
+		out.norms.insert(out.norms.end(), chunk.norms.begin(), chunk.norms.end());
+		out.faces.insert(out.faces.end(), chunk.faces.begin(), chunk.faces.end());
+
+		// Once offset a relative index is final, 0 or past what's been read so far means it reached back before the file.
+		const size_t sizes[3] = { out.verts.size(), out.texCs.size(), out.norms.size() };
+		for (size_t r = 0; r < chunk.relativeIndices.size(); r++)
+		{
+			size_t position = chunk.relativeIndices[r];
+			unsigned int& index = out.faces[faceBase + position];
+			index += offsets[position % 3];
+			if (index == 0 || index > sizes[position % 3])
+			{
+				return false;
+			}
+		}
+
+		// Chunk material indices are local to the chunk, map them onto the merged name list.
+		std::vector<int> materialMap(chunk.materialNames.size());
+		for (size_t m = 0; m < chunk.materialNames.size(); m++)
+		{
+			std::vector<std::string>::iterator found = std::find(out.materialNames.begin(), out.materialNames.end(), chunk.materialNames[m]);
+			materialMap[m] = (int)(found - out.materialNames.begin());
+			if (found == out.materialNames.end())
+			{
+				out.materialNames.push_back(chunk.materialNames[m]);
+			}
+		}
+
+		// Faces before the chunk's first usemtl carry on with the previous chunk's material, so need no range.
+		for (size_t r = 0; r < chunk.materialRanges.size(); r++)
+		{
+			ObjMaterialRange range = chunk.materialRanges[r];
+			range.firstFace += (unsigned int)(faceBase / 9);
+			range.material = materialMap[range.material];
+			if (!out.materialRanges.empty() && out.materialRanges.back().firstFace == range.firstFace)
+			{
+				out.materialRanges.back() = range;
+			}
+			else
+			{
+				out.materialRanges.push_back(range);
+			}
+		}
+
+		chunk.clear();
+	}
+	return true;
+}
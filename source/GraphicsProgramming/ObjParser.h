@@ -0,0 +1,89 @@
+// ObjParser class, parses Wavefront OBJ text into raw position/texcoord/normal/face arrays.
+// Maps the whole file into memory and walks it with a hand written tokenizer and float parser,
+// so no per-line libc calls or temporary strings are made while parsing.
+#ifndef _OBJPARSER_H_
+#define _OBJPARSER_H_
+
+#include <vector>
+#include <string>
+#include "Vector3.h"
+#include "ThreadPool.h"
+
+// Read-only view of an entire file mapped into memory.
+class MappedFile
+{
+
+public:
+	MappedFile();
+	~MappedFile();
+
+	// Maps the given file, returns false if it can't be opened or is empty.
+	bool open(const char* filename);
+	// Unmaps the file and closes any handles.
+	void close();
+
+	const char* data() const { return fileData; };
+	size_t size() const { return fileSize; };
+
+private:
+	// Not copyable, the mapping is owned by this object.
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+
+	const char* fileData;
+	size_t fileSize;
+	void* fileHandle;
+	void* mappingHandle;
+};
+
+// Faces from firstFace (a triangle index) up to the next range use material, an index into materialNames.
+struct ObjMaterialRange
+{
+	unsigned int firstFace;
+	int material;
+};
+
+// Raw data read from an OBJ file, indices are 1 based as in the file (0 = not present).
+struct ObjData
+{
+	std::vector<Vector3> verts;
+	std::vector<Vector3> texCs;
+	std::vector<Vector3> norms;
+	// v/vt/vn index triplets, 9 per triangle.
+	std::vector<unsigned int> faces;
+	std::vector<std::string> materialNames;
+	// One entry per usemtl, faces before the first one have no material.
+	std::vector<ObjMaterialRange> materialRanges;
+	// Positions in faces of negative (relative) indices, resolved against this object's own counts.
+	// Only needed when chunks are merged, as earlier chunks shift what they refer to.
+	std::vector<size_t> relativeIndices;
+
+	void clear();
+};
+
+class ObjParser
+{
+
+public:
+	// Maps and parses an OBJ file. Returns false if the file can't be read, contains non-triangle faces or relative
+	// indices reaching back before the start of the file.
+	static bool parseFile(const char* filename, ObjData& out);
+	// Maps an OBJ file and parses line aligned chunks of it in parallel on the pool, then merges them.
+	// Output is identical to parseFile. Must not be called from one of the pool's own workers.
+	static bool parseFileParallel(const char* filename, ObjData& out, ThreadPool& pool = ThreadPool::shared());
+	// Parses OBJ text in the range [begin, end). Does not need to be null terminated.
+	static bool parse(const char* begin, const char* end, ObjData& out);
+	// Appends chunks parsed in file order onto out, offsetting any relative indices by the data before them.
+	// Returns false if a relative index refers back past the start of the file.
+	static bool merge(std::vector<ObjData>& chunks, ObjData& out);
+	// False if any of data's relative indices refer back past the start of its arrays. parse leaves those for
+	// merge to resolve, so a whole file must be checked after parsing.
+	static bool relativeInRange(const ObjData& data);
+
+	// Parses a float starting at p, returns a pointer past the last character consumed.
+	static const char* parseFloat(const char* p, const char* end, float& out);
+	// Parses an unsigned integer starting at p, returns a pointer past the last digit.
+	static const char* parseUInt(const char* p, const char* end, unsigned int& out);
+};
+
+#endif
@@ -0,0 +1,207 @@
+#include "RenderQueue.h"
+#include "GLState.h"
+#include <string.h>
+
+// Key fields, from the top bit down.
+static const int passShift = 56;
+static const unsigned long long blendBit = 1ull << 55;
+static const int textureBits = 23;
+static const unsigned long long textureMask = (1ull << textureBits) - 1;
+
+RenderQueue::RenderQueue() : passes(maxPasses), running(&everything), packetsRun(0), passesRun(0), culled(0)
+{
+	for (size_t i = 0; i < passes.size(); i++)
+	{
+		passes[i].windowed = false;
+	}
+	for (int i = 0; i < 16; i++)
+	{
+		projection[i] = i % 5 == 0 ? 1.0f : 0.0f;
+	}
+}
+
+void RenderQueue::setPass(int pass, const State& begin, const State& end)
+{
+	passes[pass].begin = begin;
+	passes[pass].end = end;
+}
+
+void RenderQueue::begin()
+{
+	glGetFloatv(GL_PROJECTION_MATRIX, projection);
+	for (size_t i = 0; i < passes.size(); i++)
+	{
+		passes[i].windowed = false;
+	}
+	culled = 0;
+}
+
+bool RenderQueue::setWindow(int pass, const Bounds& bounds)
+{
+	GLfloat modelview[16], clip[16];
+	glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+	Frustum::multiply(projection, modelview, clip);
+	passes[pass].windowed = true;
+	return Frustum::screenRect(clip, bounds, passes[pass].window);
+}
+
+unsigned long long RenderQueue::makeKey(int pass, bool blended, GLuint texture, float depth)
+{
+	// Positive floats order the same as their bits, anything behind the eye sorts as at it.
+	unsigned int depthBits = 0;
+	if (depth > 0.0f)
+	{
+		memcpy(&depthBits, &depth, sizeof(depthBits));
+	}
+
+	unsigned long long key = (unsigned long long)(pass & 0xff) << passShift;
+	if (blended)
+	{
+		// Depth first and inverted so the farthest draws first, texture only breaks ties.
+		key |= blendBit;
+		key |= (unsigned long long)(0xffffffffu - depthBits) << textureBits;
+		key |= texture & textureMask;
+	}
+	else
+	{
+		key |= (unsigned long long)(texture & textureMask) << 32;
+		key |= depthBits;
+	}
+	return key;
+}
+
+bool RenderQueue::submit(int pass, bool blended, const GLuint* texture, const GLfloat* colour, const Bounds* bounds, const Draw& draw)
+{
+	Packet packet;
+	glGetFloatv(GL_MODELVIEW_MATRIX, packet.matrix);
+	GLfloat clip[16];
+	Frustum::multiply(projection, packet.matrix, clip);
+	packet.frustum.extract(clip, passes[pass].windowed ? passes[pass].window : NULL);
+	if (bounds != NULL && !packet.frustum.intersects(*bounds))
+	{
+		culled++;
+		return false;
+	}
+
+	for (int i = 0; i < 4; i++)
+	{
+		packet.colour[i] = colour != NULL ? colour[i] : 1.0f;
+	}
+	packet.texture = texture;
+	packet.blended = blended;
+	packet.draw = draw;
+
+	// Sorted by the depth of the packet's origin.
+	Entry entry;
+	entry.key = makeKey(pass, blended, texture != NULL ? *texture : 0, -packet.matrix[14]);
+	entry.packet = (unsigned int)packets.size();
+	entries.push_back(entry);
+	packets.push_back(packet);
+	return true;
+}
+
+// Least significant digit first radix sort, a byte at a time. Each pass is stable so earlier digits keep their order.
+// Digits every key shares are skipped, which in practice is most of the pass and texture bytes.
+void RenderQueue::sort()
+{
+	const size_t count = entries.size();
+	if (count < 2)
+	{
+		return;
+	}
+	scratch.resize(count);
+
+	unsigned int histograms[8][256];
+	memset(histograms, 0, sizeof(histograms));
+	for (size_t i = 0; i < count; i++)
+	{
+		unsigned long long key = entries[i].key;
+		for (int digit = 0; digit < 8; digit++)
+		{
+			histograms[digit][(key >> (digit * 8)) & 0xff]++;
+		}
+	}
+
+	for (int digit = 0; digit < 8; digit++)
+	{
+		unsigned int* histogram = histograms[digit];
+		if (histogram[(entries[0].key >> (digit * 8)) & 0xff] == count)
+		{
+			continue;
+		}
+
+		// Counts to starting offsets.
+		unsigned int offset = 0;
+		for (int bucket = 0; bucket < 256; bucket++)
+		{
+			unsigned int bucketCount = histogram[bucket];
+			histogram[bucket] = offset;
+			offset += bucketCount;
+		}
+
+		for (size_t i = 0; i < count; i++)
+		{
+			scratch[histogram[(entries[i].key >> (digit * 8)) & 0xff]++] = entries[i];
+		}
+		entries.swap(scratch);
+	}
+}
+
+void RenderQueue::execute()
+{
+	sort();
+
+	packetsRun = (int)packets.size();
+	passesRun = 0;
+
+	int pass = -1;
+	bool blending = false;
+
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	for (size_t i = 0; i < entries.size(); i++)
+	{
+		const Packet& packet = packets[entries[i].packet];
+
+		int packetPass = (int)(entries[i].key >> passShift);
+		if (packetPass != pass)
+		{
+			if (pass >= 0 && passes[pass].end)
+			{
+				passes[pass].end();
+			}
+			pass = packetPass;
+			if (passes[pass].begin)
+			{
+				passes[pass].begin();
+			}
+			passesRun++;
+		}
+
+		GLState::set(GL_BLEND, packet.blended);
+		blending = packet.blended;
+		if (packet.texture != NULL)
+		{
+			GLState::bindTexture(*packet.texture);
+		}
+
+		glLoadMatrixf(packet.matrix);
+		GLState::colour(packet.colour);
+		running = &packet.frustum;
+		packet.draw();
+	}
+	running = &everything;
+
+	if (pass >= 0 && passes[pass].end)
+	{
+		passes[pass].end();
+	}
+	if (blending)
+	{
+		GLState::disable(GL_BLEND);
+	}
+	glPopMatrix();
+
+	packets.clear();
+	entries.clear();
+}
@@ -0,0 +1,100 @@
+// RenderQueue class, collects a frame's draws as packets and runs them in sorted order.
+// Each packet is keyed by 64 bits: pass, blend, texture and depth, most significant first. Passes run in number order and
+// each sets up its own state, so stencil and mask work keeps its order. Within a pass opaque packets sort by texture and
+// then front to back, so depth testing rejects what is hidden early, and blended packets follow back to front.
+// The keys are radix sorted once per frame, equal keys keep the order they were submitted in.
+// A packet captures the modelview and colour current when it's submitted and its draw runs under them. Blending, texture
+// and colour go through GLState, so packets sorted together skip setting what the one before already set.
+// Packets given bounds are culled as they're submitted if they're wholly outside the view, see Frustum.
+#ifndef _RENDERQUEUE_H_
+#define _RENDERQUEUE_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <vector>
+#include <functional>
+#include "Frustum.h"
+
+class RenderQueue
+{
+
+public:
+	// Draws a packet under the modelview and colour it was submitted with.
+	typedef std::function<void()> Draw;
+	// Sets up or puts back the state of a pass. Blending is left to the queue.
+	typedef std::function<void()> State;
+
+	static const int maxPasses = 256;
+
+	RenderQueue();
+
+	// Gives pass the state it runs with, begin is run before its first packet and end after its last. Either may be empty.
+	void setPass(int pass, const State& begin, const State& end);
+
+	// Starts a frame's submissions, taking the projection to cull against and clearing each pass's window.
+	void begin();
+
+	// Queues draw in pass under the current modelview. texture is the variable holding the texture bound for the draw, read
+	// when it runs, or NULL if the draw binds its own. colour is RGBA, or NULL for white. bounds, in the modelview's space,
+	// cull the packet if they're outside the view or pass's window, NULL never culls. Returns false if it was culled.
+	bool submit(int pass, bool blended, const GLuint* texture, const GLfloat* colour, const Bounds* bounds, const Draw& draw);
+
+	// Narrows what pass can see to the part of the screen bounds cover under the current modelview, e.g. a mirror's
+	// reflection to the mirror. Returns false if they're off screen, when nothing in the pass could be seen.
+	bool setWindow(int pass, const Bounds& bounds);
+
+	// Sorts and runs the queued packets, then empties the queue. Must be on the GL thread.
+	void execute();
+	// Frustum the running packet was tested against, in the space of its modelview. For draws to cull their own parts.
+	const Frustum& frustum() const { return *running; };
+
+	// Counts from the last execute, and packets culled since begin.
+	int packetCount() const { return packetsRun; };
+	int passCount() const { return passesRun; };
+	int culledCount() const { return culled; };
+
+	// Builds a sort key. depth is the distance in front of the eye, quantised to 32 bits.
+	static unsigned long long makeKey(int pass, bool blended, GLuint texture, float depth);
+
+private:
+	RenderQueue(const RenderQueue&);
+	RenderQueue& operator=(const RenderQueue&);
+
+	// Orders the entries by key.
+	void sort();
+
+	struct Packet
+	{
+		GLfloat matrix[16];
+		GLfloat colour[4];
+		const GLuint* texture;
+		bool blended;
+		Frustum frustum;
+		Draw draw;
+	};
+	std::vector<Packet> packets;
+
+	// A key and the packet it sorts, the packets themselves are never moved.
+	struct Entry
+	{
+		unsigned long long key;
+		unsigned int packet;
+	};
+	std::vector<Entry> entries, scratch;
+
+	struct PassState
+	{
+		State begin, end;
+		float window[4];
+		bool windowed;
+	};
+	std::vector<PassState> passes;
+
+	GLfloat projection[16];
+	Frustum everything;
+	const Frustum* running;
+
+	int packetsRun, passesRun, culled;
+};
+
+#endif
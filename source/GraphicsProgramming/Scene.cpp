@@ -10,18 +10,22 @@ Scene::Scene(Input *in)
 	glClearColor(0.39f, 0.58f, 93.0f, 1.0f);			// Cornflour Blue Background
 	glClearDepth(1.0f);									// Depth Buffer Setup
 	glClearStencil(0);									// Clear stencil buffer
-	glEnable(GL_DEPTH_TEST);							// Enables Depth Testing
+	GLState::enable(GL_DEPTH_TEST);						// Enables Depth Testing
 	glDepthFunc(GL_LEQUAL);								// The Type Of Depth Testing To Do
 	glHint(GL_PERSPECTIVE_CORRECTION_HINT, GL_NICEST);	// Really Nice Perspective Calculations
-	glEnable(GL_LIGHTING);								// Enable lighting
-	glEnable(GL_COLOR_MATERIAL);						// Enable material colour
+	GLState::enable(GL_LIGHTING);						// Enable lighting
+	GLState::enable(GL_COLOR_MATERIAL);					// Enable material colour
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);	// Initialise blend function
-	glEnable(GL_TEXTURE_2D);							// Enable textures on polygons
+	GLState::enable(GL_TEXTURE_2D);						// Enable textures on polygons
 	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);	// Set mode for texture application
 
 	// Other OpenGL / render setting should be applied here.
-	tram.load("Models/tram.obj", NULL, "models/tram.mtl");
-	crowbar.load("Models/Crowbar.obj", NULL, NULL);
+	// Models and textures load in the background, drawing placeholders until they're ready.
+	GLExtensions::load();
+	assets.init();
+	tram.setVertexFormat(VertexBuffer::PackedInterleaved);	// Drawn three times a frame, worth the smaller vertices
+	assets.loadModel(&tram, "Models/tram.obj", NULL, "models/tram.mtl");
+	assets.loadModel(&crowbar, "Models/Crowbar.obj", NULL, NULL);
 
 	// Initialise variables
 	textureSetup();										// Set up some default textures
@@ -35,12 +39,17 @@ Scene::Scene(Input *in)
 	tramCamera.update();								// Update tramCamera variables
 	doorCamera.update();								// Update doorCamera variables
 
-	shape.genDiscData(1.f, 24.f);							// Genereate disc data
-	shape.genSphereData(1.f, 20.f);							// Genereate sphere data
-	shape.genCylinderData(1.f, 24.f);						// Genereate cylinder data
-	shape.genTorusData(0.325f, 24.f);						// Genereate torus data
-	shape.genTramRailData(1.f, 20.f);						// Genereate tram rail data
-	shape.genWall(1.f, 20.f);								// Genereate wall data
+	// Shapes baked ahead of time, see BakedShapes. Equivalent to genDiscData(1, 24), genSphereData(1, 20),
+	// genCylinderData(1, 24), genTorusData(0.325, 24), genTramRailData(1, 20) and genWall(1, 20).
+	shape.setDiscData(BakedDisc<24, 1000>::arrays());
+	shape.setSphereData(BakedTables::sphere());
+	shape.setCylinderData(BakedTables::cylinder());
+	shape.setTorusData(BakedTables::torus());
+	shape.setTramRailData(BakedTables::plane(), BakedTables::cuboid(), BakedTables::cuboidAtlasTexCoords());
+	shape.setWallData(BakedTables::wall());
+	instanceSetup();										// Place the repeated rails
+	staticBatchSetup();										// Merge the static scenery
+	renderQueueSetup();										// State for each pass of the render queue
 }
 
 void Scene::update(float dt)
@@ -66,6 +75,27 @@ void Scene::update(float dt)
 	// Swap between texture filtering modes.
 	texFilterMode();
 
+	// Swap between vertex buffer objects and client arrays.
+	vertexBufferMode();
+
+	// Swap between hardware instancing and a loop of draws.
+	instancingMode();
+
+	// Show or hide the light spheres.
+	lightSpheresMode();
+
+	// Swap between dropping repeated GL state changes and issuing them all.
+	stateCacheMode();
+
+	// Swap between the scalar, SSE and AVX culling kernels.
+	cullingKernelMode();
+
+	// Compare the tram's vertex formats.
+	vertexFormatBenchmark();
+
+	// Compare the culling kernels.
+	cullingBenchmark();
+
 	// Calculate FPS for output
 	calculateFPS();
 
@@ -78,6 +108,11 @@ void Scene::update(float dt)
 
 void Scene::render() {
 
+	// Upload any assets the loader has finished decoding, a couple of milliseconds a frame.
+	assets.update(2.f);
+	Instancing::resetCounts();
+	GLState::resetCounts();
+
 	// Clear Color and Depth Buffers
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
@@ -100,9 +135,9 @@ void Scene::render() {
 	// End render geometry --------------------------------------
 
 	// Render text, should be last object rendered.
-	glDisable(GL_LIGHTING);	// Disable lighting to prevent issues with text discolouration.
+	GLState::disable(GL_LIGHTING);	// Disable lighting to prevent issues with text discolouration.
 	renderTextOutput();
-	glEnable(GL_LIGHTING);	// Re-enable lighting to prevent issues with scene lights.
+	GLState::enable(GL_LIGHTING);	// Re-enable lighting to prevent issues with scene lights.
 	
 	// Swap buffers, after all objects are rendered.
 	glutSwapBuffers();
@@ -140,141 +175,105 @@ void Scene::resize(int w, int h)
 }
 
 // Shows use of the stencil buffer to create a reflection of a given shape.
+// Queues the mirror into the stencil buffer, the reflected objects inside it, the tinted mirror over them and then the
+// real objects, each in its own pass, see renderQueueSetup.
 void Scene::stencilBufferExample()
 {
-	// Turn off writing to the frame buffer
-	glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-
-	// Enable stencil test
-	glEnable(GL_STENCIL_TEST);
-
-	// Set stencil function to always pass
-	glStencilFunc(GL_ALWAYS, 1, 1);
-
-	// Set the stencil opertaion to replace values when the test passes
-	glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
-
-	// Disable depth test
-	glDisable(GL_DEPTH_TEST);
-
-	// Draw wall object
+	// Mirror, into the stencil buffer only. The reflection is only seen through it, so is culled to the mirror's part of
+	// the screen, or skipped if the mirror is out of view.
 	glPushMatrix();
 		glTranslatef(-12.f, 0.f, -55.f);
 		glScalef(1.2f, 1.2f, 1.0f);
-		shape.renderPlane(NULL);		// Reflection
+		bool mirrorShown = queue.submit(ReflectionMaskPass, false, &noTexture, white, &shape.planeBounds(), [this]() { shape.renderPlane(NULL); }) &&
+			queue.setWindow(ReflectedPass, shape.planeBounds());
 	glPopMatrix();
-	
-
-	// Enable depth test
-	glEnable(GL_DEPTH_TEST);
 
-	// Turn on rendering to the frame buffer
-	glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-
-	// Set stencil function to test if the value is '1'
-	glStencilFunc(GL_EQUAL, 1, 1);
-
-	// Set the stencil operation to keep all values
-	glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
-
-	// Reflected objects
-	glPushMatrix();
-		glColor3f(1.f, 1.f, 1.f);
-		glScalef(1.0f, 1.0f, -1.0f);
-		glTranslatef(tramX, 2.965f, 100.f);
-		glRotatef(90.f, 0.f, 1.f, 0.f);
-		tram.render();
-	glPopMatrix();
+	if (mirrorShown)
+	{
+		renderReflection();
+	}
 
+	// Mirror, blended over the reflection
 	glPushMatrix();
-		glTranslatef(0.f, 0.f, -37.f);
-		renderDoor();
+		glTranslatef(-12.f, 0.f, -55.f);
+		glScalef(1.2f, 1.2f, 1.0f);
+		queue.submit(MirrorPass, true, &noTexture, mirrorColour, &shape.planeBounds(), [this]() { shape.renderPlane(NULL); });
 	glPopMatrix();
 
+	// Real objects. The door and its room have always been drawn in the mirror's colour.
 	glPushMatrix();
-		glTranslatef(0.f, 0.f, -20.f);
-		renderDoorRoom();
+		glTranslatef(0.f, 0.f, -3.0f);
+		renderDoor(RealPass, mirrorColour);
 	glPopMatrix();
 
-	glPushMatrix();
-		glTranslatef(0.f, 0.f, -94.5f);
-		renderRail();
-	glPopMatrix();
+	renderDoorRoom(RealPass, mirrorColour);
 
 	glPushMatrix();
-		glTranslatef(0.f, 0.f, -40.f);
-		renderDoorLocks();
+		glTranslatef(0.f, 0.f, -2.5f);
+		renderDoorLocks(RealPass, doorLockLods);
 	glPopMatrix();
 
-	glPushMatrix();
-		glTranslatef(0.f, 0.f, -110.f);
-		glRotatef(180.f, 1.f, 0.f, 0.f);
-		renderWalkway();
-	glPopMatrix();
+	renderWalkway(RealPass);
 
 	glPushMatrix();
-		glTranslatef(9.1f, 1.5f, -65.f);
+		glTranslatef(9.1f, 1.5f, -45.f);
 		glRotatef(-45.f, 0.f, 0.f, 1.f);
 		glScalef(0.05f, 0.05f, 0.05f);
-		crowbar.render();
+		Bounds crowbarBounds = crowbar.bounds();
+		queue.submit(RealPass, false, NULL, white, &crowbarBounds, [this]() { crowbar.render(chooseLod(crowbar, crowbarLod)); });
 	glPopMatrix();
+}
 
-	// Disable stencil test
-	glDisable(GL_STENCIL_TEST);
-
-	// Enable alpha blending
-	glEnable(GL_BLEND);
-
-	// Disable lighting
-	glDisable(GL_LIGHTING);
-
-	// Set colour of floor object
-	glColor4f(0.4f, 0.4f, 0.5f, 0.8f);
+// Queues the copies of the objects seen in the mirror.
+void Scene::renderReflection()
+{
+	Bounds tramBounds = tram.bounds(), crowbarBounds = crowbar.bounds();
 
 	glPushMatrix();
-		glTranslatef(-12.f, 0.f, -55.f);
-		glScalef(1.2f, 1.2f, 1.0f);
-		shape.renderPlane(NULL);				// Reflection Plane
+		glScalef(1.0f, 1.0f, -1.0f);
+		glTranslatef(tramX, 2.965f, 100.f);
+		glRotatef(90.f, 0.f, 1.f, 0.f);
+		queue.submit(ReflectedPass, false, NULL, white, &tramBounds, [this]() { tram.render(chooseLod(tram, reflectedTramLod, reflectionLodBias)); });
 	glPopMatrix();
 
-	// Enable lighting
-	glEnable(GL_LIGHTING);
-
-	// Disable blend
-	glDisable(GL_BLEND);
+	glPushMatrix();
+		glTranslatef(0.f, 0.f, -37.f);
+		renderDoor(ReflectedPass, white);
+	glPopMatrix();
 
-	// Real objects
 	glPushMatrix();
-		glTranslatef(0.f, 0.f, -3.0f);
-		renderDoor();
+		glTranslatef(0.f, 0.f, -20.f);
+		renderDoorRoom(ReflectedPass, white);
 	glPopMatrix();
 
 	glPushMatrix();
-		renderDoorRoom();
+		glTranslatef(0.f, 0.f, -94.5f);
+		renderRail(ReflectedPass);
 	glPopMatrix();
 
 	glPushMatrix();
-		glTranslatef(0.f, 0.f, -2.5f);
-		renderDoorLocks();
+		glTranslatef(0.f, 0.f, -40.f);
+		renderDoorLocks(ReflectedPass, reflectedDoorLockLods, reflectionLodBias);
 	glPopMatrix();
 
 	glPushMatrix();
-		renderWalkway();
+		glTranslatef(0.f, 0.f, -110.f);
+		glRotatef(180.f, 1.f, 0.f, 0.f);
+		renderWalkway(ReflectedPass);
 	glPopMatrix();
 
 	glPushMatrix();
-		glTranslatef(9.1f, 1.5f, -45.f);
+		glTranslatef(9.1f, 1.5f, -65.f);
 		glRotatef(-45.f, 0.f, 0.f, 1.f);
 		glScalef(0.05f, 0.05f, 0.05f);
-		crowbar.render();
+		queue.submit(ReflectedPass, false, NULL, white, &crowbarBounds, [this]() { crowbar.render(chooseLod(crowbar, reflectedCrowbarLod, reflectionLodBias)); });
 	glPopMatrix();
 }
 
 // Shows an example of a planar shadow using a model.
+// Queues the wall into the stencil buffer, the flattened rail and tram inside it, then the real rail and tram.
 void Scene::planarShadow()
 {
-	glBindTexture(GL_TEXTURE_2D, NULL);
-
 	GLfloat wallVerts[] = { -30.f, 30.f, -34.9f, // top left
 							-30.f, -30.f, -34.9f, // bottom left
 							30.f, -30.f, -34.9f, // bottom right
@@ -283,69 +282,109 @@ void Scene::planarShadow()
 	// Generate shadow matrix
 	shadowMatrix.generateShadowMatrix(shadowMatrixArray, sceneLightPosition, wallVerts);
 
-	// Turn off writing to the frame buffer
-	glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-
-	// Enable stencil test
-	glEnable(GL_STENCIL_TEST);
-
-	// Set stencil function to always pass
-	glStencilFunc(GL_ALWAYS, 1, 1);
-
-	// Set the stencil opertaion to replace values when the test passes
-	glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
-
-	glBegin(GL_QUADS);
-	glColor3f(1.0f, 0.8f, 0.8f);
-	glVertex3f(-30.f, 30.f, -34.9f);
-	glVertex3f(-30.f, -30.f, -34.9f);
-	glVertex3f(30.f, -30.f, -34.9f);
-	glVertex3f(30.f, 30.f, -34.9f);
-	glEnd();
-
-	// Disable depth test
-	glDisable(GL_STENCIL_TEST);
-
-	// Render shadow
-	glDisable(GL_DEPTH_TEST);
-	glDisable(GL_LIGHTING);
-	glDisable(GL_TEXTURE_2D);
-	glEnable(GL_BLEND);
-
+	// Wall the shadow falls on, into the stencil buffer only. The shadow can't be seen if the wall can't.
+	const Bounds wallBounds(Vector3(-30.f, -30.f, -34.9f), Vector3(30.f, 30.f, -34.9f));
+	bool wallShown = queue.submit(ShadowMaskPass, false, &noTexture, white, &wallBounds, []()
+	{
+		glBegin(GL_QUADS);
+		glVertex3f(-30.f, 30.f, -34.9f);
+		glVertex3f(-30.f, -30.f, -34.9f);
+		glVertex3f(30.f, -30.f, -34.9f);
+		glVertex3f(30.f, 30.f, -34.9f);
+		glEnd();
+	});
 
-	glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-	glEnable(GL_STENCIL_TEST);
-	glStencilFunc(GL_EQUAL, 1, 1);
-	glStencilOp(GL_KEEP, GL_KEEP, GL_ZERO);
+	// Render shadow. The shadow matrix is a projection, so the flattened copies aren't culled themselves.
+	if (wallShown)
+	{
+		const GLfloat shadowColour[4] = { 0.1f, 0.1f, 0.1f, 1.f };
+		glPushMatrix();
+			glMultMatrixf((GLfloat *)shadowMatrixArray);
+			queue.submit(ShadowPass, true, NULL, shadowColour, NULL, [this]() { shape.renderTramRail(hazardTexture, hazardTexture, railInstances, 5); });
+			glTranslatef(tramX, 2.965f, -5.0f);
+			glRotatef(90, 0.f, 1.f, 0.f);
+			// The shadow matrix flattens it, so go from the real tram's level
+			queue.submit(ShadowPass, true, NULL, shadowColour, NULL, [this]() { tram.render(tramLod + shadowLodBias); });
+		glPopMatrix();
+	}
 
-	glColor3f(0.1f, 0.1f, 0.1f);	// Shadow's colour
+	// render object
 	glPushMatrix();
-		glMultMatrixf((GLfloat *)shadowMatrixArray);
-		renderRail();
 		glTranslatef(tramX, 2.965f, -5.0f);
-		glRotatef(90, 0.f, 1.f, 0.f);
-		tram.render();
+		glRotatef(90.f, 0.f, 1.f, 0.f);
+		Bounds tramBounds = tram.bounds();
+		queue.submit(ShadowCasterPass, false, NULL, white, &tramBounds, [this]() { tram.render(chooseLod(tram, tramLod)); });
 	glPopMatrix();
 
-	glDisable(GL_BLEND);
-	glDisable(GL_STENCIL_TEST);
-	glEnable(GL_DEPTH_TEST);
+	renderRail(ShadowCasterPass);
+}
 
-	glColor3f(1.0f, 1.0f, 1.0f); // Model colour
-	glEnable(GL_DEPTH_TEST);
-	glEnable(GL_LIGHTING);
-	glEnable(GL_TEXTURE_2D);
+// Gives each pass of the render queue its state. The passes run in the order they're declared in, see Scene::Pass.
+void Scene::renderQueueSetup()
+{
+	// Stencil writes only, where the mirror is
+	queue.setPass(ReflectionMaskPass, []()
+	{
+		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+		GLState::enable(GL_STENCIL_TEST);
+		glStencilFunc(GL_ALWAYS, 1, 1);
+		glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+		GLState::disable(GL_DEPTH_TEST);
+	}, []()
+	{
+		GLState::enable(GL_DEPTH_TEST);
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+		GLState::disable(GL_STENCIL_TEST);
+	});
 
-	// render object
-	glPushMatrix();
-		glTranslatef(tramX, 2.965f, -5.0f);
-		glRotatef(90.f, 0.f, 1.f, 0.f);
-		tram.render();
-	glPopMatrix();
+	// Only inside the mirror
+	queue.setPass(ReflectedPass, []()
+	{
+		GLState::enable(GL_STENCIL_TEST);
+		glStencilFunc(GL_EQUAL, 1, 1);
+		glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+	}, []()
+	{
+		GLState::disable(GL_STENCIL_TEST);
+	});
 
-	glPushMatrix();
-		renderRail();
-	glPopMatrix();
+	queue.setPass(MirrorPass, []()
+	{
+		GLState::disable(GL_LIGHTING);
+	}, []()
+	{
+		GLState::enable(GL_LIGHTING);
+	});
+
+	// Stencil writes only, where the wall can be seen
+	queue.setPass(ShadowMaskPass, []()
+	{
+		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+		GLState::enable(GL_STENCIL_TEST);
+		glStencilFunc(GL_ALWAYS, 1, 1);
+		glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+	}, []()
+	{
+		GLState::disable(GL_STENCIL_TEST);
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+	});
+
+	// Flat, untextured and unlit on the wall, clearing the stencil as it goes so overlaps darken once
+	queue.setPass(ShadowPass, []()
+	{
+		GLState::disable(GL_DEPTH_TEST);
+		GLState::disable(GL_LIGHTING);
+		GLState::disable(GL_TEXTURE_2D);
+		GLState::enable(GL_STENCIL_TEST);
+		glStencilFunc(GL_EQUAL, 1, 1);
+		glStencilOp(GL_KEEP, GL_KEEP, GL_ZERO);
+	}, []()
+	{
+		GLState::disable(GL_STENCIL_TEST);
+		GLState::enable(GL_DEPTH_TEST);
+		GLState::enable(GL_LIGHTING);
+		GLState::enable(GL_TEXTURE_2D);
+	});
 }
 
 // Resets all variables to default values within the scene.
@@ -369,13 +408,13 @@ void Scene::reset()
 // Sets up the skybox.
 void Scene::skyboxSetup()
 {
-	glBindTexture(GL_TEXTURE_2D, NULL);
-	glColor3f(0.15f, 0.15f, 0.15f); // 0.125 is close to wall colour
+	GLState::bindTexture(NULL);
+	GLState::colour(0.15f, 0.15f, 0.15f); // 0.125 is close to wall colour
 
 	glPushMatrix();
 		glTranslatef(cameraPointer->getPosition().x, cameraPointer->getPosition().y, cameraPointer->getPosition().z);
-		glDisable(GL_DEPTH_TEST);
-		glDisable(GL_LIGHTING);
+		GLState::disable(GL_DEPTH_TEST);
+		GLState::disable(GL_LIGHTING);
 		glBegin(GL_QUADS);
 		// Front face
 		glTexCoord2f(0.5f, 0.25f);
@@ -456,8 +495,8 @@ void Scene::skyboxSetup()
 		glVertex3f(0.5f, -0.5f, 0.5f);
 		glEnd();
 
-		glEnable(GL_DEPTH_TEST);
-		glEnable(GL_LIGHTING);
+		GLState::enable(GL_DEPTH_TEST);
+		GLState::enable(GL_LIGHTING);
 	glPopMatrix();
 }
 
@@ -579,7 +618,7 @@ void Scene::lightingSetup()
 		glLightf(GL_LIGHT4, GL_CONSTANT_ATTENUATION, 1.0f);
 		glLightf(GL_LIGHT4, GL_LINEAR_ATTENUATION, 0.25f);
 		glLightf(GL_LIGHT4, GL_QUADRATIC_ATTENUATION, 0.05f);
-		glEnable(GL_LIGHT4);
+		GLState::enable(GL_LIGHT4);
 	glPopMatrix();
 
 #pragma endregion Left dock light
@@ -600,7 +639,7 @@ void Scene::lightingSetup()
 		glLightf(GL_LIGHT5, GL_CONSTANT_ATTENUATION, 1.0f);
 		glLightf(GL_LIGHT5, GL_LINEAR_ATTENUATION, 0.25f);
 		glLightf(GL_LIGHT5, GL_QUADRATIC_ATTENUATION, 0.05f);
-		glEnable(GL_LIGHT5);
+		GLState::enable(GL_LIGHT5);
 	glPopMatrix();
 
 #pragma endregion Right dock light
@@ -623,7 +662,7 @@ void Scene::lightingSetup()
 		glLightf(GL_LIGHT6, GL_CONSTANT_ATTENUATION, 1.0f);
 		glLightf(GL_LIGHT6, GL_LINEAR_ATTENUATION, 0.2f);
 		glLightf(GL_LIGHT6, GL_QUADRATIC_ATTENUATION, 0.f);
-		glEnable(GL_LIGHT6);
+		GLState::enable(GL_LIGHT6);
 	glPopMatrix();
 
 #pragma endregion Lights up the entire scene a small amount
@@ -709,57 +748,12 @@ void Scene::cameraSelection()
 // Sets up textures to be used in the scene.
 void Scene::textureSetup()
 {
-	doorTopTexture = SOIL_load_OGL_texture
-	(
-		"gfx/doorTop.png",
-		SOIL_LOAD_AUTO,
-		SOIL_CREATE_NEW_ID,
-		SOIL_FLAG_MIPMAPS | SOIL_FLAG_NTSC_SAFE_RGB | SOIL_FLAG_COMPRESS_TO_DXT
-	);
-
-	doorBottomTexture = SOIL_load_OGL_texture
-	(
-		"gfx/doorBottom.png",
-		SOIL_LOAD_AUTO,
-		SOIL_CREATE_NEW_ID,
-		SOIL_FLAG_MIPMAPS | SOIL_FLAG_NTSC_SAFE_RGB | SOIL_FLAG_COMPRESS_TO_DXT
-	);
-	doorTopTextureFlipped = SOIL_load_OGL_texture
-	(
-		"gfx/doorTopFlipped.png",
-		SOIL_LOAD_AUTO,
-		SOIL_CREATE_NEW_ID,
-		SOIL_FLAG_MIPMAPS | SOIL_FLAG_NTSC_SAFE_RGB | SOIL_FLAG_COMPRESS_TO_DXT
-	);
-
-	doorBottomTextureFlipped = SOIL_load_OGL_texture
-	(
-		"gfx/doorBottomFlipped.png",
-		SOIL_LOAD_AUTO,
-		SOIL_CREATE_NEW_ID,
-		SOIL_FLAG_MIPMAPS | SOIL_FLAG_NTSC_SAFE_RGB | SOIL_FLAG_COMPRESS_TO_DXT
-	);
-	grateTexture = SOIL_load_OGL_texture
-	(
-		"gfx/grate.png",
-		SOIL_LOAD_AUTO,
-		SOIL_CREATE_NEW_ID,
-		SOIL_FLAG_MIPMAPS | SOIL_FLAG_NTSC_SAFE_RGB | SOIL_FLAG_COMPRESS_TO_DXT
-	);
-	hazardTexture = SOIL_load_OGL_texture
-	(
-		"gfx/hazard.png",
-		SOIL_LOAD_AUTO,
-		SOIL_CREATE_NEW_ID,
-		SOIL_FLAG_MIPMAPS | SOIL_FLAG_NTSC_SAFE_RGB | SOIL_FLAG_COMPRESS_TO_DXT
-	);
-	wallTexture = SOIL_load_OGL_texture
-	(
-		"gfx/wall.png",
-		SOIL_LOAD_AUTO,
-		SOIL_CREATE_NEW_ID,
-		SOIL_FLAG_MIPMAPS | SOIL_FLAG_NTSC_SAFE_RGB | SOIL_FLAG_COMPRESS_TO_DXT
-	);
+	// Each door half's flipped back and its front in one atlas, so it draws in one go.
+	assets.loadAtlas(&doorTopAtlas, "gfx/doorTopFlipped.png", "gfx/doorTop.png");
+	assets.loadAtlas(&doorBottomAtlas, "gfx/doorBottomFlipped.png", "gfx/doorBottom.png");
+	assets.loadTexture(&grateTexture, "gfx/grate.png");
+	assets.loadTexture(&hazardTexture, "gfx/hazard.png");
+	assets.loadTexture(&wallTexture, "gfx/wall.png");
 }
 
 // Sets up specular material values to be used in the scene.
@@ -797,6 +791,286 @@ void Scene::wireframeMode()
 	}
 }
 
+// Allows user to switch between vertex buffer objects and client side arrays, to compare the two.
+void Scene::vertexBufferMode()
+{
+	if (input->isKeyDown('v'))
+	{
+		VertexBuffer::useBuffers = !VertexBuffer::useBuffers;
+		input->SetKeyUp('v');
+	}
+}
+
+// Toggles instanced draws on 'h', falling back to a loop of draws shows what instancing saves.
+void Scene::instancingMode()
+{
+	if (input->isKeyDown('h'))
+	{
+		Instancing::useHardware = !Instancing::useHardware;
+		input->SetKeyUp('h');
+	}
+}
+
+// Toggles GLState's cache on 'g', issuing every state change shows how many were already set.
+void Scene::stateCacheMode()
+{
+	if (input->isKeyDown('g'))
+	{
+		GLState::useCache = !GLState::useCache;
+		input->SetKeyUp('g');
+	}
+}
+
+// Steps through the culling kernels this CPU supports on 'u', they all cull the same parts so only the timing differs.
+void Scene::cullingKernelMode()
+{
+	if (input->isKeyDown('u'))
+	{
+		BoundsArray::nextKernel();
+		input->SetKeyUp('u');
+	}
+}
+
+// Toggles the spheres marking each light on 'l'. They're one instanced draw so can be left on.
+void Scene::lightSpheresMode()
+{
+	if (input->isKeyDown('l'))
+	{
+		showLightSpheres = !showLightSpheres;
+		input->SetKeyUp('l');
+	}
+}
+
+// Builds each instance's transform on a clean matrix stack, the same transforms the rails were drawn with one at a time.
+void Scene::instanceSetup()
+{
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+
+	// Rails
+	const float railX[5] = { 30.f, 10.f, -10.f, -30.f, -50.f };
+	for (int i = 0; i < 5; i++)
+	{
+		glLoadIdentity();
+		glTranslatef(railX[i], 10.99f, -5.5f);
+		railInstances[i] = Instancing::capture();
+		railBounds.add(shape.tramRailBounds(), railInstances[i].transform);
+	}
+
+	glPopMatrix();
+}
+
+// Adds the static scenery to its batches with the transforms and colours it used to be drawn with each frame.
+// The batches rebuild themselves on their next render, so changing the layout is a matter of clearing and adding again.
+void Scene::staticBatchSetup()
+{
+	const GLfloat black[4] = { 0.f, 0.f, 0.f, 1.f };
+	const GLfloat grey[4] = { 0.6f, 0.6f, 0.6f, 1.f };
+	const GLfloat white[4] = { 1.f, 1.f, 1.f, 1.f };
+
+	sceneryBatch.clear();
+	doorRoomBatch.clear();
+	walkwayBatch.clear();
+
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+
+	// Bottom plane
+	glLoadIdentity();
+	glTranslatef(-30.0f, -30.0f, -35.0f);
+	glRotatef(90.f, 1.f, 0.f, 0.f);
+	glScalef(3.0f, 6.0f, 1.0f);
+	shape.batchPlane(sceneryBatch, NULL, black);
+
+	// Back wall
+	glLoadIdentity();
+	glTranslatef(-30.0f, -30.0f, -35.0f);
+	glScalef(3.0f, 6.0f, 1.0f);
+	shape.batchWall(sceneryBatch, &wallTexture, grey);
+
+	// Left wall
+	glLoadIdentity();
+	glTranslatef(-30.0f, -30.0f, 25.0f);
+	glRotatef(90.f, 0.f, 1.f, 0.f);
+	glScalef(3.0f, 6.0f, 1.0f);
+	shape.batchWall(sceneryBatch, &wallTexture, grey);
+
+	// Right wall
+	glLoadIdentity();
+	glTranslatef(30.0f, -30.0f, -35.f);
+	glRotatef(270.f, 0.f, 1.f, 0.f);
+	glScalef(3.0f, 6.0f, 1.0f);
+	shape.batchWall(sceneryBatch, &wallTexture, grey);
+
+	// Left dock and its end wall
+	glLoadIdentity();
+	glTranslatef(-50.f, 0.f, -17.0f);
+	glScalef(1.0f, 12.0f, 24.0f);
+	shape.batchTramDock(sceneryBatch, &wallTexture, white);
+	glScalef(1.0f, 0.1f, 0.05f);
+	glRotatef(-90.f, 0.f, 1.f, 0.f);
+	shape.batchPlane(sceneryBatch, &wallTexture, white);
+
+	// Right dock and its end wall
+	glLoadIdentity();
+	glTranslatef(30.f, 0.f, -17.0f);
+	glScalef(1.0f, 12.0f, 24.0f);
+	shape.batchTramDock(sceneryBatch, &wallTexture, white);
+	glTranslatef(20.f, 0.f, 1.f);
+	glRotatef(-270.f, 0.f, 1.f, 0.f);
+	glScalef(0.05f, 0.1f, 1.f);
+	shape.batchPlane(sceneryBatch, &wallTexture, white);
+
+	// Door room, relative to wherever renderDoorRoom is drawn
+	glLoadIdentity();
+	glTranslatef(12.f, 0.f, -55.f);
+	glRotatef(-90.f, 0.f, 1.f, 0.f);
+	glScalef(1.0f, 12.0f, 24.0f);
+	shape.batchTramDock(doorRoomBatch, &wallTexture);
+
+	// Walkway parts, relative to wherever renderWalkway is drawn
+	glLoadIdentity();
+	glTranslatef(-18.0f, 0.0f, -35.0f);
+	glRotatef(90.f, 1.f, 0.f, 0.f);
+	glScalef(1.8f, 1.0f, 1.0f);
+	shape.batchPlane(walkwayBatch, &grateTexture);
+	glLoadIdentity();
+	glTranslatef(-12.0f, 0.0f, -25.0f);
+	glRotatef(90.f, 1.f, 0.f, 0.f);
+	glScalef(1.2f, 1.75f, 1.0f);
+	shape.batchPlane(walkwayBatch, &grateTexture);
+
+	glPopMatrix();
+}
+
+// Times uploading and drawing the tram in each vertex format when 'b' is pressed, printing the results to the console.
+// Runs before the frame is cleared so the test draws never show.
+void Scene::vertexFormatBenchmark()
+{
+	if (!input->isKeyDown('b'))
+	{
+		return;
+	}
+	input->SetKeyUp('b');
+	if (!tram.isResident())
+	{
+		return;
+	}
+
+	typedef std::chrono::high_resolution_clock Clock;
+	const int draws = 200;
+	const VertexBuffer::Format formats[] = { VertexBuffer::FloatArrays, VertexBuffer::PackedInterleaved };
+	const char* names[] = { "Float arrays", "Packed interleaved" };
+	VertexBuffer::Format original = tram.vertexFormat();
+
+	for (int i = 0; i < 2; i++)
+	{
+		glFinish();
+		Clock::time_point start = Clock::now();
+		tram.setVertexFormat(formats[i]);
+		glFinish();
+		float uploadMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+
+		if (tram.vertexFormat() != formats[i])
+		{
+			printf("%s: not supported by this driver\n", names[i]);
+			continue;
+		}
+
+		// One warm up draw, then the timed ones.
+		tram.render();
+		glFinish();
+		start = Clock::now();
+		for (int d = 0; d < draws; d++)
+		{
+			tram.render();
+		}
+		glFinish();
+		float drawMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count() / draws;
+
+		printf("%s: %d KB uploaded in %.2f ms, %.3f ms per draw, %.1f M vertices/s\n", names[i],
+			(int)(tram.bufferMemory() / 1024), uploadMs, drawMs, tram.indexCount() / (drawMs * 1000.0f));
+	}
+
+	tram.setVertexFormat(original);
+}
+
+// Times each culling kernel on 'j' over 1K, 10K and 100K random boxes against the camera's frustum, printing how many
+// objects each tests per microsecond and whether it agrees with the scalar kernel.
+void Scene::cullingBenchmark()
+{
+	if (!input->isKeyDown('j'))
+	{
+		return;
+	}
+	input->SetKeyUp('j');
+
+	// The frustum the scene is drawn with.
+	GLfloat projection[16], modelview[16], clip[16];
+	glGetFloatv(GL_PROJECTION_MATRIX, projection);
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadIdentity();
+	gluLookAt(cameraPointer->getPosition().getX(), cameraPointer->getPosition().getY(), cameraPointer->getPosition().getZ(),
+		cameraPointer->getLookAt().getX(), cameraPointer->getLookAt().getY(), cameraPointer->getLookAt().getZ(),
+		cameraPointer->getUp().getX(), cameraPointer->getUp().getY(), cameraPointer->getUp().getZ());
+	glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+	glPopMatrix();
+	Frustum::multiply(projection, modelview, clip);
+	Frustum frustum;
+	frustum.extract(clip);
+
+	typedef std::chrono::high_resolution_clock Clock;
+	const int counts[] = { 1000, 10000, 100000 };
+	const char* tests[] = { "boxes", "spheres" };
+	// Rail segment and prop sized boxes scattered through the enclosure and well past it, so every plane culls some.
+	std::mt19937 random(25);
+	std::uniform_real_distribution<float> position(-150.0f, 150.0f);
+	std::uniform_real_distribution<float> size(0.2f, 6.0f);
+
+	for (int c = 0; c < 3; c++)
+	{
+		BoundsArray bounds;
+		for (int i = 0; i < counts[c]; i++)
+		{
+			Vector3 min(position(random), position(random), position(random));
+			Vector3 max(min.x + size(random), min.y + size(random), min.z + size(random));
+			bounds.add(Bounds(min, max));
+		}
+		std::vector<unsigned char> reference(counts[c]), visible(counts[c]);
+		// Around a million tests a kernel, so the small counts aren't lost in the clock's resolution.
+		int repeats = std::max(1, 1000000 / counts[c]);
+
+		for (int t = 0; t < 2; t++)
+		{
+			BoundsArray::Test test = (BoundsArray::Test)t;
+			int expected = bounds.cull(frustum, reference.data(), test, BoundsArray::Scalar);
+			for (int k = 0; k < BoundsArray::KernelCount; k++)
+			{
+				BoundsArray::Kernel kernel = (BoundsArray::Kernel)k;
+				if (!BoundsArray::supported(kernel))
+				{
+					printf("%s: not supported by this CPU\n", BoundsArray::name(kernel));
+					continue;
+				}
+
+				// One warm up cull, then the timed ones.
+				int visibleCount = bounds.cull(frustum, visible.data(), test, kernel);
+				bool matches = visibleCount == expected && visible == reference;
+				Clock::time_point start = Clock::now();
+				for (int r = 0; r < repeats; r++)
+				{
+					bounds.cull(frustum, visible.data(), test, kernel);
+				}
+				float us = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+
+				printf("%d %s, %s: %.1f objects/us, %d visible%s\n", counts[c], tests[t], BoundsArray::name(kernel),
+					(float)counts[c] * repeats / std::max(us, 1.0f), visibleCount, matches ? "" : " (differs from Scalar)");
+			}
+		}
+	}
+}
+
 // Allows user to switch between texture filtering modes.
 void Scene::texFilterMode()
 {
@@ -838,20 +1112,24 @@ void Scene::texFilterMode()
 	}	
 }
 
-// Renders the scene.
+// Queues the scene and draws it sorted, see RenderQueue.
 void Scene::renderScene()
 {
+	// Shared by everything drawn, set once before the queue runs.
+	specularMaterials();
+
+	queue.begin();
+	StaticBatch::resetCounts();
+
 	renderEnclosure();
 
-	//renderLightSpheres();
+	renderLightSpheres();
 
 	stencilBufferExample();
 
 	planarShadow();
 
-	renderLeftDock();
-
-	renderRightDock();
+	queue.execute();
 }
 
 // Allows user to move the tram forwards/backwards.
@@ -863,7 +1141,7 @@ void Scene::tramMovement(float dt)
 		if (tramX < 40.0f)
 		{
 			tramX += 1.f*dt;
-			glEnable(GL_LIGHT3);
+			GLState::enable(GL_LIGHT3);
 		}
 	}
 	// Move tram forwards
@@ -872,13 +1150,13 @@ void Scene::tramMovement(float dt)
 		if (tramX > -40.0f)
 		{
 			tramX -= 1.f*dt;
-			glEnable(GL_LIGHT2);
+			GLState::enable(GL_LIGHT2);
 		}
 	}
 	else if (!input->isKeyDown('i') && !input->isKeyDown('k'))
 	{
-		glDisable(GL_LIGHT2);
-		glDisable(GL_LIGHT3);
+		GLState::disable(GL_LIGHT2);
+		GLState::disable(GL_LIGHT3);
 	}
 }
 
@@ -892,8 +1170,8 @@ void Scene::doorControls(float dt)
 		{
 			bottomDoorY += 0.25f*dt;
 			topDoorY -= 0.25f*dt;
-			glEnable(GL_LIGHT0);
-			glEnable(GL_LIGHT1);
+			GLState::enable(GL_LIGHT0);
+			GLState::enable(GL_LIGHT1);
 			angle += 25.0f * dt;
 		}
 		if (doorLockX >= 0.f && doorLock2X <= 0.f && bottomDoorY >= 0.0f && topDoorY >= 5.9f)
@@ -911,8 +1189,8 @@ void Scene::doorControls(float dt)
 		{
 			bottomDoorY -= 0.25f*dt;
 			topDoorY += 0.25f*dt;
-			glEnable(GL_LIGHT0);
-			glEnable(GL_LIGHT1);
+			GLState::enable(GL_LIGHT0);
+			GLState::enable(GL_LIGHT1);
 			angle += 25.0f * dt;
 		}
 		if (doorLockX < 22.f && doorLock2X > -22.f)
@@ -924,96 +1202,72 @@ void Scene::doorControls(float dt)
 	}
 	if (!input->isKeyDown('q') && !input->isKeyDown('e'))
 	{
-		glDisable(GL_LIGHT0);
-		glDisable(GL_LIGHT1);
+		GLState::disable(GL_LIGHT0);
+		GLState::disable(GL_LIGHT1);
 	}
 }
 
-// Renders spheres at each lights location to allow lights to be seen easier.
+// Queues a small sphere at each light's position in the light's colour, when shown.
 void Scene::renderLightSpheres()
 {
-	// Render a sphere at top left of door (LIGHT_0) position
-	glPushMatrix();
-	glColor3f(1.f, 0.f, 0.f);
-	glTranslatef(doorLight1Pos.x, doorLight1Pos.y, doorLight1Pos.z);
-	gluSphere(gluNewQuadric(), 0.20, 20, 20);
-	glPopMatrix();
-
-	// Render a sphere at top right of door (LIGHT_1) position
-	glPushMatrix();
-	glColor3f(1.f, 0.f, 0.f);
-	glTranslatef(doorLight2Pos.x, doorLight2Pos.y, doorLight2Pos.z);
-	gluSphere(gluNewQuadric(), 0.20, 20, 20);
-	glPopMatrix();
-
-	// Render a sphere at front of tram (LIGHT_2) position
-	glPushMatrix();
-	glColor3f(1.f, 0.8f, 1.f);
-	glTranslatef(tramLight1Pos.x, tramLight1Pos.y, tramLight1Pos.z);
-	gluSphere(gluNewQuadric(), 0.20, 20, 20);
-	glPopMatrix();
-
-	// Render a sphere at back of tram (LIGHT_3) position
-	glPushMatrix();
-	glColor3f(1.f, 0.8f, 1.f);
-	glTranslatef(tramLight2Pos.x, tramLight2Pos.y, tramLight2Pos.z);
-	gluSphere(gluNewQuadric(), 0.20, 20, 20);
-	glPopMatrix();
-
-	// Render a sphere at left dock (LIGHT_4) position
-	glPushMatrix();
-	glColor3f(1.f, 0.8f, 1.f);
-	glTranslatef(dockLight1Pos.x, dockLight1Pos.y, dockLight1Pos.z);
-	gluSphere(gluNewQuadric(), 0.20, 20, 20);
-	glPopMatrix();
-
-	// Render a sphere at right dock (LIGHT_5) position
-	glPushMatrix();
-	glColor3f(1.f, 0.8f, 1.f);
-	glTranslatef(dockLight2Pos.x, dockLight2Pos.y, dockLight2Pos.z);
-	gluSphere(gluNewQuadric(), 0.20, 20, 20);
-	glPopMatrix();
-
-	// Render a sphere at scene lights location (LIGHT_6) position
-	glPushMatrix();
-	glColor3f(1.f, 1.0f, 1.f);
-	glTranslatef(sceneLightPosition[0], sceneLightPosition[1], sceneLightPosition[2]);
-	gluSphere(gluNewQuadric(), 0.20, 20, 20);
-	glPopMatrix();
+	if (showLightSpheres)
+	{
+		queue.submit(ScenePass, false, &noTexture, white, NULL, [this]() { drawLightSpheres(); });
+	}
 }
 
-// Renders the trams rail.
-void Scene::renderRail()
+// Draws the light spheres, all in one instanced draw of the shape's sphere.
+void Scene::drawLightSpheres()
 {
-	// Render rail 0
-	glPushMatrix();
-	glTranslatef(30.f, 10.99f, -5.5f);
-	shape.renderTramRail(hazardTexture, hazardTexture);
-	glPopMatrix();
-
-	// Render rail 1
-	glPushMatrix();
-	glTranslatef(10.f, 10.99f, -5.5f);
-	shape.renderTramRail(hazardTexture, hazardTexture);
-	glPopMatrix();
+	// Door lights (LIGHT_0, LIGHT_1), tram lights (LIGHT_2, LIGHT_3), dock lights (LIGHT_4, LIGHT_5) and the scene light (LIGHT_6).
+	const int lightCount = sizeof(lightInstances) / sizeof(lightInstances[0]);
+	const Vector3 positions[lightCount] = { doorLight1Pos, doorLight2Pos, tramLight1Pos, tramLight2Pos, dockLight1Pos, dockLight2Pos,
+		Vector3(sceneLightPosition[0], sceneLightPosition[1], sceneLightPosition[2]) };
+	const GLfloat colours[lightCount][3] = { { 1.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, { 1.f, 0.8f, 1.f }, { 1.f, 0.8f, 1.f },
+		{ 1.f, 0.8f, 1.f }, { 1.f, 0.8f, 1.f }, { 1.f, 1.f, 1.f } };
+	const float radius = 0.2f;
+
+	GLfloat modelview[16];
+	glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+	int nearest = 0;
+	float nearestDepth = 0.0f;
+	for (int i = 0; i < lightCount; i++)
+	{
+		Instancing::Instance& light = lightInstances[i];
+		light = Instancing::Instance();
+		light.transform[0] = light.transform[5] = light.transform[10] = radius;
+		light.transform[12] = positions[i].x;
+		light.transform[13] = positions[i].y;
+		light.transform[14] = positions[i].z;
+		light.tint[0] = colours[i][0];
+		light.tint[1] = colours[i][1];
+		light.tint[2] = colours[i][2];
+
+		float depth = -(modelview[2] * positions[i].x + modelview[6] * positions[i].y + modelview[10] * positions[i].z + modelview[14]);
+		if (i == 0 || depth < nearestDepth)
+		{
+			nearest = i;
+			nearestDepth = depth;
+		}
+	}
 
-	// Render rail 2
+	// One level for the batch, fine enough for the nearest sphere.
 	glPushMatrix();
-	glTranslatef(-10.f, 10.99f, -5.5f);
-	shape.renderTramRail(hazardTexture, hazardTexture);
+	glMultMatrixf(lightInstances[nearest].transform);
+	lightSphereLod = shape.selectLod(Shape::Sphere, shape.screenRadius(Shape::Sphere), lightSphereLod, shapePixelError);
 	glPopMatrix();
 
-	// Render rail 3
-	glPushMatrix();
-	glTranslatef(-30.f, 10.99f, -5.5f);
-	shape.renderTramRail(hazardTexture, hazardTexture);
-	glPopMatrix();
+	// The transforms scale the unit sphere, renormalise so the spheres light as gluSphere's did.
+	GLState::pushAttrib(GL_ENABLE_BIT | GL_CURRENT_BIT);
+	GLState::enable(GL_NORMALIZE);
+	shape.renderSphere(lightSphereLod, lightInstances, lightCount);
+	GLState::popAttrib();
+}
 
-	// Render rail 4
-	glPushMatrix();
-	glTranslatef(-50.f, 10.99f, -5.5f);
-	shape.renderTramRail(hazardTexture, hazardTexture);
-	glPopMatrix();
+// Queues the trams rail.
+void Scene::renderRail(Pass pass)
+{
+	queue.submit(pass, false, NULL, white, &railBounds, [this]() { shape.renderTramRail(hazardTexture, hazardTexture, railInstances, 5); });
 }
 
 // Renders the tram.
@@ -1021,185 +1275,128 @@ void Scene::renderTram()
 {
 	// Render tram
 	glPushMatrix();
-	glColor3f(1.f, 1.f, 1.f);
+	GLState::colour(1.f, 1.f, 1.f);
 	glTranslatef(tramX, 2.965f, -5.0f);
 	glRotatef(90.f, 0.f, 1.f, 0.f);
-	glColor3f(1.0f, 1.0f, 1.0f);
-	tram.render();
+	GLState::colour(1.0f, 1.0f, 1.0f);
+	tram.render(chooseLod(tram, tramLod));
 	glPopMatrix();
 }
 
-// Renders the door.
-void Scene::renderDoor()
+// Picks a level of detail from the model's projected size, see Model::selectLod.
+int Scene::chooseLod(const Model& model, int& current, int bias)
 {
-	// Door Top
-	glPushMatrix();
-	glTranslatef(-12.f, topDoorY, -36.05f);
-	glScalef(1.2f, 6.0f, 1.0f);
-	shape.renderTramRail(doorTopTexture, doorTopTextureFlipped);
-	glPopMatrix();
-
-	// Door Bottom
-	glPushMatrix();
-	glTranslatef(-12.f, bottomDoorY, -36.05f);
-	glScalef(1.2f, 6.0f, 1.0f);
-	shape.renderTramRail(doorBottomTexture, doorBottomTextureFlipped);
-	glPopMatrix();
+	current = model.selectLod(model.screenSize(), current);
+	return current + bias;
 }
 
-// Renders the room behind the door.
-void Scene::renderDoorRoom()
+// Picks the round shape's level of detail from its size on screen, see Shape::selectLod.
+int Scene::chooseLod(Shape::Round round, int& current, int bias)
 {
-	// Render Door room
-	glPushMatrix();
-	glTranslatef(12.f, 0.f, -55.f);
-	glRotatef(-90.f, 0.f, 1.f, 0.f);
-	glScalef(1.0f, 12.0f, 24.0f);
-	shape.renderTramDock(wallTexture);
-	glPopMatrix(); 
+	current = shape.selectLod(round, shape.screenRadius(round), current, shapePixelError);
+	return current + bias;
 }
 
-// Renders the walkway.
-void Scene::renderWalkway()
+// Queues the door.
+void Scene::renderDoor(Pass pass, const GLfloat* colour)
 {
-	glEnable(GL_BLEND);
-	// Render walkway part 1
+	// Door Top
 	glPushMatrix();
-	glTranslatef(-18.0f, 0.0f, -35.0f);
-	glRotatef(90.f, 1.f, 0.f, 0.f);
-	glScalef(1.8f, 1.0f, 1.0f);
-	shape.renderPlane(grateTexture);
+	glTranslatef(-12.f, topDoorY, -36.05f);
+	glScalef(1.2f, 6.0f, 1.0f);
+	queue.submit(pass, false, NULL, colour, &shape.tramRailBounds(), [this]() { shape.renderTramRailAtlas(doorTopAtlas); });
 	glPopMatrix();
 
-	// Render walkway part 2
+	// Door Bottom
 	glPushMatrix();
-	glTranslatef(-12.0f, 0.0f, -25.0f);
-	glRotatef(90.f, 1.f, 0.f, 0.f);
-	glScalef(1.2f, 1.75f, 1.0f);
-	shape.renderPlane(grateTexture);
+	glTranslatef(-12.f, bottomDoorY, -36.05f);
+	glScalef(1.2f, 6.0f, 1.0f);
+	queue.submit(pass, false, NULL, colour, &shape.tramRailBounds(), [this]() { shape.renderTramRailAtlas(doorBottomAtlas); });
 	glPopMatrix();
-	glDisable(GL_BLEND);
 }
 
-// Renders the left tram dock.
-void Scene::renderLeftDock()
+// Queues the room behind the door, its parts culled as it's drawn.
+void Scene::renderDoorRoom(Pass pass, const GLfloat* colour)
 {
-	// Render left room
-	glPushMatrix();
-		glTranslatef(-50.f, 0.f, -17.0f);
-		glScalef(1.0f, 12.0f, 24.0f);
-		shape.renderTramDock(wallTexture);
-		glPushMatrix();
-			glScalef(1.0f, 0.1f, 0.05f);
-			glRotatef(-90.f, 0.f, 1.f, 0.f);
-			shape.renderPlane(wallTexture);
-		glPopMatrix();
-	glPopMatrix();
+	queue.submit(pass, false, NULL, colour, &doorRoomBatch.bounds(), [this]() { doorRoomBatch.render(&queue.frustum()); });
 }
 
-// Renders the right tram dock.
-void Scene::renderRightDock()
+// Queues the walkway, it's see through so is blended.
+void Scene::renderWalkway(Pass pass)
 {
-	// Render right room
-	glPushMatrix();
-		glTranslatef(30.f, 0.f, -17.0f);
-		glScalef(1.0f, 12.0f, 24.0f);
-		shape.renderTramDock(wallTexture);
-		glPushMatrix();
-			glTranslatef(20.f, 0.f, 1.f);
-			glRotatef(-270.f, 0.f, 1.f, 0.f);
-			glScalef(0.05f, 0.1f, 1.f);
-			shape.renderPlane(wallTexture);
-		glPopMatrix();
-	glPopMatrix();
+	queue.submit(pass, true, NULL, white, &walkwayBatch.bounds(), [this]() { walkwayBatch.render(&queue.frustum()); });
 }
 
-// Renders the walls and floor of the scene.
+// Queues the walls and floor of the scene, and the docks, their parts culled as they're drawn.
 void Scene::renderEnclosure()
 {
-	// Render bottom plane
-	glPushMatrix();
-		glColor3f(0.f, 0.f, 0.f);
-		glTranslatef(-30.0f, -30.0f, -35.0f);
-		glRotatef(90.f, 1.f, 0.f, 0.f);
-		glScalef(3.0f, 6.0f, 1.0f);
-		shape.renderPlane(NULL);
-	glPopMatrix();
-
-	// Render back wall
-	glPushMatrix();
-		glColor3f(0.6f, 0.6f, 0.6f);
-		glTranslatef(-30.0f, -30.0f, -35.0f);
-		glScalef(3.0f, 6.0f, 1.0f);
-		shape.renderWall(wallTexture);
-	glPopMatrix();
-
-	// Render left wall
-	glPushMatrix();
-		glColor3f(0.6f, 0.6f, 0.6f);
-		glTranslatef(-30.0f, -30.0f, 25.0f);
-		glRotatef(90.f, 0.f, 1.f, 0.f);
-		glScalef(3.0f, 6.0f, 1.0f);
-		shape.renderWall(wallTexture);
-	glPopMatrix();
-
-	// Render right wall
-	glPushMatrix();
-		glColor3f(0.6f, 0.6f, 0.6f);
-		glTranslatef(30.0f, -30.0f, -35.f);
-		glRotatef(270.f, 0.f, 1.f, 0.f);
-		glScalef(3.0f, 6.0f, 1.0f);
-		shape.renderWall(wallTexture);
-	glPopMatrix();
+	queue.submit(ScenePass, false, NULL, white, &sceneryBatch.bounds(), [this]() { sceneryBatch.render(&queue.frustum()); });
 }
 
-// Renders the cylinders, discs and torus's in front of the door (which resemble door locks).
-void Scene::renderDoorLocks()
+// Queues the cylinders, discs and torus's in front of the door (which resemble door locks).
+// Each part is its own packet, culled and tessellated for its size on screen.
+void Scene::renderDoorLocks(Pass pass, int* lods, int bias)
 {
-	specularMaterials();
-
-	glBindTexture(GL_TEXTURE_2D, NULL);
-	
-	glColor3f(1.0f, 1.0f, 1.0f);
 	glPushMatrix();
 		glTranslatef(doorLock2X - 12.f, 2.f, -34.f);
 		glRotatef(90.f, 0.f, 1.f, 0.f);
-		shape.renderCylinder();
+		renderDoorLockPart(pass, Shape::Cylinder, &lods[0], bias);
 		glPushMatrix();
 			glTranslatef(0.325f, -1.f, -doorLock2X - 23.f);
 			glRotatef(90.f, 0.f, 1.f, 0.f);
 			glRotatef(angle2, 0.f, 0.f, 1.f);
-			shape.renderDisc();
+			renderDoorLockPart(pass, Shape::Disc, &lods[1], bias);
 			glPushMatrix();
 				glTranslatef(0.f, 0.f, -0.325f);
 				glRotatef(angle2, 0.f, 0.f, 1.f);
-				shape.renderTorus();
+				renderDoorLockPart(pass, Shape::Torus, &lods[2], bias);
 			glPopMatrix();
 			glTranslatef(0.f, 0.f, -0.65f);
-			shape.renderDisc();
+			renderDoorLockPart(pass, Shape::Disc, &lods[3], bias);
 		glPopMatrix();
 	glPopMatrix();
 
 	glPushMatrix();
 		glTranslatef(doorLockX - 12.f, 10.f, -34.f);
 		glRotatef(90.f, 0.f, 1.f, 0.f);
-		shape.renderCylinder();
+		renderDoorLockPart(pass, Shape::Cylinder, &lods[4], bias);
 		glPushMatrix();
 			glTranslatef(0.325f, 1.f, -doorLockX - 1.f);
 			glRotatef(90.f, 0.f, 1.f, 0.f);
 			glRotatef(angle2, 0.f, 0.f, 1.f);
-			shape.renderDisc();
+			renderDoorLockPart(pass, Shape::Disc, &lods[5], bias);
 				glPushMatrix();
 					glTranslatef(0.f, 0.f, -0.325f);
 					glRotatef(angle2, 0.f, 0.f, 1.f);
-					shape.renderTorus();
+					renderDoorLockPart(pass, Shape::Torus, &lods[6], bias);
 				glPopMatrix();
 			glTranslatef(0.f, 0.f, -0.65f);
-			shape.renderDisc();
+			renderDoorLockPart(pass, Shape::Disc, &lods[7], bias);
 		glPopMatrix();
 	glPopMatrix();
 }
 
+// Queues one round part of a door lock under the current modelview, lod is the level it used last frame.
+void Scene::renderDoorLockPart(Pass pass, Shape::Round round, int* lod, int bias)
+{
+	queue.submit(pass, false, &noTexture, white, &shape.bounds(round), [this, round, lod, bias]()
+	{
+		int level = chooseLod(round, *lod, bias);
+		switch (round)
+		{
+		case Shape::Disc:
+			shape.renderDisc(level);
+			break;
+		case Shape::Cylinder:
+			shape.renderCylinder(level);
+			break;
+		default:
+			shape.renderTorus(level);
+			break;
+		}
+	});
+}
+
 // Calculates FPS.
 void Scene::calculateFPS()
 {
@@ -1224,6 +1421,33 @@ void Scene::renderTextOutput()
 	displayText(-1.f, 0.84f, 1.f, 1.f, 1.f, textureText);
 	sprintf_s(cameraText, "Selected Camera: %s", selectedCamera.c_str());
 	displayText(-1.f, 0.78f, 1.f, 1.f, 1.f, cameraText);
+	TextureCache& textures = TextureCache::shared();
+	sprintf_s(textureMemoryText, "Textures: %i (%.1f MB)", textures.size(), textures.memoryUsage() / (1024.f * 1024.f));
+	displayText(-1.f, 0.72f, 1.f, 1.f, 1.f, textureMemoryText);
+	sprintf_s(vertexBufferText, "Vertex Data: %s (%.1f MB)", VertexBuffer::useBuffers && GLExtensions::vertexBuffers ? "VBO" : "Client Arrays",
+		VertexBuffer::totalMemoryUsage() / (1024.f * 1024.f));
+	displayText(-1.f, 0.66f, 1.f, 1.f, 1.f, vertexBufferText);
+	sprintf_s(lodText, "LOD: Tram %i/%i, Crowbar %i/%i, Locks %i/%i segments", tramLod, tram.lodCount(), crowbarLod, crowbar.lodCount(),
+		shape.lodSegments(Shape::Cylinder, doorLockLods[0]), shape.lodSegments(Shape::Cylinder, 0));
+	displayText(-1.f, 0.60f, 1.f, 1.f, 1.f, lodText);
+	sprintf_s(instancingText, "Instancing: %s (%i draws, %i copies)", Instancing::hardware() ? "GPU" : "Loop",
+		Instancing::drawCalls(), Instancing::instancesDrawn());
+	displayText(-1.f, 0.54f, 1.f, 1.f, 1.f, instancingText);
+	sprintf_s(staticBatchText, "Static Batches: %i draws, %i quads", sceneryBatch.drawCalls() + doorRoomBatch.drawCalls() + walkwayBatch.drawCalls(),
+		sceneryBatch.quadCount() + doorRoomBatch.quadCount() + walkwayBatch.quadCount());
+	displayText(-1.f, 0.48f, 1.f, 1.f, 1.f, staticBatchText);
+	sprintf_s(renderQueueText, "Render Queue: %i packets in %i passes", queue.packetCount(), queue.passCount());
+	displayText(-1.f, 0.42f, 1.f, 1.f, 1.f, renderQueueText);
+	sprintf_s(stateText, "GL State: %s (%i issued, %i elided)", GLState::useCache ? "Cached" : "Uncached", GLState::issued(), GLState::elided());
+	displayText(-1.f, 0.36f, 1.f, 1.f, 1.f, stateText);
+	sprintf_s(cullingText, "Culling: %s, %i drawn, %i culled (batch parts %i drawn, %i culled)", BoundsArray::name(BoundsArray::kernel()),
+		queue.packetCount(), queue.culledCount(), StaticBatch::partsDrawn(), StaticBatch::partsCulled());
+	displayText(-1.f, 0.30f, 1.f, 1.f, 1.f, cullingText);
+	if (assets.pending() > 0)
+	{
+		sprintf_s(loadingText, "Loading: %i assets", assets.pending());
+		displayText(-1.f, 0.24f, 1.f, 1.f, 1.f, loadingText);
+	}
 }
 
 // Renders text to screen. Must be called last in render function (before swap buffers)
@@ -1241,14 +1465,14 @@ void Scene::displayText(float x, float y, float r, float g, float b, char* strin
 	gluLookAt(0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
 
 	// Set text colour and position.
-	glColor3f(r, g, b);
+	GLState::colour(r, g, b);
 	glRasterPos2f(x, y);
 	// Render text.
 	for (int i = 0; i < j; i++) {
 		glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, string[i]);
 	}
 	// Reset colour to white.
-	glColor3f(1.f, 1.f, 1.f);
+	GLState::colour(1.f, 1.f, 1.f);
 
 	// Swap back to 3D rendering.
 	glMatrixMode(GL_PROJECTION);
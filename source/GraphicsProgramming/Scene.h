@@ -15,10 +15,18 @@
 // Further includes should go here:
 #include "SOIL.h"
 #include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
 #include "Camera.h"
 #include "Shape.h"
 #include "Model.h"
 #include "Shadow.h"
+#include "AssetLoader.h"
+#include "GLExtensions.h"
+#include "RenderQueue.h"
+#include "GLState.h"
+#include "BoundsArray.h"
 
 class Scene{
 
@@ -59,32 +67,61 @@ protected:
 	void wireframeMode();
 	// Allows the user to switch between texture filtering modes.
 	void texFilterMode();
-	// Render chosen scene.
+	// Allows the user to switch between vertex buffer objects and client side arrays.
+	void vertexBufferMode();
+	// Allows the user to switch between hardware instancing and a loop of draws.
+	void instancingMode();
+	// Allows the user to switch GLState's cache of redundant state changes off and on.
+	void stateCacheMode();
+	// Allows the user to switch between the culling kernels the CPU supports.
+	void cullingKernelMode();
+	// Shows or hides a sphere at each light.
+	void lightSpheresMode();
+	// Passes of the render queue, run in this order. The mirror and the wall the shadow falls on are written into the
+	// stencil buffer first, then what's seen in them is drawn inside.
+	enum Pass { ScenePass, ReflectionMaskPass, ReflectedPass, MirrorPass, RealPass, ShadowMaskPass, ShadowPass, ShadowCasterPass };
+
+	// Gives each pass its state.
+	void renderQueueSetup();
+	// Captures the transforms of the repeated rails.
+	void instanceSetup();
+	// Bakes the static scenery into world space batches.
+	void staticBatchSetup();
+	// Benchmarks the tram's vertex formats.
+	void vertexFormatBenchmark();
+	// Benchmarks the culling kernels.
+	void cullingBenchmark();
+	// Queues the scene and draws it.
 	void renderScene();
 	// Move tram.
 	void tramMovement(float dt);
 	// Open/Close door.
 	void doorControls(float dt);
-	// Renders the lights spheres.
+	// Queues a sphere at each light, when shown.
 	void renderLightSpheres();
-	// Renders the entire tram rail.
-	void renderRail();
+	void drawLightSpheres();
+	// Queues the entire tram rail.
+	void renderRail(Pass pass);
 	// Renders the tram.
 	void renderTram();
-	// Renders the door.
-	void renderDoor();
-	// Renders the door room.
-	void renderDoorRoom();
-	// Renders the walkway.
-	void renderWalkway();
-	// Renders the left dock.
-	void renderLeftDock();
-	// Renders the right dock.
-	void renderRightDock();
-	// Renders the walls/floor.
+	// Picks the model's level of detail from its size on screen under the current matrices.
+	// current is the level this draw used last frame and is updated, bias asks for that many levels coarser.
+	int chooseLod(const Model& model, int& current, int bias = 0);
+	// The same for one of shape's round shapes, see Shape::selectLod.
+	int chooseLod(Shape::Round round, int& current, int bias = 0);
+	// Queues the door, drawn in colour.
+	void renderDoor(Pass pass, const GLfloat* colour);
+	// Queues the door room, drawn in colour.
+	void renderDoorRoom(Pass pass, const GLfloat* colour);
+	// Queues the walkway.
+	void renderWalkway(Pass pass);
+	// Queues the walls/floor and docks.
 	void renderEnclosure();
-	// Renders the door locks.
-	void renderDoorLocks();
+	// Queues the door locks. lods is the level each part used last frame, see doorLockLods.
+	void renderDoorLocks(Pass pass, int* lods, int bias = 0);
+	void renderDoorLockPart(Pass pass, Shape::Round round, int* lod, int bias);
+	// Queues the objects seen in the mirror.
+	void renderReflection();
 	// Planar Shadow
 	void planarShadow();
 	// Stencil Buffer example
@@ -103,6 +140,15 @@ protected:
 	char mouseText[40];
 	char textureText[40];
 	char cameraText[40];
+	char loadingText[40];
+	char textureMemoryText[40];
+	char vertexBufferText[40];
+	char lodText[80];
+	char instancingText[64];
+	char staticBatchText[64];
+	char renderQueueText[64];
+	char stateText[64];
+	char cullingText[96];
 	string selectedTexMode, selectedCamera;
 
 	//variables
@@ -111,10 +157,38 @@ protected:
 	float angle = 0.0f, angle2 = 0.0f;
 	bool wireframe = false;
 	float shadowMatrixArray[16];
-	GLuint doorTopTexture, doorTopTextureFlipped, doorBottomTexture, doorBottomTextureFlipped, grateTexture, hazardTexture, wallTexture;
+	GLuint doorTopAtlas, doorBottomAtlas, grateTexture, hazardTexture, wallTexture;
 	Camera freeCamera, tramCamera, doorCamera, *cameraPointer;
 	Shape shape;
+	// Placement of each rail, drawn with one instanced call per face, see Instancing.
+	Instancing::Instance railInstances[5];
+	// Box round every rail, for culling them together.
+	Bounds railBounds;
+	// Scenery that never moves, merged per texture. The door room and walkway are drawn again reflected so are kept apart
+	// and drawn under the caller's matrix and colour.
+	StaticBatch sceneryBatch, doorRoomBatch, walkwayBatch;
 	Model tram, crowbar;
+	// Level of detail each model draw used last frame, kept apart so each has its own hysteresis.
+	int tramLod = 0, reflectedTramLod = 0, crowbarLod = 0, reflectedCrowbarLod = 0;
+	// Levels coarser the reflection and planar shadow are drawn, they're seen through a tinted floor or flattened.
+	int reflectionLodBias = 1, shadowLodBias = 2;
+	// Level each door lock part used last frame, cylinder, disc, torus and disc per lock, for the real and reflected locks.
+	int doorLockLods[8] = { 0 }, reflectedDoorLockLods[8] = { 0 };
+	// Silhouette error in pixels allowed the round shapes' tessellation.
+	float shapePixelError = 0.5f;
+	// A sphere per light, drawn in one instanced call when shown, and the level of detail it used last frame.
+	Instancing::Instance lightInstances[7];
+	bool showLightSpheres = false;
+	int lightSphereLod = 0;
+	// The frame's draws, sorted by pass, blending, texture and depth before they're run.
+	RenderQueue queue;
+	// Texture slot for packets drawn untextured.
+	GLuint noTexture = 0;
+	// Colours packets are drawn in, the mirror's tint is translucent.
+	const GLfloat white[4] = { 1.f, 1.f, 1.f, 1.f };
+	const GLfloat mirrorColour[4] = { 0.4f, 0.4f, 0.5f, 0.8f };
+	// Declared after the models so its workers are stopped before they're destroyed.
+	AssetLoader assets;
 	Shadow shadowMatrix;
 	Vector3 doorLight1Pos, doorLight2Pos, tramLight1Pos, tramLight2Pos, dockLight1Pos, dockLight2Pos;
 	GLfloat sceneLightPosition[3] = { 0,0,0 };
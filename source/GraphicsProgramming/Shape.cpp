@@ -1,6 +1,15 @@
 #include "shape.h"
+#include "GLState.h"
+#include <algorithm>
 #define PI 3.14159265
 
+// Segments round each level of a round shape, as a fraction of the full level's.
+static const float lodScales[Shape::lodCount] = { 1.0f, 0.75f, 0.5f, 0.375f, 0.25f };
+// Fewest segments a level may have.
+static const int lodMinimumSegments = 6;
+// Fraction either side of the pixel tolerance a level has to be before selectLod switches to or from it, as Model's.
+static const float lodHysteresis = 0.25f;
+
 // Vertex array to allow rendering of a cube.
 extern float cubeVerts[] = {	-1.0, -1.0, -1.0,			// Vertex #0
 							1.0, -1.0, -1.0,		// Vertex #1
@@ -40,6 +49,17 @@ extern GLubyte cubeIndices[] = { 1, 0, 2,		//front
 							1, 0, 5,		//down
 							5, 0, 4};
 
+// Starts with no shapes, each is drawn once generated or set.
+Shape::Shape() : cylinderSeg(0)
+{
+	ShapeArrays none = { NULL, NULL, NULL, NULL, 0, 0, 0.0f, 0.0f };
+	discArrays = sphereArrays = cylinderArrays = torusArrays = tramRailArrays = wallArrays = cuboidArrays = none;
+	for (int shape = 0; shape < RoundCount; shape++)
+	{
+		clearLevels((Round)shape);
+	}
+}
+
 // Render function utilising dereferencing of single array elements.
 void Shape::render1()
 {
@@ -64,78 +84,54 @@ void Shape::render1()
 }
 
 // Renders, textures and allows lighting of a disc.
-void Shape::renderDisc()
+void Shape::renderDisc(int lod)
 {
-	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
-	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ord arrays
+	const VertexBuffer* buffer;
+	const ShapeArrays& arrays = roundLevel(Disc, lod, buffer);
+	buffer->bind();					// Enable and point the arrays at the shape's data
 
-	glVertexPointer(3, GL_FLOAT, 0, discVertex.data());				// Pointer to vertex array
-	glNormalPointer(GL_FLOAT, 0, discNormals.data());				// Pointer to normals array
-	glTexCoordPointer(2, GL_FLOAT, 0, discTexCoords.data());		// Pointer to texture co-ords array
+	glDrawArrays(GL_TRIANGLE_FAN, 0, arrays.vertexCount);
 
-	glDrawArrays(GL_TRIANGLE_FAN, 0, discVertex.size());
-
-	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
-	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+	buffer->unbind();					// Disable the arrays
 }
 
 // Renders, textures and allows lighting of a sphere.
-void Shape::renderSphere()
+void Shape::renderSphere(int lod)
 {
-	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
-	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ord arrays
-
-	glVertexPointer(3, GL_FLOAT, 0, sphereVertex.data());			// Pointer to vertex array
-	glNormalPointer(GL_FLOAT, 0, sphereNormals.data());				// Pointer to normals array
-	glTexCoordPointer(2, GL_FLOAT, 0, sphereTexCoords.data());		// Pointer to texture co-ords array
+	const VertexBuffer* buffer;
+	const ShapeArrays& arrays = roundLevel(Sphere, lod, buffer);
+	buffer->bind();					// Enable and point the arrays at the shape's data
 
-	glDrawArrays(GL_QUADS, 0, sphereVertex.size());
+	glDrawElements(GL_TRIANGLES, arrays.indexCount, GL_UNSIGNED_INT, buffer->indices(0));
 
-	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
-	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+	buffer->unbind();					// Disable the arrays
 }
 
 // Renders, textures and allows lighting of a cylinder.
-void Shape::renderCylinder()
+void Shape::renderCylinder(int lod)
 {
-	renderDisc();										// Add disc to front of cylinder
-	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
-	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ord arrays
-
-	glVertexPointer(3, GL_FLOAT, 0, cylinderVertex.data());				// Pointer to vertex array
-	glNormalPointer(GL_FLOAT, 0, cylinderNormals.data());				// Pointer to normals array
-	glTexCoordPointer(2, GL_FLOAT, 0, cylinderTexCoords.data());		// Pointer to texture co-ords array
+	renderDisc(lod);									// Add disc to front of cylinder
+	const VertexBuffer* buffer;
+	const ShapeArrays& arrays = roundLevel(Cylinder, lod, buffer);
+	buffer->bind();					// Enable and point the arrays at the shape's data
 
-	glDrawArrays(GL_QUADS, 0, cylinderVertex.size());
+	glDrawElements(GL_TRIANGLES, arrays.indexCount, GL_UNSIGNED_INT, buffer->indices(0));
 
-	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
-	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+	buffer->unbind();					// Disable the arrays
 	glTranslatef(0, 0, cylinderSeg);					// Add disc to end of cylinder
-	renderDisc();
+	renderDisc(lod);
 }
 
 // Renders, textures and allows lighting of a torus.
-void Shape::renderTorus()
+void Shape::renderTorus(int lod)
 {
-	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
-	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ord arrays
+	const VertexBuffer* buffer;
+	const ShapeArrays& arrays = roundLevel(Torus, lod, buffer);
+	buffer->bind();					// Enable and point the arrays at the shape's data
 
-	glVertexPointer(3, GL_FLOAT, 0, torusVertex.data());			// Pointer to vertex array
-	glNormalPointer(GL_FLOAT, 0, torusNormals.data());				// Pointer to normals array
-	glTexCoordPointer(2, GL_FLOAT, 0, torusTexCoords.data());		// Pointer to texture co-ords array
+	glDrawElements(GL_TRIANGLES, arrays.indexCount, GL_UNSIGNED_INT, buffer->indices(0));
 
-	glDrawArrays(GL_QUADS, 0, torusVertex.size());
-
-	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
-	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+	buffer->unbind();					// Disable the arrays
 }
 
 // Render function utilising dereferencing of all array elements and implementation of an index array.
@@ -157,564 +153,434 @@ void Shape::render3()
 }
 
 // Renders, textures and allows lighting of a tram rail.
+// The back and bottom faces use texture2, the front and top texture. When they differ each pair of faces is its own draw,
+// see renderTramRailAtlas for one draw.
 void Shape::renderTramRail(GLuint texture, GLuint texture2)
 {
-	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
-	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ord arrays
-
-	glVertexPointer(3, GL_FLOAT, 0, tramRailVertex.data());				// Pointer to vertex array
-	glNormalPointer(GL_FLOAT, 0, tramRailNormals.data());				// Pointer to normals array
-	glTexCoordPointer(2, GL_FLOAT, 0, tramRailTexCoords.data());		// Pointer to texture co-ords array
-
-	// Essentially the same as renderPlane although with the rotations and limitations on the Vertex data,
-	// It folds the plan over and restricts rendering of only a cuboid.
-	glPushMatrix();
-	glBindTexture(GL_TEXTURE_2D, texture2);
-	glScalef(1.0f, 0.1f, 0.1f);
-	glDrawArrays(GL_QUADS, 0, tramRailVertex.size());	// Back face/Face 1
-	glRotatef(90, 1, 0, 0);
-	glBindTexture(GL_TEXTURE_2D, texture2);
-	glDrawArrays(GL_QUADS, 0, tramRailVertex.size());	// Bottom face/Face 2
-	glTranslatef(0, 10, -10);
-	glRotatef(90, 1, 0, 0);
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glDrawArrays(GL_QUADS, 0, tramRailVertex.size());	// Front face/Face 3
-	glRotatef(90, 1, 0, 0);
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glDrawArrays(GL_QUADS, 0, tramRailVertex.size());	// Top face/Face 4
-	glPopMatrix();
+	cuboidBuffer.bind();					// Enable and point the arrays at the shape's data
+	int half = cuboidArrays.vertexCount / 2;
+	GLState::bindTexture(texture2);
+	glDrawArrays(GL_QUADS, 0, texture == texture2 ? cuboidArrays.vertexCount : half);
+	if (texture != texture2)
+	{
+		GLState::bindTexture(texture);
+		glDrawArrays(GL_QUADS, half, half);
+	}
+	cuboidBuffer.unbind();					// Disable the arrays
+}
 
-	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
-	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+// Renders, textures and allows lighting of a tram rail in one draw, with an atlas from AssetLoader::loadAtlas holding
+// the back and bottom texture in its left half and the front and top in its right.
+void Shape::renderTramRailAtlas(GLuint atlas)
+{
+	cuboidAtlasBuffer.bind();				// Enable and point the arrays at the shape's data
+	GLState::bindTexture(atlas);
+	glDrawArrays(GL_QUADS, 0, cuboidArrays.vertexCount);
+	cuboidAtlasBuffer.unbind();				// Disable the arrays
 }
 
 // Renders, textures and allows lighting of a tram dock.
 void Shape::renderTramDock(GLuint texture)
 {
-	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
-	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ord arrays
-
-	glVertexPointer(3, GL_FLOAT, 0, tramRailVertex.data());				// Pointer to vertex array
-	glNormalPointer(GL_FLOAT, 0, tramRailNormals.data());				// Pointer to normals array
-	glTexCoordPointer(2, GL_FLOAT, 0, tramRailTexCoords.data());		// Pointer to texture co-ords array
+	renderTramRail(texture, texture);
+}
 
-	// Essentially the same as renderTramRail although implemented as only uses one texture.
-	glPushMatrix();
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glScalef(1.0f, 0.1f, 0.1f);
-	glDrawArrays(GL_QUADS, 0, tramRailVertex.size());	// Back face/Face 1
-	glRotatef(90, 1, 0, 0);
-	
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glDrawArrays(GL_QUADS, 0, tramRailVertex.size());	// Bottom face/Face 2
-	glTranslatef(0, 10, -10);
-	glRotatef(90, 1, 0, 0);
-	
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glDrawArrays(GL_QUADS, 0, tramRailVertex.size());	// Front face/Face 3
-	glRotatef(90, 1, 0, 0);
-	glBindTexture(GL_TEXTURE_2D, texture);
-	
-	glDrawArrays(GL_QUADS, 0, tramRailVertex.size());	// Top face/ Face 4
-	glPopMatrix();
+// Renders a tram rail per instance.
+void Shape::renderTramRail(GLuint texture, GLuint texture2, const Instancing::Instance* instances, int instanceCount)
+{
+	cuboidBuffer.bind();					// Enable and point the arrays at the shape's data
+	int half = cuboidArrays.vertexCount / 2;
+	Instancing::begin(instances, instanceCount);
+	GLState::bindTexture(texture2);
+	Instancing::drawArrays(GL_QUADS, 0, texture == texture2 ? cuboidArrays.vertexCount : half);
+	if (texture != texture2)
+	{
+		GLState::bindTexture(texture);
+		Instancing::drawArrays(GL_QUADS, half, half);
+	}
+	Instancing::end();
+	cuboidBuffer.unbind();					// Disable the arrays
+}
 
-	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
-	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+// Renders a tram dock per instance.
+void Shape::renderTramDock(GLuint texture, const Instancing::Instance* instances, int instanceCount)
+{
+	renderTramRail(texture, texture, instances, instanceCount);
 }
 
 // Renders, textures and allows lighting of a flat plane.
 void Shape::renderPlane(GLuint texture)
 {
-	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
-	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ord arrays
-
-	glVertexPointer(3, GL_FLOAT, 0, tramRailVertex.data());				// Pointer to vertex array
-	glNormalPointer(GL_FLOAT, 0, tramRailNormals.data());				// Pointer to normals array
-	glTexCoordPointer(2, GL_FLOAT, 0, tramRailTexCoords.data());		// Pointer to texture co-ords array
+	tramRailBuffer.bind();					// Enable and point the arrays at the shape's data
 
 	glPushMatrix();
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glDrawArrays(GL_QUADS, 0, tramRailVertex.size());
+	GLState::bindTexture(texture);
+	glDrawArrays(GL_QUADS, 0, tramRailArrays.vertexCount);
 	glPopMatrix();
 
-	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
-	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+	tramRailBuffer.unbind();					// Disable the arrays
 }
 
 // Renders, textures and allows lighting of a wall with a hole in it.
 void Shape::renderWall(GLuint texture)
 {
-	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
-	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ord arrays
-
-	glVertexPointer(3, GL_FLOAT, 0, wallVertex.data());				// Pointer to vertex array
-	glNormalPointer(GL_FLOAT, 0, wallNormals.data());				// Pointer to normals array
-	glTexCoordPointer(2, GL_FLOAT, 0, wallTexCoords.data());		// Pointer to texture co-ords array
+	wallBuffer.bind();					// Enable and point the arrays at the shape's data
 
 	glPushMatrix();
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glDrawArrays(GL_QUADS, 0, wallVertex.size());
+	GLState::bindTexture(texture);
+	glDrawArrays(GL_QUADS, 0, wallArrays.vertexCount);
 	glPopMatrix();
 
-	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
-	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+	wallBuffer.unbind();					// Disable the arrays
 }
 
-// Generates all vertex's, normals and texture coordinates required to render a disc.
-void Shape::genDiscData(float radius, float segments)
+// Adds a tram rail to a batch, as one part per texture.
+void Shape::batchTramRail(StaticBatch& batch, const GLuint* texture, const GLuint* texture2, const GLfloat* colour)
 {
-	float r = radius;
-	float d = 2 * r;
-
-	Vector3 dVerts;	// Central point of disc
-	discVertex.push_back(dVerts);
-	discTexCoords.push_back(0.5);	// Tex Co-ord in centre of disc - U
-	discTexCoords.push_back(0.5);	// Tex Co-ord in centre of disc - V
-	Vector3 dNorms = Vector3(0, 0, 1); // Normal in positive Z
-	discNormals.push_back(dNorms);
-
-	for (int i = 0; i < segments + 1; i++)
+	GLfloat matrix[16];
+	glGetFloatv(GL_MODELVIEW_MATRIX, matrix);
+	const ShapeArrays& cuboid = cuboidArrays;
+	if (texture == texture2)
 	{
-		float theta = (i*(2 * PI)) / (segments);
-		dVerts.x = r*cos(theta);
-		dVerts.y = r*sin(theta);
-		dVerts.z = 0;
-		discVertex.push_back(dVerts);
-
-		float u = (cos(theta) / d) + 0.5;	// Tex Co-ord - U
-		float v = (sin(theta) / d) + 0.5;	// Tex Co-ord - V
-		discTexCoords.push_back(u);
-		discTexCoords.push_back(v);
-
-		Vector3 dNorms = Vector3(0, 0, 1); // Normal in positive Z
-		discNormals.push_back(dNorms);
+		batch.add(matrix, cuboid.vertex, cuboid.normals, cuboid.texCoords, cuboid.vertexCount, texture, colour);
+		return;
 	}
+	// Back and bottom faces first, then front and top.
+	int half = cuboid.vertexCount / 2;
+	batch.add(matrix, cuboid.vertex, cuboid.normals, cuboid.texCoords, half, texture2, colour);
+	batch.add(matrix, cuboid.vertex + half * 3, cuboid.normals + half * 3, cuboid.texCoords + half * 2, cuboid.vertexCount - half, texture, colour);
 }
 
-// Generates all vertex's, normals and texture coordinates required to render a sphere.
-void Shape::genSphereData(float radius, float segments)
+// Adds a tram dock to a batch.
+void Shape::batchTramDock(StaticBatch& batch, const GLuint* texture, const GLfloat* colour)
+{
+	batchTramRail(batch, texture, texture, colour);
+}
+
+// Adds a flat plane to a batch.
+void Shape::batchPlane(StaticBatch& batch, const GLuint* texture, const GLfloat* colour)
 {
-	float r = radius;
-	float d = 2 * r;
+	GLfloat matrix[16];
+	glGetFloatv(GL_MODELVIEW_MATRIX, matrix);
+	batch.add(matrix, tramRailArrays.vertex, tramRailArrays.normals, tramRailArrays.texCoords, tramRailArrays.vertexCount, texture, colour);
+}
 
-	Vector3 sVerts;
-	Vector3 sNorms;
+// Adds a wall with a hole in it to a batch.
+void Shape::batchWall(StaticBatch& batch, const GLuint* texture, const GLfloat* colour)
+{
+	GLfloat matrix[16];
+	glGetFloatv(GL_MODELVIEW_MATRIX, matrix);
+	batch.add(matrix, wallArrays.vertex, wallArrays.normals, wallArrays.texCoords, wallArrays.vertexCount, texture, colour);
+}
 
-	for (int lon = 0; lon < segments; lon++)
-	{
-		float delta = (lon*PI) / (segments);			// Angle of longitude
+// Renders a flat plane per instance.
+void Shape::renderPlane(GLuint texture, const Instancing::Instance* instances, int instanceCount)
+{
+	tramRailBuffer.bind();					// Enable and point the arrays at the shape's data
 
-		for (int lat = 0; lat < segments; lat++)
-		{
-			float theta = (lat*2 * PI) / (segments);	// Angle of latitude
-			sVerts.x = (r*cos(theta))*(sin(delta));
-			sVerts.y = r*cos(delta);
-			sVerts.z = (r*sin(theta))*(sin(delta));
-			sphereVertex.push_back(sVerts);
-			sNorms = sVerts;
-			sNorms.x = sNorms.x / r;
-			sNorms.y = sNorms.y / r;
-			sNorms.z = sNorms.z / r;
-			sphereNormals.push_back(sNorms);
-
-			lon++;
-			delta = (lon*PI) / (segments);
-			sVerts.x = (r*cos(theta))*(sin(delta));
-			sVerts.y = r*cos(delta);
-			sVerts.z = (r*sin(theta))*(sin(delta));
-			sphereVertex.push_back(sVerts);
-			sNorms = sVerts;
-			sNorms.x = sNorms.x / r;
-			sNorms.y = sNorms.y / r;
-			sNorms.z = sNorms.z / r;
-			sphereNormals.push_back(sNorms);
-
-			lat++;
-			theta = (lat * 2 * PI) / (segments);
-			sVerts.x = (r*cos(theta))*(sin(delta));
-			sVerts.y = r*cos(delta);
-			sVerts.z = (r*sin(theta))*(sin(delta));
-			sphereVertex.push_back(sVerts);
-			sNorms = sVerts;
-			sNorms.x = sNorms.x / r;
-			sNorms.y = sNorms.y / r;
-			sNorms.z = sNorms.z / r;
-			sphereNormals.push_back(sNorms);
-
-			lon--;
-			delta = (lon*PI) / (segments);
-			sVerts.x = (r*cos(theta))*(sin(delta));
-			sVerts.y = r*cos(delta);
-			sVerts.z = (r*sin(theta))*(sin(delta));
-			sphereVertex.push_back(sVerts);
-			sNorms = sVerts;
-			sNorms.x = sNorms.x / r;
-			sNorms.y = sNorms.y / r;
-			sNorms.z = sNorms.z / r;
-			sphereNormals.push_back(sNorms);
-			lat--;
-
-			float u1 = 0 + (lat * (1 / (segments)));
-			float v1 = 0 + (lon * (1 / (segments)));
-			float u2 = u1;
-			float v2 = v1 + (1 / (segments));
-			float u3 = u2 + (1 / (segments));
-			float v3 = v2;
-			float u4 = u3;
-			float v4 = v1;
-			sphereTexCoords.push_back(u1);
-			sphereTexCoords.push_back(v1);
-			sphereTexCoords.push_back(u2);
-			sphereTexCoords.push_back(v2);
-			sphereTexCoords.push_back(u3);
-			sphereTexCoords.push_back(v3);
-			sphereTexCoords.push_back(u4);
-			sphereTexCoords.push_back(v4);
-		}
-	}
+	GLState::bindTexture(texture);
+	Instancing::begin(instances, instanceCount);
+	Instancing::drawArrays(GL_QUADS, 0, tramRailArrays.vertexCount);
+	Instancing::end();
+
+	tramRailBuffer.unbind();					// Disable the arrays
 }
 
-// Generates all vertex's, normals and texture coordinates required to render a cylinder.
-void Shape::genCylinderData(float radius, float segments)
+// Renders a sphere per instance, at a level of detail.
+void Shape::renderSphere(int lod, const Instancing::Instance* instances, int instanceCount)
 {
-	float r = radius;
-	cylinderSeg = segments;
-	float d = 2 * r;
+	const VertexBuffer* buffer;
+	const ShapeArrays& arrays = roundLevel(Sphere, lod, buffer);
+	buffer->bind();					// Enable and point the arrays at the shape's data
 
-	Vector3 cVerts;
-	Vector3 cNorms;
+	Instancing::begin(instances, instanceCount);
+	Instancing::drawElements(GL_TRIANGLES, arrays.indexCount, GL_UNSIGNED_INT, buffer->indices(0));
+	Instancing::end();
 
-	for (int column = 0; column < segments; column++)
-	{
-		for (int stacks = 0; stacks < segments; stacks++)
-		{
-			float theta = (stacks * 2 * PI) / (segments);	// Angle of latitude
-			cVerts.x = r*cos(theta);
-			cVerts.y = r*sin(theta);
-			cVerts.z = column;
-			cylinderVertex.push_back(cVerts);
-			cNorms = cVerts;
-			cNorms.x = cNorms.x / r;
-			cNorms.y = cNorms.y / r;
-			cNorms.z = cNorms.z / r;
-			cylinderNormals.push_back(cNorms);
-
-			stacks++;
-			theta = (stacks * 2 * PI) / (segments);
-			cVerts.x = r*cos(theta);
-			cVerts.y = r*sin(theta);
-			cVerts.z = column;
-			cylinderVertex.push_back(cVerts);
-			cNorms = cVerts;
-			cNorms.x = cNorms.x / r;
-			cNorms.y = cNorms.y / r;
-			cNorms.z = cNorms.z / r;
-			cylinderNormals.push_back(cNorms);
-			stacks--;
-
-			stacks++;
-			theta = (stacks * 2 * PI) / (segments);
-			cVerts.x = r*cos(theta);
-			cVerts.y = r*sin(theta);
-			column++;
-			cVerts.z = column;
-			cylinderVertex.push_back(cVerts);
-			cNorms = cVerts;
-			cNorms.x = cNorms.x / r;
-			cNorms.y = cNorms.y / r;
-			cNorms.z = cNorms.z / r;
-			cylinderNormals.push_back(cNorms);
-
-			stacks--;
-			theta = (stacks * 2 * PI) / (segments);
-			cVerts.x = r*cos(theta);
-			cVerts.y = r*sin(theta);
-			cVerts.z = column;
-			cylinderVertex.push_back(cVerts);
-			cNorms = cVerts;
-			cNorms.x = cNorms.x / r;
-			cNorms.y = cNorms.y / r;
-			cNorms.z = cNorms.z / r;
-			cylinderNormals.push_back(cNorms);
-			column--;
-
-			float u1 = 1 - (stacks * (1 / (segments)));
-			float v1 = 0 + (column/segments);
-			float u2 = u1;
-			float v2 = v1 + (1 / (segments));
-			float u3 = u2 - (1 / (segments));
-			float v3 = v2;
-			float u4 = u3;
-			float v4 = v1;
-			cylinderTexCoords.push_back(u1);
-			cylinderTexCoords.push_back(v1);
-			cylinderTexCoords.push_back(u4);
-			cylinderTexCoords.push_back(v4);
-			cylinderTexCoords.push_back(u3);
-			cylinderTexCoords.push_back(v3);
-			cylinderTexCoords.push_back(u2);
-			cylinderTexCoords.push_back(v2);
-		}
-	}
+	buffer->unbind();					// Disable the arrays
+}
+
+// Renders a wall with a hole in it per instance.
+void Shape::renderWall(GLuint texture, const Instancing::Instance* instances, int instanceCount)
+{
+	wallBuffer.bind();					// Enable and point the arrays at the shape's data
+
+	GLState::bindTexture(texture);
+	Instancing::begin(instances, instanceCount);
+	Instancing::drawArrays(GL_QUADS, 0, wallArrays.vertexCount);
+	Instancing::end();
+
+	wallBuffer.unbind();					// Disable the arrays
+}
+
+// Arrays pointing at a shape's generated vectors. indices may be NULL for glDrawArrays.
+static ShapeArrays shapeArrays(const float* vertex, const float* normals, const float* texCoords, int vertexCount,
+	float radius, float segments, const std::vector<GLuint>* indices = NULL)
+{
+	ShapeArrays arrays = { vertex, normals, texCoords, indices != NULL ? indices->data() : NULL, vertexCount,
+		indices != NULL ? (int)indices->size() : 0, radius, segments };
+	return arrays;
+}
+
+// Generates all vertex's, normals and texture coordinates required to render a disc.
+void Shape::genDiscData(float radius, float segments)
+{
+	ShapeGen::genDisc(radius, segments, discVertex, discNormals, discTexCoords);
+	setDiscData(shapeArrays(&discVertex[0].x, &discNormals[0].x, discTexCoords.data(), (int)discVertex.size(), radius, segments));
+}
+
+// Generates all vertex's, normals and texture coordinates required to render a sphere.
+void Shape::genSphereData(float radius, float segments)
+{
+	ShapeGen::genSphere(radius, segments, sphereVertex, sphereNormals, sphereTexCoords, sphereIndices);
+	setSphereData(shapeArrays(&sphereVertex[0].x, &sphereNormals[0].x, sphereTexCoords.data(), (int)sphereVertex.size(), radius, segments, &sphereIndices));
+}
+
+// Generates all vertex's, normals and texture coordinates required to render a cylinder, segments long.
+void Shape::genCylinderData(float radius, float segments)
+{
+	ShapeGen::genCylinder(radius, segments, segments, cylinderVertex, cylinderNormals, cylinderTexCoords, cylinderIndices);
+	setCylinderData(shapeArrays(&cylinderVertex[0].x, &cylinderNormals[0].x, cylinderTexCoords.data(), (int)cylinderVertex.size(), radius, segments,
+		&cylinderIndices));
 }
 
 // Generates all vertex's, normals and texture coordinates required to render a torus.
 void Shape::genTorusData(float radius, float segments)
 {
-	float r = radius;	// Minor radius
-	float R = 2 * r;	// Major radius
+	ShapeGen::genTorus(radius, segments, torusVertex, torusNormals, torusTexCoords, torusIndices);
+	setTorusData(shapeArrays(&torusVertex[0].x, &torusNormals[0].x, torusTexCoords.data(), (int)torusVertex.size(), radius, segments, &torusIndices));
+}
+
+// Generates all vertex's, normals and texture coordinates required to render a tram rail.
+void Shape::genTramRailData(float radius, float segments)
+{
+	ShapeGen::genPlane(radius, segments, tramRailVertex, tramRailNormals, tramRailTexCoords);
+	ShapeGen::genCuboid(radius, segments, cuboidVertex, cuboidNormals, cuboidTexCoords, cuboidAtlasTexCoords);
+	setTramRailData(shapeArrays(&tramRailVertex[0].x, &tramRailNormals[0].x, tramRailTexCoords.data(), (int)tramRailVertex.size(), radius, segments),
+		shapeArrays(&cuboidVertex[0].x, &cuboidNormals[0].x, cuboidTexCoords.data(), (int)cuboidVertex.size(), radius, segments), cuboidAtlasTexCoords.data());
+}
+
+// Generates a wall with a doorway in it, columns 6 to 14 and rows 5 to 7.
+void Shape::genWall(float radius, float segments)
+{
+	genWall(radius, segments, &ShapeGen::doorway, 1);
+}
+
+// Generates all vertex's, normals and texture coordinates required to render a wall with openings in it.
+void Shape::genWall(float radius, float segments, const WallOpening* openings, int openingCount)
+{
+	ShapeGen::genWall(radius, segments, openings, openingCount, wallVertex, wallNormals, wallTexCoords);
+	setWallData(shapeArrays(&wallVertex[0].x, &wallNormals[0].x, wallTexCoords.data(), (int)wallVertex.size(), radius, segments));
+}
+
+// Uploads a shape's arrays once, drawing then reads from the VBO.
+static void upload(VertexBuffer& buffer, const ShapeArrays& arrays, const float* texCoords)
+{
+	buffer.create(arrays.vertex, arrays.normals, texCoords, arrays.vertexCount, arrays.indices, arrays.indexCount * sizeof(GLuint));
+}
+
+// Uses the given disc arrays.
+void Shape::setDiscData(const ShapeArrays& disc)
+{
+	discArrays = disc;
+	roundBounds[Disc] = Bounds::fromVertices(disc.vertex, disc.vertexCount);
+	upload(discBuffer, disc, disc.texCoords);
+	clearLevels(Disc);
+}
+
+// Uses the given sphere arrays.
+void Shape::setSphereData(const ShapeArrays& sphere)
+{
+	sphereArrays = sphere;
+	roundBounds[Sphere] = Bounds::fromVertices(sphere.vertex, sphere.vertexCount);
+	upload(sphereBuffer, sphere, sphere.texCoords);
+	clearLevels(Sphere);
+}
+
+// Uses the given cylinder arrays, as long as it has segments.
+void Shape::setCylinderData(const ShapeArrays& cylinder)
+{
+	cylinderArrays = cylinder;
+	roundBounds[Cylinder] = Bounds::fromVertices(cylinder.vertex, cylinder.vertexCount);
+	cylinderSeg = cylinder.segments;
+	upload(cylinderBuffer, cylinder, cylinder.texCoords);
+	clearLevels(Cylinder);
+}
+
+// Uses the given torus arrays.
+void Shape::setTorusData(const ShapeArrays& torus)
+{
+	torusArrays = torus;
+	roundBounds[Torus] = Bounds::fromVertices(torus.vertex, torus.vertexCount);
+	upload(torusBuffer, torus, torus.texCoords);
+	clearLevels(Torus);
+}
+
+// Uses the given plane and cuboid arrays, the cuboid uploaded once with each set of texture co-ordinates.
+void Shape::setTramRailData(const ShapeArrays& plane, const ShapeArrays& cuboid, const float* cuboidAtlasTexCoords)
+{
+	tramRailArrays = plane;
+	cuboidArrays = cuboid;
+	planeArrayBounds = Bounds::fromVertices(plane.vertex, plane.vertexCount);
+	cuboidArrayBounds = Bounds::fromVertices(cuboid.vertex, cuboid.vertexCount);
+	upload(tramRailBuffer, plane, plane.texCoords);
+	upload(cuboidBuffer, cuboid, cuboid.texCoords);
+	upload(cuboidAtlasBuffer, cuboid, cuboidAtlasTexCoords);
+}
+
+// Uses the given wall arrays.
+void Shape::setWallData(const ShapeArrays& wall)
+{
+	wallArrays = wall;
+	wallArrayBounds = Bounds::fromVertices(wall.vertex, wall.vertexCount);
+	upload(wallBuffer, wall, wall.texCoords);
+}
 
-	Vector3 tVerts;
-	Vector3 tNorms;
 
-	for (int column = 0; column < segments; column++)
+
+
+// Segments round a level, a fraction of the full level's.
+int Shape::lodSegments(Round shape, int lod) const
+{
+	int full = (int)ceil(roundArrays(shape).segments);
+	lod = std::max(0, std::min(lod, lodCount - 1));
+	int segments = (int)(full * lodScales[lod] + 0.5f);
+	return std::min(full, std::max(segments, lodMinimumSegments));
+}
+
+// Projected radius of a round shape, measured as Model::screenSize does.
+float Shape::screenRadius(Round shape) const
+{
+	GLfloat modelview[16], projection[16];
+	GLint viewport[4];
+	glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+	glGetFloatv(GL_PROJECTION_MATRIX, projection);
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	// The tessellated radius and the bounding sphere round the whole shape, the torus' silhouette is its outer edge
+	// and the cylinder runs cylinderSeg along z.
+	float radius = roundArrays(shape).radius;
+	Vector3 centre;
+	float bound = radius;
+	if (shape == Torus)
 	{
-		float delta = (column*2*PI) / (segments);			// Angle of longitude
-		for (int stacks = 0; stacks < segments; stacks++)
-		{
-			float theta = (stacks * 2 * PI) / (segments);	// Angle of latitude
-			tVerts.x = ((R + (r*cos(theta)))*(cos(delta)));
-			tVerts.y = ((R + (r*cos(theta)))*(sin(delta)));
-			tVerts.z = (r*sin(theta));
-			torusVertex.push_back(tVerts);
-			tNorms = tVerts;
-			tNorms.x = tNorms.x / r;
-			tNorms.y = tNorms.y / r;
-			tNorms.z = tNorms.z / r;
-			torusNormals.push_back(tNorms);
-
-			column++;
-			delta = (column * 2 * PI) / (segments);
-			tVerts.x = ((R + (r*cos(theta)))*(cos(delta)));
-			tVerts.y = ((R + (r*cos(theta)))*(sin(delta)));
-			tVerts.z = (r*sin(theta));
-			torusVertex.push_back(tVerts);
-			tNorms = tVerts;
-			tNorms.x = tNorms.x / r;
-			tNorms.y = tNorms.y / r;
-			tNorms.z = tNorms.z / r;
-			torusNormals.push_back(tNorms);
-
-			stacks++;
-			theta = (stacks * 2 * PI) / (segments);
-			tVerts.x = ((R + (r*cos(theta)))*(cos(delta)));
-			tVerts.y = ((R + (r*cos(theta)))*(sin(delta)));
-			tVerts.z = (r*sin(theta));
-			torusVertex.push_back(tVerts);
-			tNorms = tVerts;
-			tNorms.x = tNorms.x / r;
-			tNorms.y = tNorms.y / r;
-			tNorms.z = tNorms.z / r;
-			torusNormals.push_back(tNorms);
-
-			column--;
-			delta = (column * 2 * PI) / (segments);
-			tVerts.x = ((R + (r*cos(theta)))*(cos(delta)));
-			tVerts.y = ((R + (r*cos(theta)))*(sin(delta)));
-			tVerts.z = (r*sin(theta));
-			torusVertex.push_back(tVerts);
-			tNorms = tVerts;
-			tNorms.x = tNorms.x / r;
-			tNorms.y = tNorms.y / r;
-			tNorms.z = tNorms.z / r;
-			torusNormals.push_back(tNorms);
-			stacks--;
-
-			float u1 = 0 + (column / segments);
-			float v1 = 1 - (stacks * (1 / (segments)));
-			float u2 = u1;
-			float v2 = v1 - (1 / (segments));
-			float u3 = u2 + (1 / (segments));
-			float v3 = v2;
-			float u4 = u3;
-			float v4 = v1;
-			torusTexCoords.push_back(u1);
-			torusTexCoords.push_back(v1);
-			torusTexCoords.push_back(u4);
-			torusTexCoords.push_back(v4);
-			torusTexCoords.push_back(u3);
-			torusTexCoords.push_back(v3);
-			torusTexCoords.push_back(u2);
-			torusTexCoords.push_back(v2);
-		}
+		radius *= 3.0f;
+		bound = radius;
+	}
+	else if (shape == Cylinder)
+	{
+		centre.z = cylinderSeg * 0.5f;
+		bound = sqrt(radius * radius + centre.z * centre.z);
+	}
+
+	float scale = 0.0f;
+	for (int axis = 0; axis < 3; axis++)
+	{
+		Vector3 column(modelview[axis * 4], modelview[axis * 4 + 1], modelview[axis * 4 + 2]);
+		scale = std::max(scale, column.length());
+	}
+	float distance = -(modelview[2] * centre.x + modelview[6] * centre.y + modelview[10] * centre.z + modelview[14]);
+
+	// Measured at the nearest point of the bounds, inside them the shape covers the whole screen.
+	float nearest = distance - bound * scale;
+	if (nearest <= 0.0f)
+	{
+		return (float)viewport[3] * 2.0f;
 	}
+	return radius * scale * projection[5] / nearest * viewport[3] * 0.5f;
 }
 
-// Generates all vertex's, normals and texture coordinates required to render a tram rail.
-void Shape::genTramRailData(float radius, float segments)
+// Picks the coarsest level whose silhouette error is under pixelError pixels.
+int Shape::selectLod(Round shape, float screenRadius, int current, float pixelError) const
 {
-	float r = radius;
-	float d = 2 * r;
-
-	Vector3 trVerts;
-	Vector3 trNorms;
+	// A chord across one segment of a circle falls short of it by radius * (1 - cos(pi / segments)).
+	float errors[lodCount];
+	for (int i = 0; i < lodCount; i++)
+	{
+		errors[i] = (float)(1.0 - cos(PI / lodSegments(shape, i))) * screenRadius;
+	}
 
-	for (int column = 0; column < segments; column++)
+	// Coarsest level comfortably inside the tolerance.
+	int target = 0;
+	for (int i = 1; i < lodCount; i++)
 	{
-		for (int stacks = 0; stacks < (segments / 2); stacks++)
+		if (errors[i] * (1.0f + lodHysteresis) <= pixelError)
 		{
-			trVerts.x = column;
-			trVerts.y = stacks;
-			trVerts.z = 0;
-			tramRailVertex.push_back(trVerts);
-			trNorms.x = 0 / r;
-			trNorms.y = 0 / r;
-			trNorms.z = 1 / r;
-			tramRailNormals.push_back(trNorms);
-
-			stacks++;
-			trVerts.x = column;
-			trVerts.y = stacks;
-			trVerts.z = 0;
-			tramRailVertex.push_back(trVerts);
-			trNorms.x = 0 / r;
-			trNorms.y = 0 / r;
-			trNorms.z = 1 / r;
-			tramRailNormals.push_back(trNorms);
-			stacks--;
-
-			stacks++;
-			column++;
-			trVerts.x = column;
-			trVerts.y = stacks;
-			trVerts.z = 0;
-			tramRailVertex.push_back(trVerts);
-			trNorms.x = 0 / r;
-			trNorms.y = 0 / r;
-			trNorms.z = 1 / r;
-			tramRailNormals.push_back(trNorms);
-
-			stacks--;
-			trVerts.x = column;
-			trVerts.y = stacks;
-			trVerts.z = 0;
-			tramRailVertex.push_back(trVerts);
-			trNorms.x = 0 / r;
-			trNorms.y = 0 / r;
-			trNorms.z = 1 / r;
-			tramRailNormals.push_back(trNorms);
-			column--;
-
-			float u1 = 0 + (column * (1 / (segments)));
-			float v1 = 0 + (stacks * (1 / (segments / 2)));
-			float u2 = u1;
-			float v2 = v1 + (1 / (segments/2));
-			float u3 = u2 + (1 / (segments));
-			float v3 = v2;
-			float u4 = u3;
-			float v4 = v1;
-			tramRailTexCoords.push_back(u1);
-			tramRailTexCoords.push_back(v1);
-			tramRailTexCoords.push_back(u2);
-			tramRailTexCoords.push_back(v2);
-			tramRailTexCoords.push_back(u3);
-			tramRailTexCoords.push_back(v3);
-			tramRailTexCoords.push_back(u4);
-			tramRailTexCoords.push_back(v4);
+			target = i;
 		}
 	}
+
+	// Keep a coarser level until it's clearly outside the tolerance.
+	current = std::max(0, std::min(current, lodCount - 1));
+	if (current > target && errors[current] <= pixelError * (1.0f + lodHysteresis))
+	{
+		return current;
+	}
+	return target;
 }
 
-void Shape::genWall(float radius, float segments)
+// The full level of a round shape.
+const ShapeArrays& Shape::roundArrays(Round shape) const
 {
-	float r = radius;
-	float d = 2 * r;
+	switch (shape)
+	{
+	case Disc:
+		return discArrays;
+	case Sphere:
+		return sphereArrays;
+	case Cylinder:
+		return cylinderArrays;
+	default:
+		return torusArrays;
+	}
+}
 
-	Vector3 wVerts;
-	Vector3 wNorms;
+// Arrays and buffer of a level of a round shape, generating the level the first time it's asked for.
+const ShapeArrays& Shape::roundLevel(Round shape, int lod, const VertexBuffer*& buffer)
+{
+	const ShapeArrays& full = roundArrays(shape);
+	int segments = lodSegments(shape, lod);
+	if (segments >= (int)ceil(full.segments) || full.vertexCount == 0)
+	{
+		const VertexBuffer* buffers[RoundCount] = { &discBuffer, &sphereBuffer, &cylinderBuffer, &torusBuffer };
+		buffer = buffers[shape];
+		return full;
+	}
 
-	for (int column = 0; column < segments; column++)
+	Level& level = levels[shape][std::max(0, std::min(lod, lodCount - 1)) - 1];
+	if (level.segments != segments)
 	{
-		for (int stacks = 0; stacks < segments / 2; stacks++)
+		float radius = full.radius;
+		switch (shape)
 		{
-			wVerts.x = column;
-			wVerts.y = stacks;
-			if (column >= 6 && column <= 14 && stacks >= 5 && stacks <= 6)
-			{
-				wVerts.x = 14;
-				wVerts.y = stacks;
-			}
-			wVerts.z = 0;
-			wallVertex.push_back(wVerts);
-			wNorms.x = 0 / r;
-			wNorms.y = 0 / r;
-			wNorms.z = 1 / r;
-			wallNormals.push_back(wNorms);
-
-			stacks++;
-			wVerts.x = column;
-			wVerts.y = stacks;
-			if (column >= 6 && column <= 14 && stacks >= 6 && stacks <= 7)
-			{
-				wVerts.x = 14;
-				wVerts.y = stacks;
-			}
-			wVerts.z = 0;
-			wallVertex.push_back(wVerts);
-			wNorms.x = 0 / r;
-			wNorms.y = 0 / r;
-			wNorms.z = 1 / r;
-			wallNormals.push_back(wNorms);
-			stacks--;
-
-			stacks++;
-			column++;
-			wVerts.x = column;
-			wVerts.y = stacks;
-			if (column >= 7 && column <= 14 && stacks >= 6 && stacks <= 7)
-			{
-				wVerts.x = 14;
-				wVerts.y = stacks;
-			}
-			wVerts.z = 0;
-			wallVertex.push_back(wVerts);
-			wNorms.x = 0 / r;
-			wNorms.y = 0 / r;
-			wNorms.z = 1 / r;
-			wallNormals.push_back(wNorms);
-
-			stacks--;
-			wVerts.x = column;
-			wVerts.y = stacks;
-			if (column >= 7 && column <= 14 && stacks >= 5 && stacks <= 6)
-			{
-				wVerts.x = 14;
-				wVerts.y = stacks;
-			}
-			wVerts.z = 0;
-			wallVertex.push_back(wVerts);
-			wNorms.x = 0 / r;
-			wNorms.y = 0 / r;
-			wNorms.z = 1 / r;
-			wallNormals.push_back(wNorms);
-			column--;
-
-			float u1 = 0 + (stacks * (1 / (segments / 2)));
-			float v1 = 0 + (column * (1 / (segments)));
-			float u2 = u1;
-			float v2 = v1 + (1 / (segments));
-			float u3 = u2 + (1 / (segments / 2));
-			float v3 = v2;
-			float u4 = u3;
-			float v4 = v1;
-			wallTexCoords.push_back(u1);
-			wallTexCoords.push_back(v1);
-			wallTexCoords.push_back(u4);
-			wallTexCoords.push_back(v4);
-			wallTexCoords.push_back(u3);
-			wallTexCoords.push_back(v3);
-			wallTexCoords.push_back(u2);
-			wallTexCoords.push_back(v2);
+		case Disc:
+			ShapeGen::genDisc(radius, (float)segments, level.vertex, level.normals, level.texCoords);
+			level.indices.clear();
+			break;
+		case Sphere:
+			ShapeGen::genSphere(radius, (float)segments, level.vertex, level.normals, level.texCoords, level.indices);
+			break;
+		case Cylinder:
+			ShapeGen::genCylinder(radius, (float)segments, cylinderSeg, level.vertex, level.normals, level.texCoords, level.indices);
+			break;
+		default:
+			ShapeGen::genTorus(radius, (float)segments, level.vertex, level.normals, level.texCoords, level.indices);
+			break;
 		}
+		level.arrays = shapeArrays(&level.vertex[0].x, &level.normals[0].x, level.texCoords.data(), (int)level.vertex.size(), radius, (float)segments,
+			level.indices.empty() ? NULL : &level.indices);
+		upload(level.buffer, level.arrays, level.arrays.texCoords);
+		level.segments = segments;
 	}
+	buffer = &level.buffer;
+	return level.arrays;
 }
 
-
+// Forgets a round shape's coarser levels, they're made again from its new arrays when next drawn.
+void Shape::clearLevels(Round shape)
+{
+	for (int i = 0; i < lodCount - 1; i++)
+	{
+		levels[shape][i].segments = 0;
+	}
+}
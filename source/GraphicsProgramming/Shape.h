@@ -7,26 +7,43 @@
 #include <math.h>
 #include <vector>
 #include "Vector3.h"
+#include "ShapeGen.h"
+#include "VertexBuffer.h"
+#include "Instancing.h"
+#include "StaticBatch.h"
+#include "Bounds.h"
+#include "BakedShapes.h"
 
 class Shape
 {
 
 	public:
+		Shape();
+
+		// Round shapes, whose tessellation can be picked per draw.
+		enum Round { Disc, Sphere, Cylinder, Torus, RoundCount };
+		// Levels of detail of each round shape. Level 0 is the shape as generated or set, each further level has fewer
+		// segments round it and is made from the shape's radius the first time it's drawn, then kept.
+		static const int lodCount = 5;
+
 		// Render fuction using dereferencing method 1.
 		void render1();
-		// Renders a disc using dereferencing method 2 (Accessing full arrays).
-		void renderDisc();
-		// Renders a sphere using dereferencing method 2 (Accessing full arrays).
-		void renderSphere();
-		// Renders a cylinder using dereferencing method 2 (Accessing full arrays).
-		void renderCylinder();
-		// Renders a torus using dereferencing method 2 (Accessing full arrays).
-		void renderTorus();
+		// Renders a disc using dereferencing method 2 (Accessing full arrays), at a level of detail.
+		void renderDisc(int lod = 0);
+		// Renders a sphere using dereferencing method 2 (Accessing full arrays), at a level of detail.
+		void renderSphere(int lod = 0);
+		// Renders a cylinder using dereferencing method 2 (Accessing full arrays), at a level of detail. Its end discs
+		// are drawn at the same level.
+		void renderCylinder(int lod = 0);
+		// Renders a torus using dereferencing method 2 (Accessing full arrays), at a level of detail.
+		void renderTorus(int lod = 0);
 		// Render function using dereferencing method 3.
 		void render3();
 
 		// Renders a tram rail using dereferencing method 2 (Accessing full arrays).
 		void renderTramRail(GLuint texture, GLuint texture2);
+		// Renders a tram rail with its two textures in one atlas, see AssetLoader::loadAtlas.
+		void renderTramRailAtlas(GLuint atlas);
 		// Renders a tram dock using dereferencing method 2 (Accessing full arrays).
 		void renderTramDock(GLuint texture);
 		// Renders a large plane using dereferencing method 2 (Accessing full arrays).
@@ -34,6 +51,20 @@ class Shape
 		// Render wall with a hole in it using dereferencing method 2 (Accessing full arrays).
 		void renderWall(GLuint texture);
 
+		// Instanced versions of the above, one copy per instance in a single submission, see Instancing.
+		void renderTramRail(GLuint texture, GLuint texture2, const Instancing::Instance* instances, int instanceCount);
+		void renderTramDock(GLuint texture, const Instancing::Instance* instances, int instanceCount);
+		void renderPlane(GLuint texture, const Instancing::Instance* instances, int instanceCount);
+		void renderWall(GLuint texture, const Instancing::Instance* instances, int instanceCount);
+		void renderSphere(int lod, const Instancing::Instance* instances, int instanceCount);
+
+		// Adds the shape to a static batch under the current modelview, instead of drawing it.
+		// Textures are the variables holding them and may be NULL, as may colour, see StaticBatch.
+		void batchTramRail(StaticBatch& batch, const GLuint* texture, const GLuint* texture2, const GLfloat* colour = NULL);
+		void batchTramDock(StaticBatch& batch, const GLuint* texture, const GLfloat* colour = NULL);
+		void batchPlane(StaticBatch& batch, const GLuint* texture, const GLfloat* colour = NULL);
+		void batchWall(StaticBatch& batch, const GLuint* texture, const GLfloat* colour = NULL);
+
 		// Generates all required data for rendering a disc.
 		void genDiscData(float radius, float segments);
 		// Generates all required data for rendering a sphere.
@@ -47,6 +78,36 @@ class Shape
 		void genTramRailData(float radius, float segments);
 		// Generates all required data for rendering a wall with a hole in it.
 		void genWall(float radius, float segments);
+		// Rectangle cut out of a wall, see ShapeGen::WallOpening.
+		typedef ShapeGen::WallOpening WallOpening;
+		// Generates a wall with any number of openings cut out of it, tessellated into unit quads around them.
+		void genWall(float radius, float segments, const WallOpening* openings, int openingCount);
+
+		// Uses arrays made elsewhere, e.g. baked by BakedShapes, instead of generating them. The arrays aren't copied
+		// and must outlive the shape. The cylinder is as long as it has segments, as genCylinderData makes it.
+		void setDiscData(const ShapeArrays& disc);
+		void setSphereData(const ShapeArrays& sphere);
+		void setCylinderData(const ShapeArrays& cylinder);
+		void setTorusData(const ShapeArrays& torus);
+		void setTramRailData(const ShapeArrays& plane, const ShapeArrays& cuboid, const float* cuboidAtlasTexCoords);
+		void setWallData(const ShapeArrays& wall);
+
+		// Bounds of each shape's arrays, made when they're generated or set. The tram rail's are the cuboid's, the plane's
+		// are also the tram dock's.
+		const Bounds& bounds(Round shape) const { return roundBounds[shape]; };
+		const Bounds& tramRailBounds() const { return cuboidArrayBounds; };
+		const Bounds& planeBounds() const { return planeArrayBounds; };
+		const Bounds& wallBounds() const { return wallArrayBounds; };
+
+		// Segments round a round shape at a level of detail.
+		int lodSegments(Round shape, int lod) const;
+		// Radius in pixels of the curve a round shape is tessellated along, under the current modelview, projection and
+		// viewport, taken at the nearest point of the shape's bounding sphere.
+		float screenRadius(Round shape) const;
+		// Coarsest level whose silhouette error, the gap between a segment and the true curve, covers fewer than
+		// pixelError pixels at the given screen radius. current is the level used last frame, switched from with the
+		// same hysteresis as Model::selectLod so shapes near a threshold don't flicker between levels.
+		int selectLod(Round shape, float screenRadius, int current, float pixelError = 1.0f) const;
 
 	private:
 		// Variable used to translate a disc to "cap" a cylinder.
@@ -55,5 +116,34 @@ class Shape
 		std::vector<Vector3> discVertex, discNormals, sphereVertex, sphereNormals, cylinderVertex, cylinderNormals, torusVertex, torusNormals, tramRailVertex, tramRailNormals, wallVertex, wallNormals;
 		// TexCoords vector which store the info required for shape texturing.
 		std::vector<float> discTexCoords, sphereTexCoords, cylinderTexCoords, torusTexCoords, tramRailTexCoords, wallTexCoords;
+		// Triangle indices of the sphere, cylinder and torus, whose vertices are each shared by four quads.
+		std::vector<GLuint> sphereIndices, cylinderIndices, torusIndices;
+		// Static VBOs of the above, uploaded by each gen function. Plane and tram dock share the tram rail data.
+		VertexBuffer discBuffer, sphereBuffer, cylinderBuffer, torusBuffer, tramRailBuffer, wallBuffer;
+		// Tram rail cuboid, the plane folded into four faces and baked into one mesh. Drawn with the plain texture
+		// co-ordinates and one texture per pair of faces, or with the atlas ones and an atlas of both.
+		std::vector<Vector3> cuboidVertex, cuboidNormals;
+		std::vector<float> cuboidTexCoords, cuboidAtlasTexCoords;
+		VertexBuffer cuboidBuffer, cuboidAtlasBuffer;
+		// The arrays each shape draws from, the generated vectors above or baked tables.
+		ShapeArrays discArrays, sphereArrays, cylinderArrays, torusArrays, tramRailArrays, wallArrays, cuboidArrays;
+		// Bounds of the arrays, see bounds.
+		Bounds roundBounds[RoundCount], planeArrayBounds, wallArrayBounds, cuboidArrayBounds;
+
+		// A coarser level of a round shape, segments 0 until it's made.
+		struct Level
+		{
+			int segments;
+			std::vector<Vector3> vertex, normals;
+			std::vector<float> texCoords;
+			std::vector<GLuint> indices;
+			ShapeArrays arrays;
+			VertexBuffer buffer;
+		};
+		Level levels[RoundCount][lodCount - 1];
+
+		const ShapeArrays& roundArrays(Round shape) const;
+		const ShapeArrays& roundLevel(Round shape, int lod, const VertexBuffer*& buffer);
+		void clearLevels(Round shape);
 };
 #endif 
@@ -0,0 +1,345 @@
+#include "ShapeGen.h"
+#include "AtlasLayout.h"
+#include <math.h>
+#include <algorithm>
+
+#define PI 3.14159265
+
+// Disc of the given radius and segments, a triangle fan round its centre.
+void ShapeGen::genDisc(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords)
+{
+	float r = radius;
+	float d = 2 * r;
+
+	vertex.clear();
+	normals.clear();
+	texCoords.clear();
+
+	Vector3 dVerts;	// Central point of disc
+	vertex.push_back(dVerts);
+	texCoords.push_back(0.5);	// Tex Co-ord in centre of disc - U
+	texCoords.push_back(0.5);	// Tex Co-ord in centre of disc - V
+	Vector3 dNorms = Vector3(0, 0, 1); // Normal in positive Z
+	normals.push_back(dNorms);
+
+	for (int i = 0; i < segments + 1; i++)
+	{
+		float theta = (i*(2 * PI)) / (segments);
+		dVerts.x = r*cos(theta);
+		dVerts.y = r*sin(theta);
+		dVerts.z = 0;
+		vertex.push_back(dVerts);
+
+		float u = (cos(theta) / d) + 0.5;	// Tex Co-ord - U
+		float v = (sin(theta) / d) + 0.5;	// Tex Co-ord - V
+		texCoords.push_back(u);
+		texCoords.push_back(v);
+
+		Vector3 dNorms = Vector3(0, 0, 1); // Normal in positive Z
+		normals.push_back(dNorms);
+	}
+}
+
+// Indices of a (rows + 1) by (columns + 1) grid of vertices, laid out a row at a time. Each cell becomes two triangles
+// with the same winding as the quad (a, b), (a + 1, b), (a + 1, b + 1), (a, b + 1).
+void ShapeGen::genGridIndices(int rows, int columns, std::vector<unsigned int>& indices)
+{
+	unsigned int row = columns + 1;
+	indices.clear();
+	indices.reserve(rows * columns * 6);
+	for (unsigned int a = 0; a < (unsigned int)rows; a++)
+	{
+		for (unsigned int b = 0; b < (unsigned int)columns; b++)
+		{
+			unsigned int corner1 = a * row + b;
+			unsigned int corner2 = corner1 + row;
+			unsigned int corner3 = corner2 + 1;
+			unsigned int corner4 = corner1 + 1;
+			indices.push_back(corner1);
+			indices.push_back(corner2);
+			indices.push_back(corner3);
+			indices.push_back(corner1);
+			indices.push_back(corner3);
+			indices.push_back(corner4);
+		}
+	}
+}
+
+// Cosine and sine of count + 1 angles, turn / segments apart, the last closing the ring.
+static void genRing(int count, double turn, float segments, std::vector<float>& cosines, std::vector<float>& sines)
+{
+	cosines.resize(count + 1);
+	sines.resize(count + 1);
+	for (int i = 0; i <= count; i++)
+	{
+		float angle = (float)((i * turn) / segments);
+		cosines[i] = cos(angle);
+		sines[i] = sin(angle);
+	}
+}
+
+// Sphere of the given radius and segments.
+// One vertex per grid point, longitude by latitude, shared by the four quads around it and indexed as triangles.
+void ShapeGen::genSphere(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords,
+	std::vector<unsigned int>& indices)
+{
+	float r = radius;
+	int n = (int)ceil(segments);
+
+	std::vector<float> cosLon, sinLon, cosLat, sinLat;
+	genRing(n, PI, segments, cosLon, sinLon);			// Angles of longitude
+	genRing(n, 2 * PI, segments, cosLat, sinLat);		// Angles of latitude
+
+	vertex.clear();
+	normals.clear();
+	texCoords.clear();
+	vertex.reserve((n + 1) * (n + 1));
+	normals.reserve((n + 1) * (n + 1));
+	texCoords.reserve((n + 1) * (n + 1) * 2);
+	for (int lon = 0; lon <= n; lon++)
+	{
+		for (int lat = 0; lat <= n; lat++)
+		{
+			Vector3 sVerts;
+			sVerts.x = (r*cosLat[lat])*(sinLon[lon]);
+			sVerts.y = r*cosLon[lon];
+			sVerts.z = (r*sinLat[lat])*(sinLon[lon]);
+			vertex.push_back(sVerts);
+			normals.push_back(Vector3(sVerts.x / r, sVerts.y / r, sVerts.z / r));
+			texCoords.push_back(lat * (1 / segments));
+			texCoords.push_back(lon * (1 / segments));
+		}
+	}
+	genGridIndices(n, n, indices);
+}
+
+// Cylinder of the given radius with segments round it, length long in steps of 1.
+// One vertex per grid point, round the cylinder by along it, shared by the four quads around it and indexed as triangles.
+void ShapeGen::genCylinder(float radius, float segments, float length, std::vector<Vector3>& vertex, std::vector<Vector3>& normals,
+	std::vector<float>& texCoords, std::vector<unsigned int>& indices)
+{
+	float r = radius;
+	int n = (int)ceil(segments);
+	int columns = (int)ceil(length);
+
+	std::vector<float> cosines, sines;
+	genRing(n, 2 * PI, segments, cosines, sines);		// Angles round the cylinder
+
+	vertex.clear();
+	normals.clear();
+	texCoords.clear();
+	vertex.reserve((n + 1) * (columns + 1));
+	normals.reserve((n + 1) * (columns + 1));
+	texCoords.reserve((n + 1) * (columns + 1) * 2);
+	for (int stacks = 0; stacks <= n; stacks++)
+	{
+		for (int column = 0; column <= columns; column++)
+		{
+			Vector3 cVerts;
+			cVerts.x = r*cosines[stacks];
+			cVerts.y = r*sines[stacks];
+			cVerts.z = column;
+			vertex.push_back(cVerts);
+			normals.push_back(Vector3(cVerts.x / r, cVerts.y / r, cVerts.z / r));
+			texCoords.push_back(1 - (stacks * (1 / segments)));
+			texCoords.push_back(column / length);
+		}
+	}
+	genGridIndices(n, columns, indices);
+}
+
+// Torus with a tube of the given radius and segments, round a ring twice that.
+// One vertex per grid point, round the ring by round the tube, shared by the four quads around it and indexed as triangles.
+void ShapeGen::genTorus(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords,
+	std::vector<unsigned int>& indices)
+{
+	float r = radius;	// Minor radius
+	float R = 2 * r;	// Major radius
+	int n = (int)ceil(segments);
+
+	std::vector<float> cosDelta, sinDelta, cosTheta, sinTheta;
+	genRing(n, 2 * PI, segments, cosDelta, sinDelta);	// Angles round the ring
+	cosTheta = cosDelta;								// Angles round the tube, the same steps
+	sinTheta = sinDelta;
+
+	vertex.clear();
+	normals.clear();
+	texCoords.clear();
+	vertex.reserve((n + 1) * (n + 1));
+	normals.reserve((n + 1) * (n + 1));
+	texCoords.reserve((n + 1) * (n + 1) * 2);
+	for (int column = 0; column <= n; column++)
+	{
+		for (int stacks = 0; stacks <= n; stacks++)
+		{
+			Vector3 tVerts;
+			tVerts.x = ((R + (r*cosTheta[stacks]))*(cosDelta[column]));
+			tVerts.y = ((R + (r*cosTheta[stacks]))*(sinDelta[column]));
+			tVerts.z = (r*sinTheta[stacks]);
+			vertex.push_back(tVerts);
+			normals.push_back(Vector3(tVerts.x / r, tVerts.y / r, tVerts.z / r));
+			texCoords.push_back(column / segments);
+			texCoords.push_back(1 - (stacks * (1 / segments)));
+		}
+	}
+	genGridIndices(n, n, indices);
+}
+
+// Plane of segments by segments / 2 unit quads, column by column.
+void ShapeGen::genPlane(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords)
+{
+	float r = radius;
+
+	vertex.clear();
+	normals.clear();
+	texCoords.clear();
+
+	Vector3 pNorms(0 / r, 0 / r, 1 / r);
+	for (int column = 0; column < segments; column++)
+	{
+		for (int stacks = 0; stacks < (segments / 2); stacks++)
+		{
+			// Corners (x, y), (x, y + 1), (x + 1, y + 1), (x + 1, y).
+			int cornersX[4] = { column, column, column + 1, column + 1 };
+			int cornersY[4] = { stacks, stacks + 1, stacks + 1, stacks };
+			for (int corner = 0; corner < 4; corner++)
+			{
+				vertex.push_back(Vector3((float)cornersX[corner], (float)cornersY[corner], 0));
+				normals.push_back(pNorms);
+				texCoords.push_back(cornersX[corner] * (1 / (segments)));
+				texCoords.push_back(cornersY[corner] * (1 / (segments / 2)));
+			}
+		}
+	}
+}
+
+// Folds the plane into the back, bottom, front and top faces of a cuboid, scaled to a tenth deep and high, as one mesh.
+// Each face's texture co-ordinates are kept as they were, and also squeezed into the left half of an atlas for the back
+// and bottom and the right half for the front and top. The ends stay open, the docks and door room are walked through them.
+void ShapeGen::genCuboid(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords,
+	std::vector<float>& atlasTexCoords)
+{
+	std::vector<Vector3> planeVertex, planeNormals;
+	std::vector<float> planeTexCoords;
+	genPlane(radius, segments, planeVertex, planeNormals, planeTexCoords);
+
+	// Normals are ten times the plane's, as the fold's scale of a tenth would leave them unnormalised.
+	float n = 10 / radius;
+	Vector3 faceNormals[4] = { Vector3(0, 0, n), Vector3(0, -n, 0), Vector3(0, 0, -n), Vector3(0, n, 0) };
+
+	size_t count = planeVertex.size();
+	vertex.clear();
+	normals.clear();
+	texCoords.clear();
+	atlasTexCoords.clear();
+	vertex.reserve(count * 4);
+	normals.reserve(count * 4);
+	texCoords.reserve(count * 8);
+	atlasTexCoords.reserve(count * 8);
+	for (int face = 0; face < 4; face++)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			float x = planeVertex[i].x;
+			float y = planeVertex[i].y * 0.1f;
+			Vector3 faceVertex[4] = { Vector3(x, y, 0), Vector3(x, 0, y), Vector3(x, 1 - y, 1), Vector3(x, 1, 1 - y) };
+			vertex.push_back(faceVertex[face]);
+			normals.push_back(faceNormals[face]);
+			texCoords.push_back(planeTexCoords[i * 2]);
+			texCoords.push_back(planeTexCoords[i * 2 + 1]);
+			atlasTexCoords.push_back(AtlasLayout::u(face < 2 ? 0 : 1, planeTexCoords[i * 2]));
+			atlasTexCoords.push_back(planeTexCoords[i * 2 + 1]);
+		}
+	}
+}
+
+const ShapeGen::WallOpening ShapeGen::doorway = { 6.0f, 5.0f, 8.0f, 2.0f };
+
+// Edges closer than this are merged, so openings just off the grid don't leave slivers.
+static const float wallEdgeTolerance = 0.001f;
+
+// Sorts edges and removes any within wallEdgeTolerance of the one before.
+static void mergeEdges(std::vector<float>& edges)
+{
+	std::sort(edges.begin(), edges.end());
+	size_t kept = 0;
+	for (size_t i = 0; i < edges.size(); i++)
+	{
+		if (kept == 0 || edges[i] - edges[kept - 1] > wallEdgeTolerance)
+		{
+			edges[kept++] = edges[i];
+		}
+	}
+	edges.resize(kept);
+}
+
+// Wall with openings in it. The grid's lines are split along each opening's edges and every cell outside the openings
+// becomes one quad, so there are no degenerate quads and no edge ends part way along another.
+void ShapeGen::genWall(float radius, float segments, const WallOpening* openings, int openingCount, std::vector<Vector3>& vertex,
+	std::vector<Vector3>& normals, std::vector<float>& texCoords)
+{
+	float r = radius;
+	float width = ceil(segments);
+	float height = ceil(segments / 2);
+
+	// Grid lines one unit apart, plus the edges of each opening clamped to the wall.
+	std::vector<float> xs, ys;
+	for (int column = 0; column <= width; column++)
+	{
+		xs.push_back((float)column);
+	}
+	for (int stacks = 0; stacks <= height; stacks++)
+	{
+		ys.push_back((float)stacks);
+	}
+	for (int i = 0; i < openingCount; i++)
+	{
+		const WallOpening& opening = openings[i];
+		xs.push_back(std::max(0.0f, std::min(opening.x, width)));
+		xs.push_back(std::max(0.0f, std::min(opening.x + opening.width, width)));
+		ys.push_back(std::max(0.0f, std::min(opening.y, height)));
+		ys.push_back(std::max(0.0f, std::min(opening.y + opening.height, height)));
+	}
+	mergeEdges(xs);
+	mergeEdges(ys);
+
+	vertex.clear();
+	normals.clear();
+	texCoords.clear();
+	vertex.reserve((xs.size() - 1) * (ys.size() - 1) * 4);
+	normals.reserve((xs.size() - 1) * (ys.size() - 1) * 4);
+	texCoords.reserve((xs.size() - 1) * (ys.size() - 1) * 8);
+
+	Vector3 wNorms(0 / r, 0 / r, 1 / r);
+	for (size_t column = 0; column + 1 < xs.size(); column++)
+	{
+		for (size_t stacks = 0; stacks + 1 < ys.size(); stacks++)
+		{
+			// Cells are never split by an opening, so testing the centre is enough.
+			float centreX = (xs[column] + xs[column + 1]) * 0.5f;
+			float centreY = (ys[stacks] + ys[stacks + 1]) * 0.5f;
+			bool open = false;
+			for (int i = 0; i < openingCount && !open; i++)
+			{
+				const WallOpening& opening = openings[i];
+				open = centreX > opening.x && centreX < opening.x + opening.width && centreY > opening.y && centreY < opening.y + opening.height;
+			}
+			if (open)
+			{
+				continue;
+			}
+
+			// Corners (x, y), (x, y + 1), (x + 1, y + 1), (x + 1, y) as the tram rail's, texture co-ordinates with
+			// u up the wall and v across it.
+			float cornersX[4] = { xs[column], xs[column], xs[column + 1], xs[column + 1] };
+			float cornersY[4] = { ys[stacks], ys[stacks + 1], ys[stacks + 1], ys[stacks] };
+			for (int corner = 0; corner < 4; corner++)
+			{
+				vertex.push_back(Vector3(cornersX[corner], cornersY[corner], 0));
+				normals.push_back(wNorms);
+				texCoords.push_back(cornersY[corner] * (1 / (segments / 2)));
+				texCoords.push_back(cornersX[corner] * (1 / (segments)));
+			}
+		}
+	}
+}
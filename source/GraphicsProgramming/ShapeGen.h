@@ -0,0 +1,50 @@
+// ShapeGen class, generates the vertex arrays of Shape's disc, sphere, cylinder, torus, tram rail and wall.
+// Makes no GL calls, so the surfaces can be checked by the ShapeCheck tool and baked by the ShapeBake tool as well as
+// drawn by Shape.
+#ifndef _SHAPEGEN_H_
+#define _SHAPEGEN_H_
+
+#include <vector>
+#include "Vector3.h"
+
+class ShapeGen
+{
+
+public:
+	// Disc of the given radius and segments, a triangle fan round its centre.
+	static void genDisc(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords);
+	// Sphere of the given radius and segments, an indexed triangle grid of longitude by latitude.
+	static void genSphere(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords,
+		std::vector<unsigned int>& indices);
+	// Cylinder of the given radius with segments round it, length long in steps of 1, an indexed triangle grid.
+	static void genCylinder(float radius, float segments, float length, std::vector<Vector3>& vertex, std::vector<Vector3>& normals,
+		std::vector<float>& texCoords, std::vector<unsigned int>& indices);
+	// Torus with a tube of the given radius and segments round a ring twice that, an indexed triangle grid.
+	static void genTorus(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords,
+		std::vector<unsigned int>& indices);
+
+	// Plane of segments by segments / 2 unit quads facing +z, the tram dock's, drawn as quads.
+	static void genPlane(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords);
+	// The plane folded into the back, bottom, front and top of a cuboid a tenth high and deep, the tram rail's, drawn
+	// as quads. atlasTexCoords are texCoords moved into a two texture atlas, see AtlasLayout.
+	static void genCuboid(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords,
+		std::vector<float>& atlasTexCoords);
+
+	// Rectangle cut out of a wall, in the wall's units from its bottom left corner. The wall is segments wide and
+	// segments / 2 high.
+	struct WallOpening
+	{
+		float x, y, width, height;
+	};
+	// The doorway Shape::genWall cuts by default, columns 6 to 14 and rows 5 to 7.
+	static const WallOpening doorway;
+	// Wall of segments by segments / 2 with any number of openings cut out of it, tessellated into unit quads around
+	// them and drawn as quads.
+	static void genWall(float radius, float segments, const WallOpening* openings, int openingCount, std::vector<Vector3>& vertex,
+		std::vector<Vector3>& normals, std::vector<float>& texCoords);
+
+	// Triangle indices for a grid of rows by columns quads, each split in two with the quad's winding.
+	static void genGridIndices(int rows, int columns, std::vector<unsigned int>& indices);
+};
+
+#endif
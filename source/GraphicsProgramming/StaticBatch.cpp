@@ -0,0 +1,261 @@
+#include "StaticBatch.h"
+#include "GLExtensions.h"
+#include "GLState.h"
+#include <algorithm>
+#include <string.h>
+
+int StaticBatch::drawnParts = 0;
+int StaticBatch::culledParts = 0;
+
+StaticBatch::StaticBatch() : colourBuffer(0), coloured(false), dirty(false)
+{
+}
+
+StaticBatch::~StaticBatch()
+{
+	if (colourBuffer != 0)
+	{
+		GLExtensions::deleteBuffers(1, &colourBuffer);
+	}
+}
+
+void StaticBatch::add(const GLfloat* matrix, const float* vertex, const float* normals, const float* texCoords, int vertexCount,
+	const GLuint* texture, const GLfloat* colour)
+{
+	Part part;
+	memcpy(part.matrix, matrix, sizeof(part.matrix));
+	part.vertex = vertex;
+	part.normals = normals;
+	part.texCoords = texCoords;
+	part.vertexCount = vertexCount;
+	part.texture = texture;
+	part.builtTexture = 0;
+	part.coloured = colour != NULL;
+	for (int i = 0; i < 4; i++)
+	{
+		part.colour[i] = colour != NULL ? colour[i] : 1.0f;
+	}
+	part.bounds.add(Bounds::fromVertices(vertex, vertexCount), matrix);
+	batchBounds.add(part.bounds);
+	parts.push_back(part);
+	dirty = true;
+}
+
+void StaticBatch::clear()
+{
+	parts.clear();
+	batchBounds = Bounds();
+	dirty = true;
+}
+
+void StaticBatch::resetCounts()
+{
+	drawnParts = 0;
+	culledParts = 0;
+}
+
+// Parts sorted by texture, keeping the order they were added in within a texture.
+struct PartTextureLess
+{
+	const std::vector<GLuint>& textures;
+	PartTextureLess(const std::vector<GLuint>& t) : textures(t) {}
+	bool operator()(size_t a, size_t b) const { return textures[a] < textures[b]; }
+};
+
+void StaticBatch::transform(const GLfloat* matrix, const float* vertex, const float* normals, int vertexCount,
+	std::vector<float>& outVertex, std::vector<float>& outNormals)
+{
+	// The inverse transpose of the 3x3 is its cofactors over its determinant.
+	const GLfloat* m = matrix;
+	float c0[3] = { m[0], m[1], m[2] };
+	float c1[3] = { m[4], m[5], m[6] };
+	float c2[3] = { m[8], m[9], m[10] };
+	float n0[3] = { c1[1] * c2[2] - c1[2] * c2[1], c1[2] * c2[0] - c1[0] * c2[2], c1[0] * c2[1] - c1[1] * c2[0] };
+	float n1[3] = { c2[1] * c0[2] - c2[2] * c0[1], c2[2] * c0[0] - c2[0] * c0[2], c2[0] * c0[1] - c2[1] * c0[0] };
+	float n2[3] = { c0[1] * c1[2] - c0[2] * c1[1], c0[2] * c1[0] - c0[0] * c1[2], c0[0] * c1[1] - c0[1] * c1[0] };
+	float determinant = c0[0] * n0[0] + c0[1] * n0[1] + c0[2] * n0[2];
+	float inverse = determinant != 0.0f ? 1.0f / determinant : 0.0f;
+
+	for (int i = 0; i < vertexCount; i++)
+	{
+		const float* v = vertex + i * 3;
+		outVertex.push_back(m[0] * v[0] + m[4] * v[1] + m[8] * v[2] + m[12]);
+		outVertex.push_back(m[1] * v[0] + m[5] * v[1] + m[9] * v[2] + m[13]);
+		outVertex.push_back(m[2] * v[0] + m[6] * v[1] + m[10] * v[2] + m[14]);
+
+		const float* n = normals + i * 3;
+		outNormals.push_back((n0[0] * n[0] + n1[0] * n[1] + n2[0] * n[2]) * inverse);
+		outNormals.push_back((n0[1] * n[0] + n1[1] * n[1] + n2[1] * n[2]) * inverse);
+		outNormals.push_back((n0[2] * n[0] + n1[2] * n[1] + n2[2] * n[2]) * inverse);
+	}
+}
+
+void StaticBatch::build()
+{
+	dirty = false;
+	vertex.clear();
+	normals.clear();
+	texCoords.clear();
+	colours.clear();
+	groups.clear();
+	spans.clear();
+	spanBounds.clear();
+
+	coloured = false;
+	std::vector<size_t> order(parts.size());
+	std::vector<GLuint> textures(parts.size());
+	for (size_t i = 0; i < parts.size(); i++)
+	{
+		order[i] = i;
+		parts[i].builtTexture = parts[i].texture != NULL ? *parts[i].texture : 0;
+		textures[i] = parts[i].builtTexture;
+		coloured = coloured || parts[i].coloured;
+	}
+	std::stable_sort(order.begin(), order.end(), PartTextureLess(textures));
+
+	for (size_t p = 0; p < order.size(); p++)
+	{
+		const Part& part = parts[order[p]];
+
+		GLint first = (GLint)(vertex.size() / 3);
+		if (groups.empty() || groups.back().texture != part.builtTexture)
+		{
+			Group group;
+			group.texture = part.builtTexture;
+			group.first = first;
+			group.count = 0;
+			group.firstSpan = spans.size();
+			group.spanCount = 0;
+			groups.push_back(group);
+		}
+		groups.back().count += part.vertexCount;
+		groups.back().spanCount++;
+		Span span = { first, part.vertexCount };
+		spans.push_back(span);
+		spanBounds.add(part.bounds);
+
+		transform(part.matrix, part.vertex, part.normals, part.vertexCount, vertex, normals);
+		texCoords.insert(texCoords.end(), part.texCoords, part.texCoords + part.vertexCount * 2);
+		if (coloured)
+		{
+			for (int i = 0; i < part.vertexCount; i++)
+			{
+				colours.insert(colours.end(), part.colour, part.colour + 4);
+			}
+		}
+	}
+
+	buffer.create(vertex.data(), normals.data(), texCoords.data(), (int)(vertex.size() / 3));
+
+	if (colourBuffer != 0)
+	{
+		GLExtensions::deleteBuffers(1, &colourBuffer);
+		colourBuffer = 0;
+	}
+	if (coloured && GLExtensions::vertexBuffers && !colours.empty())
+	{
+		GLExtensions::genBuffers(1, &colourBuffer);
+		GLExtensions::bindBuffer(GL_ARRAY_BUFFER, colourBuffer);
+		GLExtensions::bufferData(GL_ARRAY_BUFFER, colours.size() * sizeof(float), colours.data(), GL_STATIC_DRAW);
+		GLExtensions::bindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+}
+
+void StaticBatch::render(const Frustum* frustum)
+{
+	// Regroup if a texture has been swapped in since the build.
+	for (size_t i = 0; i < parts.size() && !dirty; i++)
+	{
+		dirty = (parts[i].texture != NULL ? *parts[i].texture : 0) != parts[i].builtTexture;
+	}
+	if (dirty)
+	{
+		build();
+	}
+	if (groups.empty())
+	{
+		return;
+	}
+
+	// Drawing with a colour array leaves the current colour undefined, put it back for whatever is drawn next.
+	if (coloured)
+	{
+		GLState::pushAttrib(GL_CURRENT_BIT);
+	}
+
+	buffer.bind();										// Enable and point the arrays at the batch's data
+	if (coloured)
+	{
+		glEnableClientState(GL_COLOR_ARRAY);
+		if (VertexBuffer::useBuffers && colourBuffer != 0)
+		{
+			GLExtensions::bindBuffer(GL_ARRAY_BUFFER, colourBuffer);
+			glColorPointer(4, GL_FLOAT, 0, (const void*)0);
+		}
+		else
+		{
+			glColorPointer(4, GL_FLOAT, 0, colours.data());
+		}
+	}
+
+	if (frustum != NULL)
+	{
+		spanVisible.resize(spans.size());
+		spanBounds.cull(*frustum, spanVisible.data());
+	}
+
+	for (size_t i = 0; i < groups.size(); i++)
+	{
+		const Group& group = groups[i];
+		if (frustum == NULL)
+		{
+			GLState::bindTexture(group.texture);
+			glDrawArrays(GL_QUADS, group.first, group.count);
+			drawnParts += (int)group.spanCount;
+			continue;
+		}
+
+		// Runs of neighbouring parts that are in view, each drawn in one call.
+		GLint runFirst = 0;
+		GLsizei runCount = 0;
+		for (size_t s = group.firstSpan; s <= group.firstSpan + group.spanCount; s++)
+		{
+			bool last = s == group.firstSpan + group.spanCount;
+			bool visible = !last && spanVisible[s] != 0;
+			if (visible && runCount > 0 && runFirst + runCount == spans[s].first)
+			{
+				runCount += spans[s].count;
+			}
+			else
+			{
+				if (runCount > 0)
+				{
+					GLState::bindTexture(group.texture);
+					glDrawArrays(GL_QUADS, runFirst, runCount);
+				}
+				runFirst = visible ? spans[s].first : 0;
+				runCount = visible ? spans[s].count : 0;
+			}
+
+			if (visible)
+			{
+				drawnParts++;
+			}
+			else if (!last)
+			{
+				culledParts++;
+			}
+		}
+	}
+
+	if (coloured)
+	{
+		glDisableClientState(GL_COLOR_ARRAY);
+	}
+	buffer.unbind();									// Disable the arrays
+
+	if (coloured)
+	{
+		GLState::popAttrib();
+	}
+}
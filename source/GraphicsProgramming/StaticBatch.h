@@ -0,0 +1,112 @@
+// StaticBatch class, merges scenery that never moves into one vertex buffer in world space.
+// Each part is added once with the transform it would have been drawn with, its vertices are transformed on the CPU
+// and grouped by texture, so the whole batch draws with one glDrawArrays per texture and no matrix stack work.
+// Parts may carry their own colour, kept as a per vertex colour array so differently coloured parts still share a draw.
+// Parts are quad lists, like Shape's arrays, which must outlive the batch as it rebuilds from them.
+// Textures are given by the variable holding them, so a texture still loading in the background shows its placeholder
+// until AssetLoader swaps it in. Parts are grouped by the texture their variables hold, so parts with different variables
+// holding the same texture share a draw, and the batch regroups when a variable changes.
+// Each part keeps its bounds, so render can skip the parts outside a frustum, drawing the rest of a texture's parts in
+// as few runs as they allow. The bounds are tested all at once through a BoundsArray.
+#ifndef _STATICBATCH_H_
+#define _STATICBATCH_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <vector>
+#include "VertexBuffer.h"
+#include "Frustum.h"
+#include "BoundsArray.h"
+
+class StaticBatch
+{
+
+public:
+	StaticBatch();
+	~StaticBatch();
+
+	// Adds vertexCount vertices of quads transformed by matrix, column major as glMultMatrixf.
+	// texture may be NULL for none. colour is RGBA, or NULL to draw the part in whatever colour is current. Once any part
+	// has a colour the parts without one are drawn white.
+	void add(const GLfloat* matrix, const float* vertex, const float* normals, const float* texCoords, int vertexCount,
+		const GLuint* texture, const GLfloat* colour = NULL);
+	// Removes every part, the batch is rebuilt on the next render.
+	void clear();
+
+	// Draws the batch under the current modelview, rebuilding it first if parts were added or removed since the last build.
+	// frustum, if not NULL, culls the parts outside it and must be in the batch's space. Must be on the GL thread.
+	void render(const Frustum* frustum = NULL);
+
+	// glDrawArrays calls render makes without culling, one per texture.
+	int drawCalls() const { return (int)groups.size(); };
+	int quadCount() const { return (int)vertex.size() / 12; };
+	// Box round every part, in the batch's space.
+	const Bounds& bounds() const { return batchBounds; };
+
+	// Parts drawn and culled by every batch since resetCounts.
+	static int partsDrawn() { return drawnParts; };
+	static int partsCulled() { return culledParts; };
+	static void resetCounts();
+
+	// Appends vertexCount positions and normals transformed by matrix, normals by its inverse transpose. The normals are
+	// left unnormalised, as fixed function leaves them without GL_NORMALIZE, so baked geometry lights exactly as it did
+	// drawn through the matrix stack.
+	static void transform(const GLfloat* matrix, const float* vertex, const float* normals, int vertexCount,
+		std::vector<float>& outVertex, std::vector<float>& outNormals);
+
+private:
+	StaticBatch(const StaticBatch&);
+	StaticBatch& operator=(const StaticBatch&);
+
+	// Transforms and sorts the parts into the merged arrays and uploads them.
+	void build();
+
+	struct Part
+	{
+		GLfloat matrix[16];
+		const float* vertex;
+		const float* normals;
+		const float* texCoords;
+		int vertexCount;
+		const GLuint* texture;
+		GLuint builtTexture;			// What texture held at the last build
+		GLfloat colour[4];
+		bool coloured;
+		Bounds bounds;
+	};
+	std::vector<Part> parts;
+	Bounds batchBounds;
+
+	// Where a part's vertices landed in the merged arrays.
+	struct Span
+	{
+		GLint first;
+		GLsizei count;
+	};
+	std::vector<Span> spans;
+	// Bounds of each span in the same order, and whether each passed the last cull.
+	BoundsArray spanBounds;
+	std::vector<unsigned char> spanVisible;
+
+	// One draw, the vertices of every part with the same texture, spanCount spans from firstSpan.
+	struct Group
+	{
+		GLuint texture;
+		GLint first;
+		GLsizei count;
+		size_t firstSpan, spanCount;
+	};
+	std::vector<Group> groups;
+
+	// Merged world space arrays, in group order.
+	std::vector<float> vertex, normals, texCoords, colours;
+	VertexBuffer buffer;
+	GLuint colourBuffer;
+	bool coloured;
+	bool dirty;
+
+	static int drawnParts;
+	static int culledParts;
+};
+
+#endif
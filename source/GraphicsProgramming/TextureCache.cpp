@@ -0,0 +1,180 @@
+#include "TextureCache.h"
+#include "GLExtensions.h"
+#include "GLState.h"
+#include <ctype.h>
+#include <stdio.h>
+
+TextureCache::TextureCache() : totalBytes(0)
+{
+}
+
+TextureCache& TextureCache::shared()
+{
+	static TextureCache cache;
+	return cache;
+}
+
+TextureCache::Key TextureCache::makeKey(const char* filename, unsigned int flags)
+{
+	std::string path = filename;
+	for (size_t i = 0; i < path.size(); i++)
+	{
+		path[i] = path[i] == '\\' ? '/' : (char)tolower((unsigned char)path[i]);
+	}
+	return Key(path, flags);
+}
+
+size_t TextureCache::measure(GLuint texture)
+{
+	GLint previous = 0;
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glBindTexture(GL_TEXTURE_2D, texture);
+
+	size_t bytes = 0;
+	for (GLint level = 0; level < 32; level++)
+	{
+		GLint width = 0, height = 0;
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_WIDTH, &width);
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_HEIGHT, &height);
+		if (width == 0 || height == 0)
+		{
+			break;
+		}
+
+		GLint compressed = 0;
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED, &compressed);
+		// Clear any error from a driver without GL 1.3 queries.
+		while (glGetError() != GL_NO_ERROR)
+		{
+		}
+
+		if (compressed)
+		{
+			GLint size = 0;
+			glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+			bytes += (size_t)size;
+		}
+		else
+		{
+			// Bits per component of what the driver actually stored, RGB is padded out to 4 bytes like most drivers do.
+			GLint r = 0, g = 0, b = 0, a = 0, l = 0;
+			glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_RED_SIZE, &r);
+			glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_GREEN_SIZE, &g);
+			glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_BLUE_SIZE, &b);
+			glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_ALPHA_SIZE, &a);
+			glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_LUMINANCE_SIZE, &l);
+			int bytesPerPixel = (r + g + b + a + l + 7) / 8;
+			if (bytesPerPixel == 3)
+			{
+				bytesPerPixel = 4;
+			}
+			bytes += (size_t)width * height * bytesPerPixel;
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_2D, previous);
+	return bytes;
+}
+
+void TextureCache::insert(const Key& key, GLuint texture)
+{
+	Entry entry;
+	entry.key = key;
+	entry.references = 1;
+	entry.bytes = measure(texture);
+	textures[key] = texture;
+	entries[texture] = entry;
+	totalBytes += entry.bytes;
+}
+
+GLuint TextureCache::acquire(const char* filename, unsigned int flags)
+{
+	GLuint texture = find(filename, flags);
+	if (texture != 0)
+	{
+		return texture;
+	}
+
+	texture = TextureLoader::load(filename, flags);
+	if (texture == 0)
+	{
+		return 0;
+	}
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	insert(makeKey(filename, flags), texture);
+	return texture;
+}
+
+GLuint TextureCache::find(const char* filename, unsigned int flags)
+{
+	Key key = makeKey(filename, flags);
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	std::map<Key, GLuint>::iterator found = textures.find(key);
+	if (found == textures.end())
+	{
+		return 0;
+	}
+	entries[found->second].references++;
+	return found->second;
+}
+
+GLuint TextureCache::add(const char* filename, unsigned int flags, const DecodedImage& image)
+{
+	// Two loads of the same image can be in flight at once, only the first is uploaded.
+	GLuint texture = find(filename, flags);
+	if (texture != 0)
+	{
+		return texture;
+	}
+
+	texture = TextureLoader::upload(image, flags, filename);
+	if (texture == 0)
+	{
+		return 0;
+	}
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	insert(makeKey(filename, flags), texture);
+	return texture;
+}
+
+void TextureCache::release(GLuint texture)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	std::map<GLuint, Entry>::iterator found = entries.find(texture);
+	if (found == entries.end())
+	{
+		return;
+	}
+
+	if (--found->second.references > 0)
+	{
+		return;
+	}
+
+	totalBytes -= found->second.bytes;
+	textures.erase(found->second.key);
+	entries.erase(found);
+	GLState::deleteTextures(1, &texture);
+}
+
+int TextureCache::size()
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	return (int)entries.size();
+}
+
+size_t TextureCache::memoryUsage()
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	return totalBytes;
+}
+
+size_t TextureCache::memoryUsage(GLuint texture)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	std::map<GLuint, Entry>::const_iterator found = entries.find(texture);
+	return found != entries.end() ? found->second.bytes : 0;
+}
@@ -0,0 +1,63 @@
+// TextureCache class, shares GL textures between everything that loads the same image with the same flags.
+// Each texture is reference counted, acquire/find/add take a reference and release drops one,
+// the texture is deleted when the last one goes. Also tracks the GPU memory each texture uses.
+// find() may be called from any thread, everything else makes GL calls so must be on the GL thread.
+#ifndef _TEXTURECACHE_H_
+#define _TEXTURECACHE_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <map>
+#include <string>
+#include <mutex>
+#include "TextureLoader.h"
+
+class TextureCache
+{
+
+public:
+	TextureCache();
+
+	// Process wide cache.
+	static TextureCache& shared();
+
+	// Returns the texture for filename and flags, loading it on first use. Returns 0 if it can't be loaded.
+	GLuint acquire(const char* filename, unsigned int flags);
+	// Returns the texture if it's already loaded, otherwise 0 without loading it.
+	GLuint find(const char* filename, unsigned int flags);
+	// Uploads an image decoded elsewhere. If the same texture was added in the meantime that one is returned instead.
+	GLuint add(const char* filename, unsigned int flags, const DecodedImage& image);
+	// Drops a reference taken by acquire, find or add.
+	void release(GLuint texture);
+
+	// Number of textures and the bytes of GPU memory they use, mip levels included.
+	int size();
+	size_t memoryUsage();
+	size_t memoryUsage(GLuint texture);
+
+private:
+	TextureCache(const TextureCache&);
+	TextureCache& operator=(const TextureCache&);
+
+	// Paths are compared case insensitively with either slash, as on Windows.
+	typedef std::pair<std::string, unsigned int> Key;
+	static Key makeKey(const char* filename, unsigned int flags);
+	// Sums the size of each mip level of the bound texture as GL reports it.
+	static size_t measure(GLuint texture);
+
+	struct Entry
+	{
+		Key key;
+		int references;
+		size_t bytes;
+	};
+	// Adds a new texture with one reference, caller holds the lock.
+	void insert(const Key& key, GLuint texture);
+
+	std::mutex cacheMutex;
+	std::map<Key, GLuint> textures;
+	std::map<GLuint, Entry> entries;
+	size_t totalBytes;
+};
+
+#endif
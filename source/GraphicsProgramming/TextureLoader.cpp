@@ -0,0 +1,194 @@
+// Below ifdef required to remove warnings for unsafe version of fopen.
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "TextureLoader.h"
+#include "AtlasLayout.h"
+#include "GLExtensions.h"
+#include "DdsCache.h"
+#include "GLState.h"
+#include "BufferPool.h"
+#include "SOIL.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+const unsigned int TextureLoader::defaultFlags = SOIL_FLAG_MIPMAPS | SOIL_FLAG_NTSC_SAFE_RGB | SOIL_FLAG_COMPRESS_TO_DXT;
+
+bool TextureLoader::decode(const char* filename, unsigned int flags, DecodedImage& out)
+{
+	// Cooked copy, already mipmapped and compressed.
+	if ((flags & SOIL_FLAG_COMPRESS_TO_DXT) != 0 && DdsCache::load(filename, flags, out))
+	{
+		return true;
+	}
+
+	// Read the encoded file into a pooled buffer and decode from memory, so a batch of loads reuses the same few buffers.
+	FILE* file = fopen(filename, "rb");
+	if (file == NULL)
+	{
+		printf("SOIL loading error: 'Unable to open file' (%s)\n", filename);
+		return false;
+	}
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	BufferPool& pool = BufferPool::shared();
+	BufferPool::Buffer encoded = pool.acquire(size > 0 ? (size_t)size : 0);
+	bool read = size > 0 && fread(encoded.data(), 1, (size_t)size, file) == (size_t)size;
+	fclose(file);
+
+	out.pixels = read ? SOIL_load_image_from_memory(encoded.data(), (int)size, &out.width, &out.height, &out.channels, SOIL_LOAD_AUTO) : NULL;
+	pool.release(encoded);
+	if (out.pixels == NULL)
+	{
+		printf("SOIL loading error: '%s' (%s)\n", SOIL_last_result(), filename);
+		return false;
+	}
+	return true;
+}
+
+GLuint TextureLoader::uploadCompressed(const DecodedImage& image, unsigned int flags)
+{
+	int block = image.compressedFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT || image.compressedFormat == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT ? 8 : 16;
+
+	GLuint texture = 0;
+	glGenTextures(1, &texture);
+	GLState::bindTexture(texture);
+
+	size_t offset = 0;
+	int width = image.width, height = image.height;
+	for (int level = 0; level < image.levels; level++)
+	{
+		GLsizei size = (GLsizei)(((width + 3) / 4) * ((height + 3) / 4) * block);
+		GLExtensions::compressedTexImage2D(GL_TEXTURE_2D, level, image.compressedFormat, width, height, 0, size, &image.compressed[offset]);
+		offset += size;
+		width = width > 1 ? width / 2 : 1;
+		height = height > 1 ? height / 2 : 1;
+	}
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, image.levels - 1);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, image.levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	GLint wrap = (flags & SOIL_FLAG_TEXTURE_REPEATS) != 0 ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+	GLState::bindTexture(0);
+	return texture;
+}
+
+GLuint TextureLoader::upload(const DecodedImage& image, unsigned int flags, const char* filename)
+{
+	if (!image.compressed.empty())
+	{
+		return uploadCompressed(image, flags);
+	}
+	if (image.pixels == NULL)
+	{
+		return 0;
+	}
+
+	GLuint texture = SOIL_create_OGL_texture(image.pixels, image.width, image.height, image.channels, SOIL_CREATE_NEW_ID, flags);
+	GLState::forgetTexture();								// SOIL leaves its own binding
+	if (texture == 0)
+	{
+		printf("SOIL loading error: '%s'\n", SOIL_last_result());
+		return 0;
+	}
+
+	// Save the mip chain SOIL just compressed so the next run can skip it.
+	if (filename != NULL && (flags & SOIL_FLAG_COMPRESS_TO_DXT) != 0)
+	{
+		DdsCache::write(filename, flags, texture);
+	}
+	return texture;
+}
+
+void TextureLoader::release(DecodedImage& image)
+{
+	if (image.pixels != NULL)
+	{
+		SOIL_free_image_data(image.pixels);
+		image.pixels = NULL;
+	}
+	BufferPool::shared().release(image.compressed);
+}
+
+// Copies a texel of a decoded image out as RGBA.
+static void readTexel(const DecodedImage& image, int x, int y, unsigned char* rgba)
+{
+	const unsigned char* texel = image.pixels + ((size_t)y * image.width + x) * image.channels;
+	switch (image.channels)
+	{
+	case 1:
+		rgba[0] = rgba[1] = rgba[2] = texel[0];
+		rgba[3] = 255;
+		break;
+	case 2:
+		rgba[0] = rgba[1] = rgba[2] = texel[0];
+		rgba[3] = texel[1];
+		break;
+	case 3:
+		memcpy(rgba, texel, 3);
+		rgba[3] = 255;
+		break;
+	default:
+		memcpy(rgba, texel, 4);
+		break;
+	}
+}
+
+bool TextureLoader::decodeAtlas(const char* left, const char* right, DecodedImage& out)
+{
+	// Decoded without the DXT flag so there are always pixels to copy, the atlas itself is compressed on upload.
+	DecodedImage images[2];
+	if (!decode(left, 0, images[0]) || !decode(right, 0, images[1]))
+	{
+		release(images[0]);
+		return false;
+	}
+
+	// Halves are wide enough that the larger image keeps its width between the gutters.
+	int contentWidth = std::max(images[0].width, images[1].width);
+	int halfWidth = (int)ceil(contentWidth / (1.0f - 2.0f * AtlasLayout::gutter));
+	out.width = halfWidth * 2;
+	out.height = std::max(images[0].height, images[1].height);
+	out.channels = 4;
+	out.pixels = (unsigned char*)malloc((size_t)out.width * out.height * 4);
+
+	// Nearest sample each atlas texel at the same u as AtlasLayout::u maps it to, clamped into the image inside the gutters.
+	for (int half = 0; half < 2; half++)
+	{
+		const DecodedImage& image = images[half];
+		for (int x = 0; x < halfWidth; x++)
+		{
+			float u = ((x + 0.5f) / halfWidth - AtlasLayout::gutter) / (1.0f - 2.0f * AtlasLayout::gutter);
+			int sourceX = std::min(std::max((int)(u * image.width), 0), image.width - 1);
+			for (int y = 0; y < out.height; y++)
+			{
+				int sourceY = std::min((int)((y + 0.5f) / out.height * image.height), image.height - 1);
+				readTexel(image, sourceX, sourceY, out.pixels + ((size_t)y * out.width + half * halfWidth + x) * 4);
+			}
+		}
+	}
+
+	release(images[0]);
+	release(images[1]);
+	return true;
+}
+
+GLuint TextureLoader::load(const char* filename, unsigned int flags)
+{
+	DecodedImage image;
+	if (!decode(filename, flags, image))
+	{
+		return 0;
+	}
+	GLuint texture = upload(image, flags, filename);
+	release(image);
+	return texture;
+}
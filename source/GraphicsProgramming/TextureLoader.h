@@ -0,0 +1,60 @@
+// TextureLoader class, loads textures in two halves so decoding can happen away from the GL thread.
+// decode() reads and decompresses an image file and makes no GL calls, upload() creates the GL texture
+// from the decoded pixels and must be called on the thread owning the GL context.
+// DXT compressed textures are cooked to a DdsCache file on first upload, later decodes read that instead.
+#ifndef _TEXTURELOADER_H_
+#define _TEXTURELOADER_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <string>
+#include <vector>
+
+// Pixels decoded from an image file, in the file's own channel count,
+// or the compressed mip chain read from the texture's DdsCache file.
+struct DecodedImage
+{
+	DecodedImage() : pixels(NULL), width(0), height(0), channels(0), compressedFormat(0), levels(0) {};
+
+	unsigned char* pixels;				// NULL when loaded precompressed
+	int width;
+	int height;
+	int channels;
+
+	// Precompressed levels, largest first, used instead of pixels when not empty. Pooled, see BufferPool.
+	GLenum compressedFormat;
+	int levels;
+	std::vector<unsigned char> compressed;
+};
+
+class TextureLoader
+{
+
+public:
+	// Flags the scene's textures are loaded with.
+	static const unsigned int defaultFlags;
+
+	// Reads and decodes an image file, or its cooked copy when flags ask for DXT compression and the copy is up to date.
+	// Safe to call from any thread. File and compressed level buffers come from BufferPool::shared().
+	// Returns false if it couldn't be loaded.
+	static bool decode(const char* filename, unsigned int flags, DecodedImage& out);
+	// Creates a GL texture from decoded pixels using SOIL's flags (mipmaps, DXT compression etc). Returns 0 on failure.
+	// When filename is given and SOIL compressed the texture, the result is cooked for the next decode.
+	static GLuint upload(const DecodedImage& image, unsigned int flags, const char* filename = NULL);
+	// Frees decoded pixels, returning pooled buffers to the pool.
+	static void release(DecodedImage& image);
+
+	// Decodes two image files into one RGBA image, left in the left half and right in the right, each scaled to the
+	// larger height. Each half is inset by a gutter of its own edge texels, so neither picks up the other's texels
+	// when filtered or mipmapped, see AtlasLayout. Safe to call from any thread. Returns false if either couldn't be loaded.
+	static bool decodeAtlas(const char* left, const char* right, DecodedImage& out);
+
+	// decode() then upload(), all on the calling thread.
+	static GLuint load(const char* filename, unsigned int flags);
+
+private:
+	// Uploads a precompressed mip chain, setting the same filtering and wrapping SOIL would have.
+	static GLuint uploadCompressed(const DecodedImage& image, unsigned int flags);
+};
+
+#endif
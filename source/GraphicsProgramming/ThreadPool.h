@@ -0,0 +1,57 @@
+// ThreadPool class, a fixed set of worker threads which run queued tasks in submission order.
+// shared() returns a process wide pool sized to the number of hardware threads.
+#ifndef _THREADPOOL_H_
+#define _THREADPOOL_H_
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+
+class ThreadPool
+{
+
+public:
+	// 0 threads uses one per hardware thread.
+	ThreadPool(unsigned int threadCount = 0);
+	~ThreadPool();
+
+	// Process wide pool, created on first use.
+	static ThreadPool& shared();
+
+	unsigned int size() const { return (unsigned int)workers.size(); };
+
+	// Queues a task, the returned future holds its result.
+	template<typename F>
+	std::future<typename std::result_of<F()>::type> submit(F task)
+	{
+		typedef typename std::result_of<F()>::type Result;
+		std::shared_ptr<std::packaged_task<Result()> > packaged = std::make_shared<std::packaged_task<Result()> >(task);
+		std::future<Result> result = packaged->get_future();
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+			tasks.push_back([packaged]() { (*packaged)(); });
+		}
+		queueCondition.notify_one();
+		return result;
+	}
+
+private:
+	ThreadPool(const ThreadPool&);
+	ThreadPool& operator=(const ThreadPool&);
+
+	// Loop run by each worker thread.
+	void workerLoop();
+
+	std::vector<std::thread> workers;
+	std::deque<std::function<void()> > tasks;
+	std::mutex queueMutex;
+	std::condition_variable queueCondition;
+	bool stopping;
+};
+
+#endif
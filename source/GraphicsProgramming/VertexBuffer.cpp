@@ -0,0 +1,233 @@
+#include "VertexBuffer.h"
+#include "GLExtensions.h"
+#include <string.h>
+
+bool VertexBuffer::useBuffers = true;
+size_t VertexBuffer::totalBytes = 0;
+
+VertexBuffer::VertexBuffer() : vertexBuffer(0), indexBuffer(0), clientVertex(NULL), clientNormals(NULL), clientTexCoords(NULL),
+	clientIndices(NULL), vertexFormat(FloatArrays), count(0), bufferBytes(0)
+{
+}
+
+size_t VertexBuffer::vertexSize(Format format)
+{
+	return format == PackedInterleaved ? sizeof(PackedVertex) : 8 * sizeof(float);
+}
+
+unsigned int VertexBuffer::packNormal(float x, float y, float z)
+{
+	float components[3] = { x, y, z };
+	unsigned int result = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		float c = components[i] < -1.0f ? -1.0f : (components[i] > 1.0f ? 1.0f : components[i]);
+		int value = (int)(c * 511.0f + (c < 0 ? -0.5f : 0.5f));
+		result |= ((unsigned int)value & 0x3FF) << (i * 10);
+	}
+	return result;
+}
+
+unsigned short VertexBuffer::toHalf(float value)
+{
+	unsigned int bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	unsigned int sign = (bits >> 16) & 0x8000;
+	int exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+	unsigned int mantissa = bits & 0x7FFFFF;
+
+	if (exponent >= 31)
+	{
+		// Too big (or inf/nan), clamp to infinity.
+		return (unsigned short)(sign | 0x7C00);
+	}
+	if (exponent <= 0)
+	{
+		// Denormal or zero.
+		if (exponent < -10)
+		{
+			return (unsigned short)sign;
+		}
+		mantissa |= 0x800000;
+		int shift = 14 - exponent;
+		unsigned int half = mantissa >> shift;
+		if ((mantissa >> (shift - 1)) & 1)
+		{
+			half++;
+		}
+		return (unsigned short)(sign | half);
+	}
+
+	// A carry out of the mantissa when rounding correctly bumps the exponent.
+	unsigned int half = sign | ((unsigned int)exponent << 10) | (mantissa >> 13);
+	if (mantissa & 0x1000)
+	{
+		half++;
+	}
+	return (unsigned short)half;
+}
+
+VertexBuffer::~VertexBuffer()
+{
+	destroy();
+}
+
+void VertexBuffer::create(const float* vertex, const float* normals, const float* texCoords, int vertexCount,
+	const void* indices, size_t indexBytes, Format format)
+{
+	destroy();
+
+	clientVertex = vertex;
+	clientNormals = normals;
+	clientTexCoords = texCoords;
+	clientIndices = indices;
+	count = vertexCount;
+
+	GLExtensions::load();
+	vertexFormat = format == PackedInterleaved && GLExtensions::packedVertices ? PackedInterleaved : FloatArrays;
+
+	if (vertexFormat == PackedInterleaved)
+	{
+		packed.resize(vertexCount);
+		for (int i = 0; i < vertexCount; i++)
+		{
+			PackedVertex& out = packed[i];
+			out.position[0] = vertex[i * 3];
+			out.position[1] = vertex[i * 3 + 1];
+			out.position[2] = vertex[i * 3 + 2];
+			out.normal = packNormal(normals[i * 3], normals[i * 3 + 1], normals[i * 3 + 2]);
+			out.texCoord[0] = toHalf(texCoords[i * 2]);
+			out.texCoord[1] = toHalf(texCoords[i * 2 + 1]);
+		}
+	}
+
+	if (!GLExtensions::vertexBuffers || vertexCount == 0)
+	{
+		return;
+	}
+
+	GLExtensions::genBuffers(1, &vertexBuffer);
+	GLExtensions::bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+	if (vertexFormat == PackedInterleaved)
+	{
+		bufferBytes = packed.size() * sizeof(PackedVertex);
+		GLExtensions::bufferData(GL_ARRAY_BUFFER, bufferBytes, packed.data(), GL_STATIC_DRAW);
+	}
+	else
+	{
+		// One buffer with the three arrays back to back, in the same layout as Mesh and the mesh cache.
+		size_t positionBytes = (size_t)vertexCount * 3 * sizeof(float);
+		size_t texCoordBytes = (size_t)vertexCount * 2 * sizeof(float);
+		bufferBytes = positionBytes * 2 + texCoordBytes;
+		GLExtensions::bufferData(GL_ARRAY_BUFFER, bufferBytes, NULL, GL_STATIC_DRAW);
+		GLExtensions::bufferSubData(GL_ARRAY_BUFFER, 0, positionBytes, vertex);
+		GLExtensions::bufferSubData(GL_ARRAY_BUFFER, positionBytes, positionBytes, normals);
+		GLExtensions::bufferSubData(GL_ARRAY_BUFFER, positionBytes * 2, texCoordBytes, texCoords);
+	}
+	GLExtensions::bindBuffer(GL_ARRAY_BUFFER, 0);
+
+	if (indices != NULL && indexBytes > 0)
+	{
+		GLExtensions::genBuffers(1, &indexBuffer);
+		GLExtensions::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+		GLExtensions::bufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, indices, GL_STATIC_DRAW);
+		GLExtensions::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		bufferBytes += indexBytes;
+	}
+	totalBytes += bufferBytes;
+}
+
+void VertexBuffer::destroy()
+{
+	if (vertexBuffer != 0)
+	{
+		GLExtensions::deleteBuffers(1, &vertexBuffer);
+		vertexBuffer = 0;
+	}
+	if (indexBuffer != 0)
+	{
+		GLExtensions::deleteBuffers(1, &indexBuffer);
+		indexBuffer = 0;
+	}
+	totalBytes -= bufferBytes;
+	bufferBytes = 0;
+	clientVertex = clientNormals = clientTexCoords = NULL;
+	clientIndices = NULL;
+	std::vector<PackedVertex>().swap(packed);
+	vertexFormat = FloatArrays;
+	count = 0;
+}
+
+void VertexBuffer::bind() const
+{
+	glEnableClientState(GL_VERTEX_ARRAY);				// Enable vertex arrays
+	glEnableClientState(GL_NORMAL_ARRAY);				// Enable normal arrays
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);		// Enable texture co-ords arrays
+
+	if (vertexFormat == PackedInterleaved)
+	{
+		// Interleaved, pointers are offsets into a PackedVertex from either the buffer or the client copy.
+		const char* base = NULL;
+		if (buffered())
+		{
+			GLExtensions::bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+			if (indexBuffer != 0)
+			{
+				GLExtensions::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+			}
+		}
+		else
+		{
+			base = (const char*)packed.data();
+		}
+		glVertexPointer(3, GL_FLOAT, sizeof(PackedVertex), base + offsetof(PackedVertex, position));
+		glNormalPointer(GL_INT_2_10_10_10_REV, sizeof(PackedVertex), base + offsetof(PackedVertex, normal));
+		glTexCoordPointer(2, GL_HALF_FLOAT, sizeof(PackedVertex), base + offsetof(PackedVertex, texCoord));
+		return;
+	}
+
+	if (buffered())
+	{
+		// Pointers become byte offsets into the bound buffer.
+		size_t positionBytes = (size_t)count * 3 * sizeof(float);
+		GLExtensions::bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+		glVertexPointer(3, GL_FLOAT, 0, (const void*)0);
+		glNormalPointer(GL_FLOAT, 0, (const void*)positionBytes);
+		glTexCoordPointer(2, GL_FLOAT, 0, (const void*)(positionBytes * 2));
+		if (indexBuffer != 0)
+		{
+			GLExtensions::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+		}
+		return;
+	}
+
+	glVertexPointer(3, GL_FLOAT, 0, clientVertex);				// Pointer to vertex array
+	glNormalPointer(GL_FLOAT, 0, clientNormals);				// Pointer to normals array
+	glTexCoordPointer(2, GL_FLOAT, 0, clientTexCoords);		// Pointer to texture co-ords array
+}
+
+void VertexBuffer::unbind() const
+{
+	glDisableClientState(GL_VERTEX_ARRAY);				// Disable vertex arrays
+	glDisableClientState(GL_NORMAL_ARRAY);				// Disable normal arrays
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);		// Disable texture co-ords arrays
+
+	if (buffered())
+	{
+		GLExtensions::bindBuffer(GL_ARRAY_BUFFER, 0);
+		if (indexBuffer != 0)
+		{
+			GLExtensions::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		}
+	}
+}
+
+const void* VertexBuffer::indices(size_t byteOffset) const
+{
+	if (buffered() && indexBuffer != 0)
+	{
+		return (const void*)byteOffset;
+	}
+	return (const char*)clientIndices + byteOffset;
+}
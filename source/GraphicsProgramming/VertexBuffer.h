@@ -0,0 +1,89 @@
+// VertexBuffer class, uploads a mesh's vertex, normal, texture co-ordinate and index arrays once into static
+// GL buffers so they aren't copied across to the GPU on every draw.
+// The client side arrays are remembered as well, useBuffers switches between the two at runtime for comparison,
+// and they're used as is when the driver has no vertex buffer support.
+// Each buffer can instead hold a packed interleaved copy of the vertices, see Format.
+#ifndef _VERTEXBUFFER_H_
+#define _VERTEXBUFFER_H_
+
+#include "glut.h"
+#include <gl/gl.h>
+#include <stddef.h>
+#include <vector>
+
+class VertexBuffer
+{
+
+public:
+	enum Format
+	{
+		// Separate float arrays, 3 position, 3 normal, 2 texture co-ordinate. 32 bytes a vertex.
+		FloatArrays,
+		// One interleaved PackedVertex per vertex. 20 bytes a vertex, falls back to FloatArrays without GL support.
+		PackedInterleaved
+	};
+
+	// float3 position, normal as signed normalised GL_INT_2_10_10_10_REV, texture co-ordinate as two halfs.
+	struct PackedVertex
+	{
+		float position[3];
+		unsigned int normal;
+		unsigned short texCoord[2];
+	};
+
+	VertexBuffer();
+	~VertexBuffer();
+
+	// Points at the arrays and uploads them. Must be on the GL thread, the arrays must outlive this object.
+	// Positions and normals are 3 floats per vertex, texture co-ordinates 2. indices may be NULL for glDrawArrays.
+	void create(const float* vertex, const float* normals, const float* texCoords, int vertexCount,
+		const void* indices = NULL, size_t indexBytes = 0, Format format = FloatArrays);
+	// Deletes the GL buffers and forgets the arrays.
+	void destroy();
+
+	// Enables the vertex, normal and texture co-ordinate arrays and points them at the buffer or the client arrays.
+	void bind() const;
+	// Disables the arrays and unbinds the buffers.
+	void unbind() const;
+	// Pointer to pass glDrawElements for the index byteOffset bytes in.
+	const void* indices(size_t byteOffset) const;
+
+	int vertexCount() const { return count; };
+	// Format actually in use, which may differ from the one asked for.
+	Format format() const { return vertexFormat; };
+	// Bytes held in GL buffers.
+	size_t memoryUsage() const { return bufferBytes; };
+
+	// Bytes per vertex in a format.
+	static size_t vertexSize(Format format);
+	// Packs a unit normal into signed normalised 2_10_10_10, w = 0.
+	static unsigned int packNormal(float x, float y, float z);
+	// Converts a float to IEEE half precision, rounding to nearest.
+	static unsigned short toHalf(float value);
+
+	// True to draw from the buffers, false for client arrays.
+	static bool useBuffers;
+	// Bytes held in GL buffers by every VertexBuffer.
+	static size_t totalMemoryUsage() { return totalBytes; };
+
+private:
+	VertexBuffer(const VertexBuffer&);
+	VertexBuffer& operator=(const VertexBuffer&);
+
+	bool buffered() const { return useBuffers && vertexBuffer != 0; };
+
+	GLuint vertexBuffer, indexBuffer;
+	const float* clientVertex;
+	const float* clientNormals;
+	const float* clientTexCoords;
+	const void* clientIndices;
+	// Client side copy of the packed vertices, drawn from when buffers are off.
+	std::vector<PackedVertex> packed;
+	Format vertexFormat;
+	int count;
+	size_t bufferBytes;
+
+	static size_t totalBytes;
+};
+
+#endif
@@ -0,0 +1,164 @@
+// MeshCheck entry point.
+// Checks that usemtl names survive Mesh and the mesh cache whole, so each submesh still finds its MTL material.
+// Writes an OBJ and MTL pair whose material names are longer than 64 characters, two of them differing only at
+// the end, builds the mesh, cooks and reloads its cache and matches each submesh's name against the MTL's newmtl
+// names. Returns non-zero on any mismatch.
+// Usage: MeshCheck
+
+// Below ifdef required to remove warnings for unsafe version of fopen.
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Mesh.h"
+#include "MeshCache.h"
+
+static const char* objFilename = "meshcheck_materials.obj";
+static const char* mtlFilename = "meshcheck_materials.mtl";
+
+// Materials of the test pair, one per quad. The long two share their first 90 characters.
+static std::vector<std::string> materialNames()
+{
+	std::string prefix = "Exported_Scene_Root/Tram_Interior_Seating_Fabric_Worn_Blue_Variant_With_Extra_Long_Name_";
+	std::vector<std::string> names;
+	names.push_back(prefix + "Left");
+	names.push_back(prefix + "Right");
+	names.push_back("short");
+	return names;
+}
+
+// Writes a strip of quads, one per material, and the MTL naming each material with its own diffuse colour.
+static bool writeFiles(const std::vector<std::string>& names)
+{
+	FILE* obj = fopen(objFilename, "w");
+	FILE* mtl = fopen(mtlFilename, "w");
+	if (obj == NULL || mtl == NULL)
+	{
+		if (obj != NULL)
+		{
+			fclose(obj);
+		}
+		if (mtl != NULL)
+		{
+			fclose(mtl);
+		}
+		return false;
+	}
+
+	fprintf(obj, "mtllib %s\n", mtlFilename);
+	for (size_t i = 0; i <= names.size(); i++)
+	{
+		fprintf(obj, "v %d 0 0\nv %d 1 0\n", (int)i, (int)i);
+		fprintf(obj, "vt %d 0\nvt %d 1\n", (int)i, (int)i);
+	}
+	fprintf(obj, "vn 0 0 1\n");
+	for (size_t i = 0; i < names.size(); i++)
+	{
+		int a = (int)i * 2 + 1;
+		fprintf(obj, "usemtl %s\n", names[i].c_str());
+		fprintf(obj, "f %d/%d/1 %d/%d/1 %d/%d/1\n", a, a, a + 2, a + 2, a + 1, a + 1);
+		fprintf(obj, "f %d/%d/1 %d/%d/1 %d/%d/1\n", a + 1, a + 1, a + 2, a + 2, a + 3, a + 3);
+		fprintf(mtl, "newmtl %s\nKd %d 0 0\n\n", names[i].c_str(), (int)i);
+	}
+	fclose(obj);
+	fclose(mtl);
+	return true;
+}
+
+// newmtl names in file order, read the way Model::loadMTL does, the rest of the line with its ends trimmed.
+static std::vector<std::string> readMtlNames(const char* filename)
+{
+	std::vector<std::string> names;
+	FILE* file = fopen(filename, "r");
+	if (file == NULL)
+	{
+		return names;
+	}
+	char line[512];
+	while (fgets(line, sizeof(line), file) != NULL)
+	{
+		if (strncmp(line, "newmtl", 6) != 0)
+		{
+			continue;
+		}
+		std::string name = line + 6;
+		name.erase(0, name.find_first_not_of(" \t"));
+		name.erase(name.find_last_not_of(" \t\r\n") + 1);
+		names.push_back(name);
+	}
+	fclose(file);
+	return names;
+}
+
+// Checks each submesh of a view names one MTL material, and the two triangles of each quad get the quad's.
+static bool checkView(const char* source, const MeshView& view, const std::vector<std::string>& mtlNames)
+{
+	bool passed = view.subMeshCount == (int)mtlNames.size();
+	for (int i = 0; i < view.subMeshCount && passed; i++)
+	{
+		const SubMesh& subMesh = view.subMeshes[i];
+		int found = -1;
+		if (subMesh.material >= 0 && subMesh.material < (int)view.materialNames.size())
+		{
+			for (size_t m = 0; m < mtlNames.size(); m++)
+			{
+				if (mtlNames[m] == view.materialNames[subMesh.material])
+				{
+					found = (int)m;
+				}
+			}
+		}
+
+		// Quad m's corners sit at x = m and m + 1, so its material is the smallest x of the submesh's first triangle.
+		const unsigned int* indices32 = (const unsigned int*)view.indices;
+		const unsigned short* indices16 = (const unsigned short*)view.indices;
+		float x = 1e9f;
+		for (unsigned int c = subMesh.firstIndex; c < subMesh.firstIndex + 3; c++)
+		{
+			unsigned int v = view.shortIndices ? indices16[c] : indices32[c];
+			x = x < view.vertex[v * 3] ? x : view.vertex[v * 3];
+		}
+		printf("%8s submesh %d: %d triangles, material %d '%s'\n", source, i, (int)subMesh.indexCount / 3, found,
+			subMesh.material >= 0 && subMesh.material < (int)view.materialNames.size() ? view.materialNames[subMesh.material] : "");
+		passed = found >= 0 && found == (int)x && subMesh.indexCount == 6;
+	}
+	return passed;
+}
+
+int main()
+{
+	std::vector<std::string> names = materialNames();
+	if (!writeFiles(names))
+	{
+		printf("Failed to write %s\n", objFilename);
+		return 1;
+	}
+	std::vector<std::string> mtlNames = readMtlNames(mtlFilename);
+
+	ObjData obj;
+	Mesh mesh;
+	bool passed = ObjParser::parseFile(objFilename, obj) && mesh.buildFromObj(obj);
+	passed = passed && checkView("parsed", mesh.view(), mtlNames);
+
+	// Cooked and mapped back, the names then come from the cache's table.
+	passed = passed && MeshCache::write(objFilename, mesh);
+	MappedFile file;
+	MeshView view;
+	passed = passed && MeshCache::load(objFilename, file, view);
+	passed = passed && checkView("cached", view, mtlNames);
+	file.close();
+
+	remove(MeshCache::cachePath(objFilename).c_str());
+	remove(objFilename);
+	remove(mtlFilename);
+	if (!passed)
+	{
+		printf("Material names were not kept whole\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,84 @@
+// MeshTool entry point.
+// Runs MeshOptimizer over cooked mesh caches offline and reports the average cache miss ratio (ACMR) before and after,
+// so cooked meshes can be checked, or re-optimised after MeshOptimizer changes, without loading the scene.
+// Usage: MeshTool [--report] <file.meshcache|file.obj>...
+// An OBJ argument works on the cache next to it. With --report the files are only measured, not rewritten.
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <chrono>
+#include "MeshCache.h"
+#include "MeshOptimizer.h"
+
+// Optimises one cache file, returns false if it couldn't be read or written.
+static bool processFile(const char* argument, bool reportOnly)
+{
+	std::string path = argument;
+	size_t length = path.size();
+	if (length > 4 && (path.compare(length - 4, 4, ".obj") == 0 || path.compare(length - 4, 4, ".OBJ") == 0))
+	{
+		path = MeshCache::cachePath(argument);
+	}
+
+	MappedFile file;
+	MeshView view;
+	if (!MeshCache::loadFile(path.c_str(), file, view))
+	{
+		printf("%s: not a valid version %u mesh cache\n", path.c_str(), MeshCache::version);
+		return false;
+	}
+	MeshCacheHeader source = *(const MeshCacheHeader*)file.data();
+	Mesh mesh;
+	mesh.copyFrom(view);
+	// Unmap before writing, the file can't be replaced while it is mapped.
+	file.close();
+
+	float before = MeshOptimizer::acmr(mesh);
+	auto start = std::chrono::high_resolution_clock::now();
+	MeshOptimizer::optimize(mesh);
+	double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	mesh.compactIndices();
+	float after = MeshOptimizer::acmr(mesh);
+
+	printf("%s: %d vertices, %d triangles, %d submeshes, ACMR %.3f -> %.3f (%.1f ms)\n", path.c_str(),
+		mesh.vertexCount(), mesh.indexCount() / 3, (int)mesh.subMeshes.size(), before, after, ms);
+
+	if (reportOnly)
+	{
+		return true;
+	}
+	if (!MeshCache::writeFile(path.c_str(), mesh, source))
+	{
+		printf("%s: could not write cache\n", path.c_str());
+		return false;
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	bool reportOnly = false;
+	int files = 0;
+	int failed = 0;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--report") == 0)
+		{
+			reportOnly = true;
+			continue;
+		}
+		files++;
+		if (!processFile(argv[i], reportOnly))
+		{
+			failed++;
+		}
+	}
+
+	if (files == 0)
+	{
+		printf("Usage: MeshTool [--report] <file.meshcache|file.obj>...\n");
+		return 1;
+	}
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+// ShapeBake entry point.
+// Generates the scene's sphere, cylinder, torus, tram rail and wall with ShapeGen and writes them as C++ tables to
+// BakedTables.inl, which BakedShapes.cpp compiles into BakedTables. They're too large to bake at compile time as
+// BakedShapes does the disc, so they're baked here and the output is checked in. Rerun after changing ShapeGen.
+// Usage: ShapeBake [--check] <BakedTables.inl>
+// With --check the file is only compared with what would be written, returning non-zero if it's out of date.
+// The round shapes' sines and cosines come from the C runtime, so another one may change a last digit, which --check
+// also reports.
+
+// Below ifdef required to remove warnings for unsafe version of fopen.
+#ifdef _MSC_VER
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "ShapeGen.h"
+
+// Values per line of the tables.
+static const int floatsPerLine = 8;
+static const int indicesPerLine = 16;
+
+// Shortest float literal that reads back as exactly value.
+static std::string floatLiteral(float value)
+{
+	char text[32];
+	for (int precision = 6; precision <= 9; precision++)
+	{
+		snprintf(text, sizeof(text), "%.*g", precision, value);
+		if (strtof(text, NULL) == value)
+		{
+			break;
+		}
+	}
+	std::string literal = text;
+	if (literal.find_first_of(".e") == std::string::npos)
+	{
+		literal += ".0";
+	}
+	return literal + "f";
+}
+
+// Appends one static table, values wrapped a line at a time.
+static void writeTable(std::string& out, const char* type, const std::string& name, const std::vector<std::string>& values, int perLine)
+{
+	out += "static const " + std::string(type) + " " + name + "[" + std::to_string(values.size()) + "] =\n{";
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		out += i % perLine == 0 ? "\n\t" : " ";
+		out += values[i];
+		out += i + 1 < values.size() ? "," : "";
+	}
+	out += "\n};\n";
+}
+
+// Appends a float table.
+static void writeFloats(std::string& out, const std::string& name, const float* values, size_t count)
+{
+	std::vector<std::string> literals;
+	for (size_t i = 0; i < count; i++)
+	{
+		literals.push_back(floatLiteral(values[i]));
+	}
+	writeTable(out, "float", name, literals, floatsPerLine);
+}
+
+// Appends a GLuint index table.
+static void writeIndices(std::string& out, const std::string& name, const std::vector<unsigned int>& values)
+{
+	std::vector<std::string> literals;
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		literals.push_back(std::to_string(values[i]));
+	}
+	writeTable(out, "GLuint", name, literals, indicesPerLine);
+}
+
+// Appends a shape's tables and the BakedTables function returning them. indices is empty for shapes drawn as quads.
+static void writeShape(std::string& out, const char* name, const char* source, float radius, float segments, const std::vector<Vector3>& vertex,
+	const std::vector<Vector3>& normals, const std::vector<float>& texCoords, const std::vector<unsigned int>& indices)
+{
+	std::string prefix = name;
+	out += "\n// " + std::string(source) + "\n";
+	writeFloats(out, prefix + "Vertex", &vertex[0].x, vertex.size() * 3);
+	writeFloats(out, prefix + "Normals", &normals[0].x, normals.size() * 3);
+	writeFloats(out, prefix + "TexCoords", texCoords.data(), texCoords.size());
+	if (!indices.empty())
+	{
+		writeIndices(out, prefix + "Indices", indices);
+	}
+
+	out += "\nShapeArrays BakedTables::" + prefix + "()\n{\n";
+	out += "\tShapeArrays arrays = { " + prefix + "Vertex, " + prefix + "Normals, " + prefix + "TexCoords, ";
+	out += indices.empty() ? "NULL, " : prefix + "Indices, ";
+	out += std::to_string(vertex.size()) + ", " + std::to_string(indices.size()) + ", " + floatLiteral(radius) + ", " + floatLiteral(segments) + " };\n";
+	out += "\treturn arrays;\n}\n";
+}
+
+// The whole of BakedTables.inl, the sizes Scene uses.
+static std::string bakeTables()
+{
+	std::string out = "// Generated by ShapeBake from ShapeGen, do not edit. Rerun ShapeBake after changing ShapeGen.\n";
+	out += "// Included once, by BakedShapes.cpp.\n";
+
+	std::vector<Vector3> vertex, normals;
+	std::vector<float> texCoords, atlasTexCoords;
+	std::vector<unsigned int> indices, noIndices;
+
+	ShapeGen::genSphere(1.0f, 20.0f, vertex, normals, texCoords, indices);
+	writeShape(out, "sphere", "ShapeGen::genSphere(1, 20)", 1.0f, 20.0f, vertex, normals, texCoords, indices);
+	ShapeGen::genCylinder(1.0f, 24.0f, 24.0f, vertex, normals, texCoords, indices);
+	writeShape(out, "cylinder", "ShapeGen::genCylinder(1, 24, 24)", 1.0f, 24.0f, vertex, normals, texCoords, indices);
+	ShapeGen::genTorus(0.325f, 24.0f, vertex, normals, texCoords, indices);
+	writeShape(out, "torus", "ShapeGen::genTorus(0.325, 24)", 0.325f, 24.0f, vertex, normals, texCoords, indices);
+	ShapeGen::genPlane(1.0f, 20.0f, vertex, normals, texCoords);
+	writeShape(out, "plane", "ShapeGen::genPlane(1, 20)", 1.0f, 20.0f, vertex, normals, texCoords, noIndices);
+
+	ShapeGen::genCuboid(1.0f, 20.0f, vertex, normals, texCoords, atlasTexCoords);
+	writeShape(out, "cuboid", "ShapeGen::genCuboid(1, 20)", 1.0f, 20.0f, vertex, normals, texCoords, noIndices);
+	out += "\n";
+	writeFloats(out, "cuboidAtlas", atlasTexCoords.data(), atlasTexCoords.size());
+	out += "\nconst float* BakedTables::cuboidAtlasTexCoords()\n{\n\treturn cuboidAtlas;\n}\n";
+
+	ShapeGen::genWall(1.0f, 20.0f, &ShapeGen::doorway, 1, vertex, normals, texCoords);
+	writeShape(out, "wall", "ShapeGen::genWall(1, 20, &ShapeGen::doorway, 1)", 1.0f, 20.0f, vertex, normals, texCoords, noIndices);
+	return out;
+}
+
+// Whole contents of a file, false if it can't be read.
+static bool readFile(const char* filename, std::string& contents)
+{
+	FILE* file = fopen(filename, "rb");
+	if (!file)
+	{
+		return false;
+	}
+	char buffer[65536];
+	size_t read;
+	contents.clear();
+	while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+	{
+		contents.append(buffer, read);
+	}
+	fclose(file);
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	bool check = false;
+	const char* filename = NULL;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--check") == 0)
+		{
+			check = true;
+			continue;
+		}
+		filename = argv[i];
+	}
+	if (!filename)
+	{
+		printf("Usage: ShapeBake [--check] <BakedTables.inl>\n");
+		return 1;
+	}
+
+	std::string tables = bakeTables();
+	if (check)
+	{
+		std::string current;
+		if (!readFile(filename, current) || current != tables)
+		{
+			printf("%s: out of date, rerun ShapeBake\n", filename);
+			return 1;
+		}
+		printf("%s: up to date\n", filename);
+		return 0;
+	}
+
+	// Binary so the file keeps the repo's line endings on every platform.
+	FILE* file = fopen(filename, "wb");
+	if (!file || fwrite(tables.data(), 1, tables.size(), file) != tables.size())
+	{
+		printf("%s: could not write\n", filename);
+		if (file)
+		{
+			fclose(file);
+		}
+		return 1;
+	}
+	fclose(file);
+	printf("%s: %u bytes\n", filename, (unsigned int)tables.size());
+	return 0;
+}
@@ -0,0 +1,364 @@
+// ShapeCheck entry point.
+// Checks that ShapeGen's indexed sphere, cylinder and torus grids draw the same surface as the GL_QUADS generators
+// they replaced. Each old quad must be the two triangles of its grid cell with the same winding, and every corner's
+// position, normal and texture co-ordinate must match. Returns non-zero on any mismatch.
+// Usage: ShapeCheck
+
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#include "ShapeGen.h"
+
+#define PI 3.14159265
+
+// Furthest any attribute may be from the old one, the grids share angles but not every rounding.
+static const float tolerance = 1e-5f;
+
+// Old GL_QUADS sphere, four corners per quad.
+static void quadSphere(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords)
+{
+	float r = radius;
+
+	Vector3 sVerts;
+	Vector3 sNorms;
+
+	for (int lon = 0; lon < segments; lon++)
+	{
+		float delta = (lon*PI) / (segments);			// Angle of longitude
+
+		for (int lat = 0; lat < segments; lat++)
+		{
+			float theta = (lat*2 * PI) / (segments);	// Angle of latitude
+			sVerts.x = (r*cos(theta))*(sin(delta));
+			sVerts.y = r*cos(delta);
+			sVerts.z = (r*sin(theta))*(sin(delta));
+			vertex.push_back(sVerts);
+			sNorms = sVerts;
+			sNorms.x = sNorms.x / r;
+			sNorms.y = sNorms.y / r;
+			sNorms.z = sNorms.z / r;
+			normals.push_back(sNorms);
+
+			lon++;
+			delta = (lon*PI) / (segments);
+			sVerts.x = (r*cos(theta))*(sin(delta));
+			sVerts.y = r*cos(delta);
+			sVerts.z = (r*sin(theta))*(sin(delta));
+			vertex.push_back(sVerts);
+			sNorms = sVerts;
+			sNorms.x = sNorms.x / r;
+			sNorms.y = sNorms.y / r;
+			sNorms.z = sNorms.z / r;
+			normals.push_back(sNorms);
+
+			lat++;
+			theta = (lat * 2 * PI) / (segments);
+			sVerts.x = (r*cos(theta))*(sin(delta));
+			sVerts.y = r*cos(delta);
+			sVerts.z = (r*sin(theta))*(sin(delta));
+			vertex.push_back(sVerts);
+			sNorms = sVerts;
+			sNorms.x = sNorms.x / r;
+			sNorms.y = sNorms.y / r;
+			sNorms.z = sNorms.z / r;
+			normals.push_back(sNorms);
+
+			lon--;
+			delta = (lon*PI) / (segments);
+			sVerts.x = (r*cos(theta))*(sin(delta));
+			sVerts.y = r*cos(delta);
+			sVerts.z = (r*sin(theta))*(sin(delta));
+			vertex.push_back(sVerts);
+			sNorms = sVerts;
+			sNorms.x = sNorms.x / r;
+			sNorms.y = sNorms.y / r;
+			sNorms.z = sNorms.z / r;
+			normals.push_back(sNorms);
+			lat--;
+
+			float u1 = 0 + (lat * (1 / (segments)));
+			float v1 = 0 + (lon * (1 / (segments)));
+			float u2 = u1;
+			float v2 = v1 + (1 / (segments));
+			float u3 = u2 + (1 / (segments));
+			float v3 = v2;
+			float u4 = u3;
+			float v4 = v1;
+			texCoords.push_back(u1);
+			texCoords.push_back(v1);
+			texCoords.push_back(u2);
+			texCoords.push_back(v2);
+			texCoords.push_back(u3);
+			texCoords.push_back(v3);
+			texCoords.push_back(u4);
+			texCoords.push_back(v4);
+		}
+	}
+
+}
+
+// Old GL_QUADS cylinder, four corners per quad.
+static void quadCylinder(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords)
+{
+	float r = radius;
+
+	Vector3 cVerts;
+	Vector3 cNorms;
+
+	for (int column = 0; column < segments; column++)
+	{
+		for (int stacks = 0; stacks < segments; stacks++)
+		{
+			float theta = (stacks * 2 * PI) / (segments);	// Angle of latitude
+			cVerts.x = r*cos(theta);
+			cVerts.y = r*sin(theta);
+			cVerts.z = column;
+			vertex.push_back(cVerts);
+			cNorms = cVerts;
+			cNorms.x = cNorms.x / r;
+			cNorms.y = cNorms.y / r;
+			cNorms.z = cNorms.z / r;
+			normals.push_back(cNorms);
+
+			stacks++;
+			theta = (stacks * 2 * PI) / (segments);
+			cVerts.x = r*cos(theta);
+			cVerts.y = r*sin(theta);
+			cVerts.z = column;
+			vertex.push_back(cVerts);
+			cNorms = cVerts;
+			cNorms.x = cNorms.x / r;
+			cNorms.y = cNorms.y / r;
+			cNorms.z = cNorms.z / r;
+			normals.push_back(cNorms);
+			stacks--;
+
+			stacks++;
+			theta = (stacks * 2 * PI) / (segments);
+			cVerts.x = r*cos(theta);
+			cVerts.y = r*sin(theta);
+			column++;
+			cVerts.z = column;
+			vertex.push_back(cVerts);
+			cNorms = cVerts;
+			cNorms.x = cNorms.x / r;
+			cNorms.y = cNorms.y / r;
+			cNorms.z = cNorms.z / r;
+			normals.push_back(cNorms);
+
+			stacks--;
+			theta = (stacks * 2 * PI) / (segments);
+			cVerts.x = r*cos(theta);
+			cVerts.y = r*sin(theta);
+			cVerts.z = column;
+			vertex.push_back(cVerts);
+			cNorms = cVerts;
+			cNorms.x = cNorms.x / r;
+			cNorms.y = cNorms.y / r;
+			cNorms.z = cNorms.z / r;
+			normals.push_back(cNorms);
+			column--;
+
+			float u1 = 1 - (stacks * (1 / (segments)));
+			float v1 = 0 + (column/segments);
+			float u2 = u1;
+			float v2 = v1 + (1 / (segments));
+			float u3 = u2 - (1 / (segments));
+			float v3 = v2;
+			float u4 = u3;
+			float v4 = v1;
+			texCoords.push_back(u1);
+			texCoords.push_back(v1);
+			texCoords.push_back(u4);
+			texCoords.push_back(v4);
+			texCoords.push_back(u3);
+			texCoords.push_back(v3);
+			texCoords.push_back(u2);
+			texCoords.push_back(v2);
+		}
+	}
+
+}
+
+// Old GL_QUADS torus, four corners per quad.
+static void quadTorus(float radius, float segments, std::vector<Vector3>& vertex, std::vector<Vector3>& normals, std::vector<float>& texCoords)
+{
+	float r = radius;	// Minor radius
+	float R = 2 * r;	// Major radius
+
+	Vector3 tVerts;
+	Vector3 tNorms;
+
+	for (int column = 0; column < segments; column++)
+	{
+		float delta = (column*2*PI) / (segments);			// Angle of longitude
+		for (int stacks = 0; stacks < segments; stacks++)
+		{
+			float theta = (stacks * 2 * PI) / (segments);	// Angle of latitude
+			tVerts.x = ((R + (r*cos(theta)))*(cos(delta)));
+			tVerts.y = ((R + (r*cos(theta)))*(sin(delta)));
+			tVerts.z = (r*sin(theta));
+			vertex.push_back(tVerts);
+			tNorms = tVerts;
+			tNorms.x = tNorms.x / r;
+			tNorms.y = tNorms.y / r;
+			tNorms.z = tNorms.z / r;
+			normals.push_back(tNorms);
+
+			column++;
+			delta = (column * 2 * PI) / (segments);
+			tVerts.x = ((R + (r*cos(theta)))*(cos(delta)));
+			tVerts.y = ((R + (r*cos(theta)))*(sin(delta)));
+			tVerts.z = (r*sin(theta));
+			vertex.push_back(tVerts);
+			tNorms = tVerts;
+			tNorms.x = tNorms.x / r;
+			tNorms.y = tNorms.y / r;
+			tNorms.z = tNorms.z / r;
+			normals.push_back(tNorms);
+
+			stacks++;
+			theta = (stacks * 2 * PI) / (segments);
+			tVerts.x = ((R + (r*cos(theta)))*(cos(delta)));
+			tVerts.y = ((R + (r*cos(theta)))*(sin(delta)));
+			tVerts.z = (r*sin(theta));
+			vertex.push_back(tVerts);
+			tNorms = tVerts;
+			tNorms.x = tNorms.x / r;
+			tNorms.y = tNorms.y / r;
+			tNorms.z = tNorms.z / r;
+			normals.push_back(tNorms);
+
+			column--;
+			delta = (column * 2 * PI) / (segments);
+			tVerts.x = ((R + (r*cos(theta)))*(cos(delta)));
+			tVerts.y = ((R + (r*cos(theta)))*(sin(delta)));
+			tVerts.z = (r*sin(theta));
+			vertex.push_back(tVerts);
+			tNorms = tVerts;
+			tNorms.x = tNorms.x / r;
+			tNorms.y = tNorms.y / r;
+			tNorms.z = tNorms.z / r;
+			normals.push_back(tNorms);
+			stacks--;
+
+			float u1 = 0 + (column / segments);
+			float v1 = 1 - (stacks * (1 / (segments)));
+			float u2 = u1;
+			float v2 = v1 - (1 / (segments));
+			float u3 = u2 + (1 / (segments));
+			float v3 = v2;
+			float u4 = u3;
+			float v4 = v1;
+			texCoords.push_back(u1);
+			texCoords.push_back(v1);
+			texCoords.push_back(u4);
+			texCoords.push_back(v4);
+			texCoords.push_back(u3);
+			texCoords.push_back(v3);
+			texCoords.push_back(u2);
+			texCoords.push_back(v2);
+		}
+	}
+
+}
+
+// Largest difference over the components of two vectors.
+static float difference(const Vector3& a, const Vector3& b)
+{
+	return fmaxf(fabsf(a.x - b.x), fmaxf(fabsf(a.y - b.y), fabsf(a.z - b.z)));
+}
+
+// Compares old quads with the indexed grid's cells. Quads run in the old loop order, cells row by row; transposed when the
+// old outer loop was the grid's inner one. Returns the number of mismatched corners, with the largest difference in worst.
+static int compare(int n, bool transposed, const std::vector<Vector3>& quadVertex, const std::vector<Vector3>& quadNormals,
+	const std::vector<float>& quadTexCoords, const std::vector<Vector3>& vertex, const std::vector<Vector3>& normals,
+	const std::vector<float>& texCoords, const std::vector<unsigned int>& indices, float& worst)
+{
+	worst = 0.0f;
+	if (quadVertex.size() != (size_t)n * n * 4 || indices.size() != (size_t)n * n * 6)
+	{
+		return n * n * 4;
+	}
+
+	int mismatches = 0;
+	for (int quad = 0; quad < n * n; quad++)
+	{
+		int cell = transposed ? (quad % n) * n + quad / n : quad;
+		const unsigned int* triangles = &indices[cell * 6];
+		if (triangles[3] != triangles[0] || triangles[4] != triangles[2])
+		{
+			mismatches += 4;
+			continue;
+		}
+
+		// The quad's corners in order are the first triangle's three then the second's last.
+		unsigned int corners[4] = { triangles[0], triangles[1], triangles[2], triangles[5] };
+		for (int i = 0; i < 4; i++)
+		{
+			int k = quad * 4 + i;
+			unsigned int v = corners[i];
+			if (v >= vertex.size())
+			{
+				mismatches++;
+				continue;
+			}
+			float d = fmaxf(difference(quadVertex[k], vertex[v]), difference(quadNormals[k], normals[v]));
+			d = fmaxf(d, fmaxf(fabsf(quadTexCoords[k * 2] - texCoords[v * 2]), fabsf(quadTexCoords[k * 2 + 1] - texCoords[v * 2 + 1])));
+			worst = fmaxf(worst, d);
+			if (d > tolerance)
+			{
+				mismatches++;
+			}
+		}
+	}
+	return mismatches;
+}
+
+int main()
+{
+	const int segmentCounts[] = { 7, 20, 24, 64, 128 };
+	const char* names[] = { "sphere", "cylinder", "torus" };
+	bool passed = true;
+
+	printf("%10s %10s %10s %10s %12s %12s\n", "shape", "segments", "quad verts", "grid verts", "worst diff", "mismatches");
+	for (int s = 0; s < (int)(sizeof(segmentCounts) / sizeof(segmentCounts[0])); s++)
+	{
+		int n = segmentCounts[s];
+		float segments = (float)n;
+		for (int shape = 0; shape < 3; shape++)
+		{
+			std::vector<Vector3> quadVertex, quadNormals, vertex, normals;
+			std::vector<float> quadTexCoords, texCoords;
+			std::vector<unsigned int> indices;
+			switch (shape)
+			{
+			case 0:
+				quadSphere(1.0f, segments, quadVertex, quadNormals, quadTexCoords);
+				ShapeGen::genSphere(1.0f, segments, vertex, normals, texCoords, indices);
+				break;
+			case 1:
+				quadCylinder(0.5f, segments, quadVertex, quadNormals, quadTexCoords);
+				ShapeGen::genCylinder(0.5f, segments, segments, vertex, normals, texCoords, indices);
+				break;
+			default:
+				quadTorus(0.325f, segments, quadVertex, quadNormals, quadTexCoords);
+				ShapeGen::genTorus(0.325f, segments, vertex, normals, texCoords, indices);
+				break;
+			}
+
+			// The old cylinder ran along its length in the outer loop, the grid runs round it.
+			float worst;
+			int mismatches = compare(n, shape == 1, quadVertex, quadNormals, quadTexCoords, vertex, normals, texCoords, indices, worst);
+			printf("%10s %10d %10d %10d %12.3g %12d\n", names[shape], n, (int)quadVertex.size(), (int)vertex.size(), worst, mismatches);
+			passed = passed && mismatches == 0;
+		}
+	}
+
+	if (!passed)
+	{
+		printf("Indexed grids differ from the GL_QUADS surfaces\n");
+		return 1;
+	}
+	return 0;
+}